@@ -0,0 +1,1239 @@
+ABI_CHECK = False
+AR = '/usr/bin/ar'
+ARFLAGS = 'rcs'
+AUTH_SHARED = ['auth_script', 'auth_skel']
+AUTH_STATIC = ['auth_sam', 'auth_unix', 'auth_winbind', 'auth_wbc', 'auth_server', 'auth_domain', 'auth_builtin', 'auth_netlogond', 'auth_samba4']
+AUTOCONF_BUILD = ''
+AUTOCONF_HOST = ''
+AUTOCONF_PROGRAM_PREFIX = ''
+AWK = '/usr/bin/awk'
+BINDIR = '/usr/local/samba/bin'
+BROKEN_NISPLUS_INCLUDE_FILES = 1
+BUILD_DIRECTORY = '/root/repo/bin'
+BUILD_FARM = None
+BUILD_SYSTEM = 'Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux'
+BUILD_TDB2 = False
+BUILTIN_LIBRARIES = ['NONE']
+BUNDLED_LIBS = ['']
+CACHEDIR = '/usr/local/samba/var/cache'
+CC = ['/usr/bin/gcc']
+CCDEFINES = ['_SAMBA_BUILD_=4', 'HAVE_CONFIG_H=1', '_GNU_SOURCE=1', '_XOPEN_SOURCE_EXTENDED=1', 'HAVE_CONFIG_H=1']
+CCDEFINES_ST = '-D%s'
+CCFLAGS_DEBUG = ['-g']
+CCFLAGS_MACBUNDLE = ['-fPIC']
+CCFLAGS_PYEMBED = ['-fno-strict-aliasing']
+CCFLAGS_PYEXT = ['-fno-strict-aliasing']
+CCFLAGS_RELEASE = ['-O2']
+CCFLAGS_crypt = []
+CCFLAGS_gcrypt = []
+CCFLAGS_gnutls = ['-I/usr/include/p11-kit-1']
+CCFLAGS_gpg-error = []
+CCFLAGS_ncurses = []
+CCFLAGS_nsl = []
+CCFLAGS_pthread = []
+CCFLAGS_readline = []
+CCFLAGS_resolv = []
+CCFLAGS_rt = []
+CCFLAGS_uuid = []
+CCFLAGS_z = []
+CCLNK_SRC_F = ''
+CCLNK_TGT_F = ['-o', '']
+CC_NAME = 'gcc'
+CC_SRC_F = ''
+CC_TGT_F = ['-c', '-o', '']
+CC_VERSION = ('12', '2', '0')
+CHARSET_SHARED = []
+CHARSET_STATIC = ['charset_weird']
+CLUSTER_SUPPORT = ()
+CODEPAGEDIR = '/usr/local/samba/share/codepages'
+COMPILER_CC = 'gcc'
+COMPILER_SUPPORTS_LL = 1
+CONFIGDIR = '/usr/local/samba/etc'
+CONFIGFILE = '/usr/local/samba/etc/smb.conf'
+CONFIG_H_IS_FROM_SAMBA = 1
+CPP = '/usr/bin/cpp'
+CPPPATH_GNUTLS = ['/usr/include/p11-kit-1']
+CPPPATH_PYEMBED = ['/root/.pyenv/versions/2.7.18/include/python2.7']
+CPPPATH_PYEXT = ['/root/.pyenv/versions/2.7.18/include/python2.7']
+CPPPATH_ST = '-I%s'
+CROSS_ANSWERS = ''
+CROSS_COMPILE = False
+CROSS_EXECUTE = ''
+CUPS_CONFIG = ''
+DATADIR = '/usr/local/samba/share'
+DATAROOTDIR = '/usr/local/samba/share'
+DEFAULT_DOS_CHARSET = 'CP850'
+DEFAULT_UNIX_CHARSET = 'UTF-8'
+DEST_BINFMT = 'elf'
+DEST_CPU = 'x86_64'
+DEST_OS = 'linux'
+DEVELOPER = True
+DEVELOPER_MODE = True
+DISABLE_SHARED = False
+DLOPEN_TAKES_UNSIGNED_FLAGS = ()
+DOCDIR = '/usr/local/samba/share/doc/samba'
+DVIDIR = '/usr/local/samba/share/doc/samba'
+ENABLE_GNUTLS = 1
+EXEC_PREFIX = '/usr/local/samba'
+EXTRA_CFLAGS = ['-DDEVELOPER', '-DDEBUG_PASSWORD', '-fPIC', '-DDEVELOPER', '-DDEBUG_PASSWORD', '-D_REENTRANT', '-D_POSIX_PTHREAD_SEMANTICS', '-Wall', '-g', '-Wshadow', '-Wstrict-prototypes', '-Wpointer-arith', '-Wcast-align', '-Wwrite-strings', '-Werror-implicit-function-declaration', '-Wformat=2', '-Wno-format-y2k', '-Wmissing-prototypes', '-fno-common', '-Wcast-qual']
+EXTRA_INCLUDES = ['#include/public', '#source4', '#lib', '#source4/lib', '#source4/include', '#include', '#lib/replace', '#lib']
+EXTRA_LDFLAGS = ['-Wl,-no-undefined', '-Wl,-no-undefined', '-Wl,-no-undefined', '-Wl,-no-undefined', '-Wl,--export-dynamic', '-lpthread', '-Wl,-no-undefined', '-Wl,--as-needed']
+FOUND_SYSTEMLIB_com_err = False
+FOUND_SYSTEMLIB_ldb = False
+FOUND_SYSTEMLIB_popt = False
+FOUND_SYSTEMLIB_pyldb-util = False
+FOUND_SYSTEMLIB_pytalloc-util = False
+FOUND_SYSTEMLIB_subunit = False
+FOUND_SYSTEMLIB_talloc = False
+FOUND_SYSTEMLIB_tdb = False
+FOUND_SYSTEMLIB_tevent = False
+FULLSTATIC_MARKER = '-static'
+GETCWD_TAKES_NULL = 1
+GIT = '/usr/bin/git'
+GIT_LOCAL_CHANGES = False
+GLOBAL_DEPENDENCIES = ['nss_wrapper', 'socket_wrapper', 'uid_wrapper']
+GPEXT_SHARED = []
+GPEXT_STATIC = []
+HAVE_ACL_GET_FILE = ()
+HAVE_ADDR_TYPE_IN_KRB5_ADDRESS = 1
+HAVE_ADD_PROPLIST_ENTRY = ()
+HAVE_AIO = 1
+HAVE_AIO64 = 1
+HAVE_AIOCB64 = '1'
+HAVE_AIO_CANCEL = 1
+HAVE_AIO_CANCEL64 = 1
+HAVE_AIO_ERROR = 1
+HAVE_AIO_ERROR64 = 1
+HAVE_AIO_FSYNC = 1
+HAVE_AIO_FSYNC64 = 1
+HAVE_AIO_H = 1
+HAVE_AIO_READ = 1
+HAVE_AIO_READ64 = 1
+HAVE_AIO_RETURN = 1
+HAVE_AIO_RETURN64 = 1
+HAVE_AIO_SUSPEND = 1
+HAVE_AIO_SUSPEND64 = 1
+HAVE_AIO_WRITE = 1
+HAVE_AIO_WRITE64 = 1
+HAVE_ALLOCA_H = 1
+HAVE_AP_OPTS_USE_SUBKEY = 1
+HAVE_ARPA_INET_H = 1
+HAVE_ARPA_NAMESER_H = 1
+HAVE_ASM_TYPES_H = 1
+HAVE_ASM_UNISTD_H = 1
+HAVE_ASPRINTF = 1
+HAVE_ASSERT_H = 1
+HAVE_ATEXIT = 1
+HAVE_ATTRIBUTE_COLD = 1
+HAVE_ATTRIBUTE_CONST = 1
+HAVE_ATTRIBUTE_NORETURN = 1
+HAVE_ATTRIBUTE_PRINTF = 1
+HAVE_ATTRIBUTE_UNUSED = 1
+HAVE_ATTRIBUTE_USED = 1
+HAVE_ATTROPEN = ()
+HAVE_ATTR_GETF = ()
+HAVE_ATTR_LIST = ()
+HAVE_ATTR_LISTF = ()
+HAVE_ATTR_REMOVE = ()
+HAVE_ATTR_REMOVEF = ()
+HAVE_ATTR_SET = ()
+HAVE_ATTR_SETF = ()
+HAVE_AVAHI_CLIENT_NEW = ()
+HAVE_AVAHI_STRERROR = ()
+HAVE_BACKTRACE = 1
+HAVE_BACKTRACE_SYMBOLS = 1
+HAVE_BER_SCANF = ()
+HAVE_BER_SOCKBUF_ADD_IO = ()
+HAVE_BER_TAG_T = ()
+HAVE_BIG_ENDIAN = ()
+HAVE_BINDTEXTDOMAIN = 1
+HAVE_BIND_TEXTDOMAIN_CODESET = 1
+HAVE_BLKCNT_T = 1
+HAVE_BLKSIZE_T = 1
+HAVE_BOOL = 1
+HAVE_BROKEN_FCNTL64_LOCKS = ()
+HAVE_BSD_STRTOLL = ()
+HAVE_BSWAP16 = ()
+HAVE_BSWAP32 = ()
+HAVE_BUILTIN_CHOOSE_EXPR = 1
+HAVE_BUILTIN_CLZ = 1
+HAVE_BUILTIN_CLZL = 1
+HAVE_BUILTIN_CLZLL = 1
+HAVE_BUILTIN_CONSTANT_P = 1
+HAVE_BUILTIN_EXPECT = 1
+HAVE_BUILTIN_POPCOUNTL = 1
+HAVE_BUILTIN_TYPES_COMPATIBLE_P = 1
+HAVE_BZERO = 1
+HAVE_C99_VSNPRINTF = 1
+HAVE_CAP_GET_PROC = ()
+HAVE_CGETENT = ()
+HAVE_CHARSET_CP850 = 1
+HAVE_CHARSET_UTF_8 = 1
+HAVE_CHECKSUM_IN_KRB5_CHECKSUM = 1
+HAVE_CHFLAGS = ()
+HAVE_CHMOD = 1
+HAVE_CHOWN = 1
+HAVE_CHROOT = 1
+HAVE_CHSIZE = ()
+HAVE_CLOCK_GETTIME = 1
+HAVE_CLOCK_MONOTONIC = 1
+HAVE_CLOCK_PROCESS_CPUTIME_ID = 1
+HAVE_CLOCK_REALTIME = 1
+HAVE_CLOSEDIR64 = ()
+HAVE_CLOSEFROM = 1
+HAVE_COMPARISON_FN_T = 1
+HAVE_COMPILER_WILL_OPTIMIZE_OUT_FNS = 1
+HAVE_COMPOUND_LITERALS = 1
+HAVE_COM_ERR = ()
+HAVE_COM_ERR_H = 1
+HAVE_COM_RIGHT_R = ()
+HAVE_CONFIG_H = 1
+HAVE_CONNECT = 1
+HAVE_CPPFUNCTION = 1
+HAVE_CREAT64 = 1
+HAVE_CRYPT = 1
+HAVE_CRYPT16 = ()
+HAVE_CRYPT_H = 1
+HAVE_CTDB_H = ()
+HAVE_CTYPE_H = 1
+HAVE_CUPS = ()
+HAVE_CURSES_H = 1
+HAVE_DARWIN_INITGROUPS = ()
+HAVE_DECL_ASPRINTF = 1
+HAVE_DECL_DLOPEN = 1
+HAVE_DECL_FDATASYNC = 1
+HAVE_DECL_GETGRENT_R = 1
+HAVE_DECL_GETPWENT_R = 1
+HAVE_DECL_H_ERRNO = 1
+HAVE_DECL_KRB5_AUTH_CON_SET_REQ_CKSUMTYPE = 0
+HAVE_DECL_KRB5_GET_CREDENTIALS_FOR_USER = 0
+HAVE_DECL_READAHEAD = 1
+HAVE_DECL_RL_EVENT_HOOK = 1
+HAVE_DECL_SNPRINTF = 1
+HAVE_DECL_VASPRINTF = 1
+HAVE_DECL_VSNPRINTF = 1
+HAVE_DECL__RES = 1
+HAVE_DELPROPLIST = ()
+HAVE_DEVICE_MAJOR_FN = ()
+HAVE_DEVICE_MINOR_FN = ()
+HAVE_DEVNM = ()
+HAVE_DGETTEXT = 1
+HAVE_DIRENT_D_OFF = 1
+HAVE_DIRENT_H = 1
+HAVE_DIRFD = 1
+HAVE_DIRFD_DECL = 1
+HAVE_DIR_DD_FD = ()
+HAVE_DLCLOSE = 1
+HAVE_DLERROR = 1
+HAVE_DLFCN_H = 1
+HAVE_DLOPEN = 1
+HAVE_DLSYM = 1
+HAVE_DNSSERVICEREGISTER = ()
+HAVE_DNS_SEARCH = ()
+HAVE_DN_EXPAND = 1
+HAVE_DPRINTF = 1
+HAVE_DUP2 = 1
+HAVE_ENCTYPE_AES128_CTS_HMAC_SHA1_96 = 1
+HAVE_ENCTYPE_AES256_CTS_HMAC_SHA1_96 = 1
+HAVE_ENCTYPE_ARCFOUR_HMAC = 1
+HAVE_ENCTYPE_ARCFOUR_HMAC_MD5 = 1
+HAVE_ENDHOSTENT = 1
+HAVE_ENDIAN_H = 1
+HAVE_ENDMNTENT = 1
+HAVE_ENDNETGRENT = 1
+HAVE_ENDNETGRENT_PROTOTYPE = 1
+HAVE_ENVIRON_DECL = 1
+HAVE_EPOLL = 1
+HAVE_EPOLL_CREATE = 1
+HAVE_ERR = 1
+HAVE_ERRNO_DECL = 1
+HAVE_ERRNO_H = 1
+HAVE_ERRX = 1
+HAVE_ERR_H = 1
+HAVE_ETYPE_IN_ENCRYPTEDDATA = 1
+HAVE_EVENTFD = 1
+HAVE_EXECINFO_H = 1
+HAVE_EXECL = 1
+HAVE_EXPLICIT_LARGEFILE_SUPPORT = 1
+HAVE_EXTATTR_DELETE_FD = ()
+HAVE_EXTATTR_DELETE_LINK = ()
+HAVE_EXTATTR_GET_FD = ()
+HAVE_EXTATTR_GET_FILE = ()
+HAVE_EXTATTR_GET_LINK = ()
+HAVE_EXTATTR_LIST_FD = ()
+HAVE_EXTATTR_LIST_FILE = ()
+HAVE_EXTATTR_LIST_LINK = ()
+HAVE_EXTATTR_SET_FD = ()
+HAVE_EXTATTR_SET_FILE = ()
+HAVE_EXTATTR_SET_LINK = ()
+HAVE_E_DATA_POINTER_IN_KRB5_ERROR = 1
+HAVE_FALLOCATE = 1
+HAVE_FALLOCATE64 = 1
+HAVE_FCHMOD = 1
+HAVE_FCHOWN = 1
+HAVE_FCNTL_H = 1
+HAVE_FCNTL_LOCK = 1
+HAVE_FCVT = 1
+HAVE_FCVTL = ()
+HAVE_FDATASYNC = 1
+HAVE_FDATASYNC_DECL = 1
+HAVE_FDELPROPLIST = ()
+HAVE_FDOPENDIR = 1
+HAVE_FDOPENDIR64 = ()
+HAVE_FGETEA = ()
+HAVE_FGETPROPLIST = ()
+HAVE_FGETXATTR = 1
+HAVE_FLISTEA = ()
+HAVE_FLISTXATTR = 1
+HAVE_FLOAT_H = 1
+HAVE_FLOCK = 1
+HAVE_FNMATCH_H = 1
+HAVE_FOPEN64 = 1
+HAVE_FREEADDRINFO = 1
+HAVE_FREEHOSTENT = ()
+HAVE_FREEIFADDRS = 1
+HAVE_FREE_AP_REQ = 1
+HAVE_FREMOVEEA = ()
+HAVE_FREMOVEXATTR = 1
+HAVE_FRSIZE = 1
+HAVE_FSEEK64 = ()
+HAVE_FSEEKO = 1
+HAVE_FSEEKO64 = 1
+HAVE_FSETEA = ()
+HAVE_FSETPROPLIST = ()
+HAVE_FSETXATTR = 1
+HAVE_FSID_INT = 1
+HAVE_FSTAT64 = 1
+HAVE_FSYNC = 1
+HAVE_FTELL64 = ()
+HAVE_FTELLO64 = 1
+HAVE_FTRUNCATE = 1
+HAVE_FTRUNCATE64 = 1
+HAVE_FTRUNCATE_EXTEND = 1
+HAVE_FUNCTION_ATTRIBUTE_DESTRUCTOR = 1
+HAVE_FUNCTION_MACRO = 1
+HAVE_FUTIMENS = 1
+HAVE_FUTIMES = 1
+HAVE_F_SETLEASE_DECL = 1
+HAVE_GAI_STRERROR = 1
+HAVE_GCRYPT_H = 1
+HAVE_GCRY_CONTROL = 1
+HAVE_GETADDRINFO = 1
+HAVE_GETAUTHUID = ()
+HAVE_GETCWD = 1
+HAVE_GETDENTS = ()
+HAVE_GETDENTS64 = 1
+HAVE_GETDIRENTRIES = 1
+HAVE_GETGRENT = 1
+HAVE_GETGRENT_R = 1
+HAVE_GETGRENT_R_DECL = 1
+HAVE_GETGRGID_R = 1
+HAVE_GETGRNAM = 1
+HAVE_GETGRNAM_R = 1
+HAVE_GETGROUPLIST = 1
+HAVE_GETGRSET = ()
+HAVE_GETHOSTBYADDR = 1
+HAVE_GETHOSTBYNAME = 1
+HAVE_GETHOSTBYNAME_R = 1
+HAVE_GETHOSTENT = 1
+HAVE_GETHOSTENT_R = 1
+HAVE_GETHOSTNAME = 1
+HAVE_GETIFADDRS = 1
+HAVE_GETIPNODEBYADDR = ()
+HAVE_GETIPNODEBYNAME = ()
+HAVE_GETMNTENT = 1
+HAVE_GETNAMEINFO = 1
+HAVE_GETNETGRENT = 1
+HAVE_GETNETGRENT_PROTOTYPE = 1
+HAVE_GETOPT_H = 1
+HAVE_GETPAGESIZE = 1
+HAVE_GETPASS = 1
+HAVE_GETPASSPHRASE = ()
+HAVE_GETPGRP = 1
+HAVE_GETPROGNAME = ()
+HAVE_GETPROPLIST = ()
+HAVE_GETPWANAM = ()
+HAVE_GETPWENT_R = 1
+HAVE_GETPWENT_R_DECL = 1
+HAVE_GETPWNAM = 1
+HAVE_GETPWNAM_R = 1
+HAVE_GETPWUID_R = 1
+HAVE_GETRLIMIT = 1
+HAVE_GETSPNAM = 1
+HAVE_GETTEXT = 1
+HAVE_GETTIMEOFDAY_TZ = 1
+HAVE_GETUTMPX = 1
+HAVE_GETUTXENT = 1
+HAVE_GETXATTR = 1
+HAVE_GET_CURRENT_DIR_NAME = 1
+HAVE_GET_PROPLIST_ENTRY = ()
+HAVE_GLOB = 1
+HAVE_GLOB_H = 1
+HAVE_GNUTLS = 1
+HAVE_GNUTLS_DATUM = 1
+HAVE_GNUTLS_DATUM_T = 1
+HAVE_GNUTLS_GLOBAL_INIT = 1
+HAVE_GNUTLS_GNUTLS_H = 1
+HAVE_GNUTLS_X509_CRT_SET_SUBJECT_KEY_ID = 1
+HAVE_GNUTLS_X509_CRT_SET_VERSION = 1
+HAVE_GNUTLS_X509_H = 1
+HAVE_GPG_ERR_CODE_FROM_ERRNO = 1
+HAVE_GRANTPT = 1
+HAVE_GRP_H = 1
+HAVE_GSSAPI = 1
+HAVE_GSSAPI_GSSAPI_H = 1
+HAVE_GSSAPI_GSSAPI_KRB5_H = 1
+HAVE_GSSKRB5_EXTRACT_AUTHZ_DATA_FROM_SEC_CONTEXT = 1
+HAVE_GSSKRB5_GET_SUBKEY = 1
+HAVE_GSS_DISPLAY_STATUS = 1
+HAVE_GSS_INQUIRE_SEC_CONTEXT_BY_OID = 1
+HAVE_GSS_KRB5_IMPORT_CRED = 1
+HAVE_GSS_OID_EQUAL = 1
+HAVE_GSS_WRAP_IOV = 1
+HAVE_HISTORY_LIST = 1
+HAVE_HSTRERROR = 1
+HAVE_HTTPCONNECT = ()
+HAVE_HTTPCONNECTENCRYPT = ()
+HAVE_H_ERRNO = 1
+HAVE_ICONV = 1
+HAVE_ICONV_H = 1
+HAVE_ICONV_OPEN = 1
+HAVE_IFACE_GETIFADDRS = 1
+HAVE_IFADDRS_H = 1
+HAVE_IF_NAMETOINDEX = 1
+HAVE_IMMEDIATE_STRUCTURES = 1
+HAVE_INET_ATON = 1
+HAVE_INET_NTOA = 1
+HAVE_INET_NTOP = 1
+HAVE_INET_PTON = 1
+HAVE_INITGROUPS = 1
+HAVE_INITIALIZE_KRB5_ERROR_TABLE = 1
+HAVE_INNETGR = 1
+HAVE_INOTIFY = 1
+HAVE_INOTIFY_INIT = 1
+HAVE_INO_T = 1
+HAVE_INT16_T = 1
+HAVE_INT32_T = 1
+HAVE_INT64_T = 1
+HAVE_INT8_T = 1
+HAVE_INTPTR_T = 1
+HAVE_INTTYPES_H = 1
+HAVE_IPV6 = 1
+HAVE_IPV6_V6ONLY = 1
+HAVE_IRUSEROK = 1
+HAVE_ISATTY = 1
+HAVE_ISBLANK = 1
+HAVE_KERNEL_CHANGE_NOTIFY = 1
+HAVE_KERNEL_OPLOCKS_IRIX = ()
+HAVE_KERNEL_OPLOCKS_LINUX = 1
+HAVE_KERNEL_SHARE_MODES = 1
+HAVE_KRB5 = '1'
+HAVE_KRB5_ADDRESSES = 1
+HAVE_KRB5_AUTH_CON_SETKEY = 1
+HAVE_KRB5_CRYPTO = 1
+HAVE_KRB5_CRYPTO_DESTROY = 1
+HAVE_KRB5_CRYPTO_INIT = 1
+HAVE_KRB5_C_ENCTYPE_COMPARE = 1
+HAVE_KRB5_C_VERIFY_CHECKSUM = 1
+HAVE_KRB5_DECODE_AP_REQ = 1
+HAVE_KRB5_ENCTYPE_TO_STRING = 1
+HAVE_KRB5_ENCTYPE_TO_STRING_WITH_KRB5_CONTEXT_ARG = 1
+HAVE_KRB5_FREE_ERROR_CONTENTS = 1
+HAVE_KRB5_FREE_HOST_REALM = 1
+HAVE_KRB5_FWD_TGT_CREDS = 1
+HAVE_KRB5_GET_CREDS = 1
+HAVE_KRB5_GET_CREDS_OPT_ALLOC = 1
+HAVE_KRB5_GET_CREDS_OPT_SET_IMPERSONATE = 1
+HAVE_KRB5_GET_DEFAULT_IN_TKT_ETYPES = 1
+HAVE_KRB5_GET_HOST_REALM = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_ALLOC = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_FREE = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_GET_ERROR = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_SET_PAC_REQUEST = 1
+HAVE_KRB5_GET_PW_SALT = 1
+HAVE_KRB5_GET_RENEWED_CREDS = 1
+HAVE_KRB5_H = 1
+HAVE_KRB5_KEYBLOCK_KEYVALUE = 1
+HAVE_KRB5_KEYTAB_ENTRY_KEYBLOCK = 1
+HAVE_KRB5_KRBHST_GET_ADDRINFO = 1
+HAVE_KRB5_KRBHST_INIT = 1
+HAVE_KRB5_KT_COMPARE = 1
+HAVE_KRB5_KT_FREE_ENTRY = 1
+HAVE_KRB5_KU_OTHER_CKSUM = 1
+HAVE_KRB5_LOCATE_PLUGIN_H = 1
+HAVE_KRB5_MK_REQ_EXTENDED = 1
+HAVE_KRB5_PDU_NONE_DECL = 1
+HAVE_KRB5_PRINCIPAL_COMPARE_ANY_REALM = 1
+HAVE_KRB5_PRINCIPAL_GET_COMP_STRING = 1
+HAVE_KRB5_PRINCIPAL_GET_REALM = 1
+HAVE_KRB5_REALM_TYPE = 1
+HAVE_KRB5_SESSION_IN_CREDS = 1
+HAVE_KRB5_SET_DEFAULT_IN_TKT_ETYPES = 1
+HAVE_KRB5_SET_REAL_TIME = 1
+HAVE_KRB5_STRING_TO_KEY = 1
+HAVE_KRB5_STRING_TO_KEY_SALT = 1
+HAVE_KRB_STRUCT_WINSIZE = 1
+HAVE_LANGINFO_H = 1
+HAVE_LARGEFILE = 1
+HAVE_LASTLOG_H = 1
+HAVE_LBER_LOG_PRINT_FN = ()
+HAVE_LCHOWN = 1
+HAVE_LDAP_ADD_RESULT_ENTRY = ()
+HAVE_LDAP_INIT = ()
+HAVE_LDAP_INITIALIZE = ()
+HAVE_LDAP_INIT_FD = ()
+HAVE_LDAP_OPT_SOCKBUF = ()
+HAVE_LDAP_SET_REBIND_PROC = ()
+HAVE_LD_VERSION_SCRIPT = True
+HAVE_LGETEA = ()
+HAVE_LGETXATTR = 1
+HAVE_LIBCRYPT = 1
+HAVE_LIBGCRYPT = 1
+HAVE_LIBGNUTLS = 1
+HAVE_LIBGPG_ERROR = 1
+HAVE_LIBGSSAPI = 1
+HAVE_LIBINTL_H = 1
+HAVE_LIBKRB5 = 1
+HAVE_LIBNCURSES = 1
+HAVE_LIBNSL = 1
+HAVE_LIBPTHREAD = 1
+HAVE_LIBREADLINE = 1
+HAVE_LIBREPLACE = 1
+HAVE_LIBRESOLV = 1
+HAVE_LIBRT = 1
+HAVE_LIBUUID = 1
+HAVE_LIBZ = 1
+HAVE_LIMITS_H = 1
+HAVE_LINK = 1
+HAVE_LINUX_DQBLK_XFS_H = 1
+HAVE_LINUX_FALLOCATE = 1
+HAVE_LINUX_FALLOCATE64 = 1
+HAVE_LINUX_FALLOC_H = 1
+HAVE_LINUX_FCNTL_H = 1
+HAVE_LINUX_INOTIFY_H = 1
+HAVE_LINUX_IO_URING = 1
+HAVE_LINUX_IO_URING_H = 1
+HAVE_LINUX_NETLINK_H = 1
+HAVE_LINUX_READAHEAD = 1
+HAVE_LINUX_RTNETLINK_H = 1
+HAVE_LINUX_SPLICE = 1
+HAVE_LINUX_TYPES_H = 1
+HAVE_LISTEA = ()
+HAVE_LISTXATTR = 1
+HAVE_LITTLE_ENDIAN = 1
+HAVE_LLISTEA = ()
+HAVE_LLISTXATTR = 1
+HAVE_LLSEEK = ()
+HAVE_LOCALE_H = 1
+HAVE_LOFF_T = 1
+HAVE_LONGLONG = 1
+HAVE_LONG_LONG = 1
+HAVE_LREMOVEEA = ()
+HAVE_LREMOVEXATTR = 1
+HAVE_LSEEK64 = 1
+HAVE_LSETEA = ()
+HAVE_LSETXATTR = 1
+HAVE_LSTAT = 1
+HAVE_LSTAT64 = 1
+HAVE_LUTIMES = 1
+HAVE_MAKEDEV = ()
+HAVE_MALLOC_H = 1
+HAVE_MEMALIGN = 1
+HAVE_MEMCPY = 1
+HAVE_MEMMEM = 1
+HAVE_MEMMOVE = 1
+HAVE_MEMORY_H = 1
+HAVE_MEMSET = 1
+HAVE_MKDIR_MODE = 1
+HAVE_MKDTEMP = 1
+HAVE_MKNOD = 1
+HAVE_MKNOD64 = ()
+HAVE_MKTIME = 1
+HAVE_MLOCK = 1
+HAVE_MLOCKALL = 1
+HAVE_MMAP = 1
+HAVE_MNTENT_H = 1
+HAVE_MSGHDR_MSG_ACCTRIGHTS = ()
+HAVE_MSGHDR_MSG_CONTROL = 1
+HAVE_MUNLOCK = 1
+HAVE_MUNLOCKALL = 1
+HAVE_NANOSLEEP = 1
+HAVE_NATIVE_ICONV = 1
+HAVE_NETDB_H = 1
+HAVE_NETINET_IN_H = 1
+HAVE_NETINET_IN_SYSTM_H = 1
+HAVE_NETINET_IP_H = 1
+HAVE_NETINET_TCP_H = 1
+HAVE_NET_IF_H = 1
+HAVE_NEW_LIBREADLINE = 1
+HAVE_NSS_H = 1
+HAVE_OFFSET_T = ()
+HAVE_OPEN64 = 1
+HAVE_OPENDIR64 = ()
+HAVE_OPENPTY = 1
+HAVE_PAM_GET_DATA = ()
+HAVE_PAM_RADIO_TYPE = ()
+HAVE_PAM_RHOST = ()
+HAVE_PAM_START = ()
+HAVE_PAM_TTY = ()
+HAVE_PAM_VSYSLOG = ()
+HAVE_PATHCONF = 1
+HAVE_PEERCRED = 1
+HAVE_PERL_MAKEMAKER = 1
+HAVE_PIPE = 1
+HAVE_POLL = 1
+HAVE_POLL_H = 1
+HAVE_POSIX_ACLS = ()
+HAVE_POSIX_FADVISE = 1
+HAVE_POSIX_FALLOCATE = 1
+HAVE_POSIX_FALLOCATE64 = 1
+HAVE_POSIX_MEMALIGN = 1
+HAVE_PRCTL = 1
+HAVE_PREAD = 1
+HAVE_PREAD64 = 1
+HAVE_PREAD_DECL = 1
+HAVE_PRINTF = 1
+HAVE_PTHREAD = '1'
+HAVE_PTHREAD_ATTR_INIT = 1
+HAVE_PTHREAD_CREATE = 1
+HAVE_PTHREAD_H = 1
+HAVE_PTHREAD_MUTEXATTR_SETROBUST = 1
+HAVE_PTHREAD_MUTEX_CONSISTENT = 1
+HAVE_PTRDIFF_T = 1
+HAVE_PTY_H = 1
+HAVE_PUTENV = 1
+HAVE_PUTUTLINE = 1
+HAVE_PUTUTXLINE = 1
+HAVE_PWD_H = 1
+HAVE_PWRITE = 1
+HAVE_PWRITE64 = 1
+HAVE_PWRITE_DECL = 1
+HAVE_PYTHON_H = 1
+HAVE_RAND = 1
+HAVE_RANDOM = 1
+HAVE_RCMD = 1
+HAVE_RDCHK = ()
+HAVE_READAHEAD_DECL = 1
+HAVE_READDIR64 = 1
+HAVE_READLINE_HISTORY_H = 1
+HAVE_READLINE_READLINE_H = 1
+HAVE_READLINK = 1
+HAVE_READV = 1
+HAVE_REALPATH = 1
+HAVE_REMOVEEA = ()
+HAVE_REMOVEXATTR = 1
+HAVE_RENAME = 1
+HAVE_RESOLV_H = 1
+HAVE_RES_NDESTROY = ()
+HAVE_RES_NSEARCH = 1
+HAVE_RES_SEARCH = 1
+HAVE_REWINDDIR64 = ()
+HAVE_RL_COMPLETION_FUNC_T = ()
+HAVE_RL_COMPLETION_MATCHES = 1
+HAVE_RPCSVC_YPCLNT_H = 1
+HAVE_SA_FAMILY_T = 1
+HAVE_SA_SIGINFO_DECL = 1
+HAVE_SECURE_MKSTEMP = 1
+HAVE_SEEKDIR64 = ()
+HAVE_SELECT = 1
+HAVE_SENDFILE64 = '1'
+HAVE_SENDMSG = 1
+HAVE_SETBUFFER = 1
+HAVE_SETEA = ()
+HAVE_SETEGID = 1
+HAVE_SETENV = 1
+HAVE_SETENV_DECL = 1
+HAVE_SETEUID = 1
+HAVE_SETGIDX = ()
+HAVE_SETGROUPS = 1
+HAVE_SETHOSTENT = 1
+HAVE_SETITIMER = 1
+HAVE_SETJMP_H = 1
+HAVE_SETLINEBUF = 1
+HAVE_SETLOCALE = 1
+HAVE_SETLUID = ()
+HAVE_SETMNTENT = 1
+HAVE_SETNETGRENT = 1
+HAVE_SETNETGRENT_PROTOTYPE = 1
+HAVE_SETPGID = 1
+HAVE_SETPRIV = ()
+HAVE_SETPROGNAME = ()
+HAVE_SETPROPLIST = ()
+HAVE_SETREGID = 1
+HAVE_SETRESGID = 1
+HAVE_SETRESGID_DECL = 1
+HAVE_SETRESUID = 1
+HAVE_SETRESUID_DECL = 1
+HAVE_SETREUID = 1
+HAVE_SETSID = 1
+HAVE_SETUIDX = ()
+HAVE_SETXATTR = 1
+HAVE_SHADOW_H = 1
+HAVE_SHL_FINDSYM = ()
+HAVE_SHL_LOAD = ()
+HAVE_SHL_UNLOAD = ()
+HAVE_SHMGET = 1
+HAVE_SHM_OPEN = 1
+HAVE_SIGACTION = 1
+HAVE_SIGBLOCK = 1
+HAVE_SIGNAL_H = 1
+HAVE_SIGPROCMASK = 1
+HAVE_SIGSET = 1
+HAVE_SIG_ATOMIC_T_TYPE = 1
+HAVE_SIMPLE_C_PROG = 1
+HAVE_SIZEOF_PROPLIST_ENTRY = ()
+HAVE_SIZE_T = 1
+HAVE_SNPRINTF = 1
+HAVE_SOCKADDR_SA_LEN = ()
+HAVE_SOCKET = 1
+HAVE_SOCKETPAIR = 1
+HAVE_SOCKLEN_T = 1
+HAVE_SOCK_SIN_LEN = ()
+HAVE_SPLICE_DECL = 1
+HAVE_SRAND = 1
+HAVE_SRANDOM = 1
+HAVE_SSIZE_T = 1
+HAVE_SS_FAMILY = 1
+HAVE_STAT64 = 1
+HAVE_STATFS_F_FSID = 1
+HAVE_STATVFS = 1
+HAVE_STATVFS_F_FLAG = 1
+HAVE_STATVFS_F_FLAGS = ()
+HAVE_STAT_HIRES_TIMESTAMPS = '1'
+HAVE_STAT_ST_BLKSIZE = 1
+HAVE_STAT_ST_BLOCKS = 1
+HAVE_STAT_ST_FLAGS = ()
+HAVE_STAT_TV_NSEC = 1
+HAVE_STDARG_H = 1
+HAVE_STDBOOL_H = 1
+HAVE_STDDEF_H = 1
+HAVE_STDINT_H = 1
+HAVE_STDIO_H = 1
+HAVE_STDLIB_H = 1
+HAVE_STRCASECMP = 1
+HAVE_STRCASESTR = 1
+HAVE_STRCHR = 1
+HAVE_STRCPY = 1
+HAVE_STRDUP = 1
+HAVE_STRERROR = 1
+HAVE_STRERROR_R = 1
+HAVE_STRFTIME = 1
+HAVE_STRINGS_H = 1
+HAVE_STRING_H = 1
+HAVE_STRLCAT = ()
+HAVE_STRLCPY = ()
+HAVE_STRLWR = ()
+HAVE_STRNCASECMP = 1
+HAVE_STRNCPY = 1
+HAVE_STRNDUP = 1
+HAVE_STRNLEN = 1
+HAVE_STRPBRK = 1
+HAVE_STRPTIME = 1
+HAVE_STRSEP = 1
+HAVE_STRSEP_COPY = ()
+HAVE_STRSIGNAL = 1
+HAVE_STRTOK_R = 1
+HAVE_STRTOL = 1
+HAVE_STRTOLL = 1
+HAVE_STRTOQ = 1
+HAVE_STRTOULL = 1
+HAVE_STRTOUQ = 1
+HAVE_STRUCT_ADDRINFO = 1
+HAVE_STRUCT_DIRENT64 = '1'
+HAVE_STRUCT_FLOCK64 = 1
+HAVE_STRUCT_IFADDRS = 1
+HAVE_STRUCT_SIGEVENT = 1
+HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIGVAL_PTR = ()
+HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIVAL_PTR = 1
+HAVE_STRUCT_SOCKADDR = 1
+HAVE_STRUCT_SOCKADDR_IN6 = 1
+HAVE_STRUCT_SOCKADDR_STORAGE = 1
+HAVE_STRUCT_STAT_ST_BIRTHTIME = ()
+HAVE_STRUCT_STAT_ST_BIRTHTIMENSEC = ()
+HAVE_STRUCT_STAT_ST_BIRTHTIMESPEC_TV_NSEC = ()
+HAVE_STRUCT_STAT_ST_MTIMENSEC = ()
+HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC = ()
+HAVE_STRUCT_STAT_ST_MTIME_N = ()
+HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC = 1
+HAVE_STRUCT_STAT_ST_RDEV = 1
+HAVE_STRUCT_STAT_ST_UMTIME = ()
+HAVE_STRUCT_TIMESPEC = 1
+HAVE_STRUCT_WINSIZE = 1
+HAVE_STRUPR = ()
+HAVE_ST_RDEV = 1
+HAVE_SWAB = 1
+HAVE_SYMLINK = 1
+HAVE_SYSCALL_H = 1
+HAVE_SYSCONF = 1
+HAVE_SYSCTL = ()
+HAVE_SYSCTLBYNAME = ()
+HAVE_SYSLOG = 1
+HAVE_SYSLOG_H = 1
+HAVE_SYS_CDEFS_H = 1
+HAVE_SYS_DIR_H = 1
+HAVE_SYS_EPOLL_H = 1
+HAVE_SYS_EVENTFD_H = 1
+HAVE_SYS_FCNTL_H = 1
+HAVE_SYS_FILE_H = 1
+HAVE_SYS_INOTIFY_H = 1
+HAVE_SYS_IOCTL_H = 1
+HAVE_SYS_IPC_H = 1
+HAVE_SYS_KERNEL_PROC_CORE_PATTERN = '1'
+HAVE_SYS_MMAN_H = 1
+HAVE_SYS_MOUNT_H = 1
+HAVE_SYS_PARAM_H = 1
+HAVE_SYS_PRCTL_H = 1
+HAVE_SYS_QUOTA_H = 1
+HAVE_SYS_RESOURCE_H = 1
+HAVE_SYS_SELECT_H = 1
+HAVE_SYS_SHM_H = 1
+HAVE_SYS_SOCKET_H = 1
+HAVE_SYS_STATFS_H = 1
+HAVE_SYS_STATVFS_H = 1
+HAVE_SYS_STAT_H = 1
+HAVE_SYS_SYSCALL_H = 1
+HAVE_SYS_SYSLOG_H = 1
+HAVE_SYS_SYSMACROS_H = 1
+HAVE_SYS_TERMIOS_H = 1
+HAVE_SYS_TIMEB_H = 1
+HAVE_SYS_TIMES_H = 1
+HAVE_SYS_TIME_H = 1
+HAVE_SYS_TYPES_H = 1
+HAVE_SYS_UIO_H = 1
+HAVE_SYS_UNISTD_H = 1
+HAVE_SYS_UN_H = 1
+HAVE_SYS_UTSNAME_H = 1
+HAVE_SYS_VFS_H = 1
+HAVE_SYS_WAIT_H = 1
+HAVE_SYS_XATTR_H = 1
+HAVE_TELLDIR64 = ()
+HAVE_TERMCAP_H = 1
+HAVE_TERMIOS_H = 1
+HAVE_TERMIO_H = 1
+HAVE_TERM_H = 1
+HAVE_TEXTDOMAIN = 1
+HAVE_TGETENT = 1
+HAVE_TIMEGM = 1
+HAVE_TIME_H = 1
+HAVE_TYPEOF = 1
+HAVE_UINT16_T = 1
+HAVE_UINT32_T = 1
+HAVE_UINT64_T = 1
+HAVE_UINT8_T = 1
+HAVE_UINTPTR_T = 1
+HAVE_UINT_T = ()
+HAVE_UMASK = 1
+HAVE_UNAME = 1
+HAVE_UNISTD_H = 1
+HAVE_UNIXSOCKET = 1
+HAVE_UNSETENV = 1
+HAVE_UPDWTMP = 1
+HAVE_UPDWTMPX = 1
+HAVE_USLEEP = 1
+HAVE_UTIMBUF = 1
+HAVE_UTIME = 1
+HAVE_UTIMENSAT = 1
+HAVE_UTIMES = 1
+HAVE_UTIME_H = 1
+HAVE_UTMPX_H = 1
+HAVE_UTMP_H = 1
+HAVE_UT_UT_ADDR = 1
+HAVE_UT_UT_ADDR_V6 = 1
+HAVE_UT_UT_EXIT = 1
+HAVE_UT_UT_HOST = 1
+HAVE_UT_UT_ID = 1
+HAVE_UT_UT_NAME = 1
+HAVE_UT_UT_PID = 1
+HAVE_UT_UT_TIME = 1
+HAVE_UT_UT_TV = 1
+HAVE_UT_UT_TYPE = 1
+HAVE_UT_UT_USER = 1
+HAVE_UUID_GENERATE = 1
+HAVE_UUID_UUID_H = 1
+HAVE_UX_UT_SYSLEN = ()
+HAVE_U_CHAR = 1
+HAVE_U_INT32_T = 1
+HAVE_VASPRINTF = 1
+HAVE_VA_COPY = 1
+HAVE_VDPRINTF = 1
+HAVE_VISIBILITY_ATTR = 1
+HAVE_VOLATILE = 1
+HAVE_VSNPRINTF = 1
+HAVE_VSYSLOG = 1
+HAVE_WAIT4 = 1
+HAVE_WAITPID = 1
+HAVE_WARN = 1
+HAVE_WARNX = 1
+HAVE_WARN_UNUSED_RESULT = 1
+HAVE_WRITEV = 1
+HAVE_WS_XPIXEL = 1
+HAVE_WS_YPIXEL = 1
+HAVE_XATTR_SUPPORT = 1
+HAVE_YP_GET_DEFAULT_DOMAIN = 1
+HAVE_ZLIB = 1
+HAVE_ZLIBVERSION = 1
+HAVE_ZLIB_H = 1
+HAVE__ACL = ()
+HAVE__Bool = 1
+HAVE__CHDIR = ()
+HAVE__CLOSE = ()
+HAVE__CLOSEDIR = ()
+HAVE__DN_EXPAND = ()
+HAVE__DUP = ()
+HAVE__DUP2 = ()
+HAVE__FACL = ()
+HAVE__FCHDIR = ()
+HAVE__FCNTL = ()
+HAVE__FORK = ()
+HAVE__FSTAT = ()
+HAVE__FSTAT64 = ()
+HAVE__GETCWD = ()
+HAVE__LLSEEK = ()
+HAVE__LSEEK = ()
+HAVE__LSTAT = ()
+HAVE__LSTAT64 = ()
+HAVE__OPEN = ()
+HAVE__OPEN64 = ()
+HAVE__OPENDIR = ()
+HAVE__PREAD = ()
+HAVE__PREAD64 = ()
+HAVE__PWRITE = ()
+HAVE__PWRITE64 = ()
+HAVE__READ = ()
+HAVE__READDIR = ()
+HAVE__READDIR64 = ()
+HAVE__RES = 1
+HAVE__SEEKDIR = ()
+HAVE__STAT = ()
+HAVE__STAT64 = ()
+HAVE__TELLDIR = ()
+HAVE__VA_ARGS__MACRO = 1
+HAVE__WRITE = ()
+HAVE___ACL = ()
+HAVE___CHDIR = ()
+HAVE___CLOSE = 1
+HAVE___CLOSEDIR = ()
+HAVE___DN_EXPAND = ()
+HAVE___DUP = ()
+HAVE___DUP2 = 1
+HAVE___FACL = ()
+HAVE___FCHDIR = ()
+HAVE___FCNTL = 1
+HAVE___FORK = 1
+HAVE___FSTAT = ()
+HAVE___FSTAT64 = 1
+HAVE___FXSTAT = 1
+HAVE___GETCWD = ()
+HAVE___GETDENTS = ()
+HAVE___LLSEEK = ()
+HAVE___LSEEK = 1
+HAVE___LSTAT = ()
+HAVE___LSTAT64 = ()
+HAVE___LXSTAT = 1
+HAVE___NR_INOTIFY_INIT = ()
+HAVE___NR_INOTIFY_INIT_DECL = 1
+HAVE___OPEN = 1
+HAVE___OPEN64 = 1
+HAVE___OPENDIR = ()
+HAVE___PREAD = ()
+HAVE___PREAD64 = 1
+HAVE___PWRITE = ()
+HAVE___PWRITE64 = 1
+HAVE___READ = 1
+HAVE___READDIR = ()
+HAVE___READDIR64 = ()
+HAVE___SEEKDIR = ()
+HAVE___SS_FAMILY = ()
+HAVE___STAT = ()
+HAVE___STAT64 = ()
+HAVE___STRTOLL = ()
+HAVE___STRTOULL = ()
+HAVE___SYS_LLSEEK = ()
+HAVE___TELLDIR = ()
+HAVE___WRITE = 1
+HAVE___XSTAT = 1
+HEIMDAL_KRB5_CONFIG = ''
+HOSTCC = False
+HTMLDIR = '/usr/local/samba/share/doc/samba'
+IDMAP_SHARED = ['idmap_autorid']
+IDMAP_STATIC = ['idmap_tdb', 'idmap_passdb', 'idmap_nss']
+INCLUDEDIR = '/usr/local/samba/include'
+INFODIR = '/usr/local/samba/share/info'
+INLINE_MACRO = 1
+KRB5_CREDS_OPT_FREE_REQUIRES_CONTEXT = 1
+KRB5_PRINC_REALM_RETURNS_REALM = 1
+LDAP_SET_REBIND_PROC_ARGS = '3'
+LDB_MODULESDIR = '/usr/local/samba/modules/ldb'
+LIBDIR = '/usr/local/samba/lib'
+LIBEXECDIR = '/usr/local/samba/libexec'
+LIBPATH_PYEMBED = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_PYEXT = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_PYTHON2.7 = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_ST = '-L%s'
+LIBREPLACE_NETWORK_CHECKS = 1
+LIB_CRYPT = 'crypt'
+LIB_GCRYPT = 'gcrypt'
+LIB_GNUTLS = 'gnutls'
+LIB_GPG-ERROR = 'gpg-error'
+LIB_NCURSES = 'ncurses'
+LIB_NSL = 'nsl'
+LIB_PTHREAD = 'pthread'
+LIB_PYEMBED = ['m', 'dl', 'python2.7']
+LIB_PYEXT = ['m', 'dl', 'python2.7']
+LIB_PYTHON2.7 = ['python2.7']
+LIB_READLINE = 'readline'
+LIB_RESOLV = 'resolv'
+LIB_RT = 'rt'
+LIB_ST = '-l%s'
+LIB_UUID = 'uuid'
+LIB_Z = 'z'
+LIB_crypt = ['crypt']
+LIB_gcrypt = ['gcrypt']
+LIB_gnutls = ['gnutls']
+LIB_gpg-error = ['gpg-error']
+LIB_ncurses = ['ncurses']
+LIB_nsl = ['nsl']
+LIB_pthread = ['pthread']
+LIB_readline = ['readline']
+LIB_resolv = ['resolv']
+LIB_rt = ['rt']
+LIB_uuid = ['uuid']
+LIB_z = ['z']
+LINKFLAGS_MACBUNDLE = ['-bundle', '-undefined', 'dynamic_lookup']
+LINKFLAGS_PYEMBED = ['-L/root/.pyenv/versions/2.7.18/lib', '-Wl,-rpath,/root/.pyenv/versions/2.7.18/lib', '-L/root/.pyenv/versions/2.7.18/lib', '-Wl,-rpath,/root/.pyenv/versions/2.7.18/lib']
+LINK_CC = ['/usr/bin/gcc']
+LINUX = '1'
+LINUX_SENDFILE_API = '1'
+LMHOSTSFILE = '/usr/local/samba/etc/lmhosts'
+LOCALEDIR = '/usr/local/samba/share/locale'
+LOCALSTATEDIR = '/usr/local/samba/var'
+LOCKDIR = '/usr/local/samba/var/lock'
+LOGFILEBASE = '/usr/local/samba/var'
+MANDIR = '/usr/local/samba/share/man'
+MODULESDIR = '/usr/local/samba/modules'
+MODULE_PREFIXES = ['vfs', 'pdb', 'auth', 'nss_info', 'charset', 'idmap', 'gpext', 'perfcount']
+NCALRPCDIR = '/usr/local/samba/var/run/ncalrpc'
+NMBDSOCKETDIR = '/usr/local/samba/var/run/nmbd'
+NONSHARED_BINARIES = ['']
+NSS_INFO_SHARED = []
+NSS_INFO_STATIC = ['nss_info_template']
+NSS_WRAPPER = 1
+NTP_SIGND_SOCKET_DIR = '/usr/local/samba/var/run/ntp_signd'
+OLDINCLUDEDIR = '/usr/include'
+PACKAGE = 'samba'
+PAMMODULESDIR = '/usr/local/samba/lib/security'
+PDB_SHARED = ['pdb_test']
+PDB_STATIC = ['pdb_smbpasswd', 'pdb_tdbsam', 'pdb_wbc_sam', 'pdb_ads', 'pdb_samba4']
+PDFDIR = '/usr/local/samba/share/doc/samba'
+PERFCOUNT_SHARED = ['perfcount_test']
+PERFCOUNT_STATIC = []
+PERL = '/usr/bin/perl'
+PERLMAN1EXT = '1p'
+PERLMAN3EXT = '3pm'
+PIDDIR = '/usr/local/samba/var/run'
+PKGCONFIGDIR = '/usr/local/samba/lib/pkgconfig'
+POD2MAN = '/usr/bin/pod2man'
+PREFIX = '/usr/local/samba'
+PRIVATELIBDIR = '${PREFIX}/lib/samba'
+PRIVATE_DIR = '/usr/local/samba/private'
+PRIVATE_EXTENSION = 'samba4'
+PRIVATE_EXTENSION_EXCEPTION = ['']
+PRIVILEGED_SOCKET_DIR = '/usr/local/samba/var/lib'
+PSDIR = '/usr/local/samba/share/doc/samba'
+PUTUTLINE_RETURNS_UTMP = 1
+PYC = 1
+PYCMD = '"import sys, py_compile;py_compile.compile(sys.argv[1], sys.argv[2])"'
+PYFLAGS = ''
+PYFLAGS_OPT = '-O'
+PYO = 1
+PYTHON = '/root/.pyenv/versions/2.7.18/bin/python'
+PYTHONARCHDIR = '/usr/local/samba/lib/python2.7/site-packages'
+PYTHONDIR = '/usr/local/samba/lib/python2.7/site-packages'
+PYTHON_CONFIG = '/root/.pyenv/versions/2.7.18/bin/python2.7-config'
+PYTHON_VERSION = '2.7'
+RANLIB = '/usr/bin/ranlib'
+READLINE_TERMLIB = 'ncurses'
+REALPATH_TAKES_NULL = 1
+REPLACE_GETPASS = 1
+REPLACE_STRPTIME = ()
+RETSIGTYPE = 'void'
+RETSIGTYPE_INT = ()
+RPATH_ON_BUILD = True
+RPATH_ON_INSTALL = True
+RPATH_ON_INSTALL_PRIVATE = True
+RPATH_ST = '-Wl,-rpath,%s'
+SAMBA4_INTERNAL_HEIMDAL = 1
+SBINDIR = '/usr/local/samba/sbin'
+SCRIPTSBINDIR = '/usr/local/samba/sbin'
+SEEKDIR_RETURNS_VOID = 1
+SELFTEST_PREFIX = './st'
+SETUPDIR = '/usr/local/samba/share/setup'
+SHAREDSTATEDIR = '/usr/local/samba/com'
+SHLIBEXT = 'so'
+SHLIB_MARKER = '-Wl,-Bdynamic'
+SIZEOF_BOOL = '1'
+SIZEOF_CHAR = '1'
+SIZEOF_DEV_T = '8'
+SIZEOF_INO_T = '8'
+SIZEOF_INT = '4'
+SIZEOF_INT16_T = '2'
+SIZEOF_INT32_T = '4'
+SIZEOF_INT64_T = '8'
+SIZEOF_INT8_T = '1'
+SIZEOF_LONG = '8'
+SIZEOF_LONG_LONG = '8'
+SIZEOF_OFF_T = '8'
+SIZEOF_SHORT = '2'
+SIZEOF_SIZE_T = '8'
+SIZEOF_SSIZE_T = '8'
+SIZEOF_TIME_T = '8'
+SIZEOF_UINT16_T = '2'
+SIZEOF_UINT32_T = '4'
+SIZEOF_UINT64_T = '8'
+SIZEOF_UINT8_T = '1'
+SIZEOF_VOID_P = '8'
+SMB_PASSWD_FILE = '/usr/local/samba/private/smbpasswd'
+SOCKET_DIR = '/usr/local/samba/var/run'
+SOCKET_WRAPPER = 1
+SOLARIS_GETGRENT_R = ()
+SOLARIS_GETPWENT_R = ()
+SONAME_ST = '-Wl,-h,%s'
+STATEDIR = '/usr/local/samba/var/locks'
+STATICLIBPATH_ST = '-L%s'
+STATICLIB_MARKER = '-Wl,-Bstatic'
+STATICLIB_ST = '-l%s'
+STAT_STATVFS64 = 1
+STAT_ST_BLOCKSIZE = '512'
+STDC_HEADERS = 1
+STRING_STATIC_MODULES = 'pdb_smbpasswd pdb_tdbsam pdb_wbc_sam auth_sam auth_unix auth_winbind auth_wbc auth_server auth_domain auth_builtin vfs_default nss_info_template idmap_tdb idmap_passdb idmap_nss pdb_ads auth_netlogond charset_weird pdb_samba4 auth_samba4 vfs_dfs_samba4'
+SWATDIR = '/usr/local/samba/share/swat'
+SYSCONFDIR = '/usr/local/samba/etc'
+SYSCONF_SC_NGROUPS_MAX = 1
+SYSCONF_SC_NPROCESSORS_ONLN = 1
+SYSCONF_SC_NPROC_ONLN = ()
+SYSCONF_SC_PAGESIZE = 1
+SYSTEM_UNAME_MACHINE = 'x86_64'
+SYSTEM_UNAME_RELEASE = '6.18.44-fc-v139'
+SYSTEM_UNAME_SYSNAME = 'Linux'
+SYSTEM_UNAME_VERSION = '#1 SMP PREEMPT_DYNAMIC @0'
+TALLOC_COMPAT1 = False
+TARGET_TYPE = {'nsl': 'SYSLIB', 'intl': 'EMPTY', 'sunacl': 'EMPTY', 'gcrypt': 'SYSLIB', 'sec': 'EMPTY', 'pthread': 'SYSLIB', 'cups': 'EMPTY', 'rt': 'SYSLIB', 'iconv': 'EMPTY', 'uuid': 'SYSLIB', 'crypt': 'SYSLIB', 'ldap': 'EMPTY', 'pam': 'EMPTY', 'dl': 'EMPTY', 'execinfo': 'EMPTY', 'ncurses': 'SYSLIB', 'gpg-error': 'SYSLIB', 'avahi-common': 'EMPTY', 'util': 'EMPTY', 'gnutls': 'SYSLIB', 'readline': 'SYSLIB', 'gen': 'EMPTY', 'attr': 'EMPTY', 'socket': 'EMPTY', 'avahi-client': 'EMPTY', 'cap': 'EMPTY', 'resolv': 'SYSLIB', 'acl': 'EMPTY', 'aio': 'EMPTY', 'lber': 'EMPTY', 'security': 'EMPTY', 'z': 'SYSLIB'}
+TIME_T_MAX = '67768036191676799ll'
+TIME_WITH_SYS_TIME = 1
+UID_WRAPPER = 1
+USE_SETREUID = 1
+VFS_SHARED = ['vfs_recycle', 'vfs_audit', 'vfs_extd_audit', 'vfs_full_audit', 'vfs_netatalk', 'vfs_fake_perms', 'vfs_default_quota', 'vfs_readonly', 'vfs_cap', 'vfs_expand_msdfs', 'vfs_shadow_copy', 'vfs_shadow_copy2', 'vfs_readahead', 'vfs_xattr_tdb', 'vfs_streams_xattr', 'vfs_streams_depot', 'vfs_acl_xattr', 'vfs_acl_tdb', 'vfs_smb_traffic_analyzer', 'vfs_preopen', 'vfs_catia', 'vfs_scannedonly', 'vfs_crossrename', 'vfs_linux_xfs_sgid', 'vfs_time_audit', 'vfs_skel_opaque', 'vfs_skel_transparent', 'vfs_shadow_copy_test', 'vfs_syncops', 'vfs_dirsort', 'vfs_fileid', 'vfs_aio_fork', 'vfs_aio_pthread', 'vfs_io_uring']
+VFS_STATIC = ['vfs_default', 'vfs_dfs_samba4']
+VISIBILITY_CFLAGS = '-fvisibility=hidden'
+VOID_RETSIGTYPE = 1
+WINBINDD_PRIVILEGED_SOCKET_DIR = '/usr/local/samba/var/lib/winbindd_privileged'
+WINBINDD_SOCKET_DIR = '/usr/local/samba/var/run/winbindd'
+WITH_ADS = '1'
+WITH_AIO = '1'
+WITH_AUTOMOUNT = '1'
+WITH_DNS_UPDATES = 1
+WITH_PTHREADPOOL = '1'
+WITH_SENDFILE = '1'
+WITH_SYSLOG = '1'
+WITH_UTMP = 1
+WITH_WINBIND = '1'
+WORDS_BIGENDIAN = ()
+XATTR_ADDITIONAL_OPTIONS = ()
+XATTR_ADD_OPT = ()
+XSLTPROC = ''
+YAPP = ''
+_GNU_SOURCE = 1
+_HAVE_BROKEN_LINUX_SENDFILE = ()
+_HAVE_SENDFILE = 1
+_HAVE_SENDFILE64 = 1
+_SAMBA_BUILD_ = 4
+_XOPEN_SOURCE_EXTENDED = 1
+__TIME_T_MAX = 1
+asneeded_ldflags = ['-Wl,--as-needed']
+auth_script_init = 'samba_init_module'
+auth_skel_init = 'samba_init_module'
+ber_tag_t = 'unsigned int'
+build_swat = True
+build_winbind = True
+cfg_files = ['include/config.h']
+defines = {'SOLARIS_GETPWENT_R': (), 'HAVE_GSS_KRB5_IMPORT_CRED': 1, 'WITH_UTMP': 1, 'HAVE_FGETEA': (), 'HAVE_SENDFILE64': '1', 'HAVE_LGETXATTR': 1, 'HAVE_SPLICE_DECL': 1, 'WITH_AUTOMOUNT': '1', 'HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIGVAL_PTR': (), 'HAVE_ATTRIBUTE_PRINTF': 1, 'HAVE_ATTR_REMOVEF': (), 'HAVE_F_SETLEASE_DECL': 1, 'HAVE_ERRNO_DECL': 1, 'HAVE_STDINT_H': 1, 'HAVE_POSIX_MEMALIGN': 1, 'HAVE_FALLOCATE': 1, 'PUTUTLINE_RETURNS_UTMP': 1, 'HAVE_PRINTF': 1, 'HAVE_PTHREAD_MUTEXATTR_SETROBUST': 1, 'SYSTEM_UNAME_SYSNAME': '"Linux"', 'HAVE_UINT32_T': 1, 'static_init_pdb': '{ pdb_smbpasswd_init();  pdb_tdbsam_init();  pdb_wbc_sam_init();  pdb_ads_init();  pdb_samba4_init(); }', 'HAVE_INT32_T': 1, 'HAVE_FREEIFADDRS': 1, 'HAVE_MNTENT_H': 1, 'HAVE_FDATASYNC_DECL': 1, 'HAVE_MMAP': 1, 'HAVE_STRTOLL': 1, 'HAVE_SYS_CDEFS_H': 1, 'HAVE_PREAD_DECL': 1, 'vfs_xattr_tdb_init': 'samba_init_module', 'HAVE_SYS_SYSCALL_H': 1, 'HAVE_PWRITE_DECL': 1, 'HAVE_AIO_READ64': 1, 'HAVE_AIO_RETURN': 1, 'HAVE_GETPWANAM': (), 'HAVE_SYS_SYSLOG_H': 1, 'HAVE_STAT_ST_FLAGS': (), 'SEEKDIR_RETURNS_VOID': 1, 'HAVE_TERMCAP_H': 1, 'HAVE_STRUCT_STAT_ST_BIRTHTIME': (), 'vfs_readonly_init': 'samba_init_module', 'HAVE_MALLOC_H': 1, 'HAVE_INET_NTOA': 1, 'SIZEOF_OFF_T': '8', 'vfs_readahead_init': 'samba_init_module', 'HAVE_CUPS': (), 'SIZEOF_LONG_LONG': '8', 'HAVE_BOOL': 1, 'vfs_crossrename_init': 'samba_init_module', 'HAVE_BLKSIZE_T': 1, 'HAVE_SETLUID': (), 'HAVE_INET_NTOP': 1, 'HAVE___OPEN64': 1, 'HAVE__LSTAT64': (), 'HAVE_LONG_LONG': 1, 'HAVE_FSETPROPLIST': (), 'HAVE_DIR_DD_FD': (), 'SIZEOF_INT': '4', 'vfs_default_quota_init': 'samba_init_module', 'HAVE_COM_ERR_H': 1, 'static_decl_vfs': 'extern NTSTATUS vfs_default_init(void); extern NTSTATUS vfs_dfs_samba4_init(void);', 'HAVE_STRUCT_SIGEVENT': 1, 'HAVE_GETNETGRENT': 1, 'HAVE_SETNETGRENT_PROTOTYPE': 1, 'HAVE_SETNETGRENT': 1, 'HAVE_GNUTLS_DATUM': 1, 'HAVE_SYSCONF': 1, 'HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC': (), 'HAVE_SIZE_T': 1, 'WITH_ADS': '1', 'HAVE_STRUCT_IFADDRS': 1, 'DEFAULT_UNIX_CHARSET': '"UTF-8"', 'HAVE_UINT16_T': 1, 'HAVE_STATVFS': 1, 'HAVE_GSSAPI_GSSAPI_H': 1, 'HAVE_DECL_FDATASYNC': 1, 'HAVE_KRB5_GET_HOST_REALM': 1, 'HAVE_UT_UT_PID': 1, 'vfs_shadow_copy2_init': 'samba_init_module', 'HAVE_DLCLOSE': 1, 'HAVE_DECL_DLOPEN': 1, 'HAVE_IFACE_GETIFADDRS': 1, 'HAVE_GETPASS': 1, 'HAVE_KRB5_KT_COMPARE': 1, 'HAVE_IRUSEROK': 1, 'HAVE_UTIME_H': 1, 'HAVE_MLOCKALL': 1, 'HAVE__READ': (), 'HAVE_GETADDRINFO': 1, 'HAVE_SETENV_DECL': 1, 'HAVE_ATTR_SET': (), 'HAVE_IF_NAMETOINDEX': 1, 'HAVE_FGETXATTR': 1, 'HAVE_WS_YPIXEL': 1, 'HAVE_USLEEP': 1, 'HAVE_AIO64': 1, 'HAVE_STRSEP_COPY': (), 'HAVE_MEMALIGN': 1, 'HAVE_PAM_TTY': (), 'SIZEOF_INT16_T': '2', 'HAVE_STRUCT_ADDRINFO': 1, 'INLINE_MACRO': 1, 'HAVE_DNSSERVICEREGISTER': (), 'HAVE_DECL_READAHEAD': 1, 'HAVE_KRB5_KT_FREE_ENTRY': 1, 'HAVE_GNUTLS_GLOBAL_INIT': 1, 'HAVE_AIO_ERROR': 1, 'HAVE_SYS_SYSMACROS_H': 1, 'XATTR_ADDITIONAL_OPTIONS': (), 'HAVE_STDBOOL_H': 1, 'HAVE_UNSETENV': 1, 'HAVE_SYS_XATTR_H': 1, 'HAVE_STRINGS_H': 1, 'TIME_T_MAX': '67768036191676799ll', 'HAVE___SYS_LLSEEK': (), 'HAVE_ATTRIBUTE_UNUSED': 1, 'HAVE_KRB5_KEYTAB_ENTRY_KEYBLOCK': 1, 'vfs_recycle_init': 'samba_init_module', 'HAVE_KRB5': '1', 'HAVE_CHARSET_CP850': 1, 'HAVE_RES_NDESTROY': (), 'HAVE_GETGROUPLIST': 1, 'HAVE_E_DATA_POINTER_IN_KRB5_ERROR': 1, 'SYSTEM_UNAME_RELEASE': '"6.18.44-fc-v139"', 'HAVE_SYS_INOTIFY_H': 1, 'vfs_fake_perms_init': 'samba_init_module', 'HAVE_SIGNAL_H': 1, 'RETSIGTYPE': 'void', 'HAVE___NR_INOTIFY_INIT': (), 'HAVE_DEVICE_MINOR_FN': (), 'HAVE___CLOSEDIR': (), 'HAVE_STRTOULL': 1, 'HAVE_COMPOUND_LITERALS': 1, 'HAVE_ENVIRON_DECL': 1, 'HAVE_POSIX_ACLS': (), 'HAVE_GSSAPI': 1, 'HAVE_SIMPLE_C_PROG': 1, 'HAVE_EPOLL': 1, 'vfs_cap_init': 'samba_init_module', '_HAVE_SENDFILE64': 1, 'vfs_skel_transparent_init': 'samba_init_module', 'HAVE_INT16_T': 1, 'HAVE_ASPRINTF': 1, 'HAVE_STRUPR': (), 'HAVE_LIBGPG_ERROR': 1, 'HAVE_SETRESUID': 1, 'HAVE_SETRESGID_DECL': 1, 'HAVE_KRB5_GET_DEFAULT_IN_TKT_ETYPES': 1, 'HAVE_KRB5_STRING_TO_KEY': 1, 'HAVE_INTTYPES_H': 1, 'HAVE_FUNCTION_ATTRIBUTE_DESTRUCTOR': 1, 'HAVE_SYS_PARAM_H': 1, 'HAVE_SYS_SOCKET_H': 1, 'HAVE_STRNCPY': 1, 'HAVE_DECL__RES': 1, 'HAVE_CLOCK_PROCESS_CPUTIME_ID': 1, 'HAVE_UPDWTMPX': 1, 'HAVE_SYS_STAT_H': 1, 'HAVE___OPENDIR': (), 'HAVE_SETXATTR': 1, 'static_init_perfcount': '{}', 'HAVE_AIO_RETURN64': 1, 'HAVE_GETHOSTBYADDR': 1, 'HAVE_CHARSET_UTF_8': 1, 'HAVE_UTIMES': 1, 'HAVE_SYS_EVENTFD_H': 1, 'HAVE_SETGIDX': (), 'HAVE_REALPATH': 1, 'HAVE_GETAUTHUID': (), 'HAVE_KRB5_H': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_FREE': 1, 'HAVE_NETDB_H': 1, 'HAVE_ATTRIBUTE_COLD': 1, 'SIZEOF_UINT16_T': '2', 'HAVE_GETIFADDRS': 1, 'HAVE_STRCPY': 1, 'STDC_HEADERS': 1, 'HAVE_COMPARISON_FN_T': 1, 'HAVE_ICONV_H': 1, 'STAT_STATVFS64': 1, 'HAVE_LSTAT': 1, 'HAVE_LINUX_DQBLK_XFS_H': 1, 'HAVE_AIO_ERROR64': 1, 'HAVE_LIBREADLINE': 1, 'HAVE_VASPRINTF': 1, 'HAVE_RESOLV_H': 1, 'HAVE_GETXATTR': 1, 'HAVE_KRB5_SET_DEFAULT_IN_TKT_ETYPES': 1, 'HAVE___GETCWD': (), 'CLUSTER_SUPPORT': (), 'SYSTEM_UNAME_VERSION': '"#1 SMP PREEMPT_DYNAMIC @0"', 'HAVE_GLOB': 1, 'HAVE_LINUX_FALLOCATE64': 1, 'HAVE_COM_ERR': (), 'HAVE_UT_UT_ID': 1, 'HAVE___FSTAT': (), 'HAVE___FORK': 1, 'HAVE_ENCTYPE_AES128_CTS_HMAC_SHA1_96': 1, 'HAVE_EXTATTR_LIST_FILE': (), 'HAVE_TERM_H': 1, 'HAVE_BIG_ENDIAN': (), 'HAVE_STRCASESTR': 1, 'HAVE_DIRFD_DECL': 1, 'HAVE_UPDWTMP': 1, 'HAVE_VA_COPY': 1, 'HAVE_SETENV': 1, 'HAVE___FCHDIR': (), 'HAVE_CHOWN': 1, 'HAVE_UNIXSOCKET': 1, 'HAVE_PTHREAD_ATTR_INIT': 1, 'HAVE_REMOVEXATTR': 1, 'HAVE_IMMEDIATE_STRUCTURES': 1, 'HAVE_FDOPENDIR64': (), 'vfs_aio_fork_init': 'samba_init_module', 'LINUX_SENDFILE_API': '1', 'HAVE_LUTIMES': 1, 'static_init_nss_info': '{ nss_info_template_init(); }', 'HAVE_LIBRESOLV': 1, 'HAVE_STRUCT_TIMESPEC': 1, 'HAVE_ATTROPEN': (), 'HAVE_KRB5_CRYPTO_DESTROY': 1, 'HAVE_FTELL64': (), 'STAT_ST_BLOCKSIZE': '512', 'HAVE_LDAP_SET_REBIND_PROC': (), 'HAVE_UTIMBUF': 1, 'HAVE_FUTIMENS': 1, 'HAVE__STAT64': (), 'HAVE___FCNTL': 1, 'HAVE_PUTENV': 1, 'HAVE_BUILTIN_TYPES_COMPATIBLE_P': 1, 'HAVE_SETSID': 1, 'HAVE_IFADDRS_H': 1, 'HAVE___STAT64': (), 'HAVE_INITGROUPS': 1, 'HAVE___FACL': (), 'HAVE_KRB5_ENCTYPE_TO_STRING': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_ALLOC': 1, 'HAVE_ICONV': 1, 'HAVE_WARN_UNUSED_RESULT': 1, 'HAVE_GAI_STRERROR': 1, 'HAVE_LREMOVEEA': (), 'HAVE_DLSYM': 1, 'HAVE___GETDENTS': (), 'HAVE_TELLDIR64': (), 'HAVE_GETPWUID_R': 1, 'HAVE_BLKCNT_T': 1, 'HAVE_SOCKLEN_T': 1, 'HAVE_DNS_SEARCH': (), 'HAVE_SRAND': 1, 'WITH_WINBIND': '1', 'HAVE_PAM_RADIO_TYPE': (), 'static_decl_idmap': 'extern NTSTATUS idmap_tdb_init(void); extern NTSTATUS idmap_passdb_init(void); extern NTSTATUS idmap_nss_init(void);', 'vfs_streams_depot_init': 'samba_init_module', 'BUILD_SYSTEM': '"Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux"', 'HAVE_KRB5_C_VERIFY_CHECKSUM': 1, 'HAVE_DEVNM': (), 'HAVE_AIO_CANCEL': 1, 'DLOPEN_TAKES_UNSIGNED_FLAGS': (), 'HAVE_SYS_SHM_H': 1, 'HAVE_STDIO_H': 1, 'HAVE_AIO_FSYNC64': 1, 'HAVE_SETRESGID': 1, 'HAVE_CLOCK_MONOTONIC': 1, 'HAVE_AIO': 1, 'HAVE_PTRDIFF_T': 1, 'HAVE_GNUTLS_DATUM_T': 1, 'HAVE_FDELPROPLIST': (), 'HAVE_MEMMEM': 1, 'SYSTEM_UNAME_MACHINE': '"x86_64"', 'HAVE_STRUCT_STAT_ST_RDEV': 1, 'HAVE_MUNLOCKALL': 1, 'HAVE_SYS_MOUNT_H': 1, 'HAVE___LSTAT': (), 'HAVE__OPEN': (), 'HAVE_BUILTIN_EXPECT': 1, 'HAVE_LIBINTL_H': 1, 'HAVE_BUILTIN_POPCOUNTL': 1, 'HAVE_SECURE_MKSTEMP': 1, 'SIZEOF_LONG': '8', 'HAVE_XATTR_SUPPORT': 1, 'HAVE_BUILTIN_CONSTANT_P': 1, 'HAVE_MEMORY_H': 1, 'HAVE_LINUX_FCNTL_H': 1, 'HAVE_FCVTL': (), 'HAVE_READLINE_HISTORY_H': 1, 'HAVE_CLOCK_GETTIME': 1, 'HAVE_DLOPEN': 1, 'SIZEOF_SHORT': '2', 'HAVE_STRTOL': 1, 'HAVE___PREAD64': 1, 'HAVE_DIRENT_D_OFF': 1, 'HAVE_CREAT64': 1, '_SAMBA_BUILD_': 4, 'HAVE_SETBUFFER': 1, 'HAVE_OPEN64': 1, 'HAVE_LINUX_READAHEAD': 1, 'CONFIG_H_IS_FROM_SAMBA': 1, 'vfs_extd_audit_init': 'samba_init_module', 'HAVE_AVAHI_STRERROR': (), 'HAVE_LARGEFILE': 1, 'HAVE_KRB5_MK_REQ_EXTENDED': 1, 'SIZEOF_CHAR': '1', 'HAVE_SETLINEBUF': 1, 'SIZEOF_INT8_T': '1', 'HAVE_SYSLOG': 1, 'HAVE_SYSCTL': (), 'HAVE_GETHOSTENT': 1, 'HAVE_ZLIB': 1, 'HAVE_SETLOCALE': 1, 'HAVE_PUTUTXLINE': 1, 'HAVE_ENDNETGRENT': 1, 'HAVE_EXTATTR_DELETE_FD': (), 'HAVE_FSEEKO64': 1, 'HAVE_LIBNSL': 1, 'HAVE_ARPA_INET_H': 1, 'static_init_charset': '{ charset_weird_init(); }', 'HAVE_DLFCN_H': 1, 'HAVE_GETHOSTBYNAME': 1, 'HAVE_GETOPT_H': 1, 'HAVE_HTTPCONNECTENCRYPT': (), 'HAVE_BUILTIN_CLZL': 1, 'HAVE_LDAP_ADD_RESULT_ENTRY': (), 'HAVE_READLINE_READLINE_H': 1, 'HAVE_H_ERRNO': 1, 'USE_SETREUID': 1, 'HAVE_FTRUNCATE64': 1, 'HAVE_SYS_IPC_H': 1, 'HAVE_SHADOW_H': 1, 'HAVE_INET_PTON': 1, 'HAVE_GSSKRB5_EXTRACT_AUTHZ_DATA_FROM_SEC_CONTEXT': 1, 'vfs_acl_tdb_init': 'samba_init_module', 'HAVE_ENCTYPE_ARCFOUR_HMAC': 1, 'HAVE___PWRITE64': 1, 'HAVE_INITIALIZE_KRB5_ERROR_TABLE': 1, 'HAVE_STDLIB_H': 1, 'HAVE_UT_UT_TYPE': 1, 'HAVE_GETGRNAM_R': 1, 'HAVE_FSYNC': 1, 'HAVE_NETINET_IN_H': 1, 'HAVE_BINDTEXTDOMAIN': 1, 'WITH_SYSLOG': '1', 'WITH_PTHREADPOOL': '1', 'HAVE_STDARG_H': 1, 'HAVE_BER_SOCKBUF_ADD_IO': (), 'HAVE_KRB5_CRYPTO': 1, 'SIZEOF_INO_T': '8', 'HAVE_AIO_H': 1, 'HAVE_LOCALE_H': 1, 'HAVE_EVENTFD': 1, 'HAVE_RDCHK': (), 'HAVE_DEVICE_MAJOR_FN': (), 'HAVE_UT_UT_EXIT': 1, 'HAVE_REMOVEEA': (), 'HAVE_UUID_UUID_H': 1, 'HAVE___OPEN': 1, 'HAVE_DLERROR': 1, 'HAVE_GCRYPT_H': 1, 'HAVE_UT_UT_TIME': 1, 'HAVE_RCMD': 1, 'HAVE_INT64_T': 1, 'HAVE__FACL': (), 'HAVE_BSWAP16': (), 'HAVE_CONNECT': 1, 'HAVE_RANDOM': 1, 'HAVE_CPPFUNCTION': 1, 'HAVE_LIBREPLACE': 1, 'HAVE_FLISTXATTR': 1, 'HAVE_KRB5_C_ENCTYPE_COMPARE': 1, 'HAVE_LSTAT64': 1, 'HAVE_VSYSLOG': 1, 'HAVE_STRING_H': 1, 'HAVE__PREAD': (), 'HAVE_NATIVE_ICONV': 1, 'HAVE_PRCTL': 1, 'HAVE_LINUX_INOTIFY_H': 1, 'HAVE_ADDR_TYPE_IN_KRB5_ADDRESS': 1, 'HAVE_STRUCT_SOCKADDR_STORAGE': 1, 'HAVE_ENDIAN_H': 1, 'HAVE_STRSIGNAL': 1, 'HAVE_GETNETGRENT_PROTOTYPE': 1, 'SIZEOF_UINT64_T': '8', 'HAVE_PIPE': 1, 'HAVE_CHMOD': 1, 'HAVE_BACKTRACE': 1, 'HAVE_DECL_KRB5_GET_CREDENTIALS_FOR_USER': 0, 'HAVE_LGETEA': (), 'HAVE_FNMATCH_H': 1, 'HAVE__CHDIR': (), 'HAVE_LINUX_FALLOCATE': 1, 'HAVE_SHL_LOAD': (), 'HAVE_WAITPID': 1, 'HAVE_LREMOVEXATTR': 1, 'HAVE_AIO_READ': 1, 'HAVE___READ': 1, 'HAVE_KRB5_KRBHST_GET_ADDRINFO': 1, 'HAVE_AIO_CANCEL64': 1, 'WITH_SENDFILE': '1', 'HAVE__FCNTL': (), 'HAVE_HISTORY_LIST': 1, 'HAVE_EXTATTR_GET_FILE': (), 'vfs_shadow_copy_init': 'samba_init_module', 'HAVE_SYSCTLBYNAME': (), 'COMPILER_SUPPORTS_LL': 1, 'SIZEOF_SSIZE_T': '8', 'HAVE_SETJMP_H': 1, 'HAVE_KERNEL_CHANGE_NOTIFY': 1, 'perfcount_test_init': 'samba_init_module', 'HAVE_STAT64': 1, 'HAVE_STRTOK_R': 1, 'HAVE_GETPROPLIST': (), 'HAVE_LIBGSSAPI': 1, 'SIZEOF_SIZE_T': '8', 'HAVE_STATVFS_F_FLAGS': (), 'HAVE___READDIR': (), 'HAVE_GNUTLS': 1, 'HAVE_SYS_UTSNAME_H': 1, 'WORDS_BIGENDIAN': (), 'HAVE_CHECKSUM_IN_KRB5_CHECKSUM': 1, 'HAVE_MLOCK': 1, 'HAVE_LIBGCRYPT': 1, 'HAVE__RES': 1, 'HAVE_GLOB_H': 1, 'HAVE_SENDMSG': 1, 'SHLIBEXT': '"so"', 'SYSCONF_SC_PAGESIZE': 1, 'HAVE_ATTRIBUTE_USED': 1, 'HAVE_STAT_HIRES_TIMESTAMPS': '1', 'HAVE_NETINET_IP_H': 1, 'auth_script_init': 'samba_init_module', 'HAVE_UX_UT_SYSLEN': (), 'HAVE_GPG_ERR_CODE_FROM_ERRNO': 1, 'HAVE_INNETGR': 1, 'HAVE_MKNOD64': (), 'HAVE_RL_COMPLETION_FUNC_T': (), 'HAVE_POSIX_FADVISE': 1, 'HAVE_UMASK': 1, 'ENABLE_GNUTLS': 1, 'HAVE_INT8_T': 1, 'HAVE_SHM_OPEN': 1, 'HAVE_LINUX_NETLINK_H': 1, 'HAVE_SYSLOG_H': 1, 'HAVE_LINUX_SPLICE': 1, 'HAVE_FREEHOSTENT': (), 'HAVE_ARPA_NAMESER_H': 1, 'HAVE_LONGLONG': 1, 'HAVE_DECL_GETPWENT_R': 1, 'SAMBA4_INTERNAL_HEIMDAL': 1, 'HAVE_SA_FAMILY_T': 1, 'HAVE_SYS_STATVFS_H': 1, 'HAVE_KRB5_LOCATE_PLUGIN_H': 1, 'HAVE_ACL_GET_FILE': (), 'HAVE_STRUCT_STAT_ST_BIRTHTIMESPEC_TV_NSEC': (), 'HAVE_GSSKRB5_GET_SUBKEY': 1, 'HAVE_INTPTR_T': 1, '_XOPEN_SOURCE_EXTENDED': 1, 'SIZEOF_DEV_T': '8', 'HAVE_KRB5_PRINCIPAL_GET_REALM': 1, 'HAVE_SETPGID': 1, 'HAVE_FALLOCATE64': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_SET_PAC_REQUEST': 1, 'HAVE_GETHOSTNAME': 1, 'offset_t': 'loff_t', 'HAVE_GETPWNAM': 1, 'HAVE_CLOCK_REALTIME': 1, 'HAVE_GCRY_CONTROL': 1, 'HAVE_KRB5_GET_RENEWED_CREDS': 1, 'HAVE_GETRLIMIT': 1, 'HAVE_DECL_VASPRINTF': 1, 'HAVE_VISIBILITY_ATTR': 1, 'HAVE_READAHEAD_DECL': 1, 'HAVE_MKDIR_MODE': 1, 'HAVE_GET_CURRENT_DIR_NAME': 1, 'HAVE_DIRFD': 1, 'LINUX': '1', 'HAVE_KRB5_GET_CREDS': 1, '__TIME_T_MAX': 1, 'HAVE_U_INT32_T': 1, 'HAVE_FLISTEA': (), 'HAVE_SIG_ATOMIC_T_TYPE': 1, 'HAVE_GNUTLS_GNUTLS_H': 1, 'HAVE_SS_FAMILY': 1, 'static_decl_nss_info': 'extern NTSTATUS nss_info_template_init(void);', 'HAVE_PEERCRED': 1, 'HAVE_PWD_H': 1, 'HAVE__Bool': 1, 'vfs_io_uring_init': 'samba_init_module', 'HAVE_GRP_H': 1, 'SIZEOF_TIME_T': '8', 'HAVE_GETCWD': 1, 'HAVE_RAND': 1, 'HAVE_KRB_STRUCT_WINSIZE': 1, 'HAVE_ATTR_LISTF': (), 'HAVE___LLSEEK': (), 'HAVE_LDAP_INITIALIZE': (), 'HAVE_FSID_INT': 1, 'HAVE_KRB5_SESSION_IN_CREDS': 1, 'HAVE___STRTOULL': (), 'HAVE_SELECT': 1, 'HAVE_GETUTXENT': 1, 'HAVE_AIO_FSYNC': 1, 'HAVE__READDIR64': (), 'HAVE_GSS_WRAP_IOV': 1, 'RETSIGTYPE_INT': (), 'HAVE__DN_EXPAND': (), 'HAVE_RPCSVC_YPCLNT_H': 1, 'SIZEOF_INT64_T': '8', 'HAVE___CLOSE': 1, 'HAVE_READDIR64': 1, 'HAVE_SYS_UIO_H': 1, 'vfs_fileid_init': 'samba_init_module', 'HAVE___DUP': (), 'HAVE_GNUTLS_X509_CRT_SET_VERSION': 1, 'HAVE___READDIR64': (), 'HAVE_CGETENT': (), 'HAVE_LOFF_T': 1, 'vfs_skel_opaque_init': 'samba_init_module', 'HAVE_PWRITE64': 1, 'HAVE_LBER_LOG_PRINT_FN': (), 'HAVE_ASM_UNISTD_H': 1, 'HAVE_LINUX_IO_URING_H': 1, 'HAVE_UT_UT_NAME': 1, 'static_init_auth': '{ auth_sam_init();  auth_unix_init();  auth_winbind_init();  auth_wbc_init();  auth_server_init();  auth_domain_init();  auth_builtin_init();  auth_netlogond_init();  auth_samba4_init(); }', 'HAVE_REWINDDIR64': (), 'HAVE_ICONV_OPEN': 1, 'HAVE_MAKEDEV': (), 'HAVE__LSEEK': (), 'HAVE__DUP2': (), 'HAVE_STRSEP': 1, 'HAVE_SYS_WAIT_H': 1, 'HAVE_SIGPROCMASK': 1, 'HAVE_FDATASYNC': 1, 'HAVE_LISTXATTR': 1, 'HAVE__ACL': (), 'vfs_preopen_init': 'samba_init_module', 'HAVE_LLISTEA': (), 'HAVE_KRB5_FREE_HOST_REALM': 1, 'HAVE_STRUCT_SOCKADDR_IN6': 1, 'HAVE_GSS_OID_EQUAL': 1, 'vfs_linux_xfs_sgid_init': 'samba_init_module', 'HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIVAL_PTR': 1, 'HAVE_CTYPE_H': 1, 'HAVE_SYS_FILE_H': 1, 'HAVE_LINUX_IO_URING': 1, 'GETCWD_TAKES_NULL': 1, 'static_init_idmap': '{ idmap_tdb_init();  idmap_passdb_init();  idmap_nss_init(); }', 'HAVE_GETNAMEINFO': 1, 'HAVE_KRB5_KRBHST_INIT': 1, 'HAVE_SYS_MMAN_H': 1, 'HAVE_FCNTL_H': 1, 'HAVE_AVAHI_CLIENT_NEW': (), 'HAVE_DECL_ASPRINTF': 1, 'HAVE_LIBNCURSES': 1, 'HAVE_RES_SEARCH': 1, 'HAVE___STRTOLL': (), 'HAVE_STRNCASECMP': 1, 'HAVE_PAM_VSYSLOG': (), 'HAVE_NETINET_TCP_H': 1, 'HAVE_CTDB_H': (), 'HAVE_SETMNTENT': 1, 'HAVE_GETHOSTBYNAME_R': 1, 'HAVE___LSEEK': 1, 'HAVE___LXSTAT': 1, 'HAVE_STRNDUP': 1, 'SOLARIS_GETGRENT_R': (), 'HAVE_DECL_RL_EVENT_HOOK': 1, 'HAVE_SIGBLOCK': 1, 'HAVE_SETUIDX': (), 'HAVE_FREMOVEXATTR': 1, 'HAVE___DN_EXPAND': (), 'HAVE_STATVFS_F_FLAG': 1, 'HAVE_EXTATTR_LIST_LINK': (), 'HAVE_CLOSEDIR64': (), 'HAVE_KRB5_CRYPTO_INIT': 1, 'HAVE_UTMP_H': 1, 'HAVE_TIME_H': 1, 'HAVE_GRANTPT': 1, 'HAVE_TGETENT': 1, 'HAVE_NSS_H': 1, 'HAVE_PTHREAD_CREATE': 1, 'HAVE_KRB5_PDU_NONE_DECL': 1, 'HAVE_ATTRIBUTE_CONST': 1, 'HAVE_ENDHOSTENT': 1, 'HAVE__CLOSEDIR': (), 'HAVE_EXTATTR_GET_LINK': (), 'HAVE_STRNLEN': 1, 'HAVE_SYS_EPOLL_H': 1, 'HAVE_IPV6_V6ONLY': 1, 'HAVE_GETMNTENT': 1, 'HAVE_ST_RDEV': 1, 'HAVE_FOPEN64': 1, 'HAVE_GSS_INQUIRE_SEC_CONTEXT_BY_OID': 1, 'HAVE_TERMIO_H': 1, 'HAVE_U_CHAR': 1, 'HAVE_SETEGID': 1, 'HAVE_KRB5_ADDRESSES': 1, 'HAVE_KRB5_STRING_TO_KEY_SALT': 1, 'HAVE_INOTIFY_INIT': 1, 'HAVE_FLOAT_H': 1, 'LIBREPLACE_NETWORK_CHECKS': 1, 'HAVE_SETRESUID_DECL': 1, 'HAVE_GETUTMPX': 1, 'HAVE_MEMCPY': 1, 'HAVE_STRFTIME': 1, 'HAVE_NETINET_IN_SYSTM_H': 1, 'HAVE_GETIPNODEBYNAME': (), 'HAVE_LISTEA': (), 'vfs_syncops_init': 'samba_init_module', 'HAVE_GETPWENT_R': 1, 'HAVE_POLL_H': 1, 'HAVE_C99_VSNPRINTF': 1, 'HAVE_SWAB': 1, 'HAVE_STATFS_F_FSID': 1, 'SYSCONF_SC_NPROCESSORS_ONLN': 1, 'HAVE_HSTRERROR': 1, 'HAVE_SETPRIV': (), 'vfs_smb_traffic_analyzer_init': 'samba_init_module', 'HAVE_CRYPT_H': 1, 'HAVE___CHDIR': (), 'HAVE_EXTATTR_SET_LINK': (), 'HAVE_EPOLL_CREATE': 1, 'HAVE_READV': 1, 'HAVE_KRB5_PRINCIPAL_COMPARE_ANY_REALM': 1, 'HAVE_KRB5_REALM_TYPE': 1, 'HAVE_STRUCT_SOCKADDR': 1, 'HAVE__FORK': (), 'HAVE__LSTAT': (), 'HAVE_SOCKADDR_SA_LEN': (), 'HAVE_KERNEL_OPLOCKS_IRIX': (), 'HAVE_LASTLOG_H': 1, 'HAVE_PUTUTLINE': 1, 'HAVE_EXTATTR_GET_FD': (), 'HAVE_SETHOSTENT': 1, 'HAVE_EXTATTR_SET_FD': (), 'HAVE_ERR_H': 1, 'HAVE_SYS_UNISTD_H': 1, 'HAVE_LINUX_TYPES_H': 1, 'HAVE___ACL': (), 'static_decl_pdb': 'extern NTSTATUS pdb_smbpasswd_init(void); extern NTSTATUS pdb_tdbsam_init(void); extern NTSTATUS pdb_wbc_sam_init(void); extern NTSTATUS pdb_ads_init(void); extern NTSTATUS pdb_samba4_init(void);', 'HAVE_AP_OPTS_USE_SUBKEY': 1, 'HAVE_SIGSET': 1, 'HAVE__OPENDIR': (), 'HAVE_SYS_FCNTL_H': 1, 'static_decl_gpext': '', 'HAVE_DECL_H_ERRNO': 1, 'HAVE_DECL_VSNPRINTF': 1, 'HAVE_EXECINFO_H': 1, 'LDAP_SET_REBIND_PROC_ARGS': '3', 'HAVE_FRSIZE': 1, 'HAVE_PTHREAD_H': 1, 'HAVE_MSGHDR_MSG_CONTROL': 1, 'HAVE_ATTR_REMOVE': (), 'HAVE_UNISTD_H': 1, 'uint_t': 'unsigned int', 'HAVE_SETREGID': 1, 'HAVE_SYS_UN_H': 1, 'HAVE_LINUX_RTNETLINK_H': 1, 'HAVE_SYS_KERNEL_PROC_CORE_PATTERN': '1', 'HAVE_ATTRIBUTE_NORETURN': 1, '_HAVE_BROKEN_LINUX_SENDFILE': (), 'HAVE_GETPROGNAME': (), 'HAVE_COM_RIGHT_R': (), 'HAVE_GSSAPI_GSSAPI_KRB5_H': 1, 'HAVE_FTRUNCATE': 1, 'HAVE_STAT_ST_BLOCKS': 1, 'HAVE_STRLCPY': (), 'SIZEOF_INT32_T': '4', 'vfs_expand_msdfs_init': 'samba_init_module', 'HAVE_CURSES_H': 1, 'HAVE_GETGRENT_R_DECL': 1, 'HAVE_DN_EXPAND': 1, 'HAVE___XSTAT': 1, 'HAVE_LIBCRYPT': 1, 'HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC': 1, 'HAVE_GETDIRENTRIES': 1, 'HAVE_KRB5_KEYBLOCK_KEYVALUE': 1, 'HAVE_SEEKDIR64': (), 'HAVE_PTHREAD': '1', 'HAVE_FGETPROPLIST': (), 'HAVE_DECL_GETGRENT_R': 1, 'HAVE_VDPRINTF': 1, 'SIZEOF_BOOL': '1', 'HAVE_SYS_VFS_H': 1, 'HAVE_FREE_AP_REQ': 1, 'HAVE_BZERO': 1, 'vfs_acl_xattr_init': 'samba_init_module', 'HAVE_UTMPX_H': 1, 'HAVE_STRERROR_R': 1, 'HAVE_GETPAGESIZE': 1, 'HAVE_RENAME': 1, 'HAVE_GETIPNODEBYADDR': (), 'HAVE_MEMMOVE': 1, 'HAVE_STRUCT_STAT_ST_MTIME_N': (), 'HAVE_SYS_STATFS_H': 1, 'HAVE___SS_FAMILY': (), 'HAVE___WRITE': 1, 'DEFAULT_DOS_CHARSET': '"CP850"', 'static_decl_charset': 'extern NTSTATUS charset_weird_init(void);', 'HAVE_FDOPENDIR': 1, 'HAVE_SETPROGNAME': (), 'HAVE_ISBLANK': 1, 'HAVE__WRITE': (), 'HAVE_UTIME': 1, 'HAVE__OPEN64': (), 'HAVE_FCNTL_LOCK': 1, '_GNU_SOURCE': 1, 'HAVE__PWRITE': (), 'HAVE_RES_NSEARCH': 1, 'HAVE_GETDENTS64': 1, 'HAVE_GETGRSET': (), 'HAVE_LIBPTHREAD': 1, 'HAVE__GETCWD': (), 'HAVE_STRUCT_STAT_ST_MTIMENSEC': (), 'HAVE_FTRUNCATE_EXTEND': 1, 'HAVE_NET_IF_H': 1, 'HAVE_STRPTIME': 1, 'HAVE_IPV6': 1, 'HAVE_AIO_WRITE64': 1, 'HAVE_STRUCT_STAT_ST_UMTIME': (), 'SYSCONF_SC_NPROC_ONLN': (), 'HAVE_LDAP_OPT_SOCKBUF': (), 'HAVE__VA_ARGS__MACRO': 1, 'HAVE_ENDNETGRENT_PROTOTYPE': 1, 'vfs_catia_init': 'samba_init_module', 'VOID_RETSIGTYPE': 1, 'HAVE_PYTHON_H': 1, 'HAVE_BUILTIN_CHOOSE_EXPR': 1, 'HAVE_FREMOVEEA': (), 'HAVE_ETYPE_IN_ENCRYPTEDDATA': 1, 'HAVE___NR_INOTIFY_INIT_DECL': 1, 'HAVE_SRANDOM': 1, 'HAVE_UINT_T': (), 'HAVE_LSEEK64': 1, 'HAVE_SOCK_SIN_LEN': (), 'HAVE_BACKTRACE_SYMBOLS': 1, 'HAVE__PWRITE64': (), 'HAVE_GNUTLS_X509_CRT_SET_SUBJECT_KEY_ID': 1, 'HAVE_WARNX': 1, 'HAVE_BUILTIN_CLZ': 1, 'HAVE_ZLIB_H': 1, 'HAVE_UT_UT_TV': 1, 'HAVE_CAP_GET_PROC': (), 'HAVE_LIBKRB5': 1, 'HAVE_DECL_SNPRINTF': 1, 'HAVE_SETITIMER': 1, 'HAVE_PTHREAD_MUTEX_CONSISTENT': 1, 'HAVE_SYS_QUOTA_H': 1, 'SOCKET_WRAPPER': 1, 'HAVE_SHL_UNLOAD': (), 'HAVE_KRB5_GET_PW_SALT': 1, 'HAVE_FCHOWN': 1, 'HAVE_LITTLE_ENDIAN': 1, 'HAVE_GETGRNAM': 1, 'HAVE_PAM_RHOST': (), 'HAVE__FSTAT': (), 'HAVE_PAM_GET_DATA': (), 'HAVE___DUP2': 1, 'HAVE__READDIR': (), 'HAVE_LIBZ': 1, 'HAVE_ERRNO_H': 1, 'HAVE_SYS_IOCTL_H': 1, 'HAVE_POSIX_FALLOCATE': 1, 'HAVE_STRCASECMP': 1, 'HAVE_KRB5_GET_CREDS_OPT_SET_IMPERSONATE': 1, 'HAVE_STRDUP': 1, 'HAVE_BER_SCANF': (), 'SIZEOF_UINT8_T': '1', 'HAVE_UUID_GENERATE': 1, 'HAVE_TEXTDOMAIN': 1, 'HAVE_LLISTXATTR': 1, 'HAVE_INOTIFY': 1, 'HAVE__DUP': (), 'HAVE_OPENPTY': 1, 'HAVE_ATEXIT': 1, 'HAVE_UT_UT_ADDR_V6': 1, 'HAVE_EXTATTR_SET_FILE': (), 'HAVE_STRLWR': (), 'HAVE_SYS_RESOURCE_H': 1, 'HAVE_GET_PROPLIST_ENTRY': (), 'HAVE_LIBRT': 1, 'HAVE_STRUCT_FLOCK64': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_GET_ERROR': 1, 'HAVE_ATTR_GETF': (), 'HAVE_SA_SIGINFO_DECL': 1, 'HAVE_GETPGRP': 1, 'HAVE_AIO_SUSPEND64': 1, 'HAVE_GETGRENT': 1, 'HAVE_AIO_SUSPEND': 1, 'HAVE_VOLATILE': 1, 'HAVE_PREAD64': 1, 'HAVE_STRUCT_DIRENT64': '1', 'HAVE_GSS_DISPLAY_STATUS': 1, 'HAVE_EXTATTR_DELETE_LINK': (), 'pdb_test_init': 'samba_init_module', 'HAVE_EXPLICIT_LARGEFILE_SUPPORT': 1, 'HAVE___PREAD': (), 'HAVE_GETHOSTENT_R': 1, 'HAVE_SETEA': (), 'auth_skel_init': 'samba_init_module', 'TIME_WITH_SYS_TIME': 1, 'HAVE_UT_UT_HOST': 1, 'HAVE_ALLOCA_H': 1, 'HAVE_STAT_ST_BLKSIZE': 1, 'HAVE_DGETTEXT': 1, 'HAVE_SETEUID': 1, 'vfs_aio_pthread_init': 'samba_init_module', 'HAVE_WS_XPIXEL': 1, 'HAVE_MSGHDR_MSG_ACCTRIGHTS': (), 'static_init_gpext': '{}', 'HAVE_LANGINFO_H': 1, 'HAVE_ZLIBVERSION': 1, 'HAVE__PREAD64': (), 'HAVE__CLOSE': (), 'HAVE_KERNEL_OPLOCKS_LINUX': 1, 'HAVE_SYSCALL_H': 1, 'HAVE_CHFLAGS': (), 'HAVE_SYS_TIME_H': 1, 'HAVE_FUTIMES': 1, 'HAVE_FCVT': 1, 'HAVE_SHL_FINDSYM': (), 'HAVE_FSTAT64': 1, 'HAVE_UT_UT_ADDR': 1, 'HAVE_LDAP_INIT_FD': (), 'HAVE_PAM_START': (), 'HAVE_DUP2': 1, 'HAVE_FSEEKO': 1, 'XATTR_ADD_OPT': (), 'HAVE_SYS_PRCTL_H': 1, 'HAVE_KRB5_FWD_TGT_CREDS': 1, 'HAVE_ERRX': 1, 'HAVE_BIND_TEXTDOMAIN_CODESET': 1, 'HAVE__TELLDIR': (), 'HAVE_SOCKETPAIR': 1, 'HAVE_SYS_TERMIOS_H': 1, 'HAVE_GETTEXT': 1, 'HAVE_BROKEN_FCNTL64_LOCKS': (), 'WITH_DNS_UPDATES': 1, 'HAVE_LINUX_FALLOC_H': 1, 'HAVE_WAIT4': 1, 'HAVE_GETDENTS': (), 'HAVE__STAT': (), 'UID_WRAPPER': 1, 'HAVE_DARWIN_INITGROUPS': (), 'HAVE_KERNEL_SHARE_MODES': 1, 'HAVE_STRLCAT': (), 'HAVE__FCHDIR': (), 'HAVE_TIMEGM': 1, 'HAVE_FREEADDRINFO': 1, 'vfs_streams_xattr_init': 'samba_init_module', 'ber_tag_t': 'unsigned int', 'static_decl_auth': 'extern NTSTATUS auth_sam_init(void); extern NTSTATUS auth_unix_init(void); extern NTSTATUS auth_winbind_init(void); extern NTSTATUS auth_wbc_init(void); extern NTSTATUS auth_server_init(void); extern NTSTATUS auth_domain_init(void); extern NTSTATUS auth_builtin_init(void); extern NTSTATUS auth_netlogond_init(void); extern NTSTATUS auth_samba4_init(void);', 'HAVE_KRB5_FREE_ERROR_CONTENTS': 1, 'HAVE__LLSEEK': (), 'HAVE_GETSPNAM': 1, 'HAVE_MKTIME': 1, 'HAVE_LSETEA': (), 'HAVE_SOCKET': 1, 'HAVE_LIBUUID': 1, 'KRB5_CREDS_OPT_FREE_REQUIRES_CONTEXT': 1, 'HAVE_SYMLINK': 1, 'HAVE_STDDEF_H': 1, 'HAVE_HTTPCONNECT': (), 'HAVE__SEEKDIR': (), 'HAVE_FSETXATTR': 1, 'BROKEN_NISPLUS_INCLUDE_FILES': 1, 'HAVE_EXTATTR_LIST_FD': (), 'HAVE_RL_COMPLETION_MATCHES': 1, 'HAVE_NEW_LIBREADLINE': 1, 'HAVE_STRTOQ': 1, 'HAVE_ENDMNTENT': 1, 'HAVE_PWRITE': 1, 'HAVE_MKNOD': 1, 'HAVE_MUNLOCK': 1, 'HAVE_ENCTYPE_AES256_CTS_HMAC_SHA1_96': 1, 'HAVE_LSETXATTR': 1, 'HAVE_UINTPTR_T': 1, 'static_decl_perfcount': '', 'HAVE_GETGRGID_R': 1, 'HAVE__FSTAT64': (), 'HAVE_INO_T': 1, 'HAVE_CRYPT': 1, 'static_init_vfs': '{ vfs_default_init();  vfs_dfs_samba4_init(); }', 'HAVE_SYS_TIMEB_H': 1, 'HAVE_ENCTYPE_ARCFOUR_HMAC_MD5': 1, 'NSS_WRAPPER': 1, 'HAVE_WARN': 1, 'HAVE_ATTR_LIST': (), 'REPLACE_STRPTIME': (), 'HAVE_GETPASSPHRASE': (), 'HAVE_LLSEEK': (), 'HAVE_DECL_KRB5_AUTH_CON_SET_REQ_CKSUMTYPE': 0, 'HAVE_ISATTY': 1, 'HAVE_FSETEA': (), 'HAVE_LINK': 1, 'HAVE_KRB5_KU_OTHER_CKSUM': 1, 'HAVE_KRB5_DECODE_AP_REQ': 1, 'HAVE___SEEKDIR': (), 'HAVE_GETGRENT_R': 1, 'SIZEOF_VOID_P': '8', 'HAVE_STRPBRK': 1, 'HAVE_UT_UT_USER': 1, 'HAVE_CHSIZE': (), 'HAVE_EXECL': 1, 'HAVE_OPENDIR64': (), 'HAVE_KRB5_PRINCIPAL_GET_COMP_STRING': 1, 'REPLACE_GETPASS': 1, 'HAVE_COMPILER_WILL_OPTIMIZE_OUT_FNS': 1, 'REALPATH_TAKES_NULL': 1, 'HAVE_LIMITS_H': 1, 'HAVE_CONFIG_H': 1, 'vfs_dirsort_init': 'samba_init_module', 'HAVE_NANOSLEEP': 1, 'HAVE___PWRITE': (), 'HAVE_CLOSEFROM': 1, 'HAVE_KRB5_AUTH_CON_SETKEY': 1, 'HAVE_AIOCB64': '1', 'HAVE_WRITEV': 1, 'vfs_full_audit_init': 'samba_init_module', 'HAVE_YP_GET_DEFAULT_DOMAIN': 1, 'HAVE_GETTIMEOFDAY_TZ': 1, 'HAVE_TERMIOS_H': 1, 'HAVE_FUNCTION_MACRO': 1, 'SYSCONF_SC_NGROUPS_MAX': 1, 'HAVE_FTELLO64': 1, 'HAVE_BSWAP32': (), 'HAVE_UTIMENSAT': 1, 'HAVE_BUILTIN_CLZLL': 1, 'HAVE_PERL_MAKEMAKER': 1, 'HAVE_KRB5_SET_REAL_TIME': 1, 'HAVE_TYPEOF': 1, 'HAVE_STRCHR': 1, 'KRB5_PRINC_REALM_RETURNS_REALM': 1, 'HAVE_DPRINTF': 1, 'HAVE_OFFSET_T': (), 'HAVE_SYS_DIR_H': 1, 'HAVE_PTY_H': 1, 'HAVE_GNUTLS_X509_H': 1, 'HAVE_MEMSET': 1, 'HAVE_LIBGNUTLS': 1, 'WITH_AIO': '1', 'HAVE_VSNPRINTF': 1, 'HAVE_STRTOUQ': 1, 'HAVE_AIO_WRITE': 1, 'HAVE___STAT': (), 'HAVE_SNPRINTF': 1, 'HAVE_SYS_TYPES_H': 1, 'HAVE_CHROOT': 1, 'HAVE_SYS_SELECT_H': 1, 'HAVE_SSIZE_T': 1, 'HAVE_FCHMOD': 1, 'HAVE_DIRENT_H': 1, 'HAVE_BER_TAG_T': (), 'HAVE_STAT_TV_NSEC': 1, 'HAVE___TELLDIR': (), 'HAVE_KRB5_ENCTYPE_TO_STRING_WITH_KRB5_CONTEXT_ARG': 1, 'HAVE_PATHCONF': 1, 'HAVE_LDAP_INIT': (), 'HAVE___FSTAT64': 1, 'HAVE___FXSTAT': 1, 'HAVE_SETGROUPS': 1, 'vfs_audit_init': 'samba_init_module', 'HAVE_ASM_TYPES_H': 1, 'HAVE_POSIX_FALLOCATE64': 1, 'HAVE_UNAME': 1, 'HAVE_ASSERT_H': 1, 'HAVE_SIGACTION': 1, 'HAVE_KRB5_GET_CREDS_OPT_ALLOC': 1, 'HAVE_MKDTEMP': 1, '_HAVE_SENDFILE': 1, 'HAVE_CRYPT16': (), 'HAVE_SHMGET': 1, 'HAVE_UINT64_T': 1, 'SIZEOF_UINT32_T': '4', 'HAVE_GETPWENT_R_DECL': 1, 'HAVE_BSD_STRTOLL': (), 'vfs_shadow_copy_test_init': 'samba_init_module', 'vfs_scannedonly_init': 'samba_init_module', 'HAVE_STRUCT_STAT_ST_BIRTHTIMENSEC': (), 'HAVE_STRERROR': 1, 'HAVE_UINT8_T': 1, 'STRING_STATIC_MODULES': '"pdb_smbpasswd pdb_tdbsam pdb_wbc_sam auth_sam auth_unix auth_winbind auth_wbc auth_server auth_domain auth_builtin vfs_default nss_info_template idmap_tdb idmap_passdb idmap_nss pdb_ads auth_netlogond charset_weird pdb_samba4 auth_samba4 vfs_dfs_samba4"', 'HAVE_GETPWNAM_R': 1, 'idmap_autorid_init': 'samba_init_module', 'HAVE_FSEEK64': (), 'HAVE_INET_ATON': 1, 'HAVE_LCHOWN': 1, 'HAVE_DELPROPLIST': (), 'HAVE_READLINK': 1, 'HAVE_SYS_TIMES_H': 1, 'HAVE_ERR': 1, 'HAVE_PREAD': 1, 'HAVE_FLOCK': 1, 'HAVE_ATTR_SETF': (), 'HAVE_STRUCT_WINSIZE': 1, 'HAVE___LSTAT64': (), 'HAVE_ADD_PROPLIST_ENTRY': (), 'vfs_netatalk_init': 'samba_init_module', 'HAVE_POLL': 1, 'HAVE_SETPROPLIST': (), 'HAVE_SETREUID': 1, 'HAVE_SIZEOF_PROPLIST_ENTRY': (), 'vfs_time_audit_init': 'samba_init_module'}
+developer = True
+disable_python = False
+enable_gnutls = True
+hlist = ['stdio.h', 'sys/types.h', 'sys/stat.h', 'stdlib.h', 'stddef.h', 'memory.h', 'string.h', 'strings.h', 'inttypes.h', 'stdint.h', 'unistd.h', 'ctype.h', 'stdbool.h', 'stdarg.h']
+idmap_autorid_init = 'samba_init_module'
+in_compound = 0
+macbundle_PATTERN = '%s.bundle'
+offset_t = 'loff_t'
+pdb_test_init = 'samba_init_module'
+perfcount_test_init = 'samba_init_module'
+program_PATTERN = '%s'
+pyext_PATTERN = '%s.so'
+python_headers_checked = 'yes'
+shared_modules = ['vfs_recycle', 'vfs_audit', 'vfs_extd_audit', 'vfs_full_audit', 'vfs_netatalk', 'vfs_fake_perms', 'vfs_default_quota', 'vfs_readonly', 'vfs_cap', 'vfs_expand_msdfs', 'vfs_shadow_copy', 'vfs_shadow_copy2', 'auth_script', 'vfs_readahead', 'vfs_xattr_tdb', 'vfs_streams_xattr', 'vfs_streams_depot', 'vfs_acl_xattr', 'vfs_acl_tdb', 'vfs_smb_traffic_analyzer', 'vfs_preopen', 'vfs_catia', 'vfs_scannedonly', 'vfs_crossrename', 'vfs_linux_xfs_sgid', 'vfs_time_audit', 'idmap_autorid', 'perfcount_test', 'vfs_skel_opaque', 'vfs_skel_transparent', 'vfs_shadow_copy_test', 'auth_skel', 'pdb_test', 'vfs_syncops', 'vfs_dirsort', 'vfs_fileid', 'vfs_aio_fork', 'vfs_aio_pthread', 'vfs_io_uring']
+shlib_CCFLAGS = ['-fPIC', '-DPIC']
+shlib_LINKFLAGS = ['-shared']
+shlib_PATTERN = 'lib%s.so'
+srcdir = '/root/repo'
+standalone_ldb = False
+standalone_replace = False
+standalone_talloc = False
+standalone_tdb = False
+standalone_tevent = False
+static_decl_auth = 'extern NTSTATUS auth_sam_init(void); extern NTSTATUS auth_unix_init(void); extern NTSTATUS auth_winbind_init(void); extern NTSTATUS auth_wbc_init(void); extern NTSTATUS auth_server_init(void); extern NTSTATUS auth_domain_init(void); extern NTSTATUS auth_builtin_init(void); extern NTSTATUS auth_netlogond_init(void); extern NTSTATUS auth_samba4_init(void);'
+static_decl_charset = 'extern NTSTATUS charset_weird_init(void);'
+static_decl_gpext = ''
+static_decl_idmap = 'extern NTSTATUS idmap_tdb_init(void); extern NTSTATUS idmap_passdb_init(void); extern NTSTATUS idmap_nss_init(void);'
+static_decl_nss_info = 'extern NTSTATUS nss_info_template_init(void);'
+static_decl_pdb = 'extern NTSTATUS pdb_smbpasswd_init(void); extern NTSTATUS pdb_tdbsam_init(void); extern NTSTATUS pdb_wbc_sam_init(void); extern NTSTATUS pdb_ads_init(void); extern NTSTATUS pdb_samba4_init(void);'
+static_decl_perfcount = ''
+static_decl_vfs = 'extern NTSTATUS vfs_default_init(void); extern NTSTATUS vfs_dfs_samba4_init(void);'
+static_init_auth = '{ auth_sam_init();  auth_unix_init();  auth_winbind_init();  auth_wbc_init();  auth_server_init();  auth_domain_init();  auth_builtin_init();  auth_netlogond_init();  auth_samba4_init(); }'
+static_init_charset = '{ charset_weird_init(); }'
+static_init_gpext = '{}'
+static_init_idmap = '{ idmap_tdb_init();  idmap_passdb_init();  idmap_nss_init(); }'
+static_init_nss_info = '{ nss_info_template_init(); }'
+static_init_pdb = '{ pdb_smbpasswd_init();  pdb_tdbsam_init();  pdb_wbc_sam_init();  pdb_ads_init();  pdb_samba4_init(); }'
+static_init_perfcount = '{}'
+static_init_vfs = '{ vfs_default_init();  vfs_dfs_samba4_init(); }'
+static_modules = ['pdb_smbpasswd', 'pdb_tdbsam', 'pdb_wbc_sam', 'auth_sam', 'auth_unix', 'auth_winbind', 'auth_wbc', 'auth_server', 'auth_domain', 'auth_builtin', 'vfs_default', 'nss_info_template', 'idmap_tdb', 'idmap_passdb', 'idmap_nss', 'pdb_ads', 'auth_netlogond', 'charset_weird', 'pdb_samba4', 'auth_samba4', 'vfs_dfs_samba4']
+staticlib_LINKFLAGS = ['-Wl,-Bstatic']
+staticlib_PATTERN = 'lib%s.a'
+uint_t = 'unsigned int'
+undefined_ldflags = ['-Wl,-no-undefined']
+vfs_acl_tdb_init = 'samba_init_module'
+vfs_acl_xattr_init = 'samba_init_module'
+vfs_aio_fork_init = 'samba_init_module'
+vfs_aio_pthread_init = 'samba_init_module'
+vfs_audit_init = 'samba_init_module'
+vfs_cap_init = 'samba_init_module'
+vfs_catia_init = 'samba_init_module'
+vfs_crossrename_init = 'samba_init_module'
+vfs_default_quota_init = 'samba_init_module'
+vfs_dirsort_init = 'samba_init_module'
+vfs_expand_msdfs_init = 'samba_init_module'
+vfs_extd_audit_init = 'samba_init_module'
+vfs_fake_perms_init = 'samba_init_module'
+vfs_fileid_init = 'samba_init_module'
+vfs_full_audit_init = 'samba_init_module'
+vfs_io_uring_init = 'samba_init_module'
+vfs_linux_xfs_sgid_init = 'samba_init_module'
+vfs_netatalk_init = 'samba_init_module'
+vfs_preopen_init = 'samba_init_module'
+vfs_readahead_init = 'samba_init_module'
+vfs_readonly_init = 'samba_init_module'
+vfs_recycle_init = 'samba_init_module'
+vfs_scannedonly_init = 'samba_init_module'
+vfs_shadow_copy2_init = 'samba_init_module'
+vfs_shadow_copy_init = 'samba_init_module'
+vfs_shadow_copy_test_init = 'samba_init_module'
+vfs_skel_opaque_init = 'samba_init_module'
+vfs_skel_transparent_init = 'samba_init_module'
+vfs_smb_traffic_analyzer_init = 'samba_init_module'
+vfs_streams_depot_init = 'samba_init_module'
+vfs_streams_xattr_init = 'samba_init_module'
+vfs_syncops_init = 'samba_init_module'
+vfs_time_audit_init = 'samba_init_module'
+vfs_xattr_tdb_init = 'samba_init_module'
+with_avahi = False
+with_iconv = True
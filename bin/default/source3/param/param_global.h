@@ -0,0 +1,256 @@
+#ifndef __DEFAULT_SOURCE3_PARAM_PARAM_GLOBAL_H__
+#define __DEFAULT_SOURCE3_PARAM_PARAM_GLOBAL_H__
+
+/* This file was automatically generated by mkparamdefs.pl. DO NOT EDIT */
+
+/**
+ * This structure describes global (ie., server-wide) parameters.
+ */
+struct loadparm_global 
+{
+	char *  smb_ports;
+	char *  dos_charset;
+	char *  unix_charset;
+	char *  szLogFile;
+	char *  szConfigFile;
+	char *  szSMBPasswdFile;
+	char *  szPrivateDir;
+	char *  szServerString;
+	int   PrintcapCacheTime;
+	char *  szAddPortCommand;
+	char *  szEnumPortsCommand;
+	char *  szAddPrinterCommand;
+	char *  szDeletePrinterCommand;
+	char *  szOs2DriverMap;
+	char *  szLockDir;
+	char *  szPidDir;
+	char *  szManglingMethod;
+	int   mangle_prefix;
+	char *  szUtmpDir;
+	char *  szWtmpDir;
+	bool   bUtmp;
+	char *  szRootdir;
+	char *  szSMBPerfcountModule;
+	char *  szDefaultService;
+	char *  szMsgCommand;
+	char *  szGetQuota;
+	char *  szSetQuota;
+	char *  szAutoServices;
+	char *  szPasswdProgram;
+	char *  szPasswdChat;
+	char *  szPasswordServer;
+	char *  szNameResolveOrder;
+	char *  szWorkgroup;
+	char *  szNetbiosName;
+	char *  szNetbiosScope;
+	char *  szRealmUpper;
+	char *  szDnsDomain;
+	char *  szAfsUsernameMap;
+	int   iAfsTokenLifetime;
+	char *  szLogNtTokenCommand;
+	char *  szUsernameMap;
+	char *  szLogonScript;
+	char *  szLogonPath;
+	char *  szLogonDrive;
+	char *  szLogonHome;
+	char *  szRemoteAnnounce;
+	char *  szRemoteBrowseSync;
+	bool   bNmbdBindExplicitBroadcast;
+	const char **  szWINSservers;
+	const char **  szInterfaces;
+	char *  szNISHomeMapName;
+	const char **  szNetbiosAliases;
+	char *  szPassdbBackend;
+	const char **  szPreloadModules;
+	char *  szPanicAction;
+	char *  szAddUserScript;
+	char *  szRenameUserScript;
+	char *  szDelUserScript;
+	char *  szGuestaccount;
+	char *  szAddGroupScript;
+	char *  szDelGroupScript;
+	char *  szAddUserToGroupScript;
+	char *  szDelUserFromGroupScript;
+	char *  szSetPrimaryGroupScript;
+	char *  szAddMachineScript;
+	char *  szShutdownScript;
+	char *  szAbortShutdownScript;
+	char *  szUsernameMapScript;
+	int   iUsernameMapCacheTime;
+	char *  szCheckPasswordScript;
+	char *  szWINSHook;
+	char *  szTemplateHomedir;
+	char *  szTemplateShell;
+	char *  szWinbindSeparator;
+	int   iAclCompat;
+	bool   bWinbindEnumUsers;
+	bool   bWinbindEnumGroups;
+	bool   bWinbindUseDefaultDomain;
+	bool   bWinbindTrustedDomainsOnly;
+	bool   bWinbindNestedGroups;
+	int   winbind_expand_groups;
+	bool   bWinbindRefreshTickets;
+	bool   bWinbindOfflineLogon;
+	bool   bWinbindNormalizeNames;
+	bool   bWinbindRpcOnly;
+	bool   bCreateKrb5Conf;
+	char *  szIdmapBackend;
+	int   iIdmapCacheTime;
+	int   iIdmapNegativeCacheTime;
+	int   iKeepalive;
+	bool   bPassdbExpandExplicit;
+	char *  szLdapSuffix;
+	char *  szLdapAdminDn;
+	int   ldap_ssl;
+	bool   ldap_ssl_ads;
+	int   ldap_deref;
+	int   ldap_follow_referral;
+	int   ldap_passwd_sync;
+	bool   ldap_delete_dn;
+	int   ldap_replication_sleep;
+	int   ldap_timeout;
+	int   ldap_connection_timeout;
+	int   ldap_page_size;
+	int   ldap_debug_level;
+	int   ldap_debug_threshold;
+	char *  szAddShareCommand;
+	char *  szChangeShareCommand;
+	char *  szDeleteShareCommand;
+	char *  szUsersharePath;
+	const char **  szUsersharePrefixAllowList;
+	const char **  szUsersharePrefixDenyList;
+	const char **  szEventLogs;
+	bool   bRegistryShares;
+	bool   bUsershareAllowGuests;
+	bool   bUsershareOwnerOnly;
+	bool   bDisableNetbios;
+	bool   bResetOnZeroVC;
+	bool   bLogWriteableFilesOnExit;
+	bool   bMsAddPrinterWizard;
+	bool   bDNSproxy;
+	bool   bWINSsupport;
+	bool   bWINSproxy;
+	bool   bLocalMaster;
+	bool   bDomainLogons;
+	const char **  szInitLogonDelayedHosts;
+	int   InitLogonDelay;
+	bool   bLoadPrinters;
+	bool   bReadRaw;
+	bool   bLargeReadwrite;
+	bool   bWriteRaw;
+	bool   bNullPasswords;
+	bool   bObeyPamRestrictions;
+	bool   bEncryptPasswords;
+	int   clientSchannel;
+	int   serverSchannel;
+	bool   bSyslogOnly;
+	bool   bTimestampLogs;
+	bool   bDebugPrefixTimestamp;
+	bool   bDebugHiresTimestamp;
+	bool   bDebugPid;
+	bool   bDebugUid;
+	bool   bDebugClass;
+	bool   bEnableCoreFiles;
+	bool   bBrowseList;
+	bool   bNISHomeMap;
+	bool   bTimeServer;
+	bool   bBindInterfacesOnly;
+	bool   bPamPasswordChange;
+	bool   bUnixPasswdSync;
+	bool   bPasswdChatDebug;
+	int   iPasswdChatTimeout;
+	bool   bNTPipeSupport;
+	bool   bNTStatusSupport;
+	bool   bStatCache;
+	bool   bNameIndex;
+	bool   bStatCacheShared;
+	bool   bDirStatCache;
+	int   iMaxStatCacheSize;
+	bool   bAllowTrustedDomains;
+	bool   bMapUntrustedToDomain;
+	int   restrict_anonymous;
+	bool   bLanmanAuth;
+	bool   bNTLMAuth;
+	bool   bClientPlaintextAuth;
+	bool   bClientLanManAuth;
+	bool   bClientNTLMv2Auth;
+	bool   bHostMSDfs;
+	bool   bKernelOplocks;
+	bool   enhanced_browsing;
+	bool   bUseMmap;
+	bool   bUnixExtensions;
+	bool   bUseSpnego;
+	bool   bClientUseSpnego;
+	bool   client_use_spnego_principal;
+	bool   send_spnego_principal;
+	bool   bHostnameLookups;
+	char *  szDedicatedKeytabFile;
+	int   iKerberosMethod;
+	bool   bDeferSharingViolations;
+	bool   bEnablePrivileges;
+	bool   bASUSupport;
+	int   os_level;
+	int   max_ttl;
+	int   max_wins_ttl;
+	int   min_wins_ttl;
+	int   max_log_size;
+	int   max_open_files;
+	int   open_files_db_hash_size;
+	int   max_xmit;
+	int   max_mux;
+	int   pwordlevel;
+	int   unamelevel;
+	int   deadtime;
+	bool   getwd_cache;
+	int   maxprotocol;
+	int   minprotocol;
+	int   security;
+	const char **  AuthMethods;
+	bool   paranoid_server_security;
+	int   maxdisksize;
+	int   lpqcachetime;
+	int   iMaxSmbdProcesses;
+	bool   bDisableSpoolss;
+	int   syslog;
+	int   lm_announce;
+	int   lm_interval;
+	int   machine_password_timeout;
+	int   map_to_guest;
+	int   oplock_break_wait_time;
+	int   iLockSpinTime;
+	int   iUsershareMaxShares;
+	char *  szSocketOptions;
+	int   ConfigBackend;
+	int   ServerRole;
+	int   ismb2_max_read;
+	int   ismb2_max_write;
+	int   ismb2_max_trans;
+	int   ismb2_worker_threads;
+	const char **  szServicesList;
+	char *  szCupsServer;
+	char *  szIPrintServer;
+	int   cups_connection_timeout;
+	char *  ctdbdSocket;
+	const char **  szClusterAddresses;
+	bool   clustering;
+	bool   bMessagingSockets;
+	int   ctdb_timeout;
+	int   ctdb_locktime_warn_threshold;
+	bool   bAsyncSMBEchoHandler;
+	bool   bMulticastDnsRegister;
+	bool   bAllowInsecureWidelinks;
+	int   winbind_cache_time;
+	int   winbind_reconnect_delay;
+	int   winbind_max_clients;
+	const char **  szWinbindNssInfo;
+	int   AlgorithmicRidBase;
+	int   name_cache_timeout;
+	int   client_signing;
+	int   server_signing;
+	int   client_ldap_sasl_wrapping;
+	char *  ncalrpc_dir;
+LOADPARM_EXTRA_GLOBALS
+};
+
+#endif /* __DEFAULT_SOURCE3_PARAM_PARAM_GLOBAL_H__ */
+
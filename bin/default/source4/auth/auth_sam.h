@@ -0,0 +1,30 @@
+#ifndef __DEFAULT_SOURCE4_AUTH_AUTH_SAM_H__
+#define __DEFAULT_SOURCE4_AUTH_AUTH_SAM_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/auth/sam.c  */
+
+NTSTATUS sam_get_results_principal(struct ldb_context *sam_ctx,
+				   TALLOC_CTX *mem_ctx, const char *principal,
+				   const char **attrs,
+				   struct ldb_dn **domain_dn,
+				   struct ldb_message **msg);
+NTSTATUS authsam_get_user_info_dc_principal(TALLOC_CTX *mem_ctx,
+					   struct loadparm_context *lp_ctx,
+					   struct ldb_context *sam_ctx,
+					   const char *principal,
+					   struct ldb_dn *user_dn,
+					   struct auth_user_info_dc **user_info_dc);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_AUTH_AUTH_SAM_H__ */
+
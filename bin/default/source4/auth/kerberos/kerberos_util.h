@@ -0,0 +1,45 @@
+#ifndef __DEFAULT_SOURCE4_AUTH_KERBEROS_KERBEROS_UTIL_H__
+#define __DEFAULT_SOURCE4_AUTH_KERBEROS_KERBEROS_UTIL_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/auth/kerberos/kerberos_util.c  */
+
+krb5_error_code principal_from_credentials(TALLOC_CTX *parent_ctx, 
+					    struct cli_credentials *credentials, 
+					    struct smb_krb5_context *smb_krb5_context,
+					    krb5_principal *princ,
+					    enum credentials_obtained *obtained,
+					    const char **error_string);
+
+/**
+ * Return a freshly allocated ccache (destroyed by destructor on child
+ * of parent_ctx), for a given set of client credentials 
+ */
+krb5_error_code smb_krb5_get_keytab_container(TALLOC_CTX *mem_ctx,
+					      struct smb_krb5_context *smb_krb5_context,
+					      const char *keytab_name, struct keytab_container **ktc);
+krb5_error_code smb_krb5_update_keytab(TALLOC_CTX *parent_ctx,
+				       struct smb_krb5_context *smb_krb5_context,
+				       struct ldb_context *ldb, 
+				       struct ldb_message *msg,
+				       bool delete_all_kvno,
+				       const char **error_string);
+krb5_error_code smb_krb5_create_memory_keytab(TALLOC_CTX *parent_ctx,
+					   struct cli_credentials *machine_account,
+					   struct smb_krb5_context *smb_krb5_context,
+					   struct keytab_container **keytab_container) ;
+uint32_t kerberos_enctype_to_bitmap(krb5_enctype enc_type_enum);
+krb5_error_code kerberos_enctype_bitmap_to_enctypes(TALLOC_CTX *mem_ctx, uint32_t enctype_bitmap, krb5_enctype **enctypes);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_AUTH_KERBEROS_KERBEROS_UTIL_H__ */
+
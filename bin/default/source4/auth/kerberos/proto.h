@@ -0,0 +1,70 @@
+#ifndef __DEFAULT_SOURCE4_AUTH_KERBEROS_PROTO_H__
+#define __DEFAULT_SOURCE4_AUTH_KERBEROS_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/auth/kerberos/kerberos.c  */
+
+
+/* The following definitions come from ../source4/auth/kerberos/kerberos_heimdal.c  */
+
+krb5_error_code smb_rd_req_return_stuff(krb5_context context, 
+					krb5_auth_context *auth_context,
+					const krb5_data *inbuf,
+					krb5_keytab keytab, 
+					krb5_principal acceptor_principal,
+					krb5_data *outbuf, 
+					krb5_ticket **ticket, 
+					krb5_keyblock **keyblock);
+
+/* The following definitions come from ../source4/auth/kerberos/kerberos_pac.c  */
+
+krb5_error_code kerberos_pac_to_user_info_dc(TALLOC_CTX *mem_ctx,
+					     krb5_pac pac,
+					     krb5_context context,
+					     struct auth_user_info_dc **user_info_dc,
+					     struct PAC_SIGNATURE_DATA *pac_srv_sig,
+					     struct PAC_SIGNATURE_DATA *pac_kdc_sig);
+NTSTATUS kerberos_pac_blob_to_user_info_dc(TALLOC_CTX *mem_ctx,
+					   DATA_BLOB pac_blob,
+					   krb5_context context,
+					   struct auth_user_info_dc **user_info_dc,
+					   struct PAC_SIGNATURE_DATA *pac_srv_sig,
+					   struct PAC_SIGNATURE_DATA *pac_kdc_sig);
+
+/* The following definitions come from ../source4/auth/kerberos/krb5_init_context.c  */
+
+krb5_error_code smb_krb5_send_and_recv_func(krb5_context context,
+					    void *data,
+					    krb5_krbhst_info *hi,
+					    time_t timeout,
+					    const krb5_data *send_buf,
+					    krb5_data *recv_buf);
+krb5_error_code smb_krb5_init_context(void *parent_ctx,
+				      struct tevent_context *ev,
+				      struct loadparm_context *lp_ctx,
+				      struct smb_krb5_context **smb_krb5_context);
+krb5_error_code smb_krb5_context_set_event_ctx(struct smb_krb5_context *smb_krb5_context,
+					       struct tevent_context *ev,
+					       struct tevent_context **previous_ev);
+krb5_error_code smb_krb5_context_remove_event_ctx(struct smb_krb5_context *smb_krb5_context,
+						  struct tevent_context *previous_ev,
+						  struct tevent_context *ev);
+
+/* The following definitions come from ../source4/auth/kerberos/keytab_copy.c  */
+
+krb5_error_code kt_copy (krb5_context context, const char *from, const char *to);
+krb5_error_code kt_copy_one_principal (krb5_context context, const char *from, const char *to, 
+				       const char *principal, krb5_kvno kvno, krb5_enctype *enctypes);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_AUTH_KERBEROS_PROTO_H__ */
+
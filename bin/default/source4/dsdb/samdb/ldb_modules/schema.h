@@ -0,0 +1,31 @@
+#ifndef __DEFAULT_SOURCE4_DSDB_SAMDB_LDB_MODULES_SCHEMA_H__
+#define __DEFAULT_SOURCE4_DSDB_SAMDB_LDB_MODULES_SCHEMA_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/dsdb/samdb/ldb_modules/schema.c  */
+
+const struct dsdb_class * get_last_structural_class(const struct dsdb_schema *schema,const struct ldb_message_element *element,
+						    struct ldb_request *parent);
+int acl_check_access_on_class(struct ldb_module *module,
+			      const struct dsdb_schema *schema,
+			      TALLOC_CTX *mem_ctx,
+			      struct security_descriptor *sd,
+			      struct dom_sid *rp_sid,
+			      uint32_t access_mask,
+			      const char *class_name);
+const struct GUID *get_oc_guid_from_message(struct ldb_module *module,
+						   const struct dsdb_schema *schema,
+						   struct ldb_message *msg);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_DSDB_SAMDB_LDB_MODULES_SCHEMA_H__ */
+
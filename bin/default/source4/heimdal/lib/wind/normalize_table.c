@@ -0,0 +1,22977 @@
+/* /root/repo/bin/default/source4/heimdal/lib/wind/normalize_table.c */
+/* Automatically generated at 2026-10-17T03:30:17.275879 */
+
+
+#include <stdlib.h>
+#include "normalize_table.h"
+
+const struct translation _wind_normalize_table[] = {
+  {0xa0, 1, 0}, /* NO-BREAK SPACE */
+  {0xa8, 2, 1}, /* DIAERESIS */
+  {0xaa, 1, 3}, /* FEMININE ORDINAL INDICATOR */
+  {0xaf, 2, 4}, /* MACRON */
+  {0xb2, 1, 6}, /* SUPERSCRIPT TWO */
+  {0xb3, 1, 7}, /* SUPERSCRIPT THREE */
+  {0xb4, 2, 8}, /* ACUTE ACCENT */
+  {0xb5, 1, 10}, /* MICRO SIGN */
+  {0xb8, 2, 11}, /* CEDILLA */
+  {0xb9, 1, 13}, /* SUPERSCRIPT ONE */
+  {0xba, 1, 14}, /* MASCULINE ORDINAL INDICATOR */
+  {0xbc, 3, 15}, /* VULGAR FRACTION ONE QUARTER */
+  {0xbd, 3, 18}, /* VULGAR FRACTION ONE HALF */
+  {0xbe, 3, 21}, /* VULGAR FRACTION THREE QUARTERS */
+  {0xc0, 2, 24}, /* LATIN CAPITAL LETTER A WITH GRAVE */
+  {0xc1, 2, 26}, /* LATIN CAPITAL LETTER A WITH ACUTE */
+  {0xc2, 2, 28}, /* LATIN CAPITAL LETTER A WITH CIRCUMFLEX */
+  {0xc3, 2, 30}, /* LATIN CAPITAL LETTER A WITH TILDE */
+  {0xc4, 2, 32}, /* LATIN CAPITAL LETTER A WITH DIAERESIS */
+  {0xc5, 2, 34}, /* LATIN CAPITAL LETTER A WITH RING ABOVE */
+  {0xc7, 2, 36}, /* LATIN CAPITAL LETTER C WITH CEDILLA */
+  {0xc8, 2, 38}, /* LATIN CAPITAL LETTER E WITH GRAVE */
+  {0xc9, 2, 40}, /* LATIN CAPITAL LETTER E WITH ACUTE */
+  {0xca, 2, 42}, /* LATIN CAPITAL LETTER E WITH CIRCUMFLEX */
+  {0xcb, 2, 44}, /* LATIN CAPITAL LETTER E WITH DIAERESIS */
+  {0xcc, 2, 46}, /* LATIN CAPITAL LETTER I WITH GRAVE */
+  {0xcd, 2, 48}, /* LATIN CAPITAL LETTER I WITH ACUTE */
+  {0xce, 2, 50}, /* LATIN CAPITAL LETTER I WITH CIRCUMFLEX */
+  {0xcf, 2, 52}, /* LATIN CAPITAL LETTER I WITH DIAERESIS */
+  {0xd1, 2, 54}, /* LATIN CAPITAL LETTER N WITH TILDE */
+  {0xd2, 2, 56}, /* LATIN CAPITAL LETTER O WITH GRAVE */
+  {0xd3, 2, 58}, /* LATIN CAPITAL LETTER O WITH ACUTE */
+  {0xd4, 2, 60}, /* LATIN CAPITAL LETTER O WITH CIRCUMFLEX */
+  {0xd5, 2, 62}, /* LATIN CAPITAL LETTER O WITH TILDE */
+  {0xd6, 2, 64}, /* LATIN CAPITAL LETTER O WITH DIAERESIS */
+  {0xd9, 2, 66}, /* LATIN CAPITAL LETTER U WITH GRAVE */
+  {0xda, 2, 68}, /* LATIN CAPITAL LETTER U WITH ACUTE */
+  {0xdb, 2, 70}, /* LATIN CAPITAL LETTER U WITH CIRCUMFLEX */
+  {0xdc, 2, 72}, /* LATIN CAPITAL LETTER U WITH DIAERESIS */
+  {0xdd, 2, 74}, /* LATIN CAPITAL LETTER Y WITH ACUTE */
+  {0xe0, 2, 76}, /* LATIN SMALL LETTER A WITH GRAVE */
+  {0xe1, 2, 78}, /* LATIN SMALL LETTER A WITH ACUTE */
+  {0xe2, 2, 80}, /* LATIN SMALL LETTER A WITH CIRCUMFLEX */
+  {0xe3, 2, 82}, /* LATIN SMALL LETTER A WITH TILDE */
+  {0xe4, 2, 84}, /* LATIN SMALL LETTER A WITH DIAERESIS */
+  {0xe5, 2, 86}, /* LATIN SMALL LETTER A WITH RING ABOVE */
+  {0xe7, 2, 88}, /* LATIN SMALL LETTER C WITH CEDILLA */
+  {0xe8, 2, 90}, /* LATIN SMALL LETTER E WITH GRAVE */
+  {0xe9, 2, 92}, /* LATIN SMALL LETTER E WITH ACUTE */
+  {0xea, 2, 94}, /* LATIN SMALL LETTER E WITH CIRCUMFLEX */
+  {0xeb, 2, 96}, /* LATIN SMALL LETTER E WITH DIAERESIS */
+  {0xec, 2, 98}, /* LATIN SMALL LETTER I WITH GRAVE */
+  {0xed, 2, 100}, /* LATIN SMALL LETTER I WITH ACUTE */
+  {0xee, 2, 102}, /* LATIN SMALL LETTER I WITH CIRCUMFLEX */
+  {0xef, 2, 104}, /* LATIN SMALL LETTER I WITH DIAERESIS */
+  {0xf1, 2, 106}, /* LATIN SMALL LETTER N WITH TILDE */
+  {0xf2, 2, 108}, /* LATIN SMALL LETTER O WITH GRAVE */
+  {0xf3, 2, 110}, /* LATIN SMALL LETTER O WITH ACUTE */
+  {0xf4, 2, 112}, /* LATIN SMALL LETTER O WITH CIRCUMFLEX */
+  {0xf5, 2, 114}, /* LATIN SMALL LETTER O WITH TILDE */
+  {0xf6, 2, 116}, /* LATIN SMALL LETTER O WITH DIAERESIS */
+  {0xf9, 2, 118}, /* LATIN SMALL LETTER U WITH GRAVE */
+  {0xfa, 2, 120}, /* LATIN SMALL LETTER U WITH ACUTE */
+  {0xfb, 2, 122}, /* LATIN SMALL LETTER U WITH CIRCUMFLEX */
+  {0xfc, 2, 124}, /* LATIN SMALL LETTER U WITH DIAERESIS */
+  {0xfd, 2, 126}, /* LATIN SMALL LETTER Y WITH ACUTE */
+  {0xff, 2, 128}, /* LATIN SMALL LETTER Y WITH DIAERESIS */
+  {0x100, 2, 130}, /* LATIN CAPITAL LETTER A WITH MACRON */
+  {0x101, 2, 132}, /* LATIN SMALL LETTER A WITH MACRON */
+  {0x102, 2, 134}, /* LATIN CAPITAL LETTER A WITH BREVE */
+  {0x103, 2, 136}, /* LATIN SMALL LETTER A WITH BREVE */
+  {0x104, 2, 138}, /* LATIN CAPITAL LETTER A WITH OGONEK */
+  {0x105, 2, 140}, /* LATIN SMALL LETTER A WITH OGONEK */
+  {0x106, 2, 142}, /* LATIN CAPITAL LETTER C WITH ACUTE */
+  {0x107, 2, 144}, /* LATIN SMALL LETTER C WITH ACUTE */
+  {0x108, 2, 146}, /* LATIN CAPITAL LETTER C WITH CIRCUMFLEX */
+  {0x109, 2, 148}, /* LATIN SMALL LETTER C WITH CIRCUMFLEX */
+  {0x10a, 2, 150}, /* LATIN CAPITAL LETTER C WITH DOT ABOVE */
+  {0x10b, 2, 152}, /* LATIN SMALL LETTER C WITH DOT ABOVE */
+  {0x10c, 2, 154}, /* LATIN CAPITAL LETTER C WITH CARON */
+  {0x10d, 2, 156}, /* LATIN SMALL LETTER C WITH CARON */
+  {0x10e, 2, 158}, /* LATIN CAPITAL LETTER D WITH CARON */
+  {0x10f, 2, 160}, /* LATIN SMALL LETTER D WITH CARON */
+  {0x112, 2, 162}, /* LATIN CAPITAL LETTER E WITH MACRON */
+  {0x113, 2, 164}, /* LATIN SMALL LETTER E WITH MACRON */
+  {0x114, 2, 166}, /* LATIN CAPITAL LETTER E WITH BREVE */
+  {0x115, 2, 168}, /* LATIN SMALL LETTER E WITH BREVE */
+  {0x116, 2, 170}, /* LATIN CAPITAL LETTER E WITH DOT ABOVE */
+  {0x117, 2, 172}, /* LATIN SMALL LETTER E WITH DOT ABOVE */
+  {0x118, 2, 174}, /* LATIN CAPITAL LETTER E WITH OGONEK */
+  {0x119, 2, 176}, /* LATIN SMALL LETTER E WITH OGONEK */
+  {0x11a, 2, 178}, /* LATIN CAPITAL LETTER E WITH CARON */
+  {0x11b, 2, 180}, /* LATIN SMALL LETTER E WITH CARON */
+  {0x11c, 2, 182}, /* LATIN CAPITAL LETTER G WITH CIRCUMFLEX */
+  {0x11d, 2, 184}, /* LATIN SMALL LETTER G WITH CIRCUMFLEX */
+  {0x11e, 2, 186}, /* LATIN CAPITAL LETTER G WITH BREVE */
+  {0x11f, 2, 188}, /* LATIN SMALL LETTER G WITH BREVE */
+  {0x120, 2, 190}, /* LATIN CAPITAL LETTER G WITH DOT ABOVE */
+  {0x121, 2, 192}, /* LATIN SMALL LETTER G WITH DOT ABOVE */
+  {0x122, 2, 194}, /* LATIN CAPITAL LETTER G WITH CEDILLA */
+  {0x123, 2, 196}, /* LATIN SMALL LETTER G WITH CEDILLA */
+  {0x124, 2, 198}, /* LATIN CAPITAL LETTER H WITH CIRCUMFLEX */
+  {0x125, 2, 200}, /* LATIN SMALL LETTER H WITH CIRCUMFLEX */
+  {0x128, 2, 202}, /* LATIN CAPITAL LETTER I WITH TILDE */
+  {0x129, 2, 204}, /* LATIN SMALL LETTER I WITH TILDE */
+  {0x12a, 2, 206}, /* LATIN CAPITAL LETTER I WITH MACRON */
+  {0x12b, 2, 208}, /* LATIN SMALL LETTER I WITH MACRON */
+  {0x12c, 2, 210}, /* LATIN CAPITAL LETTER I WITH BREVE */
+  {0x12d, 2, 212}, /* LATIN SMALL LETTER I WITH BREVE */
+  {0x12e, 2, 214}, /* LATIN CAPITAL LETTER I WITH OGONEK */
+  {0x12f, 2, 216}, /* LATIN SMALL LETTER I WITH OGONEK */
+  {0x130, 2, 218}, /* LATIN CAPITAL LETTER I WITH DOT ABOVE */
+  {0x132, 2, 220}, /* LATIN CAPITAL LIGATURE IJ */
+  {0x133, 2, 222}, /* LATIN SMALL LIGATURE IJ */
+  {0x134, 2, 224}, /* LATIN CAPITAL LETTER J WITH CIRCUMFLEX */
+  {0x135, 2, 226}, /* LATIN SMALL LETTER J WITH CIRCUMFLEX */
+  {0x136, 2, 228}, /* LATIN CAPITAL LETTER K WITH CEDILLA */
+  {0x137, 2, 230}, /* LATIN SMALL LETTER K WITH CEDILLA */
+  {0x139, 2, 232}, /* LATIN CAPITAL LETTER L WITH ACUTE */
+  {0x13a, 2, 234}, /* LATIN SMALL LETTER L WITH ACUTE */
+  {0x13b, 2, 236}, /* LATIN CAPITAL LETTER L WITH CEDILLA */
+  {0x13c, 2, 238}, /* LATIN SMALL LETTER L WITH CEDILLA */
+  {0x13d, 2, 240}, /* LATIN CAPITAL LETTER L WITH CARON */
+  {0x13e, 2, 242}, /* LATIN SMALL LETTER L WITH CARON */
+  {0x13f, 2, 244}, /* LATIN CAPITAL LETTER L WITH MIDDLE DOT */
+  {0x140, 2, 246}, /* LATIN SMALL LETTER L WITH MIDDLE DOT */
+  {0x143, 2, 248}, /* LATIN CAPITAL LETTER N WITH ACUTE */
+  {0x144, 2, 250}, /* LATIN SMALL LETTER N WITH ACUTE */
+  {0x145, 2, 252}, /* LATIN CAPITAL LETTER N WITH CEDILLA */
+  {0x146, 2, 254}, /* LATIN SMALL LETTER N WITH CEDILLA */
+  {0x147, 2, 256}, /* LATIN CAPITAL LETTER N WITH CARON */
+  {0x148, 2, 258}, /* LATIN SMALL LETTER N WITH CARON */
+  {0x149, 2, 260}, /* LATIN SMALL LETTER N PRECEDED BY APOSTROPHE */
+  {0x14c, 2, 262}, /* LATIN CAPITAL LETTER O WITH MACRON */
+  {0x14d, 2, 264}, /* LATIN SMALL LETTER O WITH MACRON */
+  {0x14e, 2, 266}, /* LATIN CAPITAL LETTER O WITH BREVE */
+  {0x14f, 2, 268}, /* LATIN SMALL LETTER O WITH BREVE */
+  {0x150, 2, 270}, /* LATIN CAPITAL LETTER O WITH DOUBLE ACUTE */
+  {0x151, 2, 272}, /* LATIN SMALL LETTER O WITH DOUBLE ACUTE */
+  {0x154, 2, 274}, /* LATIN CAPITAL LETTER R WITH ACUTE */
+  {0x155, 2, 276}, /* LATIN SMALL LETTER R WITH ACUTE */
+  {0x156, 2, 278}, /* LATIN CAPITAL LETTER R WITH CEDILLA */
+  {0x157, 2, 280}, /* LATIN SMALL LETTER R WITH CEDILLA */
+  {0x158, 2, 282}, /* LATIN CAPITAL LETTER R WITH CARON */
+  {0x159, 2, 284}, /* LATIN SMALL LETTER R WITH CARON */
+  {0x15a, 2, 286}, /* LATIN CAPITAL LETTER S WITH ACUTE */
+  {0x15b, 2, 288}, /* LATIN SMALL LETTER S WITH ACUTE */
+  {0x15c, 2, 290}, /* LATIN CAPITAL LETTER S WITH CIRCUMFLEX */
+  {0x15d, 2, 292}, /* LATIN SMALL LETTER S WITH CIRCUMFLEX */
+  {0x15e, 2, 294}, /* LATIN CAPITAL LETTER S WITH CEDILLA */
+  {0x15f, 2, 296}, /* LATIN SMALL LETTER S WITH CEDILLA */
+  {0x160, 2, 298}, /* LATIN CAPITAL LETTER S WITH CARON */
+  {0x161, 2, 300}, /* LATIN SMALL LETTER S WITH CARON */
+  {0x162, 2, 302}, /* LATIN CAPITAL LETTER T WITH CEDILLA */
+  {0x163, 2, 304}, /* LATIN SMALL LETTER T WITH CEDILLA */
+  {0x164, 2, 306}, /* LATIN CAPITAL LETTER T WITH CARON */
+  {0x165, 2, 308}, /* LATIN SMALL LETTER T WITH CARON */
+  {0x168, 2, 310}, /* LATIN CAPITAL LETTER U WITH TILDE */
+  {0x169, 2, 312}, /* LATIN SMALL LETTER U WITH TILDE */
+  {0x16a, 2, 314}, /* LATIN CAPITAL LETTER U WITH MACRON */
+  {0x16b, 2, 316}, /* LATIN SMALL LETTER U WITH MACRON */
+  {0x16c, 2, 318}, /* LATIN CAPITAL LETTER U WITH BREVE */
+  {0x16d, 2, 320}, /* LATIN SMALL LETTER U WITH BREVE */
+  {0x16e, 2, 322}, /* LATIN CAPITAL LETTER U WITH RING ABOVE */
+  {0x16f, 2, 324}, /* LATIN SMALL LETTER U WITH RING ABOVE */
+  {0x170, 2, 326}, /* LATIN CAPITAL LETTER U WITH DOUBLE ACUTE */
+  {0x171, 2, 328}, /* LATIN SMALL LETTER U WITH DOUBLE ACUTE */
+  {0x172, 2, 330}, /* LATIN CAPITAL LETTER U WITH OGONEK */
+  {0x173, 2, 332}, /* LATIN SMALL LETTER U WITH OGONEK */
+  {0x174, 2, 334}, /* LATIN CAPITAL LETTER W WITH CIRCUMFLEX */
+  {0x175, 2, 336}, /* LATIN SMALL LETTER W WITH CIRCUMFLEX */
+  {0x176, 2, 338}, /* LATIN CAPITAL LETTER Y WITH CIRCUMFLEX */
+  {0x177, 2, 340}, /* LATIN SMALL LETTER Y WITH CIRCUMFLEX */
+  {0x178, 2, 342}, /* LATIN CAPITAL LETTER Y WITH DIAERESIS */
+  {0x179, 2, 344}, /* LATIN CAPITAL LETTER Z WITH ACUTE */
+  {0x17a, 2, 346}, /* LATIN SMALL LETTER Z WITH ACUTE */
+  {0x17b, 2, 348}, /* LATIN CAPITAL LETTER Z WITH DOT ABOVE */
+  {0x17c, 2, 350}, /* LATIN SMALL LETTER Z WITH DOT ABOVE */
+  {0x17d, 2, 352}, /* LATIN CAPITAL LETTER Z WITH CARON */
+  {0x17e, 2, 354}, /* LATIN SMALL LETTER Z WITH CARON */
+  {0x17f, 1, 288}, /* LATIN SMALL LETTER LONG S */
+  {0x1a0, 2, 356}, /* LATIN CAPITAL LETTER O WITH HORN */
+  {0x1a1, 2, 358}, /* LATIN SMALL LETTER O WITH HORN */
+  {0x1af, 2, 360}, /* LATIN CAPITAL LETTER U WITH HORN */
+  {0x1b0, 2, 362}, /* LATIN SMALL LETTER U WITH HORN */
+  {0x1c4, 2, 364}, /* LATIN CAPITAL LETTER DZ WITH CARON */
+  {0x1c5, 2, 366}, /* LATIN CAPITAL LETTER D WITH SMALL LETTER Z WITH CARON */
+  {0x1c6, 2, 368}, /* LATIN SMALL LETTER DZ WITH CARON */
+  {0x1c7, 2, 370}, /* LATIN CAPITAL LETTER LJ */
+  {0x1c8, 2, 372}, /* LATIN CAPITAL LETTER L WITH SMALL LETTER J */
+  {0x1c9, 2, 374}, /* LATIN SMALL LETTER LJ */
+  {0x1ca, 2, 376}, /* LATIN CAPITAL LETTER NJ */
+  {0x1cb, 2, 378}, /* LATIN CAPITAL LETTER N WITH SMALL LETTER J */
+  {0x1cc, 2, 380}, /* LATIN SMALL LETTER NJ */
+  {0x1cd, 2, 382}, /* LATIN CAPITAL LETTER A WITH CARON */
+  {0x1ce, 2, 384}, /* LATIN SMALL LETTER A WITH CARON */
+  {0x1cf, 2, 386}, /* LATIN CAPITAL LETTER I WITH CARON */
+  {0x1d0, 2, 388}, /* LATIN SMALL LETTER I WITH CARON */
+  {0x1d1, 2, 390}, /* LATIN CAPITAL LETTER O WITH CARON */
+  {0x1d2, 2, 392}, /* LATIN SMALL LETTER O WITH CARON */
+  {0x1d3, 2, 394}, /* LATIN CAPITAL LETTER U WITH CARON */
+  {0x1d4, 2, 396}, /* LATIN SMALL LETTER U WITH CARON */
+  {0x1d5, 2, 398}, /* LATIN CAPITAL LETTER U WITH DIAERESIS AND MACRON */
+  {0x1d6, 2, 400}, /* LATIN SMALL LETTER U WITH DIAERESIS AND MACRON */
+  {0x1d7, 2, 402}, /* LATIN CAPITAL LETTER U WITH DIAERESIS AND ACUTE */
+  {0x1d8, 2, 404}, /* LATIN SMALL LETTER U WITH DIAERESIS AND ACUTE */
+  {0x1d9, 2, 406}, /* LATIN CAPITAL LETTER U WITH DIAERESIS AND CARON */
+  {0x1da, 2, 408}, /* LATIN SMALL LETTER U WITH DIAERESIS AND CARON */
+  {0x1db, 2, 410}, /* LATIN CAPITAL LETTER U WITH DIAERESIS AND GRAVE */
+  {0x1dc, 2, 412}, /* LATIN SMALL LETTER U WITH DIAERESIS AND GRAVE */
+  {0x1de, 2, 414}, /* LATIN CAPITAL LETTER A WITH DIAERESIS AND MACRON */
+  {0x1df, 2, 416}, /* LATIN SMALL LETTER A WITH DIAERESIS AND MACRON */
+  {0x1e0, 2, 418}, /* LATIN CAPITAL LETTER A WITH DOT ABOVE AND MACRON */
+  {0x1e1, 2, 420}, /* LATIN SMALL LETTER A WITH DOT ABOVE AND MACRON */
+  {0x1e2, 2, 422}, /* LATIN CAPITAL LETTER AE WITH MACRON */
+  {0x1e3, 2, 424}, /* LATIN SMALL LETTER AE WITH MACRON */
+  {0x1e6, 2, 426}, /* LATIN CAPITAL LETTER G WITH CARON */
+  {0x1e7, 2, 428}, /* LATIN SMALL LETTER G WITH CARON */
+  {0x1e8, 2, 430}, /* LATIN CAPITAL LETTER K WITH CARON */
+  {0x1e9, 2, 432}, /* LATIN SMALL LETTER K WITH CARON */
+  {0x1ea, 2, 434}, /* LATIN CAPITAL LETTER O WITH OGONEK */
+  {0x1eb, 2, 436}, /* LATIN SMALL LETTER O WITH OGONEK */
+  {0x1ec, 2, 438}, /* LATIN CAPITAL LETTER O WITH OGONEK AND MACRON */
+  {0x1ed, 2, 440}, /* LATIN SMALL LETTER O WITH OGONEK AND MACRON */
+  {0x1ee, 2, 442}, /* LATIN CAPITAL LETTER EZH WITH CARON */
+  {0x1ef, 2, 444}, /* LATIN SMALL LETTER EZH WITH CARON */
+  {0x1f0, 2, 446}, /* LATIN SMALL LETTER J WITH CARON */
+  {0x1f1, 2, 448}, /* LATIN CAPITAL LETTER DZ */
+  {0x1f2, 2, 450}, /* LATIN CAPITAL LETTER D WITH SMALL LETTER Z */
+  {0x1f3, 2, 452}, /* LATIN SMALL LETTER DZ */
+  {0x1f4, 2, 454}, /* LATIN CAPITAL LETTER G WITH ACUTE */
+  {0x1f5, 2, 456}, /* LATIN SMALL LETTER G WITH ACUTE */
+  {0x1f8, 2, 458}, /* LATIN CAPITAL LETTER N WITH GRAVE */
+  {0x1f9, 2, 460}, /* LATIN SMALL LETTER N WITH GRAVE */
+  {0x1fa, 2, 462}, /* LATIN CAPITAL LETTER A WITH RING ABOVE AND ACUTE */
+  {0x1fb, 2, 464}, /* LATIN SMALL LETTER A WITH RING ABOVE AND ACUTE */
+  {0x1fc, 2, 466}, /* LATIN CAPITAL LETTER AE WITH ACUTE */
+  {0x1fd, 2, 468}, /* LATIN SMALL LETTER AE WITH ACUTE */
+  {0x1fe, 2, 470}, /* LATIN CAPITAL LETTER O WITH STROKE AND ACUTE */
+  {0x1ff, 2, 472}, /* LATIN SMALL LETTER O WITH STROKE AND ACUTE */
+  {0x200, 2, 474}, /* LATIN CAPITAL LETTER A WITH DOUBLE GRAVE */
+  {0x201, 2, 476}, /* LATIN SMALL LETTER A WITH DOUBLE GRAVE */
+  {0x202, 2, 478}, /* LATIN CAPITAL LETTER A WITH INVERTED BREVE */
+  {0x203, 2, 480}, /* LATIN SMALL LETTER A WITH INVERTED BREVE */
+  {0x204, 2, 482}, /* LATIN CAPITAL LETTER E WITH DOUBLE GRAVE */
+  {0x205, 2, 484}, /* LATIN SMALL LETTER E WITH DOUBLE GRAVE */
+  {0x206, 2, 486}, /* LATIN CAPITAL LETTER E WITH INVERTED BREVE */
+  {0x207, 2, 488}, /* LATIN SMALL LETTER E WITH INVERTED BREVE */
+  {0x208, 2, 490}, /* LATIN CAPITAL LETTER I WITH DOUBLE GRAVE */
+  {0x209, 2, 492}, /* LATIN SMALL LETTER I WITH DOUBLE GRAVE */
+  {0x20a, 2, 494}, /* LATIN CAPITAL LETTER I WITH INVERTED BREVE */
+  {0x20b, 2, 496}, /* LATIN SMALL LETTER I WITH INVERTED BREVE */
+  {0x20c, 2, 498}, /* LATIN CAPITAL LETTER O WITH DOUBLE GRAVE */
+  {0x20d, 2, 500}, /* LATIN SMALL LETTER O WITH DOUBLE GRAVE */
+  {0x20e, 2, 502}, /* LATIN CAPITAL LETTER O WITH INVERTED BREVE */
+  {0x20f, 2, 504}, /* LATIN SMALL LETTER O WITH INVERTED BREVE */
+  {0x210, 2, 506}, /* LATIN CAPITAL LETTER R WITH DOUBLE GRAVE */
+  {0x211, 2, 508}, /* LATIN SMALL LETTER R WITH DOUBLE GRAVE */
+  {0x212, 2, 510}, /* LATIN CAPITAL LETTER R WITH INVERTED BREVE */
+  {0x213, 2, 512}, /* LATIN SMALL LETTER R WITH INVERTED BREVE */
+  {0x214, 2, 514}, /* LATIN CAPITAL LETTER U WITH DOUBLE GRAVE */
+  {0x215, 2, 516}, /* LATIN SMALL LETTER U WITH DOUBLE GRAVE */
+  {0x216, 2, 518}, /* LATIN CAPITAL LETTER U WITH INVERTED BREVE */
+  {0x217, 2, 520}, /* LATIN SMALL LETTER U WITH INVERTED BREVE */
+  {0x218, 2, 522}, /* LATIN CAPITAL LETTER S WITH COMMA BELOW */
+  {0x219, 2, 524}, /* LATIN SMALL LETTER S WITH COMMA BELOW */
+  {0x21a, 2, 526}, /* LATIN CAPITAL LETTER T WITH COMMA BELOW */
+  {0x21b, 2, 528}, /* LATIN SMALL LETTER T WITH COMMA BELOW */
+  {0x21e, 2, 530}, /* LATIN CAPITAL LETTER H WITH CARON */
+  {0x21f, 2, 532}, /* LATIN SMALL LETTER H WITH CARON */
+  {0x226, 2, 534}, /* LATIN CAPITAL LETTER A WITH DOT ABOVE */
+  {0x227, 2, 536}, /* LATIN SMALL LETTER A WITH DOT ABOVE */
+  {0x228, 2, 538}, /* LATIN CAPITAL LETTER E WITH CEDILLA */
+  {0x229, 2, 540}, /* LATIN SMALL LETTER E WITH CEDILLA */
+  {0x22a, 2, 542}, /* LATIN CAPITAL LETTER O WITH DIAERESIS AND MACRON */
+  {0x22b, 2, 544}, /* LATIN SMALL LETTER O WITH DIAERESIS AND MACRON */
+  {0x22c, 2, 546}, /* LATIN CAPITAL LETTER O WITH TILDE AND MACRON */
+  {0x22d, 2, 548}, /* LATIN SMALL LETTER O WITH TILDE AND MACRON */
+  {0x22e, 2, 550}, /* LATIN CAPITAL LETTER O WITH DOT ABOVE */
+  {0x22f, 2, 552}, /* LATIN SMALL LETTER O WITH DOT ABOVE */
+  {0x230, 2, 554}, /* LATIN CAPITAL LETTER O WITH DOT ABOVE AND MACRON */
+  {0x231, 2, 556}, /* LATIN SMALL LETTER O WITH DOT ABOVE AND MACRON */
+  {0x232, 2, 558}, /* LATIN CAPITAL LETTER Y WITH MACRON */
+  {0x233, 2, 560}, /* LATIN SMALL LETTER Y WITH MACRON */
+  {0x2b0, 1, 200}, /* MODIFIER LETTER SMALL H */
+  {0x2b1, 1, 562}, /* MODIFIER LETTER SMALL H WITH HOOK */
+  {0x2b2, 1, 223}, /* MODIFIER LETTER SMALL J */
+  {0x2b3, 1, 276}, /* MODIFIER LETTER SMALL R */
+  {0x2b4, 1, 563}, /* MODIFIER LETTER SMALL TURNED R */
+  {0x2b5, 1, 564}, /* MODIFIER LETTER SMALL TURNED R WITH HOOK */
+  {0x2b6, 1, 565}, /* MODIFIER LETTER SMALL CAPITAL INVERTED R */
+  {0x2b7, 1, 336}, /* MODIFIER LETTER SMALL W */
+  {0x2b8, 1, 126}, /* MODIFIER LETTER SMALL Y */
+  {0x2d8, 2, 566}, /* BREVE */
+  {0x2d9, 2, 568}, /* DOT ABOVE */
+  {0x2da, 2, 570}, /* RING ABOVE */
+  {0x2db, 2, 572}, /* OGONEK */
+  {0x2dc, 2, 574}, /* SMALL TILDE */
+  {0x2dd, 2, 576}, /* DOUBLE ACUTE ACCENT */
+  {0x2e0, 1, 578}, /* MODIFIER LETTER SMALL GAMMA */
+  {0x2e1, 1, 234}, /* MODIFIER LETTER SMALL L */
+  {0x2e2, 1, 288}, /* MODIFIER LETTER SMALL S */
+  {0x2e3, 1, 579}, /* MODIFIER LETTER SMALL X */
+  {0x2e4, 1, 580}, /* MODIFIER LETTER SMALL REVERSED GLOTTAL STOP */
+  {0x340, 1, 25}, /* COMBINING GRAVE TONE MARK */
+  {0x341, 1, 9}, /* COMBINING ACUTE TONE MARK */
+  {0x343, 1, 581}, /* COMBINING GREEK KORONIS */
+  {0x344, 2, 582}, /* COMBINING GREEK DIALYTIKA TONOS */
+  {0x374, 1, 584}, /* GREEK NUMERAL SIGN */
+  {0x37a, 2, 585}, /* GREEK YPOGEGRAMMENI */
+  {0x37e, 1, 587}, /* GREEK QUESTION MARK */
+  {0x384, 2, 8}, /* GREEK TONOS */
+  {0x385, 2, 588}, /* GREEK DIALYTIKA TONOS */
+  {0x386, 2, 590}, /* GREEK CAPITAL LETTER ALPHA WITH TONOS */
+  {0x387, 1, 245}, /* GREEK ANO TELEIA */
+  {0x388, 2, 592}, /* GREEK CAPITAL LETTER EPSILON WITH TONOS */
+  {0x389, 2, 594}, /* GREEK CAPITAL LETTER ETA WITH TONOS */
+  {0x38a, 2, 596}, /* GREEK CAPITAL LETTER IOTA WITH TONOS */
+  {0x38c, 2, 598}, /* GREEK CAPITAL LETTER OMICRON WITH TONOS */
+  {0x38e, 2, 600}, /* GREEK CAPITAL LETTER UPSILON WITH TONOS */
+  {0x38f, 2, 602}, /* GREEK CAPITAL LETTER OMEGA WITH TONOS */
+  {0x390, 2, 604}, /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS */
+  {0x3aa, 2, 606}, /* GREEK CAPITAL LETTER IOTA WITH DIALYTIKA */
+  {0x3ab, 2, 608}, /* GREEK CAPITAL LETTER UPSILON WITH DIALYTIKA */
+  {0x3ac, 2, 610}, /* GREEK SMALL LETTER ALPHA WITH TONOS */
+  {0x3ad, 2, 612}, /* GREEK SMALL LETTER EPSILON WITH TONOS */
+  {0x3ae, 2, 614}, /* GREEK SMALL LETTER ETA WITH TONOS */
+  {0x3af, 2, 616}, /* GREEK SMALL LETTER IOTA WITH TONOS */
+  {0x3b0, 2, 618}, /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS */
+  {0x3ca, 2, 620}, /* GREEK SMALL LETTER IOTA WITH DIALYTIKA */
+  {0x3cb, 2, 622}, /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA */
+  {0x3cc, 2, 624}, /* GREEK SMALL LETTER OMICRON WITH TONOS */
+  {0x3cd, 2, 626}, /* GREEK SMALL LETTER UPSILON WITH TONOS */
+  {0x3ce, 2, 628}, /* GREEK SMALL LETTER OMEGA WITH TONOS */
+  {0x3d0, 1, 630}, /* GREEK BETA SYMBOL */
+  {0x3d1, 1, 631}, /* GREEK THETA SYMBOL */
+  {0x3d2, 1, 600}, /* GREEK UPSILON WITH HOOK SYMBOL */
+  {0x3d3, 2, 632}, /* GREEK UPSILON WITH ACUTE AND HOOK SYMBOL */
+  {0x3d4, 2, 634}, /* GREEK UPSILON WITH DIAERESIS AND HOOK SYMBOL */
+  {0x3d5, 1, 636}, /* GREEK PHI SYMBOL */
+  {0x3d6, 1, 637}, /* GREEK PI SYMBOL */
+  {0x3f0, 1, 638}, /* GREEK KAPPA SYMBOL */
+  {0x3f1, 1, 639}, /* GREEK RHO SYMBOL */
+  {0x3f2, 1, 640}, /* GREEK LUNATE SIGMA SYMBOL */
+  {0x3f4, 1, 641}, /* GREEK CAPITAL THETA SYMBOL */
+  {0x3f5, 1, 612}, /* GREEK LUNATE EPSILON SYMBOL */
+  {0x3f9, 1, 642}, /* GREEK CAPITAL LUNATE SIGMA SYMBOL */
+  {0x400, 2, 643}, /* CYRILLIC CAPITAL LETTER IE WITH GRAVE */
+  {0x401, 2, 645}, /* CYRILLIC CAPITAL LETTER IO */
+  {0x403, 2, 647}, /* CYRILLIC CAPITAL LETTER GJE */
+  {0x407, 2, 649}, /* CYRILLIC CAPITAL LETTER YI */
+  {0x40c, 2, 651}, /* CYRILLIC CAPITAL LETTER KJE */
+  {0x40d, 2, 653}, /* CYRILLIC CAPITAL LETTER I WITH GRAVE */
+  {0x40e, 2, 655}, /* CYRILLIC CAPITAL LETTER SHORT U */
+  {0x419, 2, 657}, /* CYRILLIC CAPITAL LETTER SHORT I */
+  {0x439, 2, 659}, /* CYRILLIC SMALL LETTER SHORT I */
+  {0x450, 2, 661}, /* CYRILLIC SMALL LETTER IE WITH GRAVE */
+  {0x451, 2, 663}, /* CYRILLIC SMALL LETTER IO */
+  {0x453, 2, 665}, /* CYRILLIC SMALL LETTER GJE */
+  {0x457, 2, 667}, /* CYRILLIC SMALL LETTER YI */
+  {0x45c, 2, 669}, /* CYRILLIC SMALL LETTER KJE */
+  {0x45d, 2, 671}, /* CYRILLIC SMALL LETTER I WITH GRAVE */
+  {0x45e, 2, 673}, /* CYRILLIC SMALL LETTER SHORT U */
+  {0x476, 2, 675}, /* CYRILLIC CAPITAL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT */
+  {0x477, 2, 677}, /* CYRILLIC SMALL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT */
+  {0x4c1, 2, 679}, /* CYRILLIC CAPITAL LETTER ZHE WITH BREVE */
+  {0x4c2, 2, 681}, /* CYRILLIC SMALL LETTER ZHE WITH BREVE */
+  {0x4d0, 2, 683}, /* CYRILLIC CAPITAL LETTER A WITH BREVE */
+  {0x4d1, 2, 685}, /* CYRILLIC SMALL LETTER A WITH BREVE */
+  {0x4d2, 2, 687}, /* CYRILLIC CAPITAL LETTER A WITH DIAERESIS */
+  {0x4d3, 2, 689}, /* CYRILLIC SMALL LETTER A WITH DIAERESIS */
+  {0x4d6, 2, 691}, /* CYRILLIC CAPITAL LETTER IE WITH BREVE */
+  {0x4d7, 2, 693}, /* CYRILLIC SMALL LETTER IE WITH BREVE */
+  {0x4da, 2, 695}, /* CYRILLIC CAPITAL LETTER SCHWA WITH DIAERESIS */
+  {0x4db, 2, 697}, /* CYRILLIC SMALL LETTER SCHWA WITH DIAERESIS */
+  {0x4dc, 2, 699}, /* CYRILLIC CAPITAL LETTER ZHE WITH DIAERESIS */
+  {0x4dd, 2, 701}, /* CYRILLIC SMALL LETTER ZHE WITH DIAERESIS */
+  {0x4de, 2, 703}, /* CYRILLIC CAPITAL LETTER ZE WITH DIAERESIS */
+  {0x4df, 2, 705}, /* CYRILLIC SMALL LETTER ZE WITH DIAERESIS */
+  {0x4e2, 2, 707}, /* CYRILLIC CAPITAL LETTER I WITH MACRON */
+  {0x4e3, 2, 709}, /* CYRILLIC SMALL LETTER I WITH MACRON */
+  {0x4e4, 2, 711}, /* CYRILLIC CAPITAL LETTER I WITH DIAERESIS */
+  {0x4e5, 2, 713}, /* CYRILLIC SMALL LETTER I WITH DIAERESIS */
+  {0x4e6, 2, 715}, /* CYRILLIC CAPITAL LETTER O WITH DIAERESIS */
+  {0x4e7, 2, 717}, /* CYRILLIC SMALL LETTER O WITH DIAERESIS */
+  {0x4ea, 2, 719}, /* CYRILLIC CAPITAL LETTER BARRED O WITH DIAERESIS */
+  {0x4eb, 2, 721}, /* CYRILLIC SMALL LETTER BARRED O WITH DIAERESIS */
+  {0x4ec, 2, 723}, /* CYRILLIC CAPITAL LETTER E WITH DIAERESIS */
+  {0x4ed, 2, 725}, /* CYRILLIC SMALL LETTER E WITH DIAERESIS */
+  {0x4ee, 2, 727}, /* CYRILLIC CAPITAL LETTER U WITH MACRON */
+  {0x4ef, 2, 729}, /* CYRILLIC SMALL LETTER U WITH MACRON */
+  {0x4f0, 2, 731}, /* CYRILLIC CAPITAL LETTER U WITH DIAERESIS */
+  {0x4f1, 2, 733}, /* CYRILLIC SMALL LETTER U WITH DIAERESIS */
+  {0x4f2, 2, 735}, /* CYRILLIC CAPITAL LETTER U WITH DOUBLE ACUTE */
+  {0x4f3, 2, 737}, /* CYRILLIC SMALL LETTER U WITH DOUBLE ACUTE */
+  {0x4f4, 2, 739}, /* CYRILLIC CAPITAL LETTER CHE WITH DIAERESIS */
+  {0x4f5, 2, 741}, /* CYRILLIC SMALL LETTER CHE WITH DIAERESIS */
+  {0x4f8, 2, 743}, /* CYRILLIC CAPITAL LETTER YERU WITH DIAERESIS */
+  {0x4f9, 2, 745}, /* CYRILLIC SMALL LETTER YERU WITH DIAERESIS */
+  {0x587, 2, 747}, /* ARMENIAN SMALL LIGATURE ECH YIWN */
+  {0x622, 2, 749}, /* ARABIC LETTER ALEF WITH MADDA ABOVE */
+  {0x623, 2, 751}, /* ARABIC LETTER ALEF WITH HAMZA ABOVE */
+  {0x624, 2, 753}, /* ARABIC LETTER WAW WITH HAMZA ABOVE */
+  {0x625, 2, 755}, /* ARABIC LETTER ALEF WITH HAMZA BELOW */
+  {0x626, 2, 757}, /* ARABIC LETTER YEH WITH HAMZA ABOVE */
+  {0x675, 2, 759}, /* ARABIC LETTER HIGH HAMZA ALEF */
+  {0x676, 2, 761}, /* ARABIC LETTER HIGH HAMZA WAW */
+  {0x677, 2, 763}, /* ARABIC LETTER U WITH HAMZA ABOVE */
+  {0x678, 2, 765}, /* ARABIC LETTER HIGH HAMZA YEH */
+  {0x6c0, 2, 767}, /* ARABIC LETTER HEH WITH YEH ABOVE */
+  {0x6c2, 2, 769}, /* ARABIC LETTER HEH GOAL WITH HAMZA ABOVE */
+  {0x6d3, 2, 771}, /* ARABIC LETTER YEH BARREE WITH HAMZA ABOVE */
+  {0x929, 2, 773}, /* DEVANAGARI LETTER NNNA */
+  {0x931, 2, 775}, /* DEVANAGARI LETTER RRA */
+  {0x934, 2, 777}, /* DEVANAGARI LETTER LLLA */
+  {0x958, 2, 779}, /* DEVANAGARI LETTER QA */
+  {0x959, 2, 781}, /* DEVANAGARI LETTER KHHA */
+  {0x95a, 2, 783}, /* DEVANAGARI LETTER GHHA */
+  {0x95b, 2, 785}, /* DEVANAGARI LETTER ZA */
+  {0x95c, 2, 787}, /* DEVANAGARI LETTER DDDHA */
+  {0x95d, 2, 789}, /* DEVANAGARI LETTER RHA */
+  {0x95e, 2, 791}, /* DEVANAGARI LETTER FA */
+  {0x95f, 2, 793}, /* DEVANAGARI LETTER YYA */
+  {0x9cb, 2, 795}, /* BENGALI VOWEL SIGN O */
+  {0x9cc, 2, 797}, /* BENGALI VOWEL SIGN AU */
+  {0x9dc, 2, 799}, /* BENGALI LETTER RRA */
+  {0x9dd, 2, 801}, /* BENGALI LETTER RHA */
+  {0x9df, 2, 803}, /* BENGALI LETTER YYA */
+  {0xa33, 2, 805}, /* GURMUKHI LETTER LLA */
+  {0xa36, 2, 807}, /* GURMUKHI LETTER SHA */
+  {0xa59, 2, 809}, /* GURMUKHI LETTER KHHA */
+  {0xa5a, 2, 811}, /* GURMUKHI LETTER GHHA */
+  {0xa5b, 2, 813}, /* GURMUKHI LETTER ZA */
+  {0xa5e, 2, 815}, /* GURMUKHI LETTER FA */
+  {0xb48, 2, 817}, /* ORIYA VOWEL SIGN AI */
+  {0xb4b, 2, 819}, /* ORIYA VOWEL SIGN O */
+  {0xb4c, 2, 821}, /* ORIYA VOWEL SIGN AU */
+  {0xb5c, 2, 823}, /* ORIYA LETTER RRA */
+  {0xb5d, 2, 825}, /* ORIYA LETTER RHA */
+  {0xb94, 2, 827}, /* TAMIL LETTER AU */
+  {0xbca, 2, 829}, /* TAMIL VOWEL SIGN O */
+  {0xbcb, 2, 831}, /* TAMIL VOWEL SIGN OO */
+  {0xbcc, 2, 833}, /* TAMIL VOWEL SIGN AU */
+  {0xc48, 2, 835}, /* TELUGU VOWEL SIGN AI */
+  {0xcc0, 2, 837}, /* KANNADA VOWEL SIGN II */
+  {0xcc7, 2, 839}, /* KANNADA VOWEL SIGN EE */
+  {0xcc8, 2, 841}, /* KANNADA VOWEL SIGN AI */
+  {0xcca, 2, 843}, /* KANNADA VOWEL SIGN O */
+  {0xccb, 2, 845}, /* KANNADA VOWEL SIGN OO */
+  {0xd4a, 2, 847}, /* MALAYALAM VOWEL SIGN O */
+  {0xd4b, 2, 849}, /* MALAYALAM VOWEL SIGN OO */
+  {0xd4c, 2, 851}, /* MALAYALAM VOWEL SIGN AU */
+  {0xdda, 2, 853}, /* SINHALA VOWEL SIGN DIGA KOMBUVA */
+  {0xddc, 2, 855}, /* SINHALA VOWEL SIGN KOMBUVA HAA AELA-PILLA */
+  {0xddd, 2, 857}, /* SINHALA VOWEL SIGN KOMBUVA HAA DIGA AELA-PILLA */
+  {0xdde, 2, 859}, /* SINHALA VOWEL SIGN KOMBUVA HAA GAYANUKITTA */
+  {0xe33, 2, 861}, /* THAI CHARACTER SARA AM */
+  {0xeb3, 2, 863}, /* LAO VOWEL SIGN AM */
+  {0xedc, 2, 865}, /* LAO HO NO */
+  {0xedd, 2, 867}, /* LAO HO MO */
+  {0xf0c, 1, 869}, /* TIBETAN MARK DELIMITER TSHEG BSTAR */
+  {0xf43, 2, 870}, /* TIBETAN LETTER GHA */
+  {0xf4d, 2, 872}, /* TIBETAN LETTER DDHA */
+  {0xf52, 2, 874}, /* TIBETAN LETTER DHA */
+  {0xf57, 2, 876}, /* TIBETAN LETTER BHA */
+  {0xf5c, 2, 878}, /* TIBETAN LETTER DZHA */
+  {0xf69, 2, 880}, /* TIBETAN LETTER KSSA */
+  {0xf73, 2, 882}, /* TIBETAN VOWEL SIGN II */
+  {0xf75, 2, 884}, /* TIBETAN VOWEL SIGN UU */
+  {0xf76, 2, 886}, /* TIBETAN VOWEL SIGN VOCALIC R */
+  {0xf77, 2, 888}, /* TIBETAN VOWEL SIGN VOCALIC RR */
+  {0xf78, 2, 890}, /* TIBETAN VOWEL SIGN VOCALIC L */
+  {0xf79, 2, 892}, /* TIBETAN VOWEL SIGN VOCALIC LL */
+  {0xf81, 2, 894}, /* TIBETAN VOWEL SIGN REVERSED II */
+  {0xf93, 2, 896}, /* TIBETAN SUBJOINED LETTER GHA */
+  {0xf9d, 2, 898}, /* TIBETAN SUBJOINED LETTER DDHA */
+  {0xfa2, 2, 900}, /* TIBETAN SUBJOINED LETTER DHA */
+  {0xfa7, 2, 902}, /* TIBETAN SUBJOINED LETTER BHA */
+  {0xfac, 2, 904}, /* TIBETAN SUBJOINED LETTER DZHA */
+  {0xfb9, 2, 906}, /* TIBETAN SUBJOINED LETTER KSSA */
+  {0x1026, 2, 908}, /* MYANMAR LETTER UU */
+  {0x1d2c, 1, 24}, /* MODIFIER LETTER CAPITAL A */
+  {0x1d2d, 1, 422}, /* MODIFIER LETTER CAPITAL AE */
+  {0x1d2e, 1, 910}, /* MODIFIER LETTER CAPITAL B */
+  {0x1d30, 1, 158}, /* MODIFIER LETTER CAPITAL D */
+  {0x1d31, 1, 38}, /* MODIFIER LETTER CAPITAL E */
+  {0x1d32, 1, 911}, /* MODIFIER LETTER CAPITAL REVERSED E */
+  {0x1d33, 1, 182}, /* MODIFIER LETTER CAPITAL G */
+  {0x1d34, 1, 198}, /* MODIFIER LETTER CAPITAL H */
+  {0x1d35, 1, 46}, /* MODIFIER LETTER CAPITAL I */
+  {0x1d36, 1, 221}, /* MODIFIER LETTER CAPITAL J */
+  {0x1d37, 1, 228}, /* MODIFIER LETTER CAPITAL K */
+  {0x1d38, 1, 232}, /* MODIFIER LETTER CAPITAL L */
+  {0x1d39, 1, 912}, /* MODIFIER LETTER CAPITAL M */
+  {0x1d3a, 1, 54}, /* MODIFIER LETTER CAPITAL N */
+  {0x1d3c, 1, 56}, /* MODIFIER LETTER CAPITAL O */
+  {0x1d3d, 1, 913}, /* MODIFIER LETTER CAPITAL OU */
+  {0x1d3e, 1, 914}, /* MODIFIER LETTER CAPITAL P */
+  {0x1d3f, 1, 274}, /* MODIFIER LETTER CAPITAL R */
+  {0x1d40, 1, 302}, /* MODIFIER LETTER CAPITAL T */
+  {0x1d41, 1, 66}, /* MODIFIER LETTER CAPITAL U */
+  {0x1d42, 1, 334}, /* MODIFIER LETTER CAPITAL W */
+  {0x1d43, 1, 3}, /* MODIFIER LETTER SMALL A */
+  {0x1d44, 1, 915}, /* MODIFIER LETTER SMALL TURNED A */
+  {0x1d45, 1, 916}, /* MODIFIER LETTER SMALL ALPHA */
+  {0x1d46, 1, 917}, /* MODIFIER LETTER SMALL TURNED AE */
+  {0x1d47, 1, 918}, /* MODIFIER LETTER SMALL B */
+  {0x1d48, 1, 160}, /* MODIFIER LETTER SMALL D */
+  {0x1d49, 1, 90}, /* MODIFIER LETTER SMALL E */
+  {0x1d4a, 1, 919}, /* MODIFIER LETTER SMALL SCHWA */
+  {0x1d4b, 1, 920}, /* MODIFIER LETTER SMALL OPEN E */
+  {0x1d4c, 1, 921}, /* MODIFIER LETTER SMALL TURNED OPEN E */
+  {0x1d4d, 1, 184}, /* MODIFIER LETTER SMALL G */
+  {0x1d4f, 1, 230}, /* MODIFIER LETTER SMALL K */
+  {0x1d50, 1, 922}, /* MODIFIER LETTER SMALL M */
+  {0x1d51, 1, 923}, /* MODIFIER LETTER SMALL ENG */
+  {0x1d52, 1, 14}, /* MODIFIER LETTER SMALL O */
+  {0x1d53, 1, 924}, /* MODIFIER LETTER SMALL OPEN O */
+  {0x1d54, 1, 925}, /* MODIFIER LETTER SMALL TOP HALF O */
+  {0x1d55, 1, 926}, /* MODIFIER LETTER SMALL BOTTOM HALF O */
+  {0x1d56, 1, 927}, /* MODIFIER LETTER SMALL P */
+  {0x1d57, 1, 304}, /* MODIFIER LETTER SMALL T */
+  {0x1d58, 1, 118}, /* MODIFIER LETTER SMALL U */
+  {0x1d59, 1, 928}, /* MODIFIER LETTER SMALL SIDEWAYS U */
+  {0x1d5a, 1, 929}, /* MODIFIER LETTER SMALL TURNED M */
+  {0x1d5b, 1, 930}, /* MODIFIER LETTER SMALL V */
+  {0x1d5c, 1, 931}, /* MODIFIER LETTER SMALL AIN */
+  {0x1d5d, 1, 630}, /* MODIFIER LETTER SMALL BETA */
+  {0x1d5e, 1, 932}, /* MODIFIER LETTER SMALL GREEK GAMMA */
+  {0x1d5f, 1, 933}, /* MODIFIER LETTER SMALL DELTA */
+  {0x1d60, 1, 636}, /* MODIFIER LETTER SMALL GREEK PHI */
+  {0x1d61, 1, 934}, /* MODIFIER LETTER SMALL CHI */
+  {0x1d62, 1, 98}, /* LATIN SUBSCRIPT SMALL LETTER I */
+  {0x1d63, 1, 276}, /* LATIN SUBSCRIPT SMALL LETTER R */
+  {0x1d64, 1, 118}, /* LATIN SUBSCRIPT SMALL LETTER U */
+  {0x1d65, 1, 930}, /* LATIN SUBSCRIPT SMALL LETTER V */
+  {0x1d66, 1, 630}, /* GREEK SUBSCRIPT SMALL LETTER BETA */
+  {0x1d67, 1, 932}, /* GREEK SUBSCRIPT SMALL LETTER GAMMA */
+  {0x1d68, 1, 639}, /* GREEK SUBSCRIPT SMALL LETTER RHO */
+  {0x1d69, 1, 636}, /* GREEK SUBSCRIPT SMALL LETTER PHI */
+  {0x1d6a, 1, 934}, /* GREEK SUBSCRIPT SMALL LETTER CHI */
+  {0x1e00, 2, 935}, /* LATIN CAPITAL LETTER A WITH RING BELOW */
+  {0x1e01, 2, 937}, /* LATIN SMALL LETTER A WITH RING BELOW */
+  {0x1e02, 2, 939}, /* LATIN CAPITAL LETTER B WITH DOT ABOVE */
+  {0x1e03, 2, 941}, /* LATIN SMALL LETTER B WITH DOT ABOVE */
+  {0x1e04, 2, 943}, /* LATIN CAPITAL LETTER B WITH DOT BELOW */
+  {0x1e05, 2, 945}, /* LATIN SMALL LETTER B WITH DOT BELOW */
+  {0x1e06, 2, 947}, /* LATIN CAPITAL LETTER B WITH LINE BELOW */
+  {0x1e07, 2, 949}, /* LATIN SMALL LETTER B WITH LINE BELOW */
+  {0x1e08, 2, 951}, /* LATIN CAPITAL LETTER C WITH CEDILLA AND ACUTE */
+  {0x1e09, 2, 953}, /* LATIN SMALL LETTER C WITH CEDILLA AND ACUTE */
+  {0x1e0a, 2, 955}, /* LATIN CAPITAL LETTER D WITH DOT ABOVE */
+  {0x1e0b, 2, 957}, /* LATIN SMALL LETTER D WITH DOT ABOVE */
+  {0x1e0c, 2, 959}, /* LATIN CAPITAL LETTER D WITH DOT BELOW */
+  {0x1e0d, 2, 961}, /* LATIN SMALL LETTER D WITH DOT BELOW */
+  {0x1e0e, 2, 963}, /* LATIN CAPITAL LETTER D WITH LINE BELOW */
+  {0x1e0f, 2, 965}, /* LATIN SMALL LETTER D WITH LINE BELOW */
+  {0x1e10, 2, 967}, /* LATIN CAPITAL LETTER D WITH CEDILLA */
+  {0x1e11, 2, 969}, /* LATIN SMALL LETTER D WITH CEDILLA */
+  {0x1e12, 2, 971}, /* LATIN CAPITAL LETTER D WITH CIRCUMFLEX BELOW */
+  {0x1e13, 2, 973}, /* LATIN SMALL LETTER D WITH CIRCUMFLEX BELOW */
+  {0x1e14, 2, 975}, /* LATIN CAPITAL LETTER E WITH MACRON AND GRAVE */
+  {0x1e15, 2, 977}, /* LATIN SMALL LETTER E WITH MACRON AND GRAVE */
+  {0x1e16, 2, 979}, /* LATIN CAPITAL LETTER E WITH MACRON AND ACUTE */
+  {0x1e17, 2, 981}, /* LATIN SMALL LETTER E WITH MACRON AND ACUTE */
+  {0x1e18, 2, 983}, /* LATIN CAPITAL LETTER E WITH CIRCUMFLEX BELOW */
+  {0x1e19, 2, 985}, /* LATIN SMALL LETTER E WITH CIRCUMFLEX BELOW */
+  {0x1e1a, 2, 987}, /* LATIN CAPITAL LETTER E WITH TILDE BELOW */
+  {0x1e1b, 2, 989}, /* LATIN SMALL LETTER E WITH TILDE BELOW */
+  {0x1e1c, 2, 991}, /* LATIN CAPITAL LETTER E WITH CEDILLA AND BREVE */
+  {0x1e1d, 2, 993}, /* LATIN SMALL LETTER E WITH CEDILLA AND BREVE */
+  {0x1e1e, 2, 995}, /* LATIN CAPITAL LETTER F WITH DOT ABOVE */
+  {0x1e1f, 2, 997}, /* LATIN SMALL LETTER F WITH DOT ABOVE */
+  {0x1e20, 2, 999}, /* LATIN CAPITAL LETTER G WITH MACRON */
+  {0x1e21, 2, 1001}, /* LATIN SMALL LETTER G WITH MACRON */
+  {0x1e22, 2, 1003}, /* LATIN CAPITAL LETTER H WITH DOT ABOVE */
+  {0x1e23, 2, 1005}, /* LATIN SMALL LETTER H WITH DOT ABOVE */
+  {0x1e24, 2, 1007}, /* LATIN CAPITAL LETTER H WITH DOT BELOW */
+  {0x1e25, 2, 1009}, /* LATIN SMALL LETTER H WITH DOT BELOW */
+  {0x1e26, 2, 1011}, /* LATIN CAPITAL LETTER H WITH DIAERESIS */
+  {0x1e27, 2, 1013}, /* LATIN SMALL LETTER H WITH DIAERESIS */
+  {0x1e28, 2, 1015}, /* LATIN CAPITAL LETTER H WITH CEDILLA */
+  {0x1e29, 2, 1017}, /* LATIN SMALL LETTER H WITH CEDILLA */
+  {0x1e2a, 2, 1019}, /* LATIN CAPITAL LETTER H WITH BREVE BELOW */
+  {0x1e2b, 2, 1021}, /* LATIN SMALL LETTER H WITH BREVE BELOW */
+  {0x1e2c, 2, 1023}, /* LATIN CAPITAL LETTER I WITH TILDE BELOW */
+  {0x1e2d, 2, 1025}, /* LATIN SMALL LETTER I WITH TILDE BELOW */
+  {0x1e2e, 2, 1027}, /* LATIN CAPITAL LETTER I WITH DIAERESIS AND ACUTE */
+  {0x1e2f, 2, 1029}, /* LATIN SMALL LETTER I WITH DIAERESIS AND ACUTE */
+  {0x1e30, 2, 1031}, /* LATIN CAPITAL LETTER K WITH ACUTE */
+  {0x1e31, 2, 1033}, /* LATIN SMALL LETTER K WITH ACUTE */
+  {0x1e32, 2, 1035}, /* LATIN CAPITAL LETTER K WITH DOT BELOW */
+  {0x1e33, 2, 1037}, /* LATIN SMALL LETTER K WITH DOT BELOW */
+  {0x1e34, 2, 1039}, /* LATIN CAPITAL LETTER K WITH LINE BELOW */
+  {0x1e35, 2, 1041}, /* LATIN SMALL LETTER K WITH LINE BELOW */
+  {0x1e36, 2, 1043}, /* LATIN CAPITAL LETTER L WITH DOT BELOW */
+  {0x1e37, 2, 1045}, /* LATIN SMALL LETTER L WITH DOT BELOW */
+  {0x1e38, 2, 1047}, /* LATIN CAPITAL LETTER L WITH DOT BELOW AND MACRON */
+  {0x1e39, 2, 1049}, /* LATIN SMALL LETTER L WITH DOT BELOW AND MACRON */
+  {0x1e3a, 2, 1051}, /* LATIN CAPITAL LETTER L WITH LINE BELOW */
+  {0x1e3b, 2, 1053}, /* LATIN SMALL LETTER L WITH LINE BELOW */
+  {0x1e3c, 2, 1055}, /* LATIN CAPITAL LETTER L WITH CIRCUMFLEX BELOW */
+  {0x1e3d, 2, 1057}, /* LATIN SMALL LETTER L WITH CIRCUMFLEX BELOW */
+  {0x1e3e, 2, 1059}, /* LATIN CAPITAL LETTER M WITH ACUTE */
+  {0x1e3f, 2, 1061}, /* LATIN SMALL LETTER M WITH ACUTE */
+  {0x1e40, 2, 1063}, /* LATIN CAPITAL LETTER M WITH DOT ABOVE */
+  {0x1e41, 2, 1065}, /* LATIN SMALL LETTER M WITH DOT ABOVE */
+  {0x1e42, 2, 1067}, /* LATIN CAPITAL LETTER M WITH DOT BELOW */
+  {0x1e43, 2, 1069}, /* LATIN SMALL LETTER M WITH DOT BELOW */
+  {0x1e44, 2, 1071}, /* LATIN CAPITAL LETTER N WITH DOT ABOVE */
+  {0x1e45, 2, 1073}, /* LATIN SMALL LETTER N WITH DOT ABOVE */
+  {0x1e46, 2, 1075}, /* LATIN CAPITAL LETTER N WITH DOT BELOW */
+  {0x1e47, 2, 1077}, /* LATIN SMALL LETTER N WITH DOT BELOW */
+  {0x1e48, 2, 1079}, /* LATIN CAPITAL LETTER N WITH LINE BELOW */
+  {0x1e49, 2, 1081}, /* LATIN SMALL LETTER N WITH LINE BELOW */
+  {0x1e4a, 2, 1083}, /* LATIN CAPITAL LETTER N WITH CIRCUMFLEX BELOW */
+  {0x1e4b, 2, 1085}, /* LATIN SMALL LETTER N WITH CIRCUMFLEX BELOW */
+  {0x1e4c, 2, 1087}, /* LATIN CAPITAL LETTER O WITH TILDE AND ACUTE */
+  {0x1e4d, 2, 1089}, /* LATIN SMALL LETTER O WITH TILDE AND ACUTE */
+  {0x1e4e, 2, 1091}, /* LATIN CAPITAL LETTER O WITH TILDE AND DIAERESIS */
+  {0x1e4f, 2, 1093}, /* LATIN SMALL LETTER O WITH TILDE AND DIAERESIS */
+  {0x1e50, 2, 1095}, /* LATIN CAPITAL LETTER O WITH MACRON AND GRAVE */
+  {0x1e51, 2, 1097}, /* LATIN SMALL LETTER O WITH MACRON AND GRAVE */
+  {0x1e52, 2, 1099}, /* LATIN CAPITAL LETTER O WITH MACRON AND ACUTE */
+  {0x1e53, 2, 1101}, /* LATIN SMALL LETTER O WITH MACRON AND ACUTE */
+  {0x1e54, 2, 1103}, /* LATIN CAPITAL LETTER P WITH ACUTE */
+  {0x1e55, 2, 1105}, /* LATIN SMALL LETTER P WITH ACUTE */
+  {0x1e56, 2, 1107}, /* LATIN CAPITAL LETTER P WITH DOT ABOVE */
+  {0x1e57, 2, 1109}, /* LATIN SMALL LETTER P WITH DOT ABOVE */
+  {0x1e58, 2, 1111}, /* LATIN CAPITAL LETTER R WITH DOT ABOVE */
+  {0x1e59, 2, 1113}, /* LATIN SMALL LETTER R WITH DOT ABOVE */
+  {0x1e5a, 2, 1115}, /* LATIN CAPITAL LETTER R WITH DOT BELOW */
+  {0x1e5b, 2, 1117}, /* LATIN SMALL LETTER R WITH DOT BELOW */
+  {0x1e5c, 2, 1119}, /* LATIN CAPITAL LETTER R WITH DOT BELOW AND MACRON */
+  {0x1e5d, 2, 1121}, /* LATIN SMALL LETTER R WITH DOT BELOW AND MACRON */
+  {0x1e5e, 2, 1123}, /* LATIN CAPITAL LETTER R WITH LINE BELOW */
+  {0x1e5f, 2, 1125}, /* LATIN SMALL LETTER R WITH LINE BELOW */
+  {0x1e60, 2, 1127}, /* LATIN CAPITAL LETTER S WITH DOT ABOVE */
+  {0x1e61, 2, 1129}, /* LATIN SMALL LETTER S WITH DOT ABOVE */
+  {0x1e62, 2, 1131}, /* LATIN CAPITAL LETTER S WITH DOT BELOW */
+  {0x1e63, 2, 1133}, /* LATIN SMALL LETTER S WITH DOT BELOW */
+  {0x1e64, 2, 1135}, /* LATIN CAPITAL LETTER S WITH ACUTE AND DOT ABOVE */
+  {0x1e65, 2, 1137}, /* LATIN SMALL LETTER S WITH ACUTE AND DOT ABOVE */
+  {0x1e66, 2, 1139}, /* LATIN CAPITAL LETTER S WITH CARON AND DOT ABOVE */
+  {0x1e67, 2, 1141}, /* LATIN SMALL LETTER S WITH CARON AND DOT ABOVE */
+  {0x1e68, 2, 1143}, /* LATIN CAPITAL LETTER S WITH DOT BELOW AND DOT ABOVE */
+  {0x1e69, 2, 1145}, /* LATIN SMALL LETTER S WITH DOT BELOW AND DOT ABOVE */
+  {0x1e6a, 2, 1147}, /* LATIN CAPITAL LETTER T WITH DOT ABOVE */
+  {0x1e6b, 2, 1149}, /* LATIN SMALL LETTER T WITH DOT ABOVE */
+  {0x1e6c, 2, 1151}, /* LATIN CAPITAL LETTER T WITH DOT BELOW */
+  {0x1e6d, 2, 1153}, /* LATIN SMALL LETTER T WITH DOT BELOW */
+  {0x1e6e, 2, 1155}, /* LATIN CAPITAL LETTER T WITH LINE BELOW */
+  {0x1e6f, 2, 1157}, /* LATIN SMALL LETTER T WITH LINE BELOW */
+  {0x1e70, 2, 1159}, /* LATIN CAPITAL LETTER T WITH CIRCUMFLEX BELOW */
+  {0x1e71, 2, 1161}, /* LATIN SMALL LETTER T WITH CIRCUMFLEX BELOW */
+  {0x1e72, 2, 1163}, /* LATIN CAPITAL LETTER U WITH DIAERESIS BELOW */
+  {0x1e73, 2, 1165}, /* LATIN SMALL LETTER U WITH DIAERESIS BELOW */
+  {0x1e74, 2, 1167}, /* LATIN CAPITAL LETTER U WITH TILDE BELOW */
+  {0x1e75, 2, 1169}, /* LATIN SMALL LETTER U WITH TILDE BELOW */
+  {0x1e76, 2, 1171}, /* LATIN CAPITAL LETTER U WITH CIRCUMFLEX BELOW */
+  {0x1e77, 2, 1173}, /* LATIN SMALL LETTER U WITH CIRCUMFLEX BELOW */
+  {0x1e78, 2, 1175}, /* LATIN CAPITAL LETTER U WITH TILDE AND ACUTE */
+  {0x1e79, 2, 1177}, /* LATIN SMALL LETTER U WITH TILDE AND ACUTE */
+  {0x1e7a, 2, 1179}, /* LATIN CAPITAL LETTER U WITH MACRON AND DIAERESIS */
+  {0x1e7b, 2, 1181}, /* LATIN SMALL LETTER U WITH MACRON AND DIAERESIS */
+  {0x1e7c, 2, 1183}, /* LATIN CAPITAL LETTER V WITH TILDE */
+  {0x1e7d, 2, 1185}, /* LATIN SMALL LETTER V WITH TILDE */
+  {0x1e7e, 2, 1187}, /* LATIN CAPITAL LETTER V WITH DOT BELOW */
+  {0x1e7f, 2, 1189}, /* LATIN SMALL LETTER V WITH DOT BELOW */
+  {0x1e80, 2, 1191}, /* LATIN CAPITAL LETTER W WITH GRAVE */
+  {0x1e81, 2, 1193}, /* LATIN SMALL LETTER W WITH GRAVE */
+  {0x1e82, 2, 1195}, /* LATIN CAPITAL LETTER W WITH ACUTE */
+  {0x1e83, 2, 1197}, /* LATIN SMALL LETTER W WITH ACUTE */
+  {0x1e84, 2, 1199}, /* LATIN CAPITAL LETTER W WITH DIAERESIS */
+  {0x1e85, 2, 1201}, /* LATIN SMALL LETTER W WITH DIAERESIS */
+  {0x1e86, 2, 1203}, /* LATIN CAPITAL LETTER W WITH DOT ABOVE */
+  {0x1e87, 2, 1205}, /* LATIN SMALL LETTER W WITH DOT ABOVE */
+  {0x1e88, 2, 1207}, /* LATIN CAPITAL LETTER W WITH DOT BELOW */
+  {0x1e89, 2, 1209}, /* LATIN SMALL LETTER W WITH DOT BELOW */
+  {0x1e8a, 2, 1211}, /* LATIN CAPITAL LETTER X WITH DOT ABOVE */
+  {0x1e8b, 2, 1213}, /* LATIN SMALL LETTER X WITH DOT ABOVE */
+  {0x1e8c, 2, 1215}, /* LATIN CAPITAL LETTER X WITH DIAERESIS */
+  {0x1e8d, 2, 1217}, /* LATIN SMALL LETTER X WITH DIAERESIS */
+  {0x1e8e, 2, 1219}, /* LATIN CAPITAL LETTER Y WITH DOT ABOVE */
+  {0x1e8f, 2, 1221}, /* LATIN SMALL LETTER Y WITH DOT ABOVE */
+  {0x1e90, 2, 1223}, /* LATIN CAPITAL LETTER Z WITH CIRCUMFLEX */
+  {0x1e91, 2, 1225}, /* LATIN SMALL LETTER Z WITH CIRCUMFLEX */
+  {0x1e92, 2, 1227}, /* LATIN CAPITAL LETTER Z WITH DOT BELOW */
+  {0x1e93, 2, 1229}, /* LATIN SMALL LETTER Z WITH DOT BELOW */
+  {0x1e94, 2, 1231}, /* LATIN CAPITAL LETTER Z WITH LINE BELOW */
+  {0x1e95, 2, 1233}, /* LATIN SMALL LETTER Z WITH LINE BELOW */
+  {0x1e96, 2, 1235}, /* LATIN SMALL LETTER H WITH LINE BELOW */
+  {0x1e97, 2, 1237}, /* LATIN SMALL LETTER T WITH DIAERESIS */
+  {0x1e98, 2, 1239}, /* LATIN SMALL LETTER W WITH RING ABOVE */
+  {0x1e99, 2, 1241}, /* LATIN SMALL LETTER Y WITH RING ABOVE */
+  {0x1e9a, 2, 1243}, /* LATIN SMALL LETTER A WITH RIGHT HALF RING */
+  {0x1e9b, 2, 1245}, /* LATIN SMALL LETTER LONG S WITH DOT ABOVE */
+  {0x1ea0, 2, 1247}, /* LATIN CAPITAL LETTER A WITH DOT BELOW */
+  {0x1ea1, 2, 1249}, /* LATIN SMALL LETTER A WITH DOT BELOW */
+  {0x1ea2, 2, 1251}, /* LATIN CAPITAL LETTER A WITH HOOK ABOVE */
+  {0x1ea3, 2, 1253}, /* LATIN SMALL LETTER A WITH HOOK ABOVE */
+  {0x1ea4, 2, 1255}, /* LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND ACUTE */
+  {0x1ea5, 2, 1257}, /* LATIN SMALL LETTER A WITH CIRCUMFLEX AND ACUTE */
+  {0x1ea6, 2, 1259}, /* LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND GRAVE */
+  {0x1ea7, 2, 1261}, /* LATIN SMALL LETTER A WITH CIRCUMFLEX AND GRAVE */
+  {0x1ea8, 2, 1263}, /* LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE */
+  {0x1ea9, 2, 1265}, /* LATIN SMALL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE */
+  {0x1eaa, 2, 1267}, /* LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND TILDE */
+  {0x1eab, 2, 1269}, /* LATIN SMALL LETTER A WITH CIRCUMFLEX AND TILDE */
+  {0x1eac, 2, 1271}, /* LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND DOT BELOW */
+  {0x1ead, 2, 1273}, /* LATIN SMALL LETTER A WITH CIRCUMFLEX AND DOT BELOW */
+  {0x1eae, 2, 1275}, /* LATIN CAPITAL LETTER A WITH BREVE AND ACUTE */
+  {0x1eaf, 2, 1277}, /* LATIN SMALL LETTER A WITH BREVE AND ACUTE */
+  {0x1eb0, 2, 1279}, /* LATIN CAPITAL LETTER A WITH BREVE AND GRAVE */
+  {0x1eb1, 2, 1281}, /* LATIN SMALL LETTER A WITH BREVE AND GRAVE */
+  {0x1eb2, 2, 1283}, /* LATIN CAPITAL LETTER A WITH BREVE AND HOOK ABOVE */
+  {0x1eb3, 2, 1285}, /* LATIN SMALL LETTER A WITH BREVE AND HOOK ABOVE */
+  {0x1eb4, 2, 1287}, /* LATIN CAPITAL LETTER A WITH BREVE AND TILDE */
+  {0x1eb5, 2, 1289}, /* LATIN SMALL LETTER A WITH BREVE AND TILDE */
+  {0x1eb6, 2, 1291}, /* LATIN CAPITAL LETTER A WITH BREVE AND DOT BELOW */
+  {0x1eb7, 2, 1293}, /* LATIN SMALL LETTER A WITH BREVE AND DOT BELOW */
+  {0x1eb8, 2, 1295}, /* LATIN CAPITAL LETTER E WITH DOT BELOW */
+  {0x1eb9, 2, 1297}, /* LATIN SMALL LETTER E WITH DOT BELOW */
+  {0x1eba, 2, 1299}, /* LATIN CAPITAL LETTER E WITH HOOK ABOVE */
+  {0x1ebb, 2, 1301}, /* LATIN SMALL LETTER E WITH HOOK ABOVE */
+  {0x1ebc, 2, 1303}, /* LATIN CAPITAL LETTER E WITH TILDE */
+  {0x1ebd, 2, 1305}, /* LATIN SMALL LETTER E WITH TILDE */
+  {0x1ebe, 2, 1307}, /* LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND ACUTE */
+  {0x1ebf, 2, 1309}, /* LATIN SMALL LETTER E WITH CIRCUMFLEX AND ACUTE */
+  {0x1ec0, 2, 1311}, /* LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND GRAVE */
+  {0x1ec1, 2, 1313}, /* LATIN SMALL LETTER E WITH CIRCUMFLEX AND GRAVE */
+  {0x1ec2, 2, 1315}, /* LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE */
+  {0x1ec3, 2, 1317}, /* LATIN SMALL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE */
+  {0x1ec4, 2, 1319}, /* LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND TILDE */
+  {0x1ec5, 2, 1321}, /* LATIN SMALL LETTER E WITH CIRCUMFLEX AND TILDE */
+  {0x1ec6, 2, 1323}, /* LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND DOT BELOW */
+  {0x1ec7, 2, 1325}, /* LATIN SMALL LETTER E WITH CIRCUMFLEX AND DOT BELOW */
+  {0x1ec8, 2, 1327}, /* LATIN CAPITAL LETTER I WITH HOOK ABOVE */
+  {0x1ec9, 2, 1329}, /* LATIN SMALL LETTER I WITH HOOK ABOVE */
+  {0x1eca, 2, 1331}, /* LATIN CAPITAL LETTER I WITH DOT BELOW */
+  {0x1ecb, 2, 1333}, /* LATIN SMALL LETTER I WITH DOT BELOW */
+  {0x1ecc, 2, 1335}, /* LATIN CAPITAL LETTER O WITH DOT BELOW */
+  {0x1ecd, 2, 1337}, /* LATIN SMALL LETTER O WITH DOT BELOW */
+  {0x1ece, 2, 1339}, /* LATIN CAPITAL LETTER O WITH HOOK ABOVE */
+  {0x1ecf, 2, 1341}, /* LATIN SMALL LETTER O WITH HOOK ABOVE */
+  {0x1ed0, 2, 1343}, /* LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND ACUTE */
+  {0x1ed1, 2, 1345}, /* LATIN SMALL LETTER O WITH CIRCUMFLEX AND ACUTE */
+  {0x1ed2, 2, 1347}, /* LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND GRAVE */
+  {0x1ed3, 2, 1349}, /* LATIN SMALL LETTER O WITH CIRCUMFLEX AND GRAVE */
+  {0x1ed4, 2, 1351}, /* LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE */
+  {0x1ed5, 2, 1353}, /* LATIN SMALL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE */
+  {0x1ed6, 2, 1355}, /* LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND TILDE */
+  {0x1ed7, 2, 1357}, /* LATIN SMALL LETTER O WITH CIRCUMFLEX AND TILDE */
+  {0x1ed8, 2, 1359}, /* LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND DOT BELOW */
+  {0x1ed9, 2, 1361}, /* LATIN SMALL LETTER O WITH CIRCUMFLEX AND DOT BELOW */
+  {0x1eda, 2, 1363}, /* LATIN CAPITAL LETTER O WITH HORN AND ACUTE */
+  {0x1edb, 2, 1365}, /* LATIN SMALL LETTER O WITH HORN AND ACUTE */
+  {0x1edc, 2, 1367}, /* LATIN CAPITAL LETTER O WITH HORN AND GRAVE */
+  {0x1edd, 2, 1369}, /* LATIN SMALL LETTER O WITH HORN AND GRAVE */
+  {0x1ede, 2, 1371}, /* LATIN CAPITAL LETTER O WITH HORN AND HOOK ABOVE */
+  {0x1edf, 2, 1373}, /* LATIN SMALL LETTER O WITH HORN AND HOOK ABOVE */
+  {0x1ee0, 2, 1375}, /* LATIN CAPITAL LETTER O WITH HORN AND TILDE */
+  {0x1ee1, 2, 1377}, /* LATIN SMALL LETTER O WITH HORN AND TILDE */
+  {0x1ee2, 2, 1379}, /* LATIN CAPITAL LETTER O WITH HORN AND DOT BELOW */
+  {0x1ee3, 2, 1381}, /* LATIN SMALL LETTER O WITH HORN AND DOT BELOW */
+  {0x1ee4, 2, 1383}, /* LATIN CAPITAL LETTER U WITH DOT BELOW */
+  {0x1ee5, 2, 1385}, /* LATIN SMALL LETTER U WITH DOT BELOW */
+  {0x1ee6, 2, 1387}, /* LATIN CAPITAL LETTER U WITH HOOK ABOVE */
+  {0x1ee7, 2, 1389}, /* LATIN SMALL LETTER U WITH HOOK ABOVE */
+  {0x1ee8, 2, 1391}, /* LATIN CAPITAL LETTER U WITH HORN AND ACUTE */
+  {0x1ee9, 2, 1393}, /* LATIN SMALL LETTER U WITH HORN AND ACUTE */
+  {0x1eea, 2, 1395}, /* LATIN CAPITAL LETTER U WITH HORN AND GRAVE */
+  {0x1eeb, 2, 1397}, /* LATIN SMALL LETTER U WITH HORN AND GRAVE */
+  {0x1eec, 2, 1399}, /* LATIN CAPITAL LETTER U WITH HORN AND HOOK ABOVE */
+  {0x1eed, 2, 1401}, /* LATIN SMALL LETTER U WITH HORN AND HOOK ABOVE */
+  {0x1eee, 2, 1403}, /* LATIN CAPITAL LETTER U WITH HORN AND TILDE */
+  {0x1eef, 2, 1405}, /* LATIN SMALL LETTER U WITH HORN AND TILDE */
+  {0x1ef0, 2, 1407}, /* LATIN CAPITAL LETTER U WITH HORN AND DOT BELOW */
+  {0x1ef1, 2, 1409}, /* LATIN SMALL LETTER U WITH HORN AND DOT BELOW */
+  {0x1ef2, 2, 1411}, /* LATIN CAPITAL LETTER Y WITH GRAVE */
+  {0x1ef3, 2, 1413}, /* LATIN SMALL LETTER Y WITH GRAVE */
+  {0x1ef4, 2, 1415}, /* LATIN CAPITAL LETTER Y WITH DOT BELOW */
+  {0x1ef5, 2, 1417}, /* LATIN SMALL LETTER Y WITH DOT BELOW */
+  {0x1ef6, 2, 1419}, /* LATIN CAPITAL LETTER Y WITH HOOK ABOVE */
+  {0x1ef7, 2, 1421}, /* LATIN SMALL LETTER Y WITH HOOK ABOVE */
+  {0x1ef8, 2, 1423}, /* LATIN CAPITAL LETTER Y WITH TILDE */
+  {0x1ef9, 2, 1425}, /* LATIN SMALL LETTER Y WITH TILDE */
+  {0x1f00, 2, 1427}, /* GREEK SMALL LETTER ALPHA WITH PSILI */
+  {0x1f01, 2, 1429}, /* GREEK SMALL LETTER ALPHA WITH DASIA */
+  {0x1f02, 2, 1431}, /* GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA */
+  {0x1f03, 2, 1433}, /* GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA */
+  {0x1f04, 2, 1435}, /* GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA */
+  {0x1f05, 2, 1437}, /* GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA */
+  {0x1f06, 2, 1439}, /* GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI */
+  {0x1f07, 2, 1441}, /* GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI */
+  {0x1f08, 2, 1443}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI */
+  {0x1f09, 2, 1445}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA */
+  {0x1f0a, 2, 1447}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA */
+  {0x1f0b, 2, 1449}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA */
+  {0x1f0c, 2, 1451}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA */
+  {0x1f0d, 2, 1453}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA */
+  {0x1f0e, 2, 1455}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI */
+  {0x1f0f, 2, 1457}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI */
+  {0x1f10, 2, 1459}, /* GREEK SMALL LETTER EPSILON WITH PSILI */
+  {0x1f11, 2, 1461}, /* GREEK SMALL LETTER EPSILON WITH DASIA */
+  {0x1f12, 2, 1463}, /* GREEK SMALL LETTER EPSILON WITH PSILI AND VARIA */
+  {0x1f13, 2, 1465}, /* GREEK SMALL LETTER EPSILON WITH DASIA AND VARIA */
+  {0x1f14, 2, 1467}, /* GREEK SMALL LETTER EPSILON WITH PSILI AND OXIA */
+  {0x1f15, 2, 1469}, /* GREEK SMALL LETTER EPSILON WITH DASIA AND OXIA */
+  {0x1f18, 2, 1471}, /* GREEK CAPITAL LETTER EPSILON WITH PSILI */
+  {0x1f19, 2, 1473}, /* GREEK CAPITAL LETTER EPSILON WITH DASIA */
+  {0x1f1a, 2, 1475}, /* GREEK CAPITAL LETTER EPSILON WITH PSILI AND VARIA */
+  {0x1f1b, 2, 1477}, /* GREEK CAPITAL LETTER EPSILON WITH DASIA AND VARIA */
+  {0x1f1c, 2, 1479}, /* GREEK CAPITAL LETTER EPSILON WITH PSILI AND OXIA */
+  {0x1f1d, 2, 1481}, /* GREEK CAPITAL LETTER EPSILON WITH DASIA AND OXIA */
+  {0x1f20, 2, 1483}, /* GREEK SMALL LETTER ETA WITH PSILI */
+  {0x1f21, 2, 1485}, /* GREEK SMALL LETTER ETA WITH DASIA */
+  {0x1f22, 2, 1487}, /* GREEK SMALL LETTER ETA WITH PSILI AND VARIA */
+  {0x1f23, 2, 1489}, /* GREEK SMALL LETTER ETA WITH DASIA AND VARIA */
+  {0x1f24, 2, 1491}, /* GREEK SMALL LETTER ETA WITH PSILI AND OXIA */
+  {0x1f25, 2, 1493}, /* GREEK SMALL LETTER ETA WITH DASIA AND OXIA */
+  {0x1f26, 2, 1495}, /* GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI */
+  {0x1f27, 2, 1497}, /* GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI */
+  {0x1f28, 2, 1499}, /* GREEK CAPITAL LETTER ETA WITH PSILI */
+  {0x1f29, 2, 1501}, /* GREEK CAPITAL LETTER ETA WITH DASIA */
+  {0x1f2a, 2, 1503}, /* GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA */
+  {0x1f2b, 2, 1505}, /* GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA */
+  {0x1f2c, 2, 1507}, /* GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA */
+  {0x1f2d, 2, 1509}, /* GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA */
+  {0x1f2e, 2, 1511}, /* GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI */
+  {0x1f2f, 2, 1513}, /* GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI */
+  {0x1f30, 2, 1515}, /* GREEK SMALL LETTER IOTA WITH PSILI */
+  {0x1f31, 2, 1517}, /* GREEK SMALL LETTER IOTA WITH DASIA */
+  {0x1f32, 2, 1519}, /* GREEK SMALL LETTER IOTA WITH PSILI AND VARIA */
+  {0x1f33, 2, 1521}, /* GREEK SMALL LETTER IOTA WITH DASIA AND VARIA */
+  {0x1f34, 2, 1523}, /* GREEK SMALL LETTER IOTA WITH PSILI AND OXIA */
+  {0x1f35, 2, 1525}, /* GREEK SMALL LETTER IOTA WITH DASIA AND OXIA */
+  {0x1f36, 2, 1527}, /* GREEK SMALL LETTER IOTA WITH PSILI AND PERISPOMENI */
+  {0x1f37, 2, 1529}, /* GREEK SMALL LETTER IOTA WITH DASIA AND PERISPOMENI */
+  {0x1f38, 2, 1531}, /* GREEK CAPITAL LETTER IOTA WITH PSILI */
+  {0x1f39, 2, 1533}, /* GREEK CAPITAL LETTER IOTA WITH DASIA */
+  {0x1f3a, 2, 1535}, /* GREEK CAPITAL LETTER IOTA WITH PSILI AND VARIA */
+  {0x1f3b, 2, 1537}, /* GREEK CAPITAL LETTER IOTA WITH DASIA AND VARIA */
+  {0x1f3c, 2, 1539}, /* GREEK CAPITAL LETTER IOTA WITH PSILI AND OXIA */
+  {0x1f3d, 2, 1541}, /* GREEK CAPITAL LETTER IOTA WITH DASIA AND OXIA */
+  {0x1f3e, 2, 1543}, /* GREEK CAPITAL LETTER IOTA WITH PSILI AND PERISPOMENI */
+  {0x1f3f, 2, 1545}, /* GREEK CAPITAL LETTER IOTA WITH DASIA AND PERISPOMENI */
+  {0x1f40, 2, 1547}, /* GREEK SMALL LETTER OMICRON WITH PSILI */
+  {0x1f41, 2, 1549}, /* GREEK SMALL LETTER OMICRON WITH DASIA */
+  {0x1f42, 2, 1551}, /* GREEK SMALL LETTER OMICRON WITH PSILI AND VARIA */
+  {0x1f43, 2, 1553}, /* GREEK SMALL LETTER OMICRON WITH DASIA AND VARIA */
+  {0x1f44, 2, 1555}, /* GREEK SMALL LETTER OMICRON WITH PSILI AND OXIA */
+  {0x1f45, 2, 1557}, /* GREEK SMALL LETTER OMICRON WITH DASIA AND OXIA */
+  {0x1f48, 2, 1559}, /* GREEK CAPITAL LETTER OMICRON WITH PSILI */
+  {0x1f49, 2, 1561}, /* GREEK CAPITAL LETTER OMICRON WITH DASIA */
+  {0x1f4a, 2, 1563}, /* GREEK CAPITAL LETTER OMICRON WITH PSILI AND VARIA */
+  {0x1f4b, 2, 1565}, /* GREEK CAPITAL LETTER OMICRON WITH DASIA AND VARIA */
+  {0x1f4c, 2, 1567}, /* GREEK CAPITAL LETTER OMICRON WITH PSILI AND OXIA */
+  {0x1f4d, 2, 1569}, /* GREEK CAPITAL LETTER OMICRON WITH DASIA AND OXIA */
+  {0x1f50, 2, 1571}, /* GREEK SMALL LETTER UPSILON WITH PSILI */
+  {0x1f51, 2, 1573}, /* GREEK SMALL LETTER UPSILON WITH DASIA */
+  {0x1f52, 2, 1575}, /* GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA */
+  {0x1f53, 2, 1577}, /* GREEK SMALL LETTER UPSILON WITH DASIA AND VARIA */
+  {0x1f54, 2, 1579}, /* GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA */
+  {0x1f55, 2, 1581}, /* GREEK SMALL LETTER UPSILON WITH DASIA AND OXIA */
+  {0x1f56, 2, 1583}, /* GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI */
+  {0x1f57, 2, 1585}, /* GREEK SMALL LETTER UPSILON WITH DASIA AND PERISPOMENI */
+  {0x1f59, 2, 1587}, /* GREEK CAPITAL LETTER UPSILON WITH DASIA */
+  {0x1f5b, 2, 1589}, /* GREEK CAPITAL LETTER UPSILON WITH DASIA AND VARIA */
+  {0x1f5d, 2, 1591}, /* GREEK CAPITAL LETTER UPSILON WITH DASIA AND OXIA */
+  {0x1f5f, 2, 1593}, /* GREEK CAPITAL LETTER UPSILON WITH DASIA AND PERISPOMENI */
+  {0x1f60, 2, 1595}, /* GREEK SMALL LETTER OMEGA WITH PSILI */
+  {0x1f61, 2, 1597}, /* GREEK SMALL LETTER OMEGA WITH DASIA */
+  {0x1f62, 2, 1599}, /* GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA */
+  {0x1f63, 2, 1601}, /* GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA */
+  {0x1f64, 2, 1603}, /* GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA */
+  {0x1f65, 2, 1605}, /* GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA */
+  {0x1f66, 2, 1607}, /* GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI */
+  {0x1f67, 2, 1609}, /* GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI */
+  {0x1f68, 2, 1611}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI */
+  {0x1f69, 2, 1613}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA */
+  {0x1f6a, 2, 1615}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA */
+  {0x1f6b, 2, 1617}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA */
+  {0x1f6c, 2, 1619}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA */
+  {0x1f6d, 2, 1621}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA */
+  {0x1f6e, 2, 1623}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI */
+  {0x1f6f, 2, 1625}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI */
+  {0x1f70, 2, 1627}, /* GREEK SMALL LETTER ALPHA WITH VARIA */
+  {0x1f71, 1, 1629}, /* GREEK SMALL LETTER ALPHA WITH OXIA */
+  {0x1f72, 2, 1630}, /* GREEK SMALL LETTER EPSILON WITH VARIA */
+  {0x1f73, 1, 1632}, /* GREEK SMALL LETTER EPSILON WITH OXIA */
+  {0x1f74, 2, 1633}, /* GREEK SMALL LETTER ETA WITH VARIA */
+  {0x1f75, 1, 1635}, /* GREEK SMALL LETTER ETA WITH OXIA */
+  {0x1f76, 2, 1636}, /* GREEK SMALL LETTER IOTA WITH VARIA */
+  {0x1f77, 1, 1638}, /* GREEK SMALL LETTER IOTA WITH OXIA */
+  {0x1f78, 2, 1639}, /* GREEK SMALL LETTER OMICRON WITH VARIA */
+  {0x1f79, 1, 1641}, /* GREEK SMALL LETTER OMICRON WITH OXIA */
+  {0x1f7a, 2, 1642}, /* GREEK SMALL LETTER UPSILON WITH VARIA */
+  {0x1f7b, 1, 1644}, /* GREEK SMALL LETTER UPSILON WITH OXIA */
+  {0x1f7c, 2, 1645}, /* GREEK SMALL LETTER OMEGA WITH VARIA */
+  {0x1f7d, 1, 1647}, /* GREEK SMALL LETTER OMEGA WITH OXIA */
+  {0x1f80, 2, 1648}, /* GREEK SMALL LETTER ALPHA WITH PSILI AND YPOGEGRAMMENI */
+  {0x1f81, 2, 1650}, /* GREEK SMALL LETTER ALPHA WITH DASIA AND YPOGEGRAMMENI */
+  {0x1f82, 2, 1652}, /* GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA AND YPOGEGRAMMENI */
+  {0x1f83, 2, 1654}, /* GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA AND YPOGEGRAMMENI */
+  {0x1f84, 2, 1656}, /* GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA AND YPOGEGRAMMENI */
+  {0x1f85, 2, 1658}, /* GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA AND YPOGEGRAMMENI */
+  {0x1f86, 2, 1660}, /* GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1f87, 2, 1662}, /* GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1f88, 2, 1664}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI */
+  {0x1f89, 2, 1666}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI */
+  {0x1f8a, 2, 1668}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA AND PROSGEGRAMMENI */
+  {0x1f8b, 2, 1670}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA AND PROSGEGRAMMENI */
+  {0x1f8c, 2, 1672}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA AND PROSGEGRAMMENI */
+  {0x1f8d, 2, 1674}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA AND PROSGEGRAMMENI */
+  {0x1f8e, 2, 1676}, /* GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI */
+  {0x1f8f, 2, 1678}, /* GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI */
+  {0x1f90, 2, 1680}, /* GREEK SMALL LETTER ETA WITH PSILI AND YPOGEGRAMMENI */
+  {0x1f91, 2, 1682}, /* GREEK SMALL LETTER ETA WITH DASIA AND YPOGEGRAMMENI */
+  {0x1f92, 2, 1684}, /* GREEK SMALL LETTER ETA WITH PSILI AND VARIA AND YPOGEGRAMMENI */
+  {0x1f93, 2, 1686}, /* GREEK SMALL LETTER ETA WITH DASIA AND VARIA AND YPOGEGRAMMENI */
+  {0x1f94, 2, 1688}, /* GREEK SMALL LETTER ETA WITH PSILI AND OXIA AND YPOGEGRAMMENI */
+  {0x1f95, 2, 1690}, /* GREEK SMALL LETTER ETA WITH DASIA AND OXIA AND YPOGEGRAMMENI */
+  {0x1f96, 2, 1692}, /* GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1f97, 2, 1694}, /* GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1f98, 2, 1696}, /* GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI */
+  {0x1f99, 2, 1698}, /* GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI */
+  {0x1f9a, 2, 1700}, /* GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA AND PROSGEGRAMMENI */
+  {0x1f9b, 2, 1702}, /* GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA AND PROSGEGRAMMENI */
+  {0x1f9c, 2, 1704}, /* GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA AND PROSGEGRAMMENI */
+  {0x1f9d, 2, 1706}, /* GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA AND PROSGEGRAMMENI */
+  {0x1f9e, 2, 1708}, /* GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI */
+  {0x1f9f, 2, 1710}, /* GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI */
+  {0x1fa0, 2, 1712}, /* GREEK SMALL LETTER OMEGA WITH PSILI AND YPOGEGRAMMENI */
+  {0x1fa1, 2, 1714}, /* GREEK SMALL LETTER OMEGA WITH DASIA AND YPOGEGRAMMENI */
+  {0x1fa2, 2, 1716}, /* GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA AND YPOGEGRAMMENI */
+  {0x1fa3, 2, 1718}, /* GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA AND YPOGEGRAMMENI */
+  {0x1fa4, 2, 1720}, /* GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA AND YPOGEGRAMMENI */
+  {0x1fa5, 2, 1722}, /* GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA AND YPOGEGRAMMENI */
+  {0x1fa6, 2, 1724}, /* GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1fa7, 2, 1726}, /* GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1fa8, 2, 1728}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI */
+  {0x1fa9, 2, 1730}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI */
+  {0x1faa, 2, 1732}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA AND PROSGEGRAMMENI */
+  {0x1fab, 2, 1734}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA AND PROSGEGRAMMENI */
+  {0x1fac, 2, 1736}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA AND PROSGEGRAMMENI */
+  {0x1fad, 2, 1738}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA AND PROSGEGRAMMENI */
+  {0x1fae, 2, 1740}, /* GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI AND PROSGEGRAMMENI */
+  {0x1faf, 2, 1742}, /* GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI AND PROSGEGRAMMENI */
+  {0x1fb0, 2, 1744}, /* GREEK SMALL LETTER ALPHA WITH VRACHY */
+  {0x1fb1, 2, 1746}, /* GREEK SMALL LETTER ALPHA WITH MACRON */
+  {0x1fb2, 2, 1748}, /* GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI */
+  {0x1fb3, 2, 1750}, /* GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI */
+  {0x1fb4, 2, 1752}, /* GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI */
+  {0x1fb6, 2, 1754}, /* GREEK SMALL LETTER ALPHA WITH PERISPOMENI */
+  {0x1fb7, 2, 1756}, /* GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1fb8, 2, 1758}, /* GREEK CAPITAL LETTER ALPHA WITH VRACHY */
+  {0x1fb9, 2, 1760}, /* GREEK CAPITAL LETTER ALPHA WITH MACRON */
+  {0x1fba, 2, 1762}, /* GREEK CAPITAL LETTER ALPHA WITH VARIA */
+  {0x1fbb, 1, 1764}, /* GREEK CAPITAL LETTER ALPHA WITH OXIA */
+  {0x1fbc, 2, 1765}, /* GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI */
+  {0x1fbd, 2, 1767}, /* GREEK KORONIS */
+  {0x1fbe, 1, 616}, /* GREEK PROSGEGRAMMENI */
+  {0x1fbf, 2, 1767}, /* GREEK PSILI */
+  {0x1fc0, 2, 1769}, /* GREEK PERISPOMENI */
+  {0x1fc1, 2, 1771}, /* GREEK DIALYTIKA AND PERISPOMENI */
+  {0x1fc2, 2, 1773}, /* GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI */
+  {0x1fc3, 2, 1775}, /* GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI */
+  {0x1fc4, 2, 1777}, /* GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI */
+  {0x1fc6, 2, 1779}, /* GREEK SMALL LETTER ETA WITH PERISPOMENI */
+  {0x1fc7, 2, 1781}, /* GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1fc8, 2, 1783}, /* GREEK CAPITAL LETTER EPSILON WITH VARIA */
+  {0x1fc9, 1, 1785}, /* GREEK CAPITAL LETTER EPSILON WITH OXIA */
+  {0x1fca, 2, 1786}, /* GREEK CAPITAL LETTER ETA WITH VARIA */
+  {0x1fcb, 1, 1788}, /* GREEK CAPITAL LETTER ETA WITH OXIA */
+  {0x1fcc, 2, 1789}, /* GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI */
+  {0x1fcd, 2, 1791}, /* GREEK PSILI AND VARIA */
+  {0x1fce, 2, 1793}, /* GREEK PSILI AND OXIA */
+  {0x1fcf, 2, 1795}, /* GREEK PSILI AND PERISPOMENI */
+  {0x1fd0, 2, 1797}, /* GREEK SMALL LETTER IOTA WITH VRACHY */
+  {0x1fd1, 2, 1799}, /* GREEK SMALL LETTER IOTA WITH MACRON */
+  {0x1fd2, 2, 1801}, /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA */
+  {0x1fd3, 1, 1803}, /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND OXIA */
+  {0x1fd6, 2, 1804}, /* GREEK SMALL LETTER IOTA WITH PERISPOMENI */
+  {0x1fd7, 2, 1806}, /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI */
+  {0x1fd8, 2, 1808}, /* GREEK CAPITAL LETTER IOTA WITH VRACHY */
+  {0x1fd9, 2, 1810}, /* GREEK CAPITAL LETTER IOTA WITH MACRON */
+  {0x1fda, 2, 1812}, /* GREEK CAPITAL LETTER IOTA WITH VARIA */
+  {0x1fdb, 1, 1814}, /* GREEK CAPITAL LETTER IOTA WITH OXIA */
+  {0x1fdd, 2, 1815}, /* GREEK DASIA AND VARIA */
+  {0x1fde, 2, 1817}, /* GREEK DASIA AND OXIA */
+  {0x1fdf, 2, 1819}, /* GREEK DASIA AND PERISPOMENI */
+  {0x1fe0, 2, 1821}, /* GREEK SMALL LETTER UPSILON WITH VRACHY */
+  {0x1fe1, 2, 1823}, /* GREEK SMALL LETTER UPSILON WITH MACRON */
+  {0x1fe2, 2, 1825}, /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA */
+  {0x1fe3, 1, 1827}, /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND OXIA */
+  {0x1fe4, 2, 1828}, /* GREEK SMALL LETTER RHO WITH PSILI */
+  {0x1fe5, 2, 1830}, /* GREEK SMALL LETTER RHO WITH DASIA */
+  {0x1fe6, 2, 1832}, /* GREEK SMALL LETTER UPSILON WITH PERISPOMENI */
+  {0x1fe7, 2, 1834}, /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI */
+  {0x1fe8, 2, 1836}, /* GREEK CAPITAL LETTER UPSILON WITH VRACHY */
+  {0x1fe9, 2, 1838}, /* GREEK CAPITAL LETTER UPSILON WITH MACRON */
+  {0x1fea, 2, 1840}, /* GREEK CAPITAL LETTER UPSILON WITH VARIA */
+  {0x1feb, 1, 1842}, /* GREEK CAPITAL LETTER UPSILON WITH OXIA */
+  {0x1fec, 2, 1843}, /* GREEK CAPITAL LETTER RHO WITH DASIA */
+  {0x1fed, 2, 1845}, /* GREEK DIALYTIKA AND VARIA */
+  {0x1fee, 1, 1847}, /* GREEK DIALYTIKA AND OXIA */
+  {0x1fef, 1, 1848}, /* GREEK VARIA */
+  {0x1ff2, 2, 1849}, /* GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI */
+  {0x1ff3, 2, 1851}, /* GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI */
+  {0x1ff4, 2, 1853}, /* GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI */
+  {0x1ff6, 2, 1855}, /* GREEK SMALL LETTER OMEGA WITH PERISPOMENI */
+  {0x1ff7, 2, 1857}, /* GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI */
+  {0x1ff8, 2, 1859}, /* GREEK CAPITAL LETTER OMICRON WITH VARIA */
+  {0x1ff9, 1, 1861}, /* GREEK CAPITAL LETTER OMICRON WITH OXIA */
+  {0x1ffa, 2, 1862}, /* GREEK CAPITAL LETTER OMEGA WITH VARIA */
+  {0x1ffb, 1, 1864}, /* GREEK CAPITAL LETTER OMEGA WITH OXIA */
+  {0x1ffc, 2, 1865}, /* GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI */
+  {0x1ffd, 1, 1867}, /* GREEK OXIA */
+  {0x1ffe, 2, 1868}, /* GREEK DASIA */
+  {0x2000, 1, 1870}, /* EN QUAD */
+  {0x2001, 1, 1871}, /* EM QUAD */
+  {0x2002, 1, 1872}, /* EN SPACE */
+  {0x2003, 1, 1873}, /* EM SPACE */
+  {0x2004, 1, 1874}, /* THREE-PER-EM SPACE */
+  {0x2005, 1, 1875}, /* FOUR-PER-EM SPACE */
+  {0x2006, 1, 1876}, /* SIX-PER-EM SPACE */
+  {0x2007, 1, 1877}, /* FIGURE SPACE */
+  {0x2008, 1, 1878}, /* PUNCTUATION SPACE */
+  {0x2009, 1, 1879}, /* THIN SPACE */
+  {0x200a, 1, 1880}, /* HAIR SPACE */
+  {0x2011, 1, 1881}, /* NON-BREAKING HYPHEN */
+  {0x2017, 2, 1882}, /* DOUBLE LOW LINE */
+  {0x2024, 1, 1884}, /* ONE DOT LEADER */
+  {0x2025, 2, 1885}, /* TWO DOT LEADER */
+  {0x2026, 3, 1884}, /* HORIZONTAL ELLIPSIS */
+  {0x202f, 1, 1887}, /* NARROW NO-BREAK SPACE */
+  {0x2033, 2, 1888}, /* DOUBLE PRIME */
+  {0x2034, 3, 1890}, /* TRIPLE PRIME */
+  {0x2036, 2, 1893}, /* REVERSED DOUBLE PRIME */
+  {0x2037, 3, 1895}, /* REVERSED TRIPLE PRIME */
+  {0x203c, 2, 1898}, /* DOUBLE EXCLAMATION MARK */
+  {0x203e, 2, 1900}, /* OVERLINE */
+  {0x2047, 2, 1902}, /* DOUBLE QUESTION MARK */
+  {0x2048, 2, 1904}, /* QUESTION EXCLAMATION MARK */
+  {0x2049, 2, 1906}, /* EXCLAMATION QUESTION MARK */
+  {0x2057, 4, 1888}, /* QUADRUPLE PRIME */
+  {0x205f, 1, 1908}, /* MEDIUM MATHEMATICAL SPACE */
+  {0x2070, 1, 1909}, /* SUPERSCRIPT ZERO */
+  {0x2071, 1, 98}, /* SUPERSCRIPT LATIN SMALL LETTER I */
+  {0x2074, 1, 17}, /* SUPERSCRIPT FOUR */
+  {0x2075, 1, 1910}, /* SUPERSCRIPT FIVE */
+  {0x2076, 1, 1911}, /* SUPERSCRIPT SIX */
+  {0x2077, 1, 1912}, /* SUPERSCRIPT SEVEN */
+  {0x2078, 1, 1913}, /* SUPERSCRIPT EIGHT */
+  {0x2079, 1, 1914}, /* SUPERSCRIPT NINE */
+  {0x207a, 1, 1915}, /* SUPERSCRIPT PLUS SIGN */
+  {0x207b, 1, 1916}, /* SUPERSCRIPT MINUS */
+  {0x207c, 1, 1917}, /* SUPERSCRIPT EQUALS SIGN */
+  {0x207d, 1, 1918}, /* SUPERSCRIPT LEFT PARENTHESIS */
+  {0x207e, 1, 1919}, /* SUPERSCRIPT RIGHT PARENTHESIS */
+  {0x207f, 1, 106}, /* SUPERSCRIPT LATIN SMALL LETTER N */
+  {0x2080, 1, 1909}, /* SUBSCRIPT ZERO */
+  {0x2081, 1, 13}, /* SUBSCRIPT ONE */
+  {0x2082, 1, 6}, /* SUBSCRIPT TWO */
+  {0x2083, 1, 7}, /* SUBSCRIPT THREE */
+  {0x2084, 1, 17}, /* SUBSCRIPT FOUR */
+  {0x2085, 1, 1910}, /* SUBSCRIPT FIVE */
+  {0x2086, 1, 1911}, /* SUBSCRIPT SIX */
+  {0x2087, 1, 1912}, /* SUBSCRIPT SEVEN */
+  {0x2088, 1, 1913}, /* SUBSCRIPT EIGHT */
+  {0x2089, 1, 1914}, /* SUBSCRIPT NINE */
+  {0x208a, 1, 1915}, /* SUBSCRIPT PLUS SIGN */
+  {0x208b, 1, 1916}, /* SUBSCRIPT MINUS */
+  {0x208c, 1, 1917}, /* SUBSCRIPT EQUALS SIGN */
+  {0x208d, 1, 1918}, /* SUBSCRIPT LEFT PARENTHESIS */
+  {0x208e, 1, 1919}, /* SUBSCRIPT RIGHT PARENTHESIS */
+  {0x20a8, 2, 1920}, /* RUPEE SIGN */
+  {0x2100, 3, 1922}, /* ACCOUNT OF */
+  {0x2101, 3, 1925}, /* ADDRESSED TO THE SUBJECT */
+  {0x2102, 1, 36}, /* DOUBLE-STRUCK CAPITAL C */
+  {0x2103, 2, 1928}, /* DEGREE CELSIUS */
+  {0x2105, 3, 1930}, /* CARE OF */
+  {0x2106, 3, 1933}, /* CADA UNA */
+  {0x2107, 1, 1936}, /* EULER CONSTANT */
+  {0x2109, 2, 1937}, /* DEGREE FAHRENHEIT */
+  {0x210a, 1, 184}, /* SCRIPT SMALL G */
+  {0x210b, 1, 198}, /* SCRIPT CAPITAL H */
+  {0x210c, 1, 198}, /* BLACK-LETTER CAPITAL H */
+  {0x210d, 1, 198}, /* DOUBLE-STRUCK CAPITAL H */
+  {0x210e, 1, 200}, /* PLANCK CONSTANT */
+  {0x210f, 1, 1939}, /* PLANCK CONSTANT OVER TWO PI */
+  {0x2110, 1, 46}, /* SCRIPT CAPITAL I */
+  {0x2111, 1, 46}, /* BLACK-LETTER CAPITAL I */
+  {0x2112, 1, 232}, /* SCRIPT CAPITAL L */
+  {0x2113, 1, 234}, /* SCRIPT SMALL L */
+  {0x2115, 1, 54}, /* DOUBLE-STRUCK CAPITAL N */
+  {0x2116, 2, 1940}, /* NUMERO SIGN */
+  {0x2119, 1, 914}, /* DOUBLE-STRUCK CAPITAL P */
+  {0x211a, 1, 1942}, /* DOUBLE-STRUCK CAPITAL Q */
+  {0x211b, 1, 274}, /* SCRIPT CAPITAL R */
+  {0x211c, 1, 274}, /* BLACK-LETTER CAPITAL R */
+  {0x211d, 1, 274}, /* DOUBLE-STRUCK CAPITAL R */
+  {0x2120, 2, 1943}, /* SERVICE MARK */
+  {0x2121, 3, 1945}, /* TELEPHONE SIGN */
+  {0x2122, 2, 1948}, /* TRADE MARK SIGN */
+  {0x2124, 1, 344}, /* DOUBLE-STRUCK CAPITAL Z */
+  {0x2126, 1, 602}, /* OHM SIGN */
+  {0x2128, 1, 344}, /* BLACK-LETTER CAPITAL Z */
+  {0x212a, 1, 228}, /* KELVIN SIGN */
+  {0x212b, 1, 462}, /* ANGSTROM SIGN */
+  {0x212c, 1, 910}, /* SCRIPT CAPITAL B */
+  {0x212d, 1, 36}, /* BLACK-LETTER CAPITAL C */
+  {0x212f, 1, 90}, /* SCRIPT SMALL E */
+  {0x2130, 1, 38}, /* SCRIPT CAPITAL E */
+  {0x2131, 1, 995}, /* SCRIPT CAPITAL F */
+  {0x2133, 1, 912}, /* SCRIPT CAPITAL M */
+  {0x2134, 1, 14}, /* SCRIPT SMALL O */
+  {0x2135, 1, 1950}, /* ALEF SYMBOL */
+  {0x2136, 1, 1951}, /* BET SYMBOL */
+  {0x2137, 1, 1952}, /* GIMEL SYMBOL */
+  {0x2138, 1, 1953}, /* DALET SYMBOL */
+  {0x2139, 1, 98}, /* INFORMATION SOURCE */
+  {0x213b, 3, 1954}, /* FACSIMILE SIGN */
+  {0x213d, 1, 932}, /* DOUBLE-STRUCK SMALL GAMMA */
+  {0x213e, 1, 1957}, /* DOUBLE-STRUCK CAPITAL GAMMA */
+  {0x213f, 1, 1958}, /* DOUBLE-STRUCK CAPITAL PI */
+  {0x2140, 1, 1959}, /* DOUBLE-STRUCK N-ARY SUMMATION */
+  {0x2145, 1, 158}, /* DOUBLE-STRUCK ITALIC CAPITAL D */
+  {0x2146, 1, 160}, /* DOUBLE-STRUCK ITALIC SMALL D */
+  {0x2147, 1, 90}, /* DOUBLE-STRUCK ITALIC SMALL E */
+  {0x2148, 1, 98}, /* DOUBLE-STRUCK ITALIC SMALL I */
+  {0x2149, 1, 223}, /* DOUBLE-STRUCK ITALIC SMALL J */
+  {0x2153, 3, 1960}, /* VULGAR FRACTION ONE THIRD */
+  {0x2154, 3, 1963}, /* VULGAR FRACTION TWO THIRDS */
+  {0x2155, 3, 1966}, /* VULGAR FRACTION ONE FIFTH */
+  {0x2156, 3, 1969}, /* VULGAR FRACTION TWO FIFTHS */
+  {0x2157, 3, 1972}, /* VULGAR FRACTION THREE FIFTHS */
+  {0x2158, 3, 1975}, /* VULGAR FRACTION FOUR FIFTHS */
+  {0x2159, 3, 1978}, /* VULGAR FRACTION ONE SIXTH */
+  {0x215a, 3, 1981}, /* VULGAR FRACTION FIVE SIXTHS */
+  {0x215b, 3, 1984}, /* VULGAR FRACTION ONE EIGHTH */
+  {0x215c, 3, 1987}, /* VULGAR FRACTION THREE EIGHTHS */
+  {0x215d, 3, 1990}, /* VULGAR FRACTION FIVE EIGHTHS */
+  {0x215e, 3, 1993}, /* VULGAR FRACTION SEVEN EIGHTHS */
+  {0x215f, 2, 15}, /* FRACTION NUMERATOR ONE */
+  {0x2160, 1, 46}, /* ROMAN NUMERAL ONE */
+  {0x2161, 2, 1996}, /* ROMAN NUMERAL TWO */
+  {0x2162, 3, 1998}, /* ROMAN NUMERAL THREE */
+  {0x2163, 2, 2001}, /* ROMAN NUMERAL FOUR */
+  {0x2164, 1, 1183}, /* ROMAN NUMERAL FIVE */
+  {0x2165, 2, 2003}, /* ROMAN NUMERAL SIX */
+  {0x2166, 3, 2005}, /* ROMAN NUMERAL SEVEN */
+  {0x2167, 4, 2008}, /* ROMAN NUMERAL EIGHT */
+  {0x2168, 2, 2012}, /* ROMAN NUMERAL NINE */
+  {0x2169, 1, 1211}, /* ROMAN NUMERAL TEN */
+  {0x216a, 2, 2014}, /* ROMAN NUMERAL ELEVEN */
+  {0x216b, 3, 2016}, /* ROMAN NUMERAL TWELVE */
+  {0x216c, 1, 232}, /* ROMAN NUMERAL FIFTY */
+  {0x216d, 1, 36}, /* ROMAN NUMERAL ONE HUNDRED */
+  {0x216e, 1, 158}, /* ROMAN NUMERAL FIVE HUNDRED */
+  {0x216f, 1, 912}, /* ROMAN NUMERAL ONE THOUSAND */
+  {0x2170, 1, 98}, /* SMALL ROMAN NUMERAL ONE */
+  {0x2171, 2, 2019}, /* SMALL ROMAN NUMERAL TWO */
+  {0x2172, 3, 2021}, /* SMALL ROMAN NUMERAL THREE */
+  {0x2173, 2, 2024}, /* SMALL ROMAN NUMERAL FOUR */
+  {0x2174, 1, 930}, /* SMALL ROMAN NUMERAL FIVE */
+  {0x2175, 2, 2026}, /* SMALL ROMAN NUMERAL SIX */
+  {0x2176, 3, 2028}, /* SMALL ROMAN NUMERAL SEVEN */
+  {0x2177, 4, 2031}, /* SMALL ROMAN NUMERAL EIGHT */
+  {0x2178, 2, 2035}, /* SMALL ROMAN NUMERAL NINE */
+  {0x2179, 1, 579}, /* SMALL ROMAN NUMERAL TEN */
+  {0x217a, 2, 2037}, /* SMALL ROMAN NUMERAL ELEVEN */
+  {0x217b, 3, 2039}, /* SMALL ROMAN NUMERAL TWELVE */
+  {0x217c, 1, 234}, /* SMALL ROMAN NUMERAL FIFTY */
+  {0x217d, 1, 88}, /* SMALL ROMAN NUMERAL ONE HUNDRED */
+  {0x217e, 1, 160}, /* SMALL ROMAN NUMERAL FIVE HUNDRED */
+  {0x217f, 1, 922}, /* SMALL ROMAN NUMERAL ONE THOUSAND */
+  {0x219a, 2, 2042}, /* LEFTWARDS ARROW WITH STROKE */
+  {0x219b, 2, 2044}, /* RIGHTWARDS ARROW WITH STROKE */
+  {0x21ae, 2, 2046}, /* LEFT RIGHT ARROW WITH STROKE */
+  {0x21cd, 2, 2048}, /* LEFTWARDS DOUBLE ARROW WITH STROKE */
+  {0x21ce, 2, 2050}, /* LEFT RIGHT DOUBLE ARROW WITH STROKE */
+  {0x21cf, 2, 2052}, /* RIGHTWARDS DOUBLE ARROW WITH STROKE */
+  {0x2204, 2, 2054}, /* THERE DOES NOT EXIST */
+  {0x2209, 2, 2056}, /* NOT AN ELEMENT OF */
+  {0x220c, 2, 2058}, /* DOES NOT CONTAIN AS MEMBER */
+  {0x2224, 2, 2060}, /* DOES NOT DIVIDE */
+  {0x2226, 2, 2062}, /* NOT PARALLEL TO */
+  {0x222c, 2, 2064}, /* DOUBLE INTEGRAL */
+  {0x222d, 3, 2066}, /* TRIPLE INTEGRAL */
+  {0x222f, 2, 2069}, /* SURFACE INTEGRAL */
+  {0x2230, 3, 2071}, /* VOLUME INTEGRAL */
+  {0x2241, 2, 2074}, /* NOT TILDE */
+  {0x2244, 2, 2076}, /* NOT ASYMPTOTICALLY EQUAL TO */
+  {0x2247, 2, 2078}, /* NEITHER APPROXIMATELY NOR ACTUALLY EQUAL TO */
+  {0x2249, 2, 2080}, /* NOT ALMOST EQUAL TO */
+  {0x2260, 2, 2082}, /* NOT EQUAL TO */
+  {0x2262, 2, 2084}, /* NOT IDENTICAL TO */
+  {0x226d, 2, 2086}, /* NOT EQUIVALENT TO */
+  {0x226e, 2, 2088}, /* NOT LESS-THAN */
+  {0x226f, 2, 2090}, /* NOT GREATER-THAN */
+  {0x2270, 2, 2092}, /* NEITHER LESS-THAN NOR EQUAL TO */
+  {0x2271, 2, 2094}, /* NEITHER GREATER-THAN NOR EQUAL TO */
+  {0x2274, 2, 2096}, /* NEITHER LESS-THAN NOR EQUIVALENT TO */
+  {0x2275, 2, 2098}, /* NEITHER GREATER-THAN NOR EQUIVALENT TO */
+  {0x2278, 2, 2100}, /* NEITHER LESS-THAN NOR GREATER-THAN */
+  {0x2279, 2, 2102}, /* NEITHER GREATER-THAN NOR LESS-THAN */
+  {0x2280, 2, 2104}, /* DOES NOT PRECEDE */
+  {0x2281, 2, 2106}, /* DOES NOT SUCCEED */
+  {0x2284, 2, 2108}, /* NOT A SUBSET OF */
+  {0x2285, 2, 2110}, /* NOT A SUPERSET OF */
+  {0x2288, 2, 2112}, /* NEITHER A SUBSET OF NOR EQUAL TO */
+  {0x2289, 2, 2114}, /* NEITHER A SUPERSET OF NOR EQUAL TO */
+  {0x22ac, 2, 2116}, /* DOES NOT PROVE */
+  {0x22ad, 2, 2118}, /* NOT TRUE */
+  {0x22ae, 2, 2120}, /* DOES NOT FORCE */
+  {0x22af, 2, 2122}, /* NEGATED DOUBLE VERTICAL BAR DOUBLE RIGHT TURNSTILE */
+  {0x22e0, 2, 2124}, /* DOES NOT PRECEDE OR EQUAL */
+  {0x22e1, 2, 2126}, /* DOES NOT SUCCEED OR EQUAL */
+  {0x22e2, 2, 2128}, /* NOT SQUARE IMAGE OF OR EQUAL TO */
+  {0x22e3, 2, 2130}, /* NOT SQUARE ORIGINAL OF OR EQUAL TO */
+  {0x22ea, 2, 2132}, /* NOT NORMAL SUBGROUP OF */
+  {0x22eb, 2, 2134}, /* DOES NOT CONTAIN AS NORMAL SUBGROUP */
+  {0x22ec, 2, 2136}, /* NOT NORMAL SUBGROUP OF OR EQUAL TO */
+  {0x22ed, 2, 2138}, /* DOES NOT CONTAIN AS NORMAL SUBGROUP OR EQUAL */
+  {0x2329, 1, 2140}, /* LEFT-POINTING ANGLE BRACKET */
+  {0x232a, 1, 2141}, /* RIGHT-POINTING ANGLE BRACKET */
+  {0x2460, 1, 13}, /* CIRCLED DIGIT ONE */
+  {0x2461, 1, 6}, /* CIRCLED DIGIT TWO */
+  {0x2462, 1, 7}, /* CIRCLED DIGIT THREE */
+  {0x2463, 1, 17}, /* CIRCLED DIGIT FOUR */
+  {0x2464, 1, 1910}, /* CIRCLED DIGIT FIVE */
+  {0x2465, 1, 1911}, /* CIRCLED DIGIT SIX */
+  {0x2466, 1, 1912}, /* CIRCLED DIGIT SEVEN */
+  {0x2467, 1, 1913}, /* CIRCLED DIGIT EIGHT */
+  {0x2468, 1, 1914}, /* CIRCLED DIGIT NINE */
+  {0x2469, 2, 2142}, /* CIRCLED NUMBER TEN */
+  {0x246a, 2, 2144}, /* CIRCLED NUMBER ELEVEN */
+  {0x246b, 2, 2146}, /* CIRCLED NUMBER TWELVE */
+  {0x246c, 2, 2148}, /* CIRCLED NUMBER THIRTEEN */
+  {0x246d, 2, 2150}, /* CIRCLED NUMBER FOURTEEN */
+  {0x246e, 2, 2152}, /* CIRCLED NUMBER FIFTEEN */
+  {0x246f, 2, 2154}, /* CIRCLED NUMBER SIXTEEN */
+  {0x2470, 2, 2156}, /* CIRCLED NUMBER SEVENTEEN */
+  {0x2471, 2, 2158}, /* CIRCLED NUMBER EIGHTEEN */
+  {0x2472, 2, 2160}, /* CIRCLED NUMBER NINETEEN */
+  {0x2473, 2, 2162}, /* CIRCLED NUMBER TWENTY */
+  {0x2474, 3, 2164}, /* PARENTHESIZED DIGIT ONE */
+  {0x2475, 3, 2167}, /* PARENTHESIZED DIGIT TWO */
+  {0x2476, 3, 2170}, /* PARENTHESIZED DIGIT THREE */
+  {0x2477, 3, 2173}, /* PARENTHESIZED DIGIT FOUR */
+  {0x2478, 3, 2176}, /* PARENTHESIZED DIGIT FIVE */
+  {0x2479, 3, 2179}, /* PARENTHESIZED DIGIT SIX */
+  {0x247a, 3, 2182}, /* PARENTHESIZED DIGIT SEVEN */
+  {0x247b, 3, 2185}, /* PARENTHESIZED DIGIT EIGHT */
+  {0x247c, 3, 2188}, /* PARENTHESIZED DIGIT NINE */
+  {0x247d, 4, 2191}, /* PARENTHESIZED NUMBER TEN */
+  {0x247e, 4, 2195}, /* PARENTHESIZED NUMBER ELEVEN */
+  {0x247f, 4, 2199}, /* PARENTHESIZED NUMBER TWELVE */
+  {0x2480, 4, 2203}, /* PARENTHESIZED NUMBER THIRTEEN */
+  {0x2481, 4, 2207}, /* PARENTHESIZED NUMBER FOURTEEN */
+  {0x2482, 4, 2211}, /* PARENTHESIZED NUMBER FIFTEEN */
+  {0x2483, 4, 2215}, /* PARENTHESIZED NUMBER SIXTEEN */
+  {0x2484, 4, 2219}, /* PARENTHESIZED NUMBER SEVENTEEN */
+  {0x2485, 4, 2223}, /* PARENTHESIZED NUMBER EIGHTEEN */
+  {0x2486, 4, 2227}, /* PARENTHESIZED NUMBER NINETEEN */
+  {0x2487, 4, 2231}, /* PARENTHESIZED NUMBER TWENTY */
+  {0x2488, 2, 2235}, /* DIGIT ONE FULL STOP */
+  {0x2489, 2, 2237}, /* DIGIT TWO FULL STOP */
+  {0x248a, 2, 2239}, /* DIGIT THREE FULL STOP */
+  {0x248b, 2, 2241}, /* DIGIT FOUR FULL STOP */
+  {0x248c, 2, 2243}, /* DIGIT FIVE FULL STOP */
+  {0x248d, 2, 2245}, /* DIGIT SIX FULL STOP */
+  {0x248e, 2, 2247}, /* DIGIT SEVEN FULL STOP */
+  {0x248f, 2, 2249}, /* DIGIT EIGHT FULL STOP */
+  {0x2490, 2, 2251}, /* DIGIT NINE FULL STOP */
+  {0x2491, 3, 2253}, /* NUMBER TEN FULL STOP */
+  {0x2492, 3, 2256}, /* NUMBER ELEVEN FULL STOP */
+  {0x2493, 3, 2259}, /* NUMBER TWELVE FULL STOP */
+  {0x2494, 3, 2262}, /* NUMBER THIRTEEN FULL STOP */
+  {0x2495, 3, 2265}, /* NUMBER FOURTEEN FULL STOP */
+  {0x2496, 3, 2268}, /* NUMBER FIFTEEN FULL STOP */
+  {0x2497, 3, 2271}, /* NUMBER SIXTEEN FULL STOP */
+  {0x2498, 3, 2274}, /* NUMBER SEVENTEEN FULL STOP */
+  {0x2499, 3, 2277}, /* NUMBER EIGHTEEN FULL STOP */
+  {0x249a, 3, 2280}, /* NUMBER NINETEEN FULL STOP */
+  {0x249b, 3, 2283}, /* NUMBER TWENTY FULL STOP */
+  {0x249c, 3, 2286}, /* PARENTHESIZED LATIN SMALL LETTER A */
+  {0x249d, 3, 2289}, /* PARENTHESIZED LATIN SMALL LETTER B */
+  {0x249e, 3, 2292}, /* PARENTHESIZED LATIN SMALL LETTER C */
+  {0x249f, 3, 2295}, /* PARENTHESIZED LATIN SMALL LETTER D */
+  {0x24a0, 3, 2298}, /* PARENTHESIZED LATIN SMALL LETTER E */
+  {0x24a1, 3, 2301}, /* PARENTHESIZED LATIN SMALL LETTER F */
+  {0x24a2, 3, 2304}, /* PARENTHESIZED LATIN SMALL LETTER G */
+  {0x24a3, 3, 2307}, /* PARENTHESIZED LATIN SMALL LETTER H */
+  {0x24a4, 3, 2310}, /* PARENTHESIZED LATIN SMALL LETTER I */
+  {0x24a5, 3, 2313}, /* PARENTHESIZED LATIN SMALL LETTER J */
+  {0x24a6, 3, 2316}, /* PARENTHESIZED LATIN SMALL LETTER K */
+  {0x24a7, 3, 2319}, /* PARENTHESIZED LATIN SMALL LETTER L */
+  {0x24a8, 3, 2322}, /* PARENTHESIZED LATIN SMALL LETTER M */
+  {0x24a9, 3, 2325}, /* PARENTHESIZED LATIN SMALL LETTER N */
+  {0x24aa, 3, 2328}, /* PARENTHESIZED LATIN SMALL LETTER O */
+  {0x24ab, 3, 2331}, /* PARENTHESIZED LATIN SMALL LETTER P */
+  {0x24ac, 3, 2334}, /* PARENTHESIZED LATIN SMALL LETTER Q */
+  {0x24ad, 3, 2337}, /* PARENTHESIZED LATIN SMALL LETTER R */
+  {0x24ae, 3, 2340}, /* PARENTHESIZED LATIN SMALL LETTER S */
+  {0x24af, 3, 2343}, /* PARENTHESIZED LATIN SMALL LETTER T */
+  {0x24b0, 3, 2346}, /* PARENTHESIZED LATIN SMALL LETTER U */
+  {0x24b1, 3, 2349}, /* PARENTHESIZED LATIN SMALL LETTER V */
+  {0x24b2, 3, 2352}, /* PARENTHESIZED LATIN SMALL LETTER W */
+  {0x24b3, 3, 2355}, /* PARENTHESIZED LATIN SMALL LETTER X */
+  {0x24b4, 3, 2358}, /* PARENTHESIZED LATIN SMALL LETTER Y */
+  {0x24b5, 3, 2361}, /* PARENTHESIZED LATIN SMALL LETTER Z */
+  {0x24b6, 1, 24}, /* CIRCLED LATIN CAPITAL LETTER A */
+  {0x24b7, 1, 910}, /* CIRCLED LATIN CAPITAL LETTER B */
+  {0x24b8, 1, 36}, /* CIRCLED LATIN CAPITAL LETTER C */
+  {0x24b9, 1, 158}, /* CIRCLED LATIN CAPITAL LETTER D */
+  {0x24ba, 1, 38}, /* CIRCLED LATIN CAPITAL LETTER E */
+  {0x24bb, 1, 995}, /* CIRCLED LATIN CAPITAL LETTER F */
+  {0x24bc, 1, 182}, /* CIRCLED LATIN CAPITAL LETTER G */
+  {0x24bd, 1, 198}, /* CIRCLED LATIN CAPITAL LETTER H */
+  {0x24be, 1, 46}, /* CIRCLED LATIN CAPITAL LETTER I */
+  {0x24bf, 1, 221}, /* CIRCLED LATIN CAPITAL LETTER J */
+  {0x24c0, 1, 228}, /* CIRCLED LATIN CAPITAL LETTER K */
+  {0x24c1, 1, 232}, /* CIRCLED LATIN CAPITAL LETTER L */
+  {0x24c2, 1, 912}, /* CIRCLED LATIN CAPITAL LETTER M */
+  {0x24c3, 1, 54}, /* CIRCLED LATIN CAPITAL LETTER N */
+  {0x24c4, 1, 56}, /* CIRCLED LATIN CAPITAL LETTER O */
+  {0x24c5, 1, 914}, /* CIRCLED LATIN CAPITAL LETTER P */
+  {0x24c6, 1, 1942}, /* CIRCLED LATIN CAPITAL LETTER Q */
+  {0x24c7, 1, 274}, /* CIRCLED LATIN CAPITAL LETTER R */
+  {0x24c8, 1, 286}, /* CIRCLED LATIN CAPITAL LETTER S */
+  {0x24c9, 1, 302}, /* CIRCLED LATIN CAPITAL LETTER T */
+  {0x24ca, 1, 66}, /* CIRCLED LATIN CAPITAL LETTER U */
+  {0x24cb, 1, 1183}, /* CIRCLED LATIN CAPITAL LETTER V */
+  {0x24cc, 1, 334}, /* CIRCLED LATIN CAPITAL LETTER W */
+  {0x24cd, 1, 1211}, /* CIRCLED LATIN CAPITAL LETTER X */
+  {0x24ce, 1, 74}, /* CIRCLED LATIN CAPITAL LETTER Y */
+  {0x24cf, 1, 344}, /* CIRCLED LATIN CAPITAL LETTER Z */
+  {0x24d0, 1, 3}, /* CIRCLED LATIN SMALL LETTER A */
+  {0x24d1, 1, 918}, /* CIRCLED LATIN SMALL LETTER B */
+  {0x24d2, 1, 88}, /* CIRCLED LATIN SMALL LETTER C */
+  {0x24d3, 1, 160}, /* CIRCLED LATIN SMALL LETTER D */
+  {0x24d4, 1, 90}, /* CIRCLED LATIN SMALL LETTER E */
+  {0x24d5, 1, 997}, /* CIRCLED LATIN SMALL LETTER F */
+  {0x24d6, 1, 184}, /* CIRCLED LATIN SMALL LETTER G */
+  {0x24d7, 1, 200}, /* CIRCLED LATIN SMALL LETTER H */
+  {0x24d8, 1, 98}, /* CIRCLED LATIN SMALL LETTER I */
+  {0x24d9, 1, 223}, /* CIRCLED LATIN SMALL LETTER J */
+  {0x24da, 1, 230}, /* CIRCLED LATIN SMALL LETTER K */
+  {0x24db, 1, 234}, /* CIRCLED LATIN SMALL LETTER L */
+  {0x24dc, 1, 922}, /* CIRCLED LATIN SMALL LETTER M */
+  {0x24dd, 1, 106}, /* CIRCLED LATIN SMALL LETTER N */
+  {0x24de, 1, 14}, /* CIRCLED LATIN SMALL LETTER O */
+  {0x24df, 1, 927}, /* CIRCLED LATIN SMALL LETTER P */
+  {0x24e0, 1, 2335}, /* CIRCLED LATIN SMALL LETTER Q */
+  {0x24e1, 1, 276}, /* CIRCLED LATIN SMALL LETTER R */
+  {0x24e2, 1, 288}, /* CIRCLED LATIN SMALL LETTER S */
+  {0x24e3, 1, 304}, /* CIRCLED LATIN SMALL LETTER T */
+  {0x24e4, 1, 118}, /* CIRCLED LATIN SMALL LETTER U */
+  {0x24e5, 1, 930}, /* CIRCLED LATIN SMALL LETTER V */
+  {0x24e6, 1, 336}, /* CIRCLED LATIN SMALL LETTER W */
+  {0x24e7, 1, 579}, /* CIRCLED LATIN SMALL LETTER X */
+  {0x24e8, 1, 126}, /* CIRCLED LATIN SMALL LETTER Y */
+  {0x24e9, 1, 346}, /* CIRCLED LATIN SMALL LETTER Z */
+  {0x24ea, 1, 1909}, /* CIRCLED DIGIT ZERO */
+  {0x2a0c, 4, 2064}, /* QUADRUPLE INTEGRAL OPERATOR */
+  {0x2a74, 3, 2364}, /* DOUBLE COLON EQUAL */
+  {0x2a75, 2, 2367}, /* TWO CONSECUTIVE EQUALS SIGNS */
+  {0x2a76, 3, 2366}, /* THREE CONSECUTIVE EQUALS SIGNS */
+  {0x2adc, 2, 2369}, /* FORKING */
+  {0x2e9f, 1, 2371}, /* CJK RADICAL MOTHER */
+  {0x2ef3, 1, 2372}, /* CJK RADICAL C-SIMPLIFIED TURTLE */
+  {0x2f00, 1, 2373}, /* KANGXI RADICAL ONE */
+  {0x2f01, 1, 2374}, /* KANGXI RADICAL LINE */
+  {0x2f02, 1, 2375}, /* KANGXI RADICAL DOT */
+  {0x2f03, 1, 2376}, /* KANGXI RADICAL SLASH */
+  {0x2f04, 1, 2377}, /* KANGXI RADICAL SECOND */
+  {0x2f05, 1, 2378}, /* KANGXI RADICAL HOOK */
+  {0x2f06, 1, 2379}, /* KANGXI RADICAL TWO */
+  {0x2f07, 1, 2380}, /* KANGXI RADICAL LID */
+  {0x2f08, 1, 2381}, /* KANGXI RADICAL MAN */
+  {0x2f09, 1, 2382}, /* KANGXI RADICAL LEGS */
+  {0x2f0a, 1, 2383}, /* KANGXI RADICAL ENTER */
+  {0x2f0b, 1, 2384}, /* KANGXI RADICAL EIGHT */
+  {0x2f0c, 1, 2385}, /* KANGXI RADICAL DOWN BOX */
+  {0x2f0d, 1, 2386}, /* KANGXI RADICAL COVER */
+  {0x2f0e, 1, 2387}, /* KANGXI RADICAL ICE */
+  {0x2f0f, 1, 2388}, /* KANGXI RADICAL TABLE */
+  {0x2f10, 1, 2389}, /* KANGXI RADICAL OPEN BOX */
+  {0x2f11, 1, 2390}, /* KANGXI RADICAL KNIFE */
+  {0x2f12, 1, 2391}, /* KANGXI RADICAL POWER */
+  {0x2f13, 1, 2392}, /* KANGXI RADICAL WRAP */
+  {0x2f14, 1, 2393}, /* KANGXI RADICAL SPOON */
+  {0x2f15, 1, 2394}, /* KANGXI RADICAL RIGHT OPEN BOX */
+  {0x2f16, 1, 2395}, /* KANGXI RADICAL HIDING ENCLOSURE */
+  {0x2f17, 1, 2396}, /* KANGXI RADICAL TEN */
+  {0x2f18, 1, 2397}, /* KANGXI RADICAL DIVINATION */
+  {0x2f19, 1, 2398}, /* KANGXI RADICAL SEAL */
+  {0x2f1a, 1, 2399}, /* KANGXI RADICAL CLIFF */
+  {0x2f1b, 1, 2400}, /* KANGXI RADICAL PRIVATE */
+  {0x2f1c, 1, 2401}, /* KANGXI RADICAL AGAIN */
+  {0x2f1d, 1, 2402}, /* KANGXI RADICAL MOUTH */
+  {0x2f1e, 1, 2403}, /* KANGXI RADICAL ENCLOSURE */
+  {0x2f1f, 1, 2404}, /* KANGXI RADICAL EARTH */
+  {0x2f20, 1, 2405}, /* KANGXI RADICAL SCHOLAR */
+  {0x2f21, 1, 2406}, /* KANGXI RADICAL GO */
+  {0x2f22, 1, 2407}, /* KANGXI RADICAL GO SLOWLY */
+  {0x2f23, 1, 2408}, /* KANGXI RADICAL EVENING */
+  {0x2f24, 1, 2409}, /* KANGXI RADICAL BIG */
+  {0x2f25, 1, 2410}, /* KANGXI RADICAL WOMAN */
+  {0x2f26, 1, 2411}, /* KANGXI RADICAL CHILD */
+  {0x2f27, 1, 2412}, /* KANGXI RADICAL ROOF */
+  {0x2f28, 1, 2413}, /* KANGXI RADICAL INCH */
+  {0x2f29, 1, 2414}, /* KANGXI RADICAL SMALL */
+  {0x2f2a, 1, 2415}, /* KANGXI RADICAL LAME */
+  {0x2f2b, 1, 2416}, /* KANGXI RADICAL CORPSE */
+  {0x2f2c, 1, 2417}, /* KANGXI RADICAL SPROUT */
+  {0x2f2d, 1, 2418}, /* KANGXI RADICAL MOUNTAIN */
+  {0x2f2e, 1, 2419}, /* KANGXI RADICAL RIVER */
+  {0x2f2f, 1, 2420}, /* KANGXI RADICAL WORK */
+  {0x2f30, 1, 2421}, /* KANGXI RADICAL ONESELF */
+  {0x2f31, 1, 2422}, /* KANGXI RADICAL TURBAN */
+  {0x2f32, 1, 2423}, /* KANGXI RADICAL DRY */
+  {0x2f33, 1, 2424}, /* KANGXI RADICAL SHORT THREAD */
+  {0x2f34, 1, 2425}, /* KANGXI RADICAL DOTTED CLIFF */
+  {0x2f35, 1, 2426}, /* KANGXI RADICAL LONG STRIDE */
+  {0x2f36, 1, 2427}, /* KANGXI RADICAL TWO HANDS */
+  {0x2f37, 1, 2428}, /* KANGXI RADICAL SHOOT */
+  {0x2f38, 1, 2429}, /* KANGXI RADICAL BOW */
+  {0x2f39, 1, 2430}, /* KANGXI RADICAL SNOUT */
+  {0x2f3a, 1, 2431}, /* KANGXI RADICAL BRISTLE */
+  {0x2f3b, 1, 2432}, /* KANGXI RADICAL STEP */
+  {0x2f3c, 1, 2433}, /* KANGXI RADICAL HEART */
+  {0x2f3d, 1, 2434}, /* KANGXI RADICAL HALBERD */
+  {0x2f3e, 1, 2435}, /* KANGXI RADICAL DOOR */
+  {0x2f3f, 1, 2436}, /* KANGXI RADICAL HAND */
+  {0x2f40, 1, 2437}, /* KANGXI RADICAL BRANCH */
+  {0x2f41, 1, 2438}, /* KANGXI RADICAL RAP */
+  {0x2f42, 1, 2439}, /* KANGXI RADICAL SCRIPT */
+  {0x2f43, 1, 2440}, /* KANGXI RADICAL DIPPER */
+  {0x2f44, 1, 2441}, /* KANGXI RADICAL AXE */
+  {0x2f45, 1, 2442}, /* KANGXI RADICAL SQUARE */
+  {0x2f46, 1, 2443}, /* KANGXI RADICAL NOT */
+  {0x2f47, 1, 2444}, /* KANGXI RADICAL SUN */
+  {0x2f48, 1, 2445}, /* KANGXI RADICAL SAY */
+  {0x2f49, 1, 2446}, /* KANGXI RADICAL MOON */
+  {0x2f4a, 1, 2447}, /* KANGXI RADICAL TREE */
+  {0x2f4b, 1, 2448}, /* KANGXI RADICAL LACK */
+  {0x2f4c, 1, 2449}, /* KANGXI RADICAL STOP */
+  {0x2f4d, 1, 2450}, /* KANGXI RADICAL DEATH */
+  {0x2f4e, 1, 2451}, /* KANGXI RADICAL WEAPON */
+  {0x2f4f, 1, 2452}, /* KANGXI RADICAL DO NOT */
+  {0x2f50, 1, 2453}, /* KANGXI RADICAL COMPARE */
+  {0x2f51, 1, 2454}, /* KANGXI RADICAL FUR */
+  {0x2f52, 1, 2455}, /* KANGXI RADICAL CLAN */
+  {0x2f53, 1, 2456}, /* KANGXI RADICAL STEAM */
+  {0x2f54, 1, 2457}, /* KANGXI RADICAL WATER */
+  {0x2f55, 1, 2458}, /* KANGXI RADICAL FIRE */
+  {0x2f56, 1, 2459}, /* KANGXI RADICAL CLAW */
+  {0x2f57, 1, 2460}, /* KANGXI RADICAL FATHER */
+  {0x2f58, 1, 2461}, /* KANGXI RADICAL DOUBLE X */
+  {0x2f59, 1, 2462}, /* KANGXI RADICAL HALF TREE TRUNK */
+  {0x2f5a, 1, 2463}, /* KANGXI RADICAL SLICE */
+  {0x2f5b, 1, 2464}, /* KANGXI RADICAL FANG */
+  {0x2f5c, 1, 2465}, /* KANGXI RADICAL COW */
+  {0x2f5d, 1, 2466}, /* KANGXI RADICAL DOG */
+  {0x2f5e, 1, 2467}, /* KANGXI RADICAL PROFOUND */
+  {0x2f5f, 1, 2468}, /* KANGXI RADICAL JADE */
+  {0x2f60, 1, 2469}, /* KANGXI RADICAL MELON */
+  {0x2f61, 1, 2470}, /* KANGXI RADICAL TILE */
+  {0x2f62, 1, 2471}, /* KANGXI RADICAL SWEET */
+  {0x2f63, 1, 2472}, /* KANGXI RADICAL LIFE */
+  {0x2f64, 1, 2473}, /* KANGXI RADICAL USE */
+  {0x2f65, 1, 2474}, /* KANGXI RADICAL FIELD */
+  {0x2f66, 1, 2475}, /* KANGXI RADICAL BOLT OF CLOTH */
+  {0x2f67, 1, 2476}, /* KANGXI RADICAL SICKNESS */
+  {0x2f68, 1, 2477}, /* KANGXI RADICAL DOTTED TENT */
+  {0x2f69, 1, 2478}, /* KANGXI RADICAL WHITE */
+  {0x2f6a, 1, 2479}, /* KANGXI RADICAL SKIN */
+  {0x2f6b, 1, 2480}, /* KANGXI RADICAL DISH */
+  {0x2f6c, 1, 2481}, /* KANGXI RADICAL EYE */
+  {0x2f6d, 1, 2482}, /* KANGXI RADICAL SPEAR */
+  {0x2f6e, 1, 2483}, /* KANGXI RADICAL ARROW */
+  {0x2f6f, 1, 2484}, /* KANGXI RADICAL STONE */
+  {0x2f70, 1, 2485}, /* KANGXI RADICAL SPIRIT */
+  {0x2f71, 1, 2486}, /* KANGXI RADICAL TRACK */
+  {0x2f72, 1, 2487}, /* KANGXI RADICAL GRAIN */
+  {0x2f73, 1, 2488}, /* KANGXI RADICAL CAVE */
+  {0x2f74, 1, 2489}, /* KANGXI RADICAL STAND */
+  {0x2f75, 1, 2490}, /* KANGXI RADICAL BAMBOO */
+  {0x2f76, 1, 2491}, /* KANGXI RADICAL RICE */
+  {0x2f77, 1, 2492}, /* KANGXI RADICAL SILK */
+  {0x2f78, 1, 2493}, /* KANGXI RADICAL JAR */
+  {0x2f79, 1, 2494}, /* KANGXI RADICAL NET */
+  {0x2f7a, 1, 2495}, /* KANGXI RADICAL SHEEP */
+  {0x2f7b, 1, 2496}, /* KANGXI RADICAL FEATHER */
+  {0x2f7c, 1, 2497}, /* KANGXI RADICAL OLD */
+  {0x2f7d, 1, 2498}, /* KANGXI RADICAL AND */
+  {0x2f7e, 1, 2499}, /* KANGXI RADICAL PLOW */
+  {0x2f7f, 1, 2500}, /* KANGXI RADICAL EAR */
+  {0x2f80, 1, 2501}, /* KANGXI RADICAL BRUSH */
+  {0x2f81, 1, 2502}, /* KANGXI RADICAL MEAT */
+  {0x2f82, 1, 2503}, /* KANGXI RADICAL MINISTER */
+  {0x2f83, 1, 2504}, /* KANGXI RADICAL SELF */
+  {0x2f84, 1, 2505}, /* KANGXI RADICAL ARRIVE */
+  {0x2f85, 1, 2506}, /* KANGXI RADICAL MORTAR */
+  {0x2f86, 1, 2507}, /* KANGXI RADICAL TONGUE */
+  {0x2f87, 1, 2508}, /* KANGXI RADICAL OPPOSE */
+  {0x2f88, 1, 2509}, /* KANGXI RADICAL BOAT */
+  {0x2f89, 1, 2510}, /* KANGXI RADICAL STOPPING */
+  {0x2f8a, 1, 2511}, /* KANGXI RADICAL COLOR */
+  {0x2f8b, 1, 2512}, /* KANGXI RADICAL GRASS */
+  {0x2f8c, 1, 2513}, /* KANGXI RADICAL TIGER */
+  {0x2f8d, 1, 2514}, /* KANGXI RADICAL INSECT */
+  {0x2f8e, 1, 2515}, /* KANGXI RADICAL BLOOD */
+  {0x2f8f, 1, 2516}, /* KANGXI RADICAL WALK ENCLOSURE */
+  {0x2f90, 1, 2517}, /* KANGXI RADICAL CLOTHES */
+  {0x2f91, 1, 2518}, /* KANGXI RADICAL WEST */
+  {0x2f92, 1, 2519}, /* KANGXI RADICAL SEE */
+  {0x2f93, 1, 2520}, /* KANGXI RADICAL HORN */
+  {0x2f94, 1, 2521}, /* KANGXI RADICAL SPEECH */
+  {0x2f95, 1, 2522}, /* KANGXI RADICAL VALLEY */
+  {0x2f96, 1, 2523}, /* KANGXI RADICAL BEAN */
+  {0x2f97, 1, 2524}, /* KANGXI RADICAL PIG */
+  {0x2f98, 1, 2525}, /* KANGXI RADICAL BADGER */
+  {0x2f99, 1, 2526}, /* KANGXI RADICAL SHELL */
+  {0x2f9a, 1, 2527}, /* KANGXI RADICAL RED */
+  {0x2f9b, 1, 2528}, /* KANGXI RADICAL RUN */
+  {0x2f9c, 1, 2529}, /* KANGXI RADICAL FOOT */
+  {0x2f9d, 1, 2530}, /* KANGXI RADICAL BODY */
+  {0x2f9e, 1, 2531}, /* KANGXI RADICAL CART */
+  {0x2f9f, 1, 2532}, /* KANGXI RADICAL BITTER */
+  {0x2fa0, 1, 2533}, /* KANGXI RADICAL MORNING */
+  {0x2fa1, 1, 2534}, /* KANGXI RADICAL WALK */
+  {0x2fa2, 1, 2535}, /* KANGXI RADICAL CITY */
+  {0x2fa3, 1, 2536}, /* KANGXI RADICAL WINE */
+  {0x2fa4, 1, 2537}, /* KANGXI RADICAL DISTINGUISH */
+  {0x2fa5, 1, 2538}, /* KANGXI RADICAL VILLAGE */
+  {0x2fa6, 1, 2539}, /* KANGXI RADICAL GOLD */
+  {0x2fa7, 1, 2540}, /* KANGXI RADICAL LONG */
+  {0x2fa8, 1, 2541}, /* KANGXI RADICAL GATE */
+  {0x2fa9, 1, 2542}, /* KANGXI RADICAL MOUND */
+  {0x2faa, 1, 2543}, /* KANGXI RADICAL SLAVE */
+  {0x2fab, 1, 2544}, /* KANGXI RADICAL SHORT TAILED BIRD */
+  {0x2fac, 1, 2545}, /* KANGXI RADICAL RAIN */
+  {0x2fad, 1, 2546}, /* KANGXI RADICAL BLUE */
+  {0x2fae, 1, 2547}, /* KANGXI RADICAL WRONG */
+  {0x2faf, 1, 2548}, /* KANGXI RADICAL FACE */
+  {0x2fb0, 1, 2549}, /* KANGXI RADICAL LEATHER */
+  {0x2fb1, 1, 2550}, /* KANGXI RADICAL TANNED LEATHER */
+  {0x2fb2, 1, 2551}, /* KANGXI RADICAL LEEK */
+  {0x2fb3, 1, 2552}, /* KANGXI RADICAL SOUND */
+  {0x2fb4, 1, 2553}, /* KANGXI RADICAL LEAF */
+  {0x2fb5, 1, 2554}, /* KANGXI RADICAL WIND */
+  {0x2fb6, 1, 2555}, /* KANGXI RADICAL FLY */
+  {0x2fb7, 1, 2556}, /* KANGXI RADICAL EAT */
+  {0x2fb8, 1, 2557}, /* KANGXI RADICAL HEAD */
+  {0x2fb9, 1, 2558}, /* KANGXI RADICAL FRAGRANT */
+  {0x2fba, 1, 2559}, /* KANGXI RADICAL HORSE */
+  {0x2fbb, 1, 2560}, /* KANGXI RADICAL BONE */
+  {0x2fbc, 1, 2561}, /* KANGXI RADICAL TALL */
+  {0x2fbd, 1, 2562}, /* KANGXI RADICAL HAIR */
+  {0x2fbe, 1, 2563}, /* KANGXI RADICAL FIGHT */
+  {0x2fbf, 1, 2564}, /* KANGXI RADICAL SACRIFICIAL WINE */
+  {0x2fc0, 1, 2565}, /* KANGXI RADICAL CAULDRON */
+  {0x2fc1, 1, 2566}, /* KANGXI RADICAL GHOST */
+  {0x2fc2, 1, 2567}, /* KANGXI RADICAL FISH */
+  {0x2fc3, 1, 2568}, /* KANGXI RADICAL BIRD */
+  {0x2fc4, 1, 2569}, /* KANGXI RADICAL SALT */
+  {0x2fc5, 1, 2570}, /* KANGXI RADICAL DEER */
+  {0x2fc6, 1, 2571}, /* KANGXI RADICAL WHEAT */
+  {0x2fc7, 1, 2572}, /* KANGXI RADICAL HEMP */
+  {0x2fc8, 1, 2573}, /* KANGXI RADICAL YELLOW */
+  {0x2fc9, 1, 2574}, /* KANGXI RADICAL MILLET */
+  {0x2fca, 1, 2575}, /* KANGXI RADICAL BLACK */
+  {0x2fcb, 1, 2576}, /* KANGXI RADICAL EMBROIDERY */
+  {0x2fcc, 1, 2577}, /* KANGXI RADICAL FROG */
+  {0x2fcd, 1, 2578}, /* KANGXI RADICAL TRIPOD */
+  {0x2fce, 1, 2579}, /* KANGXI RADICAL DRUM */
+  {0x2fcf, 1, 2580}, /* KANGXI RADICAL RAT */
+  {0x2fd0, 1, 2581}, /* KANGXI RADICAL NOSE */
+  {0x2fd1, 1, 2582}, /* KANGXI RADICAL EVEN */
+  {0x2fd2, 1, 2583}, /* KANGXI RADICAL TOOTH */
+  {0x2fd3, 1, 2584}, /* KANGXI RADICAL DRAGON */
+  {0x2fd4, 1, 2585}, /* KANGXI RADICAL TURTLE */
+  {0x2fd5, 1, 2586}, /* KANGXI RADICAL FLUTE */
+  {0x3000, 1, 2587}, /* IDEOGRAPHIC SPACE */
+  {0x3036, 1, 2588}, /* CIRCLED POSTAL MARK */
+  {0x3038, 1, 2396}, /* HANGZHOU NUMERAL TEN */
+  {0x3039, 1, 2589}, /* HANGZHOU NUMERAL TWENTY */
+  {0x303a, 1, 2590}, /* HANGZHOU NUMERAL THIRTY */
+  {0x304c, 2, 2591}, /* HIRAGANA LETTER GA */
+  {0x304e, 2, 2593}, /* HIRAGANA LETTER GI */
+  {0x3050, 2, 2595}, /* HIRAGANA LETTER GU */
+  {0x3052, 2, 2597}, /* HIRAGANA LETTER GE */
+  {0x3054, 2, 2599}, /* HIRAGANA LETTER GO */
+  {0x3056, 2, 2601}, /* HIRAGANA LETTER ZA */
+  {0x3058, 2, 2603}, /* HIRAGANA LETTER ZI */
+  {0x305a, 2, 2605}, /* HIRAGANA LETTER ZU */
+  {0x305c, 2, 2607}, /* HIRAGANA LETTER ZE */
+  {0x305e, 2, 2609}, /* HIRAGANA LETTER ZO */
+  {0x3060, 2, 2611}, /* HIRAGANA LETTER DA */
+  {0x3062, 2, 2613}, /* HIRAGANA LETTER DI */
+  {0x3065, 2, 2615}, /* HIRAGANA LETTER DU */
+  {0x3067, 2, 2617}, /* HIRAGANA LETTER DE */
+  {0x3069, 2, 2619}, /* HIRAGANA LETTER DO */
+  {0x3070, 2, 2621}, /* HIRAGANA LETTER BA */
+  {0x3071, 2, 2623}, /* HIRAGANA LETTER PA */
+  {0x3073, 2, 2625}, /* HIRAGANA LETTER BI */
+  {0x3074, 2, 2627}, /* HIRAGANA LETTER PI */
+  {0x3076, 2, 2629}, /* HIRAGANA LETTER BU */
+  {0x3077, 2, 2631}, /* HIRAGANA LETTER PU */
+  {0x3079, 2, 2633}, /* HIRAGANA LETTER BE */
+  {0x307a, 2, 2635}, /* HIRAGANA LETTER PE */
+  {0x307c, 2, 2637}, /* HIRAGANA LETTER BO */
+  {0x307d, 2, 2639}, /* HIRAGANA LETTER PO */
+  {0x3094, 2, 2641}, /* HIRAGANA LETTER VU */
+  {0x309b, 2, 2643}, /* KATAKANA-HIRAGANA VOICED SOUND MARK */
+  {0x309c, 2, 2645}, /* KATAKANA-HIRAGANA SEMI-VOICED SOUND MARK */
+  {0x309e, 2, 2647}, /* HIRAGANA VOICED ITERATION MARK */
+  {0x309f, 2, 2649}, /* HIRAGANA DIGRAPH YORI */
+  {0x30ac, 2, 2651}, /* KATAKANA LETTER GA */
+  {0x30ae, 2, 2653}, /* KATAKANA LETTER GI */
+  {0x30b0, 2, 2655}, /* KATAKANA LETTER GU */
+  {0x30b2, 2, 2657}, /* KATAKANA LETTER GE */
+  {0x30b4, 2, 2659}, /* KATAKANA LETTER GO */
+  {0x30b6, 2, 2661}, /* KATAKANA LETTER ZA */
+  {0x30b8, 2, 2663}, /* KATAKANA LETTER ZI */
+  {0x30ba, 2, 2665}, /* KATAKANA LETTER ZU */
+  {0x30bc, 2, 2667}, /* KATAKANA LETTER ZE */
+  {0x30be, 2, 2669}, /* KATAKANA LETTER ZO */
+  {0x30c0, 2, 2671}, /* KATAKANA LETTER DA */
+  {0x30c2, 2, 2673}, /* KATAKANA LETTER DI */
+  {0x30c5, 2, 2675}, /* KATAKANA LETTER DU */
+  {0x30c7, 2, 2677}, /* KATAKANA LETTER DE */
+  {0x30c9, 2, 2679}, /* KATAKANA LETTER DO */
+  {0x30d0, 2, 2681}, /* KATAKANA LETTER BA */
+  {0x30d1, 2, 2683}, /* KATAKANA LETTER PA */
+  {0x30d3, 2, 2685}, /* KATAKANA LETTER BI */
+  {0x30d4, 2, 2687}, /* KATAKANA LETTER PI */
+  {0x30d6, 2, 2689}, /* KATAKANA LETTER BU */
+  {0x30d7, 2, 2691}, /* KATAKANA LETTER PU */
+  {0x30d9, 2, 2693}, /* KATAKANA LETTER BE */
+  {0x30da, 2, 2695}, /* KATAKANA LETTER PE */
+  {0x30dc, 2, 2697}, /* KATAKANA LETTER BO */
+  {0x30dd, 2, 2699}, /* KATAKANA LETTER PO */
+  {0x30f4, 2, 2701}, /* KATAKANA LETTER VU */
+  {0x30f7, 2, 2703}, /* KATAKANA LETTER VA */
+  {0x30f8, 2, 2705}, /* KATAKANA LETTER VI */
+  {0x30f9, 2, 2707}, /* KATAKANA LETTER VE */
+  {0x30fa, 2, 2709}, /* KATAKANA LETTER VO */
+  {0x30fe, 2, 2711}, /* KATAKANA VOICED ITERATION MARK */
+  {0x30ff, 2, 2713}, /* KATAKANA DIGRAPH KOTO */
+  {0x3131, 1, 2715}, /* HANGUL LETTER KIYEOK */
+  {0x3132, 1, 2716}, /* HANGUL LETTER SSANGKIYEOK */
+  {0x3133, 1, 2717}, /* HANGUL LETTER KIYEOK-SIOS */
+  {0x3134, 1, 2718}, /* HANGUL LETTER NIEUN */
+  {0x3135, 1, 2719}, /* HANGUL LETTER NIEUN-CIEUC */
+  {0x3136, 1, 2720}, /* HANGUL LETTER NIEUN-HIEUH */
+  {0x3137, 1, 2721}, /* HANGUL LETTER TIKEUT */
+  {0x3138, 1, 2722}, /* HANGUL LETTER SSANGTIKEUT */
+  {0x3139, 1, 2723}, /* HANGUL LETTER RIEUL */
+  {0x313a, 1, 2724}, /* HANGUL LETTER RIEUL-KIYEOK */
+  {0x313b, 1, 2725}, /* HANGUL LETTER RIEUL-MIEUM */
+  {0x313c, 1, 2726}, /* HANGUL LETTER RIEUL-PIEUP */
+  {0x313d, 1, 2727}, /* HANGUL LETTER RIEUL-SIOS */
+  {0x313e, 1, 2728}, /* HANGUL LETTER RIEUL-THIEUTH */
+  {0x313f, 1, 2729}, /* HANGUL LETTER RIEUL-PHIEUPH */
+  {0x3140, 1, 2730}, /* HANGUL LETTER RIEUL-HIEUH */
+  {0x3141, 1, 2731}, /* HANGUL LETTER MIEUM */
+  {0x3142, 1, 2732}, /* HANGUL LETTER PIEUP */
+  {0x3143, 1, 2733}, /* HANGUL LETTER SSANGPIEUP */
+  {0x3144, 1, 2734}, /* HANGUL LETTER PIEUP-SIOS */
+  {0x3145, 1, 2735}, /* HANGUL LETTER SIOS */
+  {0x3146, 1, 2736}, /* HANGUL LETTER SSANGSIOS */
+  {0x3147, 1, 2737}, /* HANGUL LETTER IEUNG */
+  {0x3148, 1, 2738}, /* HANGUL LETTER CIEUC */
+  {0x3149, 1, 2739}, /* HANGUL LETTER SSANGCIEUC */
+  {0x314a, 1, 2740}, /* HANGUL LETTER CHIEUCH */
+  {0x314b, 1, 2741}, /* HANGUL LETTER KHIEUKH */
+  {0x314c, 1, 2742}, /* HANGUL LETTER THIEUTH */
+  {0x314d, 1, 2743}, /* HANGUL LETTER PHIEUPH */
+  {0x314e, 1, 2744}, /* HANGUL LETTER HIEUH */
+  {0x314f, 1, 2745}, /* HANGUL LETTER A */
+  {0x3150, 1, 2746}, /* HANGUL LETTER AE */
+  {0x3151, 1, 2747}, /* HANGUL LETTER YA */
+  {0x3152, 1, 2748}, /* HANGUL LETTER YAE */
+  {0x3153, 1, 2749}, /* HANGUL LETTER EO */
+  {0x3154, 1, 2750}, /* HANGUL LETTER E */
+  {0x3155, 1, 2751}, /* HANGUL LETTER YEO */
+  {0x3156, 1, 2752}, /* HANGUL LETTER YE */
+  {0x3157, 1, 2753}, /* HANGUL LETTER O */
+  {0x3158, 1, 2754}, /* HANGUL LETTER WA */
+  {0x3159, 1, 2755}, /* HANGUL LETTER WAE */
+  {0x315a, 1, 2756}, /* HANGUL LETTER OE */
+  {0x315b, 1, 2757}, /* HANGUL LETTER YO */
+  {0x315c, 1, 2758}, /* HANGUL LETTER U */
+  {0x315d, 1, 2759}, /* HANGUL LETTER WEO */
+  {0x315e, 1, 2760}, /* HANGUL LETTER WE */
+  {0x315f, 1, 2761}, /* HANGUL LETTER WI */
+  {0x3160, 1, 2762}, /* HANGUL LETTER YU */
+  {0x3161, 1, 2763}, /* HANGUL LETTER EU */
+  {0x3162, 1, 2764}, /* HANGUL LETTER YI */
+  {0x3163, 1, 2765}, /* HANGUL LETTER I */
+  {0x3164, 1, 2766}, /* HANGUL FILLER */
+  {0x3165, 1, 2767}, /* HANGUL LETTER SSANGNIEUN */
+  {0x3166, 1, 2768}, /* HANGUL LETTER NIEUN-TIKEUT */
+  {0x3167, 1, 2769}, /* HANGUL LETTER NIEUN-SIOS */
+  {0x3168, 1, 2770}, /* HANGUL LETTER NIEUN-PANSIOS */
+  {0x3169, 1, 2771}, /* HANGUL LETTER RIEUL-KIYEOK-SIOS */
+  {0x316a, 1, 2772}, /* HANGUL LETTER RIEUL-TIKEUT */
+  {0x316b, 1, 2773}, /* HANGUL LETTER RIEUL-PIEUP-SIOS */
+  {0x316c, 1, 2774}, /* HANGUL LETTER RIEUL-PANSIOS */
+  {0x316d, 1, 2775}, /* HANGUL LETTER RIEUL-YEORINHIEUH */
+  {0x316e, 1, 2776}, /* HANGUL LETTER MIEUM-PIEUP */
+  {0x316f, 1, 2777}, /* HANGUL LETTER MIEUM-SIOS */
+  {0x3170, 1, 2778}, /* HANGUL LETTER MIEUM-PANSIOS */
+  {0x3171, 1, 2779}, /* HANGUL LETTER KAPYEOUNMIEUM */
+  {0x3172, 1, 2780}, /* HANGUL LETTER PIEUP-KIYEOK */
+  {0x3173, 1, 2781}, /* HANGUL LETTER PIEUP-TIKEUT */
+  {0x3174, 1, 2782}, /* HANGUL LETTER PIEUP-SIOS-KIYEOK */
+  {0x3175, 1, 2783}, /* HANGUL LETTER PIEUP-SIOS-TIKEUT */
+  {0x3176, 1, 2784}, /* HANGUL LETTER PIEUP-CIEUC */
+  {0x3177, 1, 2785}, /* HANGUL LETTER PIEUP-THIEUTH */
+  {0x3178, 1, 2786}, /* HANGUL LETTER KAPYEOUNPIEUP */
+  {0x3179, 1, 2787}, /* HANGUL LETTER KAPYEOUNSSANGPIEUP */
+  {0x317a, 1, 2788}, /* HANGUL LETTER SIOS-KIYEOK */
+  {0x317b, 1, 2789}, /* HANGUL LETTER SIOS-NIEUN */
+  {0x317c, 1, 2790}, /* HANGUL LETTER SIOS-TIKEUT */
+  {0x317d, 1, 2791}, /* HANGUL LETTER SIOS-PIEUP */
+  {0x317e, 1, 2792}, /* HANGUL LETTER SIOS-CIEUC */
+  {0x317f, 1, 2793}, /* HANGUL LETTER PANSIOS */
+  {0x3180, 1, 2794}, /* HANGUL LETTER SSANGIEUNG */
+  {0x3181, 1, 2795}, /* HANGUL LETTER YESIEUNG */
+  {0x3182, 1, 2796}, /* HANGUL LETTER YESIEUNG-SIOS */
+  {0x3183, 1, 2797}, /* HANGUL LETTER YESIEUNG-PANSIOS */
+  {0x3184, 1, 2798}, /* HANGUL LETTER KAPYEOUNPHIEUPH */
+  {0x3185, 1, 2799}, /* HANGUL LETTER SSANGHIEUH */
+  {0x3186, 1, 2800}, /* HANGUL LETTER YEORINHIEUH */
+  {0x3187, 1, 2801}, /* HANGUL LETTER YO-YA */
+  {0x3188, 1, 2802}, /* HANGUL LETTER YO-YAE */
+  {0x3189, 1, 2803}, /* HANGUL LETTER YO-I */
+  {0x318a, 1, 2804}, /* HANGUL LETTER YU-YEO */
+  {0x318b, 1, 2805}, /* HANGUL LETTER YU-YE */
+  {0x318c, 1, 2806}, /* HANGUL LETTER YU-I */
+  {0x318d, 1, 2807}, /* HANGUL LETTER ARAEA */
+  {0x318e, 1, 2808}, /* HANGUL LETTER ARAEAE */
+  {0x3192, 1, 2373}, /* IDEOGRAPHIC ANNOTATION ONE MARK */
+  {0x3193, 1, 2379}, /* IDEOGRAPHIC ANNOTATION TWO MARK */
+  {0x3194, 1, 2809}, /* IDEOGRAPHIC ANNOTATION THREE MARK */
+  {0x3195, 1, 2810}, /* IDEOGRAPHIC ANNOTATION FOUR MARK */
+  {0x3196, 1, 2811}, /* IDEOGRAPHIC ANNOTATION TOP MARK */
+  {0x3197, 1, 2812}, /* IDEOGRAPHIC ANNOTATION MIDDLE MARK */
+  {0x3198, 1, 2813}, /* IDEOGRAPHIC ANNOTATION BOTTOM MARK */
+  {0x3199, 1, 2814}, /* IDEOGRAPHIC ANNOTATION FIRST MARK */
+  {0x319a, 1, 2377}, /* IDEOGRAPHIC ANNOTATION SECOND MARK */
+  {0x319b, 1, 2815}, /* IDEOGRAPHIC ANNOTATION THIRD MARK */
+  {0x319c, 1, 2816}, /* IDEOGRAPHIC ANNOTATION FOURTH MARK */
+  {0x319d, 1, 2817}, /* IDEOGRAPHIC ANNOTATION HEAVEN MARK */
+  {0x319e, 1, 2818}, /* IDEOGRAPHIC ANNOTATION EARTH MARK */
+  {0x319f, 1, 2381}, /* IDEOGRAPHIC ANNOTATION MAN MARK */
+  {0x3200, 3, 2819}, /* PARENTHESIZED HANGUL KIYEOK */
+  {0x3201, 3, 2822}, /* PARENTHESIZED HANGUL NIEUN */
+  {0x3202, 3, 2825}, /* PARENTHESIZED HANGUL TIKEUT */
+  {0x3203, 3, 2828}, /* PARENTHESIZED HANGUL RIEUL */
+  {0x3204, 3, 2831}, /* PARENTHESIZED HANGUL MIEUM */
+  {0x3205, 3, 2834}, /* PARENTHESIZED HANGUL PIEUP */
+  {0x3206, 3, 2837}, /* PARENTHESIZED HANGUL SIOS */
+  {0x3207, 3, 2840}, /* PARENTHESIZED HANGUL IEUNG */
+  {0x3208, 3, 2843}, /* PARENTHESIZED HANGUL CIEUC */
+  {0x3209, 3, 2846}, /* PARENTHESIZED HANGUL CHIEUCH */
+  {0x320a, 3, 2849}, /* PARENTHESIZED HANGUL KHIEUKH */
+  {0x320b, 3, 2852}, /* PARENTHESIZED HANGUL THIEUTH */
+  {0x320c, 3, 2855}, /* PARENTHESIZED HANGUL PHIEUPH */
+  {0x320d, 3, 2858}, /* PARENTHESIZED HANGUL HIEUH */
+  {0x320e, 4, 2861}, /* PARENTHESIZED HANGUL KIYEOK A */
+  {0x320f, 4, 2865}, /* PARENTHESIZED HANGUL NIEUN A */
+  {0x3210, 4, 2869}, /* PARENTHESIZED HANGUL TIKEUT A */
+  {0x3211, 4, 2873}, /* PARENTHESIZED HANGUL RIEUL A */
+  {0x3212, 4, 2877}, /* PARENTHESIZED HANGUL MIEUM A */
+  {0x3213, 4, 2881}, /* PARENTHESIZED HANGUL PIEUP A */
+  {0x3214, 4, 2885}, /* PARENTHESIZED HANGUL SIOS A */
+  {0x3215, 4, 2889}, /* PARENTHESIZED HANGUL IEUNG A */
+  {0x3216, 4, 2893}, /* PARENTHESIZED HANGUL CIEUC A */
+  {0x3217, 4, 2897}, /* PARENTHESIZED HANGUL CHIEUCH A */
+  {0x3218, 4, 2901}, /* PARENTHESIZED HANGUL KHIEUKH A */
+  {0x3219, 4, 2905}, /* PARENTHESIZED HANGUL THIEUTH A */
+  {0x321a, 4, 2909}, /* PARENTHESIZED HANGUL PHIEUPH A */
+  {0x321b, 4, 2913}, /* PARENTHESIZED HANGUL HIEUH A */
+  {0x321c, 4, 2917}, /* PARENTHESIZED HANGUL CIEUC U */
+  {0x321d, 7, 2921}, /* PARENTHESIZED KOREAN CHARACTER OJEON */
+  {0x321e, 6, 2928}, /* PARENTHESIZED KOREAN CHARACTER O HU */
+  {0x3220, 3, 2934}, /* PARENTHESIZED IDEOGRAPH ONE */
+  {0x3221, 3, 2937}, /* PARENTHESIZED IDEOGRAPH TWO */
+  {0x3222, 3, 2940}, /* PARENTHESIZED IDEOGRAPH THREE */
+  {0x3223, 3, 2943}, /* PARENTHESIZED IDEOGRAPH FOUR */
+  {0x3224, 3, 2946}, /* PARENTHESIZED IDEOGRAPH FIVE */
+  {0x3225, 3, 2949}, /* PARENTHESIZED IDEOGRAPH SIX */
+  {0x3226, 3, 2952}, /* PARENTHESIZED IDEOGRAPH SEVEN */
+  {0x3227, 3, 2955}, /* PARENTHESIZED IDEOGRAPH EIGHT */
+  {0x3228, 3, 2958}, /* PARENTHESIZED IDEOGRAPH NINE */
+  {0x3229, 3, 2961}, /* PARENTHESIZED IDEOGRAPH TEN */
+  {0x322a, 3, 2964}, /* PARENTHESIZED IDEOGRAPH MOON */
+  {0x322b, 3, 2967}, /* PARENTHESIZED IDEOGRAPH FIRE */
+  {0x322c, 3, 2970}, /* PARENTHESIZED IDEOGRAPH WATER */
+  {0x322d, 3, 2973}, /* PARENTHESIZED IDEOGRAPH WOOD */
+  {0x322e, 3, 2976}, /* PARENTHESIZED IDEOGRAPH METAL */
+  {0x322f, 3, 2979}, /* PARENTHESIZED IDEOGRAPH EARTH */
+  {0x3230, 3, 2982}, /* PARENTHESIZED IDEOGRAPH SUN */
+  {0x3231, 3, 2985}, /* PARENTHESIZED IDEOGRAPH STOCK */
+  {0x3232, 3, 2988}, /* PARENTHESIZED IDEOGRAPH HAVE */
+  {0x3233, 3, 2991}, /* PARENTHESIZED IDEOGRAPH SOCIETY */
+  {0x3234, 3, 2994}, /* PARENTHESIZED IDEOGRAPH NAME */
+  {0x3235, 3, 2997}, /* PARENTHESIZED IDEOGRAPH SPECIAL */
+  {0x3236, 3, 3000}, /* PARENTHESIZED IDEOGRAPH FINANCIAL */
+  {0x3237, 3, 3003}, /* PARENTHESIZED IDEOGRAPH CONGRATULATION */
+  {0x3238, 3, 3006}, /* PARENTHESIZED IDEOGRAPH LABOR */
+  {0x3239, 3, 3009}, /* PARENTHESIZED IDEOGRAPH REPRESENT */
+  {0x323a, 3, 3012}, /* PARENTHESIZED IDEOGRAPH CALL */
+  {0x323b, 3, 3015}, /* PARENTHESIZED IDEOGRAPH STUDY */
+  {0x323c, 3, 3018}, /* PARENTHESIZED IDEOGRAPH SUPERVISE */
+  {0x323d, 3, 3021}, /* PARENTHESIZED IDEOGRAPH ENTERPRISE */
+  {0x323e, 3, 3024}, /* PARENTHESIZED IDEOGRAPH RESOURCE */
+  {0x323f, 3, 3027}, /* PARENTHESIZED IDEOGRAPH ALLIANCE */
+  {0x3240, 3, 3030}, /* PARENTHESIZED IDEOGRAPH FESTIVAL */
+  {0x3241, 3, 3033}, /* PARENTHESIZED IDEOGRAPH REST */
+  {0x3242, 3, 3036}, /* PARENTHESIZED IDEOGRAPH SELF */
+  {0x3243, 3, 3039}, /* PARENTHESIZED IDEOGRAPH REACH */
+  {0x3250, 3, 3042}, /* PARTNERSHIP SIGN */
+  {0x3251, 2, 2147}, /* CIRCLED NUMBER TWENTY ONE */
+  {0x3252, 2, 3045}, /* CIRCLED NUMBER TWENTY TWO */
+  {0x3253, 2, 6}, /* CIRCLED NUMBER TWENTY THREE */
+  {0x3254, 2, 3047}, /* CIRCLED NUMBER TWENTY FOUR */
+  {0x3255, 2, 3049}, /* CIRCLED NUMBER TWENTY FIVE */
+  {0x3256, 2, 3051}, /* CIRCLED NUMBER TWENTY SIX */
+  {0x3257, 2, 3053}, /* CIRCLED NUMBER TWENTY SEVEN */
+  {0x3258, 2, 3055}, /* CIRCLED NUMBER TWENTY EIGHT */
+  {0x3259, 2, 3057}, /* CIRCLED NUMBER TWENTY NINE */
+  {0x325a, 2, 3059}, /* CIRCLED NUMBER THIRTY */
+  {0x325b, 2, 1965}, /* CIRCLED NUMBER THIRTY ONE */
+  {0x325c, 2, 1962}, /* CIRCLED NUMBER THIRTY TWO */
+  {0x325d, 2, 3061}, /* CIRCLED NUMBER THIRTY THREE */
+  {0x325e, 2, 3063}, /* CIRCLED NUMBER THIRTY FOUR */
+  {0x325f, 2, 3065}, /* CIRCLED NUMBER THIRTY FIVE */
+  {0x3260, 1, 2715}, /* CIRCLED HANGUL KIYEOK */
+  {0x3261, 1, 2718}, /* CIRCLED HANGUL NIEUN */
+  {0x3262, 1, 2721}, /* CIRCLED HANGUL TIKEUT */
+  {0x3263, 1, 2723}, /* CIRCLED HANGUL RIEUL */
+  {0x3264, 1, 2731}, /* CIRCLED HANGUL MIEUM */
+  {0x3265, 1, 2732}, /* CIRCLED HANGUL PIEUP */
+  {0x3266, 1, 2735}, /* CIRCLED HANGUL SIOS */
+  {0x3267, 1, 2737}, /* CIRCLED HANGUL IEUNG */
+  {0x3268, 1, 2738}, /* CIRCLED HANGUL CIEUC */
+  {0x3269, 1, 2740}, /* CIRCLED HANGUL CHIEUCH */
+  {0x326a, 1, 2741}, /* CIRCLED HANGUL KHIEUKH */
+  {0x326b, 1, 2742}, /* CIRCLED HANGUL THIEUTH */
+  {0x326c, 1, 2743}, /* CIRCLED HANGUL PHIEUPH */
+  {0x326d, 1, 2744}, /* CIRCLED HANGUL HIEUH */
+  {0x326e, 2, 2862}, /* CIRCLED HANGUL KIYEOK A */
+  {0x326f, 2, 2866}, /* CIRCLED HANGUL NIEUN A */
+  {0x3270, 2, 2870}, /* CIRCLED HANGUL TIKEUT A */
+  {0x3271, 2, 2874}, /* CIRCLED HANGUL RIEUL A */
+  {0x3272, 2, 2878}, /* CIRCLED HANGUL MIEUM A */
+  {0x3273, 2, 2882}, /* CIRCLED HANGUL PIEUP A */
+  {0x3274, 2, 2886}, /* CIRCLED HANGUL SIOS A */
+  {0x3275, 2, 2890}, /* CIRCLED HANGUL IEUNG A */
+  {0x3276, 2, 2894}, /* CIRCLED HANGUL CIEUC A */
+  {0x3277, 2, 2898}, /* CIRCLED HANGUL CHIEUCH A */
+  {0x3278, 2, 2902}, /* CIRCLED HANGUL KHIEUKH A */
+  {0x3279, 2, 2906}, /* CIRCLED HANGUL THIEUTH A */
+  {0x327a, 2, 2910}, /* CIRCLED HANGUL PHIEUPH A */
+  {0x327b, 2, 2744}, /* CIRCLED HANGUL HIEUH A */
+  {0x327c, 5, 3067}, /* CIRCLED KOREAN CHARACTER CHAMKO */
+  {0x327d, 4, 3072}, /* CIRCLED KOREAN CHARACTER JUEUI */
+  {0x3280, 1, 2373}, /* CIRCLED IDEOGRAPH ONE */
+  {0x3281, 1, 2379}, /* CIRCLED IDEOGRAPH TWO */
+  {0x3282, 1, 2809}, /* CIRCLED IDEOGRAPH THREE */
+  {0x3283, 1, 2810}, /* CIRCLED IDEOGRAPH FOUR */
+  {0x3284, 1, 2947}, /* CIRCLED IDEOGRAPH FIVE */
+  {0x3285, 1, 2950}, /* CIRCLED IDEOGRAPH SIX */
+  {0x3286, 1, 2953}, /* CIRCLED IDEOGRAPH SEVEN */
+  {0x3287, 1, 2384}, /* CIRCLED IDEOGRAPH EIGHT */
+  {0x3288, 1, 2959}, /* CIRCLED IDEOGRAPH NINE */
+  {0x3289, 1, 2396}, /* CIRCLED IDEOGRAPH TEN */
+  {0x328a, 1, 2446}, /* CIRCLED IDEOGRAPH MOON */
+  {0x328b, 1, 2458}, /* CIRCLED IDEOGRAPH FIRE */
+  {0x328c, 1, 2457}, /* CIRCLED IDEOGRAPH WATER */
+  {0x328d, 1, 2447}, /* CIRCLED IDEOGRAPH WOOD */
+  {0x328e, 1, 2539}, /* CIRCLED IDEOGRAPH METAL */
+  {0x328f, 1, 2404}, /* CIRCLED IDEOGRAPH EARTH */
+  {0x3290, 1, 2444}, /* CIRCLED IDEOGRAPH SUN */
+  {0x3291, 1, 2986}, /* CIRCLED IDEOGRAPH STOCK */
+  {0x3292, 1, 2989}, /* CIRCLED IDEOGRAPH HAVE */
+  {0x3293, 1, 2992}, /* CIRCLED IDEOGRAPH SOCIETY */
+  {0x3294, 1, 2995}, /* CIRCLED IDEOGRAPH NAME */
+  {0x3295, 1, 2998}, /* CIRCLED IDEOGRAPH SPECIAL */
+  {0x3296, 1, 3001}, /* CIRCLED IDEOGRAPH FINANCIAL */
+  {0x3297, 1, 3004}, /* CIRCLED IDEOGRAPH CONGRATULATION */
+  {0x3298, 1, 3007}, /* CIRCLED IDEOGRAPH LABOR */
+  {0x3299, 1, 3076}, /* CIRCLED IDEOGRAPH SECRET */
+  {0x329a, 1, 3077}, /* CIRCLED IDEOGRAPH MALE */
+  {0x329b, 1, 2410}, /* CIRCLED IDEOGRAPH FEMALE */
+  {0x329c, 1, 3078}, /* CIRCLED IDEOGRAPH SUITABLE */
+  {0x329d, 1, 3079}, /* CIRCLED IDEOGRAPH EXCELLENT */
+  {0x329e, 1, 3080}, /* CIRCLED IDEOGRAPH PRINT */
+  {0x329f, 1, 3081}, /* CIRCLED IDEOGRAPH ATTENTION */
+  {0x32a0, 1, 3082}, /* CIRCLED IDEOGRAPH ITEM */
+  {0x32a1, 1, 3034}, /* CIRCLED IDEOGRAPH REST */
+  {0x32a2, 1, 3083}, /* CIRCLED IDEOGRAPH COPY */
+  {0x32a3, 1, 3084}, /* CIRCLED IDEOGRAPH CORRECT */
+  {0x32a4, 1, 2811}, /* CIRCLED IDEOGRAPH HIGH */
+  {0x32a5, 1, 2812}, /* CIRCLED IDEOGRAPH CENTRE */
+  {0x32a6, 1, 2813}, /* CIRCLED IDEOGRAPH LOW */
+  {0x32a7, 1, 3085}, /* CIRCLED IDEOGRAPH LEFT */
+  {0x32a8, 1, 3086}, /* CIRCLED IDEOGRAPH RIGHT */
+  {0x32a9, 1, 3087}, /* CIRCLED IDEOGRAPH MEDICINE */
+  {0x32aa, 1, 3088}, /* CIRCLED IDEOGRAPH RELIGION */
+  {0x32ab, 1, 3016}, /* CIRCLED IDEOGRAPH STUDY */
+  {0x32ac, 1, 3019}, /* CIRCLED IDEOGRAPH SUPERVISE */
+  {0x32ad, 1, 3022}, /* CIRCLED IDEOGRAPH ENTERPRISE */
+  {0x32ae, 1, 3025}, /* CIRCLED IDEOGRAPH RESOURCE */
+  {0x32af, 1, 3028}, /* CIRCLED IDEOGRAPH ALLIANCE */
+  {0x32b0, 1, 3089}, /* CIRCLED IDEOGRAPH NIGHT */
+  {0x32b1, 2, 3090}, /* CIRCLED NUMBER THIRTY SIX */
+  {0x32b2, 2, 3092}, /* CIRCLED NUMBER THIRTY SEVEN */
+  {0x32b3, 2, 3094}, /* CIRCLED NUMBER THIRTY EIGHT */
+  {0x32b4, 2, 3096}, /* CIRCLED NUMBER THIRTY NINE */
+  {0x32b5, 2, 3098}, /* CIRCLED NUMBER FORTY */
+  {0x32b6, 2, 17}, /* CIRCLED NUMBER FORTY ONE */
+  {0x32b7, 2, 3048}, /* CIRCLED NUMBER FORTY TWO */
+  {0x32b8, 2, 3064}, /* CIRCLED NUMBER FORTY THREE */
+  {0x32b9, 2, 3100}, /* CIRCLED NUMBER FORTY FOUR */
+  {0x32ba, 2, 3102}, /* CIRCLED NUMBER FORTY FIVE */
+  {0x32bb, 2, 3104}, /* CIRCLED NUMBER FORTY SIX */
+  {0x32bc, 2, 3106}, /* CIRCLED NUMBER FORTY SEVEN */
+  {0x32bd, 2, 3108}, /* CIRCLED NUMBER FORTY EIGHT */
+  {0x32be, 2, 3110}, /* CIRCLED NUMBER FORTY NINE */
+  {0x32bf, 2, 3112}, /* CIRCLED NUMBER FIFTY */
+  {0x32c0, 2, 3114}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR JANUARY */
+  {0x32c1, 2, 3116}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR FEBRUARY */
+  {0x32c2, 2, 3118}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR MARCH */
+  {0x32c3, 2, 3120}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR APRIL */
+  {0x32c4, 2, 3122}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR MAY */
+  {0x32c5, 2, 3124}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR JUNE */
+  {0x32c6, 2, 3126}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR JULY */
+  {0x32c7, 2, 3128}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR AUGUST */
+  {0x32c8, 2, 3130}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR SEPTEMBER */
+  {0x32c9, 3, 3132}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR OCTOBER */
+  {0x32ca, 3, 3135}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR NOVEMBER */
+  {0x32cb, 3, 3138}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DECEMBER */
+  {0x32cc, 2, 3141}, /* SQUARE HG */
+  {0x32cd, 3, 3143}, /* SQUARE ERG */
+  {0x32ce, 2, 3146}, /* SQUARE EV */
+  {0x32cf, 3, 3148}, /* LIMITED LIABILITY SIGN */
+  {0x32d0, 1, 3151}, /* CIRCLED KATAKANA A */
+  {0x32d1, 1, 3152}, /* CIRCLED KATAKANA I */
+  {0x32d2, 1, 2701}, /* CIRCLED KATAKANA U */
+  {0x32d3, 1, 3153}, /* CIRCLED KATAKANA E */
+  {0x32d4, 1, 3154}, /* CIRCLED KATAKANA O */
+  {0x32d5, 1, 2651}, /* CIRCLED KATAKANA KA */
+  {0x32d6, 1, 2653}, /* CIRCLED KATAKANA KI */
+  {0x32d7, 1, 2655}, /* CIRCLED KATAKANA KU */
+  {0x32d8, 1, 2657}, /* CIRCLED KATAKANA KE */
+  {0x32d9, 1, 2659}, /* CIRCLED KATAKANA KO */
+  {0x32da, 1, 2661}, /* CIRCLED KATAKANA SA */
+  {0x32db, 1, 2663}, /* CIRCLED KATAKANA SI */
+  {0x32dc, 1, 2665}, /* CIRCLED KATAKANA SU */
+  {0x32dd, 1, 2667}, /* CIRCLED KATAKANA SE */
+  {0x32de, 1, 2669}, /* CIRCLED KATAKANA SO */
+  {0x32df, 1, 2671}, /* CIRCLED KATAKANA TA */
+  {0x32e0, 1, 2673}, /* CIRCLED KATAKANA TI */
+  {0x32e1, 1, 2675}, /* CIRCLED KATAKANA TU */
+  {0x32e2, 1, 2677}, /* CIRCLED KATAKANA TE */
+  {0x32e3, 1, 2679}, /* CIRCLED KATAKANA TO */
+  {0x32e4, 1, 3155}, /* CIRCLED KATAKANA NA */
+  {0x32e5, 1, 3156}, /* CIRCLED KATAKANA NI */
+  {0x32e6, 1, 3157}, /* CIRCLED KATAKANA NU */
+  {0x32e7, 1, 3158}, /* CIRCLED KATAKANA NE */
+  {0x32e8, 1, 3159}, /* CIRCLED KATAKANA NO */
+  {0x32e9, 1, 2681}, /* CIRCLED KATAKANA HA */
+  {0x32ea, 1, 2685}, /* CIRCLED KATAKANA HI */
+  {0x32eb, 1, 2689}, /* CIRCLED KATAKANA HU */
+  {0x32ec, 1, 2693}, /* CIRCLED KATAKANA HE */
+  {0x32ed, 1, 2697}, /* CIRCLED KATAKANA HO */
+  {0x32ee, 1, 3160}, /* CIRCLED KATAKANA MA */
+  {0x32ef, 1, 3161}, /* CIRCLED KATAKANA MI */
+  {0x32f0, 1, 3162}, /* CIRCLED KATAKANA MU */
+  {0x32f1, 1, 3163}, /* CIRCLED KATAKANA ME */
+  {0x32f2, 1, 3164}, /* CIRCLED KATAKANA MO */
+  {0x32f3, 1, 3165}, /* CIRCLED KATAKANA YA */
+  {0x32f4, 1, 3166}, /* CIRCLED KATAKANA YU */
+  {0x32f5, 1, 3167}, /* CIRCLED KATAKANA YO */
+  {0x32f6, 1, 3168}, /* CIRCLED KATAKANA RA */
+  {0x32f7, 1, 3169}, /* CIRCLED KATAKANA RI */
+  {0x32f8, 1, 3170}, /* CIRCLED KATAKANA RU */
+  {0x32f9, 1, 3171}, /* CIRCLED KATAKANA RE */
+  {0x32fa, 1, 3172}, /* CIRCLED KATAKANA RO */
+  {0x32fb, 1, 2703}, /* CIRCLED KATAKANA WA */
+  {0x32fc, 1, 2705}, /* CIRCLED KATAKANA WI */
+  {0x32fd, 1, 2707}, /* CIRCLED KATAKANA WE */
+  {0x32fe, 1, 2709}, /* CIRCLED KATAKANA WO */
+  {0x3300, 4, 3173}, /* SQUARE APAATO */
+  {0x3301, 4, 3177}, /* SQUARE ARUHUA */
+  {0x3302, 4, 3181}, /* SQUARE ANPEA */
+  {0x3303, 3, 3185}, /* SQUARE AARU */
+  {0x3304, 4, 3188}, /* SQUARE ININGU */
+  {0x3305, 3, 3192}, /* SQUARE INTI */
+  {0x3306, 3, 3195}, /* SQUARE UON */
+  {0x3307, 5, 3198}, /* SQUARE ESUKUUDO */
+  {0x3308, 4, 3203}, /* SQUARE EEKAA */
+  {0x3309, 3, 3207}, /* SQUARE ONSU */
+  {0x330a, 3, 3210}, /* SQUARE OOMU */
+  {0x330b, 3, 3213}, /* SQUARE KAIRI */
+  {0x330c, 4, 3216}, /* SQUARE KARATTO */
+  {0x330d, 4, 3220}, /* SQUARE KARORII */
+  {0x330e, 3, 3224}, /* SQUARE GARON */
+  {0x330f, 3, 3227}, /* SQUARE GANMA */
+  {0x3310, 2, 3230}, /* SQUARE GIGA */
+  {0x3311, 3, 3232}, /* SQUARE GINII */
+  {0x3312, 4, 3235}, /* SQUARE KYURII */
+  {0x3313, 4, 3239}, /* SQUARE GIRUDAA */
+  {0x3314, 2, 3243}, /* SQUARE KIRO */
+  {0x3315, 5, 3245}, /* SQUARE KIROGURAMU */
+  {0x3316, 6, 3250}, /* SQUARE KIROMEETORU */
+  {0x3317, 5, 3256}, /* SQUARE KIROWATTO */
+  {0x3318, 3, 3247}, /* SQUARE GURAMU */
+  {0x3319, 5, 3261}, /* SQUARE GURAMUTON */
+  {0x331a, 5, 3266}, /* SQUARE KURUZEIRO */
+  {0x331b, 4, 3271}, /* SQUARE KUROONE */
+  {0x331c, 3, 3275}, /* SQUARE KEESU */
+  {0x331d, 3, 3278}, /* SQUARE KORUNA */
+  {0x331e, 3, 3281}, /* SQUARE KOOPO */
+  {0x331f, 4, 3284}, /* SQUARE SAIKURU */
+  {0x3320, 5, 3288}, /* SQUARE SANTIIMU */
+  {0x3321, 4, 3293}, /* SQUARE SIRINGU */
+  {0x3322, 3, 3297}, /* SQUARE SENTI */
+  {0x3323, 3, 3300}, /* SQUARE SENTO */
+  {0x3324, 3, 3303}, /* SQUARE DAASU */
+  {0x3325, 2, 3306}, /* SQUARE DESI */
+  {0x3326, 2, 3308}, /* SQUARE DORU */
+  {0x3327, 2, 3264}, /* SQUARE TON */
+  {0x3328, 2, 3310}, /* SQUARE NANO */
+  {0x3329, 3, 3312}, /* SQUARE NOTTO */
+  {0x332a, 3, 3315}, /* SQUARE HAITU */
+  {0x332b, 5, 3318}, /* SQUARE PAASENTO */
+  {0x332c, 3, 3323}, /* SQUARE PAATU */
+  {0x332d, 4, 3326}, /* SQUARE BAARERU */
+  {0x332e, 5, 3330}, /* SQUARE PIASUTORU */
+  {0x332f, 3, 3335}, /* SQUARE PIKURU */
+  {0x3330, 2, 3338}, /* SQUARE PIKO */
+  {0x3331, 2, 3340}, /* SQUARE BIRU */
+  {0x3332, 5, 3342}, /* SQUARE HUARADDO */
+  {0x3333, 4, 3347}, /* SQUARE HUIITO */
+  {0x3334, 5, 3351}, /* SQUARE BUSSYERU */
+  {0x3335, 3, 3356}, /* SQUARE HURAN */
+  {0x3336, 5, 3359}, /* SQUARE HEKUTAARU */
+  {0x3337, 2, 3364}, /* SQUARE PESO */
+  {0x3338, 3, 3366}, /* SQUARE PENIHI */
+  {0x3339, 3, 3369}, /* SQUARE HERUTU */
+  {0x333a, 3, 3372}, /* SQUARE PENSU */
+  {0x333b, 3, 3375}, /* SQUARE PEEZI */
+  {0x333c, 3, 3378}, /* SQUARE BEETA */
+  {0x333d, 4, 3381}, /* SQUARE POINTO */
+  {0x333e, 3, 3385}, /* SQUARE BORUTO */
+  {0x333f, 2, 3388}, /* SQUARE HON */
+  {0x3340, 3, 3390}, /* SQUARE PONDO */
+  {0x3341, 3, 3393}, /* SQUARE HOORU */
+  {0x3342, 3, 3396}, /* SQUARE HOON */
+  {0x3343, 4, 3399}, /* SQUARE MAIKURO */
+  {0x3344, 3, 3403}, /* SQUARE MAIRU */
+  {0x3345, 3, 3406}, /* SQUARE MAHHA */
+  {0x3346, 3, 3409}, /* SQUARE MARUKU */
+  {0x3347, 5, 3412}, /* SQUARE MANSYON */
+  {0x3348, 4, 3417}, /* SQUARE MIKURON */
+  {0x3349, 2, 3421}, /* SQUARE MIRI */
+  {0x334a, 5, 3423}, /* SQUARE MIRIBAARU */
+  {0x334b, 2, 3428}, /* SQUARE MEGA */
+  {0x334c, 4, 3430}, /* SQUARE MEGATON */
+  {0x334d, 4, 3252}, /* SQUARE MEETORU */
+  {0x334e, 3, 3434}, /* SQUARE YAADO */
+  {0x334f, 3, 3437}, /* SQUARE YAARU */
+  {0x3350, 3, 3440}, /* SQUARE YUAN */
+  {0x3351, 4, 3443}, /* SQUARE RITTORU */
+  {0x3352, 2, 3447}, /* SQUARE RIRA */
+  {0x3353, 3, 3449}, /* SQUARE RUPII */
+  {0x3354, 4, 3452}, /* SQUARE RUUBURU */
+  {0x3355, 2, 3456}, /* SQUARE REMU */
+  {0x3356, 5, 3458}, /* SQUARE RENTOGEN */
+  {0x3357, 3, 3258}, /* SQUARE WATTO */
+  {0x3358, 2, 3463}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR ZERO */
+  {0x3359, 2, 3465}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR ONE */
+  {0x335a, 2, 3467}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TWO */
+  {0x335b, 2, 3469}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR THREE */
+  {0x335c, 2, 3471}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR FOUR */
+  {0x335d, 2, 3473}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR FIVE */
+  {0x335e, 2, 3475}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR SIX */
+  {0x335f, 2, 3477}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR SEVEN */
+  {0x3360, 2, 3479}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR EIGHT */
+  {0x3361, 2, 3481}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR NINE */
+  {0x3362, 3, 3483}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TEN */
+  {0x3363, 3, 3486}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR ELEVEN */
+  {0x3364, 3, 3489}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TWELVE */
+  {0x3365, 3, 3492}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR THIRTEEN */
+  {0x3366, 3, 3495}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR FOURTEEN */
+  {0x3367, 3, 3498}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR FIFTEEN */
+  {0x3368, 3, 3501}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR SIXTEEN */
+  {0x3369, 3, 3504}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR SEVENTEEN */
+  {0x336a, 3, 3507}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR EIGHTEEN */
+  {0x336b, 3, 3510}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR NINETEEN */
+  {0x336c, 3, 3513}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TWENTY */
+  {0x336d, 3, 3516}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TWENTY-ONE */
+  {0x336e, 3, 3519}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TWENTY-TWO */
+  {0x336f, 3, 3522}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TWENTY-THREE */
+  {0x3370, 3, 3525}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR HOUR TWENTY-FOUR */
+  {0x3371, 3, 3528}, /* SQUARE HPA */
+  {0x3372, 2, 3531}, /* SQUARE DA */
+  {0x3373, 2, 3533}, /* SQUARE AU */
+  {0x3374, 3, 3535}, /* SQUARE BAR */
+  {0x3375, 2, 3538}, /* SQUARE OV */
+  {0x3376, 2, 3540}, /* SQUARE PC */
+  {0x3377, 2, 3542}, /* SQUARE DM */
+  {0x3378, 3, 3544}, /* SQUARE DM SQUARED */
+  {0x3379, 3, 3547}, /* SQUARE DM CUBED */
+  {0x337a, 2, 3550}, /* SQUARE IU */
+  {0x337b, 2, 3552}, /* SQUARE ERA NAME HEISEI */
+  {0x337c, 2, 3554}, /* SQUARE ERA NAME SYOUWA */
+  {0x337d, 2, 3556}, /* SQUARE ERA NAME TAISYOU */
+  {0x337e, 2, 3558}, /* SQUARE ERA NAME MEIZI */
+  {0x337f, 4, 3560}, /* SQUARE CORPORATION */
+  {0x3380, 2, 3564}, /* SQUARE PA AMPS */
+  {0x3381, 2, 3566}, /* SQUARE NA */
+  {0x3382, 2, 3568}, /* SQUARE MU A */
+  {0x3383, 2, 3570}, /* SQUARE MA */
+  {0x3384, 2, 3572}, /* SQUARE KA */
+  {0x3385, 2, 3574}, /* SQUARE KB */
+  {0x3386, 2, 3576}, /* SQUARE MB */
+  {0x3387, 2, 3578}, /* SQUARE GB */
+  {0x3388, 3, 3580}, /* SQUARE CAL */
+  {0x3389, 4, 3583}, /* SQUARE KCAL */
+  {0x338a, 2, 3587}, /* SQUARE PF */
+  {0x338b, 2, 3589}, /* SQUARE NF */
+  {0x338c, 2, 3591}, /* SQUARE MU F */
+  {0x338d, 2, 3593}, /* SQUARE MU G */
+  {0x338e, 2, 3595}, /* SQUARE MG */
+  {0x338f, 2, 3597}, /* SQUARE KG */
+  {0x3390, 2, 3599}, /* SQUARE HZ */
+  {0x3391, 3, 3601}, /* SQUARE KHZ */
+  {0x3392, 3, 3604}, /* SQUARE MHZ */
+  {0x3393, 3, 3607}, /* SQUARE GHZ */
+  {0x3394, 3, 3610}, /* SQUARE THZ */
+  {0x3395, 2, 3613}, /* SQUARE MU L */
+  {0x3396, 2, 3615}, /* SQUARE ML */
+  {0x3397, 2, 3617}, /* SQUARE DL */
+  {0x3398, 2, 3619}, /* SQUARE KL */
+  {0x3399, 2, 3621}, /* SQUARE FM */
+  {0x339a, 2, 3623}, /* SQUARE NM */
+  {0x339b, 2, 3625}, /* SQUARE MU M */
+  {0x339c, 2, 3627}, /* SQUARE MM */
+  {0x339d, 2, 3629}, /* SQUARE CM */
+  {0x339e, 2, 3631}, /* SQUARE KM */
+  {0x339f, 3, 3633}, /* SQUARE MM SQUARED */
+  {0x33a0, 3, 3636}, /* SQUARE CM SQUARED */
+  {0x33a1, 2, 3545}, /* SQUARE M SQUARED */
+  {0x33a2, 3, 3639}, /* SQUARE KM SQUARED */
+  {0x33a3, 3, 3642}, /* SQUARE MM CUBED */
+  {0x33a4, 3, 3645}, /* SQUARE CM CUBED */
+  {0x33a5, 2, 3548}, /* SQUARE M CUBED */
+  {0x33a6, 3, 3648}, /* SQUARE KM CUBED */
+  {0x33a7, 3, 3651}, /* SQUARE M OVER S */
+  {0x33a8, 4, 3654}, /* SQUARE M OVER S SQUARED */
+  {0x33a9, 2, 3529}, /* SQUARE PA */
+  {0x33aa, 3, 3658}, /* SQUARE KPA */
+  {0x33ab, 3, 3661}, /* SQUARE MPA */
+  {0x33ac, 3, 3664}, /* SQUARE GPA */
+  {0x33ad, 3, 3667}, /* SQUARE RAD */
+  {0x33ae, 5, 3670}, /* SQUARE RAD OVER S */
+  {0x33af, 6, 3675}, /* SQUARE RAD OVER S SQUARED */
+  {0x33b0, 2, 3681}, /* SQUARE PS */
+  {0x33b1, 2, 3683}, /* SQUARE NS */
+  {0x33b2, 2, 3685}, /* SQUARE MU S */
+  {0x33b3, 2, 3687}, /* SQUARE MS */
+  {0x33b4, 2, 3689}, /* SQUARE PV */
+  {0x33b5, 2, 3691}, /* SQUARE NV */
+  {0x33b6, 2, 3693}, /* SQUARE MU V */
+  {0x33b7, 2, 3695}, /* SQUARE MV */
+  {0x33b8, 2, 3697}, /* SQUARE KV */
+  {0x33b9, 2, 3699}, /* SQUARE MV MEGA */
+  {0x33ba, 2, 3701}, /* SQUARE PW */
+  {0x33bb, 2, 3703}, /* SQUARE NW */
+  {0x33bc, 2, 3705}, /* SQUARE MU W */
+  {0x33bd, 2, 3707}, /* SQUARE MW */
+  {0x33be, 2, 3709}, /* SQUARE KW */
+  {0x33bf, 2, 3711}, /* SQUARE MW MEGA */
+  {0x33c0, 2, 3713}, /* SQUARE K OHM */
+  {0x33c1, 2, 3715}, /* SQUARE M OHM */
+  {0x33c2, 4, 3717}, /* SQUARE AM */
+  {0x33c3, 2, 3721}, /* SQUARE BQ */
+  {0x33c4, 2, 3723}, /* SQUARE CC */
+  {0x33c5, 2, 3541}, /* SQUARE CD */
+  {0x33c6, 4, 3725}, /* SQUARE C OVER KG */
+  {0x33c7, 3, 3729}, /* SQUARE CO */
+  {0x33c8, 2, 3732}, /* SQUARE DB */
+  {0x33c9, 2, 3734}, /* SQUARE GY */
+  {0x33ca, 2, 3736}, /* SQUARE HA */
+  {0x33cb, 2, 3738}, /* SQUARE HP */
+  {0x33cc, 2, 3740}, /* SQUARE IN */
+  {0x33cd, 2, 3742}, /* SQUARE KK */
+  {0x33ce, 2, 3744}, /* SQUARE KM CAPITAL */
+  {0x33cf, 2, 3746}, /* SQUARE KT */
+  {0x33d0, 2, 3748}, /* SQUARE LM */
+  {0x33d1, 2, 3750}, /* SQUARE LN */
+  {0x33d2, 3, 3752}, /* SQUARE LOG */
+  {0x33d3, 2, 3755}, /* SQUARE LX */
+  {0x33d4, 2, 3757}, /* SQUARE MB SMALL */
+  {0x33d5, 3, 3759}, /* SQUARE MIL */
+  {0x33d6, 3, 3762}, /* SQUARE MOL */
+  {0x33d7, 2, 3765}, /* SQUARE PH */
+  {0x33d8, 4, 3767}, /* SQUARE PM */
+  {0x33d9, 3, 3771}, /* SQUARE PPM */
+  {0x33da, 2, 3774}, /* SQUARE PR */
+  {0x33db, 2, 3674}, /* SQUARE SR */
+  {0x33dc, 2, 3776}, /* SQUARE SV */
+  {0x33dd, 2, 3778}, /* SQUARE WB */
+  {0x33de, 3, 3780}, /* SQUARE V OVER M */
+  {0x33df, 3, 3783}, /* SQUARE A OVER M */
+  {0x33e0, 2, 3786}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY ONE */
+  {0x33e1, 2, 3788}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWO */
+  {0x33e2, 2, 3790}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY THREE */
+  {0x33e3, 2, 3792}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY FOUR */
+  {0x33e4, 2, 3794}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY FIVE */
+  {0x33e5, 2, 3796}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY SIX */
+  {0x33e6, 2, 3798}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY SEVEN */
+  {0x33e7, 2, 3800}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY EIGHT */
+  {0x33e8, 2, 3802}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY NINE */
+  {0x33e9, 3, 3804}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TEN */
+  {0x33ea, 3, 3807}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY ELEVEN */
+  {0x33eb, 3, 3810}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWELVE */
+  {0x33ec, 3, 3813}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY THIRTEEN */
+  {0x33ed, 3, 3816}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY FOURTEEN */
+  {0x33ee, 3, 3819}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY FIFTEEN */
+  {0x33ef, 3, 3822}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY SIXTEEN */
+  {0x33f0, 3, 3825}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY SEVENTEEN */
+  {0x33f1, 3, 3828}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY EIGHTEEN */
+  {0x33f2, 3, 3831}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY NINETEEN */
+  {0x33f3, 3, 3834}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY */
+  {0x33f4, 3, 3837}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-ONE */
+  {0x33f5, 3, 3840}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-TWO */
+  {0x33f6, 3, 3843}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-THREE */
+  {0x33f7, 3, 3846}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-FOUR */
+  {0x33f8, 3, 3849}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-FIVE */
+  {0x33f9, 3, 3852}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-SIX */
+  {0x33fa, 3, 3855}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-SEVEN */
+  {0x33fb, 3, 3858}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-EIGHT */
+  {0x33fc, 3, 3861}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY TWENTY-NINE */
+  {0x33fd, 3, 3864}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY THIRTY */
+  {0x33fe, 3, 3867}, /* IDEOGRAPHIC TELEGRAPH SYMBOL FOR DAY THIRTY-ONE */
+  {0x33ff, 3, 3870}, /* SQUARE GAL */
+  {0xf900, 1, 3873}, /* CJK COMPATIBILITY IDEOGRAPH-F900 */
+  {0xf901, 1, 3874}, /* CJK COMPATIBILITY IDEOGRAPH-F901 */
+  {0xf902, 1, 2531}, /* CJK COMPATIBILITY IDEOGRAPH-F902 */
+  {0xf903, 1, 3875}, /* CJK COMPATIBILITY IDEOGRAPH-F903 */
+  {0xf904, 1, 3876}, /* CJK COMPATIBILITY IDEOGRAPH-F904 */
+  {0xf905, 1, 3877}, /* CJK COMPATIBILITY IDEOGRAPH-F905 */
+  {0xf906, 1, 3878}, /* CJK COMPATIBILITY IDEOGRAPH-F906 */
+  {0xf907, 1, 2585}, /* CJK COMPATIBILITY IDEOGRAPH-F907 */
+  {0xf908, 1, 2585}, /* CJK COMPATIBILITY IDEOGRAPH-F908 */
+  {0xf909, 1, 3879}, /* CJK COMPATIBILITY IDEOGRAPH-F909 */
+  {0xf90a, 1, 2539}, /* CJK COMPATIBILITY IDEOGRAPH-F90A */
+  {0xf90b, 1, 3880}, /* CJK COMPATIBILITY IDEOGRAPH-F90B */
+  {0xf90c, 1, 3881}, /* CJK COMPATIBILITY IDEOGRAPH-F90C */
+  {0xf90d, 1, 3882}, /* CJK COMPATIBILITY IDEOGRAPH-F90D */
+  {0xf90e, 1, 3883}, /* CJK COMPATIBILITY IDEOGRAPH-F90E */
+  {0xf90f, 1, 3884}, /* CJK COMPATIBILITY IDEOGRAPH-F90F */
+  {0xf910, 1, 3885}, /* CJK COMPATIBILITY IDEOGRAPH-F910 */
+  {0xf911, 1, 3886}, /* CJK COMPATIBILITY IDEOGRAPH-F911 */
+  {0xf912, 1, 3887}, /* CJK COMPATIBILITY IDEOGRAPH-F912 */
+  {0xf913, 1, 3888}, /* CJK COMPATIBILITY IDEOGRAPH-F913 */
+  {0xf914, 1, 3889}, /* CJK COMPATIBILITY IDEOGRAPH-F914 */
+  {0xf915, 1, 3890}, /* CJK COMPATIBILITY IDEOGRAPH-F915 */
+  {0xf916, 1, 3891}, /* CJK COMPATIBILITY IDEOGRAPH-F916 */
+  {0xf917, 1, 3892}, /* CJK COMPATIBILITY IDEOGRAPH-F917 */
+  {0xf918, 1, 3893}, /* CJK COMPATIBILITY IDEOGRAPH-F918 */
+  {0xf919, 1, 3894}, /* CJK COMPATIBILITY IDEOGRAPH-F919 */
+  {0xf91a, 1, 3895}, /* CJK COMPATIBILITY IDEOGRAPH-F91A */
+  {0xf91b, 1, 3896}, /* CJK COMPATIBILITY IDEOGRAPH-F91B */
+  {0xf91c, 1, 3897}, /* CJK COMPATIBILITY IDEOGRAPH-F91C */
+  {0xf91d, 1, 3898}, /* CJK COMPATIBILITY IDEOGRAPH-F91D */
+  {0xf91e, 1, 3899}, /* CJK COMPATIBILITY IDEOGRAPH-F91E */
+  {0xf91f, 1, 3900}, /* CJK COMPATIBILITY IDEOGRAPH-F91F */
+  {0xf920, 1, 3901}, /* CJK COMPATIBILITY IDEOGRAPH-F920 */
+  {0xf921, 1, 3902}, /* CJK COMPATIBILITY IDEOGRAPH-F921 */
+  {0xf922, 1, 3903}, /* CJK COMPATIBILITY IDEOGRAPH-F922 */
+  {0xf923, 1, 3904}, /* CJK COMPATIBILITY IDEOGRAPH-F923 */
+  {0xf924, 1, 3905}, /* CJK COMPATIBILITY IDEOGRAPH-F924 */
+  {0xf925, 1, 3906}, /* CJK COMPATIBILITY IDEOGRAPH-F925 */
+  {0xf926, 1, 3907}, /* CJK COMPATIBILITY IDEOGRAPH-F926 */
+  {0xf927, 1, 3908}, /* CJK COMPATIBILITY IDEOGRAPH-F927 */
+  {0xf928, 1, 3909}, /* CJK COMPATIBILITY IDEOGRAPH-F928 */
+  {0xf929, 1, 3910}, /* CJK COMPATIBILITY IDEOGRAPH-F929 */
+  {0xf92a, 1, 3911}, /* CJK COMPATIBILITY IDEOGRAPH-F92A */
+  {0xf92b, 1, 3912}, /* CJK COMPATIBILITY IDEOGRAPH-F92B */
+  {0xf92c, 1, 3913}, /* CJK COMPATIBILITY IDEOGRAPH-F92C */
+  {0xf92d, 1, 3914}, /* CJK COMPATIBILITY IDEOGRAPH-F92D */
+  {0xf92e, 1, 3915}, /* CJK COMPATIBILITY IDEOGRAPH-F92E */
+  {0xf92f, 1, 3916}, /* CJK COMPATIBILITY IDEOGRAPH-F92F */
+  {0xf930, 1, 3917}, /* CJK COMPATIBILITY IDEOGRAPH-F930 */
+  {0xf931, 1, 3918}, /* CJK COMPATIBILITY IDEOGRAPH-F931 */
+  {0xf932, 1, 3919}, /* CJK COMPATIBILITY IDEOGRAPH-F932 */
+  {0xf933, 1, 3920}, /* CJK COMPATIBILITY IDEOGRAPH-F933 */
+  {0xf934, 1, 2497}, /* CJK COMPATIBILITY IDEOGRAPH-F934 */
+  {0xf935, 1, 3921}, /* CJK COMPATIBILITY IDEOGRAPH-F935 */
+  {0xf936, 1, 3922}, /* CJK COMPATIBILITY IDEOGRAPH-F936 */
+  {0xf937, 1, 3923}, /* CJK COMPATIBILITY IDEOGRAPH-F937 */
+  {0xf938, 1, 3924}, /* CJK COMPATIBILITY IDEOGRAPH-F938 */
+  {0xf939, 1, 3925}, /* CJK COMPATIBILITY IDEOGRAPH-F939 */
+  {0xf93a, 1, 3926}, /* CJK COMPATIBILITY IDEOGRAPH-F93A */
+  {0xf93b, 1, 3927}, /* CJK COMPATIBILITY IDEOGRAPH-F93B */
+  {0xf93c, 1, 3928}, /* CJK COMPATIBILITY IDEOGRAPH-F93C */
+  {0xf93d, 1, 3929}, /* CJK COMPATIBILITY IDEOGRAPH-F93D */
+  {0xf93e, 1, 3930}, /* CJK COMPATIBILITY IDEOGRAPH-F93E */
+  {0xf93f, 1, 3931}, /* CJK COMPATIBILITY IDEOGRAPH-F93F */
+  {0xf940, 1, 2570}, /* CJK COMPATIBILITY IDEOGRAPH-F940 */
+  {0xf941, 1, 3932}, /* CJK COMPATIBILITY IDEOGRAPH-F941 */
+  {0xf942, 1, 3933}, /* CJK COMPATIBILITY IDEOGRAPH-F942 */
+  {0xf943, 1, 3934}, /* CJK COMPATIBILITY IDEOGRAPH-F943 */
+  {0xf944, 1, 3935}, /* CJK COMPATIBILITY IDEOGRAPH-F944 */
+  {0xf945, 1, 3936}, /* CJK COMPATIBILITY IDEOGRAPH-F945 */
+  {0xf946, 1, 3937}, /* CJK COMPATIBILITY IDEOGRAPH-F946 */
+  {0xf947, 1, 3938}, /* CJK COMPATIBILITY IDEOGRAPH-F947 */
+  {0xf948, 1, 3939}, /* CJK COMPATIBILITY IDEOGRAPH-F948 */
+  {0xf949, 1, 3940}, /* CJK COMPATIBILITY IDEOGRAPH-F949 */
+  {0xf94a, 1, 3941}, /* CJK COMPATIBILITY IDEOGRAPH-F94A */
+  {0xf94b, 1, 3942}, /* CJK COMPATIBILITY IDEOGRAPH-F94B */
+  {0xf94c, 1, 3943}, /* CJK COMPATIBILITY IDEOGRAPH-F94C */
+  {0xf94d, 1, 3944}, /* CJK COMPATIBILITY IDEOGRAPH-F94D */
+  {0xf94e, 1, 3945}, /* CJK COMPATIBILITY IDEOGRAPH-F94E */
+  {0xf94f, 1, 3946}, /* CJK COMPATIBILITY IDEOGRAPH-F94F */
+  {0xf950, 1, 3947}, /* CJK COMPATIBILITY IDEOGRAPH-F950 */
+  {0xf951, 1, 3948}, /* CJK COMPATIBILITY IDEOGRAPH-F951 */
+  {0xf952, 1, 3949}, /* CJK COMPATIBILITY IDEOGRAPH-F952 */
+  {0xf953, 1, 3950}, /* CJK COMPATIBILITY IDEOGRAPH-F953 */
+  {0xf954, 1, 3951}, /* CJK COMPATIBILITY IDEOGRAPH-F954 */
+  {0xf955, 1, 3952}, /* CJK COMPATIBILITY IDEOGRAPH-F955 */
+  {0xf956, 1, 3953}, /* CJK COMPATIBILITY IDEOGRAPH-F956 */
+  {0xf957, 1, 3954}, /* CJK COMPATIBILITY IDEOGRAPH-F957 */
+  {0xf958, 1, 3955}, /* CJK COMPATIBILITY IDEOGRAPH-F958 */
+  {0xf959, 1, 3956}, /* CJK COMPATIBILITY IDEOGRAPH-F959 */
+  {0xf95a, 1, 3957}, /* CJK COMPATIBILITY IDEOGRAPH-F95A */
+  {0xf95b, 1, 3958}, /* CJK COMPATIBILITY IDEOGRAPH-F95B */
+  {0xf95c, 1, 3889}, /* CJK COMPATIBILITY IDEOGRAPH-F95C */
+  {0xf95d, 1, 3959}, /* CJK COMPATIBILITY IDEOGRAPH-F95D */
+  {0xf95e, 1, 3960}, /* CJK COMPATIBILITY IDEOGRAPH-F95E */
+  {0xf95f, 1, 3961}, /* CJK COMPATIBILITY IDEOGRAPH-F95F */
+  {0xf960, 1, 3962}, /* CJK COMPATIBILITY IDEOGRAPH-F960 */
+  {0xf961, 1, 3963}, /* CJK COMPATIBILITY IDEOGRAPH-F961 */
+  {0xf962, 1, 3964}, /* CJK COMPATIBILITY IDEOGRAPH-F962 */
+  {0xf963, 1, 3965}, /* CJK COMPATIBILITY IDEOGRAPH-F963 */
+  {0xf964, 1, 3966}, /* CJK COMPATIBILITY IDEOGRAPH-F964 */
+  {0xf965, 1, 3967}, /* CJK COMPATIBILITY IDEOGRAPH-F965 */
+  {0xf966, 1, 3968}, /* CJK COMPATIBILITY IDEOGRAPH-F966 */
+  {0xf967, 1, 3969}, /* CJK COMPATIBILITY IDEOGRAPH-F967 */
+  {0xf968, 1, 3970}, /* CJK COMPATIBILITY IDEOGRAPH-F968 */
+  {0xf969, 1, 3971}, /* CJK COMPATIBILITY IDEOGRAPH-F969 */
+  {0xf96a, 1, 3972}, /* CJK COMPATIBILITY IDEOGRAPH-F96A */
+  {0xf96b, 1, 3973}, /* CJK COMPATIBILITY IDEOGRAPH-F96B */
+  {0xf96c, 1, 3974}, /* CJK COMPATIBILITY IDEOGRAPH-F96C */
+  {0xf96d, 1, 3975}, /* CJK COMPATIBILITY IDEOGRAPH-F96D */
+  {0xf96e, 1, 3976}, /* CJK COMPATIBILITY IDEOGRAPH-F96E */
+  {0xf96f, 1, 3977}, /* CJK COMPATIBILITY IDEOGRAPH-F96F */
+  {0xf970, 1, 3978}, /* CJK COMPATIBILITY IDEOGRAPH-F970 */
+  {0xf971, 1, 2533}, /* CJK COMPATIBILITY IDEOGRAPH-F971 */
+  {0xf972, 1, 3979}, /* CJK COMPATIBILITY IDEOGRAPH-F972 */
+  {0xf973, 1, 3980}, /* CJK COMPATIBILITY IDEOGRAPH-F973 */
+  {0xf974, 1, 3981}, /* CJK COMPATIBILITY IDEOGRAPH-F974 */
+  {0xf975, 1, 3982}, /* CJK COMPATIBILITY IDEOGRAPH-F975 */
+  {0xf976, 1, 3983}, /* CJK COMPATIBILITY IDEOGRAPH-F976 */
+  {0xf977, 1, 3984}, /* CJK COMPATIBILITY IDEOGRAPH-F977 */
+  {0xf978, 1, 3985}, /* CJK COMPATIBILITY IDEOGRAPH-F978 */
+  {0xf979, 1, 3986}, /* CJK COMPATIBILITY IDEOGRAPH-F979 */
+  {0xf97a, 1, 3987}, /* CJK COMPATIBILITY IDEOGRAPH-F97A */
+  {0xf97b, 1, 3988}, /* CJK COMPATIBILITY IDEOGRAPH-F97B */
+  {0xf97c, 1, 3989}, /* CJK COMPATIBILITY IDEOGRAPH-F97C */
+  {0xf97d, 1, 3990}, /* CJK COMPATIBILITY IDEOGRAPH-F97D */
+  {0xf97e, 1, 3991}, /* CJK COMPATIBILITY IDEOGRAPH-F97E */
+  {0xf97f, 1, 3992}, /* CJK COMPATIBILITY IDEOGRAPH-F97F */
+  {0xf980, 1, 3993}, /* CJK COMPATIBILITY IDEOGRAPH-F980 */
+  {0xf981, 1, 2410}, /* CJK COMPATIBILITY IDEOGRAPH-F981 */
+  {0xf982, 1, 3994}, /* CJK COMPATIBILITY IDEOGRAPH-F982 */
+  {0xf983, 1, 3995}, /* CJK COMPATIBILITY IDEOGRAPH-F983 */
+  {0xf984, 1, 3996}, /* CJK COMPATIBILITY IDEOGRAPH-F984 */
+  {0xf985, 1, 3997}, /* CJK COMPATIBILITY IDEOGRAPH-F985 */
+  {0xf986, 1, 3998}, /* CJK COMPATIBILITY IDEOGRAPH-F986 */
+  {0xf987, 1, 3999}, /* CJK COMPATIBILITY IDEOGRAPH-F987 */
+  {0xf988, 1, 4000}, /* CJK COMPATIBILITY IDEOGRAPH-F988 */
+  {0xf989, 1, 4001}, /* CJK COMPATIBILITY IDEOGRAPH-F989 */
+  {0xf98a, 1, 2391}, /* CJK COMPATIBILITY IDEOGRAPH-F98A */
+  {0xf98b, 1, 4002}, /* CJK COMPATIBILITY IDEOGRAPH-F98B */
+  {0xf98c, 1, 4003}, /* CJK COMPATIBILITY IDEOGRAPH-F98C */
+  {0xf98d, 1, 4004}, /* CJK COMPATIBILITY IDEOGRAPH-F98D */
+  {0xf98e, 1, 4005}, /* CJK COMPATIBILITY IDEOGRAPH-F98E */
+  {0xf98f, 1, 4006}, /* CJK COMPATIBILITY IDEOGRAPH-F98F */
+  {0xf990, 1, 4007}, /* CJK COMPATIBILITY IDEOGRAPH-F990 */
+  {0xf991, 1, 4008}, /* CJK COMPATIBILITY IDEOGRAPH-F991 */
+  {0xf992, 1, 4009}, /* CJK COMPATIBILITY IDEOGRAPH-F992 */
+  {0xf993, 1, 4010}, /* CJK COMPATIBILITY IDEOGRAPH-F993 */
+  {0xf994, 1, 4011}, /* CJK COMPATIBILITY IDEOGRAPH-F994 */
+  {0xf995, 1, 4012}, /* CJK COMPATIBILITY IDEOGRAPH-F995 */
+  {0xf996, 1, 4013}, /* CJK COMPATIBILITY IDEOGRAPH-F996 */
+  {0xf997, 1, 4014}, /* CJK COMPATIBILITY IDEOGRAPH-F997 */
+  {0xf998, 1, 4015}, /* CJK COMPATIBILITY IDEOGRAPH-F998 */
+  {0xf999, 1, 4016}, /* CJK COMPATIBILITY IDEOGRAPH-F999 */
+  {0xf99a, 1, 4017}, /* CJK COMPATIBILITY IDEOGRAPH-F99A */
+  {0xf99b, 1, 4018}, /* CJK COMPATIBILITY IDEOGRAPH-F99B */
+  {0xf99c, 1, 4019}, /* CJK COMPATIBILITY IDEOGRAPH-F99C */
+  {0xf99d, 1, 4020}, /* CJK COMPATIBILITY IDEOGRAPH-F99D */
+  {0xf99e, 1, 4021}, /* CJK COMPATIBILITY IDEOGRAPH-F99E */
+  {0xf99f, 1, 4022}, /* CJK COMPATIBILITY IDEOGRAPH-F99F */
+  {0xf9a0, 1, 4023}, /* CJK COMPATIBILITY IDEOGRAPH-F9A0 */
+  {0xf9a1, 1, 3977}, /* CJK COMPATIBILITY IDEOGRAPH-F9A1 */
+  {0xf9a2, 1, 4024}, /* CJK COMPATIBILITY IDEOGRAPH-F9A2 */
+  {0xf9a3, 1, 4025}, /* CJK COMPATIBILITY IDEOGRAPH-F9A3 */
+  {0xf9a4, 1, 4026}, /* CJK COMPATIBILITY IDEOGRAPH-F9A4 */
+  {0xf9a5, 1, 4027}, /* CJK COMPATIBILITY IDEOGRAPH-F9A5 */
+  {0xf9a6, 1, 4028}, /* CJK COMPATIBILITY IDEOGRAPH-F9A6 */
+  {0xf9a7, 1, 4029}, /* CJK COMPATIBILITY IDEOGRAPH-F9A7 */
+  {0xf9a8, 1, 4030}, /* CJK COMPATIBILITY IDEOGRAPH-F9A8 */
+  {0xf9a9, 1, 4031}, /* CJK COMPATIBILITY IDEOGRAPH-F9A9 */
+  {0xf9aa, 1, 3961}, /* CJK COMPATIBILITY IDEOGRAPH-F9AA */
+  {0xf9ab, 1, 4032}, /* CJK COMPATIBILITY IDEOGRAPH-F9AB */
+  {0xf9ac, 1, 4033}, /* CJK COMPATIBILITY IDEOGRAPH-F9AC */
+  {0xf9ad, 1, 4034}, /* CJK COMPATIBILITY IDEOGRAPH-F9AD */
+  {0xf9ae, 1, 4035}, /* CJK COMPATIBILITY IDEOGRAPH-F9AE */
+  {0xf9af, 1, 4036}, /* CJK COMPATIBILITY IDEOGRAPH-F9AF */
+  {0xf9b0, 1, 4037}, /* CJK COMPATIBILITY IDEOGRAPH-F9B0 */
+  {0xf9b1, 1, 4038}, /* CJK COMPATIBILITY IDEOGRAPH-F9B1 */
+  {0xf9b2, 1, 4039}, /* CJK COMPATIBILITY IDEOGRAPH-F9B2 */
+  {0xf9b3, 1, 4040}, /* CJK COMPATIBILITY IDEOGRAPH-F9B3 */
+  {0xf9b4, 1, 4041}, /* CJK COMPATIBILITY IDEOGRAPH-F9B4 */
+  {0xf9b5, 1, 4042}, /* CJK COMPATIBILITY IDEOGRAPH-F9B5 */
+  {0xf9b6, 1, 4043}, /* CJK COMPATIBILITY IDEOGRAPH-F9B6 */
+  {0xf9b7, 1, 4044}, /* CJK COMPATIBILITY IDEOGRAPH-F9B7 */
+  {0xf9b8, 1, 4045}, /* CJK COMPATIBILITY IDEOGRAPH-F9B8 */
+  {0xf9b9, 1, 4046}, /* CJK COMPATIBILITY IDEOGRAPH-F9B9 */
+  {0xf9ba, 1, 4047}, /* CJK COMPATIBILITY IDEOGRAPH-F9BA */
+  {0xf9bb, 1, 4048}, /* CJK COMPATIBILITY IDEOGRAPH-F9BB */
+  {0xf9bc, 1, 4049}, /* CJK COMPATIBILITY IDEOGRAPH-F9BC */
+  {0xf9bd, 1, 4050}, /* CJK COMPATIBILITY IDEOGRAPH-F9BD */
+  {0xf9be, 1, 4051}, /* CJK COMPATIBILITY IDEOGRAPH-F9BE */
+  {0xf9bf, 1, 3889}, /* CJK COMPATIBILITY IDEOGRAPH-F9BF */
+  {0xf9c0, 1, 4052}, /* CJK COMPATIBILITY IDEOGRAPH-F9C0 */
+  {0xf9c1, 1, 4053}, /* CJK COMPATIBILITY IDEOGRAPH-F9C1 */
+  {0xf9c2, 1, 4054}, /* CJK COMPATIBILITY IDEOGRAPH-F9C2 */
+  {0xf9c3, 1, 4055}, /* CJK COMPATIBILITY IDEOGRAPH-F9C3 */
+  {0xf9c4, 1, 2584}, /* CJK COMPATIBILITY IDEOGRAPH-F9C4 */
+  {0xf9c5, 1, 4056}, /* CJK COMPATIBILITY IDEOGRAPH-F9C5 */
+  {0xf9c6, 1, 4057}, /* CJK COMPATIBILITY IDEOGRAPH-F9C6 */
+  {0xf9c7, 1, 4058}, /* CJK COMPATIBILITY IDEOGRAPH-F9C7 */
+  {0xf9c8, 1, 4059}, /* CJK COMPATIBILITY IDEOGRAPH-F9C8 */
+  {0xf9c9, 1, 4060}, /* CJK COMPATIBILITY IDEOGRAPH-F9C9 */
+  {0xf9ca, 1, 4061}, /* CJK COMPATIBILITY IDEOGRAPH-F9CA */
+  {0xf9cb, 1, 4062}, /* CJK COMPATIBILITY IDEOGRAPH-F9CB */
+  {0xf9cc, 1, 4063}, /* CJK COMPATIBILITY IDEOGRAPH-F9CC */
+  {0xf9cd, 1, 4064}, /* CJK COMPATIBILITY IDEOGRAPH-F9CD */
+  {0xf9ce, 1, 4065}, /* CJK COMPATIBILITY IDEOGRAPH-F9CE */
+  {0xf9cf, 1, 4066}, /* CJK COMPATIBILITY IDEOGRAPH-F9CF */
+  {0xf9d0, 1, 4067}, /* CJK COMPATIBILITY IDEOGRAPH-F9D0 */
+  {0xf9d1, 1, 2950}, /* CJK COMPATIBILITY IDEOGRAPH-F9D1 */
+  {0xf9d2, 1, 4068}, /* CJK COMPATIBILITY IDEOGRAPH-F9D2 */
+  {0xf9d3, 1, 4069}, /* CJK COMPATIBILITY IDEOGRAPH-F9D3 */
+  {0xf9d4, 1, 4070}, /* CJK COMPATIBILITY IDEOGRAPH-F9D4 */
+  {0xf9d5, 1, 4071}, /* CJK COMPATIBILITY IDEOGRAPH-F9D5 */
+  {0xf9d6, 1, 4072}, /* CJK COMPATIBILITY IDEOGRAPH-F9D6 */
+  {0xf9d7, 1, 4073}, /* CJK COMPATIBILITY IDEOGRAPH-F9D7 */
+  {0xf9d8, 1, 4074}, /* CJK COMPATIBILITY IDEOGRAPH-F9D8 */
+  {0xf9d9, 1, 4075}, /* CJK COMPATIBILITY IDEOGRAPH-F9D9 */
+  {0xf9da, 1, 4076}, /* CJK COMPATIBILITY IDEOGRAPH-F9DA */
+  {0xf9db, 1, 3963}, /* CJK COMPATIBILITY IDEOGRAPH-F9DB */
+  {0xf9dc, 1, 4077}, /* CJK COMPATIBILITY IDEOGRAPH-F9DC */
+  {0xf9dd, 1, 4078}, /* CJK COMPATIBILITY IDEOGRAPH-F9DD */
+  {0xf9de, 1, 4079}, /* CJK COMPATIBILITY IDEOGRAPH-F9DE */
+  {0xf9df, 1, 4080}, /* CJK COMPATIBILITY IDEOGRAPH-F9DF */
+  {0xf9e0, 1, 4081}, /* CJK COMPATIBILITY IDEOGRAPH-F9E0 */
+  {0xf9e1, 1, 4082}, /* CJK COMPATIBILITY IDEOGRAPH-F9E1 */
+  {0xf9e2, 1, 4083}, /* CJK COMPATIBILITY IDEOGRAPH-F9E2 */
+  {0xf9e3, 1, 4084}, /* CJK COMPATIBILITY IDEOGRAPH-F9E3 */
+  {0xf9e4, 1, 4085}, /* CJK COMPATIBILITY IDEOGRAPH-F9E4 */
+  {0xf9e5, 1, 4086}, /* CJK COMPATIBILITY IDEOGRAPH-F9E5 */
+  {0xf9e6, 1, 4087}, /* CJK COMPATIBILITY IDEOGRAPH-F9E6 */
+  {0xf9e7, 1, 4088}, /* CJK COMPATIBILITY IDEOGRAPH-F9E7 */
+  {0xf9e8, 1, 4089}, /* CJK COMPATIBILITY IDEOGRAPH-F9E8 */
+  {0xf9e9, 1, 2538}, /* CJK COMPATIBILITY IDEOGRAPH-F9E9 */
+  {0xf9ea, 1, 4090}, /* CJK COMPATIBILITY IDEOGRAPH-F9EA */
+  {0xf9eb, 1, 4091}, /* CJK COMPATIBILITY IDEOGRAPH-F9EB */
+  {0xf9ec, 1, 4092}, /* CJK COMPATIBILITY IDEOGRAPH-F9EC */
+  {0xf9ed, 1, 4093}, /* CJK COMPATIBILITY IDEOGRAPH-F9ED */
+  {0xf9ee, 1, 4094}, /* CJK COMPATIBILITY IDEOGRAPH-F9EE */
+  {0xf9ef, 1, 4095}, /* CJK COMPATIBILITY IDEOGRAPH-F9EF */
+  {0xf9f0, 1, 4096}, /* CJK COMPATIBILITY IDEOGRAPH-F9F0 */
+  {0xf9f1, 1, 4097}, /* CJK COMPATIBILITY IDEOGRAPH-F9F1 */
+  {0xf9f2, 1, 4098}, /* CJK COMPATIBILITY IDEOGRAPH-F9F2 */
+  {0xf9f3, 1, 4099}, /* CJK COMPATIBILITY IDEOGRAPH-F9F3 */
+  {0xf9f4, 1, 4100}, /* CJK COMPATIBILITY IDEOGRAPH-F9F4 */
+  {0xf9f5, 1, 4101}, /* CJK COMPATIBILITY IDEOGRAPH-F9F5 */
+  {0xf9f6, 1, 4102}, /* CJK COMPATIBILITY IDEOGRAPH-F9F6 */
+  {0xf9f7, 1, 2489}, /* CJK COMPATIBILITY IDEOGRAPH-F9F7 */
+  {0xf9f8, 1, 4103}, /* CJK COMPATIBILITY IDEOGRAPH-F9F8 */
+  {0xf9f9, 1, 4104}, /* CJK COMPATIBILITY IDEOGRAPH-F9F9 */
+  {0xf9fa, 1, 4105}, /* CJK COMPATIBILITY IDEOGRAPH-F9FA */
+  {0xf9fb, 1, 4106}, /* CJK COMPATIBILITY IDEOGRAPH-F9FB */
+  {0xf9fc, 1, 4107}, /* CJK COMPATIBILITY IDEOGRAPH-F9FC */
+  {0xf9fd, 1, 4108}, /* CJK COMPATIBILITY IDEOGRAPH-F9FD */
+  {0xf9fe, 1, 4109}, /* CJK COMPATIBILITY IDEOGRAPH-F9FE */
+  {0xf9ff, 1, 4110}, /* CJK COMPATIBILITY IDEOGRAPH-F9FF */
+  {0xfa00, 1, 4111}, /* CJK COMPATIBILITY IDEOGRAPH-FA00 */
+  {0xfa01, 1, 4112}, /* CJK COMPATIBILITY IDEOGRAPH-FA01 */
+  {0xfa02, 1, 4113}, /* CJK COMPATIBILITY IDEOGRAPH-FA02 */
+  {0xfa03, 1, 4114}, /* CJK COMPATIBILITY IDEOGRAPH-FA03 */
+  {0xfa04, 1, 4115}, /* CJK COMPATIBILITY IDEOGRAPH-FA04 */
+  {0xfa05, 1, 4116}, /* CJK COMPATIBILITY IDEOGRAPH-FA05 */
+  {0xfa06, 1, 4117}, /* CJK COMPATIBILITY IDEOGRAPH-FA06 */
+  {0xfa07, 1, 4118}, /* CJK COMPATIBILITY IDEOGRAPH-FA07 */
+  {0xfa08, 1, 2516}, /* CJK COMPATIBILITY IDEOGRAPH-FA08 */
+  {0xfa09, 1, 4119}, /* CJK COMPATIBILITY IDEOGRAPH-FA09 */
+  {0xfa0a, 1, 2519}, /* CJK COMPATIBILITY IDEOGRAPH-FA0A */
+  {0xfa0b, 1, 4120}, /* CJK COMPATIBILITY IDEOGRAPH-FA0B */
+  {0xfa0c, 1, 4121}, /* CJK COMPATIBILITY IDEOGRAPH-FA0C */
+  {0xfa0d, 1, 4122}, /* CJK COMPATIBILITY IDEOGRAPH-FA0D */
+  {0xfa10, 1, 4123}, /* CJK COMPATIBILITY IDEOGRAPH-FA10 */
+  {0xfa12, 1, 4124}, /* CJK COMPATIBILITY IDEOGRAPH-FA12 */
+  {0xfa15, 1, 4125}, /* CJK COMPATIBILITY IDEOGRAPH-FA15 */
+  {0xfa16, 1, 4126}, /* CJK COMPATIBILITY IDEOGRAPH-FA16 */
+  {0xfa17, 1, 4127}, /* CJK COMPATIBILITY IDEOGRAPH-FA17 */
+  {0xfa18, 1, 4128}, /* CJK COMPATIBILITY IDEOGRAPH-FA18 */
+  {0xfa19, 1, 4129}, /* CJK COMPATIBILITY IDEOGRAPH-FA19 */
+  {0xfa1a, 1, 4130}, /* CJK COMPATIBILITY IDEOGRAPH-FA1A */
+  {0xfa1b, 1, 4131}, /* CJK COMPATIBILITY IDEOGRAPH-FA1B */
+  {0xfa1c, 1, 4132}, /* CJK COMPATIBILITY IDEOGRAPH-FA1C */
+  {0xfa1d, 1, 4133}, /* CJK COMPATIBILITY IDEOGRAPH-FA1D */
+  {0xfa1e, 1, 2496}, /* CJK COMPATIBILITY IDEOGRAPH-FA1E */
+  {0xfa20, 1, 4134}, /* CJK COMPATIBILITY IDEOGRAPH-FA20 */
+  {0xfa22, 1, 4135}, /* CJK COMPATIBILITY IDEOGRAPH-FA22 */
+  {0xfa25, 1, 4136}, /* CJK COMPATIBILITY IDEOGRAPH-FA25 */
+  {0xfa26, 1, 4137}, /* CJK COMPATIBILITY IDEOGRAPH-FA26 */
+  {0xfa2a, 1, 4138}, /* CJK COMPATIBILITY IDEOGRAPH-FA2A */
+  {0xfa2b, 1, 4139}, /* CJK COMPATIBILITY IDEOGRAPH-FA2B */
+  {0xfa2c, 1, 4140}, /* CJK COMPATIBILITY IDEOGRAPH-FA2C */
+  {0xfa2d, 1, 4141}, /* CJK COMPATIBILITY IDEOGRAPH-FA2D */
+  {0xfa30, 1, 4142}, /* CJK COMPATIBILITY IDEOGRAPH-FA30 */
+  {0xfa31, 1, 4143}, /* CJK COMPATIBILITY IDEOGRAPH-FA31 */
+  {0xfa32, 1, 4144}, /* CJK COMPATIBILITY IDEOGRAPH-FA32 */
+  {0xfa33, 1, 4145}, /* CJK COMPATIBILITY IDEOGRAPH-FA33 */
+  {0xfa34, 1, 4146}, /* CJK COMPATIBILITY IDEOGRAPH-FA34 */
+  {0xfa35, 1, 4147}, /* CJK COMPATIBILITY IDEOGRAPH-FA35 */
+  {0xfa36, 1, 4148}, /* CJK COMPATIBILITY IDEOGRAPH-FA36 */
+  {0xfa37, 1, 4149}, /* CJK COMPATIBILITY IDEOGRAPH-FA37 */
+  {0xfa38, 1, 4150}, /* CJK COMPATIBILITY IDEOGRAPH-FA38 */
+  {0xfa39, 1, 4151}, /* CJK COMPATIBILITY IDEOGRAPH-FA39 */
+  {0xfa3a, 1, 4152}, /* CJK COMPATIBILITY IDEOGRAPH-FA3A */
+  {0xfa3b, 1, 4153}, /* CJK COMPATIBILITY IDEOGRAPH-FA3B */
+  {0xfa3c, 1, 2417}, /* CJK COMPATIBILITY IDEOGRAPH-FA3C */
+  {0xfa3d, 1, 4154}, /* CJK COMPATIBILITY IDEOGRAPH-FA3D */
+  {0xfa3e, 1, 4155}, /* CJK COMPATIBILITY IDEOGRAPH-FA3E */
+  {0xfa3f, 1, 4156}, /* CJK COMPATIBILITY IDEOGRAPH-FA3F */
+  {0xfa40, 1, 4157}, /* CJK COMPATIBILITY IDEOGRAPH-FA40 */
+  {0xfa41, 1, 4158}, /* CJK COMPATIBILITY IDEOGRAPH-FA41 */
+  {0xfa42, 1, 4159}, /* CJK COMPATIBILITY IDEOGRAPH-FA42 */
+  {0xfa43, 1, 4160}, /* CJK COMPATIBILITY IDEOGRAPH-FA43 */
+  {0xfa44, 1, 4161}, /* CJK COMPATIBILITY IDEOGRAPH-FA44 */
+  {0xfa45, 1, 4162}, /* CJK COMPATIBILITY IDEOGRAPH-FA45 */
+  {0xfa46, 1, 4163}, /* CJK COMPATIBILITY IDEOGRAPH-FA46 */
+  {0xfa47, 1, 4164}, /* CJK COMPATIBILITY IDEOGRAPH-FA47 */
+  {0xfa48, 1, 4165}, /* CJK COMPATIBILITY IDEOGRAPH-FA48 */
+  {0xfa49, 1, 4166}, /* CJK COMPATIBILITY IDEOGRAPH-FA49 */
+  {0xfa4a, 1, 4167}, /* CJK COMPATIBILITY IDEOGRAPH-FA4A */
+  {0xfa4b, 1, 4168}, /* CJK COMPATIBILITY IDEOGRAPH-FA4B */
+  {0xfa4c, 1, 2992}, /* CJK COMPATIBILITY IDEOGRAPH-FA4C */
+  {0xfa4d, 1, 4169}, /* CJK COMPATIBILITY IDEOGRAPH-FA4D */
+  {0xfa4e, 1, 4170}, /* CJK COMPATIBILITY IDEOGRAPH-FA4E */
+  {0xfa4f, 1, 4171}, /* CJK COMPATIBILITY IDEOGRAPH-FA4F */
+  {0xfa50, 1, 4172}, /* CJK COMPATIBILITY IDEOGRAPH-FA50 */
+  {0xfa51, 1, 3004}, /* CJK COMPATIBILITY IDEOGRAPH-FA51 */
+  {0xfa52, 1, 4173}, /* CJK COMPATIBILITY IDEOGRAPH-FA52 */
+  {0xfa53, 1, 4174}, /* CJK COMPATIBILITY IDEOGRAPH-FA53 */
+  {0xfa54, 1, 4175}, /* CJK COMPATIBILITY IDEOGRAPH-FA54 */
+  {0xfa55, 1, 4176}, /* CJK COMPATIBILITY IDEOGRAPH-FA55 */
+  {0xfa56, 1, 4177}, /* CJK COMPATIBILITY IDEOGRAPH-FA56 */
+  {0xfa57, 1, 4013}, /* CJK COMPATIBILITY IDEOGRAPH-FA57 */
+  {0xfa58, 1, 4178}, /* CJK COMPATIBILITY IDEOGRAPH-FA58 */
+  {0xfa59, 1, 4179}, /* CJK COMPATIBILITY IDEOGRAPH-FA59 */
+  {0xfa5a, 1, 4180}, /* CJK COMPATIBILITY IDEOGRAPH-FA5A */
+  {0xfa5b, 1, 4181}, /* CJK COMPATIBILITY IDEOGRAPH-FA5B */
+  {0xfa5c, 1, 4182}, /* CJK COMPATIBILITY IDEOGRAPH-FA5C */
+  {0xfa5d, 1, 4183}, /* CJK COMPATIBILITY IDEOGRAPH-FA5D */
+  {0xfa5e, 1, 4183}, /* CJK COMPATIBILITY IDEOGRAPH-FA5E */
+  {0xfa5f, 1, 4184}, /* CJK COMPATIBILITY IDEOGRAPH-FA5F */
+  {0xfa60, 1, 4185}, /* CJK COMPATIBILITY IDEOGRAPH-FA60 */
+  {0xfa61, 1, 4186}, /* CJK COMPATIBILITY IDEOGRAPH-FA61 */
+  {0xfa62, 1, 4187}, /* CJK COMPATIBILITY IDEOGRAPH-FA62 */
+  {0xfa63, 1, 4188}, /* CJK COMPATIBILITY IDEOGRAPH-FA63 */
+  {0xfa64, 1, 4189}, /* CJK COMPATIBILITY IDEOGRAPH-FA64 */
+  {0xfa65, 1, 4190}, /* CJK COMPATIBILITY IDEOGRAPH-FA65 */
+  {0xfa66, 1, 4191}, /* CJK COMPATIBILITY IDEOGRAPH-FA66 */
+  {0xfa67, 1, 4136}, /* CJK COMPATIBILITY IDEOGRAPH-FA67 */
+  {0xfa68, 1, 4192}, /* CJK COMPATIBILITY IDEOGRAPH-FA68 */
+  {0xfa69, 1, 4193}, /* CJK COMPATIBILITY IDEOGRAPH-FA69 */
+  {0xfa6a, 1, 4194}, /* CJK COMPATIBILITY IDEOGRAPH-FA6A */
+  {0xfb00, 2, 4195}, /* LATIN SMALL LIGATURE FF */
+  {0xfb01, 2, 4197}, /* LATIN SMALL LIGATURE FI */
+  {0xfb02, 2, 4199}, /* LATIN SMALL LIGATURE FL */
+  {0xfb03, 3, 4196}, /* LATIN SMALL LIGATURE FFI */
+  {0xfb04, 3, 4201}, /* LATIN SMALL LIGATURE FFL */
+  {0xfb05, 2, 4204}, /* LATIN SMALL LIGATURE LONG S T */
+  {0xfb06, 2, 4206}, /* LATIN SMALL LIGATURE ST */
+  {0xfb13, 2, 4208}, /* ARMENIAN SMALL LIGATURE MEN NOW */
+  {0xfb14, 2, 4210}, /* ARMENIAN SMALL LIGATURE MEN ECH */
+  {0xfb15, 2, 4212}, /* ARMENIAN SMALL LIGATURE MEN INI */
+  {0xfb16, 2, 4214}, /* ARMENIAN SMALL LIGATURE VEW NOW */
+  {0xfb17, 2, 4216}, /* ARMENIAN SMALL LIGATURE MEN XEH */
+  {0xfb1d, 2, 4218}, /* HEBREW LETTER YOD WITH HIRIQ */
+  {0xfb1f, 2, 4220}, /* HEBREW LIGATURE YIDDISH YOD YOD PATAH */
+  {0xfb20, 1, 4222}, /* HEBREW LETTER ALTERNATIVE AYIN */
+  {0xfb21, 1, 1950}, /* HEBREW LETTER WIDE ALEF */
+  {0xfb22, 1, 1953}, /* HEBREW LETTER WIDE DALET */
+  {0xfb23, 1, 4223}, /* HEBREW LETTER WIDE HE */
+  {0xfb24, 1, 4224}, /* HEBREW LETTER WIDE KAF */
+  {0xfb25, 1, 4225}, /* HEBREW LETTER WIDE LAMED */
+  {0xfb26, 1, 4226}, /* HEBREW LETTER WIDE FINAL MEM */
+  {0xfb27, 1, 4227}, /* HEBREW LETTER WIDE RESH */
+  {0xfb28, 1, 4228}, /* HEBREW LETTER WIDE TAV */
+  {0xfb29, 1, 1915}, /* HEBREW LETTER ALTERNATIVE PLUS SIGN */
+  {0xfb2a, 2, 4229}, /* HEBREW LETTER SHIN WITH SHIN DOT */
+  {0xfb2b, 2, 4231}, /* HEBREW LETTER SHIN WITH SIN DOT */
+  {0xfb2c, 2, 4233}, /* HEBREW LETTER SHIN WITH DAGESH AND SHIN DOT */
+  {0xfb2d, 2, 4235}, /* HEBREW LETTER SHIN WITH DAGESH AND SIN DOT */
+  {0xfb2e, 2, 4237}, /* HEBREW LETTER ALEF WITH PATAH */
+  {0xfb2f, 2, 4239}, /* HEBREW LETTER ALEF WITH QAMATS */
+  {0xfb30, 2, 4241}, /* HEBREW LETTER ALEF WITH MAPIQ */
+  {0xfb31, 2, 4243}, /* HEBREW LETTER BET WITH DAGESH */
+  {0xfb32, 2, 4245}, /* HEBREW LETTER GIMEL WITH DAGESH */
+  {0xfb33, 2, 4247}, /* HEBREW LETTER DALET WITH DAGESH */
+  {0xfb34, 2, 4249}, /* HEBREW LETTER HE WITH MAPIQ */
+  {0xfb35, 2, 4251}, /* HEBREW LETTER VAV WITH DAGESH */
+  {0xfb36, 2, 4253}, /* HEBREW LETTER ZAYIN WITH DAGESH */
+  {0xfb38, 2, 4255}, /* HEBREW LETTER TET WITH DAGESH */
+  {0xfb39, 2, 4257}, /* HEBREW LETTER YOD WITH DAGESH */
+  {0xfb3a, 2, 4259}, /* HEBREW LETTER FINAL KAF WITH DAGESH */
+  {0xfb3b, 2, 4261}, /* HEBREW LETTER KAF WITH DAGESH */
+  {0xfb3c, 2, 4263}, /* HEBREW LETTER LAMED WITH DAGESH */
+  {0xfb3e, 2, 4265}, /* HEBREW LETTER MEM WITH DAGESH */
+  {0xfb40, 2, 4267}, /* HEBREW LETTER NUN WITH DAGESH */
+  {0xfb41, 2, 4269}, /* HEBREW LETTER SAMEKH WITH DAGESH */
+  {0xfb43, 2, 4271}, /* HEBREW LETTER FINAL PE WITH DAGESH */
+  {0xfb44, 2, 4273}, /* HEBREW LETTER PE WITH DAGESH */
+  {0xfb46, 2, 4275}, /* HEBREW LETTER TSADI WITH DAGESH */
+  {0xfb47, 2, 4277}, /* HEBREW LETTER QOF WITH DAGESH */
+  {0xfb48, 2, 4279}, /* HEBREW LETTER RESH WITH DAGESH */
+  {0xfb49, 2, 4281}, /* HEBREW LETTER SHIN WITH DAGESH */
+  {0xfb4a, 2, 4283}, /* HEBREW LETTER TAV WITH DAGESH */
+  {0xfb4b, 2, 4285}, /* HEBREW LETTER VAV WITH HOLAM */
+  {0xfb4c, 2, 4287}, /* HEBREW LETTER BET WITH RAFE */
+  {0xfb4d, 2, 4289}, /* HEBREW LETTER KAF WITH RAFE */
+  {0xfb4e, 2, 4291}, /* HEBREW LETTER PE WITH RAFE */
+  {0xfb4f, 2, 4293}, /* HEBREW LIGATURE ALEF LAMED */
+  {0xfb50, 1, 4295}, /* ARABIC LETTER ALEF WASLA ISOLATED FORM */
+  {0xfb51, 1, 4295}, /* ARABIC LETTER ALEF WASLA FINAL FORM */
+  {0xfb52, 1, 4296}, /* ARABIC LETTER BEEH ISOLATED FORM */
+  {0xfb53, 1, 4296}, /* ARABIC LETTER BEEH FINAL FORM */
+  {0xfb54, 1, 4296}, /* ARABIC LETTER BEEH INITIAL FORM */
+  {0xfb55, 1, 4296}, /* ARABIC LETTER BEEH MEDIAL FORM */
+  {0xfb56, 1, 4297}, /* ARABIC LETTER PEH ISOLATED FORM */
+  {0xfb57, 1, 4297}, /* ARABIC LETTER PEH FINAL FORM */
+  {0xfb58, 1, 4297}, /* ARABIC LETTER PEH INITIAL FORM */
+  {0xfb59, 1, 4297}, /* ARABIC LETTER PEH MEDIAL FORM */
+  {0xfb5a, 1, 4298}, /* ARABIC LETTER BEHEH ISOLATED FORM */
+  {0xfb5b, 1, 4298}, /* ARABIC LETTER BEHEH FINAL FORM */
+  {0xfb5c, 1, 4298}, /* ARABIC LETTER BEHEH INITIAL FORM */
+  {0xfb5d, 1, 4298}, /* ARABIC LETTER BEHEH MEDIAL FORM */
+  {0xfb5e, 1, 4299}, /* ARABIC LETTER TTEHEH ISOLATED FORM */
+  {0xfb5f, 1, 4299}, /* ARABIC LETTER TTEHEH FINAL FORM */
+  {0xfb60, 1, 4299}, /* ARABIC LETTER TTEHEH INITIAL FORM */
+  {0xfb61, 1, 4299}, /* ARABIC LETTER TTEHEH MEDIAL FORM */
+  {0xfb62, 1, 4300}, /* ARABIC LETTER TEHEH ISOLATED FORM */
+  {0xfb63, 1, 4300}, /* ARABIC LETTER TEHEH FINAL FORM */
+  {0xfb64, 1, 4300}, /* ARABIC LETTER TEHEH INITIAL FORM */
+  {0xfb65, 1, 4300}, /* ARABIC LETTER TEHEH MEDIAL FORM */
+  {0xfb66, 1, 4301}, /* ARABIC LETTER TTEH ISOLATED FORM */
+  {0xfb67, 1, 4301}, /* ARABIC LETTER TTEH FINAL FORM */
+  {0xfb68, 1, 4301}, /* ARABIC LETTER TTEH INITIAL FORM */
+  {0xfb69, 1, 4301}, /* ARABIC LETTER TTEH MEDIAL FORM */
+  {0xfb6a, 1, 4302}, /* ARABIC LETTER VEH ISOLATED FORM */
+  {0xfb6b, 1, 4302}, /* ARABIC LETTER VEH FINAL FORM */
+  {0xfb6c, 1, 4302}, /* ARABIC LETTER VEH INITIAL FORM */
+  {0xfb6d, 1, 4302}, /* ARABIC LETTER VEH MEDIAL FORM */
+  {0xfb6e, 1, 4303}, /* ARABIC LETTER PEHEH ISOLATED FORM */
+  {0xfb6f, 1, 4303}, /* ARABIC LETTER PEHEH FINAL FORM */
+  {0xfb70, 1, 4303}, /* ARABIC LETTER PEHEH INITIAL FORM */
+  {0xfb71, 1, 4303}, /* ARABIC LETTER PEHEH MEDIAL FORM */
+  {0xfb72, 1, 4304}, /* ARABIC LETTER DYEH ISOLATED FORM */
+  {0xfb73, 1, 4304}, /* ARABIC LETTER DYEH FINAL FORM */
+  {0xfb74, 1, 4304}, /* ARABIC LETTER DYEH INITIAL FORM */
+  {0xfb75, 1, 4304}, /* ARABIC LETTER DYEH MEDIAL FORM */
+  {0xfb76, 1, 4305}, /* ARABIC LETTER NYEH ISOLATED FORM */
+  {0xfb77, 1, 4305}, /* ARABIC LETTER NYEH FINAL FORM */
+  {0xfb78, 1, 4305}, /* ARABIC LETTER NYEH INITIAL FORM */
+  {0xfb79, 1, 4305}, /* ARABIC LETTER NYEH MEDIAL FORM */
+  {0xfb7a, 1, 4306}, /* ARABIC LETTER TCHEH ISOLATED FORM */
+  {0xfb7b, 1, 4306}, /* ARABIC LETTER TCHEH FINAL FORM */
+  {0xfb7c, 1, 4306}, /* ARABIC LETTER TCHEH INITIAL FORM */
+  {0xfb7d, 1, 4306}, /* ARABIC LETTER TCHEH MEDIAL FORM */
+  {0xfb7e, 1, 4307}, /* ARABIC LETTER TCHEHEH ISOLATED FORM */
+  {0xfb7f, 1, 4307}, /* ARABIC LETTER TCHEHEH FINAL FORM */
+  {0xfb80, 1, 4307}, /* ARABIC LETTER TCHEHEH INITIAL FORM */
+  {0xfb81, 1, 4307}, /* ARABIC LETTER TCHEHEH MEDIAL FORM */
+  {0xfb82, 1, 4308}, /* ARABIC LETTER DDAHAL ISOLATED FORM */
+  {0xfb83, 1, 4308}, /* ARABIC LETTER DDAHAL FINAL FORM */
+  {0xfb84, 1, 4309}, /* ARABIC LETTER DAHAL ISOLATED FORM */
+  {0xfb85, 1, 4309}, /* ARABIC LETTER DAHAL FINAL FORM */
+  {0xfb86, 1, 4310}, /* ARABIC LETTER DUL ISOLATED FORM */
+  {0xfb87, 1, 4310}, /* ARABIC LETTER DUL FINAL FORM */
+  {0xfb88, 1, 4311}, /* ARABIC LETTER DDAL ISOLATED FORM */
+  {0xfb89, 1, 4311}, /* ARABIC LETTER DDAL FINAL FORM */
+  {0xfb8a, 1, 4312}, /* ARABIC LETTER JEH ISOLATED FORM */
+  {0xfb8b, 1, 4312}, /* ARABIC LETTER JEH FINAL FORM */
+  {0xfb8c, 1, 4313}, /* ARABIC LETTER RREH ISOLATED FORM */
+  {0xfb8d, 1, 4313}, /* ARABIC LETTER RREH FINAL FORM */
+  {0xfb8e, 1, 4314}, /* ARABIC LETTER KEHEH ISOLATED FORM */
+  {0xfb8f, 1, 4314}, /* ARABIC LETTER KEHEH FINAL FORM */
+  {0xfb90, 1, 4314}, /* ARABIC LETTER KEHEH INITIAL FORM */
+  {0xfb91, 1, 4314}, /* ARABIC LETTER KEHEH MEDIAL FORM */
+  {0xfb92, 1, 4315}, /* ARABIC LETTER GAF ISOLATED FORM */
+  {0xfb93, 1, 4315}, /* ARABIC LETTER GAF FINAL FORM */
+  {0xfb94, 1, 4315}, /* ARABIC LETTER GAF INITIAL FORM */
+  {0xfb95, 1, 4315}, /* ARABIC LETTER GAF MEDIAL FORM */
+  {0xfb96, 1, 4316}, /* ARABIC LETTER GUEH ISOLATED FORM */
+  {0xfb97, 1, 4316}, /* ARABIC LETTER GUEH FINAL FORM */
+  {0xfb98, 1, 4316}, /* ARABIC LETTER GUEH INITIAL FORM */
+  {0xfb99, 1, 4316}, /* ARABIC LETTER GUEH MEDIAL FORM */
+  {0xfb9a, 1, 4317}, /* ARABIC LETTER NGOEH ISOLATED FORM */
+  {0xfb9b, 1, 4317}, /* ARABIC LETTER NGOEH FINAL FORM */
+  {0xfb9c, 1, 4317}, /* ARABIC LETTER NGOEH INITIAL FORM */
+  {0xfb9d, 1, 4317}, /* ARABIC LETTER NGOEH MEDIAL FORM */
+  {0xfb9e, 1, 4318}, /* ARABIC LETTER NOON GHUNNA ISOLATED FORM */
+  {0xfb9f, 1, 4318}, /* ARABIC LETTER NOON GHUNNA FINAL FORM */
+  {0xfba0, 1, 4319}, /* ARABIC LETTER RNOON ISOLATED FORM */
+  {0xfba1, 1, 4319}, /* ARABIC LETTER RNOON FINAL FORM */
+  {0xfba2, 1, 4319}, /* ARABIC LETTER RNOON INITIAL FORM */
+  {0xfba3, 1, 4319}, /* ARABIC LETTER RNOON MEDIAL FORM */
+  {0xfba4, 1, 4320}, /* ARABIC LETTER HEH WITH YEH ABOVE ISOLATED FORM */
+  {0xfba5, 1, 4320}, /* ARABIC LETTER HEH WITH YEH ABOVE FINAL FORM */
+  {0xfba6, 1, 769}, /* ARABIC LETTER HEH GOAL ISOLATED FORM */
+  {0xfba7, 1, 769}, /* ARABIC LETTER HEH GOAL FINAL FORM */
+  {0xfba8, 1, 769}, /* ARABIC LETTER HEH GOAL INITIAL FORM */
+  {0xfba9, 1, 769}, /* ARABIC LETTER HEH GOAL MEDIAL FORM */
+  {0xfbaa, 1, 4321}, /* ARABIC LETTER HEH DOACHASHMEE ISOLATED FORM */
+  {0xfbab, 1, 4321}, /* ARABIC LETTER HEH DOACHASHMEE FINAL FORM */
+  {0xfbac, 1, 4321}, /* ARABIC LETTER HEH DOACHASHMEE INITIAL FORM */
+  {0xfbad, 1, 4321}, /* ARABIC LETTER HEH DOACHASHMEE MEDIAL FORM */
+  {0xfbae, 1, 771}, /* ARABIC LETTER YEH BARREE ISOLATED FORM */
+  {0xfbaf, 1, 771}, /* ARABIC LETTER YEH BARREE FINAL FORM */
+  {0xfbb0, 1, 4322}, /* ARABIC LETTER YEH BARREE WITH HAMZA ABOVE ISOLATED FORM */
+  {0xfbb1, 1, 4322}, /* ARABIC LETTER YEH BARREE WITH HAMZA ABOVE FINAL FORM */
+  {0xfbd3, 1, 4323}, /* ARABIC LETTER NG ISOLATED FORM */
+  {0xfbd4, 1, 4323}, /* ARABIC LETTER NG FINAL FORM */
+  {0xfbd5, 1, 4323}, /* ARABIC LETTER NG INITIAL FORM */
+  {0xfbd6, 1, 4323}, /* ARABIC LETTER NG MEDIAL FORM */
+  {0xfbd7, 1, 763}, /* ARABIC LETTER U ISOLATED FORM */
+  {0xfbd8, 1, 763}, /* ARABIC LETTER U FINAL FORM */
+  {0xfbd9, 1, 4324}, /* ARABIC LETTER OE ISOLATED FORM */
+  {0xfbda, 1, 4324}, /* ARABIC LETTER OE FINAL FORM */
+  {0xfbdb, 1, 4325}, /* ARABIC LETTER YU ISOLATED FORM */
+  {0xfbdc, 1, 4325}, /* ARABIC LETTER YU FINAL FORM */
+  {0xfbdd, 1, 4326}, /* ARABIC LETTER U WITH HAMZA ABOVE ISOLATED FORM */
+  {0xfbde, 1, 4327}, /* ARABIC LETTER VE ISOLATED FORM */
+  {0xfbdf, 1, 4327}, /* ARABIC LETTER VE FINAL FORM */
+  {0xfbe0, 1, 4328}, /* ARABIC LETTER KIRGHIZ OE ISOLATED FORM */
+  {0xfbe1, 1, 4328}, /* ARABIC LETTER KIRGHIZ OE FINAL FORM */
+  {0xfbe2, 1, 4329}, /* ARABIC LETTER KIRGHIZ YU ISOLATED FORM */
+  {0xfbe3, 1, 4329}, /* ARABIC LETTER KIRGHIZ YU FINAL FORM */
+  {0xfbe4, 1, 4330}, /* ARABIC LETTER E ISOLATED FORM */
+  {0xfbe5, 1, 4330}, /* ARABIC LETTER E FINAL FORM */
+  {0xfbe6, 1, 4330}, /* ARABIC LETTER E INITIAL FORM */
+  {0xfbe7, 1, 4330}, /* ARABIC LETTER E MEDIAL FORM */
+  {0xfbe8, 1, 4331}, /* ARABIC LETTER UIGHUR KAZAKH KIRGHIZ ALEF MAKSURA INITIAL FORM */
+  {0xfbe9, 1, 4331}, /* ARABIC LETTER UIGHUR KAZAKH KIRGHIZ ALEF MAKSURA MEDIAL FORM */
+  {0xfbea, 2, 4332}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH ALEF ISOLATED FORM */
+  {0xfbeb, 2, 4332}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH ALEF FINAL FORM */
+  {0xfbec, 2, 4334}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH AE ISOLATED FORM */
+  {0xfbed, 2, 4334}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH AE FINAL FORM */
+  {0xfbee, 2, 4336}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH WAW ISOLATED FORM */
+  {0xfbef, 2, 4336}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH WAW FINAL FORM */
+  {0xfbf0, 2, 4338}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH U ISOLATED FORM */
+  {0xfbf1, 2, 4338}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH U FINAL FORM */
+  {0xfbf2, 2, 4340}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH OE ISOLATED FORM */
+  {0xfbf3, 2, 4340}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH OE FINAL FORM */
+  {0xfbf4, 2, 4342}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH YU ISOLATED FORM */
+  {0xfbf5, 2, 4342}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH YU FINAL FORM */
+  {0xfbf6, 2, 4344}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH E ISOLATED FORM */
+  {0xfbf7, 2, 4344}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH E FINAL FORM */
+  {0xfbf8, 2, 4344}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH E INITIAL FORM */
+  {0xfbf9, 2, 4346}, /* ARABIC LIGATURE UIGHUR KIRGHIZ YEH WITH HAMZA ABOVE WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfbfa, 2, 4346}, /* ARABIC LIGATURE UIGHUR KIRGHIZ YEH WITH HAMZA ABOVE WITH ALEF MAKSURA FINAL FORM */
+  {0xfbfb, 2, 4346}, /* ARABIC LIGATURE UIGHUR KIRGHIZ YEH WITH HAMZA ABOVE WITH ALEF MAKSURA INITIAL FORM */
+  {0xfbfc, 1, 4348}, /* ARABIC LETTER FARSI YEH ISOLATED FORM */
+  {0xfbfd, 1, 4348}, /* ARABIC LETTER FARSI YEH FINAL FORM */
+  {0xfbfe, 1, 4348}, /* ARABIC LETTER FARSI YEH INITIAL FORM */
+  {0xfbff, 1, 4348}, /* ARABIC LETTER FARSI YEH MEDIAL FORM */
+  {0xfc00, 2, 4349}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH JEEM ISOLATED FORM */
+  {0xfc01, 2, 4351}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH HAH ISOLATED FORM */
+  {0xfc02, 2, 4353}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH MEEM ISOLATED FORM */
+  {0xfc03, 2, 4346}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc04, 2, 4355}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH YEH ISOLATED FORM */
+  {0xfc05, 2, 4357}, /* ARABIC LIGATURE BEH WITH JEEM ISOLATED FORM */
+  {0xfc06, 2, 4359}, /* ARABIC LIGATURE BEH WITH HAH ISOLATED FORM */
+  {0xfc07, 2, 4361}, /* ARABIC LIGATURE BEH WITH KHAH ISOLATED FORM */
+  {0xfc08, 2, 4363}, /* ARABIC LIGATURE BEH WITH MEEM ISOLATED FORM */
+  {0xfc09, 2, 4365}, /* ARABIC LIGATURE BEH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc0a, 2, 4367}, /* ARABIC LIGATURE BEH WITH YEH ISOLATED FORM */
+  {0xfc0b, 2, 4369}, /* ARABIC LIGATURE TEH WITH JEEM ISOLATED FORM */
+  {0xfc0c, 2, 4371}, /* ARABIC LIGATURE TEH WITH HAH ISOLATED FORM */
+  {0xfc0d, 2, 4373}, /* ARABIC LIGATURE TEH WITH KHAH ISOLATED FORM */
+  {0xfc0e, 2, 4375}, /* ARABIC LIGATURE TEH WITH MEEM ISOLATED FORM */
+  {0xfc0f, 2, 4377}, /* ARABIC LIGATURE TEH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc10, 2, 4379}, /* ARABIC LIGATURE TEH WITH YEH ISOLATED FORM */
+  {0xfc11, 2, 4381}, /* ARABIC LIGATURE THEH WITH JEEM ISOLATED FORM */
+  {0xfc12, 2, 4383}, /* ARABIC LIGATURE THEH WITH MEEM ISOLATED FORM */
+  {0xfc13, 2, 4385}, /* ARABIC LIGATURE THEH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc14, 2, 4387}, /* ARABIC LIGATURE THEH WITH YEH ISOLATED FORM */
+  {0xfc15, 2, 4389}, /* ARABIC LIGATURE JEEM WITH HAH ISOLATED FORM */
+  {0xfc16, 2, 4391}, /* ARABIC LIGATURE JEEM WITH MEEM ISOLATED FORM */
+  {0xfc17, 2, 4390}, /* ARABIC LIGATURE HAH WITH JEEM ISOLATED FORM */
+  {0xfc18, 2, 4393}, /* ARABIC LIGATURE HAH WITH MEEM ISOLATED FORM */
+  {0xfc19, 2, 4395}, /* ARABIC LIGATURE KHAH WITH JEEM ISOLATED FORM */
+  {0xfc1a, 2, 4397}, /* ARABIC LIGATURE KHAH WITH HAH ISOLATED FORM */
+  {0xfc1b, 2, 4399}, /* ARABIC LIGATURE KHAH WITH MEEM ISOLATED FORM */
+  {0xfc1c, 2, 4401}, /* ARABIC LIGATURE SEEN WITH JEEM ISOLATED FORM */
+  {0xfc1d, 2, 4403}, /* ARABIC LIGATURE SEEN WITH HAH ISOLATED FORM */
+  {0xfc1e, 2, 4405}, /* ARABIC LIGATURE SEEN WITH KHAH ISOLATED FORM */
+  {0xfc1f, 2, 4407}, /* ARABIC LIGATURE SEEN WITH MEEM ISOLATED FORM */
+  {0xfc20, 2, 4409}, /* ARABIC LIGATURE SAD WITH HAH ISOLATED FORM */
+  {0xfc21, 2, 4411}, /* ARABIC LIGATURE SAD WITH MEEM ISOLATED FORM */
+  {0xfc22, 2, 4413}, /* ARABIC LIGATURE DAD WITH JEEM ISOLATED FORM */
+  {0xfc23, 2, 4415}, /* ARABIC LIGATURE DAD WITH HAH ISOLATED FORM */
+  {0xfc24, 2, 4417}, /* ARABIC LIGATURE DAD WITH KHAH ISOLATED FORM */
+  {0xfc25, 2, 4419}, /* ARABIC LIGATURE DAD WITH MEEM ISOLATED FORM */
+  {0xfc26, 2, 4421}, /* ARABIC LIGATURE TAH WITH HAH ISOLATED FORM */
+  {0xfc27, 2, 4423}, /* ARABIC LIGATURE TAH WITH MEEM ISOLATED FORM */
+  {0xfc28, 2, 4425}, /* ARABIC LIGATURE ZAH WITH MEEM ISOLATED FORM */
+  {0xfc29, 2, 4427}, /* ARABIC LIGATURE AIN WITH JEEM ISOLATED FORM */
+  {0xfc2a, 2, 4429}, /* ARABIC LIGATURE AIN WITH MEEM ISOLATED FORM */
+  {0xfc2b, 2, 4431}, /* ARABIC LIGATURE GHAIN WITH JEEM ISOLATED FORM */
+  {0xfc2c, 2, 4433}, /* ARABIC LIGATURE GHAIN WITH MEEM ISOLATED FORM */
+  {0xfc2d, 2, 4435}, /* ARABIC LIGATURE FEH WITH JEEM ISOLATED FORM */
+  {0xfc2e, 2, 4437}, /* ARABIC LIGATURE FEH WITH HAH ISOLATED FORM */
+  {0xfc2f, 2, 4439}, /* ARABIC LIGATURE FEH WITH KHAH ISOLATED FORM */
+  {0xfc30, 2, 4441}, /* ARABIC LIGATURE FEH WITH MEEM ISOLATED FORM */
+  {0xfc31, 2, 4443}, /* ARABIC LIGATURE FEH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc32, 2, 4445}, /* ARABIC LIGATURE FEH WITH YEH ISOLATED FORM */
+  {0xfc33, 2, 4447}, /* ARABIC LIGATURE QAF WITH HAH ISOLATED FORM */
+  {0xfc34, 2, 4449}, /* ARABIC LIGATURE QAF WITH MEEM ISOLATED FORM */
+  {0xfc35, 2, 4451}, /* ARABIC LIGATURE QAF WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc36, 2, 4453}, /* ARABIC LIGATURE QAF WITH YEH ISOLATED FORM */
+  {0xfc37, 2, 4455}, /* ARABIC LIGATURE KAF WITH ALEF ISOLATED FORM */
+  {0xfc38, 2, 4457}, /* ARABIC LIGATURE KAF WITH JEEM ISOLATED FORM */
+  {0xfc39, 2, 4459}, /* ARABIC LIGATURE KAF WITH HAH ISOLATED FORM */
+  {0xfc3a, 2, 4461}, /* ARABIC LIGATURE KAF WITH KHAH ISOLATED FORM */
+  {0xfc3b, 2, 4463}, /* ARABIC LIGATURE KAF WITH LAM ISOLATED FORM */
+  {0xfc3c, 2, 4465}, /* ARABIC LIGATURE KAF WITH MEEM ISOLATED FORM */
+  {0xfc3d, 2, 4467}, /* ARABIC LIGATURE KAF WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc3e, 2, 4469}, /* ARABIC LIGATURE KAF WITH YEH ISOLATED FORM */
+  {0xfc3f, 2, 4471}, /* ARABIC LIGATURE LAM WITH JEEM ISOLATED FORM */
+  {0xfc40, 2, 4473}, /* ARABIC LIGATURE LAM WITH HAH ISOLATED FORM */
+  {0xfc41, 2, 4475}, /* ARABIC LIGATURE LAM WITH KHAH ISOLATED FORM */
+  {0xfc42, 2, 4477}, /* ARABIC LIGATURE LAM WITH MEEM ISOLATED FORM */
+  {0xfc43, 2, 4479}, /* ARABIC LIGATURE LAM WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc44, 2, 4481}, /* ARABIC LIGATURE LAM WITH YEH ISOLATED FORM */
+  {0xfc45, 2, 4483}, /* ARABIC LIGATURE MEEM WITH JEEM ISOLATED FORM */
+  {0xfc46, 2, 4392}, /* ARABIC LIGATURE MEEM WITH HAH ISOLATED FORM */
+  {0xfc47, 2, 4394}, /* ARABIC LIGATURE MEEM WITH KHAH ISOLATED FORM */
+  {0xfc48, 2, 4485}, /* ARABIC LIGATURE MEEM WITH MEEM ISOLATED FORM */
+  {0xfc49, 2, 4487}, /* ARABIC LIGATURE MEEM WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc4a, 2, 4489}, /* ARABIC LIGATURE MEEM WITH YEH ISOLATED FORM */
+  {0xfc4b, 2, 4491}, /* ARABIC LIGATURE NOON WITH JEEM ISOLATED FORM */
+  {0xfc4c, 2, 4493}, /* ARABIC LIGATURE NOON WITH HAH ISOLATED FORM */
+  {0xfc4d, 2, 4495}, /* ARABIC LIGATURE NOON WITH KHAH ISOLATED FORM */
+  {0xfc4e, 2, 4497}, /* ARABIC LIGATURE NOON WITH MEEM ISOLATED FORM */
+  {0xfc4f, 2, 4499}, /* ARABIC LIGATURE NOON WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc50, 2, 4501}, /* ARABIC LIGATURE NOON WITH YEH ISOLATED FORM */
+  {0xfc51, 2, 4503}, /* ARABIC LIGATURE HEH WITH JEEM ISOLATED FORM */
+  {0xfc52, 2, 4505}, /* ARABIC LIGATURE HEH WITH MEEM ISOLATED FORM */
+  {0xfc53, 2, 4507}, /* ARABIC LIGATURE HEH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc54, 2, 4509}, /* ARABIC LIGATURE HEH WITH YEH ISOLATED FORM */
+  {0xfc55, 2, 4388}, /* ARABIC LIGATURE YEH WITH JEEM ISOLATED FORM */
+  {0xfc56, 2, 4511}, /* ARABIC LIGATURE YEH WITH HAH ISOLATED FORM */
+  {0xfc57, 2, 4513}, /* ARABIC LIGATURE YEH WITH KHAH ISOLATED FORM */
+  {0xfc58, 2, 4482}, /* ARABIC LIGATURE YEH WITH MEEM ISOLATED FORM */
+  {0xfc59, 2, 4515}, /* ARABIC LIGATURE YEH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfc5a, 2, 4510}, /* ARABIC LIGATURE YEH WITH YEH ISOLATED FORM */
+  {0xfc5b, 2, 4517}, /* ARABIC LIGATURE THAL WITH SUPERSCRIPT ALEF ISOLATED FORM */
+  {0xfc5c, 2, 4519}, /* ARABIC LIGATURE REH WITH SUPERSCRIPT ALEF ISOLATED FORM */
+  {0xfc5d, 2, 4521}, /* ARABIC LIGATURE ALEF MAKSURA WITH SUPERSCRIPT ALEF ISOLATED FORM */
+  {0xfc5e, 3, 4523}, /* ARABIC LIGATURE SHADDA WITH DAMMATAN ISOLATED FORM */
+  {0xfc5f, 3, 4526}, /* ARABIC LIGATURE SHADDA WITH KASRATAN ISOLATED FORM */
+  {0xfc60, 3, 4529}, /* ARABIC LIGATURE SHADDA WITH FATHA ISOLATED FORM */
+  {0xfc61, 3, 4532}, /* ARABIC LIGATURE SHADDA WITH DAMMA ISOLATED FORM */
+  {0xfc62, 3, 4535}, /* ARABIC LIGATURE SHADDA WITH KASRA ISOLATED FORM */
+  {0xfc63, 3, 4538}, /* ARABIC LIGATURE SHADDA WITH SUPERSCRIPT ALEF ISOLATED FORM */
+  {0xfc64, 2, 4541}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH REH FINAL FORM */
+  {0xfc65, 2, 4543}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH ZAIN FINAL FORM */
+  {0xfc66, 2, 4353}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH MEEM FINAL FORM */
+  {0xfc67, 2, 4545}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH NOON FINAL FORM */
+  {0xfc68, 2, 4346}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH ALEF MAKSURA FINAL FORM */
+  {0xfc69, 2, 4355}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH YEH FINAL FORM */
+  {0xfc6a, 2, 4547}, /* ARABIC LIGATURE BEH WITH REH FINAL FORM */
+  {0xfc6b, 2, 4549}, /* ARABIC LIGATURE BEH WITH ZAIN FINAL FORM */
+  {0xfc6c, 2, 4363}, /* ARABIC LIGATURE BEH WITH MEEM FINAL FORM */
+  {0xfc6d, 2, 4551}, /* ARABIC LIGATURE BEH WITH NOON FINAL FORM */
+  {0xfc6e, 2, 4365}, /* ARABIC LIGATURE BEH WITH ALEF MAKSURA FINAL FORM */
+  {0xfc6f, 2, 4367}, /* ARABIC LIGATURE BEH WITH YEH FINAL FORM */
+  {0xfc70, 2, 4553}, /* ARABIC LIGATURE TEH WITH REH FINAL FORM */
+  {0xfc71, 2, 4555}, /* ARABIC LIGATURE TEH WITH ZAIN FINAL FORM */
+  {0xfc72, 2, 4375}, /* ARABIC LIGATURE TEH WITH MEEM FINAL FORM */
+  {0xfc73, 2, 4557}, /* ARABIC LIGATURE TEH WITH NOON FINAL FORM */
+  {0xfc74, 2, 4377}, /* ARABIC LIGATURE TEH WITH ALEF MAKSURA FINAL FORM */
+  {0xfc75, 2, 4379}, /* ARABIC LIGATURE TEH WITH YEH FINAL FORM */
+  {0xfc76, 2, 4559}, /* ARABIC LIGATURE THEH WITH REH FINAL FORM */
+  {0xfc77, 2, 4561}, /* ARABIC LIGATURE THEH WITH ZAIN FINAL FORM */
+  {0xfc78, 2, 4383}, /* ARABIC LIGATURE THEH WITH MEEM FINAL FORM */
+  {0xfc79, 2, 4563}, /* ARABIC LIGATURE THEH WITH NOON FINAL FORM */
+  {0xfc7a, 2, 4385}, /* ARABIC LIGATURE THEH WITH ALEF MAKSURA FINAL FORM */
+  {0xfc7b, 2, 4387}, /* ARABIC LIGATURE THEH WITH YEH FINAL FORM */
+  {0xfc7c, 2, 4443}, /* ARABIC LIGATURE FEH WITH ALEF MAKSURA FINAL FORM */
+  {0xfc7d, 2, 4445}, /* ARABIC LIGATURE FEH WITH YEH FINAL FORM */
+  {0xfc7e, 2, 4451}, /* ARABIC LIGATURE QAF WITH ALEF MAKSURA FINAL FORM */
+  {0xfc7f, 2, 4453}, /* ARABIC LIGATURE QAF WITH YEH FINAL FORM */
+  {0xfc80, 2, 4455}, /* ARABIC LIGATURE KAF WITH ALEF FINAL FORM */
+  {0xfc81, 2, 4463}, /* ARABIC LIGATURE KAF WITH LAM FINAL FORM */
+  {0xfc82, 2, 4465}, /* ARABIC LIGATURE KAF WITH MEEM FINAL FORM */
+  {0xfc83, 2, 4467}, /* ARABIC LIGATURE KAF WITH ALEF MAKSURA FINAL FORM */
+  {0xfc84, 2, 4469}, /* ARABIC LIGATURE KAF WITH YEH FINAL FORM */
+  {0xfc85, 2, 4477}, /* ARABIC LIGATURE LAM WITH MEEM FINAL FORM */
+  {0xfc86, 2, 4479}, /* ARABIC LIGATURE LAM WITH ALEF MAKSURA FINAL FORM */
+  {0xfc87, 2, 4481}, /* ARABIC LIGATURE LAM WITH YEH FINAL FORM */
+  {0xfc88, 2, 4565}, /* ARABIC LIGATURE MEEM WITH ALEF FINAL FORM */
+  {0xfc89, 2, 4485}, /* ARABIC LIGATURE MEEM WITH MEEM FINAL FORM */
+  {0xfc8a, 2, 4567}, /* ARABIC LIGATURE NOON WITH REH FINAL FORM */
+  {0xfc8b, 2, 4569}, /* ARABIC LIGATURE NOON WITH ZAIN FINAL FORM */
+  {0xfc8c, 2, 4497}, /* ARABIC LIGATURE NOON WITH MEEM FINAL FORM */
+  {0xfc8d, 2, 4571}, /* ARABIC LIGATURE NOON WITH NOON FINAL FORM */
+  {0xfc8e, 2, 4499}, /* ARABIC LIGATURE NOON WITH ALEF MAKSURA FINAL FORM */
+  {0xfc8f, 2, 4501}, /* ARABIC LIGATURE NOON WITH YEH FINAL FORM */
+  {0xfc90, 2, 4521}, /* ARABIC LIGATURE ALEF MAKSURA WITH SUPERSCRIPT ALEF FINAL FORM */
+  {0xfc91, 2, 4573}, /* ARABIC LIGATURE YEH WITH REH FINAL FORM */
+  {0xfc92, 2, 4575}, /* ARABIC LIGATURE YEH WITH ZAIN FINAL FORM */
+  {0xfc93, 2, 4482}, /* ARABIC LIGATURE YEH WITH MEEM FINAL FORM */
+  {0xfc94, 2, 4490}, /* ARABIC LIGATURE YEH WITH NOON FINAL FORM */
+  {0xfc95, 2, 4515}, /* ARABIC LIGATURE YEH WITH ALEF MAKSURA FINAL FORM */
+  {0xfc96, 2, 4510}, /* ARABIC LIGATURE YEH WITH YEH FINAL FORM */
+  {0xfc97, 2, 4349}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH JEEM INITIAL FORM */
+  {0xfc98, 2, 4351}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH HAH INITIAL FORM */
+  {0xfc99, 2, 4577}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH KHAH INITIAL FORM */
+  {0xfc9a, 2, 4353}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH MEEM INITIAL FORM */
+  {0xfc9b, 2, 4579}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH HEH INITIAL FORM */
+  {0xfc9c, 2, 4357}, /* ARABIC LIGATURE BEH WITH JEEM INITIAL FORM */
+  {0xfc9d, 2, 4359}, /* ARABIC LIGATURE BEH WITH HAH INITIAL FORM */
+  {0xfc9e, 2, 4361}, /* ARABIC LIGATURE BEH WITH KHAH INITIAL FORM */
+  {0xfc9f, 2, 4363}, /* ARABIC LIGATURE BEH WITH MEEM INITIAL FORM */
+  {0xfca0, 2, 4581}, /* ARABIC LIGATURE BEH WITH HEH INITIAL FORM */
+  {0xfca1, 2, 4369}, /* ARABIC LIGATURE TEH WITH JEEM INITIAL FORM */
+  {0xfca2, 2, 4371}, /* ARABIC LIGATURE TEH WITH HAH INITIAL FORM */
+  {0xfca3, 2, 4373}, /* ARABIC LIGATURE TEH WITH KHAH INITIAL FORM */
+  {0xfca4, 2, 4375}, /* ARABIC LIGATURE TEH WITH MEEM INITIAL FORM */
+  {0xfca5, 2, 4583}, /* ARABIC LIGATURE TEH WITH HEH INITIAL FORM */
+  {0xfca6, 2, 4383}, /* ARABIC LIGATURE THEH WITH MEEM INITIAL FORM */
+  {0xfca7, 2, 4389}, /* ARABIC LIGATURE JEEM WITH HAH INITIAL FORM */
+  {0xfca8, 2, 4391}, /* ARABIC LIGATURE JEEM WITH MEEM INITIAL FORM */
+  {0xfca9, 2, 4390}, /* ARABIC LIGATURE HAH WITH JEEM INITIAL FORM */
+  {0xfcaa, 2, 4393}, /* ARABIC LIGATURE HAH WITH MEEM INITIAL FORM */
+  {0xfcab, 2, 4395}, /* ARABIC LIGATURE KHAH WITH JEEM INITIAL FORM */
+  {0xfcac, 2, 4399}, /* ARABIC LIGATURE KHAH WITH MEEM INITIAL FORM */
+  {0xfcad, 2, 4401}, /* ARABIC LIGATURE SEEN WITH JEEM INITIAL FORM */
+  {0xfcae, 2, 4403}, /* ARABIC LIGATURE SEEN WITH HAH INITIAL FORM */
+  {0xfcaf, 2, 4405}, /* ARABIC LIGATURE SEEN WITH KHAH INITIAL FORM */
+  {0xfcb0, 2, 4407}, /* ARABIC LIGATURE SEEN WITH MEEM INITIAL FORM */
+  {0xfcb1, 2, 4409}, /* ARABIC LIGATURE SAD WITH HAH INITIAL FORM */
+  {0xfcb2, 2, 4585}, /* ARABIC LIGATURE SAD WITH KHAH INITIAL FORM */
+  {0xfcb3, 2, 4411}, /* ARABIC LIGATURE SAD WITH MEEM INITIAL FORM */
+  {0xfcb4, 2, 4413}, /* ARABIC LIGATURE DAD WITH JEEM INITIAL FORM */
+  {0xfcb5, 2, 4415}, /* ARABIC LIGATURE DAD WITH HAH INITIAL FORM */
+  {0xfcb6, 2, 4417}, /* ARABIC LIGATURE DAD WITH KHAH INITIAL FORM */
+  {0xfcb7, 2, 4419}, /* ARABIC LIGATURE DAD WITH MEEM INITIAL FORM */
+  {0xfcb8, 2, 4421}, /* ARABIC LIGATURE TAH WITH HAH INITIAL FORM */
+  {0xfcb9, 2, 4425}, /* ARABIC LIGATURE ZAH WITH MEEM INITIAL FORM */
+  {0xfcba, 2, 4427}, /* ARABIC LIGATURE AIN WITH JEEM INITIAL FORM */
+  {0xfcbb, 2, 4429}, /* ARABIC LIGATURE AIN WITH MEEM INITIAL FORM */
+  {0xfcbc, 2, 4431}, /* ARABIC LIGATURE GHAIN WITH JEEM INITIAL FORM */
+  {0xfcbd, 2, 4433}, /* ARABIC LIGATURE GHAIN WITH MEEM INITIAL FORM */
+  {0xfcbe, 2, 4435}, /* ARABIC LIGATURE FEH WITH JEEM INITIAL FORM */
+  {0xfcbf, 2, 4437}, /* ARABIC LIGATURE FEH WITH HAH INITIAL FORM */
+  {0xfcc0, 2, 4439}, /* ARABIC LIGATURE FEH WITH KHAH INITIAL FORM */
+  {0xfcc1, 2, 4441}, /* ARABIC LIGATURE FEH WITH MEEM INITIAL FORM */
+  {0xfcc2, 2, 4447}, /* ARABIC LIGATURE QAF WITH HAH INITIAL FORM */
+  {0xfcc3, 2, 4449}, /* ARABIC LIGATURE QAF WITH MEEM INITIAL FORM */
+  {0xfcc4, 2, 4457}, /* ARABIC LIGATURE KAF WITH JEEM INITIAL FORM */
+  {0xfcc5, 2, 4459}, /* ARABIC LIGATURE KAF WITH HAH INITIAL FORM */
+  {0xfcc6, 2, 4461}, /* ARABIC LIGATURE KAF WITH KHAH INITIAL FORM */
+  {0xfcc7, 2, 4463}, /* ARABIC LIGATURE KAF WITH LAM INITIAL FORM */
+  {0xfcc8, 2, 4465}, /* ARABIC LIGATURE KAF WITH MEEM INITIAL FORM */
+  {0xfcc9, 2, 4471}, /* ARABIC LIGATURE LAM WITH JEEM INITIAL FORM */
+  {0xfcca, 2, 4473}, /* ARABIC LIGATURE LAM WITH HAH INITIAL FORM */
+  {0xfccb, 2, 4475}, /* ARABIC LIGATURE LAM WITH KHAH INITIAL FORM */
+  {0xfccc, 2, 4477}, /* ARABIC LIGATURE LAM WITH MEEM INITIAL FORM */
+  {0xfccd, 2, 4587}, /* ARABIC LIGATURE LAM WITH HEH INITIAL FORM */
+  {0xfcce, 2, 4483}, /* ARABIC LIGATURE MEEM WITH JEEM INITIAL FORM */
+  {0xfccf, 2, 4392}, /* ARABIC LIGATURE MEEM WITH HAH INITIAL FORM */
+  {0xfcd0, 2, 4394}, /* ARABIC LIGATURE MEEM WITH KHAH INITIAL FORM */
+  {0xfcd1, 2, 4485}, /* ARABIC LIGATURE MEEM WITH MEEM INITIAL FORM */
+  {0xfcd2, 2, 4491}, /* ARABIC LIGATURE NOON WITH JEEM INITIAL FORM */
+  {0xfcd3, 2, 4493}, /* ARABIC LIGATURE NOON WITH HAH INITIAL FORM */
+  {0xfcd4, 2, 4495}, /* ARABIC LIGATURE NOON WITH KHAH INITIAL FORM */
+  {0xfcd5, 2, 4497}, /* ARABIC LIGATURE NOON WITH MEEM INITIAL FORM */
+  {0xfcd6, 2, 4589}, /* ARABIC LIGATURE NOON WITH HEH INITIAL FORM */
+  {0xfcd7, 2, 4503}, /* ARABIC LIGATURE HEH WITH JEEM INITIAL FORM */
+  {0xfcd8, 2, 4505}, /* ARABIC LIGATURE HEH WITH MEEM INITIAL FORM */
+  {0xfcd9, 2, 4591}, /* ARABIC LIGATURE HEH WITH SUPERSCRIPT ALEF INITIAL FORM */
+  {0xfcda, 2, 4388}, /* ARABIC LIGATURE YEH WITH JEEM INITIAL FORM */
+  {0xfcdb, 2, 4511}, /* ARABIC LIGATURE YEH WITH HAH INITIAL FORM */
+  {0xfcdc, 2, 4513}, /* ARABIC LIGATURE YEH WITH KHAH INITIAL FORM */
+  {0xfcdd, 2, 4482}, /* ARABIC LIGATURE YEH WITH MEEM INITIAL FORM */
+  {0xfcde, 2, 4502}, /* ARABIC LIGATURE YEH WITH HEH INITIAL FORM */
+  {0xfcdf, 2, 4353}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH MEEM MEDIAL FORM */
+  {0xfce0, 2, 4579}, /* ARABIC LIGATURE YEH WITH HAMZA ABOVE WITH HEH MEDIAL FORM */
+  {0xfce1, 2, 4363}, /* ARABIC LIGATURE BEH WITH MEEM MEDIAL FORM */
+  {0xfce2, 2, 4581}, /* ARABIC LIGATURE BEH WITH HEH MEDIAL FORM */
+  {0xfce3, 2, 4375}, /* ARABIC LIGATURE TEH WITH MEEM MEDIAL FORM */
+  {0xfce4, 2, 4583}, /* ARABIC LIGATURE TEH WITH HEH MEDIAL FORM */
+  {0xfce5, 2, 4383}, /* ARABIC LIGATURE THEH WITH MEEM MEDIAL FORM */
+  {0xfce6, 2, 4593}, /* ARABIC LIGATURE THEH WITH HEH MEDIAL FORM */
+  {0xfce7, 2, 4407}, /* ARABIC LIGATURE SEEN WITH MEEM MEDIAL FORM */
+  {0xfce8, 2, 4595}, /* ARABIC LIGATURE SEEN WITH HEH MEDIAL FORM */
+  {0xfce9, 2, 4597}, /* ARABIC LIGATURE SHEEN WITH MEEM MEDIAL FORM */
+  {0xfcea, 2, 4599}, /* ARABIC LIGATURE SHEEN WITH HEH MEDIAL FORM */
+  {0xfceb, 2, 4463}, /* ARABIC LIGATURE KAF WITH LAM MEDIAL FORM */
+  {0xfcec, 2, 4465}, /* ARABIC LIGATURE KAF WITH MEEM MEDIAL FORM */
+  {0xfced, 2, 4477}, /* ARABIC LIGATURE LAM WITH MEEM MEDIAL FORM */
+  {0xfcee, 2, 4497}, /* ARABIC LIGATURE NOON WITH MEEM MEDIAL FORM */
+  {0xfcef, 2, 4589}, /* ARABIC LIGATURE NOON WITH HEH MEDIAL FORM */
+  {0xfcf0, 2, 4482}, /* ARABIC LIGATURE YEH WITH MEEM MEDIAL FORM */
+  {0xfcf1, 2, 4502}, /* ARABIC LIGATURE YEH WITH HEH MEDIAL FORM */
+  {0xfcf2, 3, 4601}, /* ARABIC LIGATURE SHADDA WITH FATHA MEDIAL FORM */
+  {0xfcf3, 3, 4604}, /* ARABIC LIGATURE SHADDA WITH DAMMA MEDIAL FORM */
+  {0xfcf4, 3, 4607}, /* ARABIC LIGATURE SHADDA WITH KASRA MEDIAL FORM */
+  {0xfcf5, 2, 4610}, /* ARABIC LIGATURE TAH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfcf6, 2, 4612}, /* ARABIC LIGATURE TAH WITH YEH ISOLATED FORM */
+  {0xfcf7, 2, 4614}, /* ARABIC LIGATURE AIN WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfcf8, 2, 4616}, /* ARABIC LIGATURE AIN WITH YEH ISOLATED FORM */
+  {0xfcf9, 2, 4618}, /* ARABIC LIGATURE GHAIN WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfcfa, 2, 4620}, /* ARABIC LIGATURE GHAIN WITH YEH ISOLATED FORM */
+  {0xfcfb, 2, 4622}, /* ARABIC LIGATURE SEEN WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfcfc, 2, 4624}, /* ARABIC LIGATURE SEEN WITH YEH ISOLATED FORM */
+  {0xfcfd, 2, 4626}, /* ARABIC LIGATURE SHEEN WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfcfe, 2, 4628}, /* ARABIC LIGATURE SHEEN WITH YEH ISOLATED FORM */
+  {0xfcff, 2, 4630}, /* ARABIC LIGATURE HAH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfd00, 2, 4512}, /* ARABIC LIGATURE HAH WITH YEH ISOLATED FORM */
+  {0xfd01, 2, 4632}, /* ARABIC LIGATURE JEEM WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfd02, 2, 4634}, /* ARABIC LIGATURE JEEM WITH YEH ISOLATED FORM */
+  {0xfd03, 2, 4636}, /* ARABIC LIGATURE KHAH WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfd04, 2, 4514}, /* ARABIC LIGATURE KHAH WITH YEH ISOLATED FORM */
+  {0xfd05, 2, 4638}, /* ARABIC LIGATURE SAD WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfd06, 2, 4640}, /* ARABIC LIGATURE SAD WITH YEH ISOLATED FORM */
+  {0xfd07, 2, 4642}, /* ARABIC LIGATURE DAD WITH ALEF MAKSURA ISOLATED FORM */
+  {0xfd08, 2, 4644}, /* ARABIC LIGATURE DAD WITH YEH ISOLATED FORM */
+  {0xfd09, 2, 4646}, /* ARABIC LIGATURE SHEEN WITH JEEM ISOLATED FORM */
+  {0xfd0a, 2, 4648}, /* ARABIC LIGATURE SHEEN WITH HAH ISOLATED FORM */
+  {0xfd0b, 2, 4650}, /* ARABIC LIGATURE SHEEN WITH KHAH ISOLATED FORM */
+  {0xfd0c, 2, 4597}, /* ARABIC LIGATURE SHEEN WITH MEEM ISOLATED FORM */
+  {0xfd0d, 2, 4652}, /* ARABIC LIGATURE SHEEN WITH REH ISOLATED FORM */
+  {0xfd0e, 2, 4654}, /* ARABIC LIGATURE SEEN WITH REH ISOLATED FORM */
+  {0xfd0f, 2, 4656}, /* ARABIC LIGATURE SAD WITH REH ISOLATED FORM */
+  {0xfd10, 2, 4658}, /* ARABIC LIGATURE DAD WITH REH ISOLATED FORM */
+  {0xfd11, 2, 4610}, /* ARABIC LIGATURE TAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfd12, 2, 4612}, /* ARABIC LIGATURE TAH WITH YEH FINAL FORM */
+  {0xfd13, 2, 4614}, /* ARABIC LIGATURE AIN WITH ALEF MAKSURA FINAL FORM */
+  {0xfd14, 2, 4616}, /* ARABIC LIGATURE AIN WITH YEH FINAL FORM */
+  {0xfd15, 2, 4618}, /* ARABIC LIGATURE GHAIN WITH ALEF MAKSURA FINAL FORM */
+  {0xfd16, 2, 4620}, /* ARABIC LIGATURE GHAIN WITH YEH FINAL FORM */
+  {0xfd17, 2, 4622}, /* ARABIC LIGATURE SEEN WITH ALEF MAKSURA FINAL FORM */
+  {0xfd18, 2, 4624}, /* ARABIC LIGATURE SEEN WITH YEH FINAL FORM */
+  {0xfd19, 2, 4626}, /* ARABIC LIGATURE SHEEN WITH ALEF MAKSURA FINAL FORM */
+  {0xfd1a, 2, 4628}, /* ARABIC LIGATURE SHEEN WITH YEH FINAL FORM */
+  {0xfd1b, 2, 4630}, /* ARABIC LIGATURE HAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfd1c, 2, 4512}, /* ARABIC LIGATURE HAH WITH YEH FINAL FORM */
+  {0xfd1d, 2, 4632}, /* ARABIC LIGATURE JEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfd1e, 2, 4634}, /* ARABIC LIGATURE JEEM WITH YEH FINAL FORM */
+  {0xfd1f, 2, 4636}, /* ARABIC LIGATURE KHAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfd20, 2, 4514}, /* ARABIC LIGATURE KHAH WITH YEH FINAL FORM */
+  {0xfd21, 2, 4638}, /* ARABIC LIGATURE SAD WITH ALEF MAKSURA FINAL FORM */
+  {0xfd22, 2, 4640}, /* ARABIC LIGATURE SAD WITH YEH FINAL FORM */
+  {0xfd23, 2, 4642}, /* ARABIC LIGATURE DAD WITH ALEF MAKSURA FINAL FORM */
+  {0xfd24, 2, 4644}, /* ARABIC LIGATURE DAD WITH YEH FINAL FORM */
+  {0xfd25, 2, 4646}, /* ARABIC LIGATURE SHEEN WITH JEEM FINAL FORM */
+  {0xfd26, 2, 4648}, /* ARABIC LIGATURE SHEEN WITH HAH FINAL FORM */
+  {0xfd27, 2, 4650}, /* ARABIC LIGATURE SHEEN WITH KHAH FINAL FORM */
+  {0xfd28, 2, 4597}, /* ARABIC LIGATURE SHEEN WITH MEEM FINAL FORM */
+  {0xfd29, 2, 4652}, /* ARABIC LIGATURE SHEEN WITH REH FINAL FORM */
+  {0xfd2a, 2, 4654}, /* ARABIC LIGATURE SEEN WITH REH FINAL FORM */
+  {0xfd2b, 2, 4656}, /* ARABIC LIGATURE SAD WITH REH FINAL FORM */
+  {0xfd2c, 2, 4658}, /* ARABIC LIGATURE DAD WITH REH FINAL FORM */
+  {0xfd2d, 2, 4646}, /* ARABIC LIGATURE SHEEN WITH JEEM INITIAL FORM */
+  {0xfd2e, 2, 4648}, /* ARABIC LIGATURE SHEEN WITH HAH INITIAL FORM */
+  {0xfd2f, 2, 4650}, /* ARABIC LIGATURE SHEEN WITH KHAH INITIAL FORM */
+  {0xfd30, 2, 4597}, /* ARABIC LIGATURE SHEEN WITH MEEM INITIAL FORM */
+  {0xfd31, 2, 4595}, /* ARABIC LIGATURE SEEN WITH HEH INITIAL FORM */
+  {0xfd32, 2, 4599}, /* ARABIC LIGATURE SHEEN WITH HEH INITIAL FORM */
+  {0xfd33, 2, 4423}, /* ARABIC LIGATURE TAH WITH MEEM INITIAL FORM */
+  {0xfd34, 2, 4401}, /* ARABIC LIGATURE SEEN WITH JEEM MEDIAL FORM */
+  {0xfd35, 2, 4403}, /* ARABIC LIGATURE SEEN WITH HAH MEDIAL FORM */
+  {0xfd36, 2, 4405}, /* ARABIC LIGATURE SEEN WITH KHAH MEDIAL FORM */
+  {0xfd37, 2, 4646}, /* ARABIC LIGATURE SHEEN WITH JEEM MEDIAL FORM */
+  {0xfd38, 2, 4648}, /* ARABIC LIGATURE SHEEN WITH HAH MEDIAL FORM */
+  {0xfd39, 2, 4650}, /* ARABIC LIGATURE SHEEN WITH KHAH MEDIAL FORM */
+  {0xfd3a, 2, 4423}, /* ARABIC LIGATURE TAH WITH MEEM MEDIAL FORM */
+  {0xfd3b, 2, 4425}, /* ARABIC LIGATURE ZAH WITH MEEM MEDIAL FORM */
+  {0xfd3c, 2, 4660}, /* ARABIC LIGATURE ALEF WITH FATHATAN FINAL FORM */
+  {0xfd3d, 2, 4660}, /* ARABIC LIGATURE ALEF WITH FATHATAN ISOLATED FORM */
+  {0xfd50, 3, 4662}, /* ARABIC LIGATURE TEH WITH JEEM WITH MEEM INITIAL FORM */
+  {0xfd51, 3, 4665}, /* ARABIC LIGATURE TEH WITH HAH WITH JEEM FINAL FORM */
+  {0xfd52, 3, 4665}, /* ARABIC LIGATURE TEH WITH HAH WITH JEEM INITIAL FORM */
+  {0xfd53, 3, 4668}, /* ARABIC LIGATURE TEH WITH HAH WITH MEEM INITIAL FORM */
+  {0xfd54, 3, 4671}, /* ARABIC LIGATURE TEH WITH KHAH WITH MEEM INITIAL FORM */
+  {0xfd55, 3, 4674}, /* ARABIC LIGATURE TEH WITH MEEM WITH JEEM INITIAL FORM */
+  {0xfd56, 3, 4677}, /* ARABIC LIGATURE TEH WITH MEEM WITH HAH INITIAL FORM */
+  {0xfd57, 3, 4680}, /* ARABIC LIGATURE TEH WITH MEEM WITH KHAH INITIAL FORM */
+  {0xfd58, 3, 4391}, /* ARABIC LIGATURE JEEM WITH MEEM WITH HAH FINAL FORM */
+  {0xfd59, 3, 4391}, /* ARABIC LIGATURE JEEM WITH MEEM WITH HAH INITIAL FORM */
+  {0xfd5a, 3, 4683}, /* ARABIC LIGATURE HAH WITH MEEM WITH YEH FINAL FORM */
+  {0xfd5b, 3, 4686}, /* ARABIC LIGATURE HAH WITH MEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfd5c, 3, 4689}, /* ARABIC LIGATURE SEEN WITH HAH WITH JEEM INITIAL FORM */
+  {0xfd5d, 3, 4692}, /* ARABIC LIGATURE SEEN WITH JEEM WITH HAH INITIAL FORM */
+  {0xfd5e, 3, 4695}, /* ARABIC LIGATURE SEEN WITH JEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfd5f, 3, 4698}, /* ARABIC LIGATURE SEEN WITH MEEM WITH HAH FINAL FORM */
+  {0xfd60, 3, 4698}, /* ARABIC LIGATURE SEEN WITH MEEM WITH HAH INITIAL FORM */
+  {0xfd61, 3, 4701}, /* ARABIC LIGATURE SEEN WITH MEEM WITH JEEM INITIAL FORM */
+  {0xfd62, 3, 4704}, /* ARABIC LIGATURE SEEN WITH MEEM WITH MEEM FINAL FORM */
+  {0xfd63, 3, 4704}, /* ARABIC LIGATURE SEEN WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfd64, 3, 4707}, /* ARABIC LIGATURE SAD WITH HAH WITH HAH FINAL FORM */
+  {0xfd65, 3, 4707}, /* ARABIC LIGATURE SAD WITH HAH WITH HAH INITIAL FORM */
+  {0xfd66, 3, 4710}, /* ARABIC LIGATURE SAD WITH MEEM WITH MEEM FINAL FORM */
+  {0xfd67, 3, 4713}, /* ARABIC LIGATURE SHEEN WITH HAH WITH MEEM FINAL FORM */
+  {0xfd68, 3, 4713}, /* ARABIC LIGATURE SHEEN WITH HAH WITH MEEM INITIAL FORM */
+  {0xfd69, 3, 4716}, /* ARABIC LIGATURE SHEEN WITH JEEM WITH YEH FINAL FORM */
+  {0xfd6a, 3, 4719}, /* ARABIC LIGATURE SHEEN WITH MEEM WITH KHAH FINAL FORM */
+  {0xfd6b, 3, 4719}, /* ARABIC LIGATURE SHEEN WITH MEEM WITH KHAH INITIAL FORM */
+  {0xfd6c, 3, 4722}, /* ARABIC LIGATURE SHEEN WITH MEEM WITH MEEM FINAL FORM */
+  {0xfd6d, 3, 4722}, /* ARABIC LIGATURE SHEEN WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfd6e, 3, 4725}, /* ARABIC LIGATURE DAD WITH HAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfd6f, 3, 4728}, /* ARABIC LIGATURE DAD WITH KHAH WITH MEEM FINAL FORM */
+  {0xfd70, 3, 4728}, /* ARABIC LIGATURE DAD WITH KHAH WITH MEEM INITIAL FORM */
+  {0xfd71, 3, 4731}, /* ARABIC LIGATURE TAH WITH MEEM WITH HAH FINAL FORM */
+  {0xfd72, 3, 4731}, /* ARABIC LIGATURE TAH WITH MEEM WITH HAH INITIAL FORM */
+  {0xfd73, 3, 4734}, /* ARABIC LIGATURE TAH WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfd74, 3, 4737}, /* ARABIC LIGATURE TAH WITH MEEM WITH YEH FINAL FORM */
+  {0xfd75, 3, 4740}, /* ARABIC LIGATURE AIN WITH JEEM WITH MEEM FINAL FORM */
+  {0xfd76, 3, 4743}, /* ARABIC LIGATURE AIN WITH MEEM WITH MEEM FINAL FORM */
+  {0xfd77, 3, 4743}, /* ARABIC LIGATURE AIN WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfd78, 3, 4746}, /* ARABIC LIGATURE AIN WITH MEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfd79, 3, 4749}, /* ARABIC LIGATURE GHAIN WITH MEEM WITH MEEM FINAL FORM */
+  {0xfd7a, 3, 4752}, /* ARABIC LIGATURE GHAIN WITH MEEM WITH YEH FINAL FORM */
+  {0xfd7b, 3, 4755}, /* ARABIC LIGATURE GHAIN WITH MEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfd7c, 3, 4758}, /* ARABIC LIGATURE FEH WITH KHAH WITH MEEM FINAL FORM */
+  {0xfd7d, 3, 4758}, /* ARABIC LIGATURE FEH WITH KHAH WITH MEEM INITIAL FORM */
+  {0xfd7e, 3, 4761}, /* ARABIC LIGATURE QAF WITH MEEM WITH HAH FINAL FORM */
+  {0xfd7f, 3, 4764}, /* ARABIC LIGATURE QAF WITH MEEM WITH MEEM FINAL FORM */
+  {0xfd80, 3, 4767}, /* ARABIC LIGATURE LAM WITH HAH WITH MEEM FINAL FORM */
+  {0xfd81, 3, 4770}, /* ARABIC LIGATURE LAM WITH HAH WITH YEH FINAL FORM */
+  {0xfd82, 3, 4773}, /* ARABIC LIGATURE LAM WITH HAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfd83, 3, 4776}, /* ARABIC LIGATURE LAM WITH JEEM WITH JEEM INITIAL FORM */
+  {0xfd84, 3, 4776}, /* ARABIC LIGATURE LAM WITH JEEM WITH JEEM FINAL FORM */
+  {0xfd85, 3, 4779}, /* ARABIC LIGATURE LAM WITH KHAH WITH MEEM FINAL FORM */
+  {0xfd86, 3, 4779}, /* ARABIC LIGATURE LAM WITH KHAH WITH MEEM INITIAL FORM */
+  {0xfd87, 3, 4782}, /* ARABIC LIGATURE LAM WITH MEEM WITH HAH FINAL FORM */
+  {0xfd88, 3, 4782}, /* ARABIC LIGATURE LAM WITH MEEM WITH HAH INITIAL FORM */
+  {0xfd89, 3, 4785}, /* ARABIC LIGATURE MEEM WITH HAH WITH JEEM INITIAL FORM */
+  {0xfd8a, 3, 4392}, /* ARABIC LIGATURE MEEM WITH HAH WITH MEEM INITIAL FORM */
+  {0xfd8b, 3, 4788}, /* ARABIC LIGATURE MEEM WITH HAH WITH YEH FINAL FORM */
+  {0xfd8c, 3, 4791}, /* ARABIC LIGATURE MEEM WITH JEEM WITH HAH INITIAL FORM */
+  {0xfd8d, 3, 4483}, /* ARABIC LIGATURE MEEM WITH JEEM WITH MEEM INITIAL FORM */
+  {0xfd8e, 3, 4394}, /* ARABIC LIGATURE MEEM WITH KHAH WITH JEEM INITIAL FORM */
+  {0xfd8f, 3, 4794}, /* ARABIC LIGATURE MEEM WITH KHAH WITH MEEM INITIAL FORM */
+  {0xfd92, 3, 4797}, /* ARABIC LIGATURE MEEM WITH JEEM WITH KHAH INITIAL FORM */
+  {0xfd93, 3, 4800}, /* ARABIC LIGATURE HEH WITH MEEM WITH JEEM INITIAL FORM */
+  {0xfd94, 3, 4803}, /* ARABIC LIGATURE HEH WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfd95, 3, 4806}, /* ARABIC LIGATURE NOON WITH HAH WITH MEEM INITIAL FORM */
+  {0xfd96, 3, 4809}, /* ARABIC LIGATURE NOON WITH HAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfd97, 3, 4812}, /* ARABIC LIGATURE NOON WITH JEEM WITH MEEM FINAL FORM */
+  {0xfd98, 3, 4812}, /* ARABIC LIGATURE NOON WITH JEEM WITH MEEM INITIAL FORM */
+  {0xfd99, 3, 4815}, /* ARABIC LIGATURE NOON WITH JEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfd9a, 3, 4818}, /* ARABIC LIGATURE NOON WITH MEEM WITH YEH FINAL FORM */
+  {0xfd9b, 3, 4821}, /* ARABIC LIGATURE NOON WITH MEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfd9c, 3, 4824}, /* ARABIC LIGATURE YEH WITH MEEM WITH MEEM FINAL FORM */
+  {0xfd9d, 3, 4824}, /* ARABIC LIGATURE YEH WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfd9e, 3, 4827}, /* ARABIC LIGATURE BEH WITH KHAH WITH YEH FINAL FORM */
+  {0xfd9f, 3, 4830}, /* ARABIC LIGATURE TEH WITH JEEM WITH YEH FINAL FORM */
+  {0xfda0, 3, 4833}, /* ARABIC LIGATURE TEH WITH JEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfda1, 3, 4836}, /* ARABIC LIGATURE TEH WITH KHAH WITH YEH FINAL FORM */
+  {0xfda2, 3, 4839}, /* ARABIC LIGATURE TEH WITH KHAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfda3, 3, 4842}, /* ARABIC LIGATURE TEH WITH MEEM WITH YEH FINAL FORM */
+  {0xfda4, 3, 4845}, /* ARABIC LIGATURE TEH WITH MEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfda5, 3, 4848}, /* ARABIC LIGATURE JEEM WITH MEEM WITH YEH FINAL FORM */
+  {0xfda6, 3, 4851}, /* ARABIC LIGATURE JEEM WITH HAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfda7, 3, 4854}, /* ARABIC LIGATURE JEEM WITH MEEM WITH ALEF MAKSURA FINAL FORM */
+  {0xfda8, 3, 4857}, /* ARABIC LIGATURE SEEN WITH KHAH WITH ALEF MAKSURA FINAL FORM */
+  {0xfda9, 3, 4860}, /* ARABIC LIGATURE SAD WITH HAH WITH YEH FINAL FORM */
+  {0xfdaa, 3, 4863}, /* ARABIC LIGATURE SHEEN WITH HAH WITH YEH FINAL FORM */
+  {0xfdab, 3, 4866}, /* ARABIC LIGATURE DAD WITH HAH WITH YEH FINAL FORM */
+  {0xfdac, 3, 4869}, /* ARABIC LIGATURE LAM WITH JEEM WITH YEH FINAL FORM */
+  {0xfdad, 3, 4872}, /* ARABIC LIGATURE LAM WITH MEEM WITH YEH FINAL FORM */
+  {0xfdae, 3, 4511}, /* ARABIC LIGATURE YEH WITH HAH WITH YEH FINAL FORM */
+  {0xfdaf, 3, 4875}, /* ARABIC LIGATURE YEH WITH JEEM WITH YEH FINAL FORM */
+  {0xfdb0, 3, 4878}, /* ARABIC LIGATURE YEH WITH MEEM WITH YEH FINAL FORM */
+  {0xfdb1, 3, 4881}, /* ARABIC LIGATURE MEEM WITH MEEM WITH YEH FINAL FORM */
+  {0xfdb2, 3, 4884}, /* ARABIC LIGATURE QAF WITH MEEM WITH YEH FINAL FORM */
+  {0xfdb3, 3, 4887}, /* ARABIC LIGATURE NOON WITH HAH WITH YEH FINAL FORM */
+  {0xfdb4, 3, 4761}, /* ARABIC LIGATURE QAF WITH MEEM WITH HAH INITIAL FORM */
+  {0xfdb5, 3, 4767}, /* ARABIC LIGATURE LAM WITH HAH WITH MEEM INITIAL FORM */
+  {0xfdb6, 3, 4890}, /* ARABIC LIGATURE AIN WITH MEEM WITH YEH FINAL FORM */
+  {0xfdb7, 3, 4893}, /* ARABIC LIGATURE KAF WITH MEEM WITH YEH FINAL FORM */
+  {0xfdb8, 3, 4896}, /* ARABIC LIGATURE NOON WITH JEEM WITH HAH INITIAL FORM */
+  {0xfdb9, 3, 4899}, /* ARABIC LIGATURE MEEM WITH KHAH WITH YEH FINAL FORM */
+  {0xfdba, 3, 4902}, /* ARABIC LIGATURE LAM WITH JEEM WITH MEEM INITIAL FORM */
+  {0xfdbb, 3, 4905}, /* ARABIC LIGATURE KAF WITH MEEM WITH MEEM FINAL FORM */
+  {0xfdbc, 3, 4902}, /* ARABIC LIGATURE LAM WITH JEEM WITH MEEM FINAL FORM */
+  {0xfdbd, 3, 4896}, /* ARABIC LIGATURE NOON WITH JEEM WITH HAH FINAL FORM */
+  {0xfdbe, 3, 4908}, /* ARABIC LIGATURE JEEM WITH HAH WITH YEH FINAL FORM */
+  {0xfdbf, 3, 4911}, /* ARABIC LIGATURE HAH WITH JEEM WITH YEH FINAL FORM */
+  {0xfdc0, 3, 4914}, /* ARABIC LIGATURE MEEM WITH JEEM WITH YEH FINAL FORM */
+  {0xfdc1, 3, 4917}, /* ARABIC LIGATURE FEH WITH MEEM WITH YEH FINAL FORM */
+  {0xfdc2, 3, 4920}, /* ARABIC LIGATURE BEH WITH HAH WITH YEH FINAL FORM */
+  {0xfdc3, 3, 4905}, /* ARABIC LIGATURE KAF WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfdc4, 3, 4740}, /* ARABIC LIGATURE AIN WITH JEEM WITH MEEM INITIAL FORM */
+  {0xfdc5, 3, 4710}, /* ARABIC LIGATURE SAD WITH MEEM WITH MEEM INITIAL FORM */
+  {0xfdc6, 3, 4923}, /* ARABIC LIGATURE SEEN WITH KHAH WITH YEH FINAL FORM */
+  {0xfdc7, 3, 4926}, /* ARABIC LIGATURE NOON WITH JEEM WITH YEH FINAL FORM */
+  {0xfdf0, 3, 4929}, /* ARABIC LIGATURE SALLA USED AS KORANIC STOP SIGN ISOLATED FORM */
+  {0xfdf1, 3, 4932}, /* ARABIC LIGATURE QALA USED AS KORANIC STOP SIGN ISOLATED FORM */
+  {0xfdf2, 4, 4935}, /* ARABIC LIGATURE ALLAH ISOLATED FORM */
+  {0xfdf3, 4, 4939}, /* ARABIC LIGATURE AKBAR ISOLATED FORM */
+  {0xfdf4, 4, 4943}, /* ARABIC LIGATURE MOHAMMAD ISOLATED FORM */
+  {0xfdf5, 4, 4947}, /* ARABIC LIGATURE SALAM ISOLATED FORM */
+  {0xfdf6, 4, 4951}, /* ARABIC LIGATURE RASOUL ISOLATED FORM */
+  {0xfdf7, 4, 4955}, /* ARABIC LIGATURE ALAYHE ISOLATED FORM */
+  {0xfdf8, 4, 4959}, /* ARABIC LIGATURE WASALLAM ISOLATED FORM */
+  {0xfdf9, 3, 4963}, /* ARABIC LIGATURE SALLA ISOLATED FORM */
+  {0xfdfa, 18, 4966}, /* ARABIC LIGATURE SALLALLAHOU ALAYHE WASALLAM */
+  {0xfdfb, 8, 4984}, /* ARABIC LIGATURE JALLAJALALOUHOU */
+  {0xfdfc, 4, 4992}, /* RIAL SIGN */
+  {0xfe30, 1, 4996}, /* PRESENTATION FORM FOR VERTICAL TWO DOT LEADER */
+  {0xfe31, 1, 4997}, /* PRESENTATION FORM FOR VERTICAL EM DASH */
+  {0xfe32, 1, 4998}, /* PRESENTATION FORM FOR VERTICAL EN DASH */
+  {0xfe33, 1, 4999}, /* PRESENTATION FORM FOR VERTICAL LOW LINE */
+  {0xfe34, 1, 4999}, /* PRESENTATION FORM FOR VERTICAL WAVY LOW LINE */
+  {0xfe35, 1, 1918}, /* PRESENTATION FORM FOR VERTICAL LEFT PARENTHESIS */
+  {0xfe36, 1, 1919}, /* PRESENTATION FORM FOR VERTICAL RIGHT PARENTHESIS */
+  {0xfe37, 1, 5000}, /* PRESENTATION FORM FOR VERTICAL LEFT CURLY BRACKET */
+  {0xfe38, 1, 5001}, /* PRESENTATION FORM FOR VERTICAL RIGHT CURLY BRACKET */
+  {0xfe39, 1, 5002}, /* PRESENTATION FORM FOR VERTICAL LEFT TORTOISE SHELL BRACKET */
+  {0xfe3a, 1, 5003}, /* PRESENTATION FORM FOR VERTICAL RIGHT TORTOISE SHELL BRACKET */
+  {0xfe3b, 1, 5004}, /* PRESENTATION FORM FOR VERTICAL LEFT BLACK LENTICULAR BRACKET */
+  {0xfe3c, 1, 5005}, /* PRESENTATION FORM FOR VERTICAL RIGHT BLACK LENTICULAR BRACKET */
+  {0xfe3d, 1, 5006}, /* PRESENTATION FORM FOR VERTICAL LEFT DOUBLE ANGLE BRACKET */
+  {0xfe3e, 1, 5007}, /* PRESENTATION FORM FOR VERTICAL RIGHT DOUBLE ANGLE BRACKET */
+  {0xfe3f, 1, 2140}, /* PRESENTATION FORM FOR VERTICAL LEFT ANGLE BRACKET */
+  {0xfe40, 1, 2141}, /* PRESENTATION FORM FOR VERTICAL RIGHT ANGLE BRACKET */
+  {0xfe41, 1, 5008}, /* PRESENTATION FORM FOR VERTICAL LEFT CORNER BRACKET */
+  {0xfe42, 1, 5009}, /* PRESENTATION FORM FOR VERTICAL RIGHT CORNER BRACKET */
+  {0xfe43, 1, 5010}, /* PRESENTATION FORM FOR VERTICAL LEFT WHITE CORNER BRACKET */
+  {0xfe44, 1, 5011}, /* PRESENTATION FORM FOR VERTICAL RIGHT WHITE CORNER BRACKET */
+  {0xfe47, 1, 5012}, /* PRESENTATION FORM FOR VERTICAL LEFT SQUARE BRACKET */
+  {0xfe48, 1, 5013}, /* PRESENTATION FORM FOR VERTICAL RIGHT SQUARE BRACKET */
+  {0xfe49, 1, 5014}, /* DASHED OVERLINE */
+  {0xfe4a, 1, 5014}, /* CENTRELINE OVERLINE */
+  {0xfe4b, 1, 5014}, /* WAVY OVERLINE */
+  {0xfe4c, 1, 5014}, /* DOUBLE WAVY OVERLINE */
+  {0xfe4d, 1, 4999}, /* DASHED LOW LINE */
+  {0xfe4e, 1, 4999}, /* CENTRELINE LOW LINE */
+  {0xfe4f, 1, 4999}, /* WAVY LOW LINE */
+  {0xfe50, 1, 5015}, /* SMALL COMMA */
+  {0xfe51, 1, 5016}, /* SMALL IDEOGRAPHIC COMMA */
+  {0xfe52, 1, 1884}, /* SMALL FULL STOP */
+  {0xfe54, 1, 587}, /* SMALL SEMICOLON */
+  {0xfe55, 1, 2364}, /* SMALL COLON */
+  {0xfe56, 1, 1902}, /* SMALL QUESTION MARK */
+  {0xfe57, 1, 1898}, /* SMALL EXCLAMATION MARK */
+  {0xfe58, 1, 4997}, /* SMALL EM DASH */
+  {0xfe59, 1, 1918}, /* SMALL LEFT PARENTHESIS */
+  {0xfe5a, 1, 1919}, /* SMALL RIGHT PARENTHESIS */
+  {0xfe5b, 1, 5000}, /* SMALL LEFT CURLY BRACKET */
+  {0xfe5c, 1, 5001}, /* SMALL RIGHT CURLY BRACKET */
+  {0xfe5d, 1, 5002}, /* SMALL LEFT TORTOISE SHELL BRACKET */
+  {0xfe5e, 1, 5003}, /* SMALL RIGHT TORTOISE SHELL BRACKET */
+  {0xfe5f, 1, 5017}, /* SMALL NUMBER SIGN */
+  {0xfe60, 1, 5018}, /* SMALL AMPERSAND */
+  {0xfe61, 1, 5019}, /* SMALL ASTERISK */
+  {0xfe62, 1, 1915}, /* SMALL PLUS SIGN */
+  {0xfe63, 1, 5020}, /* SMALL HYPHEN-MINUS */
+  {0xfe64, 1, 2088}, /* SMALL LESS-THAN SIGN */
+  {0xfe65, 1, 2090}, /* SMALL GREATER-THAN SIGN */
+  {0xfe66, 1, 1917}, /* SMALL EQUALS SIGN */
+  {0xfe68, 1, 5021}, /* SMALL REVERSE SOLIDUS */
+  {0xfe69, 1, 5022}, /* SMALL DOLLAR SIGN */
+  {0xfe6a, 1, 5023}, /* SMALL PERCENT SIGN */
+  {0xfe6b, 1, 5024}, /* SMALL COMMERCIAL AT */
+  {0xfe70, 2, 5025}, /* ARABIC FATHATAN ISOLATED FORM */
+  {0xfe71, 2, 5027}, /* ARABIC TATWEEL WITH FATHATAN ABOVE */
+  {0xfe72, 2, 4523}, /* ARABIC DAMMATAN ISOLATED FORM */
+  {0xfe74, 2, 4526}, /* ARABIC KASRATAN ISOLATED FORM */
+  {0xfe76, 2, 4529}, /* ARABIC FATHA ISOLATED FORM */
+  {0xfe77, 2, 4601}, /* ARABIC FATHA MEDIAL FORM */
+  {0xfe78, 2, 4532}, /* ARABIC DAMMA ISOLATED FORM */
+  {0xfe79, 2, 4604}, /* ARABIC DAMMA MEDIAL FORM */
+  {0xfe7a, 2, 4535}, /* ARABIC KASRA ISOLATED FORM */
+  {0xfe7b, 2, 4607}, /* ARABIC KASRA MEDIAL FORM */
+  {0xfe7c, 2, 4538}, /* ARABIC SHADDA ISOLATED FORM */
+  {0xfe7d, 2, 5029}, /* ARABIC SHADDA MEDIAL FORM */
+  {0xfe7e, 2, 5031}, /* ARABIC SUKUN ISOLATED FORM */
+  {0xfe7f, 2, 5033}, /* ARABIC SUKUN MEDIAL FORM */
+  {0xfe80, 1, 5035}, /* ARABIC LETTER HAMZA ISOLATED FORM */
+  {0xfe81, 1, 5036}, /* ARABIC LETTER ALEF WITH MADDA ABOVE ISOLATED FORM */
+  {0xfe82, 1, 5036}, /* ARABIC LETTER ALEF WITH MADDA ABOVE FINAL FORM */
+  {0xfe83, 1, 5037}, /* ARABIC LETTER ALEF WITH HAMZA ABOVE ISOLATED FORM */
+  {0xfe84, 1, 5037}, /* ARABIC LETTER ALEF WITH HAMZA ABOVE FINAL FORM */
+  {0xfe85, 1, 5038}, /* ARABIC LETTER WAW WITH HAMZA ABOVE ISOLATED FORM */
+  {0xfe86, 1, 5038}, /* ARABIC LETTER WAW WITH HAMZA ABOVE FINAL FORM */
+  {0xfe87, 1, 5039}, /* ARABIC LETTER ALEF WITH HAMZA BELOW ISOLATED FORM */
+  {0xfe88, 1, 5039}, /* ARABIC LETTER ALEF WITH HAMZA BELOW FINAL FORM */
+  {0xfe89, 1, 4332}, /* ARABIC LETTER YEH WITH HAMZA ABOVE ISOLATED FORM */
+  {0xfe8a, 1, 4332}, /* ARABIC LETTER YEH WITH HAMZA ABOVE FINAL FORM */
+  {0xfe8b, 1, 4332}, /* ARABIC LETTER YEH WITH HAMZA ABOVE INITIAL FORM */
+  {0xfe8c, 1, 4332}, /* ARABIC LETTER YEH WITH HAMZA ABOVE MEDIAL FORM */
+  {0xfe8d, 1, 749}, /* ARABIC LETTER ALEF ISOLATED FORM */
+  {0xfe8e, 1, 749}, /* ARABIC LETTER ALEF FINAL FORM */
+  {0xfe8f, 1, 4357}, /* ARABIC LETTER BEH ISOLATED FORM */
+  {0xfe90, 1, 4357}, /* ARABIC LETTER BEH FINAL FORM */
+  {0xfe91, 1, 4357}, /* ARABIC LETTER BEH INITIAL FORM */
+  {0xfe92, 1, 4357}, /* ARABIC LETTER BEH MEDIAL FORM */
+  {0xfe93, 1, 5040}, /* ARABIC LETTER TEH MARBUTA ISOLATED FORM */
+  {0xfe94, 1, 5040}, /* ARABIC LETTER TEH MARBUTA FINAL FORM */
+  {0xfe95, 1, 4369}, /* ARABIC LETTER TEH ISOLATED FORM */
+  {0xfe96, 1, 4369}, /* ARABIC LETTER TEH FINAL FORM */
+  {0xfe97, 1, 4369}, /* ARABIC LETTER TEH INITIAL FORM */
+  {0xfe98, 1, 4369}, /* ARABIC LETTER TEH MEDIAL FORM */
+  {0xfe99, 1, 4381}, /* ARABIC LETTER THEH ISOLATED FORM */
+  {0xfe9a, 1, 4381}, /* ARABIC LETTER THEH FINAL FORM */
+  {0xfe9b, 1, 4381}, /* ARABIC LETTER THEH INITIAL FORM */
+  {0xfe9c, 1, 4381}, /* ARABIC LETTER THEH MEDIAL FORM */
+  {0xfe9d, 1, 4350}, /* ARABIC LETTER JEEM ISOLATED FORM */
+  {0xfe9e, 1, 4350}, /* ARABIC LETTER JEEM FINAL FORM */
+  {0xfe9f, 1, 4350}, /* ARABIC LETTER JEEM INITIAL FORM */
+  {0xfea0, 1, 4350}, /* ARABIC LETTER JEEM MEDIAL FORM */
+  {0xfea1, 1, 4352}, /* ARABIC LETTER HAH ISOLATED FORM */
+  {0xfea2, 1, 4352}, /* ARABIC LETTER HAH FINAL FORM */
+  {0xfea3, 1, 4352}, /* ARABIC LETTER HAH INITIAL FORM */
+  {0xfea4, 1, 4352}, /* ARABIC LETTER HAH MEDIAL FORM */
+  {0xfea5, 1, 4362}, /* ARABIC LETTER KHAH ISOLATED FORM */
+  {0xfea6, 1, 4362}, /* ARABIC LETTER KHAH FINAL FORM */
+  {0xfea7, 1, 4362}, /* ARABIC LETTER KHAH INITIAL FORM */
+  {0xfea8, 1, 4362}, /* ARABIC LETTER KHAH MEDIAL FORM */
+  {0xfea9, 1, 4946}, /* ARABIC LETTER DAL ISOLATED FORM */
+  {0xfeaa, 1, 4946}, /* ARABIC LETTER DAL FINAL FORM */
+  {0xfeab, 1, 4517}, /* ARABIC LETTER THAL ISOLATED FORM */
+  {0xfeac, 1, 4517}, /* ARABIC LETTER THAL FINAL FORM */
+  {0xfead, 1, 4519}, /* ARABIC LETTER REH ISOLATED FORM */
+  {0xfeae, 1, 4519}, /* ARABIC LETTER REH FINAL FORM */
+  {0xfeaf, 1, 4544}, /* ARABIC LETTER ZAIN ISOLATED FORM */
+  {0xfeb0, 1, 4544}, /* ARABIC LETTER ZAIN FINAL FORM */
+  {0xfeb1, 1, 4401}, /* ARABIC LETTER SEEN ISOLATED FORM */
+  {0xfeb2, 1, 4401}, /* ARABIC LETTER SEEN FINAL FORM */
+  {0xfeb3, 1, 4401}, /* ARABIC LETTER SEEN INITIAL FORM */
+  {0xfeb4, 1, 4401}, /* ARABIC LETTER SEEN MEDIAL FORM */
+  {0xfeb5, 1, 4597}, /* ARABIC LETTER SHEEN ISOLATED FORM */
+  {0xfeb6, 1, 4597}, /* ARABIC LETTER SHEEN FINAL FORM */
+  {0xfeb7, 1, 4597}, /* ARABIC LETTER SHEEN INITIAL FORM */
+  {0xfeb8, 1, 4597}, /* ARABIC LETTER SHEEN MEDIAL FORM */
+  {0xfeb9, 1, 4409}, /* ARABIC LETTER SAD ISOLATED FORM */
+  {0xfeba, 1, 4409}, /* ARABIC LETTER SAD FINAL FORM */
+  {0xfebb, 1, 4409}, /* ARABIC LETTER SAD INITIAL FORM */
+  {0xfebc, 1, 4409}, /* ARABIC LETTER SAD MEDIAL FORM */
+  {0xfebd, 1, 4413}, /* ARABIC LETTER DAD ISOLATED FORM */
+  {0xfebe, 1, 4413}, /* ARABIC LETTER DAD FINAL FORM */
+  {0xfebf, 1, 4413}, /* ARABIC LETTER DAD INITIAL FORM */
+  {0xfec0, 1, 4413}, /* ARABIC LETTER DAD MEDIAL FORM */
+  {0xfec1, 1, 4421}, /* ARABIC LETTER TAH ISOLATED FORM */
+  {0xfec2, 1, 4421}, /* ARABIC LETTER TAH FINAL FORM */
+  {0xfec3, 1, 4421}, /* ARABIC LETTER TAH INITIAL FORM */
+  {0xfec4, 1, 4421}, /* ARABIC LETTER TAH MEDIAL FORM */
+  {0xfec5, 1, 4425}, /* ARABIC LETTER ZAH ISOLATED FORM */
+  {0xfec6, 1, 4425}, /* ARABIC LETTER ZAH FINAL FORM */
+  {0xfec7, 1, 4425}, /* ARABIC LETTER ZAH INITIAL FORM */
+  {0xfec8, 1, 4425}, /* ARABIC LETTER ZAH MEDIAL FORM */
+  {0xfec9, 1, 4427}, /* ARABIC LETTER AIN ISOLATED FORM */
+  {0xfeca, 1, 4427}, /* ARABIC LETTER AIN FINAL FORM */
+  {0xfecb, 1, 4427}, /* ARABIC LETTER AIN INITIAL FORM */
+  {0xfecc, 1, 4427}, /* ARABIC LETTER AIN MEDIAL FORM */
+  {0xfecd, 1, 4431}, /* ARABIC LETTER GHAIN ISOLATED FORM */
+  {0xfece, 1, 4431}, /* ARABIC LETTER GHAIN FINAL FORM */
+  {0xfecf, 1, 4431}, /* ARABIC LETTER GHAIN INITIAL FORM */
+  {0xfed0, 1, 4431}, /* ARABIC LETTER GHAIN MEDIAL FORM */
+  {0xfed1, 1, 4435}, /* ARABIC LETTER FEH ISOLATED FORM */
+  {0xfed2, 1, 4435}, /* ARABIC LETTER FEH FINAL FORM */
+  {0xfed3, 1, 4435}, /* ARABIC LETTER FEH INITIAL FORM */
+  {0xfed4, 1, 4435}, /* ARABIC LETTER FEH MEDIAL FORM */
+  {0xfed5, 1, 4447}, /* ARABIC LETTER QAF ISOLATED FORM */
+  {0xfed6, 1, 4447}, /* ARABIC LETTER QAF FINAL FORM */
+  {0xfed7, 1, 4447}, /* ARABIC LETTER QAF INITIAL FORM */
+  {0xfed8, 1, 4447}, /* ARABIC LETTER QAF MEDIAL FORM */
+  {0xfed9, 1, 4455}, /* ARABIC LETTER KAF ISOLATED FORM */
+  {0xfeda, 1, 4455}, /* ARABIC LETTER KAF FINAL FORM */
+  {0xfedb, 1, 4455}, /* ARABIC LETTER KAF INITIAL FORM */
+  {0xfedc, 1, 4455}, /* ARABIC LETTER KAF MEDIAL FORM */
+  {0xfedd, 1, 4464}, /* ARABIC LETTER LAM ISOLATED FORM */
+  {0xfede, 1, 4464}, /* ARABIC LETTER LAM FINAL FORM */
+  {0xfedf, 1, 4464}, /* ARABIC LETTER LAM INITIAL FORM */
+  {0xfee0, 1, 4464}, /* ARABIC LETTER LAM MEDIAL FORM */
+  {0xfee1, 1, 4354}, /* ARABIC LETTER MEEM ISOLATED FORM */
+  {0xfee2, 1, 4354}, /* ARABIC LETTER MEEM FINAL FORM */
+  {0xfee3, 1, 4354}, /* ARABIC LETTER MEEM INITIAL FORM */
+  {0xfee4, 1, 4354}, /* ARABIC LETTER MEEM MEDIAL FORM */
+  {0xfee5, 1, 4491}, /* ARABIC LETTER NOON ISOLATED FORM */
+  {0xfee6, 1, 4491}, /* ARABIC LETTER NOON FINAL FORM */
+  {0xfee7, 1, 4491}, /* ARABIC LETTER NOON INITIAL FORM */
+  {0xfee8, 1, 4491}, /* ARABIC LETTER NOON MEDIAL FORM */
+  {0xfee9, 1, 4503}, /* ARABIC LETTER HEH ISOLATED FORM */
+  {0xfeea, 1, 4503}, /* ARABIC LETTER HEH FINAL FORM */
+  {0xfeeb, 1, 4503}, /* ARABIC LETTER HEH INITIAL FORM */
+  {0xfeec, 1, 4503}, /* ARABIC LETTER HEH MEDIAL FORM */
+  {0xfeed, 1, 753}, /* ARABIC LETTER WAW ISOLATED FORM */
+  {0xfeee, 1, 753}, /* ARABIC LETTER WAW FINAL FORM */
+  {0xfeef, 1, 4331}, /* ARABIC LETTER ALEF MAKSURA ISOLATED FORM */
+  {0xfef0, 1, 4331}, /* ARABIC LETTER ALEF MAKSURA FINAL FORM */
+  {0xfef1, 1, 757}, /* ARABIC LETTER YEH ISOLATED FORM */
+  {0xfef2, 1, 757}, /* ARABIC LETTER YEH FINAL FORM */
+  {0xfef3, 1, 757}, /* ARABIC LETTER YEH INITIAL FORM */
+  {0xfef4, 1, 757}, /* ARABIC LETTER YEH MEDIAL FORM */
+  {0xfef5, 2, 5041}, /* ARABIC LIGATURE LAM WITH ALEF WITH MADDA ABOVE ISOLATED FORM */
+  {0xfef6, 2, 5041}, /* ARABIC LIGATURE LAM WITH ALEF WITH MADDA ABOVE FINAL FORM */
+  {0xfef7, 2, 5043}, /* ARABIC LIGATURE LAM WITH ALEF WITH HAMZA ABOVE ISOLATED FORM */
+  {0xfef8, 2, 5043}, /* ARABIC LIGATURE LAM WITH ALEF WITH HAMZA ABOVE FINAL FORM */
+  {0xfef9, 2, 5045}, /* ARABIC LIGATURE LAM WITH ALEF WITH HAMZA BELOW ISOLATED FORM */
+  {0xfefa, 2, 5045}, /* ARABIC LIGATURE LAM WITH ALEF WITH HAMZA BELOW FINAL FORM */
+  {0xfefb, 2, 4988}, /* ARABIC LIGATURE LAM WITH ALEF ISOLATED FORM */
+  {0xfefc, 2, 4988}, /* ARABIC LIGATURE LAM WITH ALEF FINAL FORM */
+  {0xff01, 1, 1898}, /* FULLWIDTH EXCLAMATION MARK */
+  {0xff02, 1, 5047}, /* FULLWIDTH QUOTATION MARK */
+  {0xff03, 1, 5017}, /* FULLWIDTH NUMBER SIGN */
+  {0xff04, 1, 5022}, /* FULLWIDTH DOLLAR SIGN */
+  {0xff05, 1, 5023}, /* FULLWIDTH PERCENT SIGN */
+  {0xff06, 1, 5018}, /* FULLWIDTH AMPERSAND */
+  {0xff07, 1, 5048}, /* FULLWIDTH APOSTROPHE */
+  {0xff08, 1, 1918}, /* FULLWIDTH LEFT PARENTHESIS */
+  {0xff09, 1, 1919}, /* FULLWIDTH RIGHT PARENTHESIS */
+  {0xff0a, 1, 5019}, /* FULLWIDTH ASTERISK */
+  {0xff0b, 1, 1915}, /* FULLWIDTH PLUS SIGN */
+  {0xff0c, 1, 5015}, /* FULLWIDTH COMMA */
+  {0xff0d, 1, 5020}, /* FULLWIDTH HYPHEN-MINUS */
+  {0xff0e, 1, 1884}, /* FULLWIDTH FULL STOP */
+  {0xff0f, 1, 1923}, /* FULLWIDTH SOLIDUS */
+  {0xff10, 1, 1909}, /* FULLWIDTH DIGIT ZERO */
+  {0xff11, 1, 13}, /* FULLWIDTH DIGIT ONE */
+  {0xff12, 1, 6}, /* FULLWIDTH DIGIT TWO */
+  {0xff13, 1, 7}, /* FULLWIDTH DIGIT THREE */
+  {0xff14, 1, 17}, /* FULLWIDTH DIGIT FOUR */
+  {0xff15, 1, 1910}, /* FULLWIDTH DIGIT FIVE */
+  {0xff16, 1, 1911}, /* FULLWIDTH DIGIT SIX */
+  {0xff17, 1, 1912}, /* FULLWIDTH DIGIT SEVEN */
+  {0xff18, 1, 1913}, /* FULLWIDTH DIGIT EIGHT */
+  {0xff19, 1, 1914}, /* FULLWIDTH DIGIT NINE */
+  {0xff1a, 1, 2364}, /* FULLWIDTH COLON */
+  {0xff1b, 1, 587}, /* FULLWIDTH SEMICOLON */
+  {0xff1c, 1, 2088}, /* FULLWIDTH LESS-THAN SIGN */
+  {0xff1d, 1, 1917}, /* FULLWIDTH EQUALS SIGN */
+  {0xff1e, 1, 2090}, /* FULLWIDTH GREATER-THAN SIGN */
+  {0xff1f, 1, 1902}, /* FULLWIDTH QUESTION MARK */
+  {0xff20, 1, 5024}, /* FULLWIDTH COMMERCIAL AT */
+  {0xff21, 1, 24}, /* FULLWIDTH LATIN CAPITAL LETTER A */
+  {0xff22, 1, 910}, /* FULLWIDTH LATIN CAPITAL LETTER B */
+  {0xff23, 1, 36}, /* FULLWIDTH LATIN CAPITAL LETTER C */
+  {0xff24, 1, 158}, /* FULLWIDTH LATIN CAPITAL LETTER D */
+  {0xff25, 1, 38}, /* FULLWIDTH LATIN CAPITAL LETTER E */
+  {0xff26, 1, 995}, /* FULLWIDTH LATIN CAPITAL LETTER F */
+  {0xff27, 1, 182}, /* FULLWIDTH LATIN CAPITAL LETTER G */
+  {0xff28, 1, 198}, /* FULLWIDTH LATIN CAPITAL LETTER H */
+  {0xff29, 1, 46}, /* FULLWIDTH LATIN CAPITAL LETTER I */
+  {0xff2a, 1, 221}, /* FULLWIDTH LATIN CAPITAL LETTER J */
+  {0xff2b, 1, 228}, /* FULLWIDTH LATIN CAPITAL LETTER K */
+  {0xff2c, 1, 232}, /* FULLWIDTH LATIN CAPITAL LETTER L */
+  {0xff2d, 1, 912}, /* FULLWIDTH LATIN CAPITAL LETTER M */
+  {0xff2e, 1, 54}, /* FULLWIDTH LATIN CAPITAL LETTER N */
+  {0xff2f, 1, 56}, /* FULLWIDTH LATIN CAPITAL LETTER O */
+  {0xff30, 1, 914}, /* FULLWIDTH LATIN CAPITAL LETTER P */
+  {0xff31, 1, 1942}, /* FULLWIDTH LATIN CAPITAL LETTER Q */
+  {0xff32, 1, 274}, /* FULLWIDTH LATIN CAPITAL LETTER R */
+  {0xff33, 1, 286}, /* FULLWIDTH LATIN CAPITAL LETTER S */
+  {0xff34, 1, 302}, /* FULLWIDTH LATIN CAPITAL LETTER T */
+  {0xff35, 1, 66}, /* FULLWIDTH LATIN CAPITAL LETTER U */
+  {0xff36, 1, 1183}, /* FULLWIDTH LATIN CAPITAL LETTER V */
+  {0xff37, 1, 334}, /* FULLWIDTH LATIN CAPITAL LETTER W */
+  {0xff38, 1, 1211}, /* FULLWIDTH LATIN CAPITAL LETTER X */
+  {0xff39, 1, 74}, /* FULLWIDTH LATIN CAPITAL LETTER Y */
+  {0xff3a, 1, 344}, /* FULLWIDTH LATIN CAPITAL LETTER Z */
+  {0xff3b, 1, 5012}, /* FULLWIDTH LEFT SQUARE BRACKET */
+  {0xff3c, 1, 5021}, /* FULLWIDTH REVERSE SOLIDUS */
+  {0xff3d, 1, 5013}, /* FULLWIDTH RIGHT SQUARE BRACKET */
+  {0xff3e, 1, 5049}, /* FULLWIDTH CIRCUMFLEX ACCENT */
+  {0xff3f, 1, 4999}, /* FULLWIDTH LOW LINE */
+  {0xff40, 1, 1848}, /* FULLWIDTH GRAVE ACCENT */
+  {0xff41, 1, 3}, /* FULLWIDTH LATIN SMALL LETTER A */
+  {0xff42, 1, 918}, /* FULLWIDTH LATIN SMALL LETTER B */
+  {0xff43, 1, 88}, /* FULLWIDTH LATIN SMALL LETTER C */
+  {0xff44, 1, 160}, /* FULLWIDTH LATIN SMALL LETTER D */
+  {0xff45, 1, 90}, /* FULLWIDTH LATIN SMALL LETTER E */
+  {0xff46, 1, 997}, /* FULLWIDTH LATIN SMALL LETTER F */
+  {0xff47, 1, 184}, /* FULLWIDTH LATIN SMALL LETTER G */
+  {0xff48, 1, 200}, /* FULLWIDTH LATIN SMALL LETTER H */
+  {0xff49, 1, 98}, /* FULLWIDTH LATIN SMALL LETTER I */
+  {0xff4a, 1, 223}, /* FULLWIDTH LATIN SMALL LETTER J */
+  {0xff4b, 1, 230}, /* FULLWIDTH LATIN SMALL LETTER K */
+  {0xff4c, 1, 234}, /* FULLWIDTH LATIN SMALL LETTER L */
+  {0xff4d, 1, 922}, /* FULLWIDTH LATIN SMALL LETTER M */
+  {0xff4e, 1, 106}, /* FULLWIDTH LATIN SMALL LETTER N */
+  {0xff4f, 1, 14}, /* FULLWIDTH LATIN SMALL LETTER O */
+  {0xff50, 1, 927}, /* FULLWIDTH LATIN SMALL LETTER P */
+  {0xff51, 1, 2335}, /* FULLWIDTH LATIN SMALL LETTER Q */
+  {0xff52, 1, 276}, /* FULLWIDTH LATIN SMALL LETTER R */
+  {0xff53, 1, 288}, /* FULLWIDTH LATIN SMALL LETTER S */
+  {0xff54, 1, 304}, /* FULLWIDTH LATIN SMALL LETTER T */
+  {0xff55, 1, 118}, /* FULLWIDTH LATIN SMALL LETTER U */
+  {0xff56, 1, 930}, /* FULLWIDTH LATIN SMALL LETTER V */
+  {0xff57, 1, 336}, /* FULLWIDTH LATIN SMALL LETTER W */
+  {0xff58, 1, 579}, /* FULLWIDTH LATIN SMALL LETTER X */
+  {0xff59, 1, 126}, /* FULLWIDTH LATIN SMALL LETTER Y */
+  {0xff5a, 1, 346}, /* FULLWIDTH LATIN SMALL LETTER Z */
+  {0xff5b, 1, 5000}, /* FULLWIDTH LEFT CURLY BRACKET */
+  {0xff5c, 1, 5050}, /* FULLWIDTH VERTICAL LINE */
+  {0xff5d, 1, 5001}, /* FULLWIDTH RIGHT CURLY BRACKET */
+  {0xff5e, 1, 5051}, /* FULLWIDTH TILDE */
+  {0xff5f, 1, 5052}, /* FULLWIDTH LEFT WHITE PARENTHESIS */
+  {0xff60, 1, 5053}, /* FULLWIDTH RIGHT WHITE PARENTHESIS */
+  {0xff61, 1, 5054}, /* HALFWIDTH IDEOGRAPHIC FULL STOP */
+  {0xff62, 1, 5008}, /* HALFWIDTH LEFT CORNER BRACKET */
+  {0xff63, 1, 5009}, /* HALFWIDTH RIGHT CORNER BRACKET */
+  {0xff64, 1, 5016}, /* HALFWIDTH IDEOGRAPHIC COMMA */
+  {0xff65, 1, 5055}, /* HALFWIDTH KATAKANA MIDDLE DOT */
+  {0xff66, 1, 2709}, /* HALFWIDTH KATAKANA LETTER WO */
+  {0xff67, 1, 3180}, /* HALFWIDTH KATAKANA LETTER SMALL A */
+  {0xff68, 1, 3348}, /* HALFWIDTH KATAKANA LETTER SMALL I */
+  {0xff69, 1, 5056}, /* HALFWIDTH KATAKANA LETTER SMALL U */
+  {0xff6a, 1, 3354}, /* HALFWIDTH KATAKANA LETTER SMALL E */
+  {0xff6b, 1, 3196}, /* HALFWIDTH KATAKANA LETTER SMALL O */
+  {0xff6c, 1, 5057}, /* HALFWIDTH KATAKANA LETTER SMALL YA */
+  {0xff6d, 1, 3236}, /* HALFWIDTH KATAKANA LETTER SMALL YU */
+  {0xff6e, 1, 3415}, /* HALFWIDTH KATAKANA LETTER SMALL YO */
+  {0xff6f, 1, 3218}, /* HALFWIDTH KATAKANA LETTER SMALL TU */
+  {0xff70, 1, 3175}, /* HALFWIDTH KATAKANA-HIRAGANA PROLONGED SOUND MARK */
+  {0xff71, 1, 3151}, /* HALFWIDTH KATAKANA LETTER A */
+  {0xff72, 1, 3152}, /* HALFWIDTH KATAKANA LETTER I */
+  {0xff73, 1, 2701}, /* HALFWIDTH KATAKANA LETTER U */
+  {0xff74, 1, 3153}, /* HALFWIDTH KATAKANA LETTER E */
+  {0xff75, 1, 3154}, /* HALFWIDTH KATAKANA LETTER O */
+  {0xff76, 1, 2651}, /* HALFWIDTH KATAKANA LETTER KA */
+  {0xff77, 1, 2653}, /* HALFWIDTH KATAKANA LETTER KI */
+  {0xff78, 1, 2655}, /* HALFWIDTH KATAKANA LETTER KU */
+  {0xff79, 1, 2657}, /* HALFWIDTH KATAKANA LETTER KE */
+  {0xff7a, 1, 2659}, /* HALFWIDTH KATAKANA LETTER KO */
+  {0xff7b, 1, 2661}, /* HALFWIDTH KATAKANA LETTER SA */
+  {0xff7c, 1, 2663}, /* HALFWIDTH KATAKANA LETTER SI */
+  {0xff7d, 1, 2665}, /* HALFWIDTH KATAKANA LETTER SU */
+  {0xff7e, 1, 2667}, /* HALFWIDTH KATAKANA LETTER SE */
+  {0xff7f, 1, 2669}, /* HALFWIDTH KATAKANA LETTER SO */
+  {0xff80, 1, 2671}, /* HALFWIDTH KATAKANA LETTER TA */
+  {0xff81, 1, 2673}, /* HALFWIDTH KATAKANA LETTER TI */
+  {0xff82, 1, 2675}, /* HALFWIDTH KATAKANA LETTER TU */
+  {0xff83, 1, 2677}, /* HALFWIDTH KATAKANA LETTER TE */
+  {0xff84, 1, 2679}, /* HALFWIDTH KATAKANA LETTER TO */
+  {0xff85, 1, 3155}, /* HALFWIDTH KATAKANA LETTER NA */
+  {0xff86, 1, 3156}, /* HALFWIDTH KATAKANA LETTER NI */
+  {0xff87, 1, 3157}, /* HALFWIDTH KATAKANA LETTER NU */
+  {0xff88, 1, 3158}, /* HALFWIDTH KATAKANA LETTER NE */
+  {0xff89, 1, 3159}, /* HALFWIDTH KATAKANA LETTER NO */
+  {0xff8a, 1, 2681}, /* HALFWIDTH KATAKANA LETTER HA */
+  {0xff8b, 1, 2685}, /* HALFWIDTH KATAKANA LETTER HI */
+  {0xff8c, 1, 2689}, /* HALFWIDTH KATAKANA LETTER HU */
+  {0xff8d, 1, 2693}, /* HALFWIDTH KATAKANA LETTER HE */
+  {0xff8e, 1, 2697}, /* HALFWIDTH KATAKANA LETTER HO */
+  {0xff8f, 1, 3160}, /* HALFWIDTH KATAKANA LETTER MA */
+  {0xff90, 1, 3161}, /* HALFWIDTH KATAKANA LETTER MI */
+  {0xff91, 1, 3162}, /* HALFWIDTH KATAKANA LETTER MU */
+  {0xff92, 1, 3163}, /* HALFWIDTH KATAKANA LETTER ME */
+  {0xff93, 1, 3164}, /* HALFWIDTH KATAKANA LETTER MO */
+  {0xff94, 1, 3165}, /* HALFWIDTH KATAKANA LETTER YA */
+  {0xff95, 1, 3166}, /* HALFWIDTH KATAKANA LETTER YU */
+  {0xff96, 1, 3167}, /* HALFWIDTH KATAKANA LETTER YO */
+  {0xff97, 1, 3168}, /* HALFWIDTH KATAKANA LETTER RA */
+  {0xff98, 1, 3169}, /* HALFWIDTH KATAKANA LETTER RI */
+  {0xff99, 1, 3170}, /* HALFWIDTH KATAKANA LETTER RU */
+  {0xff9a, 1, 3171}, /* HALFWIDTH KATAKANA LETTER RE */
+  {0xff9b, 1, 3172}, /* HALFWIDTH KATAKANA LETTER RO */
+  {0xff9c, 1, 2703}, /* HALFWIDTH KATAKANA LETTER WA */
+  {0xff9d, 1, 3182}, /* HALFWIDTH KATAKANA LETTER N */
+  {0xff9e, 1, 2592}, /* HALFWIDTH KATAKANA VOICED SOUND MARK */
+  {0xff9f, 1, 2624}, /* HALFWIDTH KATAKANA SEMI-VOICED SOUND MARK */
+  {0xffa0, 1, 5058}, /* HALFWIDTH HANGUL FILLER */
+  {0xffa1, 1, 5059}, /* HALFWIDTH HANGUL LETTER KIYEOK */
+  {0xffa2, 1, 5060}, /* HALFWIDTH HANGUL LETTER SSANGKIYEOK */
+  {0xffa3, 1, 5061}, /* HALFWIDTH HANGUL LETTER KIYEOK-SIOS */
+  {0xffa4, 1, 5062}, /* HALFWIDTH HANGUL LETTER NIEUN */
+  {0xffa5, 1, 5063}, /* HALFWIDTH HANGUL LETTER NIEUN-CIEUC */
+  {0xffa6, 1, 5064}, /* HALFWIDTH HANGUL LETTER NIEUN-HIEUH */
+  {0xffa7, 1, 5065}, /* HALFWIDTH HANGUL LETTER TIKEUT */
+  {0xffa8, 1, 5066}, /* HALFWIDTH HANGUL LETTER SSANGTIKEUT */
+  {0xffa9, 1, 5067}, /* HALFWIDTH HANGUL LETTER RIEUL */
+  {0xffaa, 1, 5068}, /* HALFWIDTH HANGUL LETTER RIEUL-KIYEOK */
+  {0xffab, 1, 5069}, /* HALFWIDTH HANGUL LETTER RIEUL-MIEUM */
+  {0xffac, 1, 5070}, /* HALFWIDTH HANGUL LETTER RIEUL-PIEUP */
+  {0xffad, 1, 5071}, /* HALFWIDTH HANGUL LETTER RIEUL-SIOS */
+  {0xffae, 1, 5072}, /* HALFWIDTH HANGUL LETTER RIEUL-THIEUTH */
+  {0xffaf, 1, 5073}, /* HALFWIDTH HANGUL LETTER RIEUL-PHIEUPH */
+  {0xffb0, 1, 5074}, /* HALFWIDTH HANGUL LETTER RIEUL-HIEUH */
+  {0xffb1, 1, 5075}, /* HALFWIDTH HANGUL LETTER MIEUM */
+  {0xffb2, 1, 5076}, /* HALFWIDTH HANGUL LETTER PIEUP */
+  {0xffb3, 1, 5077}, /* HALFWIDTH HANGUL LETTER SSANGPIEUP */
+  {0xffb4, 1, 5078}, /* HALFWIDTH HANGUL LETTER PIEUP-SIOS */
+  {0xffb5, 1, 5079}, /* HALFWIDTH HANGUL LETTER SIOS */
+  {0xffb6, 1, 5080}, /* HALFWIDTH HANGUL LETTER SSANGSIOS */
+  {0xffb7, 1, 5081}, /* HALFWIDTH HANGUL LETTER IEUNG */
+  {0xffb8, 1, 5082}, /* HALFWIDTH HANGUL LETTER CIEUC */
+  {0xffb9, 1, 5083}, /* HALFWIDTH HANGUL LETTER SSANGCIEUC */
+  {0xffba, 1, 5084}, /* HALFWIDTH HANGUL LETTER CHIEUCH */
+  {0xffbb, 1, 5085}, /* HALFWIDTH HANGUL LETTER KHIEUKH */
+  {0xffbc, 1, 5086}, /* HALFWIDTH HANGUL LETTER THIEUTH */
+  {0xffbd, 1, 5087}, /* HALFWIDTH HANGUL LETTER PHIEUPH */
+  {0xffbe, 1, 5088}, /* HALFWIDTH HANGUL LETTER HIEUH */
+  {0xffc2, 1, 5089}, /* HALFWIDTH HANGUL LETTER A */
+  {0xffc3, 1, 5090}, /* HALFWIDTH HANGUL LETTER AE */
+  {0xffc4, 1, 5091}, /* HALFWIDTH HANGUL LETTER YA */
+  {0xffc5, 1, 5092}, /* HALFWIDTH HANGUL LETTER YAE */
+  {0xffc6, 1, 5093}, /* HALFWIDTH HANGUL LETTER EO */
+  {0xffc7, 1, 5094}, /* HALFWIDTH HANGUL LETTER E */
+  {0xffca, 1, 5095}, /* HALFWIDTH HANGUL LETTER YEO */
+  {0xffcb, 1, 5096}, /* HALFWIDTH HANGUL LETTER YE */
+  {0xffcc, 1, 5097}, /* HALFWIDTH HANGUL LETTER O */
+  {0xffcd, 1, 5098}, /* HALFWIDTH HANGUL LETTER WA */
+  {0xffce, 1, 5099}, /* HALFWIDTH HANGUL LETTER WAE */
+  {0xffcf, 1, 5100}, /* HALFWIDTH HANGUL LETTER OE */
+  {0xffd2, 1, 5101}, /* HALFWIDTH HANGUL LETTER YO */
+  {0xffd3, 1, 5102}, /* HALFWIDTH HANGUL LETTER U */
+  {0xffd4, 1, 5103}, /* HALFWIDTH HANGUL LETTER WEO */
+  {0xffd5, 1, 5104}, /* HALFWIDTH HANGUL LETTER WE */
+  {0xffd6, 1, 5105}, /* HALFWIDTH HANGUL LETTER WI */
+  {0xffd7, 1, 5106}, /* HALFWIDTH HANGUL LETTER YU */
+  {0xffda, 1, 5107}, /* HALFWIDTH HANGUL LETTER EU */
+  {0xffdb, 1, 5108}, /* HALFWIDTH HANGUL LETTER YI */
+  {0xffdc, 1, 5109}, /* HALFWIDTH HANGUL LETTER I */
+  {0xffe0, 1, 5110}, /* FULLWIDTH CENT SIGN */
+  {0xffe1, 1, 5111}, /* FULLWIDTH POUND SIGN */
+  {0xffe2, 1, 5112}, /* FULLWIDTH NOT SIGN */
+  {0xffe3, 1, 5113}, /* FULLWIDTH MACRON */
+  {0xffe4, 1, 5114}, /* FULLWIDTH BROKEN BAR */
+  {0xffe5, 1, 5115}, /* FULLWIDTH YEN SIGN */
+  {0xffe6, 1, 5116}, /* FULLWIDTH WON SIGN */
+  {0xffe8, 1, 5117}, /* HALFWIDTH FORMS LIGHT VERTICAL */
+  {0xffe9, 1, 2042}, /* HALFWIDTH LEFTWARDS ARROW */
+  {0xffea, 1, 5118}, /* HALFWIDTH UPWARDS ARROW */
+  {0xffeb, 1, 2044}, /* HALFWIDTH RIGHTWARDS ARROW */
+  {0xffec, 1, 5119}, /* HALFWIDTH DOWNWARDS ARROW */
+  {0xffed, 1, 5120}, /* HALFWIDTH BLACK SQUARE */
+  {0xffee, 1, 5121}, /* HALFWIDTH WHITE CIRCLE */
+  {0x1d15e, 2, 5122}, /* MUSICAL SYMBOL HALF NOTE */
+  {0x1d15f, 2, 5124}, /* MUSICAL SYMBOL QUARTER NOTE */
+  {0x1d160, 2, 5126}, /* MUSICAL SYMBOL EIGHTH NOTE */
+  {0x1d161, 2, 5128}, /* MUSICAL SYMBOL SIXTEENTH NOTE */
+  {0x1d162, 2, 5130}, /* MUSICAL SYMBOL THIRTY-SECOND NOTE */
+  {0x1d163, 2, 5132}, /* MUSICAL SYMBOL SIXTY-FOURTH NOTE */
+  {0x1d164, 2, 5134}, /* MUSICAL SYMBOL ONE HUNDRED TWENTY-EIGHTH NOTE */
+  {0x1d1bb, 2, 5136}, /* MUSICAL SYMBOL MINIMA */
+  {0x1d1bc, 2, 5138}, /* MUSICAL SYMBOL MINIMA BLACK */
+  {0x1d1bd, 2, 5140}, /* MUSICAL SYMBOL SEMIMINIMA WHITE */
+  {0x1d1be, 2, 5142}, /* MUSICAL SYMBOL SEMIMINIMA BLACK */
+  {0x1d1bf, 2, 5144}, /* MUSICAL SYMBOL FUSA WHITE */
+  {0x1d1c0, 2, 5146}, /* MUSICAL SYMBOL FUSA BLACK */
+  {0x1d400, 1, 24}, /* MATHEMATICAL BOLD CAPITAL A */
+  {0x1d401, 1, 910}, /* MATHEMATICAL BOLD CAPITAL B */
+  {0x1d402, 1, 36}, /* MATHEMATICAL BOLD CAPITAL C */
+  {0x1d403, 1, 158}, /* MATHEMATICAL BOLD CAPITAL D */
+  {0x1d404, 1, 38}, /* MATHEMATICAL BOLD CAPITAL E */
+  {0x1d405, 1, 995}, /* MATHEMATICAL BOLD CAPITAL F */
+  {0x1d406, 1, 182}, /* MATHEMATICAL BOLD CAPITAL G */
+  {0x1d407, 1, 198}, /* MATHEMATICAL BOLD CAPITAL H */
+  {0x1d408, 1, 46}, /* MATHEMATICAL BOLD CAPITAL I */
+  {0x1d409, 1, 221}, /* MATHEMATICAL BOLD CAPITAL J */
+  {0x1d40a, 1, 228}, /* MATHEMATICAL BOLD CAPITAL K */
+  {0x1d40b, 1, 232}, /* MATHEMATICAL BOLD CAPITAL L */
+  {0x1d40c, 1, 912}, /* MATHEMATICAL BOLD CAPITAL M */
+  {0x1d40d, 1, 54}, /* MATHEMATICAL BOLD CAPITAL N */
+  {0x1d40e, 1, 56}, /* MATHEMATICAL BOLD CAPITAL O */
+  {0x1d40f, 1, 914}, /* MATHEMATICAL BOLD CAPITAL P */
+  {0x1d410, 1, 1942}, /* MATHEMATICAL BOLD CAPITAL Q */
+  {0x1d411, 1, 274}, /* MATHEMATICAL BOLD CAPITAL R */
+  {0x1d412, 1, 286}, /* MATHEMATICAL BOLD CAPITAL S */
+  {0x1d413, 1, 302}, /* MATHEMATICAL BOLD CAPITAL T */
+  {0x1d414, 1, 66}, /* MATHEMATICAL BOLD CAPITAL U */
+  {0x1d415, 1, 1183}, /* MATHEMATICAL BOLD CAPITAL V */
+  {0x1d416, 1, 334}, /* MATHEMATICAL BOLD CAPITAL W */
+  {0x1d417, 1, 1211}, /* MATHEMATICAL BOLD CAPITAL X */
+  {0x1d418, 1, 74}, /* MATHEMATICAL BOLD CAPITAL Y */
+  {0x1d419, 1, 344}, /* MATHEMATICAL BOLD CAPITAL Z */
+  {0x1d41a, 1, 3}, /* MATHEMATICAL BOLD SMALL A */
+  {0x1d41b, 1, 918}, /* MATHEMATICAL BOLD SMALL B */
+  {0x1d41c, 1, 88}, /* MATHEMATICAL BOLD SMALL C */
+  {0x1d41d, 1, 160}, /* MATHEMATICAL BOLD SMALL D */
+  {0x1d41e, 1, 90}, /* MATHEMATICAL BOLD SMALL E */
+  {0x1d41f, 1, 997}, /* MATHEMATICAL BOLD SMALL F */
+  {0x1d420, 1, 184}, /* MATHEMATICAL BOLD SMALL G */
+  {0x1d421, 1, 200}, /* MATHEMATICAL BOLD SMALL H */
+  {0x1d422, 1, 98}, /* MATHEMATICAL BOLD SMALL I */
+  {0x1d423, 1, 223}, /* MATHEMATICAL BOLD SMALL J */
+  {0x1d424, 1, 230}, /* MATHEMATICAL BOLD SMALL K */
+  {0x1d425, 1, 234}, /* MATHEMATICAL BOLD SMALL L */
+  {0x1d426, 1, 922}, /* MATHEMATICAL BOLD SMALL M */
+  {0x1d427, 1, 106}, /* MATHEMATICAL BOLD SMALL N */
+  {0x1d428, 1, 14}, /* MATHEMATICAL BOLD SMALL O */
+  {0x1d429, 1, 927}, /* MATHEMATICAL BOLD SMALL P */
+  {0x1d42a, 1, 2335}, /* MATHEMATICAL BOLD SMALL Q */
+  {0x1d42b, 1, 276}, /* MATHEMATICAL BOLD SMALL R */
+  {0x1d42c, 1, 288}, /* MATHEMATICAL BOLD SMALL S */
+  {0x1d42d, 1, 304}, /* MATHEMATICAL BOLD SMALL T */
+  {0x1d42e, 1, 118}, /* MATHEMATICAL BOLD SMALL U */
+  {0x1d42f, 1, 930}, /* MATHEMATICAL BOLD SMALL V */
+  {0x1d430, 1, 336}, /* MATHEMATICAL BOLD SMALL W */
+  {0x1d431, 1, 579}, /* MATHEMATICAL BOLD SMALL X */
+  {0x1d432, 1, 126}, /* MATHEMATICAL BOLD SMALL Y */
+  {0x1d433, 1, 346}, /* MATHEMATICAL BOLD SMALL Z */
+  {0x1d434, 1, 24}, /* MATHEMATICAL ITALIC CAPITAL A */
+  {0x1d435, 1, 910}, /* MATHEMATICAL ITALIC CAPITAL B */
+  {0x1d436, 1, 36}, /* MATHEMATICAL ITALIC CAPITAL C */
+  {0x1d437, 1, 158}, /* MATHEMATICAL ITALIC CAPITAL D */
+  {0x1d438, 1, 38}, /* MATHEMATICAL ITALIC CAPITAL E */
+  {0x1d439, 1, 995}, /* MATHEMATICAL ITALIC CAPITAL F */
+  {0x1d43a, 1, 182}, /* MATHEMATICAL ITALIC CAPITAL G */
+  {0x1d43b, 1, 198}, /* MATHEMATICAL ITALIC CAPITAL H */
+  {0x1d43c, 1, 46}, /* MATHEMATICAL ITALIC CAPITAL I */
+  {0x1d43d, 1, 221}, /* MATHEMATICAL ITALIC CAPITAL J */
+  {0x1d43e, 1, 228}, /* MATHEMATICAL ITALIC CAPITAL K */
+  {0x1d43f, 1, 232}, /* MATHEMATICAL ITALIC CAPITAL L */
+  {0x1d440, 1, 912}, /* MATHEMATICAL ITALIC CAPITAL M */
+  {0x1d441, 1, 54}, /* MATHEMATICAL ITALIC CAPITAL N */
+  {0x1d442, 1, 56}, /* MATHEMATICAL ITALIC CAPITAL O */
+  {0x1d443, 1, 914}, /* MATHEMATICAL ITALIC CAPITAL P */
+  {0x1d444, 1, 1942}, /* MATHEMATICAL ITALIC CAPITAL Q */
+  {0x1d445, 1, 274}, /* MATHEMATICAL ITALIC CAPITAL R */
+  {0x1d446, 1, 286}, /* MATHEMATICAL ITALIC CAPITAL S */
+  {0x1d447, 1, 302}, /* MATHEMATICAL ITALIC CAPITAL T */
+  {0x1d448, 1, 66}, /* MATHEMATICAL ITALIC CAPITAL U */
+  {0x1d449, 1, 1183}, /* MATHEMATICAL ITALIC CAPITAL V */
+  {0x1d44a, 1, 334}, /* MATHEMATICAL ITALIC CAPITAL W */
+  {0x1d44b, 1, 1211}, /* MATHEMATICAL ITALIC CAPITAL X */
+  {0x1d44c, 1, 74}, /* MATHEMATICAL ITALIC CAPITAL Y */
+  {0x1d44d, 1, 344}, /* MATHEMATICAL ITALIC CAPITAL Z */
+  {0x1d44e, 1, 3}, /* MATHEMATICAL ITALIC SMALL A */
+  {0x1d44f, 1, 918}, /* MATHEMATICAL ITALIC SMALL B */
+  {0x1d450, 1, 88}, /* MATHEMATICAL ITALIC SMALL C */
+  {0x1d451, 1, 160}, /* MATHEMATICAL ITALIC SMALL D */
+  {0x1d452, 1, 90}, /* MATHEMATICAL ITALIC SMALL E */
+  {0x1d453, 1, 997}, /* MATHEMATICAL ITALIC SMALL F */
+  {0x1d454, 1, 184}, /* MATHEMATICAL ITALIC SMALL G */
+  {0x1d456, 1, 98}, /* MATHEMATICAL ITALIC SMALL I */
+  {0x1d457, 1, 223}, /* MATHEMATICAL ITALIC SMALL J */
+  {0x1d458, 1, 230}, /* MATHEMATICAL ITALIC SMALL K */
+  {0x1d459, 1, 234}, /* MATHEMATICAL ITALIC SMALL L */
+  {0x1d45a, 1, 922}, /* MATHEMATICAL ITALIC SMALL M */
+  {0x1d45b, 1, 106}, /* MATHEMATICAL ITALIC SMALL N */
+  {0x1d45c, 1, 14}, /* MATHEMATICAL ITALIC SMALL O */
+  {0x1d45d, 1, 927}, /* MATHEMATICAL ITALIC SMALL P */
+  {0x1d45e, 1, 2335}, /* MATHEMATICAL ITALIC SMALL Q */
+  {0x1d45f, 1, 276}, /* MATHEMATICAL ITALIC SMALL R */
+  {0x1d460, 1, 288}, /* MATHEMATICAL ITALIC SMALL S */
+  {0x1d461, 1, 304}, /* MATHEMATICAL ITALIC SMALL T */
+  {0x1d462, 1, 118}, /* MATHEMATICAL ITALIC SMALL U */
+  {0x1d463, 1, 930}, /* MATHEMATICAL ITALIC SMALL V */
+  {0x1d464, 1, 336}, /* MATHEMATICAL ITALIC SMALL W */
+  {0x1d465, 1, 579}, /* MATHEMATICAL ITALIC SMALL X */
+  {0x1d466, 1, 126}, /* MATHEMATICAL ITALIC SMALL Y */
+  {0x1d467, 1, 346}, /* MATHEMATICAL ITALIC SMALL Z */
+  {0x1d468, 1, 24}, /* MATHEMATICAL BOLD ITALIC CAPITAL A */
+  {0x1d469, 1, 910}, /* MATHEMATICAL BOLD ITALIC CAPITAL B */
+  {0x1d46a, 1, 36}, /* MATHEMATICAL BOLD ITALIC CAPITAL C */
+  {0x1d46b, 1, 158}, /* MATHEMATICAL BOLD ITALIC CAPITAL D */
+  {0x1d46c, 1, 38}, /* MATHEMATICAL BOLD ITALIC CAPITAL E */
+  {0x1d46d, 1, 995}, /* MATHEMATICAL BOLD ITALIC CAPITAL F */
+  {0x1d46e, 1, 182}, /* MATHEMATICAL BOLD ITALIC CAPITAL G */
+  {0x1d46f, 1, 198}, /* MATHEMATICAL BOLD ITALIC CAPITAL H */
+  {0x1d470, 1, 46}, /* MATHEMATICAL BOLD ITALIC CAPITAL I */
+  {0x1d471, 1, 221}, /* MATHEMATICAL BOLD ITALIC CAPITAL J */
+  {0x1d472, 1, 228}, /* MATHEMATICAL BOLD ITALIC CAPITAL K */
+  {0x1d473, 1, 232}, /* MATHEMATICAL BOLD ITALIC CAPITAL L */
+  {0x1d474, 1, 912}, /* MATHEMATICAL BOLD ITALIC CAPITAL M */
+  {0x1d475, 1, 54}, /* MATHEMATICAL BOLD ITALIC CAPITAL N */
+  {0x1d476, 1, 56}, /* MATHEMATICAL BOLD ITALIC CAPITAL O */
+  {0x1d477, 1, 914}, /* MATHEMATICAL BOLD ITALIC CAPITAL P */
+  {0x1d478, 1, 1942}, /* MATHEMATICAL BOLD ITALIC CAPITAL Q */
+  {0x1d479, 1, 274}, /* MATHEMATICAL BOLD ITALIC CAPITAL R */
+  {0x1d47a, 1, 286}, /* MATHEMATICAL BOLD ITALIC CAPITAL S */
+  {0x1d47b, 1, 302}, /* MATHEMATICAL BOLD ITALIC CAPITAL T */
+  {0x1d47c, 1, 66}, /* MATHEMATICAL BOLD ITALIC CAPITAL U */
+  {0x1d47d, 1, 1183}, /* MATHEMATICAL BOLD ITALIC CAPITAL V */
+  {0x1d47e, 1, 334}, /* MATHEMATICAL BOLD ITALIC CAPITAL W */
+  {0x1d47f, 1, 1211}, /* MATHEMATICAL BOLD ITALIC CAPITAL X */
+  {0x1d480, 1, 74}, /* MATHEMATICAL BOLD ITALIC CAPITAL Y */
+  {0x1d481, 1, 344}, /* MATHEMATICAL BOLD ITALIC CAPITAL Z */
+  {0x1d482, 1, 3}, /* MATHEMATICAL BOLD ITALIC SMALL A */
+  {0x1d483, 1, 918}, /* MATHEMATICAL BOLD ITALIC SMALL B */
+  {0x1d484, 1, 88}, /* MATHEMATICAL BOLD ITALIC SMALL C */
+  {0x1d485, 1, 160}, /* MATHEMATICAL BOLD ITALIC SMALL D */
+  {0x1d486, 1, 90}, /* MATHEMATICAL BOLD ITALIC SMALL E */
+  {0x1d487, 1, 997}, /* MATHEMATICAL BOLD ITALIC SMALL F */
+  {0x1d488, 1, 184}, /* MATHEMATICAL BOLD ITALIC SMALL G */
+  {0x1d489, 1, 200}, /* MATHEMATICAL BOLD ITALIC SMALL H */
+  {0x1d48a, 1, 98}, /* MATHEMATICAL BOLD ITALIC SMALL I */
+  {0x1d48b, 1, 223}, /* MATHEMATICAL BOLD ITALIC SMALL J */
+  {0x1d48c, 1, 230}, /* MATHEMATICAL BOLD ITALIC SMALL K */
+  {0x1d48d, 1, 234}, /* MATHEMATICAL BOLD ITALIC SMALL L */
+  {0x1d48e, 1, 922}, /* MATHEMATICAL BOLD ITALIC SMALL M */
+  {0x1d48f, 1, 106}, /* MATHEMATICAL BOLD ITALIC SMALL N */
+  {0x1d490, 1, 14}, /* MATHEMATICAL BOLD ITALIC SMALL O */
+  {0x1d491, 1, 927}, /* MATHEMATICAL BOLD ITALIC SMALL P */
+  {0x1d492, 1, 2335}, /* MATHEMATICAL BOLD ITALIC SMALL Q */
+  {0x1d493, 1, 276}, /* MATHEMATICAL BOLD ITALIC SMALL R */
+  {0x1d494, 1, 288}, /* MATHEMATICAL BOLD ITALIC SMALL S */
+  {0x1d495, 1, 304}, /* MATHEMATICAL BOLD ITALIC SMALL T */
+  {0x1d496, 1, 118}, /* MATHEMATICAL BOLD ITALIC SMALL U */
+  {0x1d497, 1, 930}, /* MATHEMATICAL BOLD ITALIC SMALL V */
+  {0x1d498, 1, 336}, /* MATHEMATICAL BOLD ITALIC SMALL W */
+  {0x1d499, 1, 579}, /* MATHEMATICAL BOLD ITALIC SMALL X */
+  {0x1d49a, 1, 126}, /* MATHEMATICAL BOLD ITALIC SMALL Y */
+  {0x1d49b, 1, 346}, /* MATHEMATICAL BOLD ITALIC SMALL Z */
+  {0x1d49c, 1, 24}, /* MATHEMATICAL SCRIPT CAPITAL A */
+  {0x1d49e, 1, 36}, /* MATHEMATICAL SCRIPT CAPITAL C */
+  {0x1d49f, 1, 158}, /* MATHEMATICAL SCRIPT CAPITAL D */
+  {0x1d4a2, 1, 182}, /* MATHEMATICAL SCRIPT CAPITAL G */
+  {0x1d4a5, 1, 221}, /* MATHEMATICAL SCRIPT CAPITAL J */
+  {0x1d4a6, 1, 228}, /* MATHEMATICAL SCRIPT CAPITAL K */
+  {0x1d4a9, 1, 54}, /* MATHEMATICAL SCRIPT CAPITAL N */
+  {0x1d4aa, 1, 56}, /* MATHEMATICAL SCRIPT CAPITAL O */
+  {0x1d4ab, 1, 914}, /* MATHEMATICAL SCRIPT CAPITAL P */
+  {0x1d4ac, 1, 1942}, /* MATHEMATICAL SCRIPT CAPITAL Q */
+  {0x1d4ae, 1, 286}, /* MATHEMATICAL SCRIPT CAPITAL S */
+  {0x1d4af, 1, 302}, /* MATHEMATICAL SCRIPT CAPITAL T */
+  {0x1d4b0, 1, 66}, /* MATHEMATICAL SCRIPT CAPITAL U */
+  {0x1d4b1, 1, 1183}, /* MATHEMATICAL SCRIPT CAPITAL V */
+  {0x1d4b2, 1, 334}, /* MATHEMATICAL SCRIPT CAPITAL W */
+  {0x1d4b3, 1, 1211}, /* MATHEMATICAL SCRIPT CAPITAL X */
+  {0x1d4b4, 1, 74}, /* MATHEMATICAL SCRIPT CAPITAL Y */
+  {0x1d4b5, 1, 344}, /* MATHEMATICAL SCRIPT CAPITAL Z */
+  {0x1d4b6, 1, 3}, /* MATHEMATICAL SCRIPT SMALL A */
+  {0x1d4b7, 1, 918}, /* MATHEMATICAL SCRIPT SMALL B */
+  {0x1d4b8, 1, 88}, /* MATHEMATICAL SCRIPT SMALL C */
+  {0x1d4b9, 1, 160}, /* MATHEMATICAL SCRIPT SMALL D */
+  {0x1d4bb, 1, 997}, /* MATHEMATICAL SCRIPT SMALL F */
+  {0x1d4bd, 1, 200}, /* MATHEMATICAL SCRIPT SMALL H */
+  {0x1d4be, 1, 98}, /* MATHEMATICAL SCRIPT SMALL I */
+  {0x1d4bf, 1, 223}, /* MATHEMATICAL SCRIPT SMALL J */
+  {0x1d4c0, 1, 230}, /* MATHEMATICAL SCRIPT SMALL K */
+  {0x1d4c1, 1, 234}, /* MATHEMATICAL SCRIPT SMALL L */
+  {0x1d4c2, 1, 922}, /* MATHEMATICAL SCRIPT SMALL M */
+  {0x1d4c3, 1, 106}, /* MATHEMATICAL SCRIPT SMALL N */
+  {0x1d4c5, 1, 927}, /* MATHEMATICAL SCRIPT SMALL P */
+  {0x1d4c6, 1, 2335}, /* MATHEMATICAL SCRIPT SMALL Q */
+  {0x1d4c7, 1, 276}, /* MATHEMATICAL SCRIPT SMALL R */
+  {0x1d4c8, 1, 288}, /* MATHEMATICAL SCRIPT SMALL S */
+  {0x1d4c9, 1, 304}, /* MATHEMATICAL SCRIPT SMALL T */
+  {0x1d4ca, 1, 118}, /* MATHEMATICAL SCRIPT SMALL U */
+  {0x1d4cb, 1, 930}, /* MATHEMATICAL SCRIPT SMALL V */
+  {0x1d4cc, 1, 336}, /* MATHEMATICAL SCRIPT SMALL W */
+  {0x1d4cd, 1, 579}, /* MATHEMATICAL SCRIPT SMALL X */
+  {0x1d4ce, 1, 126}, /* MATHEMATICAL SCRIPT SMALL Y */
+  {0x1d4cf, 1, 346}, /* MATHEMATICAL SCRIPT SMALL Z */
+  {0x1d4d0, 1, 24}, /* MATHEMATICAL BOLD SCRIPT CAPITAL A */
+  {0x1d4d1, 1, 910}, /* MATHEMATICAL BOLD SCRIPT CAPITAL B */
+  {0x1d4d2, 1, 36}, /* MATHEMATICAL BOLD SCRIPT CAPITAL C */
+  {0x1d4d3, 1, 158}, /* MATHEMATICAL BOLD SCRIPT CAPITAL D */
+  {0x1d4d4, 1, 38}, /* MATHEMATICAL BOLD SCRIPT CAPITAL E */
+  {0x1d4d5, 1, 995}, /* MATHEMATICAL BOLD SCRIPT CAPITAL F */
+  {0x1d4d6, 1, 182}, /* MATHEMATICAL BOLD SCRIPT CAPITAL G */
+  {0x1d4d7, 1, 198}, /* MATHEMATICAL BOLD SCRIPT CAPITAL H */
+  {0x1d4d8, 1, 46}, /* MATHEMATICAL BOLD SCRIPT CAPITAL I */
+  {0x1d4d9, 1, 221}, /* MATHEMATICAL BOLD SCRIPT CAPITAL J */
+  {0x1d4da, 1, 228}, /* MATHEMATICAL BOLD SCRIPT CAPITAL K */
+  {0x1d4db, 1, 232}, /* MATHEMATICAL BOLD SCRIPT CAPITAL L */
+  {0x1d4dc, 1, 912}, /* MATHEMATICAL BOLD SCRIPT CAPITAL M */
+  {0x1d4dd, 1, 54}, /* MATHEMATICAL BOLD SCRIPT CAPITAL N */
+  {0x1d4de, 1, 56}, /* MATHEMATICAL BOLD SCRIPT CAPITAL O */
+  {0x1d4df, 1, 914}, /* MATHEMATICAL BOLD SCRIPT CAPITAL P */
+  {0x1d4e0, 1, 1942}, /* MATHEMATICAL BOLD SCRIPT CAPITAL Q */
+  {0x1d4e1, 1, 274}, /* MATHEMATICAL BOLD SCRIPT CAPITAL R */
+  {0x1d4e2, 1, 286}, /* MATHEMATICAL BOLD SCRIPT CAPITAL S */
+  {0x1d4e3, 1, 302}, /* MATHEMATICAL BOLD SCRIPT CAPITAL T */
+  {0x1d4e4, 1, 66}, /* MATHEMATICAL BOLD SCRIPT CAPITAL U */
+  {0x1d4e5, 1, 1183}, /* MATHEMATICAL BOLD SCRIPT CAPITAL V */
+  {0x1d4e6, 1, 334}, /* MATHEMATICAL BOLD SCRIPT CAPITAL W */
+  {0x1d4e7, 1, 1211}, /* MATHEMATICAL BOLD SCRIPT CAPITAL X */
+  {0x1d4e8, 1, 74}, /* MATHEMATICAL BOLD SCRIPT CAPITAL Y */
+  {0x1d4e9, 1, 344}, /* MATHEMATICAL BOLD SCRIPT CAPITAL Z */
+  {0x1d4ea, 1, 3}, /* MATHEMATICAL BOLD SCRIPT SMALL A */
+  {0x1d4eb, 1, 918}, /* MATHEMATICAL BOLD SCRIPT SMALL B */
+  {0x1d4ec, 1, 88}, /* MATHEMATICAL BOLD SCRIPT SMALL C */
+  {0x1d4ed, 1, 160}, /* MATHEMATICAL BOLD SCRIPT SMALL D */
+  {0x1d4ee, 1, 90}, /* MATHEMATICAL BOLD SCRIPT SMALL E */
+  {0x1d4ef, 1, 997}, /* MATHEMATICAL BOLD SCRIPT SMALL F */
+  {0x1d4f0, 1, 184}, /* MATHEMATICAL BOLD SCRIPT SMALL G */
+  {0x1d4f1, 1, 200}, /* MATHEMATICAL BOLD SCRIPT SMALL H */
+  {0x1d4f2, 1, 98}, /* MATHEMATICAL BOLD SCRIPT SMALL I */
+  {0x1d4f3, 1, 223}, /* MATHEMATICAL BOLD SCRIPT SMALL J */
+  {0x1d4f4, 1, 230}, /* MATHEMATICAL BOLD SCRIPT SMALL K */
+  {0x1d4f5, 1, 234}, /* MATHEMATICAL BOLD SCRIPT SMALL L */
+  {0x1d4f6, 1, 922}, /* MATHEMATICAL BOLD SCRIPT SMALL M */
+  {0x1d4f7, 1, 106}, /* MATHEMATICAL BOLD SCRIPT SMALL N */
+  {0x1d4f8, 1, 14}, /* MATHEMATICAL BOLD SCRIPT SMALL O */
+  {0x1d4f9, 1, 927}, /* MATHEMATICAL BOLD SCRIPT SMALL P */
+  {0x1d4fa, 1, 2335}, /* MATHEMATICAL BOLD SCRIPT SMALL Q */
+  {0x1d4fb, 1, 276}, /* MATHEMATICAL BOLD SCRIPT SMALL R */
+  {0x1d4fc, 1, 288}, /* MATHEMATICAL BOLD SCRIPT SMALL S */
+  {0x1d4fd, 1, 304}, /* MATHEMATICAL BOLD SCRIPT SMALL T */
+  {0x1d4fe, 1, 118}, /* MATHEMATICAL BOLD SCRIPT SMALL U */
+  {0x1d4ff, 1, 930}, /* MATHEMATICAL BOLD SCRIPT SMALL V */
+  {0x1d500, 1, 336}, /* MATHEMATICAL BOLD SCRIPT SMALL W */
+  {0x1d501, 1, 579}, /* MATHEMATICAL BOLD SCRIPT SMALL X */
+  {0x1d502, 1, 126}, /* MATHEMATICAL BOLD SCRIPT SMALL Y */
+  {0x1d503, 1, 346}, /* MATHEMATICAL BOLD SCRIPT SMALL Z */
+  {0x1d504, 1, 24}, /* MATHEMATICAL FRAKTUR CAPITAL A */
+  {0x1d505, 1, 910}, /* MATHEMATICAL FRAKTUR CAPITAL B */
+  {0x1d507, 1, 158}, /* MATHEMATICAL FRAKTUR CAPITAL D */
+  {0x1d508, 1, 38}, /* MATHEMATICAL FRAKTUR CAPITAL E */
+  {0x1d509, 1, 995}, /* MATHEMATICAL FRAKTUR CAPITAL F */
+  {0x1d50a, 1, 182}, /* MATHEMATICAL FRAKTUR CAPITAL G */
+  {0x1d50d, 1, 221}, /* MATHEMATICAL FRAKTUR CAPITAL J */
+  {0x1d50e, 1, 228}, /* MATHEMATICAL FRAKTUR CAPITAL K */
+  {0x1d50f, 1, 232}, /* MATHEMATICAL FRAKTUR CAPITAL L */
+  {0x1d510, 1, 912}, /* MATHEMATICAL FRAKTUR CAPITAL M */
+  {0x1d511, 1, 54}, /* MATHEMATICAL FRAKTUR CAPITAL N */
+  {0x1d512, 1, 56}, /* MATHEMATICAL FRAKTUR CAPITAL O */
+  {0x1d513, 1, 914}, /* MATHEMATICAL FRAKTUR CAPITAL P */
+  {0x1d514, 1, 1942}, /* MATHEMATICAL FRAKTUR CAPITAL Q */
+  {0x1d516, 1, 286}, /* MATHEMATICAL FRAKTUR CAPITAL S */
+  {0x1d517, 1, 302}, /* MATHEMATICAL FRAKTUR CAPITAL T */
+  {0x1d518, 1, 66}, /* MATHEMATICAL FRAKTUR CAPITAL U */
+  {0x1d519, 1, 1183}, /* MATHEMATICAL FRAKTUR CAPITAL V */
+  {0x1d51a, 1, 334}, /* MATHEMATICAL FRAKTUR CAPITAL W */
+  {0x1d51b, 1, 1211}, /* MATHEMATICAL FRAKTUR CAPITAL X */
+  {0x1d51c, 1, 74}, /* MATHEMATICAL FRAKTUR CAPITAL Y */
+  {0x1d51e, 1, 3}, /* MATHEMATICAL FRAKTUR SMALL A */
+  {0x1d51f, 1, 918}, /* MATHEMATICAL FRAKTUR SMALL B */
+  {0x1d520, 1, 88}, /* MATHEMATICAL FRAKTUR SMALL C */
+  {0x1d521, 1, 160}, /* MATHEMATICAL FRAKTUR SMALL D */
+  {0x1d522, 1, 90}, /* MATHEMATICAL FRAKTUR SMALL E */
+  {0x1d523, 1, 997}, /* MATHEMATICAL FRAKTUR SMALL F */
+  {0x1d524, 1, 184}, /* MATHEMATICAL FRAKTUR SMALL G */
+  {0x1d525, 1, 200}, /* MATHEMATICAL FRAKTUR SMALL H */
+  {0x1d526, 1, 98}, /* MATHEMATICAL FRAKTUR SMALL I */
+  {0x1d527, 1, 223}, /* MATHEMATICAL FRAKTUR SMALL J */
+  {0x1d528, 1, 230}, /* MATHEMATICAL FRAKTUR SMALL K */
+  {0x1d529, 1, 234}, /* MATHEMATICAL FRAKTUR SMALL L */
+  {0x1d52a, 1, 922}, /* MATHEMATICAL FRAKTUR SMALL M */
+  {0x1d52b, 1, 106}, /* MATHEMATICAL FRAKTUR SMALL N */
+  {0x1d52c, 1, 14}, /* MATHEMATICAL FRAKTUR SMALL O */
+  {0x1d52d, 1, 927}, /* MATHEMATICAL FRAKTUR SMALL P */
+  {0x1d52e, 1, 2335}, /* MATHEMATICAL FRAKTUR SMALL Q */
+  {0x1d52f, 1, 276}, /* MATHEMATICAL FRAKTUR SMALL R */
+  {0x1d530, 1, 288}, /* MATHEMATICAL FRAKTUR SMALL S */
+  {0x1d531, 1, 304}, /* MATHEMATICAL FRAKTUR SMALL T */
+  {0x1d532, 1, 118}, /* MATHEMATICAL FRAKTUR SMALL U */
+  {0x1d533, 1, 930}, /* MATHEMATICAL FRAKTUR SMALL V */
+  {0x1d534, 1, 336}, /* MATHEMATICAL FRAKTUR SMALL W */
+  {0x1d535, 1, 579}, /* MATHEMATICAL FRAKTUR SMALL X */
+  {0x1d536, 1, 126}, /* MATHEMATICAL FRAKTUR SMALL Y */
+  {0x1d537, 1, 346}, /* MATHEMATICAL FRAKTUR SMALL Z */
+  {0x1d538, 1, 24}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL A */
+  {0x1d539, 1, 910}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL B */
+  {0x1d53b, 1, 158}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL D */
+  {0x1d53c, 1, 38}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL E */
+  {0x1d53d, 1, 995}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL F */
+  {0x1d53e, 1, 182}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL G */
+  {0x1d540, 1, 46}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL I */
+  {0x1d541, 1, 221}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL J */
+  {0x1d542, 1, 228}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL K */
+  {0x1d543, 1, 232}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL L */
+  {0x1d544, 1, 912}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL M */
+  {0x1d546, 1, 56}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL O */
+  {0x1d54a, 1, 286}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL S */
+  {0x1d54b, 1, 302}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL T */
+  {0x1d54c, 1, 66}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL U */
+  {0x1d54d, 1, 1183}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL V */
+  {0x1d54e, 1, 334}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL W */
+  {0x1d54f, 1, 1211}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL X */
+  {0x1d550, 1, 74}, /* MATHEMATICAL DOUBLE-STRUCK CAPITAL Y */
+  {0x1d552, 1, 3}, /* MATHEMATICAL DOUBLE-STRUCK SMALL A */
+  {0x1d553, 1, 918}, /* MATHEMATICAL DOUBLE-STRUCK SMALL B */
+  {0x1d554, 1, 88}, /* MATHEMATICAL DOUBLE-STRUCK SMALL C */
+  {0x1d555, 1, 160}, /* MATHEMATICAL DOUBLE-STRUCK SMALL D */
+  {0x1d556, 1, 90}, /* MATHEMATICAL DOUBLE-STRUCK SMALL E */
+  {0x1d557, 1, 997}, /* MATHEMATICAL DOUBLE-STRUCK SMALL F */
+  {0x1d558, 1, 184}, /* MATHEMATICAL DOUBLE-STRUCK SMALL G */
+  {0x1d559, 1, 200}, /* MATHEMATICAL DOUBLE-STRUCK SMALL H */
+  {0x1d55a, 1, 98}, /* MATHEMATICAL DOUBLE-STRUCK SMALL I */
+  {0x1d55b, 1, 223}, /* MATHEMATICAL DOUBLE-STRUCK SMALL J */
+  {0x1d55c, 1, 230}, /* MATHEMATICAL DOUBLE-STRUCK SMALL K */
+  {0x1d55d, 1, 234}, /* MATHEMATICAL DOUBLE-STRUCK SMALL L */
+  {0x1d55e, 1, 922}, /* MATHEMATICAL DOUBLE-STRUCK SMALL M */
+  {0x1d55f, 1, 106}, /* MATHEMATICAL DOUBLE-STRUCK SMALL N */
+  {0x1d560, 1, 14}, /* MATHEMATICAL DOUBLE-STRUCK SMALL O */
+  {0x1d561, 1, 927}, /* MATHEMATICAL DOUBLE-STRUCK SMALL P */
+  {0x1d562, 1, 2335}, /* MATHEMATICAL DOUBLE-STRUCK SMALL Q */
+  {0x1d563, 1, 276}, /* MATHEMATICAL DOUBLE-STRUCK SMALL R */
+  {0x1d564, 1, 288}, /* MATHEMATICAL DOUBLE-STRUCK SMALL S */
+  {0x1d565, 1, 304}, /* MATHEMATICAL DOUBLE-STRUCK SMALL T */
+  {0x1d566, 1, 118}, /* MATHEMATICAL DOUBLE-STRUCK SMALL U */
+  {0x1d567, 1, 930}, /* MATHEMATICAL DOUBLE-STRUCK SMALL V */
+  {0x1d568, 1, 336}, /* MATHEMATICAL DOUBLE-STRUCK SMALL W */
+  {0x1d569, 1, 579}, /* MATHEMATICAL DOUBLE-STRUCK SMALL X */
+  {0x1d56a, 1, 126}, /* MATHEMATICAL DOUBLE-STRUCK SMALL Y */
+  {0x1d56b, 1, 346}, /* MATHEMATICAL DOUBLE-STRUCK SMALL Z */
+  {0x1d56c, 1, 24}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL A */
+  {0x1d56d, 1, 910}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL B */
+  {0x1d56e, 1, 36}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL C */
+  {0x1d56f, 1, 158}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL D */
+  {0x1d570, 1, 38}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL E */
+  {0x1d571, 1, 995}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL F */
+  {0x1d572, 1, 182}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL G */
+  {0x1d573, 1, 198}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL H */
+  {0x1d574, 1, 46}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL I */
+  {0x1d575, 1, 221}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL J */
+  {0x1d576, 1, 228}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL K */
+  {0x1d577, 1, 232}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL L */
+  {0x1d578, 1, 912}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL M */
+  {0x1d579, 1, 54}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL N */
+  {0x1d57a, 1, 56}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL O */
+  {0x1d57b, 1, 914}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL P */
+  {0x1d57c, 1, 1942}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL Q */
+  {0x1d57d, 1, 274}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL R */
+  {0x1d57e, 1, 286}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL S */
+  {0x1d57f, 1, 302}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL T */
+  {0x1d580, 1, 66}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL U */
+  {0x1d581, 1, 1183}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL V */
+  {0x1d582, 1, 334}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL W */
+  {0x1d583, 1, 1211}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL X */
+  {0x1d584, 1, 74}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL Y */
+  {0x1d585, 1, 344}, /* MATHEMATICAL BOLD FRAKTUR CAPITAL Z */
+  {0x1d586, 1, 3}, /* MATHEMATICAL BOLD FRAKTUR SMALL A */
+  {0x1d587, 1, 918}, /* MATHEMATICAL BOLD FRAKTUR SMALL B */
+  {0x1d588, 1, 88}, /* MATHEMATICAL BOLD FRAKTUR SMALL C */
+  {0x1d589, 1, 160}, /* MATHEMATICAL BOLD FRAKTUR SMALL D */
+  {0x1d58a, 1, 90}, /* MATHEMATICAL BOLD FRAKTUR SMALL E */
+  {0x1d58b, 1, 997}, /* MATHEMATICAL BOLD FRAKTUR SMALL F */
+  {0x1d58c, 1, 184}, /* MATHEMATICAL BOLD FRAKTUR SMALL G */
+  {0x1d58d, 1, 200}, /* MATHEMATICAL BOLD FRAKTUR SMALL H */
+  {0x1d58e, 1, 98}, /* MATHEMATICAL BOLD FRAKTUR SMALL I */
+  {0x1d58f, 1, 223}, /* MATHEMATICAL BOLD FRAKTUR SMALL J */
+  {0x1d590, 1, 230}, /* MATHEMATICAL BOLD FRAKTUR SMALL K */
+  {0x1d591, 1, 234}, /* MATHEMATICAL BOLD FRAKTUR SMALL L */
+  {0x1d592, 1, 922}, /* MATHEMATICAL BOLD FRAKTUR SMALL M */
+  {0x1d593, 1, 106}, /* MATHEMATICAL BOLD FRAKTUR SMALL N */
+  {0x1d594, 1, 14}, /* MATHEMATICAL BOLD FRAKTUR SMALL O */
+  {0x1d595, 1, 927}, /* MATHEMATICAL BOLD FRAKTUR SMALL P */
+  {0x1d596, 1, 2335}, /* MATHEMATICAL BOLD FRAKTUR SMALL Q */
+  {0x1d597, 1, 276}, /* MATHEMATICAL BOLD FRAKTUR SMALL R */
+  {0x1d598, 1, 288}, /* MATHEMATICAL BOLD FRAKTUR SMALL S */
+  {0x1d599, 1, 304}, /* MATHEMATICAL BOLD FRAKTUR SMALL T */
+  {0x1d59a, 1, 118}, /* MATHEMATICAL BOLD FRAKTUR SMALL U */
+  {0x1d59b, 1, 930}, /* MATHEMATICAL BOLD FRAKTUR SMALL V */
+  {0x1d59c, 1, 336}, /* MATHEMATICAL BOLD FRAKTUR SMALL W */
+  {0x1d59d, 1, 579}, /* MATHEMATICAL BOLD FRAKTUR SMALL X */
+  {0x1d59e, 1, 126}, /* MATHEMATICAL BOLD FRAKTUR SMALL Y */
+  {0x1d59f, 1, 346}, /* MATHEMATICAL BOLD FRAKTUR SMALL Z */
+  {0x1d5a0, 1, 24}, /* MATHEMATICAL SANS-SERIF CAPITAL A */
+  {0x1d5a1, 1, 910}, /* MATHEMATICAL SANS-SERIF CAPITAL B */
+  {0x1d5a2, 1, 36}, /* MATHEMATICAL SANS-SERIF CAPITAL C */
+  {0x1d5a3, 1, 158}, /* MATHEMATICAL SANS-SERIF CAPITAL D */
+  {0x1d5a4, 1, 38}, /* MATHEMATICAL SANS-SERIF CAPITAL E */
+  {0x1d5a5, 1, 995}, /* MATHEMATICAL SANS-SERIF CAPITAL F */
+  {0x1d5a6, 1, 182}, /* MATHEMATICAL SANS-SERIF CAPITAL G */
+  {0x1d5a7, 1, 198}, /* MATHEMATICAL SANS-SERIF CAPITAL H */
+  {0x1d5a8, 1, 46}, /* MATHEMATICAL SANS-SERIF CAPITAL I */
+  {0x1d5a9, 1, 221}, /* MATHEMATICAL SANS-SERIF CAPITAL J */
+  {0x1d5aa, 1, 228}, /* MATHEMATICAL SANS-SERIF CAPITAL K */
+  {0x1d5ab, 1, 232}, /* MATHEMATICAL SANS-SERIF CAPITAL L */
+  {0x1d5ac, 1, 912}, /* MATHEMATICAL SANS-SERIF CAPITAL M */
+  {0x1d5ad, 1, 54}, /* MATHEMATICAL SANS-SERIF CAPITAL N */
+  {0x1d5ae, 1, 56}, /* MATHEMATICAL SANS-SERIF CAPITAL O */
+  {0x1d5af, 1, 914}, /* MATHEMATICAL SANS-SERIF CAPITAL P */
+  {0x1d5b0, 1, 1942}, /* MATHEMATICAL SANS-SERIF CAPITAL Q */
+  {0x1d5b1, 1, 274}, /* MATHEMATICAL SANS-SERIF CAPITAL R */
+  {0x1d5b2, 1, 286}, /* MATHEMATICAL SANS-SERIF CAPITAL S */
+  {0x1d5b3, 1, 302}, /* MATHEMATICAL SANS-SERIF CAPITAL T */
+  {0x1d5b4, 1, 66}, /* MATHEMATICAL SANS-SERIF CAPITAL U */
+  {0x1d5b5, 1, 1183}, /* MATHEMATICAL SANS-SERIF CAPITAL V */
+  {0x1d5b6, 1, 334}, /* MATHEMATICAL SANS-SERIF CAPITAL W */
+  {0x1d5b7, 1, 1211}, /* MATHEMATICAL SANS-SERIF CAPITAL X */
+  {0x1d5b8, 1, 74}, /* MATHEMATICAL SANS-SERIF CAPITAL Y */
+  {0x1d5b9, 1, 344}, /* MATHEMATICAL SANS-SERIF CAPITAL Z */
+  {0x1d5ba, 1, 3}, /* MATHEMATICAL SANS-SERIF SMALL A */
+  {0x1d5bb, 1, 918}, /* MATHEMATICAL SANS-SERIF SMALL B */
+  {0x1d5bc, 1, 88}, /* MATHEMATICAL SANS-SERIF SMALL C */
+  {0x1d5bd, 1, 160}, /* MATHEMATICAL SANS-SERIF SMALL D */
+  {0x1d5be, 1, 90}, /* MATHEMATICAL SANS-SERIF SMALL E */
+  {0x1d5bf, 1, 997}, /* MATHEMATICAL SANS-SERIF SMALL F */
+  {0x1d5c0, 1, 184}, /* MATHEMATICAL SANS-SERIF SMALL G */
+  {0x1d5c1, 1, 200}, /* MATHEMATICAL SANS-SERIF SMALL H */
+  {0x1d5c2, 1, 98}, /* MATHEMATICAL SANS-SERIF SMALL I */
+  {0x1d5c3, 1, 223}, /* MATHEMATICAL SANS-SERIF SMALL J */
+  {0x1d5c4, 1, 230}, /* MATHEMATICAL SANS-SERIF SMALL K */
+  {0x1d5c5, 1, 234}, /* MATHEMATICAL SANS-SERIF SMALL L */
+  {0x1d5c6, 1, 922}, /* MATHEMATICAL SANS-SERIF SMALL M */
+  {0x1d5c7, 1, 106}, /* MATHEMATICAL SANS-SERIF SMALL N */
+  {0x1d5c8, 1, 14}, /* MATHEMATICAL SANS-SERIF SMALL O */
+  {0x1d5c9, 1, 927}, /* MATHEMATICAL SANS-SERIF SMALL P */
+  {0x1d5ca, 1, 2335}, /* MATHEMATICAL SANS-SERIF SMALL Q */
+  {0x1d5cb, 1, 276}, /* MATHEMATICAL SANS-SERIF SMALL R */
+  {0x1d5cc, 1, 288}, /* MATHEMATICAL SANS-SERIF SMALL S */
+  {0x1d5cd, 1, 304}, /* MATHEMATICAL SANS-SERIF SMALL T */
+  {0x1d5ce, 1, 118}, /* MATHEMATICAL SANS-SERIF SMALL U */
+  {0x1d5cf, 1, 930}, /* MATHEMATICAL SANS-SERIF SMALL V */
+  {0x1d5d0, 1, 336}, /* MATHEMATICAL SANS-SERIF SMALL W */
+  {0x1d5d1, 1, 579}, /* MATHEMATICAL SANS-SERIF SMALL X */
+  {0x1d5d2, 1, 126}, /* MATHEMATICAL SANS-SERIF SMALL Y */
+  {0x1d5d3, 1, 346}, /* MATHEMATICAL SANS-SERIF SMALL Z */
+  {0x1d5d4, 1, 24}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL A */
+  {0x1d5d5, 1, 910}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL B */
+  {0x1d5d6, 1, 36}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL C */
+  {0x1d5d7, 1, 158}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL D */
+  {0x1d5d8, 1, 38}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL E */
+  {0x1d5d9, 1, 995}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL F */
+  {0x1d5da, 1, 182}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL G */
+  {0x1d5db, 1, 198}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL H */
+  {0x1d5dc, 1, 46}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL I */
+  {0x1d5dd, 1, 221}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL J */
+  {0x1d5de, 1, 228}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL K */
+  {0x1d5df, 1, 232}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL L */
+  {0x1d5e0, 1, 912}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL M */
+  {0x1d5e1, 1, 54}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL N */
+  {0x1d5e2, 1, 56}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL O */
+  {0x1d5e3, 1, 914}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL P */
+  {0x1d5e4, 1, 1942}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL Q */
+  {0x1d5e5, 1, 274}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL R */
+  {0x1d5e6, 1, 286}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL S */
+  {0x1d5e7, 1, 302}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL T */
+  {0x1d5e8, 1, 66}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL U */
+  {0x1d5e9, 1, 1183}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL V */
+  {0x1d5ea, 1, 334}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL W */
+  {0x1d5eb, 1, 1211}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL X */
+  {0x1d5ec, 1, 74}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL Y */
+  {0x1d5ed, 1, 344}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL Z */
+  {0x1d5ee, 1, 3}, /* MATHEMATICAL SANS-SERIF BOLD SMALL A */
+  {0x1d5ef, 1, 918}, /* MATHEMATICAL SANS-SERIF BOLD SMALL B */
+  {0x1d5f0, 1, 88}, /* MATHEMATICAL SANS-SERIF BOLD SMALL C */
+  {0x1d5f1, 1, 160}, /* MATHEMATICAL SANS-SERIF BOLD SMALL D */
+  {0x1d5f2, 1, 90}, /* MATHEMATICAL SANS-SERIF BOLD SMALL E */
+  {0x1d5f3, 1, 997}, /* MATHEMATICAL SANS-SERIF BOLD SMALL F */
+  {0x1d5f4, 1, 184}, /* MATHEMATICAL SANS-SERIF BOLD SMALL G */
+  {0x1d5f5, 1, 200}, /* MATHEMATICAL SANS-SERIF BOLD SMALL H */
+  {0x1d5f6, 1, 98}, /* MATHEMATICAL SANS-SERIF BOLD SMALL I */
+  {0x1d5f7, 1, 223}, /* MATHEMATICAL SANS-SERIF BOLD SMALL J */
+  {0x1d5f8, 1, 230}, /* MATHEMATICAL SANS-SERIF BOLD SMALL K */
+  {0x1d5f9, 1, 234}, /* MATHEMATICAL SANS-SERIF BOLD SMALL L */
+  {0x1d5fa, 1, 922}, /* MATHEMATICAL SANS-SERIF BOLD SMALL M */
+  {0x1d5fb, 1, 106}, /* MATHEMATICAL SANS-SERIF BOLD SMALL N */
+  {0x1d5fc, 1, 14}, /* MATHEMATICAL SANS-SERIF BOLD SMALL O */
+  {0x1d5fd, 1, 927}, /* MATHEMATICAL SANS-SERIF BOLD SMALL P */
+  {0x1d5fe, 1, 2335}, /* MATHEMATICAL SANS-SERIF BOLD SMALL Q */
+  {0x1d5ff, 1, 276}, /* MATHEMATICAL SANS-SERIF BOLD SMALL R */
+  {0x1d600, 1, 288}, /* MATHEMATICAL SANS-SERIF BOLD SMALL S */
+  {0x1d601, 1, 304}, /* MATHEMATICAL SANS-SERIF BOLD SMALL T */
+  {0x1d602, 1, 118}, /* MATHEMATICAL SANS-SERIF BOLD SMALL U */
+  {0x1d603, 1, 930}, /* MATHEMATICAL SANS-SERIF BOLD SMALL V */
+  {0x1d604, 1, 336}, /* MATHEMATICAL SANS-SERIF BOLD SMALL W */
+  {0x1d605, 1, 579}, /* MATHEMATICAL SANS-SERIF BOLD SMALL X */
+  {0x1d606, 1, 126}, /* MATHEMATICAL SANS-SERIF BOLD SMALL Y */
+  {0x1d607, 1, 346}, /* MATHEMATICAL SANS-SERIF BOLD SMALL Z */
+  {0x1d608, 1, 24}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL A */
+  {0x1d609, 1, 910}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL B */
+  {0x1d60a, 1, 36}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL C */
+  {0x1d60b, 1, 158}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL D */
+  {0x1d60c, 1, 38}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL E */
+  {0x1d60d, 1, 995}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL F */
+  {0x1d60e, 1, 182}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL G */
+  {0x1d60f, 1, 198}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL H */
+  {0x1d610, 1, 46}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL I */
+  {0x1d611, 1, 221}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL J */
+  {0x1d612, 1, 228}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL K */
+  {0x1d613, 1, 232}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL L */
+  {0x1d614, 1, 912}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL M */
+  {0x1d615, 1, 54}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL N */
+  {0x1d616, 1, 56}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL O */
+  {0x1d617, 1, 914}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL P */
+  {0x1d618, 1, 1942}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL Q */
+  {0x1d619, 1, 274}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL R */
+  {0x1d61a, 1, 286}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL S */
+  {0x1d61b, 1, 302}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL T */
+  {0x1d61c, 1, 66}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL U */
+  {0x1d61d, 1, 1183}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL V */
+  {0x1d61e, 1, 334}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL W */
+  {0x1d61f, 1, 1211}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL X */
+  {0x1d620, 1, 74}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL Y */
+  {0x1d621, 1, 344}, /* MATHEMATICAL SANS-SERIF ITALIC CAPITAL Z */
+  {0x1d622, 1, 3}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL A */
+  {0x1d623, 1, 918}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL B */
+  {0x1d624, 1, 88}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL C */
+  {0x1d625, 1, 160}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL D */
+  {0x1d626, 1, 90}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL E */
+  {0x1d627, 1, 997}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL F */
+  {0x1d628, 1, 184}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL G */
+  {0x1d629, 1, 200}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL H */
+  {0x1d62a, 1, 98}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL I */
+  {0x1d62b, 1, 223}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL J */
+  {0x1d62c, 1, 230}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL K */
+  {0x1d62d, 1, 234}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL L */
+  {0x1d62e, 1, 922}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL M */
+  {0x1d62f, 1, 106}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL N */
+  {0x1d630, 1, 14}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL O */
+  {0x1d631, 1, 927}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL P */
+  {0x1d632, 1, 2335}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL Q */
+  {0x1d633, 1, 276}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL R */
+  {0x1d634, 1, 288}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL S */
+  {0x1d635, 1, 304}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL T */
+  {0x1d636, 1, 118}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL U */
+  {0x1d637, 1, 930}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL V */
+  {0x1d638, 1, 336}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL W */
+  {0x1d639, 1, 579}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL X */
+  {0x1d63a, 1, 126}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL Y */
+  {0x1d63b, 1, 346}, /* MATHEMATICAL SANS-SERIF ITALIC SMALL Z */
+  {0x1d63c, 1, 24}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL A */
+  {0x1d63d, 1, 910}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL B */
+  {0x1d63e, 1, 36}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL C */
+  {0x1d63f, 1, 158}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL D */
+  {0x1d640, 1, 38}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL E */
+  {0x1d641, 1, 995}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL F */
+  {0x1d642, 1, 182}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL G */
+  {0x1d643, 1, 198}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL H */
+  {0x1d644, 1, 46}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL I */
+  {0x1d645, 1, 221}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL J */
+  {0x1d646, 1, 228}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL K */
+  {0x1d647, 1, 232}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL L */
+  {0x1d648, 1, 912}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL M */
+  {0x1d649, 1, 54}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL N */
+  {0x1d64a, 1, 56}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL O */
+  {0x1d64b, 1, 914}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL P */
+  {0x1d64c, 1, 1942}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL Q */
+  {0x1d64d, 1, 274}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL R */
+  {0x1d64e, 1, 286}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL S */
+  {0x1d64f, 1, 302}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL T */
+  {0x1d650, 1, 66}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL U */
+  {0x1d651, 1, 1183}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL V */
+  {0x1d652, 1, 334}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL W */
+  {0x1d653, 1, 1211}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL X */
+  {0x1d654, 1, 74}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL Y */
+  {0x1d655, 1, 344}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL Z */
+  {0x1d656, 1, 3}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL A */
+  {0x1d657, 1, 918}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL B */
+  {0x1d658, 1, 88}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL C */
+  {0x1d659, 1, 160}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL D */
+  {0x1d65a, 1, 90}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL E */
+  {0x1d65b, 1, 997}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL F */
+  {0x1d65c, 1, 184}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL G */
+  {0x1d65d, 1, 200}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL H */
+  {0x1d65e, 1, 98}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL I */
+  {0x1d65f, 1, 223}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL J */
+  {0x1d660, 1, 230}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL K */
+  {0x1d661, 1, 234}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL L */
+  {0x1d662, 1, 922}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL M */
+  {0x1d663, 1, 106}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL N */
+  {0x1d664, 1, 14}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL O */
+  {0x1d665, 1, 927}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL P */
+  {0x1d666, 1, 2335}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL Q */
+  {0x1d667, 1, 276}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL R */
+  {0x1d668, 1, 288}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL S */
+  {0x1d669, 1, 304}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL T */
+  {0x1d66a, 1, 118}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL U */
+  {0x1d66b, 1, 930}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL V */
+  {0x1d66c, 1, 336}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL W */
+  {0x1d66d, 1, 579}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL X */
+  {0x1d66e, 1, 126}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL Y */
+  {0x1d66f, 1, 346}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL Z */
+  {0x1d670, 1, 24}, /* MATHEMATICAL MONOSPACE CAPITAL A */
+  {0x1d671, 1, 910}, /* MATHEMATICAL MONOSPACE CAPITAL B */
+  {0x1d672, 1, 36}, /* MATHEMATICAL MONOSPACE CAPITAL C */
+  {0x1d673, 1, 158}, /* MATHEMATICAL MONOSPACE CAPITAL D */
+  {0x1d674, 1, 38}, /* MATHEMATICAL MONOSPACE CAPITAL E */
+  {0x1d675, 1, 995}, /* MATHEMATICAL MONOSPACE CAPITAL F */
+  {0x1d676, 1, 182}, /* MATHEMATICAL MONOSPACE CAPITAL G */
+  {0x1d677, 1, 198}, /* MATHEMATICAL MONOSPACE CAPITAL H */
+  {0x1d678, 1, 46}, /* MATHEMATICAL MONOSPACE CAPITAL I */
+  {0x1d679, 1, 221}, /* MATHEMATICAL MONOSPACE CAPITAL J */
+  {0x1d67a, 1, 228}, /* MATHEMATICAL MONOSPACE CAPITAL K */
+  {0x1d67b, 1, 232}, /* MATHEMATICAL MONOSPACE CAPITAL L */
+  {0x1d67c, 1, 912}, /* MATHEMATICAL MONOSPACE CAPITAL M */
+  {0x1d67d, 1, 54}, /* MATHEMATICAL MONOSPACE CAPITAL N */
+  {0x1d67e, 1, 56}, /* MATHEMATICAL MONOSPACE CAPITAL O */
+  {0x1d67f, 1, 914}, /* MATHEMATICAL MONOSPACE CAPITAL P */
+  {0x1d680, 1, 1942}, /* MATHEMATICAL MONOSPACE CAPITAL Q */
+  {0x1d681, 1, 274}, /* MATHEMATICAL MONOSPACE CAPITAL R */
+  {0x1d682, 1, 286}, /* MATHEMATICAL MONOSPACE CAPITAL S */
+  {0x1d683, 1, 302}, /* MATHEMATICAL MONOSPACE CAPITAL T */
+  {0x1d684, 1, 66}, /* MATHEMATICAL MONOSPACE CAPITAL U */
+  {0x1d685, 1, 1183}, /* MATHEMATICAL MONOSPACE CAPITAL V */
+  {0x1d686, 1, 334}, /* MATHEMATICAL MONOSPACE CAPITAL W */
+  {0x1d687, 1, 1211}, /* MATHEMATICAL MONOSPACE CAPITAL X */
+  {0x1d688, 1, 74}, /* MATHEMATICAL MONOSPACE CAPITAL Y */
+  {0x1d689, 1, 344}, /* MATHEMATICAL MONOSPACE CAPITAL Z */
+  {0x1d68a, 1, 3}, /* MATHEMATICAL MONOSPACE SMALL A */
+  {0x1d68b, 1, 918}, /* MATHEMATICAL MONOSPACE SMALL B */
+  {0x1d68c, 1, 88}, /* MATHEMATICAL MONOSPACE SMALL C */
+  {0x1d68d, 1, 160}, /* MATHEMATICAL MONOSPACE SMALL D */
+  {0x1d68e, 1, 90}, /* MATHEMATICAL MONOSPACE SMALL E */
+  {0x1d68f, 1, 997}, /* MATHEMATICAL MONOSPACE SMALL F */
+  {0x1d690, 1, 184}, /* MATHEMATICAL MONOSPACE SMALL G */
+  {0x1d691, 1, 200}, /* MATHEMATICAL MONOSPACE SMALL H */
+  {0x1d692, 1, 98}, /* MATHEMATICAL MONOSPACE SMALL I */
+  {0x1d693, 1, 223}, /* MATHEMATICAL MONOSPACE SMALL J */
+  {0x1d694, 1, 230}, /* MATHEMATICAL MONOSPACE SMALL K */
+  {0x1d695, 1, 234}, /* MATHEMATICAL MONOSPACE SMALL L */
+  {0x1d696, 1, 922}, /* MATHEMATICAL MONOSPACE SMALL M */
+  {0x1d697, 1, 106}, /* MATHEMATICAL MONOSPACE SMALL N */
+  {0x1d698, 1, 14}, /* MATHEMATICAL MONOSPACE SMALL O */
+  {0x1d699, 1, 927}, /* MATHEMATICAL MONOSPACE SMALL P */
+  {0x1d69a, 1, 2335}, /* MATHEMATICAL MONOSPACE SMALL Q */
+  {0x1d69b, 1, 276}, /* MATHEMATICAL MONOSPACE SMALL R */
+  {0x1d69c, 1, 288}, /* MATHEMATICAL MONOSPACE SMALL S */
+  {0x1d69d, 1, 304}, /* MATHEMATICAL MONOSPACE SMALL T */
+  {0x1d69e, 1, 118}, /* MATHEMATICAL MONOSPACE SMALL U */
+  {0x1d69f, 1, 930}, /* MATHEMATICAL MONOSPACE SMALL V */
+  {0x1d6a0, 1, 336}, /* MATHEMATICAL MONOSPACE SMALL W */
+  {0x1d6a1, 1, 579}, /* MATHEMATICAL MONOSPACE SMALL X */
+  {0x1d6a2, 1, 126}, /* MATHEMATICAL MONOSPACE SMALL Y */
+  {0x1d6a3, 1, 346}, /* MATHEMATICAL MONOSPACE SMALL Z */
+  {0x1d6a8, 1, 590}, /* MATHEMATICAL BOLD CAPITAL ALPHA */
+  {0x1d6a9, 1, 5148}, /* MATHEMATICAL BOLD CAPITAL BETA */
+  {0x1d6aa, 1, 1957}, /* MATHEMATICAL BOLD CAPITAL GAMMA */
+  {0x1d6ab, 1, 5149}, /* MATHEMATICAL BOLD CAPITAL DELTA */
+  {0x1d6ac, 1, 592}, /* MATHEMATICAL BOLD CAPITAL EPSILON */
+  {0x1d6ad, 1, 5150}, /* MATHEMATICAL BOLD CAPITAL ZETA */
+  {0x1d6ae, 1, 594}, /* MATHEMATICAL BOLD CAPITAL ETA */
+  {0x1d6af, 1, 641}, /* MATHEMATICAL BOLD CAPITAL THETA */
+  {0x1d6b0, 1, 596}, /* MATHEMATICAL BOLD CAPITAL IOTA */
+  {0x1d6b1, 1, 5151}, /* MATHEMATICAL BOLD CAPITAL KAPPA */
+  {0x1d6b2, 1, 5152}, /* MATHEMATICAL BOLD CAPITAL LAMDA */
+  {0x1d6b3, 1, 5153}, /* MATHEMATICAL BOLD CAPITAL MU */
+  {0x1d6b4, 1, 5154}, /* MATHEMATICAL BOLD CAPITAL NU */
+  {0x1d6b5, 1, 5155}, /* MATHEMATICAL BOLD CAPITAL XI */
+  {0x1d6b6, 1, 598}, /* MATHEMATICAL BOLD CAPITAL OMICRON */
+  {0x1d6b7, 1, 1958}, /* MATHEMATICAL BOLD CAPITAL PI */
+  {0x1d6b8, 1, 1843}, /* MATHEMATICAL BOLD CAPITAL RHO */
+  {0x1d6b9, 1, 5156}, /* MATHEMATICAL BOLD CAPITAL THETA SYMBOL */
+  {0x1d6ba, 1, 642}, /* MATHEMATICAL BOLD CAPITAL SIGMA */
+  {0x1d6bb, 1, 5157}, /* MATHEMATICAL BOLD CAPITAL TAU */
+  {0x1d6bc, 1, 600}, /* MATHEMATICAL BOLD CAPITAL UPSILON */
+  {0x1d6bd, 1, 5158}, /* MATHEMATICAL BOLD CAPITAL PHI */
+  {0x1d6be, 1, 5159}, /* MATHEMATICAL BOLD CAPITAL CHI */
+  {0x1d6bf, 1, 5160}, /* MATHEMATICAL BOLD CAPITAL PSI */
+  {0x1d6c0, 1, 602}, /* MATHEMATICAL BOLD CAPITAL OMEGA */
+  {0x1d6c1, 1, 5161}, /* MATHEMATICAL BOLD NABLA */
+  {0x1d6c2, 1, 610}, /* MATHEMATICAL BOLD SMALL ALPHA */
+  {0x1d6c3, 1, 630}, /* MATHEMATICAL BOLD SMALL BETA */
+  {0x1d6c4, 1, 932}, /* MATHEMATICAL BOLD SMALL GAMMA */
+  {0x1d6c5, 1, 933}, /* MATHEMATICAL BOLD SMALL DELTA */
+  {0x1d6c6, 1, 612}, /* MATHEMATICAL BOLD SMALL EPSILON */
+  {0x1d6c7, 1, 5162}, /* MATHEMATICAL BOLD SMALL ZETA */
+  {0x1d6c8, 1, 614}, /* MATHEMATICAL BOLD SMALL ETA */
+  {0x1d6c9, 1, 631}, /* MATHEMATICAL BOLD SMALL THETA */
+  {0x1d6ca, 1, 616}, /* MATHEMATICAL BOLD SMALL IOTA */
+  {0x1d6cb, 1, 638}, /* MATHEMATICAL BOLD SMALL KAPPA */
+  {0x1d6cc, 1, 5163}, /* MATHEMATICAL BOLD SMALL LAMDA */
+  {0x1d6cd, 1, 10}, /* MATHEMATICAL BOLD SMALL MU */
+  {0x1d6ce, 1, 5164}, /* MATHEMATICAL BOLD SMALL NU */
+  {0x1d6cf, 1, 5165}, /* MATHEMATICAL BOLD SMALL XI */
+  {0x1d6d0, 1, 624}, /* MATHEMATICAL BOLD SMALL OMICRON */
+  {0x1d6d1, 1, 637}, /* MATHEMATICAL BOLD SMALL PI */
+  {0x1d6d2, 1, 639}, /* MATHEMATICAL BOLD SMALL RHO */
+  {0x1d6d3, 1, 640}, /* MATHEMATICAL BOLD SMALL FINAL SIGMA */
+  {0x1d6d4, 1, 5166}, /* MATHEMATICAL BOLD SMALL SIGMA */
+  {0x1d6d5, 1, 5167}, /* MATHEMATICAL BOLD SMALL TAU */
+  {0x1d6d6, 1, 622}, /* MATHEMATICAL BOLD SMALL UPSILON */
+  {0x1d6d7, 1, 636}, /* MATHEMATICAL BOLD SMALL PHI */
+  {0x1d6d8, 1, 934}, /* MATHEMATICAL BOLD SMALL CHI */
+  {0x1d6d9, 1, 5168}, /* MATHEMATICAL BOLD SMALL PSI */
+  {0x1d6da, 1, 628}, /* MATHEMATICAL BOLD SMALL OMEGA */
+  {0x1d6db, 1, 5169}, /* MATHEMATICAL BOLD PARTIAL DIFFERENTIAL */
+  {0x1d6dc, 1, 5170}, /* MATHEMATICAL BOLD EPSILON SYMBOL */
+  {0x1d6dd, 1, 5171}, /* MATHEMATICAL BOLD THETA SYMBOL */
+  {0x1d6de, 1, 5172}, /* MATHEMATICAL BOLD KAPPA SYMBOL */
+  {0x1d6df, 1, 5173}, /* MATHEMATICAL BOLD PHI SYMBOL */
+  {0x1d6e0, 1, 5174}, /* MATHEMATICAL BOLD RHO SYMBOL */
+  {0x1d6e1, 1, 5175}, /* MATHEMATICAL BOLD PI SYMBOL */
+  {0x1d6e2, 1, 590}, /* MATHEMATICAL ITALIC CAPITAL ALPHA */
+  {0x1d6e3, 1, 5148}, /* MATHEMATICAL ITALIC CAPITAL BETA */
+  {0x1d6e4, 1, 1957}, /* MATHEMATICAL ITALIC CAPITAL GAMMA */
+  {0x1d6e5, 1, 5149}, /* MATHEMATICAL ITALIC CAPITAL DELTA */
+  {0x1d6e6, 1, 592}, /* MATHEMATICAL ITALIC CAPITAL EPSILON */
+  {0x1d6e7, 1, 5150}, /* MATHEMATICAL ITALIC CAPITAL ZETA */
+  {0x1d6e8, 1, 594}, /* MATHEMATICAL ITALIC CAPITAL ETA */
+  {0x1d6e9, 1, 641}, /* MATHEMATICAL ITALIC CAPITAL THETA */
+  {0x1d6ea, 1, 596}, /* MATHEMATICAL ITALIC CAPITAL IOTA */
+  {0x1d6eb, 1, 5151}, /* MATHEMATICAL ITALIC CAPITAL KAPPA */
+  {0x1d6ec, 1, 5152}, /* MATHEMATICAL ITALIC CAPITAL LAMDA */
+  {0x1d6ed, 1, 5153}, /* MATHEMATICAL ITALIC CAPITAL MU */
+  {0x1d6ee, 1, 5154}, /* MATHEMATICAL ITALIC CAPITAL NU */
+  {0x1d6ef, 1, 5155}, /* MATHEMATICAL ITALIC CAPITAL XI */
+  {0x1d6f0, 1, 598}, /* MATHEMATICAL ITALIC CAPITAL OMICRON */
+  {0x1d6f1, 1, 1958}, /* MATHEMATICAL ITALIC CAPITAL PI */
+  {0x1d6f2, 1, 1843}, /* MATHEMATICAL ITALIC CAPITAL RHO */
+  {0x1d6f3, 1, 5156}, /* MATHEMATICAL ITALIC CAPITAL THETA SYMBOL */
+  {0x1d6f4, 1, 642}, /* MATHEMATICAL ITALIC CAPITAL SIGMA */
+  {0x1d6f5, 1, 5157}, /* MATHEMATICAL ITALIC CAPITAL TAU */
+  {0x1d6f6, 1, 600}, /* MATHEMATICAL ITALIC CAPITAL UPSILON */
+  {0x1d6f7, 1, 5158}, /* MATHEMATICAL ITALIC CAPITAL PHI */
+  {0x1d6f8, 1, 5159}, /* MATHEMATICAL ITALIC CAPITAL CHI */
+  {0x1d6f9, 1, 5160}, /* MATHEMATICAL ITALIC CAPITAL PSI */
+  {0x1d6fa, 1, 602}, /* MATHEMATICAL ITALIC CAPITAL OMEGA */
+  {0x1d6fb, 1, 5161}, /* MATHEMATICAL ITALIC NABLA */
+  {0x1d6fc, 1, 610}, /* MATHEMATICAL ITALIC SMALL ALPHA */
+  {0x1d6fd, 1, 630}, /* MATHEMATICAL ITALIC SMALL BETA */
+  {0x1d6fe, 1, 932}, /* MATHEMATICAL ITALIC SMALL GAMMA */
+  {0x1d6ff, 1, 933}, /* MATHEMATICAL ITALIC SMALL DELTA */
+  {0x1d700, 1, 612}, /* MATHEMATICAL ITALIC SMALL EPSILON */
+  {0x1d701, 1, 5162}, /* MATHEMATICAL ITALIC SMALL ZETA */
+  {0x1d702, 1, 614}, /* MATHEMATICAL ITALIC SMALL ETA */
+  {0x1d703, 1, 631}, /* MATHEMATICAL ITALIC SMALL THETA */
+  {0x1d704, 1, 616}, /* MATHEMATICAL ITALIC SMALL IOTA */
+  {0x1d705, 1, 638}, /* MATHEMATICAL ITALIC SMALL KAPPA */
+  {0x1d706, 1, 5163}, /* MATHEMATICAL ITALIC SMALL LAMDA */
+  {0x1d707, 1, 10}, /* MATHEMATICAL ITALIC SMALL MU */
+  {0x1d708, 1, 5164}, /* MATHEMATICAL ITALIC SMALL NU */
+  {0x1d709, 1, 5165}, /* MATHEMATICAL ITALIC SMALL XI */
+  {0x1d70a, 1, 624}, /* MATHEMATICAL ITALIC SMALL OMICRON */
+  {0x1d70b, 1, 637}, /* MATHEMATICAL ITALIC SMALL PI */
+  {0x1d70c, 1, 639}, /* MATHEMATICAL ITALIC SMALL RHO */
+  {0x1d70d, 1, 640}, /* MATHEMATICAL ITALIC SMALL FINAL SIGMA */
+  {0x1d70e, 1, 5166}, /* MATHEMATICAL ITALIC SMALL SIGMA */
+  {0x1d70f, 1, 5167}, /* MATHEMATICAL ITALIC SMALL TAU */
+  {0x1d710, 1, 622}, /* MATHEMATICAL ITALIC SMALL UPSILON */
+  {0x1d711, 1, 636}, /* MATHEMATICAL ITALIC SMALL PHI */
+  {0x1d712, 1, 934}, /* MATHEMATICAL ITALIC SMALL CHI */
+  {0x1d713, 1, 5168}, /* MATHEMATICAL ITALIC SMALL PSI */
+  {0x1d714, 1, 628}, /* MATHEMATICAL ITALIC SMALL OMEGA */
+  {0x1d715, 1, 5169}, /* MATHEMATICAL ITALIC PARTIAL DIFFERENTIAL */
+  {0x1d716, 1, 5170}, /* MATHEMATICAL ITALIC EPSILON SYMBOL */
+  {0x1d717, 1, 5171}, /* MATHEMATICAL ITALIC THETA SYMBOL */
+  {0x1d718, 1, 5172}, /* MATHEMATICAL ITALIC KAPPA SYMBOL */
+  {0x1d719, 1, 5173}, /* MATHEMATICAL ITALIC PHI SYMBOL */
+  {0x1d71a, 1, 5174}, /* MATHEMATICAL ITALIC RHO SYMBOL */
+  {0x1d71b, 1, 5175}, /* MATHEMATICAL ITALIC PI SYMBOL */
+  {0x1d71c, 1, 590}, /* MATHEMATICAL BOLD ITALIC CAPITAL ALPHA */
+  {0x1d71d, 1, 5148}, /* MATHEMATICAL BOLD ITALIC CAPITAL BETA */
+  {0x1d71e, 1, 1957}, /* MATHEMATICAL BOLD ITALIC CAPITAL GAMMA */
+  {0x1d71f, 1, 5149}, /* MATHEMATICAL BOLD ITALIC CAPITAL DELTA */
+  {0x1d720, 1, 592}, /* MATHEMATICAL BOLD ITALIC CAPITAL EPSILON */
+  {0x1d721, 1, 5150}, /* MATHEMATICAL BOLD ITALIC CAPITAL ZETA */
+  {0x1d722, 1, 594}, /* MATHEMATICAL BOLD ITALIC CAPITAL ETA */
+  {0x1d723, 1, 641}, /* MATHEMATICAL BOLD ITALIC CAPITAL THETA */
+  {0x1d724, 1, 596}, /* MATHEMATICAL BOLD ITALIC CAPITAL IOTA */
+  {0x1d725, 1, 5151}, /* MATHEMATICAL BOLD ITALIC CAPITAL KAPPA */
+  {0x1d726, 1, 5152}, /* MATHEMATICAL BOLD ITALIC CAPITAL LAMDA */
+  {0x1d727, 1, 5153}, /* MATHEMATICAL BOLD ITALIC CAPITAL MU */
+  {0x1d728, 1, 5154}, /* MATHEMATICAL BOLD ITALIC CAPITAL NU */
+  {0x1d729, 1, 5155}, /* MATHEMATICAL BOLD ITALIC CAPITAL XI */
+  {0x1d72a, 1, 598}, /* MATHEMATICAL BOLD ITALIC CAPITAL OMICRON */
+  {0x1d72b, 1, 1958}, /* MATHEMATICAL BOLD ITALIC CAPITAL PI */
+  {0x1d72c, 1, 1843}, /* MATHEMATICAL BOLD ITALIC CAPITAL RHO */
+  {0x1d72d, 1, 5156}, /* MATHEMATICAL BOLD ITALIC CAPITAL THETA SYMBOL */
+  {0x1d72e, 1, 642}, /* MATHEMATICAL BOLD ITALIC CAPITAL SIGMA */
+  {0x1d72f, 1, 5157}, /* MATHEMATICAL BOLD ITALIC CAPITAL TAU */
+  {0x1d730, 1, 600}, /* MATHEMATICAL BOLD ITALIC CAPITAL UPSILON */
+  {0x1d731, 1, 5158}, /* MATHEMATICAL BOLD ITALIC CAPITAL PHI */
+  {0x1d732, 1, 5159}, /* MATHEMATICAL BOLD ITALIC CAPITAL CHI */
+  {0x1d733, 1, 5160}, /* MATHEMATICAL BOLD ITALIC CAPITAL PSI */
+  {0x1d734, 1, 602}, /* MATHEMATICAL BOLD ITALIC CAPITAL OMEGA */
+  {0x1d735, 1, 5161}, /* MATHEMATICAL BOLD ITALIC NABLA */
+  {0x1d736, 1, 610}, /* MATHEMATICAL BOLD ITALIC SMALL ALPHA */
+  {0x1d737, 1, 630}, /* MATHEMATICAL BOLD ITALIC SMALL BETA */
+  {0x1d738, 1, 932}, /* MATHEMATICAL BOLD ITALIC SMALL GAMMA */
+  {0x1d739, 1, 933}, /* MATHEMATICAL BOLD ITALIC SMALL DELTA */
+  {0x1d73a, 1, 612}, /* MATHEMATICAL BOLD ITALIC SMALL EPSILON */
+  {0x1d73b, 1, 5162}, /* MATHEMATICAL BOLD ITALIC SMALL ZETA */
+  {0x1d73c, 1, 614}, /* MATHEMATICAL BOLD ITALIC SMALL ETA */
+  {0x1d73d, 1, 631}, /* MATHEMATICAL BOLD ITALIC SMALL THETA */
+  {0x1d73e, 1, 616}, /* MATHEMATICAL BOLD ITALIC SMALL IOTA */
+  {0x1d73f, 1, 638}, /* MATHEMATICAL BOLD ITALIC SMALL KAPPA */
+  {0x1d740, 1, 5163}, /* MATHEMATICAL BOLD ITALIC SMALL LAMDA */
+  {0x1d741, 1, 10}, /* MATHEMATICAL BOLD ITALIC SMALL MU */
+  {0x1d742, 1, 5164}, /* MATHEMATICAL BOLD ITALIC SMALL NU */
+  {0x1d743, 1, 5165}, /* MATHEMATICAL BOLD ITALIC SMALL XI */
+  {0x1d744, 1, 624}, /* MATHEMATICAL BOLD ITALIC SMALL OMICRON */
+  {0x1d745, 1, 637}, /* MATHEMATICAL BOLD ITALIC SMALL PI */
+  {0x1d746, 1, 639}, /* MATHEMATICAL BOLD ITALIC SMALL RHO */
+  {0x1d747, 1, 640}, /* MATHEMATICAL BOLD ITALIC SMALL FINAL SIGMA */
+  {0x1d748, 1, 5166}, /* MATHEMATICAL BOLD ITALIC SMALL SIGMA */
+  {0x1d749, 1, 5167}, /* MATHEMATICAL BOLD ITALIC SMALL TAU */
+  {0x1d74a, 1, 622}, /* MATHEMATICAL BOLD ITALIC SMALL UPSILON */
+  {0x1d74b, 1, 636}, /* MATHEMATICAL BOLD ITALIC SMALL PHI */
+  {0x1d74c, 1, 934}, /* MATHEMATICAL BOLD ITALIC SMALL CHI */
+  {0x1d74d, 1, 5168}, /* MATHEMATICAL BOLD ITALIC SMALL PSI */
+  {0x1d74e, 1, 628}, /* MATHEMATICAL BOLD ITALIC SMALL OMEGA */
+  {0x1d74f, 1, 5169}, /* MATHEMATICAL BOLD ITALIC PARTIAL DIFFERENTIAL */
+  {0x1d750, 1, 5170}, /* MATHEMATICAL BOLD ITALIC EPSILON SYMBOL */
+  {0x1d751, 1, 5171}, /* MATHEMATICAL BOLD ITALIC THETA SYMBOL */
+  {0x1d752, 1, 5172}, /* MATHEMATICAL BOLD ITALIC KAPPA SYMBOL */
+  {0x1d753, 1, 5173}, /* MATHEMATICAL BOLD ITALIC PHI SYMBOL */
+  {0x1d754, 1, 5174}, /* MATHEMATICAL BOLD ITALIC RHO SYMBOL */
+  {0x1d755, 1, 5175}, /* MATHEMATICAL BOLD ITALIC PI SYMBOL */
+  {0x1d756, 1, 590}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL ALPHA */
+  {0x1d757, 1, 5148}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL BETA */
+  {0x1d758, 1, 1957}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL GAMMA */
+  {0x1d759, 1, 5149}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL DELTA */
+  {0x1d75a, 1, 592}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL EPSILON */
+  {0x1d75b, 1, 5150}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL ZETA */
+  {0x1d75c, 1, 594}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL ETA */
+  {0x1d75d, 1, 641}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL THETA */
+  {0x1d75e, 1, 596}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL IOTA */
+  {0x1d75f, 1, 5151}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL KAPPA */
+  {0x1d760, 1, 5152}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL LAMDA */
+  {0x1d761, 1, 5153}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL MU */
+  {0x1d762, 1, 5154}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL NU */
+  {0x1d763, 1, 5155}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL XI */
+  {0x1d764, 1, 598}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL OMICRON */
+  {0x1d765, 1, 1958}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL PI */
+  {0x1d766, 1, 1843}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL RHO */
+  {0x1d767, 1, 5156}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL THETA SYMBOL */
+  {0x1d768, 1, 642}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL SIGMA */
+  {0x1d769, 1, 5157}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL TAU */
+  {0x1d76a, 1, 600}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL UPSILON */
+  {0x1d76b, 1, 5158}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL PHI */
+  {0x1d76c, 1, 5159}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL CHI */
+  {0x1d76d, 1, 5160}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL PSI */
+  {0x1d76e, 1, 602}, /* MATHEMATICAL SANS-SERIF BOLD CAPITAL OMEGA */
+  {0x1d76f, 1, 5161}, /* MATHEMATICAL SANS-SERIF BOLD NABLA */
+  {0x1d770, 1, 610}, /* MATHEMATICAL SANS-SERIF BOLD SMALL ALPHA */
+  {0x1d771, 1, 630}, /* MATHEMATICAL SANS-SERIF BOLD SMALL BETA */
+  {0x1d772, 1, 932}, /* MATHEMATICAL SANS-SERIF BOLD SMALL GAMMA */
+  {0x1d773, 1, 933}, /* MATHEMATICAL SANS-SERIF BOLD SMALL DELTA */
+  {0x1d774, 1, 612}, /* MATHEMATICAL SANS-SERIF BOLD SMALL EPSILON */
+  {0x1d775, 1, 5162}, /* MATHEMATICAL SANS-SERIF BOLD SMALL ZETA */
+  {0x1d776, 1, 614}, /* MATHEMATICAL SANS-SERIF BOLD SMALL ETA */
+  {0x1d777, 1, 631}, /* MATHEMATICAL SANS-SERIF BOLD SMALL THETA */
+  {0x1d778, 1, 616}, /* MATHEMATICAL SANS-SERIF BOLD SMALL IOTA */
+  {0x1d779, 1, 638}, /* MATHEMATICAL SANS-SERIF BOLD SMALL KAPPA */
+  {0x1d77a, 1, 5163}, /* MATHEMATICAL SANS-SERIF BOLD SMALL LAMDA */
+  {0x1d77b, 1, 10}, /* MATHEMATICAL SANS-SERIF BOLD SMALL MU */
+  {0x1d77c, 1, 5164}, /* MATHEMATICAL SANS-SERIF BOLD SMALL NU */
+  {0x1d77d, 1, 5165}, /* MATHEMATICAL SANS-SERIF BOLD SMALL XI */
+  {0x1d77e, 1, 624}, /* MATHEMATICAL SANS-SERIF BOLD SMALL OMICRON */
+  {0x1d77f, 1, 637}, /* MATHEMATICAL SANS-SERIF BOLD SMALL PI */
+  {0x1d780, 1, 639}, /* MATHEMATICAL SANS-SERIF BOLD SMALL RHO */
+  {0x1d781, 1, 640}, /* MATHEMATICAL SANS-SERIF BOLD SMALL FINAL SIGMA */
+  {0x1d782, 1, 5166}, /* MATHEMATICAL SANS-SERIF BOLD SMALL SIGMA */
+  {0x1d783, 1, 5167}, /* MATHEMATICAL SANS-SERIF BOLD SMALL TAU */
+  {0x1d784, 1, 622}, /* MATHEMATICAL SANS-SERIF BOLD SMALL UPSILON */
+  {0x1d785, 1, 636}, /* MATHEMATICAL SANS-SERIF BOLD SMALL PHI */
+  {0x1d786, 1, 934}, /* MATHEMATICAL SANS-SERIF BOLD SMALL CHI */
+  {0x1d787, 1, 5168}, /* MATHEMATICAL SANS-SERIF BOLD SMALL PSI */
+  {0x1d788, 1, 628}, /* MATHEMATICAL SANS-SERIF BOLD SMALL OMEGA */
+  {0x1d789, 1, 5169}, /* MATHEMATICAL SANS-SERIF BOLD PARTIAL DIFFERENTIAL */
+  {0x1d78a, 1, 5170}, /* MATHEMATICAL SANS-SERIF BOLD EPSILON SYMBOL */
+  {0x1d78b, 1, 5171}, /* MATHEMATICAL SANS-SERIF BOLD THETA SYMBOL */
+  {0x1d78c, 1, 5172}, /* MATHEMATICAL SANS-SERIF BOLD KAPPA SYMBOL */
+  {0x1d78d, 1, 5173}, /* MATHEMATICAL SANS-SERIF BOLD PHI SYMBOL */
+  {0x1d78e, 1, 5174}, /* MATHEMATICAL SANS-SERIF BOLD RHO SYMBOL */
+  {0x1d78f, 1, 5175}, /* MATHEMATICAL SANS-SERIF BOLD PI SYMBOL */
+  {0x1d790, 1, 590}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL ALPHA */
+  {0x1d791, 1, 5148}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL BETA */
+  {0x1d792, 1, 1957}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL GAMMA */
+  {0x1d793, 1, 5149}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL DELTA */
+  {0x1d794, 1, 592}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL EPSILON */
+  {0x1d795, 1, 5150}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL ZETA */
+  {0x1d796, 1, 594}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL ETA */
+  {0x1d797, 1, 641}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL THETA */
+  {0x1d798, 1, 596}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL IOTA */
+  {0x1d799, 1, 5151}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL KAPPA */
+  {0x1d79a, 1, 5152}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL LAMDA */
+  {0x1d79b, 1, 5153}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL MU */
+  {0x1d79c, 1, 5154}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL NU */
+  {0x1d79d, 1, 5155}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL XI */
+  {0x1d79e, 1, 598}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL OMICRON */
+  {0x1d79f, 1, 1958}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL PI */
+  {0x1d7a0, 1, 1843}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL RHO */
+  {0x1d7a1, 1, 5156}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL THETA SYMBOL */
+  {0x1d7a2, 1, 642}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL SIGMA */
+  {0x1d7a3, 1, 5157}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL TAU */
+  {0x1d7a4, 1, 600}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL UPSILON */
+  {0x1d7a5, 1, 5158}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL PHI */
+  {0x1d7a6, 1, 5159}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL CHI */
+  {0x1d7a7, 1, 5160}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL PSI */
+  {0x1d7a8, 1, 602}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC CAPITAL OMEGA */
+  {0x1d7a9, 1, 5161}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC NABLA */
+  {0x1d7aa, 1, 610}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL ALPHA */
+  {0x1d7ab, 1, 630}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL BETA */
+  {0x1d7ac, 1, 932}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL GAMMA */
+  {0x1d7ad, 1, 933}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL DELTA */
+  {0x1d7ae, 1, 612}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL EPSILON */
+  {0x1d7af, 1, 5162}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL ZETA */
+  {0x1d7b0, 1, 614}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL ETA */
+  {0x1d7b1, 1, 631}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL THETA */
+  {0x1d7b2, 1, 616}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL IOTA */
+  {0x1d7b3, 1, 638}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL KAPPA */
+  {0x1d7b4, 1, 5163}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL LAMDA */
+  {0x1d7b5, 1, 10}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL MU */
+  {0x1d7b6, 1, 5164}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL NU */
+  {0x1d7b7, 1, 5165}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL XI */
+  {0x1d7b8, 1, 624}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL OMICRON */
+  {0x1d7b9, 1, 637}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL PI */
+  {0x1d7ba, 1, 639}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL RHO */
+  {0x1d7bb, 1, 640}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL FINAL SIGMA */
+  {0x1d7bc, 1, 5166}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL SIGMA */
+  {0x1d7bd, 1, 5167}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL TAU */
+  {0x1d7be, 1, 622}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL UPSILON */
+  {0x1d7bf, 1, 636}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL PHI */
+  {0x1d7c0, 1, 934}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL CHI */
+  {0x1d7c1, 1, 5168}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL PSI */
+  {0x1d7c2, 1, 628}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC SMALL OMEGA */
+  {0x1d7c3, 1, 5169}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC PARTIAL DIFFERENTIAL */
+  {0x1d7c4, 1, 5170}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC EPSILON SYMBOL */
+  {0x1d7c5, 1, 5171}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC THETA SYMBOL */
+  {0x1d7c6, 1, 5172}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC KAPPA SYMBOL */
+  {0x1d7c7, 1, 5173}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC PHI SYMBOL */
+  {0x1d7c8, 1, 5174}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC RHO SYMBOL */
+  {0x1d7c9, 1, 5175}, /* MATHEMATICAL SANS-SERIF BOLD ITALIC PI SYMBOL */
+  {0x1d7ce, 1, 1909}, /* MATHEMATICAL BOLD DIGIT ZERO */
+  {0x1d7cf, 1, 13}, /* MATHEMATICAL BOLD DIGIT ONE */
+  {0x1d7d0, 1, 6}, /* MATHEMATICAL BOLD DIGIT TWO */
+  {0x1d7d1, 1, 7}, /* MATHEMATICAL BOLD DIGIT THREE */
+  {0x1d7d2, 1, 17}, /* MATHEMATICAL BOLD DIGIT FOUR */
+  {0x1d7d3, 1, 1910}, /* MATHEMATICAL BOLD DIGIT FIVE */
+  {0x1d7d4, 1, 1911}, /* MATHEMATICAL BOLD DIGIT SIX */
+  {0x1d7d5, 1, 1912}, /* MATHEMATICAL BOLD DIGIT SEVEN */
+  {0x1d7d6, 1, 1913}, /* MATHEMATICAL BOLD DIGIT EIGHT */
+  {0x1d7d7, 1, 1914}, /* MATHEMATICAL BOLD DIGIT NINE */
+  {0x1d7d8, 1, 1909}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT ZERO */
+  {0x1d7d9, 1, 13}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT ONE */
+  {0x1d7da, 1, 6}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT TWO */
+  {0x1d7db, 1, 7}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT THREE */
+  {0x1d7dc, 1, 17}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT FOUR */
+  {0x1d7dd, 1, 1910}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT FIVE */
+  {0x1d7de, 1, 1911}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT SIX */
+  {0x1d7df, 1, 1912}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT SEVEN */
+  {0x1d7e0, 1, 1913}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT EIGHT */
+  {0x1d7e1, 1, 1914}, /* MATHEMATICAL DOUBLE-STRUCK DIGIT NINE */
+  {0x1d7e2, 1, 1909}, /* MATHEMATICAL SANS-SERIF DIGIT ZERO */
+  {0x1d7e3, 1, 13}, /* MATHEMATICAL SANS-SERIF DIGIT ONE */
+  {0x1d7e4, 1, 6}, /* MATHEMATICAL SANS-SERIF DIGIT TWO */
+  {0x1d7e5, 1, 7}, /* MATHEMATICAL SANS-SERIF DIGIT THREE */
+  {0x1d7e6, 1, 17}, /* MATHEMATICAL SANS-SERIF DIGIT FOUR */
+  {0x1d7e7, 1, 1910}, /* MATHEMATICAL SANS-SERIF DIGIT FIVE */
+  {0x1d7e8, 1, 1911}, /* MATHEMATICAL SANS-SERIF DIGIT SIX */
+  {0x1d7e9, 1, 1912}, /* MATHEMATICAL SANS-SERIF DIGIT SEVEN */
+  {0x1d7ea, 1, 1913}, /* MATHEMATICAL SANS-SERIF DIGIT EIGHT */
+  {0x1d7eb, 1, 1914}, /* MATHEMATICAL SANS-SERIF DIGIT NINE */
+  {0x1d7ec, 1, 1909}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT ZERO */
+  {0x1d7ed, 1, 13}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT ONE */
+  {0x1d7ee, 1, 6}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT TWO */
+  {0x1d7ef, 1, 7}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT THREE */
+  {0x1d7f0, 1, 17}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT FOUR */
+  {0x1d7f1, 1, 1910}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT FIVE */
+  {0x1d7f2, 1, 1911}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT SIX */
+  {0x1d7f3, 1, 1912}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT SEVEN */
+  {0x1d7f4, 1, 1913}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT EIGHT */
+  {0x1d7f5, 1, 1914}, /* MATHEMATICAL SANS-SERIF BOLD DIGIT NINE */
+  {0x1d7f6, 1, 1909}, /* MATHEMATICAL MONOSPACE DIGIT ZERO */
+  {0x1d7f7, 1, 13}, /* MATHEMATICAL MONOSPACE DIGIT ONE */
+  {0x1d7f8, 1, 6}, /* MATHEMATICAL MONOSPACE DIGIT TWO */
+  {0x1d7f9, 1, 7}, /* MATHEMATICAL MONOSPACE DIGIT THREE */
+  {0x1d7fa, 1, 17}, /* MATHEMATICAL MONOSPACE DIGIT FOUR */
+  {0x1d7fb, 1, 1910}, /* MATHEMATICAL MONOSPACE DIGIT FIVE */
+  {0x1d7fc, 1, 1911}, /* MATHEMATICAL MONOSPACE DIGIT SIX */
+  {0x1d7fd, 1, 1912}, /* MATHEMATICAL MONOSPACE DIGIT SEVEN */
+  {0x1d7fe, 1, 1913}, /* MATHEMATICAL MONOSPACE DIGIT EIGHT */
+  {0x1d7ff, 1, 1914}, /* MATHEMATICAL MONOSPACE DIGIT NINE */
+  {0x2f800, 1, 5176}, /* CJK COMPATIBILITY IDEOGRAPH-2F800 */
+  {0x2f801, 1, 5177}, /* CJK COMPATIBILITY IDEOGRAPH-2F801 */
+  {0x2f802, 1, 5178}, /* CJK COMPATIBILITY IDEOGRAPH-2F802 */
+  {0x2f803, 1, 5179}, /* CJK COMPATIBILITY IDEOGRAPH-2F803 */
+  {0x2f804, 1, 5180}, /* CJK COMPATIBILITY IDEOGRAPH-2F804 */
+  {0x2f805, 1, 4142}, /* CJK COMPATIBILITY IDEOGRAPH-2F805 */
+  {0x2f806, 1, 5181}, /* CJK COMPATIBILITY IDEOGRAPH-2F806 */
+  {0x2f807, 1, 5182}, /* CJK COMPATIBILITY IDEOGRAPH-2F807 */
+  {0x2f808, 1, 5183}, /* CJK COMPATIBILITY IDEOGRAPH-2F808 */
+  {0x2f809, 1, 5184}, /* CJK COMPATIBILITY IDEOGRAPH-2F809 */
+  {0x2f80a, 1, 4143}, /* CJK COMPATIBILITY IDEOGRAPH-2F80A */
+  {0x2f80b, 1, 5185}, /* CJK COMPATIBILITY IDEOGRAPH-2F80B */
+  {0x2f80c, 1, 5186}, /* CJK COMPATIBILITY IDEOGRAPH-2F80C */
+  {0x2f80d, 1, 5187}, /* CJK COMPATIBILITY IDEOGRAPH-2F80D */
+  {0x2f80e, 1, 4144}, /* CJK COMPATIBILITY IDEOGRAPH-2F80E */
+  {0x2f80f, 1, 5188}, /* CJK COMPATIBILITY IDEOGRAPH-2F80F */
+  {0x2f810, 1, 5189}, /* CJK COMPATIBILITY IDEOGRAPH-2F810 */
+  {0x2f811, 1, 5190}, /* CJK COMPATIBILITY IDEOGRAPH-2F811 */
+  {0x2f812, 1, 5191}, /* CJK COMPATIBILITY IDEOGRAPH-2F812 */
+  {0x2f813, 1, 5192}, /* CJK COMPATIBILITY IDEOGRAPH-2F813 */
+  {0x2f814, 1, 5193}, /* CJK COMPATIBILITY IDEOGRAPH-2F814 */
+  {0x2f815, 1, 5194}, /* CJK COMPATIBILITY IDEOGRAPH-2F815 */
+  {0x2f816, 1, 5195}, /* CJK COMPATIBILITY IDEOGRAPH-2F816 */
+  {0x2f817, 1, 5196}, /* CJK COMPATIBILITY IDEOGRAPH-2F817 */
+  {0x2f818, 1, 5197}, /* CJK COMPATIBILITY IDEOGRAPH-2F818 */
+  {0x2f819, 1, 5198}, /* CJK COMPATIBILITY IDEOGRAPH-2F819 */
+  {0x2f81a, 1, 5199}, /* CJK COMPATIBILITY IDEOGRAPH-2F81A */
+  {0x2f81b, 1, 5200}, /* CJK COMPATIBILITY IDEOGRAPH-2F81B */
+  {0x2f81c, 1, 5201}, /* CJK COMPATIBILITY IDEOGRAPH-2F81C */
+  {0x2f81d, 1, 2389}, /* CJK COMPATIBILITY IDEOGRAPH-2F81D */
+  {0x2f81e, 1, 5202}, /* CJK COMPATIBILITY IDEOGRAPH-2F81E */
+  {0x2f81f, 1, 5203}, /* CJK COMPATIBILITY IDEOGRAPH-2F81F */
+  {0x2f820, 1, 5204}, /* CJK COMPATIBILITY IDEOGRAPH-2F820 */
+  {0x2f821, 1, 5205}, /* CJK COMPATIBILITY IDEOGRAPH-2F821 */
+  {0x2f822, 1, 5206}, /* CJK COMPATIBILITY IDEOGRAPH-2F822 */
+  {0x2f823, 1, 5207}, /* CJK COMPATIBILITY IDEOGRAPH-2F823 */
+  {0x2f824, 1, 5208}, /* CJK COMPATIBILITY IDEOGRAPH-2F824 */
+  {0x2f825, 1, 5209}, /* CJK COMPATIBILITY IDEOGRAPH-2F825 */
+  {0x2f826, 1, 4145}, /* CJK COMPATIBILITY IDEOGRAPH-2F826 */
+  {0x2f827, 1, 4146}, /* CJK COMPATIBILITY IDEOGRAPH-2F827 */
+  {0x2f828, 1, 5210}, /* CJK COMPATIBILITY IDEOGRAPH-2F828 */
+  {0x2f829, 1, 5211}, /* CJK COMPATIBILITY IDEOGRAPH-2F829 */
+  {0x2f82a, 1, 5212}, /* CJK COMPATIBILITY IDEOGRAPH-2F82A */
+  {0x2f82b, 1, 3965}, /* CJK COMPATIBILITY IDEOGRAPH-2F82B */
+  {0x2f82c, 1, 5213}, /* CJK COMPATIBILITY IDEOGRAPH-2F82C */
+  {0x2f82d, 1, 4147}, /* CJK COMPATIBILITY IDEOGRAPH-2F82D */
+  {0x2f82e, 1, 5214}, /* CJK COMPATIBILITY IDEOGRAPH-2F82E */
+  {0x2f82f, 1, 5215}, /* CJK COMPATIBILITY IDEOGRAPH-2F82F */
+  {0x2f830, 1, 5216}, /* CJK COMPATIBILITY IDEOGRAPH-2F830 */
+  {0x2f831, 1, 5217}, /* CJK COMPATIBILITY IDEOGRAPH-2F831 */
+  {0x2f832, 1, 5217}, /* CJK COMPATIBILITY IDEOGRAPH-2F832 */
+  {0x2f833, 1, 5217}, /* CJK COMPATIBILITY IDEOGRAPH-2F833 */
+  {0x2f834, 1, 5218}, /* CJK COMPATIBILITY IDEOGRAPH-2F834 */
+  {0x2f835, 1, 5219}, /* CJK COMPATIBILITY IDEOGRAPH-2F835 */
+  {0x2f836, 1, 5220}, /* CJK COMPATIBILITY IDEOGRAPH-2F836 */
+  {0x2f837, 1, 5221}, /* CJK COMPATIBILITY IDEOGRAPH-2F837 */
+  {0x2f838, 1, 5222}, /* CJK COMPATIBILITY IDEOGRAPH-2F838 */
+  {0x2f839, 1, 5223}, /* CJK COMPATIBILITY IDEOGRAPH-2F839 */
+  {0x2f83a, 1, 5224}, /* CJK COMPATIBILITY IDEOGRAPH-2F83A */
+  {0x2f83b, 1, 5225}, /* CJK COMPATIBILITY IDEOGRAPH-2F83B */
+  {0x2f83c, 1, 5226}, /* CJK COMPATIBILITY IDEOGRAPH-2F83C */
+  {0x2f83d, 1, 5227}, /* CJK COMPATIBILITY IDEOGRAPH-2F83D */
+  {0x2f83e, 1, 5228}, /* CJK COMPATIBILITY IDEOGRAPH-2F83E */
+  {0x2f83f, 1, 5229}, /* CJK COMPATIBILITY IDEOGRAPH-2F83F */
+  {0x2f840, 1, 5230}, /* CJK COMPATIBILITY IDEOGRAPH-2F840 */
+  {0x2f841, 1, 5231}, /* CJK COMPATIBILITY IDEOGRAPH-2F841 */
+  {0x2f842, 1, 5232}, /* CJK COMPATIBILITY IDEOGRAPH-2F842 */
+  {0x2f843, 1, 5233}, /* CJK COMPATIBILITY IDEOGRAPH-2F843 */
+  {0x2f844, 1, 5234}, /* CJK COMPATIBILITY IDEOGRAPH-2F844 */
+  {0x2f845, 1, 5235}, /* CJK COMPATIBILITY IDEOGRAPH-2F845 */
+  {0x2f846, 1, 5235}, /* CJK COMPATIBILITY IDEOGRAPH-2F846 */
+  {0x2f847, 1, 5236}, /* CJK COMPATIBILITY IDEOGRAPH-2F847 */
+  {0x2f848, 1, 5237}, /* CJK COMPATIBILITY IDEOGRAPH-2F848 */
+  {0x2f849, 1, 5238}, /* CJK COMPATIBILITY IDEOGRAPH-2F849 */
+  {0x2f84a, 1, 5239}, /* CJK COMPATIBILITY IDEOGRAPH-2F84A */
+  {0x2f84b, 1, 5240}, /* CJK COMPATIBILITY IDEOGRAPH-2F84B */
+  {0x2f84c, 1, 4149}, /* CJK COMPATIBILITY IDEOGRAPH-2F84C */
+  {0x2f84d, 1, 5241}, /* CJK COMPATIBILITY IDEOGRAPH-2F84D */
+  {0x2f84e, 1, 5242}, /* CJK COMPATIBILITY IDEOGRAPH-2F84E */
+  {0x2f84f, 1, 5243}, /* CJK COMPATIBILITY IDEOGRAPH-2F84F */
+  {0x2f850, 1, 4111}, /* CJK COMPATIBILITY IDEOGRAPH-2F850 */
+  {0x2f851, 1, 5244}, /* CJK COMPATIBILITY IDEOGRAPH-2F851 */
+  {0x2f852, 1, 5245}, /* CJK COMPATIBILITY IDEOGRAPH-2F852 */
+  {0x2f853, 1, 5246}, /* CJK COMPATIBILITY IDEOGRAPH-2F853 */
+  {0x2f854, 1, 5247}, /* CJK COMPATIBILITY IDEOGRAPH-2F854 */
+  {0x2f855, 1, 5248}, /* CJK COMPATIBILITY IDEOGRAPH-2F855 */
+  {0x2f856, 1, 5249}, /* CJK COMPATIBILITY IDEOGRAPH-2F856 */
+  {0x2f857, 1, 5250}, /* CJK COMPATIBILITY IDEOGRAPH-2F857 */
+  {0x2f858, 1, 5251}, /* CJK COMPATIBILITY IDEOGRAPH-2F858 */
+  {0x2f859, 1, 5252}, /* CJK COMPATIBILITY IDEOGRAPH-2F859 */
+  {0x2f85a, 1, 5253}, /* CJK COMPATIBILITY IDEOGRAPH-2F85A */
+  {0x2f85b, 1, 5254}, /* CJK COMPATIBILITY IDEOGRAPH-2F85B */
+  {0x2f85c, 1, 5255}, /* CJK COMPATIBILITY IDEOGRAPH-2F85C */
+  {0x2f85d, 1, 5256}, /* CJK COMPATIBILITY IDEOGRAPH-2F85D */
+  {0x2f85e, 1, 5257}, /* CJK COMPATIBILITY IDEOGRAPH-2F85E */
+  {0x2f85f, 1, 5258}, /* CJK COMPATIBILITY IDEOGRAPH-2F85F */
+  {0x2f860, 1, 5259}, /* CJK COMPATIBILITY IDEOGRAPH-2F860 */
+  {0x2f861, 1, 5260}, /* CJK COMPATIBILITY IDEOGRAPH-2F861 */
+  {0x2f862, 1, 5261}, /* CJK COMPATIBILITY IDEOGRAPH-2F862 */
+  {0x2f863, 1, 5262}, /* CJK COMPATIBILITY IDEOGRAPH-2F863 */
+  {0x2f864, 1, 5263}, /* CJK COMPATIBILITY IDEOGRAPH-2F864 */
+  {0x2f865, 1, 5264}, /* CJK COMPATIBILITY IDEOGRAPH-2F865 */
+  {0x2f866, 1, 5265}, /* CJK COMPATIBILITY IDEOGRAPH-2F866 */
+  {0x2f867, 1, 5266}, /* CJK COMPATIBILITY IDEOGRAPH-2F867 */
+  {0x2f868, 1, 5267}, /* CJK COMPATIBILITY IDEOGRAPH-2F868 */
+  {0x2f869, 1, 5268}, /* CJK COMPATIBILITY IDEOGRAPH-2F869 */
+  {0x2f86a, 1, 5269}, /* CJK COMPATIBILITY IDEOGRAPH-2F86A */
+  {0x2f86b, 1, 5269}, /* CJK COMPATIBILITY IDEOGRAPH-2F86B */
+  {0x2f86c, 1, 5270}, /* CJK COMPATIBILITY IDEOGRAPH-2F86C */
+  {0x2f86d, 1, 5271}, /* CJK COMPATIBILITY IDEOGRAPH-2F86D */
+  {0x2f86e, 1, 5272}, /* CJK COMPATIBILITY IDEOGRAPH-2F86E */
+  {0x2f86f, 1, 3961}, /* CJK COMPATIBILITY IDEOGRAPH-2F86F */
+  {0x2f870, 1, 5273}, /* CJK COMPATIBILITY IDEOGRAPH-2F870 */
+  {0x2f871, 1, 5274}, /* CJK COMPATIBILITY IDEOGRAPH-2F871 */
+  {0x2f872, 1, 5275}, /* CJK COMPATIBILITY IDEOGRAPH-2F872 */
+  {0x2f873, 1, 5276}, /* CJK COMPATIBILITY IDEOGRAPH-2F873 */
+  {0x2f874, 1, 5277}, /* CJK COMPATIBILITY IDEOGRAPH-2F874 */
+  {0x2f875, 1, 2415}, /* CJK COMPATIBILITY IDEOGRAPH-2F875 */
+  {0x2f876, 1, 5278}, /* CJK COMPATIBILITY IDEOGRAPH-2F876 */
+  {0x2f877, 1, 5279}, /* CJK COMPATIBILITY IDEOGRAPH-2F877 */
+  {0x2f878, 1, 2417}, /* CJK COMPATIBILITY IDEOGRAPH-2F878 */
+  {0x2f879, 1, 5280}, /* CJK COMPATIBILITY IDEOGRAPH-2F879 */
+  {0x2f87a, 1, 5281}, /* CJK COMPATIBILITY IDEOGRAPH-2F87A */
+  {0x2f87b, 1, 5282}, /* CJK COMPATIBILITY IDEOGRAPH-2F87B */
+  {0x2f87c, 1, 5283}, /* CJK COMPATIBILITY IDEOGRAPH-2F87C */
+  {0x2f87d, 1, 5284}, /* CJK COMPATIBILITY IDEOGRAPH-2F87D */
+  {0x2f87e, 1, 5285}, /* CJK COMPATIBILITY IDEOGRAPH-2F87E */
+  {0x2f87f, 1, 5286}, /* CJK COMPATIBILITY IDEOGRAPH-2F87F */
+  {0x2f880, 1, 5287}, /* CJK COMPATIBILITY IDEOGRAPH-2F880 */
+  {0x2f881, 1, 5288}, /* CJK COMPATIBILITY IDEOGRAPH-2F881 */
+  {0x2f882, 1, 5289}, /* CJK COMPATIBILITY IDEOGRAPH-2F882 */
+  {0x2f883, 1, 5290}, /* CJK COMPATIBILITY IDEOGRAPH-2F883 */
+  {0x2f884, 1, 5291}, /* CJK COMPATIBILITY IDEOGRAPH-2F884 */
+  {0x2f885, 1, 5292}, /* CJK COMPATIBILITY IDEOGRAPH-2F885 */
+  {0x2f886, 1, 5293}, /* CJK COMPATIBILITY IDEOGRAPH-2F886 */
+  {0x2f887, 1, 5294}, /* CJK COMPATIBILITY IDEOGRAPH-2F887 */
+  {0x2f888, 1, 5295}, /* CJK COMPATIBILITY IDEOGRAPH-2F888 */
+  {0x2f889, 1, 5296}, /* CJK COMPATIBILITY IDEOGRAPH-2F889 */
+  {0x2f88a, 1, 5297}, /* CJK COMPATIBILITY IDEOGRAPH-2F88A */
+  {0x2f88b, 1, 5298}, /* CJK COMPATIBILITY IDEOGRAPH-2F88B */
+  {0x2f88c, 1, 5299}, /* CJK COMPATIBILITY IDEOGRAPH-2F88C */
+  {0x2f88d, 1, 5300}, /* CJK COMPATIBILITY IDEOGRAPH-2F88D */
+  {0x2f88e, 1, 3909}, /* CJK COMPATIBILITY IDEOGRAPH-2F88E */
+  {0x2f88f, 1, 5301}, /* CJK COMPATIBILITY IDEOGRAPH-2F88F */
+  {0x2f890, 1, 2427}, /* CJK COMPATIBILITY IDEOGRAPH-2F890 */
+  {0x2f891, 1, 5302}, /* CJK COMPATIBILITY IDEOGRAPH-2F891 */
+  {0x2f892, 1, 5302}, /* CJK COMPATIBILITY IDEOGRAPH-2F892 */
+  {0x2f893, 1, 5303}, /* CJK COMPATIBILITY IDEOGRAPH-2F893 */
+  {0x2f894, 1, 5304}, /* CJK COMPATIBILITY IDEOGRAPH-2F894 */
+  {0x2f895, 1, 5304}, /* CJK COMPATIBILITY IDEOGRAPH-2F895 */
+  {0x2f896, 1, 5305}, /* CJK COMPATIBILITY IDEOGRAPH-2F896 */
+  {0x2f897, 1, 5306}, /* CJK COMPATIBILITY IDEOGRAPH-2F897 */
+  {0x2f898, 1, 5307}, /* CJK COMPATIBILITY IDEOGRAPH-2F898 */
+  {0x2f899, 1, 5308}, /* CJK COMPATIBILITY IDEOGRAPH-2F899 */
+  {0x2f89a, 1, 5309}, /* CJK COMPATIBILITY IDEOGRAPH-2F89A */
+  {0x2f89b, 1, 5310}, /* CJK COMPATIBILITY IDEOGRAPH-2F89B */
+  {0x2f89c, 1, 5311}, /* CJK COMPATIBILITY IDEOGRAPH-2F89C */
+  {0x2f89d, 1, 5312}, /* CJK COMPATIBILITY IDEOGRAPH-2F89D */
+  {0x2f89e, 1, 5313}, /* CJK COMPATIBILITY IDEOGRAPH-2F89E */
+  {0x2f89f, 1, 5314}, /* CJK COMPATIBILITY IDEOGRAPH-2F89F */
+  {0x2f8a0, 1, 5315}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A0 */
+  {0x2f8a1, 1, 5316}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A1 */
+  {0x2f8a2, 1, 5317}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A2 */
+  {0x2f8a3, 1, 4154}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A3 */
+  {0x2f8a4, 1, 5318}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A4 */
+  {0x2f8a5, 1, 5319}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A5 */
+  {0x2f8a6, 1, 5320}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A6 */
+  {0x2f8a7, 1, 5321}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A7 */
+  {0x2f8a8, 1, 5322}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A8 */
+  {0x2f8a9, 1, 5321}, /* CJK COMPATIBILITY IDEOGRAPH-2F8A9 */
+  {0x2f8aa, 1, 5323}, /* CJK COMPATIBILITY IDEOGRAPH-2F8AA */
+  {0x2f8ab, 1, 4156}, /* CJK COMPATIBILITY IDEOGRAPH-2F8AB */
+  {0x2f8ac, 1, 5324}, /* CJK COMPATIBILITY IDEOGRAPH-2F8AC */
+  {0x2f8ad, 1, 5325}, /* CJK COMPATIBILITY IDEOGRAPH-2F8AD */
+  {0x2f8ae, 1, 5326}, /* CJK COMPATIBILITY IDEOGRAPH-2F8AE */
+  {0x2f8af, 1, 5327}, /* CJK COMPATIBILITY IDEOGRAPH-2F8AF */
+  {0x2f8b0, 1, 4157}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B0 */
+  {0x2f8b1, 1, 3882}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B1 */
+  {0x2f8b2, 1, 3553}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B2 */
+  {0x2f8b3, 1, 5328}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B3 */
+  {0x2f8b4, 1, 5329}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B4 */
+  {0x2f8b5, 1, 5330}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B5 */
+  {0x2f8b6, 1, 5331}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B6 */
+  {0x2f8b7, 1, 5332}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B7 */
+  {0x2f8b8, 1, 5333}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B8 */
+  {0x2f8b9, 1, 5334}, /* CJK COMPATIBILITY IDEOGRAPH-2F8B9 */
+  {0x2f8ba, 1, 5335}, /* CJK COMPATIBILITY IDEOGRAPH-2F8BA */
+  {0x2f8bb, 1, 5336}, /* CJK COMPATIBILITY IDEOGRAPH-2F8BB */
+  {0x2f8bc, 1, 5337}, /* CJK COMPATIBILITY IDEOGRAPH-2F8BC */
+  {0x2f8bd, 1, 5338}, /* CJK COMPATIBILITY IDEOGRAPH-2F8BD */
+  {0x2f8be, 1, 5339}, /* CJK COMPATIBILITY IDEOGRAPH-2F8BE */
+  {0x2f8bf, 1, 5340}, /* CJK COMPATIBILITY IDEOGRAPH-2F8BF */
+  {0x2f8c0, 1, 5341}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C0 */
+  {0x2f8c1, 1, 5342}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C1 */
+  {0x2f8c2, 1, 5343}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C2 */
+  {0x2f8c3, 1, 5344}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C3 */
+  {0x2f8c4, 1, 5345}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C4 */
+  {0x2f8c5, 1, 5346}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C5 */
+  {0x2f8c6, 1, 5347}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C6 */
+  {0x2f8c7, 1, 5348}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C7 */
+  {0x2f8c8, 1, 4158}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C8 */
+  {0x2f8c9, 1, 5349}, /* CJK COMPATIBILITY IDEOGRAPH-2F8C9 */
+  {0x2f8ca, 1, 5350}, /* CJK COMPATIBILITY IDEOGRAPH-2F8CA */
+  {0x2f8cb, 1, 5351}, /* CJK COMPATIBILITY IDEOGRAPH-2F8CB */
+  {0x2f8cc, 1, 5352}, /* CJK COMPATIBILITY IDEOGRAPH-2F8CC */
+  {0x2f8cd, 1, 5353}, /* CJK COMPATIBILITY IDEOGRAPH-2F8CD */
+  {0x2f8ce, 1, 5354}, /* CJK COMPATIBILITY IDEOGRAPH-2F8CE */
+  {0x2f8cf, 1, 4160}, /* CJK COMPATIBILITY IDEOGRAPH-2F8CF */
+  {0x2f8d0, 1, 5355}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D0 */
+  {0x2f8d1, 1, 5356}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D1 */
+  {0x2f8d2, 1, 5357}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D2 */
+  {0x2f8d3, 1, 5358}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D3 */
+  {0x2f8d4, 1, 5359}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D4 */
+  {0x2f8d5, 1, 5360}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D5 */
+  {0x2f8d6, 1, 5361}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D6 */
+  {0x2f8d7, 1, 5362}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D7 */
+  {0x2f8d8, 1, 3910}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D8 */
+  {0x2f8d9, 1, 5363}, /* CJK COMPATIBILITY IDEOGRAPH-2F8D9 */
+  {0x2f8da, 1, 5364}, /* CJK COMPATIBILITY IDEOGRAPH-2F8DA */
+  {0x2f8db, 1, 5365}, /* CJK COMPATIBILITY IDEOGRAPH-2F8DB */
+  {0x2f8dc, 1, 5366}, /* CJK COMPATIBILITY IDEOGRAPH-2F8DC */
+  {0x2f8dd, 1, 5367}, /* CJK COMPATIBILITY IDEOGRAPH-2F8DD */
+  {0x2f8de, 1, 5368}, /* CJK COMPATIBILITY IDEOGRAPH-2F8DE */
+  {0x2f8df, 1, 5369}, /* CJK COMPATIBILITY IDEOGRAPH-2F8DF */
+  {0x2f8e0, 1, 5370}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E0 */
+  {0x2f8e1, 1, 5371}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E1 */
+  {0x2f8e2, 1, 4161}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E2 */
+  {0x2f8e3, 1, 5372}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E3 */
+  {0x2f8e4, 1, 5373}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E4 */
+  {0x2f8e5, 1, 5374}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E5 */
+  {0x2f8e6, 1, 5375}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E6 */
+  {0x2f8e7, 1, 5376}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E7 */
+  {0x2f8e8, 1, 5377}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E8 */
+  {0x2f8e9, 1, 5378}, /* CJK COMPATIBILITY IDEOGRAPH-2F8E9 */
+  {0x2f8ea, 1, 5379}, /* CJK COMPATIBILITY IDEOGRAPH-2F8EA */
+  {0x2f8eb, 1, 5380}, /* CJK COMPATIBILITY IDEOGRAPH-2F8EB */
+  {0x2f8ec, 1, 5381}, /* CJK COMPATIBILITY IDEOGRAPH-2F8EC */
+  {0x2f8ed, 1, 5382}, /* CJK COMPATIBILITY IDEOGRAPH-2F8ED */
+  {0x2f8ee, 1, 5383}, /* CJK COMPATIBILITY IDEOGRAPH-2F8EE */
+  {0x2f8ef, 1, 5384}, /* CJK COMPATIBILITY IDEOGRAPH-2F8EF */
+  {0x2f8f0, 1, 5385}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F0 */
+  {0x2f8f1, 1, 5386}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F1 */
+  {0x2f8f2, 1, 5387}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F2 */
+  {0x2f8f3, 1, 5388}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F3 */
+  {0x2f8f4, 1, 5389}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F4 */
+  {0x2f8f5, 1, 3978}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F5 */
+  {0x2f8f6, 1, 5390}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F6 */
+  {0x2f8f7, 1, 5391}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F7 */
+  {0x2f8f8, 1, 5392}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F8 */
+  {0x2f8f9, 1, 5393}, /* CJK COMPATIBILITY IDEOGRAPH-2F8F9 */
+  {0x2f8fa, 1, 5394}, /* CJK COMPATIBILITY IDEOGRAPH-2F8FA */
+  {0x2f8fb, 1, 5395}, /* CJK COMPATIBILITY IDEOGRAPH-2F8FB */
+  {0x2f8fc, 1, 5396}, /* CJK COMPATIBILITY IDEOGRAPH-2F8FC */
+  {0x2f8fd, 1, 5397}, /* CJK COMPATIBILITY IDEOGRAPH-2F8FD */
+  {0x2f8fe, 1, 5398}, /* CJK COMPATIBILITY IDEOGRAPH-2F8FE */
+  {0x2f8ff, 1, 5399}, /* CJK COMPATIBILITY IDEOGRAPH-2F8FF */
+  {0x2f900, 1, 5400}, /* CJK COMPATIBILITY IDEOGRAPH-2F900 */
+  {0x2f901, 1, 4162}, /* CJK COMPATIBILITY IDEOGRAPH-2F901 */
+  {0x2f902, 1, 4061}, /* CJK COMPATIBILITY IDEOGRAPH-2F902 */
+  {0x2f903, 1, 5401}, /* CJK COMPATIBILITY IDEOGRAPH-2F903 */
+  {0x2f904, 1, 5402}, /* CJK COMPATIBILITY IDEOGRAPH-2F904 */
+  {0x2f905, 1, 5403}, /* CJK COMPATIBILITY IDEOGRAPH-2F905 */
+  {0x2f906, 1, 5404}, /* CJK COMPATIBILITY IDEOGRAPH-2F906 */
+  {0x2f907, 1, 5405}, /* CJK COMPATIBILITY IDEOGRAPH-2F907 */
+  {0x2f908, 1, 5406}, /* CJK COMPATIBILITY IDEOGRAPH-2F908 */
+  {0x2f909, 1, 5407}, /* CJK COMPATIBILITY IDEOGRAPH-2F909 */
+  {0x2f90a, 1, 5408}, /* CJK COMPATIBILITY IDEOGRAPH-2F90A */
+  {0x2f90b, 1, 5409}, /* CJK COMPATIBILITY IDEOGRAPH-2F90B */
+  {0x2f90c, 1, 5410}, /* CJK COMPATIBILITY IDEOGRAPH-2F90C */
+  {0x2f90d, 1, 5411}, /* CJK COMPATIBILITY IDEOGRAPH-2F90D */
+  {0x2f90e, 1, 5412}, /* CJK COMPATIBILITY IDEOGRAPH-2F90E */
+  {0x2f90f, 1, 5413}, /* CJK COMPATIBILITY IDEOGRAPH-2F90F */
+  {0x2f910, 1, 5414}, /* CJK COMPATIBILITY IDEOGRAPH-2F910 */
+  {0x2f911, 1, 5415}, /* CJK COMPATIBILITY IDEOGRAPH-2F911 */
+  {0x2f912, 1, 5416}, /* CJK COMPATIBILITY IDEOGRAPH-2F912 */
+  {0x2f913, 1, 5417}, /* CJK COMPATIBILITY IDEOGRAPH-2F913 */
+  {0x2f914, 1, 5418}, /* CJK COMPATIBILITY IDEOGRAPH-2F914 */
+  {0x2f915, 1, 5419}, /* CJK COMPATIBILITY IDEOGRAPH-2F915 */
+  {0x2f916, 1, 5420}, /* CJK COMPATIBILITY IDEOGRAPH-2F916 */
+  {0x2f917, 1, 5421}, /* CJK COMPATIBILITY IDEOGRAPH-2F917 */
+  {0x2f918, 1, 5422}, /* CJK COMPATIBILITY IDEOGRAPH-2F918 */
+  {0x2f919, 1, 5423}, /* CJK COMPATIBILITY IDEOGRAPH-2F919 */
+  {0x2f91a, 1, 5424}, /* CJK COMPATIBILITY IDEOGRAPH-2F91A */
+  {0x2f91b, 1, 5425}, /* CJK COMPATIBILITY IDEOGRAPH-2F91B */
+  {0x2f91c, 1, 5426}, /* CJK COMPATIBILITY IDEOGRAPH-2F91C */
+  {0x2f91d, 1, 5427}, /* CJK COMPATIBILITY IDEOGRAPH-2F91D */
+  {0x2f91e, 1, 5428}, /* CJK COMPATIBILITY IDEOGRAPH-2F91E */
+  {0x2f91f, 1, 5429}, /* CJK COMPATIBILITY IDEOGRAPH-2F91F */
+  {0x2f920, 1, 5430}, /* CJK COMPATIBILITY IDEOGRAPH-2F920 */
+  {0x2f921, 1, 5431}, /* CJK COMPATIBILITY IDEOGRAPH-2F921 */
+  {0x2f922, 1, 5432}, /* CJK COMPATIBILITY IDEOGRAPH-2F922 */
+  {0x2f923, 1, 5433}, /* CJK COMPATIBILITY IDEOGRAPH-2F923 */
+  {0x2f924, 1, 5434}, /* CJK COMPATIBILITY IDEOGRAPH-2F924 */
+  {0x2f925, 1, 5435}, /* CJK COMPATIBILITY IDEOGRAPH-2F925 */
+  {0x2f926, 1, 5436}, /* CJK COMPATIBILITY IDEOGRAPH-2F926 */
+  {0x2f927, 1, 5437}, /* CJK COMPATIBILITY IDEOGRAPH-2F927 */
+  {0x2f928, 1, 5438}, /* CJK COMPATIBILITY IDEOGRAPH-2F928 */
+  {0x2f929, 1, 5439}, /* CJK COMPATIBILITY IDEOGRAPH-2F929 */
+  {0x2f92a, 1, 5440}, /* CJK COMPATIBILITY IDEOGRAPH-2F92A */
+  {0x2f92b, 1, 5441}, /* CJK COMPATIBILITY IDEOGRAPH-2F92B */
+  {0x2f92c, 1, 5442}, /* CJK COMPATIBILITY IDEOGRAPH-2F92C */
+  {0x2f92d, 1, 5442}, /* CJK COMPATIBILITY IDEOGRAPH-2F92D */
+  {0x2f92e, 1, 5443}, /* CJK COMPATIBILITY IDEOGRAPH-2F92E */
+  {0x2f92f, 1, 5444}, /* CJK COMPATIBILITY IDEOGRAPH-2F92F */
+  {0x2f930, 1, 5445}, /* CJK COMPATIBILITY IDEOGRAPH-2F930 */
+  {0x2f931, 1, 5446}, /* CJK COMPATIBILITY IDEOGRAPH-2F931 */
+  {0x2f932, 1, 5447}, /* CJK COMPATIBILITY IDEOGRAPH-2F932 */
+  {0x2f933, 1, 5448}, /* CJK COMPATIBILITY IDEOGRAPH-2F933 */
+  {0x2f934, 1, 5449}, /* CJK COMPATIBILITY IDEOGRAPH-2F934 */
+  {0x2f935, 1, 5450}, /* CJK COMPATIBILITY IDEOGRAPH-2F935 */
+  {0x2f936, 1, 5451}, /* CJK COMPATIBILITY IDEOGRAPH-2F936 */
+  {0x2f937, 1, 5452}, /* CJK COMPATIBILITY IDEOGRAPH-2F937 */
+  {0x2f938, 1, 3964}, /* CJK COMPATIBILITY IDEOGRAPH-2F938 */
+  {0x2f939, 1, 5453}, /* CJK COMPATIBILITY IDEOGRAPH-2F939 */
+  {0x2f93a, 1, 5454}, /* CJK COMPATIBILITY IDEOGRAPH-2F93A */
+  {0x2f93b, 1, 5455}, /* CJK COMPATIBILITY IDEOGRAPH-2F93B */
+  {0x2f93c, 1, 5456}, /* CJK COMPATIBILITY IDEOGRAPH-2F93C */
+  {0x2f93d, 1, 5457}, /* CJK COMPATIBILITY IDEOGRAPH-2F93D */
+  {0x2f93e, 1, 5458}, /* CJK COMPATIBILITY IDEOGRAPH-2F93E */
+  {0x2f93f, 1, 5459}, /* CJK COMPATIBILITY IDEOGRAPH-2F93F */
+  {0x2f940, 1, 5460}, /* CJK COMPATIBILITY IDEOGRAPH-2F940 */
+  {0x2f941, 1, 5461}, /* CJK COMPATIBILITY IDEOGRAPH-2F941 */
+  {0x2f942, 1, 5462}, /* CJK COMPATIBILITY IDEOGRAPH-2F942 */
+  {0x2f943, 1, 5463}, /* CJK COMPATIBILITY IDEOGRAPH-2F943 */
+  {0x2f944, 1, 5464}, /* CJK COMPATIBILITY IDEOGRAPH-2F944 */
+  {0x2f945, 1, 5465}, /* CJK COMPATIBILITY IDEOGRAPH-2F945 */
+  {0x2f946, 1, 5466}, /* CJK COMPATIBILITY IDEOGRAPH-2F946 */
+  {0x2f947, 1, 5466}, /* CJK COMPATIBILITY IDEOGRAPH-2F947 */
+  {0x2f948, 1, 5467}, /* CJK COMPATIBILITY IDEOGRAPH-2F948 */
+  {0x2f949, 1, 5468}, /* CJK COMPATIBILITY IDEOGRAPH-2F949 */
+  {0x2f94a, 1, 5469}, /* CJK COMPATIBILITY IDEOGRAPH-2F94A */
+  {0x2f94b, 1, 5470}, /* CJK COMPATIBILITY IDEOGRAPH-2F94B */
+  {0x2f94c, 1, 5471}, /* CJK COMPATIBILITY IDEOGRAPH-2F94C */
+  {0x2f94d, 1, 5472}, /* CJK COMPATIBILITY IDEOGRAPH-2F94D */
+  {0x2f94e, 1, 5473}, /* CJK COMPATIBILITY IDEOGRAPH-2F94E */
+  {0x2f94f, 1, 3927}, /* CJK COMPATIBILITY IDEOGRAPH-2F94F */
+  {0x2f950, 1, 5474}, /* CJK COMPATIBILITY IDEOGRAPH-2F950 */
+  {0x2f951, 1, 5475}, /* CJK COMPATIBILITY IDEOGRAPH-2F951 */
+  {0x2f952, 1, 5476}, /* CJK COMPATIBILITY IDEOGRAPH-2F952 */
+  {0x2f953, 1, 4172}, /* CJK COMPATIBILITY IDEOGRAPH-2F953 */
+  {0x2f954, 1, 5477}, /* CJK COMPATIBILITY IDEOGRAPH-2F954 */
+  {0x2f955, 1, 5478}, /* CJK COMPATIBILITY IDEOGRAPH-2F955 */
+  {0x2f956, 1, 4131}, /* CJK COMPATIBILITY IDEOGRAPH-2F956 */
+  {0x2f957, 1, 5479}, /* CJK COMPATIBILITY IDEOGRAPH-2F957 */
+  {0x2f958, 1, 5480}, /* CJK COMPATIBILITY IDEOGRAPH-2F958 */
+  {0x2f959, 1, 4175}, /* CJK COMPATIBILITY IDEOGRAPH-2F959 */
+  {0x2f95a, 1, 5481}, /* CJK COMPATIBILITY IDEOGRAPH-2F95A */
+  {0x2f95b, 1, 5482}, /* CJK COMPATIBILITY IDEOGRAPH-2F95B */
+  {0x2f95c, 1, 5483}, /* CJK COMPATIBILITY IDEOGRAPH-2F95C */
+  {0x2f95d, 1, 5484}, /* CJK COMPATIBILITY IDEOGRAPH-2F95D */
+  {0x2f95e, 1, 5484}, /* CJK COMPATIBILITY IDEOGRAPH-2F95E */
+  {0x2f95f, 1, 5485}, /* CJK COMPATIBILITY IDEOGRAPH-2F95F */
+  {0x2f960, 1, 5486}, /* CJK COMPATIBILITY IDEOGRAPH-2F960 */
+  {0x2f961, 1, 5487}, /* CJK COMPATIBILITY IDEOGRAPH-2F961 */
+  {0x2f962, 1, 5488}, /* CJK COMPATIBILITY IDEOGRAPH-2F962 */
+  {0x2f963, 1, 5489}, /* CJK COMPATIBILITY IDEOGRAPH-2F963 */
+  {0x2f964, 1, 5490}, /* CJK COMPATIBILITY IDEOGRAPH-2F964 */
+  {0x2f965, 1, 5491}, /* CJK COMPATIBILITY IDEOGRAPH-2F965 */
+  {0x2f966, 1, 5492}, /* CJK COMPATIBILITY IDEOGRAPH-2F966 */
+  {0x2f967, 1, 5493}, /* CJK COMPATIBILITY IDEOGRAPH-2F967 */
+  {0x2f968, 1, 5494}, /* CJK COMPATIBILITY IDEOGRAPH-2F968 */
+  {0x2f969, 1, 5495}, /* CJK COMPATIBILITY IDEOGRAPH-2F969 */
+  {0x2f96a, 1, 5496}, /* CJK COMPATIBILITY IDEOGRAPH-2F96A */
+  {0x2f96b, 1, 5497}, /* CJK COMPATIBILITY IDEOGRAPH-2F96B */
+  {0x2f96c, 1, 5498}, /* CJK COMPATIBILITY IDEOGRAPH-2F96C */
+  {0x2f96d, 1, 5499}, /* CJK COMPATIBILITY IDEOGRAPH-2F96D */
+  {0x2f96e, 1, 5500}, /* CJK COMPATIBILITY IDEOGRAPH-2F96E */
+  {0x2f96f, 1, 5501}, /* CJK COMPATIBILITY IDEOGRAPH-2F96F */
+  {0x2f970, 1, 5502}, /* CJK COMPATIBILITY IDEOGRAPH-2F970 */
+  {0x2f971, 1, 5503}, /* CJK COMPATIBILITY IDEOGRAPH-2F971 */
+  {0x2f972, 1, 5504}, /* CJK COMPATIBILITY IDEOGRAPH-2F972 */
+  {0x2f973, 1, 5505}, /* CJK COMPATIBILITY IDEOGRAPH-2F973 */
+  {0x2f974, 1, 5506}, /* CJK COMPATIBILITY IDEOGRAPH-2F974 */
+  {0x2f975, 1, 5507}, /* CJK COMPATIBILITY IDEOGRAPH-2F975 */
+  {0x2f976, 1, 5508}, /* CJK COMPATIBILITY IDEOGRAPH-2F976 */
+  {0x2f977, 1, 5509}, /* CJK COMPATIBILITY IDEOGRAPH-2F977 */
+  {0x2f978, 1, 5510}, /* CJK COMPATIBILITY IDEOGRAPH-2F978 */
+  {0x2f979, 1, 5511}, /* CJK COMPATIBILITY IDEOGRAPH-2F979 */
+  {0x2f97a, 1, 4181}, /* CJK COMPATIBILITY IDEOGRAPH-2F97A */
+  {0x2f97b, 1, 5512}, /* CJK COMPATIBILITY IDEOGRAPH-2F97B */
+  {0x2f97c, 1, 5513}, /* CJK COMPATIBILITY IDEOGRAPH-2F97C */
+  {0x2f97d, 1, 5514}, /* CJK COMPATIBILITY IDEOGRAPH-2F97D */
+  {0x2f97e, 1, 5515}, /* CJK COMPATIBILITY IDEOGRAPH-2F97E */
+  {0x2f97f, 1, 5516}, /* CJK COMPATIBILITY IDEOGRAPH-2F97F */
+  {0x2f980, 1, 5517}, /* CJK COMPATIBILITY IDEOGRAPH-2F980 */
+  {0x2f981, 1, 5518}, /* CJK COMPATIBILITY IDEOGRAPH-2F981 */
+  {0x2f982, 1, 5519}, /* CJK COMPATIBILITY IDEOGRAPH-2F982 */
+  {0x2f983, 1, 5520}, /* CJK COMPATIBILITY IDEOGRAPH-2F983 */
+  {0x2f984, 1, 5521}, /* CJK COMPATIBILITY IDEOGRAPH-2F984 */
+  {0x2f985, 1, 5522}, /* CJK COMPATIBILITY IDEOGRAPH-2F985 */
+  {0x2f986, 1, 5523}, /* CJK COMPATIBILITY IDEOGRAPH-2F986 */
+  {0x2f987, 1, 5524}, /* CJK COMPATIBILITY IDEOGRAPH-2F987 */
+  {0x2f988, 1, 5525}, /* CJK COMPATIBILITY IDEOGRAPH-2F988 */
+  {0x2f989, 1, 5526}, /* CJK COMPATIBILITY IDEOGRAPH-2F989 */
+  {0x2f98a, 1, 5527}, /* CJK COMPATIBILITY IDEOGRAPH-2F98A */
+  {0x2f98b, 1, 5303}, /* CJK COMPATIBILITY IDEOGRAPH-2F98B */
+  {0x2f98c, 1, 5528}, /* CJK COMPATIBILITY IDEOGRAPH-2F98C */
+  {0x2f98d, 1, 5529}, /* CJK COMPATIBILITY IDEOGRAPH-2F98D */
+  {0x2f98e, 1, 5530}, /* CJK COMPATIBILITY IDEOGRAPH-2F98E */
+  {0x2f98f, 1, 5531}, /* CJK COMPATIBILITY IDEOGRAPH-2F98F */
+  {0x2f990, 1, 5532}, /* CJK COMPATIBILITY IDEOGRAPH-2F990 */
+  {0x2f991, 1, 5533}, /* CJK COMPATIBILITY IDEOGRAPH-2F991 */
+  {0x2f992, 1, 5534}, /* CJK COMPATIBILITY IDEOGRAPH-2F992 */
+  {0x2f993, 1, 5535}, /* CJK COMPATIBILITY IDEOGRAPH-2F993 */
+  {0x2f994, 1, 5536}, /* CJK COMPATIBILITY IDEOGRAPH-2F994 */
+  {0x2f995, 1, 5537}, /* CJK COMPATIBILITY IDEOGRAPH-2F995 */
+  {0x2f996, 1, 5538}, /* CJK COMPATIBILITY IDEOGRAPH-2F996 */
+  {0x2f997, 1, 5539}, /* CJK COMPATIBILITY IDEOGRAPH-2F997 */
+  {0x2f998, 1, 3981}, /* CJK COMPATIBILITY IDEOGRAPH-2F998 */
+  {0x2f999, 1, 5540}, /* CJK COMPATIBILITY IDEOGRAPH-2F999 */
+  {0x2f99a, 1, 5541}, /* CJK COMPATIBILITY IDEOGRAPH-2F99A */
+  {0x2f99b, 1, 5542}, /* CJK COMPATIBILITY IDEOGRAPH-2F99B */
+  {0x2f99c, 1, 5543}, /* CJK COMPATIBILITY IDEOGRAPH-2F99C */
+  {0x2f99d, 1, 5544}, /* CJK COMPATIBILITY IDEOGRAPH-2F99D */
+  {0x2f99e, 1, 5545}, /* CJK COMPATIBILITY IDEOGRAPH-2F99E */
+  {0x2f99f, 1, 4184}, /* CJK COMPATIBILITY IDEOGRAPH-2F99F */
+  {0x2f9a0, 1, 5546}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A0 */
+  {0x2f9a1, 1, 5547}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A1 */
+  {0x2f9a2, 1, 5548}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A2 */
+  {0x2f9a3, 1, 5549}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A3 */
+  {0x2f9a4, 1, 5550}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A4 */
+  {0x2f9a5, 1, 5551}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A5 */
+  {0x2f9a6, 1, 5552}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A6 */
+  {0x2f9a7, 1, 5553}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A7 */
+  {0x2f9a8, 1, 5554}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A8 */
+  {0x2f9a9, 1, 5555}, /* CJK COMPATIBILITY IDEOGRAPH-2F9A9 */
+  {0x2f9aa, 1, 5556}, /* CJK COMPATIBILITY IDEOGRAPH-2F9AA */
+  {0x2f9ab, 1, 5557}, /* CJK COMPATIBILITY IDEOGRAPH-2F9AB */
+  {0x2f9ac, 1, 5558}, /* CJK COMPATIBILITY IDEOGRAPH-2F9AC */
+  {0x2f9ad, 1, 5559}, /* CJK COMPATIBILITY IDEOGRAPH-2F9AD */
+  {0x2f9ae, 1, 5560}, /* CJK COMPATIBILITY IDEOGRAPH-2F9AE */
+  {0x2f9af, 1, 5561}, /* CJK COMPATIBILITY IDEOGRAPH-2F9AF */
+  {0x2f9b0, 1, 5562}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B0 */
+  {0x2f9b1, 1, 5563}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B1 */
+  {0x2f9b2, 1, 5564}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B2 */
+  {0x2f9b3, 1, 5565}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B3 */
+  {0x2f9b4, 1, 3922}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B4 */
+  {0x2f9b5, 1, 5566}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B5 */
+  {0x2f9b6, 1, 5567}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B6 */
+  {0x2f9b7, 1, 5568}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B7 */
+  {0x2f9b8, 1, 5569}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B8 */
+  {0x2f9b9, 1, 5570}, /* CJK COMPATIBILITY IDEOGRAPH-2F9B9 */
+  {0x2f9ba, 1, 5571}, /* CJK COMPATIBILITY IDEOGRAPH-2F9BA */
+  {0x2f9bb, 1, 5572}, /* CJK COMPATIBILITY IDEOGRAPH-2F9BB */
+  {0x2f9bc, 1, 5573}, /* CJK COMPATIBILITY IDEOGRAPH-2F9BC */
+  {0x2f9bd, 1, 5574}, /* CJK COMPATIBILITY IDEOGRAPH-2F9BD */
+  {0x2f9be, 1, 5575}, /* CJK COMPATIBILITY IDEOGRAPH-2F9BE */
+  {0x2f9bf, 1, 5576}, /* CJK COMPATIBILITY IDEOGRAPH-2F9BF */
+  {0x2f9c0, 1, 5577}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C0 */
+  {0x2f9c1, 1, 5578}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C1 */
+  {0x2f9c2, 1, 5579}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C2 */
+  {0x2f9c3, 1, 5580}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C3 */
+  {0x2f9c4, 1, 2517}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C4 */
+  {0x2f9c5, 1, 5581}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C5 */
+  {0x2f9c6, 1, 5582}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C6 */
+  {0x2f9c7, 1, 5583}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C7 */
+  {0x2f9c8, 1, 5584}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C8 */
+  {0x2f9c9, 1, 5585}, /* CJK COMPATIBILITY IDEOGRAPH-2F9C9 */
+  {0x2f9ca, 1, 5586}, /* CJK COMPATIBILITY IDEOGRAPH-2F9CA */
+  {0x2f9cb, 1, 5587}, /* CJK COMPATIBILITY IDEOGRAPH-2F9CB */
+  {0x2f9cc, 1, 5588}, /* CJK COMPATIBILITY IDEOGRAPH-2F9CC */
+  {0x2f9cd, 1, 5589}, /* CJK COMPATIBILITY IDEOGRAPH-2F9CD */
+  {0x2f9ce, 1, 5590}, /* CJK COMPATIBILITY IDEOGRAPH-2F9CE */
+  {0x2f9cf, 1, 5591}, /* CJK COMPATIBILITY IDEOGRAPH-2F9CF */
+  {0x2f9d0, 1, 5592}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D0 */
+  {0x2f9d1, 1, 5593}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D1 */
+  {0x2f9d2, 1, 2524}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D2 */
+  {0x2f9d3, 1, 5594}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D3 */
+  {0x2f9d4, 1, 5595}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D4 */
+  {0x2f9d5, 1, 5596}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D5 */
+  {0x2f9d6, 1, 5597}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D6 */
+  {0x2f9d7, 1, 5598}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D7 */
+  {0x2f9d8, 1, 5599}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D8 */
+  {0x2f9d9, 1, 5600}, /* CJK COMPATIBILITY IDEOGRAPH-2F9D9 */
+  {0x2f9da, 1, 5601}, /* CJK COMPATIBILITY IDEOGRAPH-2F9DA */
+  {0x2f9db, 1, 5602}, /* CJK COMPATIBILITY IDEOGRAPH-2F9DB */
+  {0x2f9dc, 1, 5603}, /* CJK COMPATIBILITY IDEOGRAPH-2F9DC */
+  {0x2f9dd, 1, 5604}, /* CJK COMPATIBILITY IDEOGRAPH-2F9DD */
+  {0x2f9de, 1, 5605}, /* CJK COMPATIBILITY IDEOGRAPH-2F9DE */
+  {0x2f9df, 1, 5606}, /* CJK COMPATIBILITY IDEOGRAPH-2F9DF */
+  {0x2f9e0, 1, 5607}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E0 */
+  {0x2f9e1, 1, 5608}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E1 */
+  {0x2f9e2, 1, 5609}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E2 */
+  {0x2f9e3, 1, 5610}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E3 */
+  {0x2f9e4, 1, 5611}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E4 */
+  {0x2f9e5, 1, 5612}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E5 */
+  {0x2f9e6, 1, 5613}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E6 */
+  {0x2f9e7, 1, 5614}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E7 */
+  {0x2f9e8, 1, 5615}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E8 */
+  {0x2f9e9, 1, 5616}, /* CJK COMPATIBILITY IDEOGRAPH-2F9E9 */
+  {0x2f9ea, 1, 5617}, /* CJK COMPATIBILITY IDEOGRAPH-2F9EA */
+  {0x2f9eb, 1, 5618}, /* CJK COMPATIBILITY IDEOGRAPH-2F9EB */
+  {0x2f9ec, 1, 5619}, /* CJK COMPATIBILITY IDEOGRAPH-2F9EC */
+  {0x2f9ed, 1, 5620}, /* CJK COMPATIBILITY IDEOGRAPH-2F9ED */
+  {0x2f9ee, 1, 5621}, /* CJK COMPATIBILITY IDEOGRAPH-2F9EE */
+  {0x2f9ef, 1, 5622}, /* CJK COMPATIBILITY IDEOGRAPH-2F9EF */
+  {0x2f9f0, 1, 5623}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F0 */
+  {0x2f9f1, 1, 5624}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F1 */
+  {0x2f9f2, 1, 5625}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F2 */
+  {0x2f9f3, 1, 5626}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F3 */
+  {0x2f9f4, 1, 5627}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F4 */
+  {0x2f9f5, 1, 5628}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F5 */
+  {0x2f9f6, 1, 5629}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F6 */
+  {0x2f9f7, 1, 5630}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F7 */
+  {0x2f9f8, 1, 5631}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F8 */
+  {0x2f9f9, 1, 5632}, /* CJK COMPATIBILITY IDEOGRAPH-2F9F9 */
+  {0x2f9fa, 1, 5633}, /* CJK COMPATIBILITY IDEOGRAPH-2F9FA */
+  {0x2f9fb, 1, 5634}, /* CJK COMPATIBILITY IDEOGRAPH-2F9FB */
+  {0x2f9fc, 1, 5635}, /* CJK COMPATIBILITY IDEOGRAPH-2F9FC */
+  {0x2f9fd, 1, 5636}, /* CJK COMPATIBILITY IDEOGRAPH-2F9FD */
+  {0x2f9fe, 1, 5637}, /* CJK COMPATIBILITY IDEOGRAPH-2F9FE */
+  {0x2f9ff, 1, 5637}, /* CJK COMPATIBILITY IDEOGRAPH-2F9FF */
+  {0x2fa00, 1, 5638}, /* CJK COMPATIBILITY IDEOGRAPH-2FA00 */
+  {0x2fa01, 1, 5639}, /* CJK COMPATIBILITY IDEOGRAPH-2FA01 */
+  {0x2fa02, 1, 5640}, /* CJK COMPATIBILITY IDEOGRAPH-2FA02 */
+  {0x2fa03, 1, 5641}, /* CJK COMPATIBILITY IDEOGRAPH-2FA03 */
+  {0x2fa04, 1, 5642}, /* CJK COMPATIBILITY IDEOGRAPH-2FA04 */
+  {0x2fa05, 1, 5643}, /* CJK COMPATIBILITY IDEOGRAPH-2FA05 */
+  {0x2fa06, 1, 5644}, /* CJK COMPATIBILITY IDEOGRAPH-2FA06 */
+  {0x2fa07, 1, 5645}, /* CJK COMPATIBILITY IDEOGRAPH-2FA07 */
+  {0x2fa08, 1, 5646}, /* CJK COMPATIBILITY IDEOGRAPH-2FA08 */
+  {0x2fa09, 1, 5647}, /* CJK COMPATIBILITY IDEOGRAPH-2FA09 */
+  {0x2fa0a, 1, 5648}, /* CJK COMPATIBILITY IDEOGRAPH-2FA0A */
+  {0x2fa0b, 1, 5649}, /* CJK COMPATIBILITY IDEOGRAPH-2FA0B */
+  {0x2fa0c, 1, 5650}, /* CJK COMPATIBILITY IDEOGRAPH-2FA0C */
+  {0x2fa0d, 1, 5651}, /* CJK COMPATIBILITY IDEOGRAPH-2FA0D */
+  {0x2fa0e, 1, 5652}, /* CJK COMPATIBILITY IDEOGRAPH-2FA0E */
+  {0x2fa0f, 1, 5653}, /* CJK COMPATIBILITY IDEOGRAPH-2FA0F */
+  {0x2fa10, 1, 5654}, /* CJK COMPATIBILITY IDEOGRAPH-2FA10 */
+  {0x2fa11, 1, 5655}, /* CJK COMPATIBILITY IDEOGRAPH-2FA11 */
+  {0x2fa12, 1, 5656}, /* CJK COMPATIBILITY IDEOGRAPH-2FA12 */
+  {0x2fa13, 1, 5657}, /* CJK COMPATIBILITY IDEOGRAPH-2FA13 */
+  {0x2fa14, 1, 5658}, /* CJK COMPATIBILITY IDEOGRAPH-2FA14 */
+  {0x2fa15, 1, 2572}, /* CJK COMPATIBILITY IDEOGRAPH-2FA15 */
+  {0x2fa16, 1, 5659}, /* CJK COMPATIBILITY IDEOGRAPH-2FA16 */
+  {0x2fa17, 1, 2576}, /* CJK COMPATIBILITY IDEOGRAPH-2FA17 */
+  {0x2fa18, 1, 5660}, /* CJK COMPATIBILITY IDEOGRAPH-2FA18 */
+  {0x2fa19, 1, 5661}, /* CJK COMPATIBILITY IDEOGRAPH-2FA19 */
+  {0x2fa1a, 1, 5662}, /* CJK COMPATIBILITY IDEOGRAPH-2FA1A */
+  {0x2fa1b, 1, 5663}, /* CJK COMPATIBILITY IDEOGRAPH-2FA1B */
+  {0x2fa1c, 1, 2581}, /* CJK COMPATIBILITY IDEOGRAPH-2FA1C */
+  {0x2fa1d, 1, 5664}, /* CJK COMPATIBILITY IDEOGRAPH-2FA1D */
+};
+
+const size_t _wind_normalize_table_size = 5224;
+
+const uint32_t _wind_normalize_val_table[] = {
+  0x20,
+  0x20,
+  0x308,
+  0x61,
+  0x20,
+  0x304,
+  0x32,
+  0x33,
+  0x20,
+  0x301,
+  0x3bc,
+  0x20,
+  0x327,
+  0x31,
+  0x6f,
+  0x31,
+  0x2044,
+  0x34,
+  0x31,
+  0x2044,
+  0x32,
+  0x33,
+  0x2044,
+  0x34,
+  0x41,
+  0x300,
+  0x41,
+  0x301,
+  0x41,
+  0x302,
+  0x41,
+  0x303,
+  0x41,
+  0x308,
+  0x41,
+  0x30a,
+  0x43,
+  0x327,
+  0x45,
+  0x300,
+  0x45,
+  0x301,
+  0x45,
+  0x302,
+  0x45,
+  0x308,
+  0x49,
+  0x300,
+  0x49,
+  0x301,
+  0x49,
+  0x302,
+  0x49,
+  0x308,
+  0x4e,
+  0x303,
+  0x4f,
+  0x300,
+  0x4f,
+  0x301,
+  0x4f,
+  0x302,
+  0x4f,
+  0x303,
+  0x4f,
+  0x308,
+  0x55,
+  0x300,
+  0x55,
+  0x301,
+  0x55,
+  0x302,
+  0x55,
+  0x308,
+  0x59,
+  0x301,
+  0x61,
+  0x300,
+  0x61,
+  0x301,
+  0x61,
+  0x302,
+  0x61,
+  0x303,
+  0x61,
+  0x308,
+  0x61,
+  0x30a,
+  0x63,
+  0x327,
+  0x65,
+  0x300,
+  0x65,
+  0x301,
+  0x65,
+  0x302,
+  0x65,
+  0x308,
+  0x69,
+  0x300,
+  0x69,
+  0x301,
+  0x69,
+  0x302,
+  0x69,
+  0x308,
+  0x6e,
+  0x303,
+  0x6f,
+  0x300,
+  0x6f,
+  0x301,
+  0x6f,
+  0x302,
+  0x6f,
+  0x303,
+  0x6f,
+  0x308,
+  0x75,
+  0x300,
+  0x75,
+  0x301,
+  0x75,
+  0x302,
+  0x75,
+  0x308,
+  0x79,
+  0x301,
+  0x79,
+  0x308,
+  0x41,
+  0x304,
+  0x61,
+  0x304,
+  0x41,
+  0x306,
+  0x61,
+  0x306,
+  0x41,
+  0x328,
+  0x61,
+  0x328,
+  0x43,
+  0x301,
+  0x63,
+  0x301,
+  0x43,
+  0x302,
+  0x63,
+  0x302,
+  0x43,
+  0x307,
+  0x63,
+  0x307,
+  0x43,
+  0x30c,
+  0x63,
+  0x30c,
+  0x44,
+  0x30c,
+  0x64,
+  0x30c,
+  0x45,
+  0x304,
+  0x65,
+  0x304,
+  0x45,
+  0x306,
+  0x65,
+  0x306,
+  0x45,
+  0x307,
+  0x65,
+  0x307,
+  0x45,
+  0x328,
+  0x65,
+  0x328,
+  0x45,
+  0x30c,
+  0x65,
+  0x30c,
+  0x47,
+  0x302,
+  0x67,
+  0x302,
+  0x47,
+  0x306,
+  0x67,
+  0x306,
+  0x47,
+  0x307,
+  0x67,
+  0x307,
+  0x47,
+  0x327,
+  0x67,
+  0x327,
+  0x48,
+  0x302,
+  0x68,
+  0x302,
+  0x49,
+  0x303,
+  0x69,
+  0x303,
+  0x49,
+  0x304,
+  0x69,
+  0x304,
+  0x49,
+  0x306,
+  0x69,
+  0x306,
+  0x49,
+  0x328,
+  0x69,
+  0x328,
+  0x49,
+  0x307,
+  0x49,
+  0x4a,
+  0x69,
+  0x6a,
+  0x4a,
+  0x302,
+  0x6a,
+  0x302,
+  0x4b,
+  0x327,
+  0x6b,
+  0x327,
+  0x4c,
+  0x301,
+  0x6c,
+  0x301,
+  0x4c,
+  0x327,
+  0x6c,
+  0x327,
+  0x4c,
+  0x30c,
+  0x6c,
+  0x30c,
+  0x4c,
+  0xb7,
+  0x6c,
+  0xb7,
+  0x4e,
+  0x301,
+  0x6e,
+  0x301,
+  0x4e,
+  0x327,
+  0x6e,
+  0x327,
+  0x4e,
+  0x30c,
+  0x6e,
+  0x30c,
+  0x2bc,
+  0x6e,
+  0x4f,
+  0x304,
+  0x6f,
+  0x304,
+  0x4f,
+  0x306,
+  0x6f,
+  0x306,
+  0x4f,
+  0x30b,
+  0x6f,
+  0x30b,
+  0x52,
+  0x301,
+  0x72,
+  0x301,
+  0x52,
+  0x327,
+  0x72,
+  0x327,
+  0x52,
+  0x30c,
+  0x72,
+  0x30c,
+  0x53,
+  0x301,
+  0x73,
+  0x301,
+  0x53,
+  0x302,
+  0x73,
+  0x302,
+  0x53,
+  0x327,
+  0x73,
+  0x327,
+  0x53,
+  0x30c,
+  0x73,
+  0x30c,
+  0x54,
+  0x327,
+  0x74,
+  0x327,
+  0x54,
+  0x30c,
+  0x74,
+  0x30c,
+  0x55,
+  0x303,
+  0x75,
+  0x303,
+  0x55,
+  0x304,
+  0x75,
+  0x304,
+  0x55,
+  0x306,
+  0x75,
+  0x306,
+  0x55,
+  0x30a,
+  0x75,
+  0x30a,
+  0x55,
+  0x30b,
+  0x75,
+  0x30b,
+  0x55,
+  0x328,
+  0x75,
+  0x328,
+  0x57,
+  0x302,
+  0x77,
+  0x302,
+  0x59,
+  0x302,
+  0x79,
+  0x302,
+  0x59,
+  0x308,
+  0x5a,
+  0x301,
+  0x7a,
+  0x301,
+  0x5a,
+  0x307,
+  0x7a,
+  0x307,
+  0x5a,
+  0x30c,
+  0x7a,
+  0x30c,
+  0x4f,
+  0x31b,
+  0x6f,
+  0x31b,
+  0x55,
+  0x31b,
+  0x75,
+  0x31b,
+  0x44,
+  0x17d,
+  0x44,
+  0x17e,
+  0x64,
+  0x17e,
+  0x4c,
+  0x4a,
+  0x4c,
+  0x6a,
+  0x6c,
+  0x6a,
+  0x4e,
+  0x4a,
+  0x4e,
+  0x6a,
+  0x6e,
+  0x6a,
+  0x41,
+  0x30c,
+  0x61,
+  0x30c,
+  0x49,
+  0x30c,
+  0x69,
+  0x30c,
+  0x4f,
+  0x30c,
+  0x6f,
+  0x30c,
+  0x55,
+  0x30c,
+  0x75,
+  0x30c,
+  0xdc,
+  0x304,
+  0xfc,
+  0x304,
+  0xdc,
+  0x301,
+  0xfc,
+  0x301,
+  0xdc,
+  0x30c,
+  0xfc,
+  0x30c,
+  0xdc,
+  0x300,
+  0xfc,
+  0x300,
+  0xc4,
+  0x304,
+  0xe4,
+  0x304,
+  0x226,
+  0x304,
+  0x227,
+  0x304,
+  0xc6,
+  0x304,
+  0xe6,
+  0x304,
+  0x47,
+  0x30c,
+  0x67,
+  0x30c,
+  0x4b,
+  0x30c,
+  0x6b,
+  0x30c,
+  0x4f,
+  0x328,
+  0x6f,
+  0x328,
+  0x1ea,
+  0x304,
+  0x1eb,
+  0x304,
+  0x1b7,
+  0x30c,
+  0x292,
+  0x30c,
+  0x6a,
+  0x30c,
+  0x44,
+  0x5a,
+  0x44,
+  0x7a,
+  0x64,
+  0x7a,
+  0x47,
+  0x301,
+  0x67,
+  0x301,
+  0x4e,
+  0x300,
+  0x6e,
+  0x300,
+  0xc5,
+  0x301,
+  0xe5,
+  0x301,
+  0xc6,
+  0x301,
+  0xe6,
+  0x301,
+  0xd8,
+  0x301,
+  0xf8,
+  0x301,
+  0x41,
+  0x30f,
+  0x61,
+  0x30f,
+  0x41,
+  0x311,
+  0x61,
+  0x311,
+  0x45,
+  0x30f,
+  0x65,
+  0x30f,
+  0x45,
+  0x311,
+  0x65,
+  0x311,
+  0x49,
+  0x30f,
+  0x69,
+  0x30f,
+  0x49,
+  0x311,
+  0x69,
+  0x311,
+  0x4f,
+  0x30f,
+  0x6f,
+  0x30f,
+  0x4f,
+  0x311,
+  0x6f,
+  0x311,
+  0x52,
+  0x30f,
+  0x72,
+  0x30f,
+  0x52,
+  0x311,
+  0x72,
+  0x311,
+  0x55,
+  0x30f,
+  0x75,
+  0x30f,
+  0x55,
+  0x311,
+  0x75,
+  0x311,
+  0x53,
+  0x326,
+  0x73,
+  0x326,
+  0x54,
+  0x326,
+  0x74,
+  0x326,
+  0x48,
+  0x30c,
+  0x68,
+  0x30c,
+  0x41,
+  0x307,
+  0x61,
+  0x307,
+  0x45,
+  0x327,
+  0x65,
+  0x327,
+  0xd6,
+  0x304,
+  0xf6,
+  0x304,
+  0xd5,
+  0x304,
+  0xf5,
+  0x304,
+  0x4f,
+  0x307,
+  0x6f,
+  0x307,
+  0x22e,
+  0x304,
+  0x22f,
+  0x304,
+  0x59,
+  0x304,
+  0x79,
+  0x304,
+  0x266,
+  0x279,
+  0x27b,
+  0x281,
+  0x20,
+  0x306,
+  0x20,
+  0x307,
+  0x20,
+  0x30a,
+  0x20,
+  0x328,
+  0x20,
+  0x303,
+  0x20,
+  0x30b,
+  0x263,
+  0x78,
+  0x295,
+  0x313,
+  0x308,
+  0x301,
+  0x2b9,
+  0x20,
+  0x345,
+  0x3b,
+  0xa8,
+  0x301,
+  0x391,
+  0x301,
+  0x395,
+  0x301,
+  0x397,
+  0x301,
+  0x399,
+  0x301,
+  0x39f,
+  0x301,
+  0x3a5,
+  0x301,
+  0x3a9,
+  0x301,
+  0x3ca,
+  0x301,
+  0x399,
+  0x308,
+  0x3a5,
+  0x308,
+  0x3b1,
+  0x301,
+  0x3b5,
+  0x301,
+  0x3b7,
+  0x301,
+  0x3b9,
+  0x301,
+  0x3cb,
+  0x301,
+  0x3b9,
+  0x308,
+  0x3c5,
+  0x308,
+  0x3bf,
+  0x301,
+  0x3c5,
+  0x301,
+  0x3c9,
+  0x301,
+  0x3b2,
+  0x3b8,
+  0x3d2,
+  0x301,
+  0x3d2,
+  0x308,
+  0x3c6,
+  0x3c0,
+  0x3ba,
+  0x3c1,
+  0x3c2,
+  0x398,
+  0x3a3,
+  0x415,
+  0x300,
+  0x415,
+  0x308,
+  0x413,
+  0x301,
+  0x406,
+  0x308,
+  0x41a,
+  0x301,
+  0x418,
+  0x300,
+  0x423,
+  0x306,
+  0x418,
+  0x306,
+  0x438,
+  0x306,
+  0x435,
+  0x300,
+  0x435,
+  0x308,
+  0x433,
+  0x301,
+  0x456,
+  0x308,
+  0x43a,
+  0x301,
+  0x438,
+  0x300,
+  0x443,
+  0x306,
+  0x474,
+  0x30f,
+  0x475,
+  0x30f,
+  0x416,
+  0x306,
+  0x436,
+  0x306,
+  0x410,
+  0x306,
+  0x430,
+  0x306,
+  0x410,
+  0x308,
+  0x430,
+  0x308,
+  0x415,
+  0x306,
+  0x435,
+  0x306,
+  0x4d8,
+  0x308,
+  0x4d9,
+  0x308,
+  0x416,
+  0x308,
+  0x436,
+  0x308,
+  0x417,
+  0x308,
+  0x437,
+  0x308,
+  0x418,
+  0x304,
+  0x438,
+  0x304,
+  0x418,
+  0x308,
+  0x438,
+  0x308,
+  0x41e,
+  0x308,
+  0x43e,
+  0x308,
+  0x4e8,
+  0x308,
+  0x4e9,
+  0x308,
+  0x42d,
+  0x308,
+  0x44d,
+  0x308,
+  0x423,
+  0x304,
+  0x443,
+  0x304,
+  0x423,
+  0x308,
+  0x443,
+  0x308,
+  0x423,
+  0x30b,
+  0x443,
+  0x30b,
+  0x427,
+  0x308,
+  0x447,
+  0x308,
+  0x42b,
+  0x308,
+  0x44b,
+  0x308,
+  0x565,
+  0x582,
+  0x627,
+  0x653,
+  0x627,
+  0x654,
+  0x648,
+  0x654,
+  0x627,
+  0x655,
+  0x64a,
+  0x654,
+  0x627,
+  0x674,
+  0x648,
+  0x674,
+  0x6c7,
+  0x674,
+  0x64a,
+  0x674,
+  0x6d5,
+  0x654,
+  0x6c1,
+  0x654,
+  0x6d2,
+  0x654,
+  0x928,
+  0x93c,
+  0x930,
+  0x93c,
+  0x933,
+  0x93c,
+  0x915,
+  0x93c,
+  0x916,
+  0x93c,
+  0x917,
+  0x93c,
+  0x91c,
+  0x93c,
+  0x921,
+  0x93c,
+  0x922,
+  0x93c,
+  0x92b,
+  0x93c,
+  0x92f,
+  0x93c,
+  0x9c7,
+  0x9be,
+  0x9c7,
+  0x9d7,
+  0x9a1,
+  0x9bc,
+  0x9a2,
+  0x9bc,
+  0x9af,
+  0x9bc,
+  0xa32,
+  0xa3c,
+  0xa38,
+  0xa3c,
+  0xa16,
+  0xa3c,
+  0xa17,
+  0xa3c,
+  0xa1c,
+  0xa3c,
+  0xa2b,
+  0xa3c,
+  0xb47,
+  0xb56,
+  0xb47,
+  0xb3e,
+  0xb47,
+  0xb57,
+  0xb21,
+  0xb3c,
+  0xb22,
+  0xb3c,
+  0xb92,
+  0xbd7,
+  0xbc6,
+  0xbbe,
+  0xbc7,
+  0xbbe,
+  0xbc6,
+  0xbd7,
+  0xc46,
+  0xc56,
+  0xcbf,
+  0xcd5,
+  0xcc6,
+  0xcd5,
+  0xcc6,
+  0xcd6,
+  0xcc6,
+  0xcc2,
+  0xcca,
+  0xcd5,
+  0xd46,
+  0xd3e,
+  0xd47,
+  0xd3e,
+  0xd46,
+  0xd57,
+  0xdd9,
+  0xdca,
+  0xdd9,
+  0xdcf,
+  0xddc,
+  0xdca,
+  0xdd9,
+  0xddf,
+  0xe4d,
+  0xe32,
+  0xecd,
+  0xeb2,
+  0xeab,
+  0xe99,
+  0xeab,
+  0xea1,
+  0xf0b,
+  0xf42,
+  0xfb7,
+  0xf4c,
+  0xfb7,
+  0xf51,
+  0xfb7,
+  0xf56,
+  0xfb7,
+  0xf5b,
+  0xfb7,
+  0xf40,
+  0xfb5,
+  0xf71,
+  0xf72,
+  0xf71,
+  0xf74,
+  0xfb2,
+  0xf80,
+  0xfb2,
+  0xf81,
+  0xfb3,
+  0xf80,
+  0xfb3,
+  0xf81,
+  0xf71,
+  0xf80,
+  0xf92,
+  0xfb7,
+  0xf9c,
+  0xfb7,
+  0xfa1,
+  0xfb7,
+  0xfa6,
+  0xfb7,
+  0xfab,
+  0xfb7,
+  0xf90,
+  0xfb5,
+  0x1025,
+  0x102e,
+  0x42,
+  0x18e,
+  0x4d,
+  0x222,
+  0x50,
+  0x250,
+  0x251,
+  0x1d02,
+  0x62,
+  0x259,
+  0x25b,
+  0x25c,
+  0x6d,
+  0x14b,
+  0x254,
+  0x1d16,
+  0x1d17,
+  0x70,
+  0x1d1d,
+  0x26f,
+  0x76,
+  0x1d25,
+  0x3b3,
+  0x3b4,
+  0x3c7,
+  0x41,
+  0x325,
+  0x61,
+  0x325,
+  0x42,
+  0x307,
+  0x62,
+  0x307,
+  0x42,
+  0x323,
+  0x62,
+  0x323,
+  0x42,
+  0x331,
+  0x62,
+  0x331,
+  0xc7,
+  0x301,
+  0xe7,
+  0x301,
+  0x44,
+  0x307,
+  0x64,
+  0x307,
+  0x44,
+  0x323,
+  0x64,
+  0x323,
+  0x44,
+  0x331,
+  0x64,
+  0x331,
+  0x44,
+  0x327,
+  0x64,
+  0x327,
+  0x44,
+  0x32d,
+  0x64,
+  0x32d,
+  0x112,
+  0x300,
+  0x113,
+  0x300,
+  0x112,
+  0x301,
+  0x113,
+  0x301,
+  0x45,
+  0x32d,
+  0x65,
+  0x32d,
+  0x45,
+  0x330,
+  0x65,
+  0x330,
+  0x228,
+  0x306,
+  0x229,
+  0x306,
+  0x46,
+  0x307,
+  0x66,
+  0x307,
+  0x47,
+  0x304,
+  0x67,
+  0x304,
+  0x48,
+  0x307,
+  0x68,
+  0x307,
+  0x48,
+  0x323,
+  0x68,
+  0x323,
+  0x48,
+  0x308,
+  0x68,
+  0x308,
+  0x48,
+  0x327,
+  0x68,
+  0x327,
+  0x48,
+  0x32e,
+  0x68,
+  0x32e,
+  0x49,
+  0x330,
+  0x69,
+  0x330,
+  0xcf,
+  0x301,
+  0xef,
+  0x301,
+  0x4b,
+  0x301,
+  0x6b,
+  0x301,
+  0x4b,
+  0x323,
+  0x6b,
+  0x323,
+  0x4b,
+  0x331,
+  0x6b,
+  0x331,
+  0x4c,
+  0x323,
+  0x6c,
+  0x323,
+  0x1e36,
+  0x304,
+  0x1e37,
+  0x304,
+  0x4c,
+  0x331,
+  0x6c,
+  0x331,
+  0x4c,
+  0x32d,
+  0x6c,
+  0x32d,
+  0x4d,
+  0x301,
+  0x6d,
+  0x301,
+  0x4d,
+  0x307,
+  0x6d,
+  0x307,
+  0x4d,
+  0x323,
+  0x6d,
+  0x323,
+  0x4e,
+  0x307,
+  0x6e,
+  0x307,
+  0x4e,
+  0x323,
+  0x6e,
+  0x323,
+  0x4e,
+  0x331,
+  0x6e,
+  0x331,
+  0x4e,
+  0x32d,
+  0x6e,
+  0x32d,
+  0xd5,
+  0x301,
+  0xf5,
+  0x301,
+  0xd5,
+  0x308,
+  0xf5,
+  0x308,
+  0x14c,
+  0x300,
+  0x14d,
+  0x300,
+  0x14c,
+  0x301,
+  0x14d,
+  0x301,
+  0x50,
+  0x301,
+  0x70,
+  0x301,
+  0x50,
+  0x307,
+  0x70,
+  0x307,
+  0x52,
+  0x307,
+  0x72,
+  0x307,
+  0x52,
+  0x323,
+  0x72,
+  0x323,
+  0x1e5a,
+  0x304,
+  0x1e5b,
+  0x304,
+  0x52,
+  0x331,
+  0x72,
+  0x331,
+  0x53,
+  0x307,
+  0x73,
+  0x307,
+  0x53,
+  0x323,
+  0x73,
+  0x323,
+  0x15a,
+  0x307,
+  0x15b,
+  0x307,
+  0x160,
+  0x307,
+  0x161,
+  0x307,
+  0x1e62,
+  0x307,
+  0x1e63,
+  0x307,
+  0x54,
+  0x307,
+  0x74,
+  0x307,
+  0x54,
+  0x323,
+  0x74,
+  0x323,
+  0x54,
+  0x331,
+  0x74,
+  0x331,
+  0x54,
+  0x32d,
+  0x74,
+  0x32d,
+  0x55,
+  0x324,
+  0x75,
+  0x324,
+  0x55,
+  0x330,
+  0x75,
+  0x330,
+  0x55,
+  0x32d,
+  0x75,
+  0x32d,
+  0x168,
+  0x301,
+  0x169,
+  0x301,
+  0x16a,
+  0x308,
+  0x16b,
+  0x308,
+  0x56,
+  0x303,
+  0x76,
+  0x303,
+  0x56,
+  0x323,
+  0x76,
+  0x323,
+  0x57,
+  0x300,
+  0x77,
+  0x300,
+  0x57,
+  0x301,
+  0x77,
+  0x301,
+  0x57,
+  0x308,
+  0x77,
+  0x308,
+  0x57,
+  0x307,
+  0x77,
+  0x307,
+  0x57,
+  0x323,
+  0x77,
+  0x323,
+  0x58,
+  0x307,
+  0x78,
+  0x307,
+  0x58,
+  0x308,
+  0x78,
+  0x308,
+  0x59,
+  0x307,
+  0x79,
+  0x307,
+  0x5a,
+  0x302,
+  0x7a,
+  0x302,
+  0x5a,
+  0x323,
+  0x7a,
+  0x323,
+  0x5a,
+  0x331,
+  0x7a,
+  0x331,
+  0x68,
+  0x331,
+  0x74,
+  0x308,
+  0x77,
+  0x30a,
+  0x79,
+  0x30a,
+  0x61,
+  0x2be,
+  0x17f,
+  0x307,
+  0x41,
+  0x323,
+  0x61,
+  0x323,
+  0x41,
+  0x309,
+  0x61,
+  0x309,
+  0xc2,
+  0x301,
+  0xe2,
+  0x301,
+  0xc2,
+  0x300,
+  0xe2,
+  0x300,
+  0xc2,
+  0x309,
+  0xe2,
+  0x309,
+  0xc2,
+  0x303,
+  0xe2,
+  0x303,
+  0x1ea0,
+  0x302,
+  0x1ea1,
+  0x302,
+  0x102,
+  0x301,
+  0x103,
+  0x301,
+  0x102,
+  0x300,
+  0x103,
+  0x300,
+  0x102,
+  0x309,
+  0x103,
+  0x309,
+  0x102,
+  0x303,
+  0x103,
+  0x303,
+  0x1ea0,
+  0x306,
+  0x1ea1,
+  0x306,
+  0x45,
+  0x323,
+  0x65,
+  0x323,
+  0x45,
+  0x309,
+  0x65,
+  0x309,
+  0x45,
+  0x303,
+  0x65,
+  0x303,
+  0xca,
+  0x301,
+  0xea,
+  0x301,
+  0xca,
+  0x300,
+  0xea,
+  0x300,
+  0xca,
+  0x309,
+  0xea,
+  0x309,
+  0xca,
+  0x303,
+  0xea,
+  0x303,
+  0x1eb8,
+  0x302,
+  0x1eb9,
+  0x302,
+  0x49,
+  0x309,
+  0x69,
+  0x309,
+  0x49,
+  0x323,
+  0x69,
+  0x323,
+  0x4f,
+  0x323,
+  0x6f,
+  0x323,
+  0x4f,
+  0x309,
+  0x6f,
+  0x309,
+  0xd4,
+  0x301,
+  0xf4,
+  0x301,
+  0xd4,
+  0x300,
+  0xf4,
+  0x300,
+  0xd4,
+  0x309,
+  0xf4,
+  0x309,
+  0xd4,
+  0x303,
+  0xf4,
+  0x303,
+  0x1ecc,
+  0x302,
+  0x1ecd,
+  0x302,
+  0x1a0,
+  0x301,
+  0x1a1,
+  0x301,
+  0x1a0,
+  0x300,
+  0x1a1,
+  0x300,
+  0x1a0,
+  0x309,
+  0x1a1,
+  0x309,
+  0x1a0,
+  0x303,
+  0x1a1,
+  0x303,
+  0x1a0,
+  0x323,
+  0x1a1,
+  0x323,
+  0x55,
+  0x323,
+  0x75,
+  0x323,
+  0x55,
+  0x309,
+  0x75,
+  0x309,
+  0x1af,
+  0x301,
+  0x1b0,
+  0x301,
+  0x1af,
+  0x300,
+  0x1b0,
+  0x300,
+  0x1af,
+  0x309,
+  0x1b0,
+  0x309,
+  0x1af,
+  0x303,
+  0x1b0,
+  0x303,
+  0x1af,
+  0x323,
+  0x1b0,
+  0x323,
+  0x59,
+  0x300,
+  0x79,
+  0x300,
+  0x59,
+  0x323,
+  0x79,
+  0x323,
+  0x59,
+  0x309,
+  0x79,
+  0x309,
+  0x59,
+  0x303,
+  0x79,
+  0x303,
+  0x3b1,
+  0x313,
+  0x3b1,
+  0x314,
+  0x1f00,
+  0x300,
+  0x1f01,
+  0x300,
+  0x1f00,
+  0x301,
+  0x1f01,
+  0x301,
+  0x1f00,
+  0x342,
+  0x1f01,
+  0x342,
+  0x391,
+  0x313,
+  0x391,
+  0x314,
+  0x1f08,
+  0x300,
+  0x1f09,
+  0x300,
+  0x1f08,
+  0x301,
+  0x1f09,
+  0x301,
+  0x1f08,
+  0x342,
+  0x1f09,
+  0x342,
+  0x3b5,
+  0x313,
+  0x3b5,
+  0x314,
+  0x1f10,
+  0x300,
+  0x1f11,
+  0x300,
+  0x1f10,
+  0x301,
+  0x1f11,
+  0x301,
+  0x395,
+  0x313,
+  0x395,
+  0x314,
+  0x1f18,
+  0x300,
+  0x1f19,
+  0x300,
+  0x1f18,
+  0x301,
+  0x1f19,
+  0x301,
+  0x3b7,
+  0x313,
+  0x3b7,
+  0x314,
+  0x1f20,
+  0x300,
+  0x1f21,
+  0x300,
+  0x1f20,
+  0x301,
+  0x1f21,
+  0x301,
+  0x1f20,
+  0x342,
+  0x1f21,
+  0x342,
+  0x397,
+  0x313,
+  0x397,
+  0x314,
+  0x1f28,
+  0x300,
+  0x1f29,
+  0x300,
+  0x1f28,
+  0x301,
+  0x1f29,
+  0x301,
+  0x1f28,
+  0x342,
+  0x1f29,
+  0x342,
+  0x3b9,
+  0x313,
+  0x3b9,
+  0x314,
+  0x1f30,
+  0x300,
+  0x1f31,
+  0x300,
+  0x1f30,
+  0x301,
+  0x1f31,
+  0x301,
+  0x1f30,
+  0x342,
+  0x1f31,
+  0x342,
+  0x399,
+  0x313,
+  0x399,
+  0x314,
+  0x1f38,
+  0x300,
+  0x1f39,
+  0x300,
+  0x1f38,
+  0x301,
+  0x1f39,
+  0x301,
+  0x1f38,
+  0x342,
+  0x1f39,
+  0x342,
+  0x3bf,
+  0x313,
+  0x3bf,
+  0x314,
+  0x1f40,
+  0x300,
+  0x1f41,
+  0x300,
+  0x1f40,
+  0x301,
+  0x1f41,
+  0x301,
+  0x39f,
+  0x313,
+  0x39f,
+  0x314,
+  0x1f48,
+  0x300,
+  0x1f49,
+  0x300,
+  0x1f48,
+  0x301,
+  0x1f49,
+  0x301,
+  0x3c5,
+  0x313,
+  0x3c5,
+  0x314,
+  0x1f50,
+  0x300,
+  0x1f51,
+  0x300,
+  0x1f50,
+  0x301,
+  0x1f51,
+  0x301,
+  0x1f50,
+  0x342,
+  0x1f51,
+  0x342,
+  0x3a5,
+  0x314,
+  0x1f59,
+  0x300,
+  0x1f59,
+  0x301,
+  0x1f59,
+  0x342,
+  0x3c9,
+  0x313,
+  0x3c9,
+  0x314,
+  0x1f60,
+  0x300,
+  0x1f61,
+  0x300,
+  0x1f60,
+  0x301,
+  0x1f61,
+  0x301,
+  0x1f60,
+  0x342,
+  0x1f61,
+  0x342,
+  0x3a9,
+  0x313,
+  0x3a9,
+  0x314,
+  0x1f68,
+  0x300,
+  0x1f69,
+  0x300,
+  0x1f68,
+  0x301,
+  0x1f69,
+  0x301,
+  0x1f68,
+  0x342,
+  0x1f69,
+  0x342,
+  0x3b1,
+  0x300,
+  0x3ac,
+  0x3b5,
+  0x300,
+  0x3ad,
+  0x3b7,
+  0x300,
+  0x3ae,
+  0x3b9,
+  0x300,
+  0x3af,
+  0x3bf,
+  0x300,
+  0x3cc,
+  0x3c5,
+  0x300,
+  0x3cd,
+  0x3c9,
+  0x300,
+  0x3ce,
+  0x1f00,
+  0x345,
+  0x1f01,
+  0x345,
+  0x1f02,
+  0x345,
+  0x1f03,
+  0x345,
+  0x1f04,
+  0x345,
+  0x1f05,
+  0x345,
+  0x1f06,
+  0x345,
+  0x1f07,
+  0x345,
+  0x1f08,
+  0x345,
+  0x1f09,
+  0x345,
+  0x1f0a,
+  0x345,
+  0x1f0b,
+  0x345,
+  0x1f0c,
+  0x345,
+  0x1f0d,
+  0x345,
+  0x1f0e,
+  0x345,
+  0x1f0f,
+  0x345,
+  0x1f20,
+  0x345,
+  0x1f21,
+  0x345,
+  0x1f22,
+  0x345,
+  0x1f23,
+  0x345,
+  0x1f24,
+  0x345,
+  0x1f25,
+  0x345,
+  0x1f26,
+  0x345,
+  0x1f27,
+  0x345,
+  0x1f28,
+  0x345,
+  0x1f29,
+  0x345,
+  0x1f2a,
+  0x345,
+  0x1f2b,
+  0x345,
+  0x1f2c,
+  0x345,
+  0x1f2d,
+  0x345,
+  0x1f2e,
+  0x345,
+  0x1f2f,
+  0x345,
+  0x1f60,
+  0x345,
+  0x1f61,
+  0x345,
+  0x1f62,
+  0x345,
+  0x1f63,
+  0x345,
+  0x1f64,
+  0x345,
+  0x1f65,
+  0x345,
+  0x1f66,
+  0x345,
+  0x1f67,
+  0x345,
+  0x1f68,
+  0x345,
+  0x1f69,
+  0x345,
+  0x1f6a,
+  0x345,
+  0x1f6b,
+  0x345,
+  0x1f6c,
+  0x345,
+  0x1f6d,
+  0x345,
+  0x1f6e,
+  0x345,
+  0x1f6f,
+  0x345,
+  0x3b1,
+  0x306,
+  0x3b1,
+  0x304,
+  0x1f70,
+  0x345,
+  0x3b1,
+  0x345,
+  0x3ac,
+  0x345,
+  0x3b1,
+  0x342,
+  0x1fb6,
+  0x345,
+  0x391,
+  0x306,
+  0x391,
+  0x304,
+  0x391,
+  0x300,
+  0x386,
+  0x391,
+  0x345,
+  0x20,
+  0x313,
+  0x20,
+  0x342,
+  0xa8,
+  0x342,
+  0x1f74,
+  0x345,
+  0x3b7,
+  0x345,
+  0x3ae,
+  0x345,
+  0x3b7,
+  0x342,
+  0x1fc6,
+  0x345,
+  0x395,
+  0x300,
+  0x388,
+  0x397,
+  0x300,
+  0x389,
+  0x397,
+  0x345,
+  0x1fbf,
+  0x300,
+  0x1fbf,
+  0x301,
+  0x1fbf,
+  0x342,
+  0x3b9,
+  0x306,
+  0x3b9,
+  0x304,
+  0x3ca,
+  0x300,
+  0x390,
+  0x3b9,
+  0x342,
+  0x3ca,
+  0x342,
+  0x399,
+  0x306,
+  0x399,
+  0x304,
+  0x399,
+  0x300,
+  0x38a,
+  0x1ffe,
+  0x300,
+  0x1ffe,
+  0x301,
+  0x1ffe,
+  0x342,
+  0x3c5,
+  0x306,
+  0x3c5,
+  0x304,
+  0x3cb,
+  0x300,
+  0x3b0,
+  0x3c1,
+  0x313,
+  0x3c1,
+  0x314,
+  0x3c5,
+  0x342,
+  0x3cb,
+  0x342,
+  0x3a5,
+  0x306,
+  0x3a5,
+  0x304,
+  0x3a5,
+  0x300,
+  0x38e,
+  0x3a1,
+  0x314,
+  0xa8,
+  0x300,
+  0x385,
+  0x60,
+  0x1f7c,
+  0x345,
+  0x3c9,
+  0x345,
+  0x3ce,
+  0x345,
+  0x3c9,
+  0x342,
+  0x1ff6,
+  0x345,
+  0x39f,
+  0x300,
+  0x38c,
+  0x3a9,
+  0x300,
+  0x38f,
+  0x3a9,
+  0x345,
+  0xb4,
+  0x20,
+  0x314,
+  0x2002,
+  0x2003,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x2010,
+  0x20,
+  0x333,
+  0x2e,
+  0x2e,
+  0x2e,
+  0x20,
+  0x2032,
+  0x2032,
+  0x2032,
+  0x2032,
+  0x2032,
+  0x2035,
+  0x2035,
+  0x2035,
+  0x2035,
+  0x2035,
+  0x21,
+  0x21,
+  0x20,
+  0x305,
+  0x3f,
+  0x3f,
+  0x3f,
+  0x21,
+  0x21,
+  0x3f,
+  0x20,
+  0x30,
+  0x35,
+  0x36,
+  0x37,
+  0x38,
+  0x39,
+  0x2b,
+  0x2212,
+  0x3d,
+  0x28,
+  0x29,
+  0x52,
+  0x73,
+  0x61,
+  0x2f,
+  0x63,
+  0x61,
+  0x2f,
+  0x73,
+  0xb0,
+  0x43,
+  0x63,
+  0x2f,
+  0x6f,
+  0x63,
+  0x2f,
+  0x75,
+  0x190,
+  0xb0,
+  0x46,
+  0x127,
+  0x4e,
+  0x6f,
+  0x51,
+  0x53,
+  0x4d,
+  0x54,
+  0x45,
+  0x4c,
+  0x54,
+  0x4d,
+  0x5d0,
+  0x5d1,
+  0x5d2,
+  0x5d3,
+  0x46,
+  0x41,
+  0x58,
+  0x393,
+  0x3a0,
+  0x2211,
+  0x31,
+  0x2044,
+  0x33,
+  0x32,
+  0x2044,
+  0x33,
+  0x31,
+  0x2044,
+  0x35,
+  0x32,
+  0x2044,
+  0x35,
+  0x33,
+  0x2044,
+  0x35,
+  0x34,
+  0x2044,
+  0x35,
+  0x31,
+  0x2044,
+  0x36,
+  0x35,
+  0x2044,
+  0x36,
+  0x31,
+  0x2044,
+  0x38,
+  0x33,
+  0x2044,
+  0x38,
+  0x35,
+  0x2044,
+  0x38,
+  0x37,
+  0x2044,
+  0x38,
+  0x49,
+  0x49,
+  0x49,
+  0x49,
+  0x49,
+  0x49,
+  0x56,
+  0x56,
+  0x49,
+  0x56,
+  0x49,
+  0x49,
+  0x56,
+  0x49,
+  0x49,
+  0x49,
+  0x49,
+  0x58,
+  0x58,
+  0x49,
+  0x58,
+  0x49,
+  0x49,
+  0x69,
+  0x69,
+  0x69,
+  0x69,
+  0x69,
+  0x69,
+  0x76,
+  0x76,
+  0x69,
+  0x76,
+  0x69,
+  0x69,
+  0x76,
+  0x69,
+  0x69,
+  0x69,
+  0x69,
+  0x78,
+  0x78,
+  0x69,
+  0x78,
+  0x69,
+  0x69,
+  0x2190,
+  0x338,
+  0x2192,
+  0x338,
+  0x2194,
+  0x338,
+  0x21d0,
+  0x338,
+  0x21d4,
+  0x338,
+  0x21d2,
+  0x338,
+  0x2203,
+  0x338,
+  0x2208,
+  0x338,
+  0x220b,
+  0x338,
+  0x2223,
+  0x338,
+  0x2225,
+  0x338,
+  0x222b,
+  0x222b,
+  0x222b,
+  0x222b,
+  0x222b,
+  0x222e,
+  0x222e,
+  0x222e,
+  0x222e,
+  0x222e,
+  0x223c,
+  0x338,
+  0x2243,
+  0x338,
+  0x2245,
+  0x338,
+  0x2248,
+  0x338,
+  0x3d,
+  0x338,
+  0x2261,
+  0x338,
+  0x224d,
+  0x338,
+  0x3c,
+  0x338,
+  0x3e,
+  0x338,
+  0x2264,
+  0x338,
+  0x2265,
+  0x338,
+  0x2272,
+  0x338,
+  0x2273,
+  0x338,
+  0x2276,
+  0x338,
+  0x2277,
+  0x338,
+  0x227a,
+  0x338,
+  0x227b,
+  0x338,
+  0x2282,
+  0x338,
+  0x2283,
+  0x338,
+  0x2286,
+  0x338,
+  0x2287,
+  0x338,
+  0x22a2,
+  0x338,
+  0x22a8,
+  0x338,
+  0x22a9,
+  0x338,
+  0x22ab,
+  0x338,
+  0x227c,
+  0x338,
+  0x227d,
+  0x338,
+  0x2291,
+  0x338,
+  0x2292,
+  0x338,
+  0x22b2,
+  0x338,
+  0x22b3,
+  0x338,
+  0x22b4,
+  0x338,
+  0x22b5,
+  0x338,
+  0x3008,
+  0x3009,
+  0x31,
+  0x30,
+  0x31,
+  0x31,
+  0x31,
+  0x32,
+  0x31,
+  0x33,
+  0x31,
+  0x34,
+  0x31,
+  0x35,
+  0x31,
+  0x36,
+  0x31,
+  0x37,
+  0x31,
+  0x38,
+  0x31,
+  0x39,
+  0x32,
+  0x30,
+  0x28,
+  0x31,
+  0x29,
+  0x28,
+  0x32,
+  0x29,
+  0x28,
+  0x33,
+  0x29,
+  0x28,
+  0x34,
+  0x29,
+  0x28,
+  0x35,
+  0x29,
+  0x28,
+  0x36,
+  0x29,
+  0x28,
+  0x37,
+  0x29,
+  0x28,
+  0x38,
+  0x29,
+  0x28,
+  0x39,
+  0x29,
+  0x28,
+  0x31,
+  0x30,
+  0x29,
+  0x28,
+  0x31,
+  0x31,
+  0x29,
+  0x28,
+  0x31,
+  0x32,
+  0x29,
+  0x28,
+  0x31,
+  0x33,
+  0x29,
+  0x28,
+  0x31,
+  0x34,
+  0x29,
+  0x28,
+  0x31,
+  0x35,
+  0x29,
+  0x28,
+  0x31,
+  0x36,
+  0x29,
+  0x28,
+  0x31,
+  0x37,
+  0x29,
+  0x28,
+  0x31,
+  0x38,
+  0x29,
+  0x28,
+  0x31,
+  0x39,
+  0x29,
+  0x28,
+  0x32,
+  0x30,
+  0x29,
+  0x31,
+  0x2e,
+  0x32,
+  0x2e,
+  0x33,
+  0x2e,
+  0x34,
+  0x2e,
+  0x35,
+  0x2e,
+  0x36,
+  0x2e,
+  0x37,
+  0x2e,
+  0x38,
+  0x2e,
+  0x39,
+  0x2e,
+  0x31,
+  0x30,
+  0x2e,
+  0x31,
+  0x31,
+  0x2e,
+  0x31,
+  0x32,
+  0x2e,
+  0x31,
+  0x33,
+  0x2e,
+  0x31,
+  0x34,
+  0x2e,
+  0x31,
+  0x35,
+  0x2e,
+  0x31,
+  0x36,
+  0x2e,
+  0x31,
+  0x37,
+  0x2e,
+  0x31,
+  0x38,
+  0x2e,
+  0x31,
+  0x39,
+  0x2e,
+  0x32,
+  0x30,
+  0x2e,
+  0x28,
+  0x61,
+  0x29,
+  0x28,
+  0x62,
+  0x29,
+  0x28,
+  0x63,
+  0x29,
+  0x28,
+  0x64,
+  0x29,
+  0x28,
+  0x65,
+  0x29,
+  0x28,
+  0x66,
+  0x29,
+  0x28,
+  0x67,
+  0x29,
+  0x28,
+  0x68,
+  0x29,
+  0x28,
+  0x69,
+  0x29,
+  0x28,
+  0x6a,
+  0x29,
+  0x28,
+  0x6b,
+  0x29,
+  0x28,
+  0x6c,
+  0x29,
+  0x28,
+  0x6d,
+  0x29,
+  0x28,
+  0x6e,
+  0x29,
+  0x28,
+  0x6f,
+  0x29,
+  0x28,
+  0x70,
+  0x29,
+  0x28,
+  0x71,
+  0x29,
+  0x28,
+  0x72,
+  0x29,
+  0x28,
+  0x73,
+  0x29,
+  0x28,
+  0x74,
+  0x29,
+  0x28,
+  0x75,
+  0x29,
+  0x28,
+  0x76,
+  0x29,
+  0x28,
+  0x77,
+  0x29,
+  0x28,
+  0x78,
+  0x29,
+  0x28,
+  0x79,
+  0x29,
+  0x28,
+  0x7a,
+  0x29,
+  0x3a,
+  0x3a,
+  0x3d,
+  0x3d,
+  0x3d,
+  0x2add,
+  0x338,
+  0x6bcd,
+  0x9f9f,
+  0x4e00,
+  0x4e28,
+  0x4e36,
+  0x4e3f,
+  0x4e59,
+  0x4e85,
+  0x4e8c,
+  0x4ea0,
+  0x4eba,
+  0x513f,
+  0x5165,
+  0x516b,
+  0x5182,
+  0x5196,
+  0x51ab,
+  0x51e0,
+  0x51f5,
+  0x5200,
+  0x529b,
+  0x52f9,
+  0x5315,
+  0x531a,
+  0x5338,
+  0x5341,
+  0x535c,
+  0x5369,
+  0x5382,
+  0x53b6,
+  0x53c8,
+  0x53e3,
+  0x56d7,
+  0x571f,
+  0x58eb,
+  0x5902,
+  0x590a,
+  0x5915,
+  0x5927,
+  0x5973,
+  0x5b50,
+  0x5b80,
+  0x5bf8,
+  0x5c0f,
+  0x5c22,
+  0x5c38,
+  0x5c6e,
+  0x5c71,
+  0x5ddb,
+  0x5de5,
+  0x5df1,
+  0x5dfe,
+  0x5e72,
+  0x5e7a,
+  0x5e7f,
+  0x5ef4,
+  0x5efe,
+  0x5f0b,
+  0x5f13,
+  0x5f50,
+  0x5f61,
+  0x5f73,
+  0x5fc3,
+  0x6208,
+  0x6236,
+  0x624b,
+  0x652f,
+  0x6534,
+  0x6587,
+  0x6597,
+  0x65a4,
+  0x65b9,
+  0x65e0,
+  0x65e5,
+  0x66f0,
+  0x6708,
+  0x6728,
+  0x6b20,
+  0x6b62,
+  0x6b79,
+  0x6bb3,
+  0x6bcb,
+  0x6bd4,
+  0x6bdb,
+  0x6c0f,
+  0x6c14,
+  0x6c34,
+  0x706b,
+  0x722a,
+  0x7236,
+  0x723b,
+  0x723f,
+  0x7247,
+  0x7259,
+  0x725b,
+  0x72ac,
+  0x7384,
+  0x7389,
+  0x74dc,
+  0x74e6,
+  0x7518,
+  0x751f,
+  0x7528,
+  0x7530,
+  0x758b,
+  0x7592,
+  0x7676,
+  0x767d,
+  0x76ae,
+  0x76bf,
+  0x76ee,
+  0x77db,
+  0x77e2,
+  0x77f3,
+  0x793a,
+  0x79b8,
+  0x79be,
+  0x7a74,
+  0x7acb,
+  0x7af9,
+  0x7c73,
+  0x7cf8,
+  0x7f36,
+  0x7f51,
+  0x7f8a,
+  0x7fbd,
+  0x8001,
+  0x800c,
+  0x8012,
+  0x8033,
+  0x807f,
+  0x8089,
+  0x81e3,
+  0x81ea,
+  0x81f3,
+  0x81fc,
+  0x820c,
+  0x821b,
+  0x821f,
+  0x826e,
+  0x8272,
+  0x8278,
+  0x864d,
+  0x866b,
+  0x8840,
+  0x884c,
+  0x8863,
+  0x897e,
+  0x898b,
+  0x89d2,
+  0x8a00,
+  0x8c37,
+  0x8c46,
+  0x8c55,
+  0x8c78,
+  0x8c9d,
+  0x8d64,
+  0x8d70,
+  0x8db3,
+  0x8eab,
+  0x8eca,
+  0x8f9b,
+  0x8fb0,
+  0x8fb5,
+  0x9091,
+  0x9149,
+  0x91c6,
+  0x91cc,
+  0x91d1,
+  0x9577,
+  0x9580,
+  0x961c,
+  0x96b6,
+  0x96b9,
+  0x96e8,
+  0x9751,
+  0x975e,
+  0x9762,
+  0x9769,
+  0x97cb,
+  0x97ed,
+  0x97f3,
+  0x9801,
+  0x98a8,
+  0x98db,
+  0x98df,
+  0x9996,
+  0x9999,
+  0x99ac,
+  0x9aa8,
+  0x9ad8,
+  0x9adf,
+  0x9b25,
+  0x9b2f,
+  0x9b32,
+  0x9b3c,
+  0x9b5a,
+  0x9ce5,
+  0x9e75,
+  0x9e7f,
+  0x9ea5,
+  0x9ebb,
+  0x9ec3,
+  0x9ecd,
+  0x9ed1,
+  0x9ef9,
+  0x9efd,
+  0x9f0e,
+  0x9f13,
+  0x9f20,
+  0x9f3b,
+  0x9f4a,
+  0x9f52,
+  0x9f8d,
+  0x9f9c,
+  0x9fa0,
+  0x20,
+  0x3012,
+  0x5344,
+  0x5345,
+  0x304b,
+  0x3099,
+  0x304d,
+  0x3099,
+  0x304f,
+  0x3099,
+  0x3051,
+  0x3099,
+  0x3053,
+  0x3099,
+  0x3055,
+  0x3099,
+  0x3057,
+  0x3099,
+  0x3059,
+  0x3099,
+  0x305b,
+  0x3099,
+  0x305d,
+  0x3099,
+  0x305f,
+  0x3099,
+  0x3061,
+  0x3099,
+  0x3064,
+  0x3099,
+  0x3066,
+  0x3099,
+  0x3068,
+  0x3099,
+  0x306f,
+  0x3099,
+  0x306f,
+  0x309a,
+  0x3072,
+  0x3099,
+  0x3072,
+  0x309a,
+  0x3075,
+  0x3099,
+  0x3075,
+  0x309a,
+  0x3078,
+  0x3099,
+  0x3078,
+  0x309a,
+  0x307b,
+  0x3099,
+  0x307b,
+  0x309a,
+  0x3046,
+  0x3099,
+  0x20,
+  0x3099,
+  0x20,
+  0x309a,
+  0x309d,
+  0x3099,
+  0x3088,
+  0x308a,
+  0x30ab,
+  0x3099,
+  0x30ad,
+  0x3099,
+  0x30af,
+  0x3099,
+  0x30b1,
+  0x3099,
+  0x30b3,
+  0x3099,
+  0x30b5,
+  0x3099,
+  0x30b7,
+  0x3099,
+  0x30b9,
+  0x3099,
+  0x30bb,
+  0x3099,
+  0x30bd,
+  0x3099,
+  0x30bf,
+  0x3099,
+  0x30c1,
+  0x3099,
+  0x30c4,
+  0x3099,
+  0x30c6,
+  0x3099,
+  0x30c8,
+  0x3099,
+  0x30cf,
+  0x3099,
+  0x30cf,
+  0x309a,
+  0x30d2,
+  0x3099,
+  0x30d2,
+  0x309a,
+  0x30d5,
+  0x3099,
+  0x30d5,
+  0x309a,
+  0x30d8,
+  0x3099,
+  0x30d8,
+  0x309a,
+  0x30db,
+  0x3099,
+  0x30db,
+  0x309a,
+  0x30a6,
+  0x3099,
+  0x30ef,
+  0x3099,
+  0x30f0,
+  0x3099,
+  0x30f1,
+  0x3099,
+  0x30f2,
+  0x3099,
+  0x30fd,
+  0x3099,
+  0x30b3,
+  0x30c8,
+  0x1100,
+  0x1101,
+  0x11aa,
+  0x1102,
+  0x11ac,
+  0x11ad,
+  0x1103,
+  0x1104,
+  0x1105,
+  0x11b0,
+  0x11b1,
+  0x11b2,
+  0x11b3,
+  0x11b4,
+  0x11b5,
+  0x111a,
+  0x1106,
+  0x1107,
+  0x1108,
+  0x1121,
+  0x1109,
+  0x110a,
+  0x110b,
+  0x110c,
+  0x110d,
+  0x110e,
+  0x110f,
+  0x1110,
+  0x1111,
+  0x1112,
+  0x1161,
+  0x1162,
+  0x1163,
+  0x1164,
+  0x1165,
+  0x1166,
+  0x1167,
+  0x1168,
+  0x1169,
+  0x116a,
+  0x116b,
+  0x116c,
+  0x116d,
+  0x116e,
+  0x116f,
+  0x1170,
+  0x1171,
+  0x1172,
+  0x1173,
+  0x1174,
+  0x1175,
+  0x1160,
+  0x1114,
+  0x1115,
+  0x11c7,
+  0x11c8,
+  0x11cc,
+  0x11ce,
+  0x11d3,
+  0x11d7,
+  0x11d9,
+  0x111c,
+  0x11dd,
+  0x11df,
+  0x111d,
+  0x111e,
+  0x1120,
+  0x1122,
+  0x1123,
+  0x1127,
+  0x1129,
+  0x112b,
+  0x112c,
+  0x112d,
+  0x112e,
+  0x112f,
+  0x1132,
+  0x1136,
+  0x1140,
+  0x1147,
+  0x114c,
+  0x11f1,
+  0x11f2,
+  0x1157,
+  0x1158,
+  0x1159,
+  0x1184,
+  0x1185,
+  0x1188,
+  0x1191,
+  0x1192,
+  0x1194,
+  0x119e,
+  0x11a1,
+  0x4e09,
+  0x56db,
+  0x4e0a,
+  0x4e2d,
+  0x4e0b,
+  0x7532,
+  0x4e19,
+  0x4e01,
+  0x5929,
+  0x5730,
+  0x28,
+  0x1100,
+  0x29,
+  0x28,
+  0x1102,
+  0x29,
+  0x28,
+  0x1103,
+  0x29,
+  0x28,
+  0x1105,
+  0x29,
+  0x28,
+  0x1106,
+  0x29,
+  0x28,
+  0x1107,
+  0x29,
+  0x28,
+  0x1109,
+  0x29,
+  0x28,
+  0x110b,
+  0x29,
+  0x28,
+  0x110c,
+  0x29,
+  0x28,
+  0x110e,
+  0x29,
+  0x28,
+  0x110f,
+  0x29,
+  0x28,
+  0x1110,
+  0x29,
+  0x28,
+  0x1111,
+  0x29,
+  0x28,
+  0x1112,
+  0x29,
+  0x28,
+  0x1100,
+  0x1161,
+  0x29,
+  0x28,
+  0x1102,
+  0x1161,
+  0x29,
+  0x28,
+  0x1103,
+  0x1161,
+  0x29,
+  0x28,
+  0x1105,
+  0x1161,
+  0x29,
+  0x28,
+  0x1106,
+  0x1161,
+  0x29,
+  0x28,
+  0x1107,
+  0x1161,
+  0x29,
+  0x28,
+  0x1109,
+  0x1161,
+  0x29,
+  0x28,
+  0x110b,
+  0x1161,
+  0x29,
+  0x28,
+  0x110c,
+  0x1161,
+  0x29,
+  0x28,
+  0x110e,
+  0x1161,
+  0x29,
+  0x28,
+  0x110f,
+  0x1161,
+  0x29,
+  0x28,
+  0x1110,
+  0x1161,
+  0x29,
+  0x28,
+  0x1111,
+  0x1161,
+  0x29,
+  0x28,
+  0x1112,
+  0x1161,
+  0x29,
+  0x28,
+  0x110c,
+  0x116e,
+  0x29,
+  0x28,
+  0x110b,
+  0x1169,
+  0x110c,
+  0x1165,
+  0x11ab,
+  0x29,
+  0x28,
+  0x110b,
+  0x1169,
+  0x1112,
+  0x116e,
+  0x29,
+  0x28,
+  0x4e00,
+  0x29,
+  0x28,
+  0x4e8c,
+  0x29,
+  0x28,
+  0x4e09,
+  0x29,
+  0x28,
+  0x56db,
+  0x29,
+  0x28,
+  0x4e94,
+  0x29,
+  0x28,
+  0x516d,
+  0x29,
+  0x28,
+  0x4e03,
+  0x29,
+  0x28,
+  0x516b,
+  0x29,
+  0x28,
+  0x4e5d,
+  0x29,
+  0x28,
+  0x5341,
+  0x29,
+  0x28,
+  0x6708,
+  0x29,
+  0x28,
+  0x706b,
+  0x29,
+  0x28,
+  0x6c34,
+  0x29,
+  0x28,
+  0x6728,
+  0x29,
+  0x28,
+  0x91d1,
+  0x29,
+  0x28,
+  0x571f,
+  0x29,
+  0x28,
+  0x65e5,
+  0x29,
+  0x28,
+  0x682a,
+  0x29,
+  0x28,
+  0x6709,
+  0x29,
+  0x28,
+  0x793e,
+  0x29,
+  0x28,
+  0x540d,
+  0x29,
+  0x28,
+  0x7279,
+  0x29,
+  0x28,
+  0x8ca1,
+  0x29,
+  0x28,
+  0x795d,
+  0x29,
+  0x28,
+  0x52b4,
+  0x29,
+  0x28,
+  0x4ee3,
+  0x29,
+  0x28,
+  0x547c,
+  0x29,
+  0x28,
+  0x5b66,
+  0x29,
+  0x28,
+  0x76e3,
+  0x29,
+  0x28,
+  0x4f01,
+  0x29,
+  0x28,
+  0x8cc7,
+  0x29,
+  0x28,
+  0x5354,
+  0x29,
+  0x28,
+  0x796d,
+  0x29,
+  0x28,
+  0x4f11,
+  0x29,
+  0x28,
+  0x81ea,
+  0x29,
+  0x28,
+  0x81f3,
+  0x29,
+  0x50,
+  0x54,
+  0x45,
+  0x32,
+  0x32,
+  0x32,
+  0x34,
+  0x32,
+  0x35,
+  0x32,
+  0x36,
+  0x32,
+  0x37,
+  0x32,
+  0x38,
+  0x32,
+  0x39,
+  0x33,
+  0x30,
+  0x33,
+  0x33,
+  0x33,
+  0x34,
+  0x33,
+  0x35,
+  0x110e,
+  0x1161,
+  0x11b7,
+  0x1100,
+  0x1169,
+  0x110c,
+  0x116e,
+  0x110b,
+  0x1174,
+  0x79d8,
+  0x7537,
+  0x9069,
+  0x512a,
+  0x5370,
+  0x6ce8,
+  0x9805,
+  0x5199,
+  0x6b63,
+  0x5de6,
+  0x53f3,
+  0x533b,
+  0x5b97,
+  0x591c,
+  0x33,
+  0x36,
+  0x33,
+  0x37,
+  0x33,
+  0x38,
+  0x33,
+  0x39,
+  0x34,
+  0x30,
+  0x34,
+  0x34,
+  0x34,
+  0x35,
+  0x34,
+  0x36,
+  0x34,
+  0x37,
+  0x34,
+  0x38,
+  0x34,
+  0x39,
+  0x35,
+  0x30,
+  0x31,
+  0x6708,
+  0x32,
+  0x6708,
+  0x33,
+  0x6708,
+  0x34,
+  0x6708,
+  0x35,
+  0x6708,
+  0x36,
+  0x6708,
+  0x37,
+  0x6708,
+  0x38,
+  0x6708,
+  0x39,
+  0x6708,
+  0x31,
+  0x30,
+  0x6708,
+  0x31,
+  0x31,
+  0x6708,
+  0x31,
+  0x32,
+  0x6708,
+  0x48,
+  0x67,
+  0x65,
+  0x72,
+  0x67,
+  0x65,
+  0x56,
+  0x4c,
+  0x54,
+  0x44,
+  0x30a2,
+  0x30a4,
+  0x30a8,
+  0x30aa,
+  0x30ca,
+  0x30cb,
+  0x30cc,
+  0x30cd,
+  0x30ce,
+  0x30de,
+  0x30df,
+  0x30e0,
+  0x30e1,
+  0x30e2,
+  0x30e4,
+  0x30e6,
+  0x30e8,
+  0x30e9,
+  0x30ea,
+  0x30eb,
+  0x30ec,
+  0x30ed,
+  0x30a2,
+  0x30d1,
+  0x30fc,
+  0x30c8,
+  0x30a2,
+  0x30eb,
+  0x30d5,
+  0x30a1,
+  0x30a2,
+  0x30f3,
+  0x30da,
+  0x30a2,
+  0x30a2,
+  0x30fc,
+  0x30eb,
+  0x30a4,
+  0x30cb,
+  0x30f3,
+  0x30b0,
+  0x30a4,
+  0x30f3,
+  0x30c1,
+  0x30a6,
+  0x30a9,
+  0x30f3,
+  0x30a8,
+  0x30b9,
+  0x30af,
+  0x30fc,
+  0x30c9,
+  0x30a8,
+  0x30fc,
+  0x30ab,
+  0x30fc,
+  0x30aa,
+  0x30f3,
+  0x30b9,
+  0x30aa,
+  0x30fc,
+  0x30e0,
+  0x30ab,
+  0x30a4,
+  0x30ea,
+  0x30ab,
+  0x30e9,
+  0x30c3,
+  0x30c8,
+  0x30ab,
+  0x30ed,
+  0x30ea,
+  0x30fc,
+  0x30ac,
+  0x30ed,
+  0x30f3,
+  0x30ac,
+  0x30f3,
+  0x30de,
+  0x30ae,
+  0x30ac,
+  0x30ae,
+  0x30cb,
+  0x30fc,
+  0x30ad,
+  0x30e5,
+  0x30ea,
+  0x30fc,
+  0x30ae,
+  0x30eb,
+  0x30c0,
+  0x30fc,
+  0x30ad,
+  0x30ed,
+  0x30ad,
+  0x30ed,
+  0x30b0,
+  0x30e9,
+  0x30e0,
+  0x30ad,
+  0x30ed,
+  0x30e1,
+  0x30fc,
+  0x30c8,
+  0x30eb,
+  0x30ad,
+  0x30ed,
+  0x30ef,
+  0x30c3,
+  0x30c8,
+  0x30b0,
+  0x30e9,
+  0x30e0,
+  0x30c8,
+  0x30f3,
+  0x30af,
+  0x30eb,
+  0x30bc,
+  0x30a4,
+  0x30ed,
+  0x30af,
+  0x30ed,
+  0x30fc,
+  0x30cd,
+  0x30b1,
+  0x30fc,
+  0x30b9,
+  0x30b3,
+  0x30eb,
+  0x30ca,
+  0x30b3,
+  0x30fc,
+  0x30dd,
+  0x30b5,
+  0x30a4,
+  0x30af,
+  0x30eb,
+  0x30b5,
+  0x30f3,
+  0x30c1,
+  0x30fc,
+  0x30e0,
+  0x30b7,
+  0x30ea,
+  0x30f3,
+  0x30b0,
+  0x30bb,
+  0x30f3,
+  0x30c1,
+  0x30bb,
+  0x30f3,
+  0x30c8,
+  0x30c0,
+  0x30fc,
+  0x30b9,
+  0x30c7,
+  0x30b7,
+  0x30c9,
+  0x30eb,
+  0x30ca,
+  0x30ce,
+  0x30ce,
+  0x30c3,
+  0x30c8,
+  0x30cf,
+  0x30a4,
+  0x30c4,
+  0x30d1,
+  0x30fc,
+  0x30bb,
+  0x30f3,
+  0x30c8,
+  0x30d1,
+  0x30fc,
+  0x30c4,
+  0x30d0,
+  0x30fc,
+  0x30ec,
+  0x30eb,
+  0x30d4,
+  0x30a2,
+  0x30b9,
+  0x30c8,
+  0x30eb,
+  0x30d4,
+  0x30af,
+  0x30eb,
+  0x30d4,
+  0x30b3,
+  0x30d3,
+  0x30eb,
+  0x30d5,
+  0x30a1,
+  0x30e9,
+  0x30c3,
+  0x30c9,
+  0x30d5,
+  0x30a3,
+  0x30fc,
+  0x30c8,
+  0x30d6,
+  0x30c3,
+  0x30b7,
+  0x30a7,
+  0x30eb,
+  0x30d5,
+  0x30e9,
+  0x30f3,
+  0x30d8,
+  0x30af,
+  0x30bf,
+  0x30fc,
+  0x30eb,
+  0x30da,
+  0x30bd,
+  0x30da,
+  0x30cb,
+  0x30d2,
+  0x30d8,
+  0x30eb,
+  0x30c4,
+  0x30da,
+  0x30f3,
+  0x30b9,
+  0x30da,
+  0x30fc,
+  0x30b8,
+  0x30d9,
+  0x30fc,
+  0x30bf,
+  0x30dd,
+  0x30a4,
+  0x30f3,
+  0x30c8,
+  0x30dc,
+  0x30eb,
+  0x30c8,
+  0x30db,
+  0x30f3,
+  0x30dd,
+  0x30f3,
+  0x30c9,
+  0x30db,
+  0x30fc,
+  0x30eb,
+  0x30db,
+  0x30fc,
+  0x30f3,
+  0x30de,
+  0x30a4,
+  0x30af,
+  0x30ed,
+  0x30de,
+  0x30a4,
+  0x30eb,
+  0x30de,
+  0x30c3,
+  0x30cf,
+  0x30de,
+  0x30eb,
+  0x30af,
+  0x30de,
+  0x30f3,
+  0x30b7,
+  0x30e7,
+  0x30f3,
+  0x30df,
+  0x30af,
+  0x30ed,
+  0x30f3,
+  0x30df,
+  0x30ea,
+  0x30df,
+  0x30ea,
+  0x30d0,
+  0x30fc,
+  0x30eb,
+  0x30e1,
+  0x30ac,
+  0x30e1,
+  0x30ac,
+  0x30c8,
+  0x30f3,
+  0x30e4,
+  0x30fc,
+  0x30c9,
+  0x30e4,
+  0x30fc,
+  0x30eb,
+  0x30e6,
+  0x30a2,
+  0x30f3,
+  0x30ea,
+  0x30c3,
+  0x30c8,
+  0x30eb,
+  0x30ea,
+  0x30e9,
+  0x30eb,
+  0x30d4,
+  0x30fc,
+  0x30eb,
+  0x30fc,
+  0x30d6,
+  0x30eb,
+  0x30ec,
+  0x30e0,
+  0x30ec,
+  0x30f3,
+  0x30c8,
+  0x30b2,
+  0x30f3,
+  0x30,
+  0x70b9,
+  0x31,
+  0x70b9,
+  0x32,
+  0x70b9,
+  0x33,
+  0x70b9,
+  0x34,
+  0x70b9,
+  0x35,
+  0x70b9,
+  0x36,
+  0x70b9,
+  0x37,
+  0x70b9,
+  0x38,
+  0x70b9,
+  0x39,
+  0x70b9,
+  0x31,
+  0x30,
+  0x70b9,
+  0x31,
+  0x31,
+  0x70b9,
+  0x31,
+  0x32,
+  0x70b9,
+  0x31,
+  0x33,
+  0x70b9,
+  0x31,
+  0x34,
+  0x70b9,
+  0x31,
+  0x35,
+  0x70b9,
+  0x31,
+  0x36,
+  0x70b9,
+  0x31,
+  0x37,
+  0x70b9,
+  0x31,
+  0x38,
+  0x70b9,
+  0x31,
+  0x39,
+  0x70b9,
+  0x32,
+  0x30,
+  0x70b9,
+  0x32,
+  0x31,
+  0x70b9,
+  0x32,
+  0x32,
+  0x70b9,
+  0x32,
+  0x33,
+  0x70b9,
+  0x32,
+  0x34,
+  0x70b9,
+  0x68,
+  0x50,
+  0x61,
+  0x64,
+  0x61,
+  0x41,
+  0x55,
+  0x62,
+  0x61,
+  0x72,
+  0x6f,
+  0x56,
+  0x70,
+  0x63,
+  0x64,
+  0x6d,
+  0x64,
+  0x6d,
+  0xb2,
+  0x64,
+  0x6d,
+  0xb3,
+  0x49,
+  0x55,
+  0x5e73,
+  0x6210,
+  0x662d,
+  0x548c,
+  0x5927,
+  0x6b63,
+  0x660e,
+  0x6cbb,
+  0x682a,
+  0x5f0f,
+  0x4f1a,
+  0x793e,
+  0x70,
+  0x41,
+  0x6e,
+  0x41,
+  0x3bc,
+  0x41,
+  0x6d,
+  0x41,
+  0x6b,
+  0x41,
+  0x4b,
+  0x42,
+  0x4d,
+  0x42,
+  0x47,
+  0x42,
+  0x63,
+  0x61,
+  0x6c,
+  0x6b,
+  0x63,
+  0x61,
+  0x6c,
+  0x70,
+  0x46,
+  0x6e,
+  0x46,
+  0x3bc,
+  0x46,
+  0x3bc,
+  0x67,
+  0x6d,
+  0x67,
+  0x6b,
+  0x67,
+  0x48,
+  0x7a,
+  0x6b,
+  0x48,
+  0x7a,
+  0x4d,
+  0x48,
+  0x7a,
+  0x47,
+  0x48,
+  0x7a,
+  0x54,
+  0x48,
+  0x7a,
+  0x3bc,
+  0x2113,
+  0x6d,
+  0x2113,
+  0x64,
+  0x2113,
+  0x6b,
+  0x2113,
+  0x66,
+  0x6d,
+  0x6e,
+  0x6d,
+  0x3bc,
+  0x6d,
+  0x6d,
+  0x6d,
+  0x63,
+  0x6d,
+  0x6b,
+  0x6d,
+  0x6d,
+  0x6d,
+  0xb2,
+  0x63,
+  0x6d,
+  0xb2,
+  0x6b,
+  0x6d,
+  0xb2,
+  0x6d,
+  0x6d,
+  0xb3,
+  0x63,
+  0x6d,
+  0xb3,
+  0x6b,
+  0x6d,
+  0xb3,
+  0x6d,
+  0x2215,
+  0x73,
+  0x6d,
+  0x2215,
+  0x73,
+  0xb2,
+  0x6b,
+  0x50,
+  0x61,
+  0x4d,
+  0x50,
+  0x61,
+  0x47,
+  0x50,
+  0x61,
+  0x72,
+  0x61,
+  0x64,
+  0x72,
+  0x61,
+  0x64,
+  0x2215,
+  0x73,
+  0x72,
+  0x61,
+  0x64,
+  0x2215,
+  0x73,
+  0xb2,
+  0x70,
+  0x73,
+  0x6e,
+  0x73,
+  0x3bc,
+  0x73,
+  0x6d,
+  0x73,
+  0x70,
+  0x56,
+  0x6e,
+  0x56,
+  0x3bc,
+  0x56,
+  0x6d,
+  0x56,
+  0x6b,
+  0x56,
+  0x4d,
+  0x56,
+  0x70,
+  0x57,
+  0x6e,
+  0x57,
+  0x3bc,
+  0x57,
+  0x6d,
+  0x57,
+  0x6b,
+  0x57,
+  0x4d,
+  0x57,
+  0x6b,
+  0x3a9,
+  0x4d,
+  0x3a9,
+  0x61,
+  0x2e,
+  0x6d,
+  0x2e,
+  0x42,
+  0x71,
+  0x63,
+  0x63,
+  0x43,
+  0x2215,
+  0x6b,
+  0x67,
+  0x43,
+  0x6f,
+  0x2e,
+  0x64,
+  0x42,
+  0x47,
+  0x79,
+  0x68,
+  0x61,
+  0x48,
+  0x50,
+  0x69,
+  0x6e,
+  0x4b,
+  0x4b,
+  0x4b,
+  0x4d,
+  0x6b,
+  0x74,
+  0x6c,
+  0x6d,
+  0x6c,
+  0x6e,
+  0x6c,
+  0x6f,
+  0x67,
+  0x6c,
+  0x78,
+  0x6d,
+  0x62,
+  0x6d,
+  0x69,
+  0x6c,
+  0x6d,
+  0x6f,
+  0x6c,
+  0x50,
+  0x48,
+  0x70,
+  0x2e,
+  0x6d,
+  0x2e,
+  0x50,
+  0x50,
+  0x4d,
+  0x50,
+  0x52,
+  0x53,
+  0x76,
+  0x57,
+  0x62,
+  0x56,
+  0x2215,
+  0x6d,
+  0x41,
+  0x2215,
+  0x6d,
+  0x31,
+  0x65e5,
+  0x32,
+  0x65e5,
+  0x33,
+  0x65e5,
+  0x34,
+  0x65e5,
+  0x35,
+  0x65e5,
+  0x36,
+  0x65e5,
+  0x37,
+  0x65e5,
+  0x38,
+  0x65e5,
+  0x39,
+  0x65e5,
+  0x31,
+  0x30,
+  0x65e5,
+  0x31,
+  0x31,
+  0x65e5,
+  0x31,
+  0x32,
+  0x65e5,
+  0x31,
+  0x33,
+  0x65e5,
+  0x31,
+  0x34,
+  0x65e5,
+  0x31,
+  0x35,
+  0x65e5,
+  0x31,
+  0x36,
+  0x65e5,
+  0x31,
+  0x37,
+  0x65e5,
+  0x31,
+  0x38,
+  0x65e5,
+  0x31,
+  0x39,
+  0x65e5,
+  0x32,
+  0x30,
+  0x65e5,
+  0x32,
+  0x31,
+  0x65e5,
+  0x32,
+  0x32,
+  0x65e5,
+  0x32,
+  0x33,
+  0x65e5,
+  0x32,
+  0x34,
+  0x65e5,
+  0x32,
+  0x35,
+  0x65e5,
+  0x32,
+  0x36,
+  0x65e5,
+  0x32,
+  0x37,
+  0x65e5,
+  0x32,
+  0x38,
+  0x65e5,
+  0x32,
+  0x39,
+  0x65e5,
+  0x33,
+  0x30,
+  0x65e5,
+  0x33,
+  0x31,
+  0x65e5,
+  0x67,
+  0x61,
+  0x6c,
+  0x8c48,
+  0x66f4,
+  0x8cc8,
+  0x6ed1,
+  0x4e32,
+  0x53e5,
+  0x5951,
+  0x5587,
+  0x5948,
+  0x61f6,
+  0x7669,
+  0x7f85,
+  0x863f,
+  0x87ba,
+  0x88f8,
+  0x908f,
+  0x6a02,
+  0x6d1b,
+  0x70d9,
+  0x73de,
+  0x843d,
+  0x916a,
+  0x99f1,
+  0x4e82,
+  0x5375,
+  0x6b04,
+  0x721b,
+  0x862d,
+  0x9e1e,
+  0x5d50,
+  0x6feb,
+  0x85cd,
+  0x8964,
+  0x62c9,
+  0x81d8,
+  0x881f,
+  0x5eca,
+  0x6717,
+  0x6d6a,
+  0x72fc,
+  0x90ce,
+  0x4f86,
+  0x51b7,
+  0x52de,
+  0x64c4,
+  0x6ad3,
+  0x7210,
+  0x76e7,
+  0x8606,
+  0x865c,
+  0x8def,
+  0x9732,
+  0x9b6f,
+  0x9dfa,
+  0x788c,
+  0x797f,
+  0x7da0,
+  0x83c9,
+  0x9304,
+  0x8ad6,
+  0x58df,
+  0x5f04,
+  0x7c60,
+  0x807e,
+  0x7262,
+  0x78ca,
+  0x8cc2,
+  0x96f7,
+  0x58d8,
+  0x5c62,
+  0x6a13,
+  0x6dda,
+  0x6f0f,
+  0x7d2f,
+  0x7e37,
+  0x964b,
+  0x52d2,
+  0x808b,
+  0x51dc,
+  0x51cc,
+  0x7a1c,
+  0x7dbe,
+  0x83f1,
+  0x9675,
+  0x8b80,
+  0x62cf,
+  0x8afe,
+  0x4e39,
+  0x5be7,
+  0x6012,
+  0x7387,
+  0x7570,
+  0x5317,
+  0x78fb,
+  0x4fbf,
+  0x5fa9,
+  0x4e0d,
+  0x6ccc,
+  0x6578,
+  0x7d22,
+  0x53c3,
+  0x585e,
+  0x7701,
+  0x8449,
+  0x8aaa,
+  0x6bba,
+  0x6c88,
+  0x62fe,
+  0x82e5,
+  0x63a0,
+  0x7565,
+  0x4eae,
+  0x5169,
+  0x51c9,
+  0x6881,
+  0x7ce7,
+  0x826f,
+  0x8ad2,
+  0x91cf,
+  0x52f5,
+  0x5442,
+  0x5eec,
+  0x65c5,
+  0x6ffe,
+  0x792a,
+  0x95ad,
+  0x9a6a,
+  0x9e97,
+  0x9ece,
+  0x66c6,
+  0x6b77,
+  0x8f62,
+  0x5e74,
+  0x6190,
+  0x6200,
+  0x649a,
+  0x6f23,
+  0x7149,
+  0x7489,
+  0x79ca,
+  0x7df4,
+  0x806f,
+  0x8f26,
+  0x84ee,
+  0x9023,
+  0x934a,
+  0x5217,
+  0x52a3,
+  0x54bd,
+  0x70c8,
+  0x88c2,
+  0x5ec9,
+  0x5ff5,
+  0x637b,
+  0x6bae,
+  0x7c3e,
+  0x7375,
+  0x4ee4,
+  0x56f9,
+  0x5dba,
+  0x601c,
+  0x73b2,
+  0x7469,
+  0x7f9a,
+  0x8046,
+  0x9234,
+  0x96f6,
+  0x9748,
+  0x9818,
+  0x4f8b,
+  0x79ae,
+  0x91b4,
+  0x96b8,
+  0x60e1,
+  0x4e86,
+  0x50da,
+  0x5bee,
+  0x5c3f,
+  0x6599,
+  0x71ce,
+  0x7642,
+  0x84fc,
+  0x907c,
+  0x6688,
+  0x962e,
+  0x5289,
+  0x677b,
+  0x67f3,
+  0x6d41,
+  0x6e9c,
+  0x7409,
+  0x7559,
+  0x786b,
+  0x7d10,
+  0x985e,
+  0x622e,
+  0x9678,
+  0x502b,
+  0x5d19,
+  0x6dea,
+  0x8f2a,
+  0x5f8b,
+  0x6144,
+  0x6817,
+  0x9686,
+  0x5229,
+  0x540f,
+  0x5c65,
+  0x6613,
+  0x674e,
+  0x68a8,
+  0x6ce5,
+  0x7406,
+  0x75e2,
+  0x7f79,
+  0x88cf,
+  0x88e1,
+  0x96e2,
+  0x533f,
+  0x6eba,
+  0x541d,
+  0x71d0,
+  0x7498,
+  0x85fa,
+  0x96a3,
+  0x9c57,
+  0x9e9f,
+  0x6797,
+  0x6dcb,
+  0x81e8,
+  0x7b20,
+  0x7c92,
+  0x72c0,
+  0x7099,
+  0x8b58,
+  0x4ec0,
+  0x8336,
+  0x523a,
+  0x5207,
+  0x5ea6,
+  0x62d3,
+  0x7cd6,
+  0x5b85,
+  0x6d1e,
+  0x66b4,
+  0x8f3b,
+  0x964d,
+  0x5ed3,
+  0x5140,
+  0x55c0,
+  0x585a,
+  0x6674,
+  0x51de,
+  0x732a,
+  0x76ca,
+  0x793c,
+  0x795e,
+  0x7965,
+  0x798f,
+  0x9756,
+  0x7cbe,
+  0x8612,
+  0x8af8,
+  0x9038,
+  0x90fd,
+  0x98ef,
+  0x98fc,
+  0x9928,
+  0x9db4,
+  0x4fae,
+  0x50e7,
+  0x514d,
+  0x52c9,
+  0x52e4,
+  0x5351,
+  0x559d,
+  0x5606,
+  0x5668,
+  0x5840,
+  0x58a8,
+  0x5c64,
+  0x6094,
+  0x6168,
+  0x618e,
+  0x61f2,
+  0x654f,
+  0x65e2,
+  0x6691,
+  0x6885,
+  0x6d77,
+  0x6e1a,
+  0x6f22,
+  0x716e,
+  0x722b,
+  0x7422,
+  0x7891,
+  0x7949,
+  0x7948,
+  0x7950,
+  0x7956,
+  0x798d,
+  0x798e,
+  0x7a40,
+  0x7a81,
+  0x7bc0,
+  0x7e09,
+  0x7e41,
+  0x7f72,
+  0x8005,
+  0x81ed,
+  0x8279,
+  0x8457,
+  0x8910,
+  0x8996,
+  0x8b01,
+  0x8b39,
+  0x8cd3,
+  0x8d08,
+  0x8fb6,
+  0x96e3,
+  0x97ff,
+  0x983b,
+  0x66,
+  0x66,
+  0x66,
+  0x69,
+  0x66,
+  0x6c,
+  0x66,
+  0x66,
+  0x6c,
+  0x17f,
+  0x74,
+  0x73,
+  0x74,
+  0x574,
+  0x576,
+  0x574,
+  0x565,
+  0x574,
+  0x56b,
+  0x57e,
+  0x576,
+  0x574,
+  0x56d,
+  0x5d9,
+  0x5b4,
+  0x5f2,
+  0x5b7,
+  0x5e2,
+  0x5d4,
+  0x5db,
+  0x5dc,
+  0x5dd,
+  0x5e8,
+  0x5ea,
+  0x5e9,
+  0x5c1,
+  0x5e9,
+  0x5c2,
+  0xfb49,
+  0x5c1,
+  0xfb49,
+  0x5c2,
+  0x5d0,
+  0x5b7,
+  0x5d0,
+  0x5b8,
+  0x5d0,
+  0x5bc,
+  0x5d1,
+  0x5bc,
+  0x5d2,
+  0x5bc,
+  0x5d3,
+  0x5bc,
+  0x5d4,
+  0x5bc,
+  0x5d5,
+  0x5bc,
+  0x5d6,
+  0x5bc,
+  0x5d8,
+  0x5bc,
+  0x5d9,
+  0x5bc,
+  0x5da,
+  0x5bc,
+  0x5db,
+  0x5bc,
+  0x5dc,
+  0x5bc,
+  0x5de,
+  0x5bc,
+  0x5e0,
+  0x5bc,
+  0x5e1,
+  0x5bc,
+  0x5e3,
+  0x5bc,
+  0x5e4,
+  0x5bc,
+  0x5e6,
+  0x5bc,
+  0x5e7,
+  0x5bc,
+  0x5e8,
+  0x5bc,
+  0x5e9,
+  0x5bc,
+  0x5ea,
+  0x5bc,
+  0x5d5,
+  0x5b9,
+  0x5d1,
+  0x5bf,
+  0x5db,
+  0x5bf,
+  0x5e4,
+  0x5bf,
+  0x5d0,
+  0x5dc,
+  0x671,
+  0x67b,
+  0x67e,
+  0x680,
+  0x67a,
+  0x67f,
+  0x679,
+  0x6a4,
+  0x6a6,
+  0x684,
+  0x683,
+  0x686,
+  0x687,
+  0x68d,
+  0x68c,
+  0x68e,
+  0x688,
+  0x698,
+  0x691,
+  0x6a9,
+  0x6af,
+  0x6b3,
+  0x6b1,
+  0x6ba,
+  0x6bb,
+  0x6c0,
+  0x6be,
+  0x6d3,
+  0x6ad,
+  0x6c6,
+  0x6c8,
+  0x677,
+  0x6cb,
+  0x6c5,
+  0x6c9,
+  0x6d0,
+  0x649,
+  0x626,
+  0x627,
+  0x626,
+  0x6d5,
+  0x626,
+  0x648,
+  0x626,
+  0x6c7,
+  0x626,
+  0x6c6,
+  0x626,
+  0x6c8,
+  0x626,
+  0x6d0,
+  0x626,
+  0x649,
+  0x6cc,
+  0x626,
+  0x62c,
+  0x626,
+  0x62d,
+  0x626,
+  0x645,
+  0x626,
+  0x64a,
+  0x628,
+  0x62c,
+  0x628,
+  0x62d,
+  0x628,
+  0x62e,
+  0x628,
+  0x645,
+  0x628,
+  0x649,
+  0x628,
+  0x64a,
+  0x62a,
+  0x62c,
+  0x62a,
+  0x62d,
+  0x62a,
+  0x62e,
+  0x62a,
+  0x645,
+  0x62a,
+  0x649,
+  0x62a,
+  0x64a,
+  0x62b,
+  0x62c,
+  0x62b,
+  0x645,
+  0x62b,
+  0x649,
+  0x62b,
+  0x64a,
+  0x62c,
+  0x62d,
+  0x62c,
+  0x645,
+  0x62d,
+  0x645,
+  0x62e,
+  0x62c,
+  0x62e,
+  0x62d,
+  0x62e,
+  0x645,
+  0x633,
+  0x62c,
+  0x633,
+  0x62d,
+  0x633,
+  0x62e,
+  0x633,
+  0x645,
+  0x635,
+  0x62d,
+  0x635,
+  0x645,
+  0x636,
+  0x62c,
+  0x636,
+  0x62d,
+  0x636,
+  0x62e,
+  0x636,
+  0x645,
+  0x637,
+  0x62d,
+  0x637,
+  0x645,
+  0x638,
+  0x645,
+  0x639,
+  0x62c,
+  0x639,
+  0x645,
+  0x63a,
+  0x62c,
+  0x63a,
+  0x645,
+  0x641,
+  0x62c,
+  0x641,
+  0x62d,
+  0x641,
+  0x62e,
+  0x641,
+  0x645,
+  0x641,
+  0x649,
+  0x641,
+  0x64a,
+  0x642,
+  0x62d,
+  0x642,
+  0x645,
+  0x642,
+  0x649,
+  0x642,
+  0x64a,
+  0x643,
+  0x627,
+  0x643,
+  0x62c,
+  0x643,
+  0x62d,
+  0x643,
+  0x62e,
+  0x643,
+  0x644,
+  0x643,
+  0x645,
+  0x643,
+  0x649,
+  0x643,
+  0x64a,
+  0x644,
+  0x62c,
+  0x644,
+  0x62d,
+  0x644,
+  0x62e,
+  0x644,
+  0x645,
+  0x644,
+  0x649,
+  0x644,
+  0x64a,
+  0x645,
+  0x62c,
+  0x645,
+  0x645,
+  0x645,
+  0x649,
+  0x645,
+  0x64a,
+  0x646,
+  0x62c,
+  0x646,
+  0x62d,
+  0x646,
+  0x62e,
+  0x646,
+  0x645,
+  0x646,
+  0x649,
+  0x646,
+  0x64a,
+  0x647,
+  0x62c,
+  0x647,
+  0x645,
+  0x647,
+  0x649,
+  0x647,
+  0x64a,
+  0x64a,
+  0x62d,
+  0x64a,
+  0x62e,
+  0x64a,
+  0x649,
+  0x630,
+  0x670,
+  0x631,
+  0x670,
+  0x649,
+  0x670,
+  0x20,
+  0x64c,
+  0x651,
+  0x20,
+  0x64d,
+  0x651,
+  0x20,
+  0x64e,
+  0x651,
+  0x20,
+  0x64f,
+  0x651,
+  0x20,
+  0x650,
+  0x651,
+  0x20,
+  0x651,
+  0x670,
+  0x626,
+  0x631,
+  0x626,
+  0x632,
+  0x626,
+  0x646,
+  0x628,
+  0x631,
+  0x628,
+  0x632,
+  0x628,
+  0x646,
+  0x62a,
+  0x631,
+  0x62a,
+  0x632,
+  0x62a,
+  0x646,
+  0x62b,
+  0x631,
+  0x62b,
+  0x632,
+  0x62b,
+  0x646,
+  0x645,
+  0x627,
+  0x646,
+  0x631,
+  0x646,
+  0x632,
+  0x646,
+  0x646,
+  0x64a,
+  0x631,
+  0x64a,
+  0x632,
+  0x626,
+  0x62e,
+  0x626,
+  0x647,
+  0x628,
+  0x647,
+  0x62a,
+  0x647,
+  0x635,
+  0x62e,
+  0x644,
+  0x647,
+  0x646,
+  0x647,
+  0x647,
+  0x670,
+  0x62b,
+  0x647,
+  0x633,
+  0x647,
+  0x634,
+  0x645,
+  0x634,
+  0x647,
+  0x640,
+  0x64e,
+  0x651,
+  0x640,
+  0x64f,
+  0x651,
+  0x640,
+  0x650,
+  0x651,
+  0x637,
+  0x649,
+  0x637,
+  0x64a,
+  0x639,
+  0x649,
+  0x639,
+  0x64a,
+  0x63a,
+  0x649,
+  0x63a,
+  0x64a,
+  0x633,
+  0x649,
+  0x633,
+  0x64a,
+  0x634,
+  0x649,
+  0x634,
+  0x64a,
+  0x62d,
+  0x649,
+  0x62c,
+  0x649,
+  0x62c,
+  0x64a,
+  0x62e,
+  0x649,
+  0x635,
+  0x649,
+  0x635,
+  0x64a,
+  0x636,
+  0x649,
+  0x636,
+  0x64a,
+  0x634,
+  0x62c,
+  0x634,
+  0x62d,
+  0x634,
+  0x62e,
+  0x634,
+  0x631,
+  0x633,
+  0x631,
+  0x635,
+  0x631,
+  0x636,
+  0x631,
+  0x627,
+  0x64b,
+  0x62a,
+  0x62c,
+  0x645,
+  0x62a,
+  0x62d,
+  0x62c,
+  0x62a,
+  0x62d,
+  0x645,
+  0x62a,
+  0x62e,
+  0x645,
+  0x62a,
+  0x645,
+  0x62c,
+  0x62a,
+  0x645,
+  0x62d,
+  0x62a,
+  0x645,
+  0x62e,
+  0x62d,
+  0x645,
+  0x64a,
+  0x62d,
+  0x645,
+  0x649,
+  0x633,
+  0x62d,
+  0x62c,
+  0x633,
+  0x62c,
+  0x62d,
+  0x633,
+  0x62c,
+  0x649,
+  0x633,
+  0x645,
+  0x62d,
+  0x633,
+  0x645,
+  0x62c,
+  0x633,
+  0x645,
+  0x645,
+  0x635,
+  0x62d,
+  0x62d,
+  0x635,
+  0x645,
+  0x645,
+  0x634,
+  0x62d,
+  0x645,
+  0x634,
+  0x62c,
+  0x64a,
+  0x634,
+  0x645,
+  0x62e,
+  0x634,
+  0x645,
+  0x645,
+  0x636,
+  0x62d,
+  0x649,
+  0x636,
+  0x62e,
+  0x645,
+  0x637,
+  0x645,
+  0x62d,
+  0x637,
+  0x645,
+  0x645,
+  0x637,
+  0x645,
+  0x64a,
+  0x639,
+  0x62c,
+  0x645,
+  0x639,
+  0x645,
+  0x645,
+  0x639,
+  0x645,
+  0x649,
+  0x63a,
+  0x645,
+  0x645,
+  0x63a,
+  0x645,
+  0x64a,
+  0x63a,
+  0x645,
+  0x649,
+  0x641,
+  0x62e,
+  0x645,
+  0x642,
+  0x645,
+  0x62d,
+  0x642,
+  0x645,
+  0x645,
+  0x644,
+  0x62d,
+  0x645,
+  0x644,
+  0x62d,
+  0x64a,
+  0x644,
+  0x62d,
+  0x649,
+  0x644,
+  0x62c,
+  0x62c,
+  0x644,
+  0x62e,
+  0x645,
+  0x644,
+  0x645,
+  0x62d,
+  0x645,
+  0x62d,
+  0x62c,
+  0x645,
+  0x62d,
+  0x64a,
+  0x645,
+  0x62c,
+  0x62d,
+  0x645,
+  0x62e,
+  0x645,
+  0x645,
+  0x62c,
+  0x62e,
+  0x647,
+  0x645,
+  0x62c,
+  0x647,
+  0x645,
+  0x645,
+  0x646,
+  0x62d,
+  0x645,
+  0x646,
+  0x62d,
+  0x649,
+  0x646,
+  0x62c,
+  0x645,
+  0x646,
+  0x62c,
+  0x649,
+  0x646,
+  0x645,
+  0x64a,
+  0x646,
+  0x645,
+  0x649,
+  0x64a,
+  0x645,
+  0x645,
+  0x628,
+  0x62e,
+  0x64a,
+  0x62a,
+  0x62c,
+  0x64a,
+  0x62a,
+  0x62c,
+  0x649,
+  0x62a,
+  0x62e,
+  0x64a,
+  0x62a,
+  0x62e,
+  0x649,
+  0x62a,
+  0x645,
+  0x64a,
+  0x62a,
+  0x645,
+  0x649,
+  0x62c,
+  0x645,
+  0x64a,
+  0x62c,
+  0x62d,
+  0x649,
+  0x62c,
+  0x645,
+  0x649,
+  0x633,
+  0x62e,
+  0x649,
+  0x635,
+  0x62d,
+  0x64a,
+  0x634,
+  0x62d,
+  0x64a,
+  0x636,
+  0x62d,
+  0x64a,
+  0x644,
+  0x62c,
+  0x64a,
+  0x644,
+  0x645,
+  0x64a,
+  0x64a,
+  0x62c,
+  0x64a,
+  0x64a,
+  0x645,
+  0x64a,
+  0x645,
+  0x645,
+  0x64a,
+  0x642,
+  0x645,
+  0x64a,
+  0x646,
+  0x62d,
+  0x64a,
+  0x639,
+  0x645,
+  0x64a,
+  0x643,
+  0x645,
+  0x64a,
+  0x646,
+  0x62c,
+  0x62d,
+  0x645,
+  0x62e,
+  0x64a,
+  0x644,
+  0x62c,
+  0x645,
+  0x643,
+  0x645,
+  0x645,
+  0x62c,
+  0x62d,
+  0x64a,
+  0x62d,
+  0x62c,
+  0x64a,
+  0x645,
+  0x62c,
+  0x64a,
+  0x641,
+  0x645,
+  0x64a,
+  0x628,
+  0x62d,
+  0x64a,
+  0x633,
+  0x62e,
+  0x64a,
+  0x646,
+  0x62c,
+  0x64a,
+  0x635,
+  0x644,
+  0x6d2,
+  0x642,
+  0x644,
+  0x6d2,
+  0x627,
+  0x644,
+  0x644,
+  0x647,
+  0x627,
+  0x643,
+  0x628,
+  0x631,
+  0x645,
+  0x62d,
+  0x645,
+  0x62f,
+  0x635,
+  0x644,
+  0x639,
+  0x645,
+  0x631,
+  0x633,
+  0x648,
+  0x644,
+  0x639,
+  0x644,
+  0x64a,
+  0x647,
+  0x648,
+  0x633,
+  0x644,
+  0x645,
+  0x635,
+  0x644,
+  0x649,
+  0x635,
+  0x644,
+  0x649,
+  0x20,
+  0x627,
+  0x644,
+  0x644,
+  0x647,
+  0x20,
+  0x639,
+  0x644,
+  0x64a,
+  0x647,
+  0x20,
+  0x648,
+  0x633,
+  0x644,
+  0x645,
+  0x62c,
+  0x644,
+  0x20,
+  0x62c,
+  0x644,
+  0x627,
+  0x644,
+  0x647,
+  0x631,
+  0x6cc,
+  0x627,
+  0x644,
+  0x2025,
+  0x2014,
+  0x2013,
+  0x5f,
+  0x7b,
+  0x7d,
+  0x3014,
+  0x3015,
+  0x3010,
+  0x3011,
+  0x300a,
+  0x300b,
+  0x300c,
+  0x300d,
+  0x300e,
+  0x300f,
+  0x5b,
+  0x5d,
+  0x203e,
+  0x2c,
+  0x3001,
+  0x23,
+  0x26,
+  0x2a,
+  0x2d,
+  0x5c,
+  0x24,
+  0x25,
+  0x40,
+  0x20,
+  0x64b,
+  0x640,
+  0x64b,
+  0x640,
+  0x651,
+  0x20,
+  0x652,
+  0x640,
+  0x652,
+  0x621,
+  0x622,
+  0x623,
+  0x624,
+  0x625,
+  0x629,
+  0x644,
+  0x622,
+  0x644,
+  0x623,
+  0x644,
+  0x625,
+  0x22,
+  0x27,
+  0x5e,
+  0x7c,
+  0x7e,
+  0x2985,
+  0x2986,
+  0x3002,
+  0x30fb,
+  0x30a5,
+  0x30e3,
+  0x3164,
+  0x3131,
+  0x3132,
+  0x3133,
+  0x3134,
+  0x3135,
+  0x3136,
+  0x3137,
+  0x3138,
+  0x3139,
+  0x313a,
+  0x313b,
+  0x313c,
+  0x313d,
+  0x313e,
+  0x313f,
+  0x3140,
+  0x3141,
+  0x3142,
+  0x3143,
+  0x3144,
+  0x3145,
+  0x3146,
+  0x3147,
+  0x3148,
+  0x3149,
+  0x314a,
+  0x314b,
+  0x314c,
+  0x314d,
+  0x314e,
+  0x314f,
+  0x3150,
+  0x3151,
+  0x3152,
+  0x3153,
+  0x3154,
+  0x3155,
+  0x3156,
+  0x3157,
+  0x3158,
+  0x3159,
+  0x315a,
+  0x315b,
+  0x315c,
+  0x315d,
+  0x315e,
+  0x315f,
+  0x3160,
+  0x3161,
+  0x3162,
+  0x3163,
+  0xa2,
+  0xa3,
+  0xac,
+  0xaf,
+  0xa6,
+  0xa5,
+  0x20a9,
+  0x2502,
+  0x2191,
+  0x2193,
+  0x25a0,
+  0x25cb,
+  0x1d157,
+  0x1d165,
+  0x1d158,
+  0x1d165,
+  0x1d15f,
+  0x1d16e,
+  0x1d15f,
+  0x1d16f,
+  0x1d15f,
+  0x1d170,
+  0x1d15f,
+  0x1d171,
+  0x1d15f,
+  0x1d172,
+  0x1d1b9,
+  0x1d165,
+  0x1d1ba,
+  0x1d165,
+  0x1d1bb,
+  0x1d16e,
+  0x1d1bc,
+  0x1d16e,
+  0x1d1bb,
+  0x1d16f,
+  0x1d1bc,
+  0x1d16f,
+  0x392,
+  0x394,
+  0x396,
+  0x39a,
+  0x39b,
+  0x39c,
+  0x39d,
+  0x39e,
+  0x3f4,
+  0x3a4,
+  0x3a6,
+  0x3a7,
+  0x3a8,
+  0x2207,
+  0x3b6,
+  0x3bb,
+  0x3bd,
+  0x3be,
+  0x3c3,
+  0x3c4,
+  0x3c8,
+  0x2202,
+  0x3f5,
+  0x3d1,
+  0x3f0,
+  0x3d5,
+  0x3f1,
+  0x3d6,
+  0x4e3d,
+  0x4e38,
+  0x4e41,
+  0x20122,
+  0x4f60,
+  0x4fbb,
+  0x5002,
+  0x507a,
+  0x5099,
+  0x50cf,
+  0x349e,
+  0x2063a,
+  0x5154,
+  0x5164,
+  0x5177,
+  0x2051c,
+  0x34b9,
+  0x5167,
+  0x518d,
+  0x2054b,
+  0x5197,
+  0x51a4,
+  0x4ecc,
+  0x51ac,
+  0x51b5,
+  0x291df,
+  0x5203,
+  0x34df,
+  0x523b,
+  0x5246,
+  0x5272,
+  0x5277,
+  0x3515,
+  0x52c7,
+  0x52fa,
+  0x5305,
+  0x5306,
+  0x5349,
+  0x535a,
+  0x5373,
+  0x537d,
+  0x537f,
+  0x20a2c,
+  0x7070,
+  0x53ca,
+  0x53df,
+  0x20b63,
+  0x53eb,
+  0x53f1,
+  0x5406,
+  0x549e,
+  0x5438,
+  0x5448,
+  0x5468,
+  0x54a2,
+  0x54f6,
+  0x5510,
+  0x5553,
+  0x5563,
+  0x5584,
+  0x5599,
+  0x55ab,
+  0x55b3,
+  0x55c2,
+  0x5716,
+  0x5717,
+  0x5651,
+  0x5674,
+  0x58ee,
+  0x57ce,
+  0x57f4,
+  0x580d,
+  0x578b,
+  0x5832,
+  0x5831,
+  0x58ac,
+  0x214e4,
+  0x58f2,
+  0x58f7,
+  0x5906,
+  0x591a,
+  0x5922,
+  0x5962,
+  0x216a8,
+  0x216ea,
+  0x59ec,
+  0x5a1b,
+  0x5a27,
+  0x59d8,
+  0x5a66,
+  0x36ee,
+  0x36fc,
+  0x5b08,
+  0x5b3e,
+  0x219c8,
+  0x5bc3,
+  0x5bd8,
+  0x5bf3,
+  0x21b18,
+  0x5bff,
+  0x5c06,
+  0x5f53,
+  0x3781,
+  0x5c60,
+  0x5cc0,
+  0x5c8d,
+  0x21de4,
+  0x5d43,
+  0x21de6,
+  0x5d6e,
+  0x5d6b,
+  0x5d7c,
+  0x5de1,
+  0x5de2,
+  0x382f,
+  0x5dfd,
+  0x5e28,
+  0x5e3d,
+  0x5e69,
+  0x3862,
+  0x22183,
+  0x387c,
+  0x5eb0,
+  0x5eb3,
+  0x5eb6,
+  0x2a392,
+  0x22331,
+  0x8201,
+  0x5f22,
+  0x38c7,
+  0x232b8,
+  0x261da,
+  0x5f62,
+  0x5f6b,
+  0x38e3,
+  0x5f9a,
+  0x5fcd,
+  0x5fd7,
+  0x5ff9,
+  0x6081,
+  0x393a,
+  0x391c,
+  0x226d4,
+  0x60c7,
+  0x6148,
+  0x614c,
+  0x614e,
+  0x617a,
+  0x61b2,
+  0x61a4,
+  0x61af,
+  0x61de,
+  0x621b,
+  0x625d,
+  0x62b1,
+  0x62d4,
+  0x6350,
+  0x22b0c,
+  0x633d,
+  0x62fc,
+  0x6368,
+  0x6383,
+  0x63e4,
+  0x22bf1,
+  0x6422,
+  0x63c5,
+  0x63a9,
+  0x3a2e,
+  0x6469,
+  0x647e,
+  0x649d,
+  0x6477,
+  0x3a6c,
+  0x656c,
+  0x2300a,
+  0x65e3,
+  0x66f8,
+  0x6649,
+  0x3b19,
+  0x3b08,
+  0x3ae4,
+  0x5192,
+  0x5195,
+  0x6700,
+  0x669c,
+  0x80ad,
+  0x43d9,
+  0x671b,
+  0x6721,
+  0x675e,
+  0x6753,
+  0x233c3,
+  0x3b49,
+  0x67fa,
+  0x6785,
+  0x6852,
+  0x2346d,
+  0x688e,
+  0x681f,
+  0x6914,
+  0x3b9d,
+  0x6942,
+  0x69a3,
+  0x69ea,
+  0x6aa8,
+  0x236a3,
+  0x6adb,
+  0x3c18,
+  0x6b21,
+  0x238a7,
+  0x6b54,
+  0x3c4e,
+  0x6b72,
+  0x6b9f,
+  0x6bbb,
+  0x23a8d,
+  0x21d0b,
+  0x23afa,
+  0x6c4e,
+  0x23cbc,
+  0x6cbf,
+  0x6ccd,
+  0x6c67,
+  0x6d16,
+  0x6d3e,
+  0x6d69,
+  0x6d78,
+  0x6d85,
+  0x23d1e,
+  0x6d34,
+  0x6e2f,
+  0x6e6e,
+  0x3d33,
+  0x6ecb,
+  0x6ec7,
+  0x23ed1,
+  0x6df9,
+  0x6f6e,
+  0x23f5e,
+  0x23f8e,
+  0x6fc6,
+  0x7039,
+  0x701e,
+  0x701b,
+  0x3d96,
+  0x704a,
+  0x707d,
+  0x7077,
+  0x70ad,
+  0x20525,
+  0x7145,
+  0x24263,
+  0x719c,
+  0x243ab,
+  0x7228,
+  0x7235,
+  0x7250,
+  0x24608,
+  0x7280,
+  0x7295,
+  0x24735,
+  0x24814,
+  0x737a,
+  0x738b,
+  0x3eac,
+  0x73a5,
+  0x3eb8,
+  0x7447,
+  0x745c,
+  0x7471,
+  0x7485,
+  0x74ca,
+  0x3f1b,
+  0x7524,
+  0x24c36,
+  0x753e,
+  0x24c92,
+  0x2219f,
+  0x7610,
+  0x24fa1,
+  0x24fb8,
+  0x25044,
+  0x3ffc,
+  0x4008,
+  0x76f4,
+  0x250f3,
+  0x250f2,
+  0x25119,
+  0x25133,
+  0x771e,
+  0x771f,
+  0x774a,
+  0x4039,
+  0x778b,
+  0x4046,
+  0x4096,
+  0x2541d,
+  0x784e,
+  0x78cc,
+  0x40e3,
+  0x25626,
+  0x2569a,
+  0x256c5,
+  0x79eb,
+  0x412f,
+  0x7a4a,
+  0x7a4f,
+  0x2597c,
+  0x25aa7,
+  0x7aee,
+  0x4202,
+  0x25bab,
+  0x7bc6,
+  0x7bc9,
+  0x4227,
+  0x25c80,
+  0x7cd2,
+  0x42a0,
+  0x7ce8,
+  0x7ce3,
+  0x7d00,
+  0x25f86,
+  0x7d63,
+  0x4301,
+  0x7dc7,
+  0x7e02,
+  0x7e45,
+  0x4334,
+  0x26228,
+  0x26247,
+  0x4359,
+  0x262d9,
+  0x7f7a,
+  0x2633e,
+  0x7f95,
+  0x7ffa,
+  0x264da,
+  0x26523,
+  0x8060,
+  0x265a8,
+  0x8070,
+  0x2335f,
+  0x43d5,
+  0x80b2,
+  0x8103,
+  0x440b,
+  0x813e,
+  0x5ab5,
+  0x267a7,
+  0x267b5,
+  0x23393,
+  0x2339c,
+  0x8204,
+  0x8f9e,
+  0x446b,
+  0x8291,
+  0x828b,
+  0x829d,
+  0x52b3,
+  0x82b1,
+  0x82b3,
+  0x82bd,
+  0x82e6,
+  0x26b3c,
+  0x831d,
+  0x8363,
+  0x83ad,
+  0x8323,
+  0x83bd,
+  0x83e7,
+  0x8353,
+  0x83ca,
+  0x83cc,
+  0x83dc,
+  0x26c36,
+  0x26d6b,
+  0x26cd5,
+  0x452b,
+  0x84f1,
+  0x84f3,
+  0x8516,
+  0x273ca,
+  0x8564,
+  0x26f2c,
+  0x455d,
+  0x4561,
+  0x26fb1,
+  0x270d2,
+  0x456b,
+  0x8650,
+  0x8667,
+  0x8669,
+  0x86a9,
+  0x8688,
+  0x870e,
+  0x86e2,
+  0x8779,
+  0x8728,
+  0x876b,
+  0x8786,
+  0x45d7,
+  0x87e1,
+  0x8801,
+  0x45f9,
+  0x8860,
+  0x27667,
+  0x88d7,
+  0x88de,
+  0x4635,
+  0x88fa,
+  0x34bb,
+  0x278ae,
+  0x27966,
+  0x46be,
+  0x46c7,
+  0x8aa0,
+  0x8aed,
+  0x8b8a,
+  0x27ca8,
+  0x8cab,
+  0x8cc1,
+  0x8d1b,
+  0x8d77,
+  0x27f2f,
+  0x20804,
+  0x8dcb,
+  0x8dbc,
+  0x8df0,
+  0x208de,
+  0x8ed4,
+  0x8f38,
+  0x285d2,
+  0x285ed,
+  0x9094,
+  0x90f1,
+  0x9111,
+  0x2872e,
+  0x911b,
+  0x9238,
+  0x92d7,
+  0x92d8,
+  0x927c,
+  0x93f9,
+  0x9415,
+  0x28bfa,
+  0x958b,
+  0x4995,
+  0x95b7,
+  0x28d77,
+  0x49e6,
+  0x96c3,
+  0x5db2,
+  0x9723,
+  0x29145,
+  0x2921a,
+  0x4a6e,
+  0x4a76,
+  0x97e0,
+  0x2940a,
+  0x4ab2,
+  0x29496,
+  0x980b,
+  0x9829,
+  0x295b6,
+  0x98e2,
+  0x4b33,
+  0x9929,
+  0x99a7,
+  0x99c2,
+  0x99fe,
+  0x4bce,
+  0x29b30,
+  0x9b12,
+  0x9c40,
+  0x9cfd,
+  0x4cce,
+  0x4ced,
+  0x9d67,
+  0x2a0ce,
+  0x4cf8,
+  0x2a105,
+  0x2a20e,
+  0x2a291,
+  0x4d56,
+  0x9efe,
+  0x9f05,
+  0x9f0f,
+  0x9f16,
+  0x2a600,
+};
+
+const struct canon_node _wind_canon_table[] = {
+  {0x0, 0, 3, 0},
+  {0x0, 0, 10, 3},
+  {0x0, 0, 16, 13},
+  {0x0, 0, 15, 29},
+  {0x0, 1, 14, 44},
+  {0x2f993, 16, 16, 57},
+  {0x0, 0, 16, 57},
+  {0x0, 0, 16, 73},
+  {0x0, 8, 16, 89},
+  {0xf942, 16, 16, 97},
+  {0x2f994, 16, 16, 97},
+  {0x0, 0, 16, 97},
+  {0x0, 9, 15, 113},
+  {0x0, 5, 6, 119},
+  {0x2f9ef, 16, 16, 120},
+  {0x0, 0, 16, 120},
+  {0x0, 0, 16, 136},
+  {0x0, 0, 16, 152},
+  {0x0, 0, 1, 168},
+  {0x0, 0, 1, 169},
+  {0x0, 3, 4, 170},
+  {0x0, 4, 5, 171},
+  {0x0, 5, 6, 172},
+  {0x1f94, 16, 16, 173},
+  {0x0, 0, 16, 173},
+  {0x0, 0, 12, 189},
+  {0x0, 10, 12, 201},
+  {0x2f8f6, 16, 16, 203},
+  {0xf970, 16, 16, 203},
+  {0x0, 0, 16, 203},
+  {0x0, 2, 14, 219},
+  {0x0, 2, 6, 231},
+  {0x0, 0, 1, 235},
+  {0x0, 0, 1, 236},
+  {0x0, 6, 7, 237},
+  {0x0, 5, 6, 238},
+  {0x0, 4, 5, 239},
+  {0x6c0, 16, 16, 240},
+  {0x0, 0, 16, 240},
+  {0x0, 0, 13, 256},
+  {0x0, 9, 10, 269},
+  {0xf9ae, 16, 16, 270},
+  {0x0, 0, 16, 270},
+  {0x0, 2, 16, 286},
+  {0x0, 15, 16, 300},
+  {0xfa69, 16, 16, 301},
+  {0x0, 0, 11, 301},
+  {0x0, 1, 16, 312},
+  {0x0, 3, 14, 327},
+  {0x0, 6, 7, 338},
+  {0x2f9a4, 16, 16, 339},
+  {0x0, 4, 15, 339},
+  {0x0, 9, 10, 350},
+  {0xf9be, 16, 16, 351},
+  {0x0, 1, 12, 351},
+  {0x0, 7, 8, 362},
+  {0x2f864, 16, 16, 363},
+  {0x0, 0, 13, 363},
+  {0x0, 0, 1, 376},
+  {0x0, 0, 1, 377},
+  {0x0, 3, 4, 378},
+  {0x0, 4, 5, 379},
+  {0x0, 5, 6, 380},
+  {0x1fc2, 16, 16, 381},
+  {0x0, 0, 16, 381},
+  {0x0, 0, 16, 397},
+  {0x0, 1, 16, 413},
+  {0x0, 0, 1, 428},
+  {0x0, 3, 4, 429},
+  {0x0, 0, 1, 430},
+  {0x0, 9, 10, 431},
+  {0x0, 9, 10, 432},
+  {0x3065, 16, 16, 433},
+  {0x0, 0, 3, 433},
+  {0x0, 0, 12, 436},
+  {0x0, 3, 14, 448},
+  {0x0, 0, 1, 459},
+  {0x0, 0, 1, 460},
+  {0x0, 3, 4, 461},
+  {0x0, 3, 4, 462},
+  {0x0, 8, 9, 463},
+  {0x2244, 16, 16, 464},
+  {0x0, 0, 15, 464},
+  {0x0, 0, 12, 479},
+  {0x0, 0, 1, 491},
+  {0x0, 0, 1, 492},
+  {0x0, 3, 4, 493},
+  {0x0, 0, 1, 494},
+  {0x0, 8, 9, 495},
+  {0x1e7b, 16, 16, 496},
+  {0x0, 1, 16, 496},
+  {0x0, 0, 1, 511},
+  {0x0, 3, 4, 512},
+  {0x0, 0, 1, 513},
+  {0x0, 9, 10, 514},
+  {0x0, 9, 10, 515},
+  {0x30ba, 16, 16, 516},
+  {0x2f995, 16, 16, 516},
+  {0x0, 0, 15, 516},
+  {0x0, 0, 15, 531},
+  {0x0, 0, 1, 546},
+  {0x0, 0, 1, 547},
+  {0x0, 3, 4, 548},
+  {0x0, 0, 1, 549},
+  {0x0, 8, 9, 550},
+  {0x4df, 16, 16, 551},
+  {0x0, 0, 16, 551},
+  {0x0, 7, 8, 567},
+  {0x2f9d7, 16, 16, 568},
+  {0x0, 0, 16, 568},
+  {0x0, 14, 15, 584},
+  {0x2f86b, 16, 16, 585},
+  {0xf94a, 16, 16, 585},
+  {0x0, 4, 14, 585},
+  {0x0, 9, 13, 595},
+  {0x0, 0, 1, 599},
+  {0x0, 0, 1, 600},
+  {0x0, 13, 14, 601},
+  {0x0, 12, 13, 602},
+  {0x0, 10, 11, 603},
+  {0xddd, 16, 16, 604},
+  {0x0, 2, 16, 604},
+  {0x0, 1, 15, 618},
+  {0xf91a, 16, 16, 632},
+  {0x0, 0, 16, 632},
+  {0x0, 1, 4, 648},
+  {0x0, 9, 10, 651},
+  {0x2f943, 16, 16, 652},
+  {0x0, 0, 16, 652},
+  {0x0, 10, 11, 668},
+  {0x0, 8, 9, 669},
+  {0x2f9d3, 16, 16, 670},
+  {0x0, 3, 16, 670},
+  {0x0, 1, 16, 683},
+  {0x0, 0, 1, 698},
+  {0x0, 0, 1, 699},
+  {0x0, 3, 4, 700},
+  {0x0, 0, 3, 701},
+  {0x0, 1, 13, 704},
+  {0x10c, 16, 16, 716},
+  {0x0, 1, 16, 716},
+  {0x0, 1, 2, 731},
+  {0xf958, 16, 16, 732},
+  {0x0, 0, 1, 732},
+  {0x0, 0, 1, 733},
+  {0x0, 3, 4, 734},
+  {0x0, 0, 1, 735},
+  {0x0, 0, 9, 736},
+  {0x4e5, 16, 16, 745},
+  {0x439, 16, 16, 745},
+  {0x4e3, 16, 16, 745},
+  {0x0, 2, 15, 745},
+  {0x0, 12, 13, 758},
+  {0x2f8c7, 16, 16, 759},
+  {0x0, 0, 1, 759},
+  {0x0, 3, 4, 760},
+  {0x0, 0, 1, 761},
+  {0x0, 9, 10, 762},
+  {0x0, 9, 10, 763},
+  {0x30b4, 16, 16, 764},
+  {0x45d, 16, 16, 764},
+  {0x0, 0, 16, 764},
+  {0x0, 0, 1, 780},
+  {0x0, 0, 1, 781},
+  {0x0, 3, 4, 782},
+  {0x0, 0, 3, 783},
+  {0x0, 0, 10, 786},
+  {0x1ee8, 16, 16, 796},
+  {0x0, 0, 16, 796},
+  {0x0, 0, 1, 812},
+  {0x0, 0, 1, 813},
+  {0x0, 3, 4, 814},
+  {0x0, 0, 4, 815},
+  {0x0, 3, 14, 819},
+  {0x1eb9, 16, 16, 830},
+  {0x1eee, 16, 16, 830},
+  {0x229, 16, 16, 830},
+  {0x1eec, 16, 16, 830},
+  {0x119, 16, 16, 830},
+  {0x2fa07, 16, 16, 830},
+  {0x10a, 16, 16, 830},
+  {0x106, 16, 16, 830},
+  {0x108, 16, 16, 830},
+  {0x0, 1, 16, 830},
+  {0x0, 9, 10, 845},
+  {0x2f90e, 16, 16, 846},
+  {0x0, 0, 14, 846},
+  {0x0, 1, 16, 860},
+  {0x0, 0, 1, 875},
+  {0x0, 0, 1, 876},
+  {0x0, 3, 4, 877},
+  {0x0, 0, 2, 878},
+  {0x0, 4, 5, 880},
+  {0x1f59, 16, 16, 881},
+  {0x0, 6, 12, 881},
+  {0x0, 14, 15, 887},
+  {0x2f9f8, 16, 16, 888},
+  {0x0, 0, 11, 888},
+  {0x0, 0, 1, 899},
+  {0x0, 0, 1, 900},
+  {0x0, 3, 4, 901},
+  {0x0, 0, 4, 902},
+  {0x0, 1, 2, 906},
+  {0x212, 16, 16, 907},
+  {0x0, 0, 1, 907},
+  {0x0, 0, 1, 908},
+  {0x0, 3, 4, 909},
+  {0x0, 0, 3, 910},
+  {0x0, 1, 12, 913},
+  {0x20f, 16, 16, 924},
+  {0x0, 2, 14, 924},
+  {0x0, 0, 1, 936},
+  {0x0, 0, 1, 937},
+  {0x0, 3, 4, 938},
+  {0x0, 3, 4, 939},
+  {0x0, 8, 9, 940},
+  {0x22e1, 16, 16, 941},
+  {0x0, 0, 15, 941},
+  {0x0, 13, 14, 956},
+  {0xf967, 16, 16, 957},
+  {0x1e19, 16, 16, 957},
+  {0x0, 1, 16, 957},
+  {0x0, 10, 11, 972},
+  {0xf9f0, 16, 16, 973},
+  {0x0, 0, 15, 973},
+  {0x0, 2, 3, 988},
+  {0x2f807, 16, 16, 989},
+  {0x0, 3, 15, 989},
+  {0x0, 13, 14, 1001},
+  {0x2f8b9, 16, 16, 1002},
+  {0x0, 0, 1, 1002},
+  {0x0, 0, 1, 1003},
+  {0x0, 3, 4, 1004},
+  {0x0, 0, 4, 1005},
+  {0x0, 0, 16, 1009},
+  {0x1d0, 16, 16, 1025},
+  {0x0, 0, 14, 1025},
+  {0x0, 9, 10, 1039},
+  {0x2f974, 16, 16, 1040},
+  {0x0, 1, 12, 1040},
+  {0x0, 1, 5, 1051},
+  {0x0, 5, 6, 1055},
+  {0x2f91b, 16, 16, 1056},
+  {0x0, 0, 1, 1056},
+  {0x0, 0, 1, 1057},
+  {0x0, 3, 4, 1058},
+  {0x0, 3, 4, 1059},
+  {0x0, 8, 9, 1060},
+  {0x22e0, 16, 16, 1061},
+  {0x0, 0, 16, 1061},
+  {0x0, 1, 11, 1077},
+  {0x2f82e, 16, 16, 1087},
+  {0x0, 0, 16, 1087},
+  {0x0, 0, 1, 1103},
+  {0x0, 0, 1, 1104},
+  {0x0, 3, 4, 1105},
+  {0x0, 0, 2, 1106},
+  {0x0, 3, 5, 1108},
+  {0x1f19, 16, 16, 1110},
+  {0x0, 0, 10, 1110},
+  {0x0, 9, 10, 1120},
+  {0x2f8ce, 16, 16, 1121},
+  {0x1f18, 16, 16, 1121},
+  {0x0, 1, 15, 1121},
+  {0x1f7d, 0, 1, 1135},
+  {0x0, 0, 1, 1136},
+  {0x0, 3, 4, 1137},
+  {0x0, 4, 5, 1138},
+  {0x0, 5, 6, 1139},
+  {0x1ff4, 16, 16, 1140},
+  {0x0, 0, 16, 1140},
+  {0x0, 9, 10, 1156},
+  {0xf9dd, 16, 16, 1157},
+  {0x0, 1, 14, 1157},
+  {0x2f991, 16, 16, 1170},
+  {0x0, 2, 16, 1170},
+  {0x0, 3, 4, 1184},
+  {0xfa0b, 16, 16, 1185},
+  {0x0, 6, 16, 1185},
+  {0x0, 0, 1, 1195},
+  {0x0, 0, 1, 1196},
+  {0x0, 3, 4, 1197},
+  {0x0, 0, 5, 1198},
+  {0x0, 2, 3, 1203},
+  {0x1fcf, 16, 16, 1204},
+  {0x0, 0, 15, 1204},
+  {0x0, 8, 9, 1219},
+  {0x2f9bc, 16, 16, 1220},
+  {0x0, 6, 7, 1220},
+  {0x0, 3, 4, 1221},
+  {0x2f838, 16, 16, 1222},
+  {0x0, 0, 7, 1222},
+  {0x0, 9, 10, 1229},
+  {0x0, 2, 3, 1230},
+  {0x2f88f, 16, 16, 1231},
+  {0x0, 2, 6, 1231},
+  {0x0, 0, 1, 1235},
+  {0x0, 0, 1, 1236},
+  {0x0, 3, 4, 1237},
+  {0x0, 3, 4, 1238},
+  {0x0, 8, 9, 1239},
+  {0x22ec, 16, 16, 1240},
+  {0x0, 0, 7, 1240},
+  {0x2f88d, 16, 16, 1247},
+  {0x0, 4, 16, 1247},
+  {0x0, 14, 15, 1259},
+  {0xfa3f, 16, 16, 1260},
+  {0x2f98f, 16, 16, 1260},
+  {0x0, 8, 12, 1260},
+  {0x0, 11, 12, 1264},
+  {0x2f9ee, 16, 16, 1265},
+  {0xfa35, 16, 16, 1265},
+  {0x0, 0, 1, 1265},
+  {0x0, 0, 1, 1266},
+  {0x0, 3, 4, 1267},
+  {0x0, 0, 3, 1268},
+  {0x0, 1, 2, 1271},
+  {0x203, 16, 16, 1272},
+  {0x0, 6, 8, 1272},
+  {0x0, 0, 1, 1274},
+  {0x0, 0, 1, 1275},
+  {0x0, 13, 14, 1276},
+  {0x0, 3, 6, 1277},
+  {0x0, 7, 8, 1280},
+  {0xd4c, 16, 16, 1281},
+  {0x0, 0, 15, 1281},
+  {0x0, 2, 3, 1296},
+  {0xfa20, 16, 16, 1297},
+  {0x0, 3, 13, 1297},
+  {0x0, 0, 2, 1307},
+  {0x0, 0, 1, 1309},
+  {0x0, 0, 1, 1310},
+  {0x0, 3, 4, 1311},
+  {0x0, 0, 1, 1312},
+  {0x0, 2, 7, 1313},
+  {0x1eac, 16, 16, 1318},
+  {0x0, 0, 16, 1318},
+  {0x0, 3, 4, 1334},
+  {0x2f874, 16, 16, 1335},
+  {0x1eb6, 16, 16, 1335},
+  {0x0, 0, 1, 1335},
+  {0x0, 0, 1, 1336},
+  {0x0, 3, 4, 1337},
+  {0x0, 4, 5, 1338},
+  {0x0, 5, 6, 1339},
+  {0x1f9c, 16, 16, 1340},
+  {0x0, 2, 12, 1340},
+  {0x0, 6, 16, 1350},
+  {0x0, 0, 1, 1360},
+  {0x0, 0, 1, 1361},
+  {0x0, 3, 4, 1362},
+  {0x0, 0, 1, 1363},
+  {0x0, 6, 7, 1364},
+  {0x1e1d, 16, 16, 1365},
+  {0x0, 1, 14, 1365},
+  {0x0, 0, 14, 1378},
+  {0x2f918, 16, 16, 1392},
+  {0x0, 2, 14, 1392},
+  {0x0, 9, 10, 1404},
+  {0x2f975, 16, 16, 1405},
+  {0x0, 1, 10, 1405},
+  {0x0, 11, 12, 1414},
+  {0xfa0a, 16, 16, 1415},
+  {0x0, 0, 16, 1415},
+  {0x0, 2, 4, 1431},
+  {0xf992, 16, 16, 1433},
+  {0xfa47, 16, 16, 1433},
+  {0x0, 2, 15, 1433},
+  {0x0, 13, 16, 1446},
+  {0xfa53, 16, 16, 1449},
+  {0xfa52, 16, 16, 1449},
+  {0xfa1b, 16, 16, 1449},
+  {0x0, 0, 1, 1449},
+  {0x0, 3, 4, 1450},
+  {0x0, 0, 1, 1451},
+  {0x0, 9, 10, 1452},
+  {0x0, 9, 10, 1453},
+  {0x30b2, 16, 16, 1454},
+  {0x0, 0, 1, 1454},
+  {0x0, 0, 1, 1455},
+  {0x0, 3, 4, 1456},
+  {0x0, 0, 5, 1457},
+  {0x0, 0, 2, 1462},
+  {0x1fca, 16, 16, 1464},
+  {0x389, 16, 16, 1464},
+  {0x0, 1, 16, 1464},
+  {0x0, 12, 13, 1479},
+  {0x2f93e, 16, 16, 1480},
+  {0x0, 3, 15, 1480},
+  {0x0, 3, 9, 1492},
+  {0x2f968, 16, 16, 1498},
+  {0x0, 0, 1, 1498},
+  {0x0, 0, 1, 1499},
+  {0x0, 3, 4, 1500},
+  {0x0, 0, 5, 1501},
+  {0x0, 2, 6, 1506},
+  {0x1f2e, 16, 16, 1510},
+  {0x1f98, 16, 16, 1510},
+  {0x0, 6, 12, 1510},
+  {0x0, 0, 1, 1516},
+  {0x2f804, 16, 16, 1517},
+  {0x2f919, 16, 16, 1517},
+  {0x2f835, 16, 16, 1517},
+  {0x0, 1, 2, 1517},
+  {0x0, 5, 6, 1518},
+  {0x2f824, 16, 16, 1519},
+  {0x0, 0, 16, 1519},
+  {0x1fe3, 16, 16, 1535},
+  {0x0, 2, 4, 1535},
+  {0x0, 0, 1, 1537},
+  {0x0, 0, 1, 1538},
+  {0x0, 3, 4, 1539},
+  {0x0, 0, 1, 1540},
+  {0x0, 7, 8, 1541},
+  {0x1e69, 16, 16, 1542},
+  {0x1fbe, 0, 1, 1542},
+  {0x0, 0, 16, 1543},
+  {0x0, 3, 4, 1559},
+  {0x2f96c, 16, 16, 1560},
+  {0x0, 0, 15, 1560},
+  {0x0, 10, 11, 1575},
+  {0x2f85d, 16, 16, 1576},
+  {0x0, 3, 11, 1576},
+  {0x2f836, 16, 16, 1584},
+  {0x0, 12, 13, 1584},
+  {0x2f92f, 16, 16, 1585},
+  {0x0, 0, 10, 1585},
+  {0x0, 0, 1, 1595},
+  {0x0, 0, 1, 1596},
+  {0x0, 3, 4, 1597},
+  {0x0, 0, 5, 1598},
+  {0x0, 2, 3, 1603},
+  {0x1f5f, 16, 16, 1604},
+  {0x0, 2, 3, 1604},
+  {0x0, 15, 16, 1605},
+  {0x2f9d8, 16, 16, 1606},
+  {0x0, 1, 16, 1606},
+  {0x0, 0, 12, 1621},
+  {0xf932, 16, 16, 1633},
+  {0x0, 0, 16, 1633},
+  {0x0, 11, 12, 1649},
+  {0xfa6a, 16, 16, 1650},
+  {0x0, 2, 16, 1650},
+  {0x0, 2, 4, 1664},
+  {0xfa68, 16, 16, 1666},
+  {0x0, 2, 16, 1666},
+  {0x212b, 0, 1, 1680},
+  {0x0, 0, 1, 1681},
+  {0x0, 3, 4, 1682},
+  {0x0, 0, 1, 1683},
+  {0x0, 1, 2, 1684},
+  {0x1fa, 16, 16, 1685},
+  {0x0, 1, 16, 1685},
+  {0x0, 0, 1, 1700},
+  {0x0, 3, 4, 1701},
+  {0x0, 0, 1, 1702},
+  {0x0, 9, 10, 1703},
+  {0x0, 9, 10, 1704},
+  {0x30c9, 16, 16, 1705},
+  {0xf9ea, 16, 16, 1705},
+  {0x0, 2, 16, 1705},
+  {0x0, 0, 1, 1719},
+  {0x0, 0, 1, 1720},
+  {0x0, 3, 4, 1721},
+  {0x0, 0, 1, 1722},
+  {0x0, 1, 2, 1723},
+  {0x1e09, 16, 16, 1724},
+  {0x0, 1, 11, 1724},
+  {0x0, 2, 3, 1734},
+  {0x2f8e1, 16, 16, 1735},
+  {0x0, 0, 14, 1735},
+  {0x0, 0, 1, 1749},
+  {0x0, 3, 4, 1750},
+  {0x0, 0, 1, 1751},
+  {0x0, 9, 10, 1752},
+  {0x0, 9, 10, 1753},
+  {0x30f9, 16, 16, 1754},
+  {0x0, 13, 14, 1754},
+  {0xf986, 16, 16, 1755},
+  {0x0, 0, 1, 1755},
+  {0x0, 0, 1, 1756},
+  {0x0, 3, 4, 1757},
+  {0x0, 0, 4, 1758},
+  {0x0, 7, 8, 1762},
+  {0x1e03, 16, 16, 1763},
+  {0x0, 0, 1, 1763},
+  {0x0, 0, 1, 1764},
+  {0x0, 3, 4, 1765},
+  {0x0, 0, 1, 1766},
+  {0x0, 1, 5, 1767},
+  {0x1fd, 16, 16, 1771},
+  {0x0, 0, 1, 1771},
+  {0x0, 0, 1, 1772},
+  {0x0, 3, 4, 1773},
+  {0x0, 3, 4, 1774},
+  {0x0, 8, 9, 1775},
+  {0x2281, 16, 16, 1776},
+  {0x1e3, 16, 16, 1776},
+  {0x0, 2, 12, 1776},
+  {0x0, 0, 1, 1786},
+  {0x0, 0, 1, 1787},
+  {0x0, 3, 4, 1788},
+  {0x0, 3, 4, 1789},
+  {0x0, 8, 9, 1790},
+  {0x22af, 16, 16, 1791},
+  {0xf96b, 16, 16, 1791},
+  {0x0, 2, 16, 1791},
+  {0x0, 3, 10, 1805},
+  {0x0, 2, 3, 1812},
+  {0x2f937, 16, 16, 1813},
+  {0x0, 2, 12, 1813},
+  {0x0, 2, 3, 1823},
+  {0xf98d, 16, 16, 1824},
+  {0x0, 6, 16, 1824},
+  {0x0, 0, 1, 1834},
+  {0x0, 3, 4, 1835},
+  {0x0, 0, 1, 1836},
+  {0x0, 9, 10, 1837},
+  {0x0, 9, 10, 1838},
+  {0x30b0, 16, 16, 1839},
+  {0x0, 0, 1, 1839},
+  {0x0, 0, 1, 1840},
+  {0x0, 3, 4, 1841},
+  {0x0, 0, 3, 1842},
+  {0x0, 1, 8, 1845},
+  {0x1e3e, 16, 16, 1852},
+  {0x1e40, 16, 16, 1852},
+  {0x0, 8, 9, 1852},
+  {0xfa65, 16, 16, 1853},
+  {0x0, 6, 16, 1853},
+  {0x0, 10, 11, 1863},
+  {0xf93a, 16, 16, 1864},
+  {0x0, 0, 16, 1864},
+  {0x0, 0, 1, 1880},
+  {0x0, 0, 1, 1881},
+  {0x0, 3, 4, 1882},
+  {0x0, 4, 5, 1883},
+  {0x0, 5, 6, 1884},
+  {0x1faa, 16, 16, 1885},
+  {0x0, 0, 1, 1885},
+  {0x0, 2, 4, 1886},
+  {0x2001, 16, 16, 1888},
+  {0x2000, 16, 16, 1888},
+  {0x0, 0, 16, 1888},
+  {0x0, 11, 12, 1904},
+  {0x0, 8, 9, 1905},
+  {0x2f897, 16, 16, 1906},
+  {0x0, 2, 15, 1906},
+  {0x0, 4, 5, 1919},
+  {0x2f934, 16, 16, 1920},
+  {0x0, 1, 13, 1920},
+  {0x0, 11, 12, 1932},
+  {0x2f848, 16, 16, 1933},
+  {0x0, 0, 16, 1933},
+  {0x0, 0, 1, 1949},
+  {0x0, 0, 1, 1950},
+  {0x0, 3, 4, 1951},
+  {0x0, 0, 5, 1952},
+  {0x0, 2, 6, 1957},
+  {0x1f07, 16, 16, 1961},
+  {0x1f81, 16, 16, 1961},
+  {0x0, 0, 1, 1961},
+  {0x0, 0, 1, 1962},
+  {0x0, 3, 4, 1963},
+  {0x0, 0, 4, 1964},
+  {0x0, 7, 13, 1968},
+  {0x1e0b, 16, 16, 1974},
+  {0x0, 0, 1, 1974},
+  {0x0, 0, 1, 1975},
+  {0x0, 3, 4, 1976},
+  {0x0, 4, 5, 1977},
+  {0x0, 5, 6, 1978},
+  {0x1f9b, 16, 16, 1979},
+  {0x0, 0, 1, 1979},
+  {0x0, 0, 1, 1980},
+  {0x0, 3, 4, 1981},
+  {0x0, 0, 3, 1982},
+  {0x0, 3, 4, 1985},
+  {0x1e43, 16, 16, 1986},
+  {0x0, 8, 9, 1986},
+  {0x0, 0, 1, 1987},
+  {0x0, 0, 1, 1988},
+  {0x0, 3, 4, 1989},
+  {0x0, 0, 5, 1990},
+  {0x0, 0, 2, 1995},
+  {0x1fed, 16, 16, 1997},
+  {0x385, 16, 16, 1997},
+  {0x0, 2, 4, 1997},
+  {0x0, 0, 1, 1999},
+  {0x0, 0, 1, 2000},
+  {0x0, 3, 4, 2001},
+  {0x0, 0, 1, 2002},
+  {0x0, 0, 2, 2003},
+  {0x1e17, 16, 16, 2005},
+  {0x0, 1, 15, 2005},
+  {0x0, 14, 15, 2019},
+  {0x2f95f, 16, 16, 2020},
+  {0x0, 0, 1, 2020},
+  {0x0, 0, 1, 2021},
+  {0x0, 3, 4, 2022},
+  {0x0, 0, 5, 2023},
+  {0x0, 0, 2, 2028},
+  {0x1f53, 16, 16, 2030},
+  {0x1f55, 16, 16, 2030},
+  {0x0, 0, 1, 2030},
+  {0x0, 0, 1, 2031},
+  {0x0, 3, 4, 2032},
+  {0x0, 3, 4, 2033},
+  {0x0, 8, 9, 2034},
+  {0x22ad, 16, 16, 2035},
+  {0x0, 2, 12, 2035},
+  {0x0, 0, 1, 2045},
+  {0x0, 3, 4, 2046},
+  {0x0, 0, 1, 2047},
+  {0x0, 9, 10, 2048},
+  {0x0, 9, 11, 2049},
+  {0x3079, 16, 16, 2051},
+  {0x0, 0, 1, 2051},
+  {0x0, 3, 4, 2052},
+  {0x0, 0, 1, 2053},
+  {0x0, 9, 10, 2054},
+  {0x0, 9, 11, 2055},
+  {0x307d, 16, 16, 2057},
+  {0x0, 3, 8, 2057},
+  {0x1e5a, 16, 16, 2062},
+  {0x156, 16, 16, 2062},
+  {0x0, 12, 13, 2062},
+  {0xf982, 16, 16, 2063},
+  {0x0, 10, 12, 2063},
+  {0x0, 0, 1, 2065},
+  {0x0, 0, 1, 2066},
+  {0x0, 3, 4, 2067},
+  {0x0, 0, 1, 2068},
+  {0x0, 4, 5, 2069},
+  {0x1ec, 16, 16, 2070},
+  {0x0, 4, 14, 2070},
+  {0x0, 3, 4, 2080},
+  {0xfa64, 16, 16, 2081},
+  {0x0, 0, 1, 2081},
+  {0x0, 0, 1, 2082},
+  {0x0, 3, 4, 2083},
+  {0x0, 4, 5, 2084},
+  {0x0, 5, 6, 2085},
+  {0x1f8e, 16, 16, 2086},
+  {0x0, 7, 8, 2086},
+  {0xf99c, 16, 16, 2087},
+  {0x0, 0, 10, 2087},
+  {0x0, 0, 1, 2097},
+  {0x0, 0, 1, 2098},
+  {0x0, 3, 4, 2099},
+  {0x0, 0, 5, 2100},
+  {0x0, 0, 2, 2105},
+  {0x1f3d, 16, 16, 2107},
+  {0x0, 0, 1, 2107},
+  {0x0, 3, 4, 2108},
+  {0x0, 0, 5, 2109},
+  {0x0, 2, 3, 2114},
+  {0x1fd6, 16, 16, 2115},
+  {0x0, 6, 15, 2115},
+  {0x0, 0, 1, 2124},
+  {0x0, 0, 1, 2125},
+  {0x0, 3, 4, 2126},
+  {0x0, 0, 5, 2127},
+  {0x0, 0, 2, 2132},
+  {0x1fde, 16, 16, 2134},
+  {0x1fdd, 16, 16, 2134},
+  {0x0, 0, 1, 2134},
+  {0x0, 0, 1, 2135},
+  {0x0, 3, 4, 2136},
+  {0x0, 4, 5, 2137},
+  {0x0, 5, 6, 2138},
+  {0x1f95, 16, 16, 2139},
+  {0x0, 4, 8, 2139},
+  {0xf90b, 16, 16, 2143},
+  {0x2f846, 16, 16, 2143},
+  {0x0, 3, 6, 2143},
+  {0x0, 0, 1, 2146},
+  {0x0, 0, 1, 2147},
+  {0x0, 3, 4, 2148},
+  {0x0, 3, 4, 2149},
+  {0x0, 8, 9, 2150},
+  {0x2224, 16, 16, 2151},
+  {0x0, 0, 16, 2151},
+  {0x0, 12, 13, 2167},
+  {0xfa08, 16, 16, 2168},
+  {0x0, 5, 6, 2168},
+  {0x2f905, 16, 16, 2169},
+  {0x0, 10, 11, 2169},
+  {0xf995, 16, 16, 2170},
+  {0x0, 0, 1, 2170},
+  {0x0, 3, 4, 2171},
+  {0x0, 0, 1, 2172},
+  {0x0, 9, 10, 2173},
+  {0x0, 9, 10, 2174},
+  {0x30c7, 16, 16, 2175},
+  {0x0, 0, 1, 2175},
+  {0x0, 0, 1, 2176},
+  {0x0, 3, 4, 2177},
+  {0x0, 0, 5, 2178},
+  {0x0, 0, 2, 2183},
+  {0x1f22, 16, 16, 2185},
+  {0x0, 5, 11, 2185},
+  {0xf97f, 16, 16, 2191},
+  {0x0, 9, 10, 2191},
+  {0x2fa00, 16, 16, 2192},
+  {0x0, 7, 16, 2192},
+  {0x0, 2, 11, 2201},
+  {0xf9e6, 16, 16, 2210},
+  {0x0, 1, 16, 2210},
+  {0x0, 10, 11, 2225},
+  {0xfa17, 16, 16, 2226},
+  {0xfa5a, 16, 16, 2226},
+  {0x0, 10, 12, 2226},
+  {0x0, 0, 1, 2228},
+  {0x0, 0, 1, 2229},
+  {0x0, 3, 4, 2230},
+  {0x0, 0, 1, 2231},
+  {0x0, 4, 5, 2232},
+  {0x1e5d, 16, 16, 2233},
+  {0x0, 7, 10, 2233},
+  {0x2f9b5, 16, 16, 2236},
+  {0x2f9b6, 16, 16, 2236},
+  {0x0, 0, 12, 2236},
+  {0x0, 0, 16, 2248},
+  {0xf997, 16, 16, 2264},
+  {0x0, 1, 12, 2264},
+  {0x0, 11, 12, 2275},
+  {0x0, 6, 7, 2276},
+  {0x2fa01, 16, 16, 2277},
+  {0x0, 10, 16, 2277},
+  {0x0, 8, 15, 2283},
+  {0xfa22, 16, 16, 2290},
+  {0x0, 0, 10, 2290},
+  {0x0, 0, 1, 2300},
+  {0x0, 0, 1, 2301},
+  {0x0, 3, 4, 2302},
+  {0x0, 0, 1, 2303},
+  {0x0, 0, 2, 2304},
+  {0x1f4a, 16, 16, 2306},
+  {0x0, 4, 13, 2306},
+  {0x0, 6, 7, 2315},
+  {0x0, 0, 1, 2316},
+  {0x0, 0, 1, 2317},
+  {0x0, 12, 13, 2318},
+  {0x0, 5, 6, 2319},
+  {0x0, 6, 7, 2320},
+  {0xc48, 16, 16, 2321},
+  {0x2f976, 16, 16, 2321},
+  {0x0, 15, 16, 2321},
+  {0xf97c, 16, 16, 2322},
+  {0x0, 2, 13, 2322},
+  {0x0, 4, 5, 2333},
+  {0xf930, 16, 16, 2334},
+  {0x212a, 0, 1, 2334},
+  {0x0, 0, 1, 2335},
+  {0x0, 3, 4, 2336},
+  {0x0, 0, 4, 2337},
+  {0x0, 1, 2, 2341},
+  {0x1e34, 16, 16, 2342},
+  {0x0, 2, 11, 2342},
+  {0x0, 3, 4, 2351},
+  {0x2f97c, 16, 16, 2352},
+  {0x0, 2, 3, 2352},
+  {0x2f85f, 16, 16, 2353},
+  {0x0, 0, 1, 2353},
+  {0x0, 0, 1, 2354},
+  {0x0, 3, 4, 2355},
+  {0x0, 0, 1, 2356},
+  {0x0, 6, 9, 2357},
+  {0x4d1, 16, 16, 2360},
+  {0x0, 1, 2, 2360},
+  {0xfa55, 16, 16, 2361},
+  {0x0, 5, 14, 2361},
+  {0x0, 15, 16, 2370},
+  {0x0, 10, 11, 2371},
+  {0x2f9ed, 16, 16, 2372},
+  {0x2f97d, 16, 16, 2372},
+  {0x0, 9, 10, 2372},
+  {0xf90e, 16, 16, 2373},
+  {0x0, 0, 1, 2373},
+  {0x0, 0, 1, 2374},
+  {0x0, 3, 4, 2375},
+  {0x0, 0, 5, 2376},
+  {0x0, 0, 2, 2381},
+  {0x1f0a, 16, 16, 2383},
+  {0x1f0c, 16, 16, 2383},
+  {0x0, 0, 1, 2383},
+  {0x0, 0, 1, 2384},
+  {0x0, 3, 4, 2385},
+  {0x0, 0, 5, 2386},
+  {0x0, 2, 6, 2391},
+  {0x1f67, 16, 16, 2395},
+  {0x0, 0, 1, 2395},
+  {0x0, 0, 1, 2396},
+  {0x0, 3, 4, 2397},
+  {0x0, 0, 3, 2398},
+  {0x0, 7, 8, 2401},
+  {0xe7, 16, 16, 2402},
+  {0x1fa1, 16, 16, 2402},
+  {0x1eea, 16, 16, 2402},
+  {0x0, 5, 11, 2402},
+  {0x2f978, 16, 16, 2408},
+  {0x0, 2, 3, 2408},
+  {0x0, 0, 1, 2409},
+  {0x0, 0, 1, 2410},
+  {0x0, 3, 4, 2411},
+  {0x0, 0, 1, 2412},
+  {0x0, 1, 9, 2413},
+  {0x3d4, 16, 16, 2421},
+  {0x0, 4, 14, 2421},
+  {0x0, 12, 13, 2431},
+  {0x2f91e, 16, 16, 2432},
+  {0x3d3, 16, 16, 2432},
+  {0x0, 3, 14, 2432},
+  {0x0, 7, 9, 2443},
+  {0x2f9e9, 16, 16, 2445},
+  {0x0, 0, 1, 2445},
+  {0x0, 0, 1, 2446},
+  {0x0, 3, 4, 2447},
+  {0x0, 0, 3, 2448},
+  {0x0, 0, 10, 2451},
+  {0x176, 16, 16, 2461},
+  {0xdd, 16, 16, 2461},
+  {0x1ef2, 16, 16, 2461},
+  {0x1e8e, 16, 16, 2461},
+  {0x232, 16, 16, 2461},
+  {0x0, 6, 16, 2461},
+  {0x0, 0, 1, 2471},
+  {0x0, 3, 4, 2472},
+  {0x0, 0, 1, 2473},
+  {0x0, 9, 10, 2474},
+  {0x0, 9, 10, 2475},
+  {0x3094, 16, 16, 2476},
+  {0x1ef6, 16, 16, 2476},
+  {0x178, 16, 16, 2476},
+  {0x0, 0, 1, 2476},
+  {0x0, 0, 1, 2477},
+  {0x0, 3, 4, 2478},
+  {0x0, 0, 1, 2479},
+  {0x0, 7, 8, 2480},
+  {0x1e68, 16, 16, 2481},
+  {0x2f9e8, 16, 16, 2481},
+  {0x0, 13, 14, 2481},
+  {0x2f999, 16, 16, 2482},
+  {0x0, 0, 1, 2482},
+  {0x0, 0, 1, 2483},
+  {0x0, 3, 4, 2484},
+  {0x0, 0, 3, 2485},
+  {0x0, 0, 9, 2488},
+  {0x1e82, 16, 16, 2497},
+  {0x0, 4, 16, 2497},
+  {0x0, 14, 15, 2509},
+  {0x2f94e, 16, 16, 2510},
+  {0x174, 16, 16, 2510},
+  {0x1e86, 16, 16, 2510},
+  {0x0, 0, 1, 2510},
+  {0x0, 0, 1, 2511},
+  {0x0, 3, 4, 2512},
+  {0x0, 0, 1, 2513},
+  {0x0, 4, 5, 2514},
+  {0x1de, 16, 16, 2515},
+  {0xf9af, 16, 16, 2515},
+  {0x0, 2, 15, 2515},
+  {0x0, 3, 4, 2528},
+  {0x2f89b, 16, 16, 2529},
+  {0x0, 3, 5, 2529},
+  {0x1f28, 16, 16, 2531},
+  {0x1f29, 16, 16, 2531},
+  {0x0, 8, 16, 2531},
+  {0x0, 10, 11, 2539},
+  {0x2f8f9, 16, 16, 2540},
+  {0x0, 10, 11, 2540},
+  {0x2f89c, 16, 16, 2541},
+  {0x0, 1, 2, 2541},
+  {0x1e07, 16, 16, 2542},
+  {0x0, 0, 1, 2542},
+  {0x0, 3, 4, 2543},
+  {0x0, 0, 1, 2544},
+  {0x0, 9, 10, 2545},
+  {0x0, 9, 11, 2546},
+  {0x30d0, 16, 16, 2548},
+  {0x0, 11, 12, 2548},
+  {0x2f9d6, 16, 16, 2549},
+  {0x0, 0, 13, 2549},
+  {0x0, 0, 15, 2562},
+  {0xfa3c, 16, 16, 2577},
+  {0x0, 7, 8, 2577},
+  {0x2f92e, 16, 16, 2578},
+  {0x0, 0, 1, 2578},
+  {0x0, 3, 4, 2579},
+  {0x0, 0, 1, 2580},
+  {0x0, 9, 10, 2581},
+  {0x0, 9, 10, 2582},
+  {0x30ae, 16, 16, 2583},
+  {0x0, 1, 16, 2583},
+  {0x0, 0, 1, 2598},
+  {0x0, 3, 4, 2599},
+  {0x0, 0, 1, 2600},
+  {0x0, 9, 10, 2601},
+  {0x0, 9, 10, 2602},
+  {0x3058, 16, 16, 2603},
+  {0x0, 0, 1, 2603},
+  {0x0, 0, 1, 2604},
+  {0x0, 3, 4, 2605},
+  {0x0, 0, 4, 2606},
+  {0x0, 0, 16, 2610},
+  {0xcb, 16, 16, 2626},
+  {0x1eba, 16, 16, 2626},
+  {0xca, 16, 16, 2626},
+  {0x1ebc, 16, 16, 2626},
+  {0xc8, 16, 16, 2626},
+  {0xc9, 16, 16, 2626},
+  {0x114, 16, 16, 2626},
+  {0x116, 16, 16, 2626},
+  {0x112, 16, 16, 2626},
+  {0xf94b, 16, 16, 2626},
+  {0x2f877, 16, 16, 2626},
+  {0xf9df, 16, 16, 2626},
+  {0xfa3b, 16, 16, 2626},
+  {0x0, 0, 1, 2626},
+  {0x0, 0, 1, 2627},
+  {0x0, 3, 4, 2628},
+  {0x0, 0, 1, 2629},
+  {0x0, 6, 7, 2630},
+  {0x1e1c, 16, 16, 2631},
+  {0x0, 4, 16, 2631},
+  {0x0, 4, 5, 2643},
+  {0x2f93d, 16, 16, 2644},
+  {0x0, 0, 1, 2644},
+  {0x0, 0, 1, 2645},
+  {0x0, 3, 4, 2646},
+  {0x0, 0, 1, 2647},
+  {0x0, 1, 2, 2648},
+  {0x1fb, 16, 16, 2649},
+  {0x0, 6, 7, 2649},
+  {0x0, 13, 14, 2650},
+  {0x2f8e3, 16, 16, 2651},
+  {0x0, 2, 8, 2651},
+  {0x2f85b, 16, 16, 2657},
+  {0x2f85a, 16, 16, 2657},
+  {0x307c, 16, 16, 2657},
+  {0x0, 0, 1, 2657},
+  {0x0, 0, 1, 2658},
+  {0x0, 3, 4, 2659},
+  {0x0, 0, 5, 2660},
+  {0x0, 2, 6, 2665},
+  {0x1f06, 16, 16, 2669},
+  {0x11a, 16, 16, 2669},
+  {0x204, 16, 16, 2669},
+  {0x1f80, 16, 16, 2669},
+  {0x307a, 16, 16, 2669},
+  {0x0, 0, 1, 2669},
+  {0x0, 8, 9, 2670},
+  {0x2f923, 16, 16, 2671},
+  {0x0, 3, 4, 2671},
+  {0x2f944, 16, 16, 2672},
+  {0x0, 10, 11, 2672},
+  {0xf94d, 16, 16, 2673},
+  {0x0, 3, 4, 2673},
+  {0x1ef0, 16, 16, 2674},
+  {0x0, 11, 12, 2674},
+  {0xf9d4, 16, 16, 2675},
+  {0x0, 0, 16, 2675},
+  {0x113, 16, 16, 2691},
+  {0x115, 16, 16, 2691},
+  {0x117, 16, 16, 2691},
+  {0xe8, 16, 16, 2691},
+  {0xe9, 16, 16, 2691},
+  {0xea, 16, 16, 2691},
+  {0x1ebd, 16, 16, 2691},
+  {0x0, 0, 1, 2691},
+  {0x0, 0, 1, 2692},
+  {0x0, 3, 4, 2693},
+  {0x0, 0, 1, 2694},
+  {0x0, 1, 2, 2695},
+  {0x1e08, 16, 16, 2696},
+  {0xeb, 16, 16, 2696},
+  {0x1ebb, 16, 16, 2696},
+  {0x0, 12, 14, 2696},
+  {0x0, 0, 1, 2698},
+  {0x0, 0, 1, 2699},
+  {0x0, 3, 4, 2700},
+  {0x0, 0, 1, 2701},
+  {0x0, 0, 2, 2702},
+  {0x1e52, 16, 16, 2704},
+  {0x0, 9, 14, 2704},
+  {0x0, 0, 5, 2709},
+  {0x0, 0, 1, 2714},
+  {0x0, 0, 1, 2715},
+  {0x0, 3, 4, 2716},
+  {0x0, 3, 4, 2717},
+  {0x0, 8, 9, 2718},
+  {0x21cf, 16, 16, 2719},
+  {0x0, 0, 1, 2719},
+  {0x0, 0, 1, 2720},
+  {0x0, 3, 4, 2721},
+  {0x0, 0, 1, 2722},
+  {0x0, 2, 3, 2723},
+  {0x134, 16, 16, 2724},
+  {0x0, 0, 1, 2724},
+  {0x0, 0, 1, 2725},
+  {0x0, 3, 4, 2726},
+  {0x0, 0, 5, 2727},
+  {0x0, 0, 2, 2732},
+  {0x1f54, 16, 16, 2734},
+  {0x1f52, 16, 16, 2734},
+  {0x0, 1, 2, 2734},
+  {0x1e5e, 16, 16, 2735},
+  {0x0, 8, 9, 2735},
+  {0xf99f, 16, 16, 2736},
+  {0x0, 1, 5, 2736},
+  {0x0, 14, 15, 2740},
+  {0x2f8f2, 16, 16, 2741},
+  {0x205, 16, 16, 2741},
+  {0x11b, 16, 16, 2741},
+  {0x2f88b, 16, 16, 2741},
+  {0x2f88c, 16, 16, 2741},
+  {0x0, 3, 8, 2741},
+  {0x2f81e, 16, 16, 2746},
+  {0x0, 0, 1, 2746},
+  {0x0, 0, 1, 2747},
+  {0x0, 3, 4, 2748},
+  {0x0, 0, 5, 2749},
+  {0x0, 3, 5, 2754},
+  {0x1f01, 16, 16, 2756},
+  {0xfa00, 16, 16, 2756},
+  {0x0, 3, 16, 2756},
+  {0x2f830, 16, 16, 2769},
+  {0x0, 2, 13, 2769},
+  {0x0, 0, 4, 2780},
+  {0x0, 0, 1, 2784},
+  {0x0, 0, 1, 2785},
+  {0x0, 9, 10, 2786},
+  {0x0, 3, 4, 2787},
+  {0x0, 12, 13, 2788},
+  {0x931, 16, 16, 2789},
+  {0x2f833, 16, 16, 2789},
+  {0x0, 0, 1, 2789},
+  {0x0, 0, 1, 2790},
+  {0x0, 3, 4, 2791},
+  {0x0, 0, 1, 2792},
+  {0x0, 8, 9, 2793},
+  {0x1e7a, 16, 16, 2794},
+  {0x0, 14, 15, 2794},
+  {0xf9d0, 16, 16, 2795},
+  {0x0, 9, 14, 2795},
+  {0x2f847, 16, 16, 2800},
+  {0x0, 13, 14, 2800},
+  {0x0, 2, 3, 2801},
+  {0x2f9b1, 16, 16, 2802},
+  {0x0, 4, 13, 2802},
+  {0x0, 7, 8, 2811},
+  {0x0, 0, 1, 2812},
+  {0x0, 0, 1, 2813},
+  {0x0, 11, 12, 2814},
+  {0x0, 3, 6, 2815},
+  {0x0, 14, 15, 2818},
+  {0xb4b, 16, 16, 2819},
+  {0x0, 6, 8, 2819},
+  {0x0, 0, 1, 2821},
+  {0x0, 0, 1, 2822},
+  {0x0, 3, 4, 2823},
+  {0x0, 0, 1, 2824},
+  {0x0, 4, 5, 2825},
+  {0x1e39, 16, 16, 2826},
+  {0x0, 0, 1, 2826},
+  {0x0, 0, 1, 2827},
+  {0x0, 3, 4, 2828},
+  {0x0, 0, 1, 2829},
+  {0x0, 2, 13, 2830},
+  {0x135, 16, 16, 2841},
+  {0x0, 13, 14, 2841},
+  {0x2f9d0, 16, 16, 2842},
+  {0x0, 4, 14, 2842},
+  {0x0, 0, 15, 2852},
+  {0x0, 4, 7, 2867},
+  {0x2f87d, 16, 16, 2870},
+  {0x2f87b, 16, 16, 2870},
+  {0x0, 7, 8, 2870},
+  {0x0, 0, 1, 2871},
+  {0x0, 0, 1, 2872},
+  {0x0, 9, 10, 2873},
+  {0x0, 11, 14, 2874},
+  {0x0, 14, 15, 2877},
+  {0x9cb, 16, 16, 2878},
+  {0x0, 1, 6, 2878},
+  {0x0, 0, 1, 2883},
+  {0x0, 0, 1, 2884},
+  {0x0, 3, 4, 2885},
+  {0x0, 3, 4, 2886},
+  {0x0, 8, 9, 2887},
+  {0x2270, 16, 16, 2888},
+  {0x0, 5, 9, 2888},
+  {0xf959, 16, 16, 2892},
+  {0xfa36, 16, 16, 2892},
+  {0x0, 0, 1, 2892},
+  {0x0, 0, 1, 2893},
+  {0x0, 3, 4, 2894},
+  {0x0, 3, 4, 2895},
+  {0x0, 8, 9, 2896},
+  {0x2271, 16, 16, 2897},
+  {0x0, 9, 10, 2897},
+  {0xfa5e, 16, 16, 2898},
+  {0x0, 0, 1, 2898},
+  {0x0, 0, 1, 2899},
+  {0x0, 3, 4, 2900},
+  {0x0, 0, 1, 2901},
+  {0x0, 1, 2, 2902},
+  {0x453, 16, 16, 2903},
+  {0xf9d3, 16, 16, 2903},
+  {0x0, 12, 14, 2903},
+  {0x0, 0, 1, 2905},
+  {0x0, 0, 1, 2906},
+  {0x0, 3, 4, 2907},
+  {0x0, 0, 1, 2908},
+  {0x0, 2, 3, 2909},
+  {0x1ed8, 16, 16, 2910},
+  {0x0, 2, 16, 2910},
+  {0xf9e7, 16, 16, 2924},
+  {0xf91c, 16, 16, 2924},
+  {0x0, 1, 16, 2924},
+  {0x0, 4, 9, 2939},
+  {0xf901, 16, 16, 2944},
+  {0x2f82f, 16, 16, 2944},
+  {0x0, 15, 16, 2944},
+  {0x2f883, 16, 16, 2945},
+  {0x0, 0, 5, 2945},
+  {0x0, 0, 1, 2950},
+  {0x0, 0, 1, 2951},
+  {0x0, 3, 4, 2952},
+  {0x0, 3, 4, 2953},
+  {0x0, 8, 9, 2954},
+  {0x21ae, 16, 16, 2955},
+  {0x0, 11, 12, 2955},
+  {0x0, 12, 13, 2956},
+  {0x2f8fb, 16, 16, 2957},
+  {0x0, 0, 1, 2957},
+  {0x0, 0, 1, 2958},
+  {0x0, 3, 4, 2959},
+  {0x0, 0, 5, 2960},
+  {0x0, 3, 5, 2965},
+  {0x1f21, 16, 16, 2967},
+  {0x1f0, 16, 16, 2967},
+  {0x1f20, 16, 16, 2967},
+  {0x0, 0, 11, 2967},
+  {0x0, 0, 1, 2978},
+  {0x2f967, 16, 16, 2979},
+  {0x0, 3, 9, 2979},
+  {0x12f, 16, 16, 2985},
+  {0x0, 7, 15, 2985},
+  {0x2f9c7, 16, 16, 2993},
+  {0x1ecb, 16, 16, 2993},
+  {0x0, 2, 12, 2993},
+  {0x0, 0, 1, 3003},
+  {0x0, 3, 4, 3004},
+  {0x0, 0, 1, 3005},
+  {0x0, 9, 10, 3006},
+  {0x0, 9, 11, 3007},
+  {0x30dc, 16, 16, 3009},
+  {0x0, 6, 11, 3009},
+  {0x0, 0, 1, 3014},
+  {0x0, 0, 1, 3015},
+  {0x0, 12, 13, 3016},
+  {0x0, 13, 14, 3017},
+  {0x0, 5, 6, 3018},
+  {0xccb, 16, 16, 3019},
+  {0x0, 4, 9, 3019},
+  {0x2f9e7, 16, 16, 3024},
+  {0x0, 3, 8, 3024},
+  {0x1e32, 16, 16, 3029},
+  {0x0, 0, 1, 3029},
+  {0x0, 0, 1, 3030},
+  {0x0, 3, 4, 3031},
+  {0x0, 0, 5, 3032},
+  {0x0, 2, 3, 3037},
+  {0x1f36, 16, 16, 3038},
+  {0x0, 3, 14, 3038},
+  {0x0, 0, 1, 3049},
+  {0x0, 0, 1, 3050},
+  {0x0, 3, 4, 3051},
+  {0x0, 0, 1, 3052},
+  {0x0, 4, 12, 3053},
+  {0x45e, 16, 16, 3061},
+  {0x136, 16, 16, 3061},
+  {0x0, 6, 8, 3061},
+  {0x0, 0, 1, 3063},
+  {0x0, 0, 1, 3064},
+  {0x0, 11, 12, 3065},
+  {0x0, 11, 14, 3066},
+  {0x0, 7, 8, 3069},
+  {0xbcc, 16, 16, 3070},
+  {0x0, 3, 4, 3070},
+  {0xf981, 16, 16, 3071},
+  {0x0, 0, 1, 3071},
+  {0x0, 0, 1, 3072},
+  {0x0, 3, 4, 3073},
+  {0x0, 0, 4, 3074},
+  {0x0, 0, 16, 3078},
+  {0x1ec8, 16, 16, 3094},
+  {0x0, 3, 4, 3094},
+  {0x343, 16, 16, 3095},
+  {0x12c, 16, 16, 3095},
+  {0x0, 3, 16, 3095},
+  {0x2f870, 16, 16, 3108},
+  {0xf9b1, 16, 16, 3108},
+  {0x0, 0, 15, 3108},
+  {0x2f97f, 16, 16, 3123},
+  {0x2f8cc, 16, 16, 3123},
+  {0x0, 0, 1, 3123},
+  {0x0, 0, 1, 3124},
+  {0x0, 3, 4, 3125},
+  {0x0, 0, 1, 3126},
+  {0x0, 4, 5, 3127},
+  {0x1ed, 16, 16, 3128},
+  {0x30dd, 16, 16, 3128},
+  {0x0, 0, 7, 3128},
+  {0x0, 11, 12, 3135},
+  {0x2f984, 16, 16, 3136},
+  {0x0, 1, 12, 3136},
+  {0x0, 13, 14, 3147},
+  {0x0, 4, 5, 3148},
+  {0x2f8a4, 16, 16, 3149},
+  {0x2f9c6, 16, 16, 3149},
+  {0x2f872, 16, 16, 3149},
+  {0x0, 2, 16, 3149},
+  {0x0, 12, 13, 3163},
+  {0xf9c3, 16, 16, 3164},
+  {0xf945, 16, 16, 3164},
+  {0x0, 5, 6, 3164},
+  {0xf90f, 16, 16, 3165},
+  {0x0, 1, 16, 3165},
+  {0x0, 13, 14, 3180},
+  {0x2f884, 16, 16, 3181},
+  {0x0, 0, 1, 3181},
+  {0x0, 0, 1, 3182},
+  {0x0, 3, 4, 3183},
+  {0x0, 0, 1, 3184},
+  {0x0, 8, 9, 3185},
+  {0x4f9, 16, 16, 3186},
+  {0x0, 5, 6, 3186},
+  {0x2f921, 16, 16, 3187},
+  {0x0, 8, 10, 3187},
+  {0xfa4d, 16, 16, 3189},
+  {0xfa4e, 16, 16, 3189},
+  {0x0, 1, 16, 3189},
+  {0x0, 11, 12, 3204},
+  {0x2fa15, 16, 16, 3205},
+  {0x0, 7, 16, 3205},
+  {0xf988, 16, 16, 3214},
+  {0x0, 11, 12, 3214},
+  {0x2f863, 16, 16, 3215},
+  {0x0, 0, 5, 3215},
+  {0x0, 7, 8, 3220},
+  {0xf950, 16, 16, 3221},
+  {0x0, 0, 16, 3221},
+  {0x0, 9, 16, 3237},
+  {0xf95b, 16, 16, 3244},
+  {0x0, 0, 1, 3244},
+  {0x0, 0, 1, 3245},
+  {0x0, 3, 4, 3246},
+  {0x0, 0, 1, 3247},
+  {0x0, 7, 9, 3248},
+  {0x1e8a, 16, 16, 3250},
+  {0x0, 0, 1, 3250},
+  {0x0, 0, 1, 3251},
+  {0x0, 3, 4, 3252},
+  {0x0, 0, 5, 3253},
+  {0x0, 0, 2, 3258},
+  {0x3b0, 16, 16, 3260},
+  {0x1fe2, 16, 16, 3260},
+  {0x0, 1, 15, 3260},
+  {0x0, 2, 3, 3274},
+  {0x2f8e8, 16, 16, 3275},
+  {0xf9f3, 16, 16, 3275},
+  {0x1e8c, 16, 16, 3275},
+  {0x0, 0, 1, 3275},
+  {0x0, 3, 4, 3276},
+  {0x0, 0, 1, 3277},
+  {0x0, 9, 10, 3278},
+  {0x0, 9, 10, 3279},
+  {0x30bc, 16, 16, 3280},
+  {0x0, 0, 1, 3280},
+  {0x0, 0, 1, 3281},
+  {0x0, 3, 4, 3282},
+  {0x0, 0, 1, 3283},
+  {0x0, 4, 5, 3284},
+  {0x1e38, 16, 16, 3285},
+  {0x0, 9, 10, 3285},
+  {0xf966, 16, 16, 3286},
+  {0x0, 2, 3, 3286},
+  {0x0, 14, 15, 3287},
+  {0x2f9e5, 16, 16, 3288},
+  {0x0, 1, 2, 3288},
+  {0x206, 16, 16, 3289},
+  {0x0, 5, 16, 3289},
+  {0x1fcb, 16, 16, 3300},
+  {0x0, 3, 4, 3300},
+  {0x1e42, 16, 16, 3301},
+  {0x0, 4, 16, 3301},
+  {0x0, 0, 1, 3313},
+  {0x2fa0b, 16, 16, 3314},
+  {0x0, 13, 14, 3314},
+  {0x2f89d, 16, 16, 3315},
+  {0x0, 1, 15, 3315},
+  {0xfa44, 16, 16, 3329},
+  {0x0, 8, 13, 3329},
+  {0xfa3a, 16, 16, 3334},
+  {0x0, 1, 15, 3334},
+  {0x0, 2, 13, 3348},
+  {0xf960, 16, 16, 3359},
+  {0x0, 1, 2, 3359},
+  {0x0, 13, 14, 3360},
+  {0x2f94d, 16, 16, 3361},
+  {0x0, 13, 14, 3361},
+  {0xf923, 16, 16, 3362},
+  {0x0, 4, 5, 3362},
+  {0xf91d, 16, 16, 3363},
+  {0x0, 12, 13, 3363},
+  {0x0, 14, 15, 3364},
+  {0x2fa10, 16, 16, 3365},
+  {0x0, 0, 1, 3365},
+  {0x0, 0, 1, 3366},
+  {0x0, 3, 4, 3367},
+  {0x0, 0, 5, 3368},
+  {0x0, 0, 2, 3373},
+  {0x1f33, 16, 16, 3375},
+  {0x0, 0, 1, 3375},
+  {0x0, 0, 1, 3376},
+  {0x0, 3, 4, 3377},
+  {0x0, 0, 1, 3378},
+  {0x0, 7, 8, 3379},
+  {0x1e1e, 16, 16, 3380},
+  {0x1f35, 16, 16, 3380},
+  {0x0, 15, 16, 3380},
+  {0xfa41, 16, 16, 3381},
+  {0xf9ac, 16, 16, 3381},
+  {0x2f858, 16, 16, 3381},
+  {0x0, 0, 1, 3381},
+  {0x0, 0, 1, 3382},
+  {0x0, 3, 4, 3383},
+  {0x0, 4, 5, 3384},
+  {0x0, 5, 6, 3385},
+  {0x1f82, 16, 16, 3386},
+  {0x0, 11, 12, 3386},
+  {0xf9d8, 16, 16, 3387},
+  {0x0, 0, 15, 3387},
+  {0x0, 0, 1, 3402},
+  {0x0, 0, 1, 3403},
+  {0x0, 3, 4, 3404},
+  {0x0, 0, 1, 3405},
+  {0x0, 0, 9, 3406},
+  {0x4d6, 16, 16, 3415},
+  {0x0, 5, 6, 3415},
+  {0xf983, 16, 16, 3416},
+  {0x400, 16, 16, 3416},
+  {0x0, 0, 1, 3416},
+  {0x0, 0, 1, 3417},
+  {0x0, 3, 4, 3418},
+  {0x0, 0, 5, 3419},
+  {0x0, 0, 2, 3424},
+  {0x1f0d, 16, 16, 3426},
+  {0x1f0b, 16, 16, 3426},
+  {0x401, 16, 16, 3426},
+  {0x0, 10, 14, 3426},
+  {0x2f8c5, 16, 16, 3430},
+  {0xf991, 16, 16, 3430},
+  {0x0, 1, 2, 3430},
+  {0x207, 16, 16, 3431},
+  {0x0, 10, 12, 3431},
+  {0x0, 0, 1, 3433},
+  {0x0, 0, 1, 3434},
+  {0x0, 3, 4, 3435},
+  {0x0, 0, 1, 3436},
+  {0x0, 7, 8, 3437},
+  {0x1e64, 16, 16, 3438},
+  {0x0, 5, 6, 3438},
+  {0x2f9a6, 16, 16, 3439},
+  {0x0, 4, 8, 3439},
+  {0x387, 16, 16, 3443},
+  {0x1ffd, 16, 16, 3443},
+  {0x0, 9, 11, 3443},
+  {0xf928, 16, 16, 3445},
+  {0x0, 0, 1, 3445},
+  {0x0, 0, 1, 3446},
+  {0x0, 3, 4, 3447},
+  {0x0, 0, 3, 3448},
+  {0x0, 3, 4, 3451},
+  {0x1ee2, 16, 16, 3452},
+  {0x0, 4, 16, 3452},
+  {0x0, 4, 14, 3464},
+  {0xf9d1, 16, 16, 3474},
+  {0x0, 1, 14, 3474},
+  {0x0, 1, 12, 3487},
+  {0x2f9e6, 16, 16, 3498},
+  {0x0, 13, 14, 3498},
+  {0x2fa0c, 16, 16, 3499},
+  {0x0, 0, 1, 3499},
+  {0x0, 0, 1, 3500},
+  {0x0, 3, 4, 3501},
+  {0x0, 0, 1, 3502},
+  {0x0, 4, 5, 3503},
+  {0x230, 16, 16, 3504},
+  {0x0, 0, 1, 3504},
+  {0x0, 0, 1, 3505},
+  {0x0, 3, 4, 3506},
+  {0x0, 4, 5, 3507},
+  {0x0, 5, 6, 3508},
+  {0x1faf, 16, 16, 3509},
+  {0x0, 14, 15, 3509},
+  {0xf9a6, 16, 16, 3510},
+  {0x0, 13, 14, 3510},
+  {0x2f87a, 16, 16, 3511},
+  {0x0, 0, 7, 3511},
+  {0x3ac, 16, 16, 3518},
+  {0x1f70, 16, 16, 3518},
+  {0x0, 7, 8, 3518},
+  {0x0, 0, 1, 3519},
+  {0x0, 0, 1, 3520},
+  {0x0, 6, 7, 3521},
+  {0x0, 5, 6, 3522},
+  {0x0, 3, 6, 3523},
+  {0x623, 16, 16, 3526},
+  {0x625, 16, 16, 3526},
+  {0x1fb1, 16, 16, 3526},
+  {0x1fb0, 16, 16, 3526},
+  {0xf9a2, 16, 16, 3526},
+  {0x0, 10, 11, 3526},
+  {0xf9d6, 16, 16, 3527},
+  {0x0, 3, 4, 3527},
+  {0x2f844, 16, 16, 3528},
+  {0x0, 1, 2, 3528},
+  {0x1e0f, 16, 16, 3529},
+  {0x0, 14, 15, 3529},
+  {0xf9c0, 16, 16, 3530},
+  {0x0, 6, 7, 3530},
+  {0xf9dc, 16, 16, 3531},
+  {0x2f810, 16, 16, 3531},
+  {0x2f814, 16, 16, 3531},
+  {0xf978, 16, 16, 3531},
+  {0x2f9e4, 16, 16, 3531},
+  {0x0, 0, 16, 3531},
+  {0x0, 13, 14, 3547},
+  {0xf9ed, 16, 16, 3548},
+  {0x0, 0, 1, 3548},
+  {0x0, 3, 4, 3549},
+  {0x0, 0, 1, 3550},
+  {0x0, 9, 10, 3551},
+  {0x0, 9, 11, 3552},
+  {0x3071, 16, 16, 3554},
+  {0x0, 2, 16, 3554},
+  {0x0, 1, 12, 3568},
+  {0x2f9af, 16, 16, 3579},
+  {0x0, 0, 1, 3579},
+  {0x0, 0, 1, 3580},
+  {0x0, 3, 4, 3581},
+  {0x0, 0, 4, 3582},
+  {0x0, 3, 14, 3586},
+  {0x1e4b, 16, 16, 3597},
+  {0x0, 0, 1, 3597},
+  {0x0, 0, 1, 3598},
+  {0x0, 3, 4, 3599},
+  {0x0, 4, 5, 3600},
+  {0x0, 5, 6, 3601},
+  {0x1f9a, 16, 16, 3602},
+  {0x0, 5, 7, 3602},
+  {0x2f829, 16, 16, 3604},
+  {0x2f82a, 16, 16, 3604},
+  {0x0, 3, 16, 3604},
+  {0x0, 14, 15, 3617},
+  {0xf999, 16, 16, 3618},
+  {0x0, 7, 15, 3618},
+  {0xf9bc, 16, 16, 3626},
+  {0x0, 0, 1, 3626},
+  {0x0, 0, 1, 3627},
+  {0x0, 3, 4, 3628},
+  {0x0, 3, 4, 3629},
+  {0x0, 8, 9, 3630},
+  {0x21cd, 16, 16, 3631},
+  {0x0, 0, 1, 3631},
+  {0x0, 0, 1, 3632},
+  {0x0, 3, 4, 3633},
+  {0x0, 3, 4, 3634},
+  {0x0, 8, 9, 3635},
+  {0x2262, 16, 16, 3636},
+  {0x0, 0, 2, 3636},
+  {0x3ae, 16, 16, 3638},
+  {0x1f74, 16, 16, 3638},
+  {0x0, 0, 1, 3638},
+  {0x0, 0, 1, 3639},
+  {0x0, 3, 4, 3640},
+  {0x0, 0, 4, 3641},
+  {0x0, 1, 2, 3645},
+  {0x1e96, 16, 16, 3646},
+  {0x0, 0, 1, 3646},
+  {0x0, 3, 4, 3647},
+  {0x0, 0, 1, 3648},
+  {0x0, 9, 10, 3649},
+  {0x0, 9, 10, 3650},
+  {0x30b8, 16, 16, 3651},
+  {0x0, 2, 7, 3651},
+  {0xf97d, 16, 16, 3656},
+  {0xf941, 16, 16, 3656},
+  {0x1e47, 16, 16, 3656},
+  {0x146, 16, 16, 3656},
+  {0x0, 0, 1, 3656},
+  {0x1e2d, 16, 16, 3657},
+  {0x2f9b2, 16, 16, 3657},
+  {0x0, 0, 1, 3657},
+  {0xf9fa, 16, 16, 3658},
+  {0x3070, 16, 16, 3658},
+  {0x0, 8, 9, 3658},
+  {0xf90c, 16, 16, 3659},
+  {0x0, 0, 1, 3659},
+  {0x0, 0, 1, 3660},
+  {0x0, 3, 4, 3661},
+  {0x0, 0, 1, 3662},
+  {0x0, 0, 10, 3663},
+  {0x1ea6, 16, 16, 3673},
+  {0x1ea4, 16, 16, 3673},
+  {0x1eaa, 16, 16, 3673},
+  {0x0, 14, 15, 3673},
+  {0xf92c, 16, 16, 3674},
+  {0x1ea8, 16, 16, 3674},
+  {0x0, 0, 1, 3674},
+  {0x0, 3, 4, 3675},
+  {0x0, 0, 1, 3676},
+  {0x0, 9, 10, 3677},
+  {0x0, 9, 10, 3678},
+  {0x30c2, 16, 16, 3679},
+  {0x0, 0, 9, 3679},
+  {0x340, 16, 16, 3688},
+  {0x341, 16, 16, 3688},
+  {0x0, 0, 15, 3688},
+  {0x0, 6, 7, 3703},
+  {0x2f94c, 16, 16, 3704},
+  {0x0, 3, 4, 3704},
+  {0x2f8e9, 16, 16, 3705},
+  {0x0, 6, 7, 3705},
+  {0xf9fe, 16, 16, 3706},
+  {0x0, 8, 9, 3706},
+  {0x0, 0, 1, 3707},
+  {0x2f965, 16, 16, 3708},
+  {0x0, 12, 13, 3708},
+  {0x0, 0, 1, 3709},
+  {0x0, 0, 1, 3710},
+  {0x0, 3, 4, 3711},
+  {0x0, 3, 4, 3712},
+  {0x0, 8, 9, 3713},
+  {0x2241, 16, 16, 3714},
+  {0x1f75, 0, 1, 3714},
+  {0x0, 0, 1, 3715},
+  {0x0, 3, 4, 3716},
+  {0x0, 4, 5, 3717},
+  {0x0, 5, 6, 3718},
+  {0x1fc4, 16, 16, 3719},
+  {0x0, 8, 9, 3719},
+  {0x0, 1, 2, 3720},
+  {0x2f876, 16, 16, 3721},
+  {0x0, 0, 15, 3721},
+  {0xfa19, 16, 16, 3736},
+  {0x0, 15, 16, 3736},
+  {0x0, 0, 1, 3737},
+  {0x0, 3, 4, 3738},
+  {0x0, 0, 1, 3739},
+  {0x0, 9, 10, 3740},
+  {0x0, 9, 10, 3741},
+  {0x30f7, 16, 16, 3742},
+  {0x0, 1, 2, 3742},
+  {0xf9e8, 16, 16, 3743},
+  {0x0, 1, 16, 3743},
+  {0x154, 16, 16, 3758},
+  {0x0, 7, 8, 3758},
+  {0x0, 12, 13, 3759},
+  {0x2f95c, 16, 16, 3760},
+  {0x0, 7, 8, 3760},
+  {0xf933, 16, 16, 3761},
+  {0x0, 0, 16, 3761},
+  {0x0, 3, 11, 3777},
+  {0x2f8df, 16, 16, 3785},
+  {0xfa50, 16, 16, 3785},
+  {0xfa4f, 16, 16, 3785},
+  {0x0, 8, 12, 3785},
+  {0x2f920, 16, 16, 3789},
+  {0x0, 3, 4, 3789},
+  {0x1e88, 16, 16, 3790},
+  {0x0, 0, 1, 3790},
+  {0x0, 3, 4, 3791},
+  {0x0, 0, 1, 3792},
+  {0x0, 9, 10, 3793},
+  {0x0, 9, 11, 3794},
+  {0x3077, 16, 16, 3796},
+  {0x0, 10, 11, 3796},
+  {0x2f917, 16, 16, 3797},
+  {0x0, 14, 16, 3797},
+  {0x0, 12, 13, 3799},
+  {0x2f868, 16, 16, 3800},
+  {0x0, 1, 7, 3800},
+  {0x0, 2, 3, 3806},
+  {0x2fa0a, 16, 16, 3807},
+  {0x0, 0, 1, 3807},
+  {0x0, 0, 1, 3808},
+  {0x0, 3, 4, 3809},
+  {0x0, 4, 5, 3810},
+  {0x0, 5, 6, 3811},
+  {0x1f86, 16, 16, 3812},
+  {0x0, 1, 6, 3812},
+  {0xfa59, 16, 16, 3817},
+  {0x2f970, 16, 16, 3817},
+  {0x0, 9, 10, 3817},
+  {0x2f887, 16, 16, 3818},
+  {0x0, 0, 9, 3818},
+  {0x0, 8, 9, 3827},
+  {0xf9fc, 16, 16, 3828},
+  {0x0, 7, 8, 3828},
+  {0xf9f4, 16, 16, 3829},
+  {0x0, 8, 10, 3829},
+  {0x0, 0, 1, 3831},
+  {0x0, 0, 1, 3832},
+  {0x0, 3, 4, 3833},
+  {0x0, 0, 1, 3834},
+  {0x0, 8, 9, 3835},
+  {0x4da, 16, 16, 3836},
+  {0x0, 1, 2, 3836},
+  {0xf9b9, 16, 16, 3837},
+  {0x0, 3, 13, 3837},
+  {0x0, 14, 15, 3847},
+  {0x2f9cd, 16, 16, 3848},
+  {0x0, 6, 7, 3848},
+  {0x2f866, 16, 16, 3849},
+  {0x0, 8, 10, 3849},
+  {0x0, 0, 1, 3851},
+  {0x0, 0, 1, 3852},
+  {0x0, 3, 4, 3853},
+  {0x0, 0, 1, 3854},
+  {0x0, 2, 3, 3855},
+  {0x1ec7, 16, 16, 3856},
+  {0x0, 14, 15, 3856},
+  {0x2f867, 16, 16, 3857},
+  {0x0, 3, 14, 3857},
+  {0x118, 16, 16, 3868},
+  {0x0, 0, 1, 3868},
+  {0x0, 0, 1, 3869},
+  {0x0, 3, 4, 3870},
+  {0x0, 0, 5, 3871},
+  {0x0, 0, 2, 3876},
+  {0x1f2d, 16, 16, 3878},
+  {0x228, 16, 16, 3878},
+  {0x0, 4, 15, 3878},
+  {0x0, 7, 8, 3889},
+  {0x2f8fe, 16, 16, 3890},
+  {0x1eb8, 16, 16, 3890},
+  {0x0, 2, 13, 3890},
+  {0x0, 0, 1, 3901},
+  {0xf9f8, 16, 16, 3902},
+  {0x0, 14, 15, 3902},
+  {0xf989, 16, 16, 3903},
+  {0x0, 2, 8, 3903},
+  {0x2f8f3, 16, 16, 3909},
+  {0x0, 6, 7, 3909},
+  {0x2f873, 16, 16, 3910},
+  {0x0, 0, 16, 3910},
+  {0x0, 1, 2, 3926},
+  {0x2f8be, 16, 16, 3927},
+  {0x0, 12, 15, 3927},
+  {0xfa18, 16, 16, 3930},
+  {0x0, 8, 9, 3930},
+  {0xf969, 16, 16, 3931},
+  {0x0, 5, 13, 3931},
+  {0x0, 3, 13, 3939},
+  {0x2f98a, 16, 16, 3949},
+  {0x0, 9, 10, 3949},
+  {0xf9cd, 16, 16, 3950},
+  {0x1e18, 16, 16, 3950},
+  {0x0, 0, 1, 3950},
+  {0x0, 0, 1, 3951},
+  {0x0, 3, 4, 3952},
+  {0x0, 0, 1, 3953},
+  {0x0, 4, 5, 3954},
+  {0x1e5c, 16, 16, 3955},
+  {0xf98c, 16, 16, 3955},
+  {0x0, 12, 16, 3955},
+  {0x0, 13, 14, 3959},
+  {0x2fa0e, 16, 16, 3960},
+  {0x0, 9, 14, 3960},
+  {0x0, 15, 16, 3965},
+  {0x2f81f, 16, 16, 3966},
+  {0x0, 2, 13, 3966},
+  {0x0, 6, 7, 3977},
+  {0x2f952, 16, 16, 3978},
+  {0x0, 0, 1, 3978},
+  {0x0, 0, 1, 3979},
+  {0x0, 3, 4, 3980},
+  {0x0, 0, 3, 3981},
+  {0x0, 1, 13, 3984},
+  {0x160, 16, 16, 3996},
+  {0x0, 0, 1, 3996},
+  {0x0, 3, 4, 3997},
+  {0x0, 0, 1, 3998},
+  {0x0, 9, 10, 3999},
+  {0x0, 9, 10, 4000},
+  {0x30ac, 16, 16, 4001},
+  {0x0, 9, 10, 4001},
+  {0xf9d5, 16, 16, 4002},
+  {0x0, 0, 1, 4002},
+  {0x0, 0, 1, 4003},
+  {0x0, 3, 4, 4004},
+  {0x0, 0, 5, 4005},
+  {0x0, 0, 2, 4010},
+  {0x3ce, 16, 16, 4012},
+  {0x0, 11, 12, 4012},
+  {0x2f8f8, 16, 16, 4013},
+  {0x0, 0, 1, 4013},
+  {0x0, 0, 1, 4014},
+  {0x0, 3, 4, 4015},
+  {0x0, 0, 1, 4016},
+  {0x0, 0, 9, 4017},
+  {0x451, 16, 16, 4026},
+  {0x450, 16, 16, 4026},
+  {0x0, 3, 13, 4026},
+  {0x0, 3, 4, 4036},
+  {0x2fa03, 16, 16, 4037},
+  {0x4d7, 16, 16, 4037},
+  {0xf9c9, 16, 16, 4037},
+  {0x1e60, 16, 16, 4037},
+  {0x15a, 16, 16, 4037},
+  {0x15c, 16, 16, 4037},
+  {0xf91e, 16, 16, 4037},
+  {0x0, 0, 1, 4037},
+  {0x0, 0, 1, 4038},
+  {0x0, 3, 4, 4039},
+  {0x0, 0, 1, 4040},
+  {0x0, 0, 10, 4041},
+  {0x1eab, 16, 16, 4051},
+  {0x1ea7, 16, 16, 4051},
+  {0x1ea5, 16, 16, 4051},
+  {0x1ea9, 16, 16, 4051},
+  {0x0, 2, 14, 4051},
+  {0x0, 10, 11, 4063},
+  {0xfa16, 16, 16, 4064},
+  {0x0, 11, 12, 4064},
+  {0xf9a4, 16, 16, 4065},
+  {0x0, 0, 1, 4065},
+  {0x0, 0, 1, 4066},
+  {0x0, 3, 4, 4067},
+  {0x0, 3, 4, 4068},
+  {0x0, 8, 9, 4069},
+  {0x226d, 16, 16, 4070},
+  {0x0, 0, 1, 4070},
+  {0x0, 0, 1, 4071},
+  {0x0, 3, 4, 4072},
+  {0x0, 4, 5, 4073},
+  {0x0, 5, 6, 4074},
+  {0x1f9f, 16, 16, 4075},
+  {0x0, 0, 1, 4075},
+  {0x0, 0, 1, 4076},
+  {0x0, 3, 4, 4077},
+  {0x0, 4, 5, 4078},
+  {0x0, 5, 6, 4079},
+  {0x1fad, 16, 16, 4080},
+  {0x0, 0, 1, 4080},
+  {0x0, 0, 1, 4081},
+  {0x0, 3, 4, 4082},
+  {0x0, 0, 3, 4083},
+  {0x0, 3, 4, 4086},
+  {0x1ee3, 16, 16, 4087},
+  {0x0, 13, 14, 4087},
+  {0x2f9ae, 16, 16, 4088},
+  {0x0, 3, 15, 4088},
+  {0x1e2b, 16, 16, 4100},
+  {0x0, 12, 13, 4100},
+  {0x2f9ea, 16, 16, 4101},
+  {0x0, 12, 13, 4101},
+  {0x0, 10, 11, 4102},
+  {0x2f9ab, 16, 16, 4103},
+  {0x0, 0, 1, 4103},
+  {0x0, 0, 1, 4104},
+  {0x0, 3, 4, 4105},
+  {0x0, 0, 5, 4106},
+  {0x0, 0, 7, 4111},
+  {0x1fba, 16, 16, 4118},
+  {0x386, 16, 16, 4118},
+  {0x1fb8, 16, 16, 4118},
+  {0x0, 7, 8, 4118},
+  {0x2f811, 16, 16, 4119},
+  {0x1fb9, 16, 16, 4119},
+  {0x0, 1, 14, 4119},
+  {0x0, 14, 15, 4132},
+  {0x2f909, 16, 16, 4133},
+  {0x0, 0, 13, 4133},
+  {0xf936, 16, 16, 4146},
+  {0x0, 6, 7, 4146},
+  {0x0, 0, 1, 4147},
+  {0x0, 0, 1, 4148},
+  {0x0, 3, 4, 4149},
+  {0x0, 4, 5, 4150},
+  {0x0, 5, 6, 4151},
+  {0x1fc7, 16, 16, 4152},
+  {0x0, 0, 11, 4152},
+  {0x0, 0, 1, 4163},
+  {0x0, 0, 1, 4164},
+  {0x0, 3, 4, 4165},
+  {0x0, 0, 1, 4166},
+  {0x0, 7, 9, 4167},
+  {0x1e8b, 16, 16, 4169},
+  {0x0, 1, 8, 4169},
+  {0x1e3f, 16, 16, 4176},
+  {0x1e41, 16, 16, 4176},
+  {0x0, 0, 16, 4176},
+  {0x0, 4, 5, 4192},
+  {0xf93f, 16, 16, 4193},
+  {0x0, 7, 8, 4193},
+  {0x2f964, 16, 16, 4194},
+  {0x0, 6, 7, 4194},
+  {0x2f9be, 16, 16, 4195},
+  {0x1e8d, 16, 16, 4195},
+  {0x0, 0, 1, 4195},
+  {0x0, 0, 1, 4196},
+  {0x0, 3, 4, 4197},
+  {0x0, 0, 1, 4198},
+  {0x0, 0, 2, 4199},
+  {0x1e14, 16, 16, 4201},
+  {0x0, 7, 8, 4201},
+  {0xfa31, 16, 16, 4202},
+  {0x0, 0, 1, 4202},
+  {0x0, 0, 1, 4203},
+  {0x0, 3, 4, 4204},
+  {0x0, 0, 1, 4205},
+  {0x0, 1, 2, 4206},
+  {0x1e2f, 16, 16, 4207},
+  {0x0, 7, 8, 4207},
+  {0xf963, 16, 16, 4208},
+  {0x2f9b3, 16, 16, 4208},
+  {0x0, 0, 1, 4208},
+  {0x0, 0, 1, 4209},
+  {0x0, 3, 4, 4210},
+  {0x0, 0, 5, 4211},
+  {0x0, 2, 3, 4216},
+  {0x1f3e, 16, 16, 4217},
+  {0x0, 0, 1, 4217},
+  {0x0, 0, 1, 4218},
+  {0x0, 3, 4, 4219},
+  {0x0, 0, 1, 4220},
+  {0x0, 1, 2, 4221},
+  {0x1e2e, 16, 16, 4222},
+  {0x1e29, 16, 16, 4222},
+  {0x0, 0, 1, 4222},
+  {0x0, 0, 1, 4223},
+  {0x0, 3, 4, 4224},
+  {0x0, 0, 4, 4225},
+  {0x0, 1, 2, 4229},
+  {0x1e06, 16, 16, 4230},
+  {0x1e25, 16, 16, 4230},
+  {0xec, 16, 16, 4230},
+  {0xed, 16, 16, 4230},
+  {0xee, 16, 16, 4230},
+  {0x129, 16, 16, 4230},
+  {0x12b, 16, 16, 4230},
+  {0x12d, 16, 16, 4230},
+  {0xef, 16, 16, 4230},
+  {0x1ec9, 16, 16, 4230},
+  {0x0, 6, 16, 4230},
+  {0x2f83b, 16, 16, 4240},
+  {0x0, 1, 2, 4240},
+  {0xf909, 16, 16, 4241},
+  {0x2f969, 16, 16, 4241},
+  {0x0, 8, 11, 4241},
+  {0x2f9c9, 16, 16, 4244},
+  {0x0, 1, 13, 4244},
+  {0x1e30, 16, 16, 4256},
+  {0x1a1, 16, 16, 4256},
+  {0x0, 3, 12, 4256},
+  {0x0, 0, 1, 4265},
+  {0x0, 0, 1, 4266},
+  {0x0, 3, 4, 4267},
+  {0x0, 3, 4, 4268},
+  {0x0, 8, 9, 4269},
+  {0x2209, 16, 16, 4270},
+  {0x0, 13, 14, 4270},
+  {0xf918, 16, 16, 4271},
+  {0xf97b, 16, 16, 4271},
+  {0x0, 1, 13, 4271},
+  {0x2f9a9, 16, 16, 4283},
+  {0x2f9a8, 16, 16, 4283},
+  {0x0, 8, 9, 4283},
+  {0x2f86e, 16, 16, 4284},
+  {0x0, 4, 5, 4284},
+  {0x2f9e2, 16, 16, 4285},
+  {0xf9de, 16, 16, 4285},
+  {0x1e8, 16, 16, 4285},
+  {0x0, 3, 4, 4285},
+  {0x2f99c, 16, 16, 4286},
+  {0x0, 6, 7, 4286},
+  {0x2f94b, 16, 16, 4287},
+  {0x209, 16, 16, 4287},
+  {0x0, 2, 3, 4287},
+  {0xfa4a, 16, 16, 4288},
+  {0xf9c2, 16, 16, 4288},
+  {0x0, 0, 1, 4288},
+  {0x0, 0, 1, 4289},
+  {0x0, 3, 4, 4290},
+  {0x0, 0, 1, 4291},
+  {0x0, 8, 9, 4292},
+  {0x4db, 16, 16, 4293},
+  {0x0, 5, 6, 4293},
+  {0xfa1a, 16, 16, 4294},
+  {0x0, 4, 15, 4294},
+  {0x2f8a9, 16, 16, 4305},
+  {0x0, 3, 14, 4305},
+  {0x0, 0, 1, 4316},
+  {0x0, 0, 1, 4317},
+  {0x0, 3, 4, 4318},
+  {0x0, 0, 1, 4319},
+  {0x0, 4, 12, 4320},
+  {0x4f0, 16, 16, 4328},
+  {0x0, 5, 10, 4328},
+  {0xf993, 16, 16, 4333},
+  {0x2f8a8, 16, 16, 4333},
+  {0x2f91c, 16, 16, 4333},
+  {0x40e, 16, 16, 4333},
+  {0x4ee, 16, 16, 4333},
+  {0x0, 5, 6, 4333},
+  {0x2f986, 16, 16, 4334},
+  {0x0, 11, 12, 4334},
+  {0xf922, 16, 16, 4335},
+  {0x0, 5, 6, 4335},
+  {0x1fcc, 16, 16, 4336},
+  {0x0, 0, 1, 4336},
+  {0x0, 3, 4, 4337},
+  {0x0, 0, 1, 4338},
+  {0x0, 9, 10, 4339},
+  {0x0, 9, 10, 4340},
+  {0x3056, 16, 16, 4341},
+  {0x0, 7, 16, 4341},
+  {0xf9da, 16, 16, 4350},
+  {0x0, 7, 8, 4350},
+  {0x2f96e, 16, 16, 4351},
+  {0xf9d9, 16, 16, 4351},
+  {0x4f2, 16, 16, 4351},
+  {0x2f8a6, 16, 16, 4351},
+  {0x0, 8, 9, 4351},
+  {0x2f869, 16, 16, 4352},
+  {0x0, 8, 9, 4352},
+  {0xf9ef, 16, 16, 4353},
+  {0x0, 5, 6, 4353},
+  {0x2f8e0, 16, 16, 4354},
+  {0x0, 0, 9, 4354},
+  {0x0, 11, 12, 4363},
+  {0x2f94a, 16, 16, 4364},
+  {0x0, 0, 10, 4364},
+  {0x0, 13, 14, 4374},
+  {0xf9c4, 16, 16, 4375},
+  {0x2f8e5, 16, 16, 4375},
+  {0x0, 0, 1, 4375},
+  {0x1e1a, 16, 16, 4376},
+  {0x0, 10, 11, 4376},
+  {0x0, 11, 12, 4377},
+  {0x2f91f, 16, 16, 4378},
+  {0x0, 0, 1, 4378},
+  {0x0, 0, 1, 4379},
+  {0x0, 3, 4, 4380},
+  {0x0, 0, 3, 4381},
+  {0x0, 0, 16, 4384},
+  {0x200, 16, 16, 4400},
+  {0x1cd, 16, 16, 4400},
+  {0xc5, 16, 16, 4400},
+  {0x0, 13, 14, 4400},
+  {0x2f8d6, 16, 16, 4401},
+  {0x0, 5, 6, 4401},
+  {0xf976, 16, 16, 4402},
+  {0x0, 6, 12, 4402},
+  {0xf9b5, 16, 16, 4408},
+  {0x0, 0, 1, 4408},
+  {0x0, 0, 1, 4409},
+  {0x0, 3, 4, 4410},
+  {0x0, 0, 4, 4411},
+  {0x0, 3, 14, 4415},
+  {0x21a, 16, 16, 4426},
+  {0x162, 16, 16, 4426},
+  {0x1e6c, 16, 16, 4426},
+  {0x0, 0, 2, 4426},
+  {0x1f05, 16, 16, 4428},
+  {0x1f03, 16, 16, 4428},
+  {0x0, 1, 2, 4428},
+  {0x2f8ef, 16, 16, 4429},
+  {0x0, 7, 8, 4429},
+  {0x2f9ce, 16, 16, 4430},
+  {0xf92d, 16, 16, 4430},
+  {0x0, 10, 15, 4430},
+  {0x0, 8, 9, 4435},
+  {0x2f860, 16, 16, 4436},
+  {0x1e70, 16, 16, 4436},
+  {0x0, 4, 5, 4436},
+  {0xfa2d, 16, 16, 4437},
+  {0x0, 12, 13, 4437},
+  {0x2f8c9, 16, 16, 4438},
+  {0x102, 16, 16, 4438},
+  {0x226, 16, 16, 4438},
+  {0x100, 16, 16, 4438},
+  {0xc2, 16, 16, 4438},
+  {0xc3, 16, 16, 4438},
+  {0xc0, 16, 16, 4438},
+  {0xc1, 16, 16, 4438},
+  {0x0, 2, 3, 4438},
+  {0x2fa06, 16, 16, 4439},
+  {0x0, 2, 3, 4439},
+  {0x1f57, 16, 16, 4440},
+  {0x0, 5, 6, 4440},
+  {0x2f9d2, 16, 16, 4441},
+  {0xc4, 16, 16, 4441},
+  {0x1ea2, 16, 16, 4441},
+  {0x0, 8, 9, 4441},
+  {0x2f8bb, 16, 16, 4442},
+  {0x0, 15, 16, 4442},
+  {0xf910, 16, 16, 4443},
+  {0x0, 0, 1, 4443},
+  {0x0, 0, 1, 4444},
+  {0x0, 3, 4, 4445},
+  {0x0, 0, 1, 4446},
+  {0x0, 1, 8, 4447},
+  {0x1e57, 16, 16, 4454},
+  {0x1e55, 16, 16, 4454},
+  {0x0, 3, 4, 4454},
+  {0xf9e0, 16, 16, 4455},
+  {0x0, 0, 1, 4455},
+  {0x0, 0, 1, 4456},
+  {0x0, 3, 4, 4457},
+  {0x0, 0, 3, 4458},
+  {0x0, 0, 16, 4461},
+  {0xd5, 16, 16, 4477},
+  {0x0, 0, 10, 4477},
+  {0x1ee0, 16, 16, 4487},
+  {0x1eda, 16, 16, 4487},
+  {0x1edc, 16, 16, 4487},
+  {0x0, 0, 1, 4487},
+  {0x0, 0, 1, 4488},
+  {0x0, 3, 4, 4489},
+  {0x0, 3, 4, 4490},
+  {0x0, 8, 9, 4491},
+  {0x22ea, 16, 16, 4492},
+  {0x1ede, 16, 16, 4492},
+  {0x0, 1, 16, 4492},
+  {0x0, 14, 15, 4507},
+  {0x2f852, 16, 16, 4508},
+  {0x0, 0, 12, 4508},
+  {0x2f8b2, 16, 16, 4520},
+  {0x0, 12, 14, 4520},
+  {0x0, 4, 5, 4522},
+  {0x2f9de, 16, 16, 4523},
+  {0x0, 12, 13, 4523},
+  {0x2f88a, 16, 16, 4524},
+  {0x0, 0, 14, 4524},
+  {0xfa32, 16, 16, 4538},
+  {0x0, 0, 1, 4538},
+  {0x0, 0, 1, 4539},
+  {0x0, 3, 4, 4540},
+  {0x0, 0, 1, 4541},
+  {0x0, 7, 8, 4542},
+  {0x1e67, 16, 16, 4543},
+  {0x0, 8, 9, 4543},
+  {0x2f9b8, 16, 16, 4544},
+  {0x0, 9, 10, 4544},
+  {0x2f8de, 16, 16, 4545},
+  {0x1f7c, 16, 16, 4545},
+  {0x0, 2, 3, 4545},
+  {0x1fdf, 16, 16, 4546},
+  {0x0, 6, 7, 4546},
+  {0x0, 11, 12, 4547},
+  {0x2f9a5, 16, 16, 4548},
+  {0x0, 6, 7, 4548},
+  {0xfa01, 16, 16, 4549},
+  {0x0, 9, 10, 4549},
+  {0x2f809, 16, 16, 4550},
+  {0x0, 4, 14, 4550},
+  {0x0, 15, 16, 4560},
+  {0x2f81c, 16, 16, 4561},
+  {0x0, 9, 10, 4561},
+  {0x2f9b7, 16, 16, 4562},
+  {0x0, 12, 15, 4562},
+  {0xf973, 16, 16, 4565},
+  {0x0, 0, 1, 4565},
+  {0x0, 3, 4, 4566},
+  {0x0, 0, 1, 4567},
+  {0x0, 9, 10, 4568},
+  {0x0, 9, 10, 4569},
+  {0x30c0, 16, 16, 4570},
+  {0x0, 3, 5, 4570},
+  {0x1f08, 16, 16, 4572},
+  {0x2f8b3, 16, 16, 4572},
+  {0x1f09, 16, 16, 4572},
+  {0x2f8ba, 16, 16, 4572},
+  {0x0, 0, 1, 4572},
+  {0x0, 0, 1, 4573},
+  {0x0, 3, 4, 4574},
+  {0x0, 0, 5, 4575},
+  {0x0, 0, 2, 4580},
+  {0x1fd2, 16, 16, 4582},
+  {0x390, 16, 16, 4582},
+  {0xfa0c, 16, 16, 4582},
+  {0x0, 0, 1, 4582},
+  {0x0, 0, 1, 4583},
+  {0x0, 3, 4, 4584},
+  {0x0, 0, 1, 4585},
+  {0x0, 1, 2, 4586},
+  {0x1e79, 16, 16, 4587},
+  {0x0, 4, 16, 4587},
+  {0x2f8ad, 16, 16, 4599},
+  {0x0, 2, 3, 4599},
+  {0x0, 15, 16, 4600},
+  {0x2f958, 16, 16, 4601},
+  {0x0, 5, 8, 4601},
+  {0x2f81b, 16, 16, 4604},
+  {0x0, 0, 1, 4604},
+  {0x0, 0, 1, 4605},
+  {0x0, 3, 4, 4606},
+  {0x0, 3, 4, 4607},
+  {0x0, 8, 9, 4608},
+  {0x2275, 16, 16, 4609},
+  {0x0, 0, 13, 4609},
+  {0x148, 16, 16, 4622},
+  {0x0, 0, 15, 4622},
+  {0x0, 14, 15, 4637},
+  {0x2f985, 16, 16, 4638},
+  {0x0, 0, 7, 4638},
+  {0xfa66, 16, 16, 4645},
+  {0xf971, 16, 16, 4645},
+  {0x0, 1, 2, 4645},
+  {0x20b, 16, 16, 4646},
+  {0x0, 0, 1, 4646},
+  {0x0, 0, 1, 4647},
+  {0x0, 3, 4, 4648},
+  {0x0, 0, 5, 4649},
+  {0x0, 2, 3, 4654},
+  {0x1fe6, 16, 16, 4655},
+  {0x0, 2, 3, 4655},
+  {0x1f3f, 16, 16, 4656},
+  {0x0, 7, 8, 4656},
+  {0x0, 1, 2, 4657},
+  {0x0, 0, 1, 4658},
+  {0x0, 0, 1, 4659},
+  {0x0, 15, 16, 4660},
+  {0x0, 7, 9, 4661},
+  {0x0, 0, 1, 4663},
+  {0xf81, 16, 16, 4664},
+  {0x0, 0, 1, 4664},
+  {0x0, 0, 1, 4665},
+  {0x0, 3, 4, 4666},
+  {0x0, 4, 5, 4667},
+  {0x0, 5, 6, 4668},
+  {0x1fb2, 16, 16, 4669},
+  {0x0, 3, 4, 4669},
+  {0x1e04, 16, 16, 4670},
+  {0x0, 1, 2, 4670},
+  {0x2f96d, 16, 16, 4671},
+  {0x0, 0, 16, 4671},
+  {0x2f95b, 16, 16, 4687},
+  {0x2f95a, 16, 16, 4687},
+  {0x1e45, 16, 16, 4687},
+  {0x1f9, 16, 16, 4687},
+  {0x144, 16, 16, 4687},
+  {0x0, 9, 10, 4687},
+  {0x2f9eb, 16, 16, 4688},
+  {0xf1, 16, 16, 4688},
+  {0x0, 0, 1, 4688},
+  {0x0, 0, 1, 4689},
+  {0x0, 3, 4, 4690},
+  {0x0, 0, 1, 4691},
+  {0x0, 2, 7, 4692},
+  {0x1ead, 16, 16, 4697},
+  {0x0, 9, 10, 4697},
+  {0x2f913, 16, 16, 4698},
+  {0x1eb7, 16, 16, 4698},
+  {0x0, 0, 1, 4698},
+  {0x0, 0, 1, 4699},
+  {0x0, 3, 4, 4700},
+  {0x0, 0, 4, 4701},
+  {0x0, 0, 13, 4705},
+  {0x147, 16, 16, 4718},
+  {0x0, 11, 14, 4718},
+  {0xfa09, 16, 16, 4721},
+  {0x0, 8, 9, 4721},
+  {0x2f83d, 16, 16, 4722},
+  {0x0, 10, 12, 4722},
+  {0x0, 7, 8, 4724},
+  {0x2f987, 16, 16, 4725},
+  {0x0, 3, 4, 4725},
+  {0x2f951, 16, 16, 4726},
+  {0x0, 5, 9, 4726},
+  {0x0, 14, 15, 4730},
+  {0x2f910, 16, 16, 4731},
+  {0xfa54, 16, 16, 4731},
+  {0x0, 10, 11, 4731},
+  {0xfa46, 16, 16, 4732},
+  {0x0, 3, 4, 4732},
+  {0x2f86d, 16, 16, 4733},
+  {0x0, 0, 16, 4733},
+  {0x1ecf, 16, 16, 4749},
+  {0xf6, 16, 16, 4749},
+  {0x14d, 16, 16, 4749},
+  {0x0, 3, 4, 4749},
+  {0x2f9a0, 16, 16, 4750},
+  {0x14f, 16, 16, 4750},
+  {0xf3, 16, 16, 4750},
+  {0xf2, 16, 16, 4750},
+  {0xf5, 16, 16, 4750},
+  {0xf4, 16, 16, 4750},
+  {0x0, 5, 6, 4750},
+  {0x2f8c0, 16, 16, 4751},
+  {0x0, 6, 7, 4751},
+  {0x2f841, 16, 16, 4752},
+  {0x0, 0, 1, 4752},
+  {0x0, 0, 1, 4753},
+  {0x0, 3, 4, 4754},
+  {0x0, 4, 5, 4755},
+  {0x0, 5, 6, 4756},
+  {0x1f9d, 16, 16, 4757},
+  {0x0, 15, 16, 4757},
+  {0xf93c, 16, 16, 4758},
+  {0x0, 0, 13, 4758},
+  {0xf9fd, 16, 16, 4771},
+  {0x0, 0, 2, 4771},
+  {0x1f65, 16, 16, 4773},
+  {0x1f63, 16, 16, 4773},
+  {0x2f8ae, 16, 16, 4773},
+  {0x0, 0, 1, 4773},
+  {0x0, 0, 1, 4774},
+  {0x0, 3, 4, 4775},
+  {0x0, 0, 1, 4776},
+  {0x0, 4, 5, 4777},
+  {0x231, 16, 16, 4778},
+  {0x0, 2, 4, 4778},
+  {0x2f942, 16, 16, 4780},
+  {0x2f941, 16, 16, 4780},
+  {0xf951, 16, 16, 4780},
+  {0x0, 8, 9, 4780},
+  {0x2f8ee, 16, 16, 4781},
+  {0x2f819, 16, 16, 4781},
+  {0x20d, 16, 16, 4781},
+  {0x1d2, 16, 16, 4781},
+  {0x151, 16, 16, 4781},
+  {0x0, 0, 1, 4781},
+  {0x0, 0, 1, 4782},
+  {0x0, 3, 4, 4783},
+  {0x0, 0, 3, 4784},
+  {0x0, 3, 4, 4787},
+  {0x1e7f, 16, 16, 4788},
+  {0x0, 14, 15, 4788},
+  {0x2f80c, 16, 16, 4789},
+  {0x2f828, 16, 16, 4789},
+  {0x0, 15, 16, 4789},
+  {0x2f980, 16, 16, 4790},
+  {0x0, 5, 10, 4790},
+  {0x2f931, 16, 16, 4795},
+  {0x0, 14, 15, 4795},
+  {0x2f98d, 16, 16, 4796},
+  {0x0, 9, 10, 4796},
+  {0xfa63, 16, 16, 4797},
+  {0xf994, 16, 16, 4797},
+  {0x0, 14, 16, 4797},
+  {0x2f947, 16, 16, 4799},
+  {0x0, 2, 8, 4799},
+  {0x0, 0, 1, 4805},
+  {0x0, 0, 1, 4806},
+  {0x0, 3, 4, 4807},
+  {0x0, 3, 4, 4808},
+  {0x0, 8, 9, 4809},
+  {0x2289, 16, 16, 4810},
+  {0x0, 13, 14, 4810},
+  {0x0, 1, 2, 4811},
+  {0x2f90d, 16, 16, 4812},
+  {0x0, 7, 8, 4812},
+  {0x2f8a5, 16, 16, 4813},
+  {0x0, 5, 11, 4813},
+  {0xf9a7, 16, 16, 4819},
+  {0x0, 9, 12, 4819},
+  {0x2f813, 16, 16, 4822},
+  {0x0, 8, 10, 4822},
+  {0x0, 15, 16, 4824},
+  {0x2f939, 16, 16, 4825},
+  {0x0, 0, 1, 4825},
+  {0x0, 0, 1, 4826},
+  {0x0, 3, 4, 4827},
+  {0x0, 0, 1, 4828},
+  {0x0, 0, 10, 4829},
+  {0x1ec1, 16, 16, 4839},
+  {0x0, 10, 11, 4839},
+  {0xf911, 16, 16, 4840},
+  {0x2f928, 16, 16, 4840},
+  {0x0, 11, 12, 4840},
+  {0xf9c8, 16, 16, 4841},
+  {0x0, 0, 1, 4841},
+  {0xf962, 16, 16, 4842},
+  {0x0, 14, 15, 4842},
+  {0xf957, 16, 16, 4843},
+  {0x0, 0, 1, 4843},
+  {0x0, 0, 1, 4844},
+  {0x0, 3, 4, 4845},
+  {0x0, 0, 1, 4846},
+  {0x0, 4, 5, 4847},
+  {0x1e1, 16, 16, 4848},
+  {0x0, 1, 2, 4848},
+  {0x1e6e, 16, 16, 4849},
+  {0x0, 10, 11, 4849},
+  {0x2f8aa, 16, 16, 4850},
+  {0x0, 8, 9, 4850},
+  {0xf9c5, 16, 16, 4851},
+  {0x0, 0, 1, 4851},
+  {0x0, 0, 1, 4852},
+  {0x0, 3, 4, 4853},
+  {0x0, 0, 1, 4854},
+  {0x0, 4, 5, 4855},
+  {0x1df, 16, 16, 4856},
+  {0x0, 0, 2, 4856},
+  {0x1f02, 16, 16, 4858},
+  {0x1f04, 16, 16, 4858},
+  {0x0, 14, 15, 4858},
+  {0xf984, 16, 16, 4859},
+  {0x0, 2, 3, 4859},
+  {0x0, 5, 6, 4860},
+  {0x0, 0, 1, 4861},
+  {0x0, 1, 2, 4862},
+  {0x0, 0, 1, 4863},
+  {0x0, 2, 3, 4864},
+  {0x0, 14, 15, 4865},
+  {0x1026, 16, 16, 4866},
+  {0x0, 14, 15, 4866},
+  {0x2f8fa, 16, 16, 4867},
+  {0x2f9ca, 16, 16, 4867},
+  {0x0, 0, 1, 4867},
+  {0x0, 0, 1, 4868},
+  {0x0, 3, 4, 4869},
+  {0x0, 0, 5, 4870},
+  {0x0, 0, 2, 4875},
+  {0x1f25, 16, 16, 4877},
+  {0x0, 11, 16, 4877},
+  {0x2f806, 16, 16, 4882},
+  {0x0, 1, 2, 4882},
+  {0x202, 16, 16, 4883},
+  {0x0, 0, 1, 4883},
+  {0x2f8b7, 16, 16, 4884},
+  {0x0, 2, 3, 4884},
+  {0x2f982, 16, 16, 4885},
+  {0x0, 8, 10, 4885},
+  {0x0, 0, 1, 4887},
+  {0x0, 0, 1, 4888},
+  {0x0, 3, 4, 4889},
+  {0x0, 0, 1, 4890},
+  {0x0, 8, 9, 4891},
+  {0x4ea, 16, 16, 4892},
+  {0x0, 0, 1, 4892},
+  {0xf98f, 16, 16, 4893},
+  {0x0, 13, 15, 4893},
+  {0x0, 13, 14, 4895},
+  {0x2f9e1, 16, 16, 4896},
+  {0x0, 0, 1, 4896},
+  {0x0, 0, 1, 4897},
+  {0x0, 3, 4, 4898},
+  {0x0, 0, 2, 4899},
+  {0x0, 0, 2, 4901},
+  {0x38c, 16, 16, 4903},
+  {0x0, 2, 7, 4903},
+  {0xf90d, 16, 16, 4908},
+  {0x0, 2, 3, 4908},
+  {0x2f875, 16, 16, 4909},
+  {0x0, 14, 15, 4909},
+  {0xf9d2, 16, 16, 4910},
+  {0x0, 10, 11, 4910},
+  {0xf902, 16, 16, 4911},
+  {0x22f, 16, 16, 4911},
+  {0x0, 2, 3, 4911},
+  {0x1f56, 16, 16, 4912},
+  {0x0, 3, 8, 4912},
+  {0x15e, 16, 16, 4917},
+  {0x218, 16, 16, 4917},
+  {0x1e62, 16, 16, 4917},
+  {0x0, 2, 7, 4917},
+  {0xf9ba, 16, 16, 4922},
+  {0xf91b, 16, 16, 4922},
+  {0x0, 3, 10, 4922},
+  {0x0, 6, 7, 4929},
+  {0x2f916, 16, 16, 4930},
+  {0x0, 0, 1, 4930},
+  {0x0, 0, 1, 4931},
+  {0x0, 3, 4, 4932},
+  {0x0, 3, 4, 4933},
+  {0x0, 8, 9, 4934},
+  {0x22ae, 16, 16, 4935},
+  {0x0, 7, 8, 4935},
+  {0x2f973, 16, 16, 4936},
+  {0x0, 0, 1, 4936},
+  {0x0, 0, 1, 4937},
+  {0x0, 3, 4, 4938},
+  {0x0, 4, 5, 4939},
+  {0x0, 5, 6, 4940},
+  {0x1fa6, 16, 16, 4941},
+  {0x0, 0, 1, 4941},
+  {0x0, 0, 1, 4942},
+  {0x0, 3, 4, 4943},
+  {0x0, 0, 1, 4944},
+  {0x0, 0, 2, 4945},
+  {0x1f42, 16, 16, 4947},
+  {0x1f44, 16, 16, 4947},
+  {0x0, 3, 4, 4947},
+  {0x2f843, 16, 16, 4948},
+  {0x0, 10, 11, 4948},
+  {0x0, 3, 4, 4949},
+  {0x2f8ec, 16, 16, 4950},
+  {0x0, 0, 10, 4950},
+  {0x1edd, 16, 16, 4960},
+  {0x1edb, 16, 16, 4960},
+  {0x0, 15, 16, 4960},
+  {0xf9eb, 16, 16, 4961},
+  {0x1ee1, 16, 16, 4961},
+  {0x1edf, 16, 16, 4961},
+  {0x622, 16, 16, 4961},
+  {0x0, 0, 1, 4961},
+  {0x0, 3, 4, 4962},
+  {0x0, 0, 1, 4963},
+  {0x0, 9, 10, 4964},
+  {0x0, 9, 11, 4965},
+  {0x30d3, 16, 16, 4967},
+  {0x0, 1, 4, 4967},
+  {0x0, 12, 13, 4970},
+  {0x2f8a2, 16, 16, 4971},
+  {0x0, 0, 1, 4971},
+  {0xf944, 16, 16, 4972},
+  {0x0, 0, 1, 4972},
+  {0x1e2c, 16, 16, 4973},
+  {0x0, 0, 1, 4973},
+  {0x0, 0, 1, 4974},
+  {0x0, 3, 4, 4975},
+  {0x0, 0, 4, 4976},
+  {0x0, 3, 8, 4980},
+  {0x1e33, 16, 16, 4985},
+  {0x0, 2, 3, 4985},
+  {0x2f888, 16, 16, 4986},
+  {0x0, 4, 5, 4986},
+  {0x2f80f, 16, 16, 4987},
+  {0x0, 0, 10, 4987},
+  {0x0, 14, 15, 4997},
+  {0x2fa13, 16, 16, 4998},
+  {0x0, 2, 3, 4998},
+  {0x2f960, 16, 16, 4999},
+  {0x0, 8, 9, 4999},
+  {0x0, 0, 1, 5000},
+  {0x0, 0, 1, 5001},
+  {0x0, 9, 10, 5002},
+  {0x0, 3, 4, 5003},
+  {0x0, 12, 13, 5004},
+  {0x929, 16, 16, 5005},
+  {0x0, 0, 1, 5005},
+  {0x0, 10, 11, 5006},
+  {0x2f8ca, 16, 16, 5007},
+  {0x0, 0, 1, 5007},
+  {0x0, 0, 1, 5008},
+  {0x0, 3, 4, 5009},
+  {0x0, 0, 5, 5010},
+  {0x0, 2, 6, 5015},
+  {0x1fa8, 16, 16, 5019},
+  {0x0, 0, 1, 5019},
+  {0x0, 0, 1, 5020},
+  {0x0, 3, 4, 5021},
+  {0x0, 4, 5, 5022},
+  {0x0, 5, 6, 5023},
+  {0x1f9e, 16, 16, 5024},
+  {0x0, 0, 1, 5024},
+  {0x0, 3, 4, 5025},
+  {0x0, 0, 1, 5026},
+  {0x0, 9, 10, 5027},
+  {0x0, 9, 10, 5028},
+  {0x30fe, 16, 16, 5029},
+  {0x0, 2, 13, 5029},
+  {0x1e27, 16, 16, 5040},
+  {0x1e23, 16, 16, 5040},
+  {0x125, 16, 16, 5040},
+  {0x0, 4, 5, 5040},
+  {0x2f8f1, 16, 16, 5041},
+  {0x0, 3, 5, 5041},
+  {0x1f60, 16, 16, 5043},
+  {0x0, 4, 5, 5043},
+  {0x2f971, 16, 16, 5044},
+  {0x30d4, 16, 16, 5044},
+  {0x1f61, 16, 16, 5044},
+  {0x0, 0, 1, 5044},
+  {0x0, 3, 4, 5045},
+  {0x0, 0, 1, 5046},
+  {0x0, 9, 10, 5047},
+  {0x0, 9, 10, 5048},
+  {0x304c, 16, 16, 5049},
+  {0x0, 0, 1, 5049},
+  {0x0, 0, 1, 5050},
+  {0x0, 3, 4, 5051},
+  {0x0, 0, 1, 5052},
+  {0x0, 1, 2, 5053},
+  {0x1e78, 16, 16, 5054},
+  {0x0, 0, 1, 5054},
+  {0x0, 3, 4, 5055},
+  {0x0, 0, 1, 5056},
+  {0x0, 9, 10, 5057},
+  {0x0, 9, 11, 5058},
+  {0x30d9, 16, 16, 5060},
+  {0x0, 8, 9, 5060},
+  {0xf9b3, 16, 16, 5061},
+  {0x0, 11, 15, 5061},
+  {0x2f914, 16, 16, 5065},
+  {0x0, 8, 14, 5065},
+  {0xfa5c, 16, 16, 5071},
+  {0x0, 0, 2, 5071},
+  {0x1f34, 16, 16, 5073},
+  {0x2f915, 16, 16, 5073},
+  {0x0, 0, 1, 5073},
+  {0x0, 0, 1, 5074},
+  {0x0, 3, 4, 5075},
+  {0x0, 4, 5, 5076},
+  {0x0, 5, 6, 5077},
+  {0x1f85, 16, 16, 5078},
+  {0x0, 4, 15, 5078},
+  {0x2f907, 16, 16, 5089},
+  {0x0, 2, 3, 5089},
+  {0x2f8bf, 16, 16, 5090},
+  {0x0, 15, 16, 5090},
+  {0xf937, 16, 16, 5091},
+  {0x2126, 0, 1, 5091},
+  {0x0, 0, 1, 5092},
+  {0x0, 3, 4, 5093},
+  {0x0, 0, 5, 5094},
+  {0x0, 0, 2, 5099},
+  {0x1ffa, 16, 16, 5101},
+  {0x38f, 16, 16, 5101},
+  {0x0, 4, 13, 5101},
+  {0x0, 0, 1, 5110},
+  {0x0, 0, 1, 5111},
+  {0x0, 3, 4, 5112},
+  {0x0, 0, 1, 5113},
+  {0x0, 1, 2, 5114},
+  {0x1ff, 16, 16, 5115},
+  {0x0, 0, 1, 5115},
+  {0x0, 0, 1, 5116},
+  {0x0, 3, 4, 5117},
+  {0x0, 4, 5, 5118},
+  {0x0, 5, 6, 5119},
+  {0x1f84, 16, 16, 5120},
+  {0xf9f6, 16, 16, 5120},
+  {0x0, 8, 10, 5120},
+  {0x2329, 16, 16, 5122},
+  {0x232a, 16, 16, 5122},
+  {0x0, 0, 1, 5122},
+  {0x0, 0, 1, 5123},
+  {0x0, 3, 4, 5124},
+  {0x0, 3, 4, 5125},
+  {0x0, 8, 9, 5126},
+  {0x2274, 16, 16, 5127},
+  {0x30da, 16, 16, 5127},
+  {0x0, 4, 13, 5127},
+  {0x0, 0, 1, 5136},
+  {0x0, 0, 1, 5137},
+  {0x0, 3, 4, 5138},
+  {0x0, 0, 1, 5139},
+  {0x0, 0, 10, 5140},
+  {0x1ed4, 16, 16, 5150},
+  {0x0, 4, 5, 5150},
+  {0xfa34, 16, 16, 5151},
+  {0x1ed0, 16, 16, 5151},
+  {0x1ed2, 16, 16, 5151},
+  {0x1ed6, 16, 16, 5151},
+  {0x2f900, 16, 16, 5151},
+  {0x0, 4, 5, 5151},
+  {0x2f940, 16, 16, 5152},
+  {0x0, 0, 1, 5152},
+  {0x0, 0, 1, 5153},
+  {0x0, 3, 4, 5154},
+  {0x0, 0, 1, 5155},
+  {0x0, 1, 9, 5156},
+  {0x1e4e, 16, 16, 5164},
+  {0x1e4c, 16, 16, 5164},
+  {0x22c, 16, 16, 5164},
+  {0x0, 9, 15, 5164},
+  {0x2fa18, 16, 16, 5170},
+  {0x0, 12, 13, 5170},
+  {0x0, 8, 9, 5171},
+  {0x2f86c, 16, 16, 5172},
+  {0x0, 7, 8, 5172},
+  {0x2fa0f, 16, 16, 5173},
+  {0x0, 1, 3, 5173},
+  {0x0, 0, 1, 5175},
+  {0x0, 0, 1, 5176},
+  {0x0, 3, 4, 5177},
+  {0x0, 3, 4, 5178},
+  {0x0, 8, 9, 5179},
+  {0x22e2, 16, 16, 5180},
+  {0x0, 4, 5, 5180},
+  {0xfa06, 16, 16, 5181},
+  {0x0, 0, 1, 5181},
+  {0x0, 0, 1, 5182},
+  {0x0, 3, 4, 5183},
+  {0x0, 0, 4, 5184},
+  {0x0, 1, 16, 5188},
+  {0x155, 16, 16, 5203},
+  {0x0, 8, 9, 5203},
+  {0xfa3e, 16, 16, 5204},
+  {0x0, 0, 1, 5204},
+  {0xf93d, 16, 16, 5205},
+  {0x0, 0, 8, 5205},
+  {0x0, 0, 1, 5213},
+  {0x0, 0, 1, 5214},
+  {0x0, 3, 4, 5215},
+  {0x0, 0, 3, 5216},
+  {0x0, 3, 4, 5219},
+  {0x1ef1, 16, 16, 5220},
+  {0x0, 6, 7, 5220},
+  {0x2f935, 16, 16, 5221},
+  {0x2fa17, 16, 16, 5221},
+  {0x0, 14, 15, 5221},
+  {0xfa48, 16, 16, 5222},
+  {0x0, 15, 16, 5222},
+  {0xf939, 16, 16, 5223},
+  {0x0, 0, 1, 5223},
+  {0x0, 0, 1, 5224},
+  {0x0, 3, 4, 5225},
+  {0x0, 0, 1, 5226},
+  {0x0, 12, 13, 5227},
+  {0x1ee, 16, 16, 5228},
+  {0x0, 8, 9, 5228},
+  {0x2fa11, 16, 16, 5229},
+  {0x0, 8, 9, 5229},
+  {0x2f97e, 16, 16, 5230},
+  {0x0, 4, 5, 5230},
+  {0xfa12, 16, 16, 5231},
+  {0x0, 0, 1, 5231},
+  {0x0, 3, 4, 5232},
+  {0x0, 0, 1, 5233},
+  {0x0, 9, 10, 5234},
+  {0x0, 9, 10, 5235},
+  {0x305c, 16, 16, 5236},
+  {0x0, 10, 11, 5236},
+  {0x2f954, 16, 16, 5237},
+  {0x0, 7, 13, 5237},
+  {0x1e6a, 16, 16, 5243},
+  {0x0, 0, 1, 5243},
+  {0x0, 0, 1, 5244},
+  {0x0, 3, 4, 5245},
+  {0x0, 0, 1, 5246},
+  {0x0, 1, 2, 5247},
+  {0x344, 16, 16, 5248},
+  {0x0, 0, 1, 5248},
+  {0x0, 0, 1, 5249},
+  {0x0, 3, 4, 5250},
+  {0x0, 0, 1, 5251},
+  {0x0, 0, 2, 5252},
+  {0x1f45, 16, 16, 5254},
+  {0x1f43, 16, 16, 5254},
+  {0x0, 0, 1, 5254},
+  {0x0, 0, 1, 5255},
+  {0x0, 3, 4, 5256},
+  {0x0, 0, 4, 5257},
+  {0x0, 1, 2, 5261},
+  {0x1e94, 16, 16, 5262},
+  {0x0, 15, 16, 5262},
+  {0xf9bd, 16, 16, 5263},
+  {0x0, 1, 13, 5263},
+  {0xfa43, 16, 16, 5275},
+  {0x0, 0, 1, 5275},
+  {0x0, 0, 1, 5276},
+  {0x0, 3, 4, 5277},
+  {0x0, 0, 1, 5278},
+  {0x0, 0, 2, 5279},
+  {0x1e51, 16, 16, 5281},
+  {0x1e53, 16, 16, 5281},
+  {0x0, 3, 4, 5281},
+  {0x2f889, 16, 16, 5282},
+  {0x0, 3, 9, 5282},
+  {0x104, 16, 16, 5288},
+  {0x164, 16, 16, 5288},
+  {0x0, 7, 8, 5288},
+  {0x2fa05, 16, 16, 5289},
+  {0x1ea0, 16, 16, 5289},
+  {0x1e00, 16, 16, 5289},
+  {0x0, 13, 14, 5289},
+  {0x0, 0, 1, 5290},
+  {0x0, 3, 4, 5291},
+  {0x0, 0, 1, 5292},
+  {0x0, 9, 10, 5293},
+  {0x0, 9, 10, 5294},
+  {0x309e, 16, 16, 5295},
+  {0x0, 2, 3, 5295},
+  {0x2f840, 16, 16, 5296},
+  {0x0, 10, 11, 5296},
+  {0x2f948, 16, 16, 5297},
+  {0x2f8d5, 16, 16, 5297},
+  {0x0, 11, 12, 5297},
+  {0xf9f7, 16, 16, 5298},
+  {0x0, 0, 1, 5298},
+  {0x0, 0, 1, 5299},
+  {0x0, 3, 4, 5300},
+  {0x0, 0, 1, 5301},
+  {0x0, 6, 9, 5302},
+  {0x4c1, 16, 16, 5305},
+  {0x1f24, 16, 16, 5305},
+  {0x0, 0, 1, 5305},
+  {0x0, 0, 1, 5306},
+  {0x0, 3, 4, 5307},
+  {0x0, 0, 5, 5308},
+  {0x0, 2, 6, 5313},
+  {0x1f6f, 16, 16, 5317},
+  {0x4dc, 16, 16, 5317},
+  {0x0, 0, 1, 5317},
+  {0x0, 0, 1, 5318},
+  {0x0, 3, 4, 5319},
+  {0x0, 0, 1, 5320},
+  {0x0, 1, 2, 5321},
+  {0x1fe, 16, 16, 5322},
+  {0x1fa9, 16, 16, 5322},
+  {0x0, 13, 14, 5322},
+  {0x2f99b, 16, 16, 5323},
+  {0x0, 0, 1, 5323},
+  {0x0, 0, 1, 5324},
+  {0x0, 3, 4, 5325},
+  {0x0, 3, 4, 5326},
+  {0x0, 8, 9, 5327},
+  {0x2204, 16, 16, 5328},
+  {0x0, 10, 12, 5328},
+  {0x0, 8, 9, 5330},
+  {0x2f92d, 16, 16, 5331},
+  {0x0, 0, 1, 5331},
+  {0x0, 0, 1, 5332},
+  {0x0, 3, 4, 5333},
+  {0x0, 0, 1, 5334},
+  {0x0, 0, 10, 5335},
+  {0x1ec2, 16, 16, 5345},
+  {0x1ebe, 16, 16, 5345},
+  {0x1ec0, 16, 16, 5345},
+  {0x1ec4, 16, 16, 5345},
+  {0x0, 2, 3, 5345},
+  {0x2f9e0, 16, 16, 5346},
+  {0x0, 2, 3, 5346},
+  {0x0, 12, 13, 5347},
+  {0x2f834, 16, 16, 5348},
+  {0x0, 7, 9, 5348},
+  {0x2f904, 16, 16, 5350},
+  {0x0, 6, 7, 5350},
+  {0x0, 0, 1, 5351},
+  {0x0, 0, 1, 5352},
+  {0x0, 3, 4, 5353},
+  {0x0, 0, 1, 5354},
+  {0x0, 8, 9, 5355},
+  {0x457, 16, 16, 5356},
+  {0x0, 0, 1, 5356},
+  {0x0, 0, 1, 5357},
+  {0x0, 3, 4, 5358},
+  {0x0, 0, 2, 5359},
+  {0x0, 0, 2, 5361},
+  {0x3ad, 16, 16, 5363},
+  {0x0, 0, 14, 5363},
+  {0x0, 8, 9, 5377},
+  {0x2f8eb, 16, 16, 5378},
+  {0x0, 0, 1, 5378},
+  {0x0, 0, 1, 5379},
+  {0x0, 3, 4, 5380},
+  {0x0, 0, 3, 5381},
+  {0x0, 3, 8, 5384},
+  {0x1e63, 16, 16, 5389},
+  {0x15f, 16, 16, 5389},
+  {0x219, 16, 16, 5389},
+  {0x0, 0, 1, 5389},
+  {0x0, 0, 1, 5390},
+  {0x0, 3, 4, 5391},
+  {0x0, 3, 4, 5392},
+  {0x0, 8, 9, 5393},
+  {0x2285, 16, 16, 5394},
+  {0x4ef, 16, 16, 5394},
+  {0xcf, 16, 16, 5394},
+  {0x0, 0, 1, 5394},
+  {0x0, 0, 1, 5395},
+  {0x0, 13, 14, 5396},
+  {0x0, 12, 14, 5397},
+  {0x0, 15, 16, 5399},
+  {0xdde, 16, 16, 5400},
+  {0x4f1, 16, 16, 5400},
+  {0x130, 16, 16, 5400},
+  {0x12a, 16, 16, 5400},
+  {0xce, 16, 16, 5400},
+  {0x128, 16, 16, 5400},
+  {0xcc, 16, 16, 5400},
+  {0xcd, 16, 16, 5400},
+  {0x0, 10, 11, 5400},
+  {0x2f8ea, 16, 16, 5401},
+  {0x0, 2, 6, 5401},
+  {0x1fc3, 16, 16, 5405},
+  {0x0, 7, 8, 5405},
+  {0x1e02, 16, 16, 5406},
+  {0x1fc6, 16, 16, 5406},
+  {0x0, 2, 4, 5406},
+  {0x0, 0, 1, 5408},
+  {0x0, 0, 1, 5409},
+  {0x0, 3, 4, 5410},
+  {0x0, 0, 1, 5411},
+  {0x0, 0, 10, 5412},
+  {0x1eaf, 16, 16, 5422},
+  {0x0, 2, 16, 5422},
+  {0x2fa02, 16, 16, 5436},
+  {0x0, 2, 6, 5436},
+  {0x1fb3, 16, 16, 5440},
+  {0x0, 0, 1, 5440},
+  {0x0, 0, 1, 5441},
+  {0x0, 3, 4, 5442},
+  {0x0, 0, 1, 5443},
+  {0x0, 8, 9, 5444},
+  {0x4f4, 16, 16, 5445},
+  {0x1fb6, 16, 16, 5445},
+  {0x0, 6, 7, 5445},
+  {0xfa1c, 16, 16, 5446},
+  {0x0, 2, 3, 5446},
+  {0x1f37, 16, 16, 5447},
+  {0x0, 13, 14, 5447},
+  {0x2f815, 16, 16, 5448},
+  {0x0, 11, 12, 5448},
+  {0x2f855, 16, 16, 5449},
+  {0x0, 12, 14, 5449},
+  {0x2f8fd, 16, 16, 5451},
+  {0x4f3, 16, 16, 5451},
+  {0xf968, 16, 16, 5451},
+  {0x208, 16, 16, 5451},
+  {0x0, 1, 2, 5451},
+  {0xf90a, 16, 16, 5452},
+  {0x1cf, 16, 16, 5452},
+  {0x0, 14, 15, 5452},
+  {0xf9c6, 16, 16, 5453},
+  {0xfa2a, 16, 16, 5453},
+  {0x0, 3, 5, 5453},
+  {0x1f68, 16, 16, 5455},
+  {0x1f69, 16, 16, 5455},
+  {0x0, 1, 5, 5455},
+  {0x2f98c, 16, 16, 5459},
+  {0x2f893, 16, 16, 5459},
+  {0x0, 8, 9, 5459},
+  {0xf926, 16, 16, 5460},
+  {0x0, 3, 9, 5460},
+  {0x1ecd, 16, 16, 5466},
+  {0x0, 0, 1, 5466},
+  {0x0, 3, 4, 5467},
+  {0x0, 0, 1, 5468},
+  {0x0, 9, 10, 5469},
+  {0x0, 9, 10, 5470},
+  {0x3052, 16, 16, 5471},
+  {0x1eb, 16, 16, 5471},
+  {0x0, 0, 10, 5471},
+  {0xf975, 16, 16, 5481},
+  {0x2f8c1, 16, 16, 5481},
+  {0x0, 0, 1, 5481},
+  {0x0, 0, 1, 5482},
+  {0x0, 3, 4, 5483},
+  {0x0, 0, 4, 5484},
+  {0x0, 7, 13, 5488},
+  {0x1e0a, 16, 16, 5494},
+  {0x0, 0, 1, 5494},
+  {0x2f9dc, 16, 16, 5495},
+  {0x0, 0, 1, 5495},
+  {0x1e1b, 16, 16, 5496},
+  {0x0, 2, 15, 5496},
+  {0xf952, 16, 16, 5509},
+  {0x0, 13, 14, 5509},
+  {0xfa1e, 16, 16, 5510},
+  {0x0, 4, 5, 5510},
+  {0x2f8d1, 16, 16, 5511},
+  {0x10e, 16, 16, 5511},
+  {0x0, 14, 15, 5511},
+  {0xf977, 16, 16, 5512},
+  {0x0, 0, 1, 5512},
+  {0xfa60, 16, 16, 5513},
+  {0x0, 10, 12, 5513},
+  {0x0, 1, 2, 5515},
+  {0x2f93b, 16, 16, 5516},
+  {0x0, 3, 4, 5516},
+  {0x1e7d, 16, 16, 5517},
+  {0x0, 0, 1, 5517},
+  {0x0, 0, 1, 5518},
+  {0x0, 3, 4, 5519},
+  {0x0, 4, 5, 5520},
+  {0x0, 5, 6, 5521},
+  {0x1fac, 16, 16, 5522},
+  {0x0, 1, 2, 5522},
+  {0x0, 8, 9, 5523},
+  {0x2f871, 16, 16, 5524},
+  {0x0, 10, 13, 5524},
+  {0xf947, 16, 16, 5527},
+  {0x2f950, 16, 16, 5527},
+  {0x0, 0, 1, 5527},
+  {0x0, 0, 1, 5528},
+  {0x0, 3, 4, 5529},
+  {0x0, 4, 5, 5530},
+  {0x0, 5, 6, 5531},
+  {0x1ff7, 16, 16, 5532},
+  {0x0, 10, 15, 5532},
+  {0xf96c, 16, 16, 5537},
+  {0x0, 0, 1, 5537},
+  {0x0, 0, 1, 5538},
+  {0x0, 3, 4, 5539},
+  {0x0, 0, 1, 5540},
+  {0x0, 8, 9, 5541},
+  {0x4ec, 16, 16, 5542},
+  {0xfa10, 16, 16, 5542},
+  {0x0, 0, 10, 5542},
+  {0x0, 10, 11, 5552},
+  {0x2f9fb, 16, 16, 5553},
+  {0xf92f, 16, 16, 5553},
+  {0x0, 6, 7, 5553},
+  {0xf98b, 16, 16, 5554},
+  {0x0, 4, 5, 5554},
+  {0x2f8e6, 16, 16, 5555},
+  {0x0, 0, 1, 5555},
+  {0x0, 0, 1, 5556},
+  {0x0, 3, 4, 5557},
+  {0x0, 4, 5, 5558},
+  {0x0, 5, 6, 5559},
+  {0x1fab, 16, 16, 5560},
+  {0x0, 7, 8, 5560},
+  {0x0, 7, 8, 5561},
+  {0x2f9f1, 16, 16, 5562},
+  {0x0, 0, 1, 5562},
+  {0x0, 0, 1, 5563},
+  {0x0, 3, 4, 5564},
+  {0x0, 0, 1, 5565},
+  {0x0, 4, 5, 5566},
+  {0x22a, 16, 16, 5567},
+  {0x0, 0, 1, 5567},
+  {0x0, 0, 1, 5568},
+  {0x0, 3, 4, 5569},
+  {0x0, 3, 4, 5570},
+  {0x0, 8, 9, 5571},
+  {0x219a, 16, 16, 5572},
+  {0xf92e, 16, 16, 5572},
+  {0xf965, 16, 16, 5572},
+  {0x0, 0, 1, 5572},
+  {0x0, 0, 1, 5573},
+  {0x0, 3, 4, 5574},
+  {0x0, 0, 4, 5575},
+  {0x0, 7, 13, 5579},
+  {0x165, 16, 16, 5585},
+  {0x0, 2, 6, 5585},
+  {0x1f99, 16, 16, 5589},
+  {0x1f2f, 16, 16, 5589},
+  {0x0, 0, 1, 5589},
+  {0x0, 0, 1, 5590},
+  {0x0, 3, 4, 5591},
+  {0x0, 0, 1, 5592},
+  {0x0, 8, 9, 5593},
+  {0x4de, 16, 16, 5594},
+  {0x0, 14, 15, 5594},
+  {0xfa1d, 16, 16, 5595},
+  {0x1ec3, 16, 16, 5595},
+  {0x0, 0, 1, 5595},
+  {0x0, 0, 1, 5596},
+  {0x0, 3, 4, 5597},
+  {0x0, 0, 2, 5598},
+  {0x0, 0, 2, 5600},
+  {0x1f78, 16, 16, 5602},
+  {0x3cc, 16, 16, 5602},
+  {0x1ec5, 16, 16, 5602},
+  {0x1ebf, 16, 16, 5602},
+  {0x0, 11, 12, 5602},
+  {0x2fa1c, 16, 16, 5603},
+  {0x0, 3, 15, 5603},
+  {0x2f8db, 16, 16, 5615},
+  {0x0, 1, 2, 5615},
+  {0xf904, 16, 16, 5616},
+  {0x0, 3, 4, 5616},
+  {0x1e92, 16, 16, 5617},
+  {0x0, 1, 2, 5617},
+  {0x2f9c1, 16, 16, 5618},
+  {0x1e6b, 16, 16, 5618},
+  {0x1e97, 16, 16, 5618},
+  {0x0, 0, 1, 5618},
+  {0x0, 0, 1, 5619},
+  {0x0, 3, 4, 5620},
+  {0x0, 4, 5, 5621},
+  {0x0, 5, 6, 5622},
+  {0x1ff2, 16, 16, 5623},
+  {0x0, 0, 1, 5623},
+  {0x0, 0, 1, 5624},
+  {0x0, 3, 4, 5625},
+  {0x0, 0, 2, 5626},
+  {0x0, 0, 9, 5628},
+  {0x3aa, 16, 16, 5637},
+  {0x0, 0, 1, 5637},
+  {0x0, 0, 1, 5638},
+  {0x0, 3, 4, 5639},
+  {0x0, 0, 1, 5640},
+  {0x0, 6, 9, 5641},
+  {0x4c2, 16, 16, 5644},
+  {0x4dd, 16, 16, 5644},
+  {0x0, 8, 9, 5644},
+  {0x2f885, 16, 16, 5645},
+  {0x1fda, 16, 16, 5645},
+  {0x38a, 16, 16, 5645},
+  {0x1fd8, 16, 16, 5645},
+  {0x1fd9, 16, 16, 5645},
+  {0x0, 5, 10, 5645},
+  {0xf9a3, 16, 16, 5650},
+  {0x0, 0, 1, 5650},
+  {0xf921, 16, 16, 5651},
+  {0x2f89f, 16, 16, 5651},
+  {0x0, 0, 1, 5651},
+  {0x0, 0, 1, 5652},
+  {0x0, 3, 4, 5653},
+  {0x0, 3, 4, 5654},
+  {0x0, 8, 9, 5655},
+  {0x2288, 16, 16, 5656},
+  {0x0, 0, 1, 5656},
+  {0x0, 0, 1, 5657},
+  {0x0, 3, 4, 5658},
+  {0x0, 0, 4, 5659},
+  {0x0, 1, 12, 5663},
+  {0x1b0, 16, 16, 5674},
+  {0xf9aa, 16, 16, 5674},
+  {0x0, 2, 3, 5674},
+  {0x0, 0, 1, 5675},
+  {0x0, 0, 1, 5676},
+  {0x0, 3, 4, 5677},
+  {0x0, 0, 1, 5678},
+  {0x0, 12, 13, 5679},
+  {0x1ef, 16, 16, 5680},
+  {0x217, 16, 16, 5680},
+  {0x0, 11, 12, 5680},
+  {0x2f9bd, 16, 16, 5681},
+  {0x0, 0, 1, 5681},
+  {0x0, 0, 1, 5682},
+  {0x0, 3, 4, 5683},
+  {0x0, 0, 4, 5684},
+  {0x0, 0, 1, 5688},
+  {0x1e74, 16, 16, 5689},
+  {0x0, 0, 1, 5689},
+  {0x0, 0, 1, 5690},
+  {0x0, 3, 4, 5691},
+  {0x0, 0, 1, 5692},
+  {0x0, 0, 10, 5693},
+  {0x1eb0, 16, 16, 5703},
+  {0x1eae, 16, 16, 5703},
+  {0x1eb4, 16, 16, 5703},
+  {0x1eb2, 16, 16, 5703},
+  {0x0, 8, 9, 5703},
+  {0x2f972, 16, 16, 5704},
+  {0x0, 15, 16, 5704},
+  {0x2f837, 16, 16, 5705},
+  {0x0, 0, 1, 5705},
+  {0x0, 0, 1, 5706},
+  {0x0, 3, 4, 5707},
+  {0x0, 4, 5, 5708},
+  {0x0, 5, 6, 5709},
+  {0x1fa7, 16, 16, 5710},
+  {0x0, 0, 1, 5710},
+  {0x0, 3, 4, 5711},
+  {0x0, 0, 1, 5712},
+  {0x0, 9, 10, 5713},
+  {0x0, 9, 10, 5714},
+  {0x305a, 16, 16, 5715},
+  {0x0, 1, 13, 5715},
+  {0x1e9, 16, 16, 5727},
+  {0x0, 15, 16, 5727},
+  {0x2f908, 16, 16, 5728},
+  {0x0, 15, 16, 5728},
+  {0x2f8fc, 16, 16, 5729},
+  {0xfa51, 16, 16, 5729},
+  {0x0, 13, 14, 5729},
+  {0x2f8e7, 16, 16, 5730},
+  {0x0, 5, 6, 5730},
+  {0x1fbc, 16, 16, 5731},
+  {0x0, 10, 11, 5731},
+  {0x2f8a1, 16, 16, 5732},
+  {0x0, 1, 14, 5732},
+  {0xfa26, 16, 16, 5745},
+  {0x0, 11, 15, 5745},
+  {0x0, 0, 1, 5749},
+  {0x0, 0, 1, 5750},
+  {0x0, 3, 4, 5751},
+  {0x0, 3, 4, 5752},
+  {0x0, 8, 9, 5753},
+  {0x2260, 16, 16, 5754},
+  {0x0, 3, 4, 5754},
+  {0x0, 12, 13, 5755},
+  {0x2f997, 16, 16, 5756},
+  {0x0, 4, 5, 5756},
+  {0x2f853, 16, 16, 5757},
+  {0x3076, 16, 16, 5757},
+  {0x0, 12, 13, 5757},
+  {0xf92b, 16, 16, 5758},
+  {0x0, 2, 3, 5758},
+  {0x0, 2, 3, 5759},
+  {0x2f803, 16, 16, 5760},
+  {0x0, 1, 2, 5760},
+  {0x20a, 16, 16, 5761},
+  {0x0, 0, 1, 5761},
+  {0x0, 0, 1, 5762},
+  {0x0, 12, 13, 5763},
+  {0x0, 12, 14, 5764},
+  {0x0, 2, 3, 5766},
+  {0xcca, 16, 16, 5767},
+  {0x0, 8, 9, 5767},
+  {0x2f865, 16, 16, 5768},
+  {0x1e31, 16, 16, 5768},
+  {0x0, 3, 4, 5768},
+  {0x0, 10, 11, 5769},
+  {0x2f80d, 16, 16, 5770},
+  {0x0, 2, 8, 5770},
+  {0x2f817, 16, 16, 5776},
+  {0x2f8d2, 16, 16, 5776},
+  {0x2f9e3, 16, 16, 5776},
+  {0x0, 0, 2, 5776},
+  {0x1f3c, 16, 16, 5778},
+  {0x1f3a, 16, 16, 5778},
+  {0x0, 6, 8, 5778},
+  {0xb48, 16, 16, 5780},
+  {0xb4c, 16, 16, 5780},
+  {0x0, 0, 1, 5780},
+  {0x0, 0, 1, 5781},
+  {0x0, 3, 4, 5782},
+  {0x0, 3, 4, 5783},
+  {0x0, 8, 9, 5784},
+  {0x2280, 16, 16, 5785},
+  {0x0, 0, 1, 5785},
+  {0x0, 3, 4, 5786},
+  {0x0, 0, 1, 5787},
+  {0x0, 9, 10, 5788},
+  {0x0, 9, 10, 5789},
+  {0x30f4, 16, 16, 5790},
+  {0x0, 6, 8, 5790},
+  {0xf9b2, 16, 16, 5792},
+  {0x0, 3, 8, 5792},
+  {0x1e5b, 16, 16, 5797},
+  {0x0, 0, 1, 5797},
+  {0x0, 0, 1, 5798},
+  {0x0, 3, 4, 5799},
+  {0x0, 0, 1, 5800},
+  {0x0, 8, 9, 5801},
+  {0x4f5, 16, 16, 5802},
+  {0x157, 16, 16, 5802},
+  {0x0, 9, 10, 5802},
+  {0x2f9c2, 16, 16, 5803},
+  {0x0, 5, 6, 5803},
+  {0x2f988, 16, 16, 5804},
+  {0x0, 0, 1, 5804},
+  {0x0, 0, 1, 5805},
+  {0x0, 3, 4, 5806},
+  {0x0, 0, 1, 5807},
+  {0x0, 0, 9, 5808},
+  {0x40d, 16, 16, 5817},
+  {0x0, 0, 1, 5817},
+  {0x0, 0, 1, 5818},
+  {0x0, 3, 4, 5819},
+  {0x0, 0, 1, 5820},
+  {0x0, 1, 8, 5821},
+  {0x1e56, 16, 16, 5828},
+  {0x1e54, 16, 16, 5828},
+  {0x0, 2, 9, 5828},
+  {0x2f83e, 16, 16, 5835},
+  {0x0, 0, 1, 5835},
+  {0x0, 0, 1, 5836},
+  {0x0, 3, 4, 5837},
+  {0x0, 4, 5, 5838},
+  {0x0, 5, 6, 5839},
+  {0x1fa2, 16, 16, 5840},
+  {0xf980, 16, 16, 5840},
+  {0x0, 10, 11, 5840},
+  {0x0, 7, 8, 5841},
+  {0x2f8f0, 16, 16, 5842},
+  {0x0, 14, 15, 5842},
+  {0xd4a, 16, 16, 5843},
+  {0x0, 6, 15, 5843},
+  {0x2f8ff, 16, 16, 5852},
+  {0x0, 0, 1, 5852},
+  {0x0, 0, 1, 5853},
+  {0x0, 3, 4, 5854},
+  {0x0, 0, 3, 5855},
+  {0x0, 3, 4, 5858},
+  {0x1e89, 16, 16, 5859},
+  {0x0, 0, 1, 5859},
+  {0x0, 0, 1, 5860},
+  {0x0, 9, 10, 5861},
+  {0x0, 3, 4, 5862},
+  {0x0, 12, 13, 5863},
+  {0x934, 16, 16, 5864},
+  {0x0, 2, 3, 5864},
+  {0x2f8ac, 16, 16, 5865},
+  {0x0, 4, 5, 5865},
+  {0x2f9ac, 16, 16, 5866},
+  {0x0, 11, 12, 5866},
+  {0x2f816, 16, 16, 5867},
+  {0x0, 14, 15, 5867},
+  {0x2f911, 16, 16, 5868},
+  {0x0, 8, 9, 5868},
+  {0x0, 6, 7, 5869},
+  {0x2f96b, 16, 16, 5870},
+  {0x1e15, 16, 16, 5870},
+  {0x0, 3, 4, 5870},
+  {0x1e05, 16, 16, 5871},
+  {0x0, 8, 9, 5871},
+  {0x2f93f, 16, 16, 5872},
+  {0x0, 8, 9, 5872},
+  {0x2f8d0, 16, 16, 5873},
+  {0x0, 0, 1, 5873},
+  {0x0, 0, 1, 5874},
+  {0x0, 6, 7, 5875},
+  {0x0, 5, 6, 5876},
+  {0x0, 4, 5, 5877},
+  {0x6d3, 16, 16, 5878},
+  {0x0, 1, 2, 5878},
+  {0x1e0e, 16, 16, 5879},
+  {0x0, 7, 10, 5879},
+  {0xfa33, 16, 16, 5882},
+  {0x0, 0, 1, 5882},
+  {0x0, 0, 1, 5883},
+  {0x0, 3, 4, 5884},
+  {0x0, 3, 4, 5885},
+  {0x0, 8, 9, 5886},
+  {0x2279, 16, 16, 5887},
+  {0x0, 2, 12, 5887},
+  {0x0, 1, 2, 5897},
+  {0x2f9b0, 16, 16, 5898},
+  {0x0, 0, 1, 5898},
+  {0xfa39, 16, 16, 5899},
+  {0x2f825, 16, 16, 5899},
+  {0x0, 3, 4, 5899},
+  {0x2f983, 16, 16, 5900},
+  {0xfa05, 16, 16, 5900},
+  {0x0, 9, 10, 5900},
+  {0xf916, 16, 16, 5901},
+  {0xf915, 16, 16, 5901},
+  {0x0, 12, 13, 5901},
+  {0xf908, 16, 16, 5902},
+  {0x0, 9, 13, 5902},
+  {0xf955, 16, 16, 5906},
+  {0x0, 14, 15, 5906},
+  {0xf9e1, 16, 16, 5907},
+  {0x2f8d3, 16, 16, 5907},
+  {0x0, 8, 9, 5907},
+  {0x2f93c, 16, 16, 5908},
+  {0x0, 0, 1, 5908},
+  {0x0, 0, 1, 5909},
+  {0x0, 3, 4, 5910},
+  {0x0, 0, 3, 5911},
+  {0x0, 2, 13, 5914},
+  {0x21e, 16, 16, 5925},
+  {0x0, 0, 1, 5925},
+  {0x0, 0, 1, 5926},
+  {0x0, 3, 4, 5927},
+  {0x0, 0, 1, 5928},
+  {0x0, 6, 9, 5929},
+  {0x4d0, 16, 16, 5932},
+  {0x0, 6, 7, 5932},
+  {0x0, 6, 7, 5933},
+  {0x2f9cc, 16, 16, 5934},
+  {0x0, 10, 11, 5934},
+  {0xf985, 16, 16, 5935},
+  {0x4d2, 16, 16, 5935},
+  {0x0, 3, 4, 5935},
+  {0x2f99a, 16, 16, 5936},
+  {0x1fd3, 16, 16, 5936},
+  {0x0, 4, 6, 5936},
+  {0x0, 0, 1, 5938},
+  {0x0, 0, 1, 5939},
+  {0x0, 3, 4, 5940},
+  {0x0, 0, 1, 5941},
+  {0x0, 15, 16, 5942},
+  {0x477, 16, 16, 5943},
+  {0x1e26, 16, 16, 5943},
+  {0x1e22, 16, 16, 5943},
+  {0x124, 16, 16, 5943},
+  {0xf979, 16, 16, 5943},
+  {0x0, 0, 1, 5943},
+  {0x2f93a, 16, 16, 5944},
+  {0xfa49, 16, 16, 5944},
+  {0x0, 8, 9, 5944},
+  {0xf900, 16, 16, 5945},
+  {0x0, 4, 5, 5945},
+  {0xf924, 16, 16, 5946},
+  {0x1f23, 16, 16, 5946},
+  {0x0, 5, 6, 5946},
+  {0x2f925, 16, 16, 5947},
+  {0x0, 4, 13, 5947},
+  {0x2f818, 16, 16, 5956},
+  {0x0, 10, 11, 5956},
+  {0x2f979, 16, 16, 5957},
+  {0x0, 0, 1, 5957},
+  {0x0, 0, 1, 5958},
+  {0x0, 3, 4, 5959},
+  {0x0, 0, 1, 5960},
+  {0x0, 2, 3, 5961},
+  {0x1ec6, 16, 16, 5962},
+  {0x0, 2, 3, 5962},
+  {0x2f895, 16, 16, 5963},
+  {0x0, 6, 7, 5963},
+  {0x0, 0, 1, 5964},
+  {0x0, 0, 1, 5965},
+  {0x0, 3, 4, 5966},
+  {0x0, 0, 1, 5967},
+  {0x0, 8, 9, 5968},
+  {0x407, 16, 16, 5969},
+  {0xf949, 16, 16, 5969},
+  {0x0, 0, 10, 5969},
+  {0x1eed, 16, 16, 5979},
+  {0x0, 5, 12, 5979},
+  {0x2f839, 16, 16, 5986},
+  {0x1eeb, 16, 16, 5986},
+  {0x1ee9, 16, 16, 5986},
+  {0x0, 3, 5, 5986},
+  {0x1f38, 16, 16, 5988},
+  {0x1eef, 16, 16, 5988},
+  {0x1f39, 16, 16, 5988},
+  {0x0, 0, 10, 5988},
+  {0x2f962, 16, 16, 5998},
+  {0xfa56, 16, 16, 5998},
+  {0x0, 3, 4, 5998},
+  {0x2f87c, 16, 16, 5999},
+  {0x2f963, 16, 16, 5999},
+  {0x0, 0, 1, 5999},
+  {0x0, 0, 1, 6000},
+  {0x0, 3, 4, 6001},
+  {0x0, 0, 1, 6002},
+  {0x0, 1, 5, 6003},
+  {0x1e2, 16, 16, 6007},
+  {0x1fc, 16, 16, 6007},
+  {0x0, 7, 8, 6007},
+  {0xf9f2, 16, 16, 6008},
+  {0xf906, 16, 16, 6008},
+  {0x0, 13, 14, 6008},
+  {0x2f886, 16, 16, 6009},
+  {0x0, 15, 16, 6009},
+  {0xf927, 16, 16, 6010},
+  {0x0, 12, 13, 6010},
+  {0x2f92a, 16, 16, 6011},
+  {0x0, 3, 5, 6011},
+  {0x1f40, 16, 16, 6013},
+  {0x1f41, 16, 16, 6013},
+  {0x0, 0, 16, 6013},
+  {0xfa, 16, 16, 6029},
+  {0xf9, 16, 16, 6029},
+  {0x169, 16, 16, 6029},
+  {0xfb, 16, 16, 6029},
+  {0x16b, 16, 16, 6029},
+  {0x0, 3, 14, 6029},
+  {0x1ee4, 16, 16, 6040},
+  {0x16d, 16, 16, 6040},
+  {0x1ee7, 16, 16, 6040},
+  {0xfc, 16, 16, 6040},
+  {0x0, 0, 1, 6040},
+  {0x0, 3, 4, 6041},
+  {0x0, 0, 1, 6042},
+  {0x0, 9, 10, 6043},
+  {0x0, 9, 10, 6044},
+  {0x3062, 16, 16, 6045},
+  {0x172, 16, 16, 6045},
+  {0x0, 0, 1, 6045},
+  {0x0, 0, 1, 6046},
+  {0x0, 3, 4, 6047},
+  {0x0, 0, 1, 6048},
+  {0x0, 7, 8, 6049},
+  {0x1e65, 16, 16, 6050},
+  {0x0, 1, 13, 6050},
+  {0x161, 16, 16, 6062},
+  {0x0, 9, 13, 6062},
+  {0x2f9a1, 16, 16, 6066},
+  {0x0, 0, 1, 6066},
+  {0x0, 0, 1, 6067},
+  {0x0, 3, 4, 6068},
+  {0x0, 0, 1, 6069},
+  {0x0, 0, 13, 6070},
+  {0x1da, 16, 16, 6083},
+  {0x0, 0, 1, 6083},
+  {0x0, 0, 1, 6084},
+  {0x0, 3, 4, 6085},
+  {0x0, 0, 4, 6086},
+  {0x0, 1, 13, 6090},
+  {0x13a, 16, 16, 6102},
+  {0x16f, 16, 16, 6102},
+  {0x1e76, 16, 16, 6102},
+  {0x0, 0, 1, 6102},
+  {0x0, 0, 1, 6103},
+  {0x0, 3, 4, 6104},
+  {0x0, 3, 4, 6105},
+  {0x0, 8, 9, 6106},
+  {0x219b, 16, 16, 6107},
+  {0x171, 16, 16, 6107},
+  {0x215, 16, 16, 6107},
+  {0x0, 0, 1, 6107},
+  {0x0, 3, 4, 6108},
+  {0x0, 0, 1, 6109},
+  {0x0, 9, 10, 6110},
+  {0x0, 9, 10, 6111},
+  {0x3050, 16, 16, 6112},
+  {0x0, 10, 11, 6112},
+  {0x0, 7, 8, 6113},
+  {0x2f95e, 16, 16, 6114},
+  {0x0, 2, 3, 6114},
+  {0x2f9ba, 16, 16, 6115},
+  {0x0, 14, 15, 6115},
+  {0xfa30, 16, 16, 6116},
+  {0x0, 10, 11, 6116},
+  {0x2f861, 16, 16, 6117},
+  {0x13e, 16, 16, 6117},
+  {0x1dc, 16, 16, 6117},
+  {0x1d8, 16, 16, 6117},
+  {0x1d6, 16, 16, 6117},
+  {0x0, 2, 3, 6117},
+  {0x1fd7, 16, 16, 6118},
+  {0x0, 1, 2, 6118},
+  {0x0, 4, 5, 6119},
+  {0x2f927, 16, 16, 6120},
+  {0x15d, 16, 16, 6120},
+  {0x15b, 16, 16, 6120},
+  {0x1e61, 16, 16, 6120},
+  {0x0, 3, 5, 6120},
+  {0x1f49, 16, 16, 6122},
+  {0x0, 0, 1, 6122},
+  {0x0, 3, 4, 6123},
+  {0x0, 0, 1, 6124},
+  {0x0, 9, 10, 6125},
+  {0x0, 9, 10, 6126},
+  {0x30c5, 16, 16, 6127},
+  {0xf93e, 16, 16, 6127},
+  {0x0, 0, 14, 6127},
+  {0x0, 4, 5, 6141},
+  {0x2f9d9, 16, 16, 6142},
+  {0x0, 13, 14, 6142},
+  {0x2f8b4, 16, 16, 6143},
+  {0x1f48, 16, 16, 6143},
+  {0x0, 8, 9, 6143},
+  {0xf9e2, 16, 16, 6144},
+  {0x0, 3, 9, 6144},
+  {0x1eca, 16, 16, 6150},
+  {0x12e, 16, 16, 6150},
+  {0x0, 0, 9, 6150},
+  {0x1f7a, 16, 16, 6159},
+  {0x3cd, 16, 16, 6159},
+  {0x1fe1, 16, 16, 6159},
+  {0x0, 1, 2, 6159},
+  {0x1e35, 16, 16, 6160},
+  {0x1fe0, 16, 16, 6160},
+  {0x0, 0, 1, 6160},
+  {0x0, 3, 4, 6161},
+  {0x0, 0, 1, 6162},
+  {0x0, 9, 10, 6163},
+  {0x0, 9, 11, 6164},
+  {0x3074, 16, 16, 6166},
+  {0x3cb, 16, 16, 6166},
+  {0x0, 3, 4, 6166},
+  {0xf99d, 16, 16, 6167},
+  {0x0, 0, 1, 6167},
+  {0x0, 0, 1, 6168},
+  {0x0, 3, 4, 6169},
+  {0x0, 0, 1, 6170},
+  {0x0, 8, 9, 6171},
+  {0x4e7, 16, 16, 6172},
+  {0x1f3b, 16, 16, 6172},
+  {0x0, 0, 1, 6172},
+  {0x0, 0, 1, 6173},
+  {0x0, 3, 4, 6174},
+  {0x0, 4, 5, 6175},
+  {0x0, 5, 6, 6176},
+  {0x1f92, 16, 16, 6177},
+  {0x0, 2, 4, 6177},
+  {0xfa42, 16, 16, 6179},
+  {0x0, 1, 2, 6179},
+  {0x1e5f, 16, 16, 6180},
+  {0x0, 0, 1, 6180},
+  {0x0, 0, 1, 6181},
+  {0x0, 3, 4, 6182},
+  {0x0, 3, 4, 6183},
+  {0x0, 8, 9, 6184},
+  {0x22ed, 16, 16, 6185},
+  {0x0, 2, 6, 6185},
+  {0x1ff6, 16, 16, 6189},
+  {0x1ff3, 16, 16, 6189},
+  {0x0, 9, 11, 6189},
+  {0xf92a, 16, 16, 6191},
+  {0x0, 0, 1, 6191},
+  {0x0, 0, 1, 6192},
+  {0x0, 3, 4, 6193},
+  {0x0, 0, 5, 6194},
+  {0x0, 2, 6, 6199},
+  {0x1fa0, 16, 16, 6203},
+  {0x0, 4, 5, 6203},
+  {0xf9b7, 16, 16, 6204},
+  {0x1f66, 16, 16, 6204},
+  {0x3073, 16, 16, 6204},
+  {0x0, 2, 8, 6204},
+  {0x2f823, 16, 16, 6210},
+  {0x0, 12, 13, 6210},
+  {0x2f862, 16, 16, 6211},
+  {0x2f822, 16, 16, 6211},
+  {0x0, 2, 3, 6211},
+  {0xf9e5, 16, 16, 6212},
+  {0x2f903, 16, 16, 6212},
+  {0x0, 11, 12, 6212},
+  {0x2f957, 16, 16, 6213},
+  {0x0, 11, 12, 6213},
+  {0xf98a, 16, 16, 6214},
+  {0x0, 9, 10, 6214},
+  {0x2f9bb, 16, 16, 6215},
+  {0x0, 0, 1, 6215},
+  {0x0, 0, 1, 6216},
+  {0x0, 3, 4, 6217},
+  {0x0, 0, 1, 6218},
+  {0x0, 15, 16, 6219},
+  {0x476, 16, 16, 6220},
+  {0x0, 0, 1, 6220},
+  {0x0, 0, 1, 6221},
+  {0x0, 3, 4, 6222},
+  {0x0, 0, 1, 6223},
+  {0x0, 8, 9, 6224},
+  {0x4eb, 16, 16, 6225},
+  {0x0, 1, 6, 6225},
+  {0xfa5b, 16, 16, 6230},
+  {0xf934, 16, 16, 6230},
+  {0x0, 0, 10, 6230},
+  {0x0, 0, 1, 6240},
+  {0x0, 0, 1, 6241},
+  {0x0, 3, 4, 6242},
+  {0x0, 0, 1, 6243},
+  {0x0, 0, 2, 6244},
+  {0x1f14, 16, 16, 6246},
+  {0x1f12, 16, 16, 6246},
+  {0x0, 3, 14, 6246},
+  {0x1e0c, 16, 16, 6257},
+  {0x1e10, 16, 16, 6257},
+  {0x1ffb, 16, 16, 6257},
+  {0x1feb, 16, 16, 6257},
+  {0x1ff9, 16, 16, 6257},
+  {0x1fdb, 16, 16, 6257},
+  {0x0, 3, 4, 6257},
+  {0x2f992, 16, 16, 6258},
+  {0x0, 0, 1, 6258},
+  {0x0, 3, 4, 6259},
+  {0x0, 0, 1, 6260},
+  {0x0, 9, 10, 6261},
+  {0x0, 9, 10, 6262},
+  {0x30b6, 16, 16, 6263},
+  {0x0, 0, 1, 6263},
+  {0x0, 0, 1, 6264},
+  {0x0, 3, 4, 6265},
+  {0x0, 0, 4, 6266},
+  {0x0, 3, 14, 6270},
+  {0x1e36, 16, 16, 6281},
+  {0x13b, 16, 16, 6281},
+  {0x1e12, 16, 16, 6281},
+  {0x0, 1, 2, 6281},
+  {0x0, 14, 15, 6282},
+  {0x2f906, 16, 16, 6283},
+  {0x0, 0, 1, 6283},
+  {0x0, 0, 1, 6284},
+  {0x0, 3, 4, 6285},
+  {0x0, 0, 1, 6286},
+  {0x0, 8, 9, 6287},
+  {0x4ed, 16, 16, 6288},
+  {0x2f8dc, 16, 16, 6288},
+  {0x0, 6, 7, 6288},
+  {0x0, 3, 4, 6289},
+  {0x2f91d, 16, 16, 6290},
+  {0x1e3c, 16, 16, 6290},
+  {0x1fbb, 16, 16, 6290},
+  {0x1fee, 16, 16, 6290},
+  {0x0, 14, 15, 6290},
+  {0x2fa08, 16, 16, 6291},
+  {0x1fc9, 16, 16, 6291},
+  {0x0, 0, 1, 6291},
+  {0x0, 0, 1, 6292},
+  {0x0, 13, 14, 6293},
+  {0x0, 3, 4, 6294},
+  {0x0, 14, 15, 6295},
+  {0xd4b, 16, 16, 6296},
+  {0x0, 6, 7, 6296},
+  {0x2fa1b, 16, 16, 6297},
+  {0x0, 7, 8, 6297},
+  {0x2f896, 16, 16, 6298},
+  {0xf97a, 16, 16, 6298},
+  {0x0, 1, 13, 6298},
+  {0x17d, 16, 16, 6310},
+  {0x0, 4, 5, 6310},
+  {0xfa57, 16, 16, 6311},
+  {0x0, 8, 9, 6311},
+  {0xf972, 16, 16, 6312},
+  {0x0, 0, 1, 6312},
+  {0x0, 0, 1, 6313},
+  {0x0, 3, 4, 6314},
+  {0x0, 3, 4, 6315},
+  {0x0, 8, 9, 6316},
+  {0x226f, 16, 16, 6317},
+  {0x0, 0, 1, 6317},
+  {0x0, 0, 1, 6318},
+  {0x0, 3, 4, 6319},
+  {0x0, 0, 1, 6320},
+  {0x0, 0, 13, 6321},
+  {0x1d5, 16, 16, 6334},
+  {0x0, 6, 7, 6334},
+  {0x0, 7, 8, 6335},
+  {0x2f9c5, 16, 16, 6336},
+  {0x0, 0, 1, 6336},
+  {0x0, 0, 1, 6337},
+  {0x0, 3, 4, 6338},
+  {0x0, 4, 5, 6339},
+  {0x0, 5, 6, 6340},
+  {0x1fb7, 16, 16, 6341},
+  {0x1db, 16, 16, 6341},
+  {0x1d7, 16, 16, 6341},
+  {0x0, 3, 14, 6341},
+  {0x1e71, 16, 16, 6352},
+  {0x0, 0, 1, 6352},
+  {0x2f924, 16, 16, 6353},
+  {0x0, 0, 1, 6353},
+  {0x0, 0, 1, 6354},
+  {0x0, 3, 4, 6355},
+  {0x0, 3, 4, 6356},
+  {0x0, 8, 9, 6357},
+  {0x2247, 16, 16, 6358},
+  {0x0, 5, 6, 6358},
+  {0x0, 6, 7, 6359},
+  {0x2fa16, 16, 16, 6360},
+  {0x0, 0, 1, 6360},
+  {0x0, 0, 1, 6361},
+  {0x0, 3, 4, 6362},
+  {0x0, 4, 5, 6363},
+  {0x0, 5, 6, 6364},
+  {0x1f8a, 16, 16, 6365},
+  {0x0, 14, 15, 6365},
+  {0x2fa0d, 16, 16, 6366},
+  {0x0, 1, 2, 6366},
+  {0x2f8a0, 16, 16, 6367},
+  {0x2f8e4, 16, 16, 6367},
+  {0x0, 9, 10, 6367},
+  {0x2f8cd, 16, 16, 6368},
+  {0x0, 5, 10, 6368},
+  {0x2f8d7, 16, 16, 6373},
+  {0x1e90, 16, 16, 6373},
+  {0x179, 16, 16, 6373},
+  {0x2f981, 16, 16, 6373},
+  {0x17b, 16, 16, 6373},
+  {0x21b, 16, 16, 6373},
+  {0x163, 16, 16, 6373},
+  {0xfa4c, 16, 16, 6373},
+  {0x1e6d, 16, 16, 6373},
+  {0x37e, 16, 16, 6373},
+  {0x1d9, 16, 16, 6373},
+  {0x0, 0, 1, 6373},
+  {0x0, 3, 4, 6374},
+  {0x0, 0, 1, 6375},
+  {0x0, 9, 10, 6376},
+  {0x0, 9, 11, 6377},
+  {0x30d7, 16, 16, 6379},
+  {0x0, 0, 1, 6379},
+  {0x0, 3, 4, 6380},
+  {0x0, 0, 1, 6381},
+  {0x0, 9, 10, 6382},
+  {0x0, 9, 10, 6383},
+  {0x3060, 16, 16, 6384},
+  {0x0, 2, 6, 6384},
+  {0x1f91, 16, 16, 6388},
+  {0x1e16, 16, 16, 6388},
+  {0x1f27, 16, 16, 6388},
+  {0x0, 7, 8, 6388},
+  {0x2f89e, 16, 16, 6389},
+  {0x0, 9, 10, 6389},
+  {0x2f8c3, 16, 16, 6390},
+  {0x0, 1, 2, 6390},
+  {0x2f83a, 16, 16, 6391},
+  {0x0, 12, 13, 6391},
+  {0x2f880, 16, 16, 6392},
+  {0x2f989, 16, 16, 6392},
+  {0xd1, 16, 16, 6392},
+  {0x1f8, 16, 16, 6392},
+  {0x143, 16, 16, 6392},
+  {0x1e44, 16, 16, 6392},
+  {0x0, 11, 12, 6392},
+  {0x2f98e, 16, 16, 6393},
+  {0x0, 11, 12, 6393},
+  {0x2f933, 16, 16, 6394},
+  {0x0, 10, 11, 6394},
+  {0xf99b, 16, 16, 6395},
+  {0x0, 0, 1, 6395},
+  {0x1e75, 16, 16, 6396},
+  {0x0, 0, 1, 6396},
+  {0x0, 0, 1, 6397},
+  {0x0, 3, 4, 6398},
+  {0x0, 4, 5, 6399},
+  {0x0, 5, 6, 6400},
+  {0x1f8d, 16, 16, 6401},
+  {0x30d6, 16, 16, 6401},
+  {0x1f2b, 16, 16, 6401},
+  {0x0, 2, 3, 6401},
+  {0xf9ad, 16, 16, 6402},
+  {0xf95d, 16, 16, 6402},
+  {0x0, 0, 1, 6402},
+  {0x0, 0, 1, 6403},
+  {0x0, 3, 4, 6404},
+  {0x0, 0, 3, 6405},
+  {0x0, 3, 4, 6408},
+  {0x1e7c, 16, 16, 6409},
+  {0x0, 3, 4, 6409},
+  {0x0, 14, 15, 6410},
+  {0x2f977, 16, 16, 6411},
+  {0x0, 0, 1, 6411},
+  {0x0, 3, 4, 6412},
+  {0x0, 0, 1, 6413},
+  {0x0, 9, 10, 6414},
+  {0x0, 9, 10, 6415},
+  {0x305e, 16, 16, 6416},
+  {0x0, 0, 1, 6416},
+  {0x2f842, 16, 16, 6417},
+  {0x0, 3, 4, 6417},
+  {0x2f90a, 16, 16, 6418},
+  {0x0, 0, 9, 6418},
+  {0x38e, 16, 16, 6427},
+  {0x0, 0, 1, 6427},
+  {0xf9ee, 16, 16, 6428},
+  {0x0, 15, 16, 6428},
+  {0x2f80b, 16, 16, 6429},
+  {0x0, 10, 11, 6429},
+  {0xf919, 16, 16, 6430},
+  {0xf912, 16, 16, 6430},
+  {0x0, 13, 14, 6430},
+  {0x0, 10, 11, 6431},
+  {0x2f898, 16, 16, 6432},
+  {0x211, 16, 16, 6432},
+  {0x159, 16, 16, 6432},
+  {0x0, 12, 13, 6432},
+  {0xfa2b, 16, 16, 6433},
+  {0x0, 10, 11, 6433},
+  {0xf9bb, 16, 16, 6434},
+  {0x0, 0, 1, 6434},
+  {0x0, 0, 1, 6435},
+  {0x0, 3, 4, 6436},
+  {0x0, 4, 5, 6437},
+  {0x0, 5, 6, 6438},
+  {0x1f83, 16, 16, 6439},
+  {0x1ff8, 16, 16, 6439},
+  {0x0, 11, 12, 6439},
+  {0x2f9d4, 16, 16, 6440},
+  {0x0, 1, 12, 6440},
+  {0x216, 16, 16, 6451},
+  {0x0, 0, 1, 6451},
+  {0x0, 0, 1, 6452},
+  {0x0, 3, 4, 6453},
+  {0x0, 0, 1, 6454},
+  {0x0, 4, 5, 6455},
+  {0x1e0, 16, 16, 6456},
+  {0x0, 0, 16, 6456},
+  {0x0, 6, 7, 6472},
+  {0xfa37, 16, 16, 6473},
+  {0x0, 0, 1, 6473},
+  {0x0, 0, 1, 6474},
+  {0x0, 3, 4, 6475},
+  {0x0, 3, 4, 6476},
+  {0x0, 8, 9, 6477},
+  {0x22e3, 16, 16, 6478},
+  {0x0, 0, 2, 6478},
+  {0x1f6a, 16, 16, 6480},
+  {0x1f6c, 16, 16, 6480},
+  {0x137, 16, 16, 6480},
+  {0x0, 3, 5, 6480},
+  {0x1f51, 16, 16, 6482},
+  {0x1f50, 16, 16, 6482},
+  {0x0, 1, 2, 6482},
+  {0x0, 5, 6, 6483},
+  {0x2f9ec, 16, 16, 6484},
+  {0x0, 14, 15, 6484},
+  {0x2f8c2, 16, 16, 6485},
+  {0x0, 13, 14, 6485},
+  {0x2f99d, 16, 16, 6486},
+  {0x1af, 16, 16, 6486},
+  {0x0, 9, 10, 6486},
+  {0xf9c7, 16, 16, 6487},
+  {0x1e59, 16, 16, 6487},
+  {0x4d3, 16, 16, 6487},
+  {0x0, 0, 1, 6487},
+  {0x0, 0, 1, 6488},
+  {0x0, 3, 4, 6489},
+  {0x0, 0, 1, 6490},
+  {0x0, 7, 8, 6491},
+  {0x1e1f, 16, 16, 6492},
+  {0x0, 7, 8, 6492},
+  {0x2f9bf, 16, 16, 6493},
+  {0x0, 2, 5, 6493},
+  {0xf73, 16, 16, 6496},
+  {0xf75, 16, 16, 6496},
+  {0x0, 8, 9, 6496},
+  {0x2f83f, 16, 16, 6497},
+  {0x0, 3, 5, 6497},
+  {0x1f30, 16, 16, 6499},
+  {0x1f31, 16, 16, 6499},
+  {0x0, 15, 16, 6499},
+  {0xf913, 16, 16, 6500},
+  {0x0, 0, 11, 6500},
+  {0x1e87, 16, 16, 6511},
+  {0x0, 0, 2, 6511},
+  {0x1fcd, 16, 16, 6513},
+  {0x1fce, 16, 16, 6513},
+  {0x175, 16, 16, 6513},
+  {0x1e83, 16, 16, 6513},
+  {0x1e81, 16, 16, 6513},
+  {0x0, 12, 13, 6513},
+  {0x2f8b8, 16, 16, 6514},
+  {0x0, 5, 6, 6514},
+  {0x1ffc, 16, 16, 6515},
+  {0xfa45, 16, 16, 6515},
+  {0x1e85, 16, 16, 6515},
+  {0x0, 3, 9, 6515},
+  {0x1ecc, 16, 16, 6521},
+  {0x0, 0, 1, 6521},
+  {0x0, 0, 1, 6522},
+  {0x0, 11, 12, 6523},
+  {0x0, 11, 12, 6524},
+  {0x0, 14, 15, 6525},
+  {0xbcb, 16, 16, 6526},
+  {0x1ea, 16, 16, 6526},
+  {0x0, 0, 1, 6526},
+  {0x0, 0, 1, 6527},
+  {0x0, 3, 4, 6528},
+  {0x0, 3, 4, 6529},
+  {0x0, 8, 9, 6530},
+  {0x22ac, 16, 16, 6531},
+  {0x0, 1, 2, 6531},
+  {0x0, 10, 11, 6532},
+  {0x2f9f7, 16, 16, 6533},
+  {0x0, 12, 13, 6533},
+  {0xf956, 16, 16, 6534},
+  {0x0, 0, 1, 6534},
+  {0x0, 0, 1, 6535},
+  {0x0, 3, 4, 6536},
+  {0x0, 0, 1, 6537},
+  {0x0, 8, 9, 6538},
+  {0x4f8, 16, 16, 6539},
+  {0x0, 12, 16, 6539},
+  {0xf9e9, 16, 16, 6543},
+  {0xf97e, 16, 16, 6543},
+  {0x0, 14, 15, 6543},
+  {0x2f8af, 16, 16, 6544},
+  {0x21f, 16, 16, 6544},
+  {0x1e98, 16, 16, 6544},
+  {0x0, 1, 2, 6544},
+  {0x1e3a, 16, 16, 6545},
+  {0x0, 7, 8, 6545},
+  {0x9cc, 16, 16, 6546},
+  {0x0, 3, 15, 6546},
+  {0x1e2a, 16, 16, 6558},
+  {0x0, 5, 16, 6558},
+  {0x2fa1a, 16, 16, 6569},
+  {0x2f81a, 16, 16, 6569},
+  {0x0, 7, 12, 6569},
+  {0x2f929, 16, 16, 6574},
+  {0x0, 2, 16, 6574},
+  {0xf94f, 16, 16, 6588},
+  {0x0, 14, 15, 6588},
+  {0xf920, 16, 16, 6589},
+  {0x0, 10, 11, 6589},
+  {0x0, 14, 15, 6590},
+  {0x2f9cb, 16, 16, 6591},
+  {0xf9a0, 16, 16, 6591},
+  {0x1e28, 16, 16, 6591},
+  {0x0, 1, 2, 6591},
+  {0x2f8da, 16, 16, 6592},
+  {0x1e24, 16, 16, 6592},
+  {0x2fa19, 16, 16, 6592},
+  {0xf9db, 16, 16, 6592},
+  {0x0, 0, 1, 6592},
+  {0x0, 0, 1, 6593},
+  {0x0, 3, 4, 6594},
+  {0x0, 0, 3, 6595},
+  {0x0, 7, 8, 6598},
+  {0x122, 16, 16, 6599},
+  {0x0, 0, 2, 6599},
+  {0x1f2a, 16, 16, 6601},
+  {0x1f2c, 16, 16, 6601},
+  {0x0, 0, 1, 6601},
+  {0x0, 0, 1, 6602},
+  {0x0, 3, 4, 6603},
+  {0x0, 4, 5, 6604},
+  {0x0, 5, 6, 6605},
+  {0x1f93, 16, 16, 6606},
+  {0x0, 14, 15, 6606},
+  {0xbca, 16, 16, 6607},
+  {0x0, 6, 7, 6607},
+  {0x2f912, 16, 16, 6608},
+  {0x0, 5, 6, 6608},
+  {0x2f9f6, 16, 16, 6609},
+  {0x0, 3, 4, 6609},
+  {0x2f8dd, 16, 16, 6610},
+  {0xf96a, 16, 16, 6610},
+  {0x0, 14, 15, 6610},
+  {0x2f90f, 16, 16, 6611},
+  {0x0, 9, 10, 6611},
+  {0x374, 16, 16, 6612},
+  {0x0, 6, 11, 6612},
+  {0xf998, 16, 16, 6617},
+  {0x0, 4, 5, 6617},
+  {0xfa3d, 16, 16, 6618},
+  {0x0, 2, 6, 6618},
+  {0x1f26, 16, 16, 6622},
+  {0x0, 7, 15, 6622},
+  {0x2f8c4, 16, 16, 6630},
+  {0x0, 0, 1, 6630},
+  {0x2f922, 16, 16, 6631},
+  {0x0, 1, 2, 6631},
+  {0xf96d, 16, 16, 6632},
+  {0x0, 1, 2, 6632},
+  {0x1e6f, 16, 16, 6633},
+  {0x0, 0, 1, 6633},
+  {0x0, 0, 1, 6634},
+  {0x0, 3, 4, 6635},
+  {0x0, 4, 5, 6636},
+  {0x0, 5, 6, 6637},
+  {0x1fa4, 16, 16, 6638},
+  {0x0, 0, 1, 6638},
+  {0x0, 0, 1, 6639},
+  {0x0, 3, 4, 6640},
+  {0x0, 0, 4, 6641},
+  {0x0, 1, 13, 6645},
+  {0x17e, 16, 16, 6657},
+  {0x1f90, 16, 16, 6657},
+  {0x0, 0, 2, 6657},
+  {0x1f5b, 16, 16, 6659},
+  {0x1f5d, 16, 16, 6659},
+  {0x0, 5, 6, 6659},
+  {0xfa04, 16, 16, 6660},
+  {0x1f6e, 16, 16, 6660},
+  {0x0, 0, 1, 6660},
+  {0x0, 0, 1, 6661},
+  {0x0, 3, 4, 6662},
+  {0x0, 0, 3, 6663},
+  {0x0, 1, 13, 6666},
+  {0x11f, 16, 16, 6678},
+  {0x121, 16, 16, 6678},
+  {0x1e21, 16, 16, 6678},
+  {0x11d, 16, 16, 6678},
+  {0x1f5, 16, 16, 6678},
+  {0x0, 3, 4, 6678},
+  {0x2f8bc, 16, 16, 6679},
+  {0x17c, 16, 16, 6679},
+  {0x17a, 16, 16, 6679},
+  {0x1e91, 16, 16, 6679},
+  {0x0, 1, 2, 6679},
+  {0x2f8b5, 16, 16, 6680},
+  {0xf9d7, 16, 16, 6680},
+  {0x2f8c6, 16, 16, 6680},
+  {0x1e7, 16, 16, 6680},
+  {0x0, 4, 5, 6680},
+  {0xf943, 16, 16, 6681},
+  {0x0, 0, 1, 6681},
+  {0x0, 0, 1, 6682},
+  {0x0, 3, 4, 6683},
+  {0x0, 0, 1, 6684},
+  {0x0, 0, 10, 6685},
+  {0x1ed7, 16, 16, 6695},
+  {0x0, 0, 1, 6695},
+  {0x0, 0, 1, 6696},
+  {0x0, 3, 4, 6697},
+  {0x0, 4, 5, 6698},
+  {0x0, 5, 6, 6699},
+  {0x1f8f, 16, 16, 6700},
+  {0x1ed1, 16, 16, 6700},
+  {0x1ed3, 16, 16, 6700},
+  {0x0, 2, 14, 6700},
+  {0xf95e, 16, 16, 6712},
+  {0x2f801, 16, 16, 6712},
+  {0x1ed5, 16, 16, 6712},
+  {0xf905, 16, 16, 6712},
+  {0x0, 0, 2, 6712},
+  {0x1f6d, 16, 16, 6714},
+  {0x1f6b, 16, 16, 6714},
+  {0x0, 10, 11, 6714},
+  {0x2f808, 16, 16, 6715},
+  {0x0, 15, 16, 6715},
+  {0x0, 0, 1, 6716},
+  {0x0, 0, 1, 6717},
+  {0x0, 12, 13, 6718},
+  {0x0, 13, 14, 6719},
+  {0x0, 5, 6, 6720},
+  {0xcc0, 16, 16, 6721},
+  {0x0, 0, 16, 6721},
+  {0x214, 16, 16, 6737},
+  {0x0, 11, 12, 6737},
+  {0xf953, 16, 16, 6738},
+  {0x1d3, 16, 16, 6738},
+  {0x170, 16, 16, 6738},
+  {0x16e, 16, 16, 6738},
+  {0x0, 3, 14, 6738},
+  {0x1e77, 16, 16, 6749},
+  {0x0, 3, 14, 6749},
+  {0x13c, 16, 16, 6760},
+  {0x1e37, 16, 16, 6760},
+  {0x0, 0, 1, 6760},
+  {0x0, 0, 1, 6761},
+  {0x0, 3, 4, 6762},
+  {0x0, 1, 2, 6763},
+  {0x0, 4, 5, 6764},
+  {0x1fec, 16, 16, 6765},
+  {0x0, 14, 15, 6765},
+  {0x0, 4, 5, 6766},
+  {0x2f859, 16, 16, 6767},
+  {0x2f800, 16, 16, 6767},
+  {0x1e3d, 16, 16, 6767},
+  {0x0, 0, 1, 6767},
+  {0x0, 3, 4, 6768},
+  {0x0, 0, 1, 6769},
+  {0x0, 9, 10, 6770},
+  {0x0, 9, 10, 6771},
+  {0x304e, 16, 16, 6772},
+  {0x0, 11, 15, 6772},
+  {0x2f87e, 16, 16, 6776},
+  {0x2f8cb, 16, 16, 6776},
+  {0x1e84, 16, 16, 6776},
+  {0x0, 0, 1, 6776},
+  {0x0, 0, 1, 6777},
+  {0x0, 3, 4, 6778},
+  {0x0, 0, 1, 6779},
+  {0x0, 1, 2, 6780},
+  {0x403, 16, 16, 6781},
+  {0x173, 16, 16, 6781},
+  {0x1ee6, 16, 16, 6781},
+  {0xdc, 16, 16, 6781},
+  {0x1ee5, 16, 16, 6781},
+  {0x16c, 16, 16, 6781},
+  {0x16a, 16, 16, 6781},
+  {0x168, 16, 16, 6781},
+  {0xdb, 16, 16, 6781},
+  {0x0, 8, 11, 6781},
+  {0x0, 0, 1, 6784},
+  {0x0, 0, 1, 6785},
+  {0x0, 6, 7, 6786},
+  {0x0, 5, 6, 6787},
+  {0x0, 4, 5, 6788},
+  {0x626, 16, 16, 6789},
+  {0x1e73, 16, 16, 6789},
+  {0x0, 5, 7, 6789},
+  {0xcc7, 16, 16, 6791},
+  {0x0, 0, 1, 6791},
+  {0x0, 0, 1, 6792},
+  {0x0, 3, 4, 6793},
+  {0x0, 0, 3, 6794},
+  {0x0, 0, 11, 6797},
+  {0x233, 16, 16, 6808},
+  {0x1e8f, 16, 16, 6808},
+  {0xcc8, 16, 16, 6808},
+  {0xfd, 16, 16, 6808},
+  {0x1ef3, 16, 16, 6808},
+  {0x1ef9, 16, 16, 6808},
+  {0x177, 16, 16, 6808},
+  {0x0, 12, 13, 6808},
+  {0x2f812, 16, 16, 6809},
+  {0x1ef7, 16, 16, 6809},
+  {0xff, 16, 16, 6809},
+  {0x1e80, 16, 16, 6809},
+  {0x0, 14, 15, 6809},
+  {0x2f83c, 16, 16, 6810},
+  {0x0, 2, 3, 6810},
+  {0x0, 0, 1, 6811},
+  {0x0, 0, 1, 6812},
+  {0x0, 11, 12, 6813},
+  {0x0, 13, 14, 6814},
+  {0x0, 7, 8, 6815},
+  {0xb94, 16, 16, 6816},
+  {0x0, 10, 11, 6816},
+  {0x0, 11, 12, 6817},
+  {0x2f961, 16, 16, 6818},
+  {0x0, 1, 2, 6818},
+  {0x213, 16, 16, 6819},
+  {0x0, 1, 12, 6819},
+  {0x1a0, 16, 16, 6830},
+  {0x0, 0, 9, 6830},
+  {0x3ca, 16, 16, 6839},
+  {0x0, 11, 12, 6839},
+  {0xf9f5, 16, 16, 6840},
+  {0x3af, 16, 16, 6840},
+  {0x1f76, 16, 16, 6840},
+  {0x1fd1, 16, 16, 6840},
+  {0x1fd0, 16, 16, 6840},
+  {0x1e99, 16, 16, 6840},
+  {0x0, 1, 2, 6840},
+  {0xf9ca, 16, 16, 6841},
+  {0x0, 1, 2, 6841},
+  {0x2f802, 16, 16, 6842},
+  {0x0, 0, 1, 6842},
+  {0x0, 0, 1, 6843},
+  {0x0, 6, 7, 6844},
+  {0x0, 5, 6, 6845},
+  {0x0, 4, 5, 6846},
+  {0x624, 16, 16, 6847},
+  {0x20e, 16, 16, 6847},
+  {0x0, 0, 1, 6847},
+  {0x0, 0, 1, 6848},
+  {0x0, 3, 4, 6849},
+  {0x0, 4, 5, 6850},
+  {0x0, 5, 6, 6851},
+  {0x1fae, 16, 16, 6852},
+  {0x0, 4, 5, 6852},
+  {0x2f8bd, 16, 16, 6853},
+  {0x0, 9, 10, 6853},
+  {0x2f949, 16, 16, 6854},
+  {0x0, 4, 5, 6854},
+  {0xf9a8, 16, 16, 6855},
+  {0x0, 3, 9, 6855},
+  {0x1e01, 16, 16, 6861},
+  {0x1ea1, 16, 16, 6861},
+  {0x1ef8, 16, 16, 6861},
+  {0x0, 0, 16, 6861},
+  {0x101, 16, 16, 6877},
+  {0x105, 16, 16, 6877},
+  {0x1f32, 16, 16, 6877},
+  {0x0, 0, 1, 6877},
+  {0x0, 3, 4, 6878},
+  {0x0, 0, 1, 6879},
+  {0x0, 9, 10, 6880},
+  {0x0, 9, 10, 6881},
+  {0x3069, 16, 16, 6882},
+  {0x0, 1, 13, 6882},
+  {0x139, 16, 16, 6894},
+  {0x0, 12, 13, 6894},
+  {0x2f9db, 16, 16, 6895},
+  {0x0, 9, 10, 6895},
+  {0xf96e, 16, 16, 6896},
+  {0x0, 3, 4, 6896},
+  {0x0, 0, 1, 6897},
+  {0x2fa09, 16, 16, 6898},
+  {0x0, 13, 14, 6898},
+  {0xf99e, 16, 16, 6899},
+  {0x0, 2, 3, 6899},
+  {0x2f85e, 16, 16, 6900},
+  {0x0, 13, 14, 6900},
+  {0xf91f, 16, 16, 6901},
+  {0x0, 13, 14, 6901},
+  {0x2f91a, 16, 16, 6902},
+  {0x13d, 16, 16, 6902},
+  {0x0, 0, 1, 6902},
+  {0x0, 3, 4, 6903},
+  {0x0, 0, 1, 6904},
+  {0x0, 9, 10, 6905},
+  {0x0, 9, 10, 6906},
+  {0x30f8, 16, 16, 6907},
+  {0x0, 5, 6, 6907},
+  {0x2f81d, 16, 16, 6908},
+  {0x2f945, 16, 16, 6908},
+  {0x0, 0, 1, 6908},
+  {0x0, 3, 4, 6909},
+  {0x0, 0, 1, 6910},
+  {0x0, 9, 10, 6911},
+  {0x0, 9, 10, 6912},
+  {0x30fa, 16, 16, 6913},
+  {0x0, 7, 12, 6913},
+  {0xf929, 16, 16, 6918},
+  {0x0, 14, 15, 6918},
+  {0xf917, 16, 16, 6919},
+  {0x0, 8, 12, 6919},
+  {0xfa07, 16, 16, 6923},
+  {0x0, 2, 6, 6923},
+  {0x1f0e, 16, 16, 6927},
+  {0x0, 0, 1, 6927},
+  {0x0, 0, 1, 6928},
+  {0x0, 3, 4, 6929},
+  {0x0, 0, 1, 6930},
+  {0x0, 1, 2, 6931},
+  {0x45c, 16, 16, 6932},
+  {0x1f88, 16, 16, 6932},
+  {0x0, 0, 1, 6932},
+  {0x0, 0, 1, 6933},
+  {0x0, 3, 4, 6934},
+  {0x0, 0, 1, 6935},
+  {0x0, 0, 2, 6936},
+  {0x1f4d, 16, 16, 6938},
+  {0x1f4b, 16, 16, 6938},
+  {0x0, 0, 1, 6938},
+  {0x0, 0, 1, 6939},
+  {0x0, 3, 4, 6940},
+  {0x0, 3, 4, 6941},
+  {0x0, 8, 9, 6942},
+  {0x22eb, 16, 16, 6943},
+  {0x0, 0, 1, 6943},
+  {0x0, 0, 1, 6944},
+  {0x0, 3, 4, 6945},
+  {0x0, 3, 4, 6946},
+  {0x0, 8, 9, 6947},
+  {0x226e, 16, 16, 6948},
+  {0x0, 0, 1, 6948},
+  {0xf9cf, 16, 16, 6949},
+  {0x0, 15, 16, 6949},
+  {0x2f8f4, 16, 16, 6950},
+  {0x0, 3, 5, 6950},
+  {0x1f11, 16, 16, 6952},
+  {0x1f10, 16, 16, 6952},
+  {0x0, 0, 1, 6952},
+  {0x0, 0, 1, 6953},
+  {0x0, 3, 4, 6954},
+  {0x0, 1, 2, 6955},
+  {0x0, 3, 5, 6956},
+  {0x1fe4, 16, 16, 6958},
+  {0x2f9df, 16, 16, 6958},
+  {0x1fe5, 16, 16, 6958},
+  {0x0, 0, 1, 6958},
+  {0x0, 3, 4, 6959},
+  {0x0, 0, 1, 6960},
+  {0x0, 9, 10, 6961},
+  {0x0, 9, 10, 6962},
+  {0x3067, 16, 16, 6963},
+  {0x1f4c, 16, 16, 6963},
+  {0x0, 6, 7, 6963},
+  {0x0, 10, 11, 6964},
+  {0xf987, 16, 16, 6965},
+  {0x2f87f, 16, 16, 6965},
+  {0x2f8d9, 16, 16, 6965},
+  {0x0, 0, 1, 6965},
+  {0xf990, 16, 16, 6966},
+  {0x0, 0, 1, 6966},
+  {0x2f879, 16, 16, 6967},
+  {0x1f73, 16, 16, 6967},
+  {0x0, 7, 8, 6967},
+  {0x2f9f0, 16, 16, 6968},
+  {0x1f77, 16, 16, 6968},
+  {0x1f71, 0, 1, 6968},
+  {0x0, 3, 4, 6969},
+  {0x0, 1, 2, 6970},
+  {0x2f892, 16, 16, 6971},
+  {0x0, 1, 2, 6971},
+  {0x1e95, 16, 16, 6972},
+  {0x0, 0, 1, 6972},
+  {0x0, 0, 1, 6973},
+  {0x0, 3, 4, 6974},
+  {0x0, 4, 5, 6975},
+  {0x0, 5, 6, 6976},
+  {0x1fa5, 16, 16, 6977},
+  {0x0, 0, 1, 6977},
+  {0x0, 3, 4, 6978},
+  {0x0, 4, 5, 6979},
+  {0x0, 5, 6, 6980},
+  {0x1fb4, 16, 16, 6981},
+  {0xf925, 16, 16, 6981},
+  {0xda, 16, 16, 6981},
+  {0x0, 6, 10, 6981},
+  {0xf9cc, 16, 16, 6985},
+  {0xf9e4, 16, 16, 6985},
+  {0x0, 3, 14, 6985},
+  {0x145, 16, 16, 6996},
+  {0x1e46, 16, 16, 6996},
+  {0x0, 3, 4, 6996},
+  {0x0, 5, 6, 6997},
+  {0x2f926, 16, 16, 6998},
+  {0x0, 2, 3, 6998},
+  {0x1fc1, 16, 16, 6999},
+  {0x0, 11, 12, 6999},
+  {0x2f9ff, 16, 16, 7000},
+  {0x0, 5, 6, 7000},
+  {0x2f955, 16, 16, 7001},
+  {0x0, 0, 1, 7001},
+  {0x0, 0, 1, 7002},
+  {0x0, 3, 4, 7003},
+  {0x0, 0, 1, 7004},
+  {0x0, 7, 8, 7005},
+  {0x1e66, 16, 16, 7006},
+  {0x0, 0, 1, 7006},
+  {0x0, 0, 1, 7007},
+  {0x0, 3, 4, 7008},
+  {0x0, 0, 1, 7009},
+  {0x0, 8, 9, 7010},
+  {0x4e6, 16, 16, 7011},
+  {0x0, 1, 2, 7011},
+  {0x1e3b, 16, 16, 7012},
+  {0x0, 7, 8, 7012},
+  {0x2f99e, 16, 16, 7013},
+  {0x1e4a, 16, 16, 7013},
+  {0xd9, 16, 16, 7013},
+  {0x0, 3, 4, 7013},
+  {0x1e7e, 16, 16, 7014},
+  {0x0, 0, 1, 7014},
+  {0x0, 0, 1, 7015},
+  {0x0, 3, 4, 7016},
+  {0x0, 0, 1, 7017},
+  {0x0, 1, 9, 7018},
+  {0x22d, 16, 16, 7026},
+  {0x0, 0, 1, 7026},
+  {0x0, 3, 4, 7027},
+  {0x0, 0, 1, 7028},
+  {0x0, 9, 10, 7029},
+  {0x0, 9, 10, 7030},
+  {0x30be, 16, 16, 7031},
+  {0x1e4d, 16, 16, 7031},
+  {0x1e4f, 16, 16, 7031},
+  {0x0, 0, 1, 7031},
+  {0x0, 0, 1, 7032},
+  {0x0, 3, 4, 7033},
+  {0x0, 3, 4, 7034},
+  {0x0, 8, 9, 7035},
+  {0x220c, 16, 16, 7036},
+  {0x0, 4, 5, 7036},
+  {0x2f84f, 16, 16, 7037},
+  {0x0, 3, 12, 7037},
+  {0xf931, 16, 16, 7046},
+  {0x0, 3, 4, 7046},
+  {0x2f849, 16, 16, 7047},
+  {0x0, 0, 1, 7047},
+  {0x0, 0, 1, 7048},
+  {0x0, 3, 4, 7049},
+  {0x0, 0, 1, 7050},
+  {0x0, 0, 2, 7051},
+  {0x1f1b, 16, 16, 7053},
+  {0x1f1d, 16, 16, 7053},
+  {0x0, 0, 1, 7053},
+  {0x0, 0, 1, 7054},
+  {0x0, 3, 4, 7055},
+  {0x0, 0, 1, 7056},
+  {0x0, 4, 5, 7057},
+  {0x22b, 16, 16, 7058},
+  {0x0, 8, 9, 7058},
+  {0xfa38, 16, 16, 7059},
+  {0x0, 7, 8, 7059},
+  {0xc7, 16, 16, 7060},
+  {0x0, 14, 15, 7060},
+  {0x2f936, 16, 16, 7061},
+  {0x0, 1, 9, 7061},
+  {0xf948, 16, 16, 7069},
+  {0x2f9d5, 16, 16, 7069},
+  {0x0, 12, 13, 7069},
+  {0x2f9a3, 16, 16, 7070},
+  {0xf903, 16, 16, 7070},
+  {0x2f8ed, 16, 16, 7070},
+  {0x0, 8, 9, 7070},
+  {0xf9b8, 16, 16, 7071},
+  {0x0, 11, 12, 7071},
+  {0x2f9da, 16, 16, 7072},
+  {0x0, 0, 11, 7072},
+  {0x2f9cf, 16, 16, 7083},
+  {0x0, 0, 1, 7083},
+  {0x0, 0, 1, 7084},
+  {0x0, 3, 4, 7085},
+  {0x0, 3, 4, 7086},
+  {0x0, 8, 9, 7087},
+  {0x2249, 16, 16, 7088},
+  {0x0, 6, 8, 7088},
+  {0x2f84b, 16, 16, 7090},
+  {0x2f84d, 16, 16, 7090},
+  {0x0, 6, 7, 7090},
+  {0x2f821, 16, 16, 7091},
+  {0x1ece, 16, 16, 7091},
+  {0xd6, 16, 16, 7091},
+  {0x22e, 16, 16, 7091},
+  {0x14e, 16, 16, 7091},
+  {0x14c, 16, 16, 7091},
+  {0x0, 13, 14, 7091},
+  {0x0, 10, 11, 7092},
+  {0x2f97b, 16, 16, 7093},
+  {0xd4, 16, 16, 7093},
+  {0xd3, 16, 16, 7093},
+  {0xd2, 16, 16, 7093},
+  {0x1eb3, 16, 16, 7093},
+  {0xfa40, 16, 16, 7093},
+  {0x1eb5, 16, 16, 7093},
+  {0x0, 13, 14, 7093},
+  {0x2f854, 16, 16, 7094},
+  {0x1eb1, 16, 16, 7094},
+  {0x0, 14, 15, 7094},
+  {0x2f890, 16, 16, 7095},
+  {0x0, 8, 9, 7095},
+  {0xfa67, 16, 16, 7096},
+  {0x0, 10, 16, 7096},
+  {0xdda, 16, 16, 7102},
+  {0x0, 8, 9, 7102},
+  {0xf9b4, 16, 16, 7103},
+  {0xddc, 16, 16, 7103},
+  {0xf9a1, 16, 16, 7103},
+  {0x0, 0, 1, 7103},
+  {0x0, 0, 1, 7104},
+  {0x0, 3, 4, 7105},
+  {0x0, 4, 5, 7106},
+  {0x0, 5, 6, 7107},
+  {0x1f8b, 16, 16, 7108},
+  {0x0, 3, 4, 7108},
+  {0x2f9f5, 16, 16, 7109},
+  {0x0, 14, 15, 7109},
+  {0x2f9b9, 16, 16, 7110},
+  {0x20c, 16, 16, 7110},
+  {0x0, 0, 1, 7110},
+  {0x0, 0, 1, 7111},
+  {0x0, 3, 4, 7112},
+  {0x0, 3, 4, 7113},
+  {0x0, 8, 9, 7114},
+  {0x2284, 16, 16, 7115},
+  {0x1d1, 16, 16, 7115},
+  {0x150, 16, 16, 7115},
+  {0x0, 7, 8, 7115},
+  {0xfa5f, 16, 16, 7116},
+  {0x0, 1, 13, 7116},
+  {0x1e6, 16, 16, 7128},
+  {0x0, 6, 7, 7128},
+  {0x2f9fd, 16, 16, 7129},
+  {0x0, 0, 1, 7129},
+  {0x0, 5, 6, 7130},
+  {0x2fa12, 16, 16, 7131},
+  {0x0, 8, 10, 7131},
+  {0x2fa04, 16, 16, 7133},
+  {0xfa2c, 16, 16, 7133},
+  {0x0, 15, 16, 7133},
+  {0xf940, 16, 16, 7134},
+  {0x0, 1, 2, 7134},
+  {0xfa4b, 16, 16, 7135},
+  {0x30d1, 16, 16, 7135},
+  {0x0, 2, 11, 7135},
+  {0x2f9f4, 16, 16, 7144},
+  {0x0, 15, 16, 7144},
+  {0xf94e, 16, 16, 7145},
+  {0x0, 0, 1, 7145},
+  {0x2f8d4, 16, 16, 7146},
+  {0x1f00, 16, 16, 7146},
+  {0x1f4, 16, 16, 7146},
+  {0x11c, 16, 16, 7146},
+  {0x1e20, 16, 16, 7146},
+  {0x11e, 16, 16, 7146},
+  {0x120, 16, 16, 7146},
+  {0x0, 3, 4, 7146},
+  {0x2f9f3, 16, 16, 7147},
+  {0x0, 9, 10, 7147},
+  {0xf9fb, 16, 16, 7148},
+  {0x1fef, 16, 16, 7148},
+  {0xf9ab, 16, 16, 7148},
+  {0x0, 3, 4, 7148},
+  {0xf94c, 16, 16, 7149},
+  {0x0, 0, 1, 7149},
+  {0x0, 0, 1, 7150},
+  {0x0, 3, 4, 7151},
+  {0x0, 4, 5, 7152},
+  {0x0, 5, 6, 7153},
+  {0x1f96, 16, 16, 7154},
+  {0x0, 0, 1, 7154},
+  {0x2f96a, 16, 16, 7155},
+  {0x1f72, 16, 16, 7155},
+  {0x0, 7, 12, 7155},
+  {0x2f90c, 16, 16, 7160},
+  {0x0, 0, 11, 7160},
+  {0x2f9d1, 16, 16, 7171},
+  {0x0, 0, 1, 7171},
+  {0x0, 0, 1, 7172},
+  {0x0, 3, 4, 7173},
+  {0x0, 0, 1, 7174},
+  {0x0, 1, 2, 7175},
+  {0x40c, 16, 16, 7176},
+  {0x0, 2, 12, 7176},
+  {0x2f89a, 16, 16, 7186},
+  {0x0, 7, 8, 7186},
+  {0x123, 16, 16, 7187},
+  {0x0, 5, 7, 7187},
+  {0xf974, 16, 16, 7189},
+  {0x2f996, 16, 16, 7189},
+  {0x0, 3, 4, 7189},
+  {0x1e93, 16, 16, 7190},
+  {0x0, 2, 3, 7190},
+  {0x1fe7, 16, 16, 7191},
+  {0x0, 2, 3, 7191},
+  {0x2f9fc, 16, 16, 7192},
+  {0x2f90b, 16, 16, 7192},
+  {0xf95a, 16, 16, 7192},
+  {0x0, 3, 5, 7192},
+  {0xfa02, 16, 16, 7194},
+  {0x2f8b6, 16, 16, 7194},
+  {0x0, 1, 2, 7194},
+  {0x1e48, 16, 16, 7195},
+  {0x4e4, 16, 16, 7195},
+  {0x4e2, 16, 16, 7195},
+  {0x0, 0, 1, 7195},
+  {0x0, 0, 1, 7196},
+  {0x0, 3, 4, 7197},
+  {0x0, 3, 4, 7198},
+  {0x0, 8, 9, 7199},
+  {0x2278, 16, 16, 7200},
+  {0x419, 16, 16, 7200},
+  {0x0, 1, 2, 7200},
+  {0x2f9c0, 16, 16, 7201},
+  {0x2f899, 16, 16, 7201},
+  {0x1e72, 16, 16, 7201},
+  {0x0, 4, 5, 7201},
+  {0xf98e, 16, 16, 7202},
+  {0x0, 5, 6, 7202},
+  {0x2f92b, 16, 16, 7203},
+  {0x0, 0, 1, 7203},
+  {0x2f9fa, 16, 16, 7204},
+  {0x0, 3, 14, 7204},
+  {0x1e0d, 16, 16, 7215},
+  {0x0, 6, 7, 7215},
+  {0x2f9f2, 16, 16, 7216},
+  {0x1e11, 16, 16, 7216},
+  {0x0, 14, 15, 7216},
+  {0x2f851, 16, 16, 7217},
+  {0x0, 6, 7, 7217},
+  {0x2f9f9, 16, 16, 7218},
+  {0x0, 2, 3, 7218},
+  {0xf9f9, 16, 16, 7219},
+  {0x0, 14, 15, 7219},
+  {0xf9a5, 16, 16, 7220},
+  {0x10f, 16, 16, 7220},
+  {0x0, 2, 6, 7220},
+  {0x1f0f, 16, 16, 7224},
+  {0x1f89, 16, 16, 7224},
+  {0x0, 15, 16, 7224},
+  {0x0, 0, 1, 7225},
+  {0x0, 0, 1, 7226},
+  {0x0, 3, 4, 7227},
+  {0x0, 0, 1, 7228},
+  {0x0, 7, 8, 7229},
+  {0x1e9b, 16, 16, 7230},
+  {0x1e13, 16, 16, 7230},
+  {0x0, 0, 3, 7230},
+  {0x2f84a, 16, 16, 7233},
+  {0xfa0d, 16, 16, 7233},
+  {0x0, 1, 2, 7233},
+  {0x2fa14, 16, 16, 7234},
+  {0x0, 12, 13, 7234},
+  {0x2f9ad, 16, 16, 7235},
+  {0x0, 10, 12, 7235},
+  {0xf9ff, 16, 16, 7237},
+  {0x2f820, 16, 16, 7237},
+  {0x0, 1, 2, 7237},
+  {0x2f84e, 16, 16, 7238},
+  {0x1fe8, 16, 16, 7238},
+  {0x1e58, 16, 16, 7238},
+  {0x1fe9, 16, 16, 7238},
+  {0x1fea, 16, 16, 7238},
+  {0x0, 13, 14, 7238},
+  {0x2f8f7, 16, 16, 7239},
+  {0x0, 0, 1, 7239},
+  {0x0, 0, 1, 7240},
+  {0x0, 3, 4, 7241},
+  {0x0, 4, 5, 7242},
+  {0x0, 5, 6, 7243},
+  {0x1f97, 16, 16, 7244},
+  {0x3ab, 16, 16, 7244},
+  {0x0, 3, 4, 7244},
+  {0xf9f1, 16, 16, 7245},
+  {0x210, 16, 16, 7245},
+  {0x2f9a2, 16, 16, 7245},
+  {0x158, 16, 16, 7245},
+  {0x0, 5, 6, 7245},
+  {0x2f9c8, 16, 16, 7246},
+  {0x0, 0, 2, 7246},
+  {0x1fc8, 16, 16, 7248},
+  {0x388, 16, 16, 7248},
+  {0x0, 12, 13, 7248},
+  {0xf9cb, 16, 16, 7249},
+  {0x0, 1, 2, 7249},
+  {0xfa62, 16, 16, 7250},
+  {0x0, 9, 10, 7250},
+  {0xf9a9, 16, 16, 7251},
+  {0x0, 14, 15, 7251},
+  {0xf9b6, 16, 16, 7252},
+  {0x0, 5, 6, 7252},
+  {0xf9e3, 16, 16, 7253},
+  {0x0, 11, 12, 7253},
+  {0xf9ce, 16, 16, 7254},
+  {0x0, 3, 4, 7254},
+  {0x1ef5, 16, 16, 7255},
+  {0x0, 1, 2, 7255},
+  {0x1e49, 16, 16, 7256},
+  {0x0, 0, 1, 7256},
+  {0x0, 0, 1, 7257},
+  {0x0, 3, 4, 7258},
+  {0x0, 0, 1, 7259},
+  {0x0, 0, 2, 7260},
+  {0x1f1c, 16, 16, 7262},
+  {0x1f1a, 16, 16, 7262},
+  {0x0, 3, 4, 7262},
+  {0xf99a, 16, 16, 7263},
+  {0xe4, 16, 16, 7263},
+  {0x1ea3, 16, 16, 7263},
+  {0x0, 0, 1, 7263},
+  {0x0, 3, 4, 7264},
+  {0x0, 0, 1, 7265},
+  {0x0, 9, 10, 7266},
+  {0x0, 9, 10, 7267},
+  {0x3054, 16, 16, 7268},
+  {0x0, 1, 3, 7268},
+  {0x2f856, 16, 16, 7270},
+  {0x2f857, 16, 16, 7270},
+  {0xe0, 16, 16, 7270},
+  {0xe1, 16, 16, 7270},
+  {0xe2, 16, 16, 7270},
+  {0xe3, 16, 16, 7270},
+  {0x0, 9, 10, 7270},
+  {0x2f82c, 16, 16, 7271},
+  {0x103, 16, 16, 7271},
+  {0x227, 16, 16, 7271},
+  {0x0, 0, 1, 7271},
+  {0x0, 0, 1, 7272},
+  {0x0, 3, 4, 7273},
+  {0x0, 0, 1, 7274},
+  {0x0, 0, 2, 7275},
+  {0x1f13, 16, 16, 7277},
+  {0x1f15, 16, 16, 7277},
+  {0x0, 1, 2, 7277},
+  {0x2f930, 16, 16, 7278},
+  {0x0, 0, 2, 7278},
+  {0x1f62, 16, 16, 7280},
+  {0x1f64, 16, 16, 7280},
+  {0x0, 2, 3, 7280},
+  {0xf938, 16, 16, 7281},
+  {0x0, 12, 13, 7281},
+  {0xf93b, 16, 16, 7282},
+  {0x0, 6, 7, 7282},
+  {0xf935, 16, 16, 7283},
+  {0x0, 0, 1, 7283},
+  {0x0, 0, 1, 7284},
+  {0x0, 3, 4, 7285},
+  {0x0, 4, 5, 7286},
+  {0x0, 5, 6, 7287},
+  {0x1f8c, 16, 16, 7288},
+  {0x0, 0, 1, 7288},
+  {0x0, 0, 1, 7289},
+  {0x0, 3, 4, 7290},
+  {0x0, 0, 1, 7291},
+  {0x0, 2, 3, 7292},
+  {0x1ed9, 16, 16, 7293},
+  {0xe5, 16, 16, 7293},
+  {0x1ce, 16, 16, 7293},
+  {0x0, 11, 12, 7293},
+  {0x2f9a7, 16, 16, 7294},
+  {0x201, 16, 16, 7294},
+  {0x0, 11, 12, 7294},
+  {0x2f990, 16, 16, 7295},
+  {0x0, 6, 7, 7295},
+  {0x2f85c, 16, 16, 7296},
+  {0x0, 0, 1, 7296},
+  {0x0, 0, 1, 7297},
+  {0x0, 3, 4, 7298},
+  {0x0, 4, 5, 7299},
+  {0x0, 5, 6, 7300},
+  {0x1fa3, 16, 16, 7301},
+  {0x0, 6, 7, 7301},
+  {0x2f9aa, 16, 16, 7302},
+  {0x0, 6, 7, 7302},
+  {0xf9b0, 16, 16, 7303},
+  {0x0, 1, 3, 7303},
+  {0x2f881, 16, 16, 7305},
+  {0x2f882, 16, 16, 7305},
+  {0x0, 2, 3, 7305},
+  {0xf9c1, 16, 16, 7306},
+  {0x0, 2, 7, 7306},
+  {0xfa03, 16, 16, 7311},
+  {0x0, 10, 11, 7311},
+  {0x2f932, 16, 16, 7312},
+  {0x2f966, 16, 16, 7312},
+  {0x0, 10, 11, 7312},
+  {0xf9ec, 16, 16, 7313},
+  {0x1e50, 16, 16, 7313},
+  {0x0, 6, 7, 7313},
+  {0xfa61, 16, 16, 7314},
+  {0x0, 1, 13, 7314},
+  {0x109, 16, 16, 7326},
+  {0x107, 16, 16, 7326},
+  {0x10b, 16, 16, 7326},
+  {0x0, 1, 2, 7326},
+  {0x0, 0, 1, 7327},
+  {0x0, 0, 1, 7328},
+  {0x0, 6, 7, 7329},
+  {0x0, 5, 6, 7330},
+  {0x0, 4, 5, 7331},
+  {0x6c2, 16, 16, 7332},
+  {0x0, 2, 3, 7332},
+  {0xf9bf, 16, 16, 7333},
+  {0x0, 0, 1, 7333},
+  {0x0, 0, 1, 7334},
+  {0x2fa1d, 16, 16, 7335},
+  {0x0, 3, 4, 7335},
+  {0x1ef4, 16, 16, 7336},
+  {0x0, 14, 15, 7336},
+  {0x2f9dd, 16, 16, 7337},
+  {0x0, 0, 4, 7337},
+  {0x2f9c4, 16, 16, 7341},
+  {0x0, 0, 1, 7341},
+  {0x0, 0, 1, 7342},
+  {0x0, 3, 4, 7343},
+  {0x0, 4, 5, 7344},
+  {0x0, 5, 6, 7345},
+  {0x1f87, 16, 16, 7346},
+  {0x2f9c3, 16, 16, 7346},
+  {0x0, 11, 12, 7346},
+  {0xf964, 16, 16, 7347},
+  {0x0, 12, 15, 7347},
+  {0xfa15, 16, 16, 7350},
+  {0xf954, 16, 16, 7350},
+  {0x0, 2, 3, 7350},
+  {0xf946, 16, 16, 7351},
+  {0x0, 0, 1, 7351},
+  {0x0, 0, 1, 7352},
+  {0x0, 3, 4, 7353},
+  {0x0, 3, 4, 7354},
+  {0x0, 8, 9, 7355},
+  {0x2226, 16, 16, 7356},
+  {0x1f79, 16, 16, 7356},
+  {0x0, 0, 1, 7356},
+  {0x0, 0, 1, 7357},
+  {0x0, 3, 4, 7358},
+  {0x0, 3, 4, 7359},
+  {0x0, 8, 9, 7360},
+  {0x21ce, 16, 16, 7361},
+  {0x1d4, 16, 16, 7361},
+  {0x1f7b, 16, 16, 7361},
+  {0x10d, 16, 16, 7361},
+  {0x0, 2, 10, 7361},
+  {0x2f96f, 16, 16, 7369},
+  {0xfa58, 16, 16, 7369},
+};
+
+const unsigned short _wind_canon_next_table[] = {
+  1,
+  0,
+  46,
+  29,
+  15,
+  73,
+  64,
+  11,
+  6,
+  24,
+  38,
+  2,
+  42,
+  722,
+  2119,
+  3,
+  140,
+  1467,
+  221,
+  325,
+  285,
+  682,
+  360,
+  729,
+  1610,
+  635,
+  106,
+  2045,
+  510,
+  2830,
+  0,
+  0,
+  0,
+  0,
+  0,
+  748,
+  1101,
+  4614,
+  273,
+  0,
+  4,
+  0,
+  0,
+  4440,
+  5,
+  0,
+  10,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  97,
+  224,
+  1388,
+  270,
+  249,
+  1440,
+  550,
+  3741,
+  2040,
+  7,
+  419,
+  54,
+  109,
+  883,
+  1230,
+  275,
+  336,
+  4348,
+  0,
+  0,
+  4568,
+  3216,
+  2891,
+  0,
+  0,
+  0,
+  0,
+  1305,
+  0,
+  0,
+  8,
+  4480,
+  937,
+  112,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  9,
+  1532,
+  2106,
+  1144,
+  236,
+  1215,
+  1449,
+  1624,
+  0,
+  0,
+  12,
+  194,
+  1718,
+  1680,
+  3611,
+  217,
+  398,
+  13,
+  0,
+  0,
+  0,
+  0,
+  4477,
+  14,
+  2316,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  328,
+  16,
+  553,
+  3511,
+  17,
+  646,
+  732,
+  426,
+  532,
+  57,
+  0,
+  0,
+  0,
+  278,
+  1790,
+  0,
+  0,
+  658,
+  695,
+  2327,
+  3451,
+  3868,
+  18,
+  666,
+  4417,
+  4518,
+  391,
+  1640,
+  1458,
+  567,
+  340,
+  2209,
+  2458,
+  1747,
+  19,
+  20,
+  21,
+  22,
+  23,
+  1307,
+  304,
+  1254,
+  227,
+  750,
+  51,
+  1120,
+  1576,
+  467,
+  1270,
+  2751,
+  25,
+  1647,
+  183,
+  1785,
+  363,
+  1315,
+  0,
+  1982,
+  0,
+  0,
+  2474,
+  0,
+  1656,
+  0,
+  4178,
+  4486,
+  26,
+  28,
+  27,
+  132,
+  82,
+  346,
+  186,
+  98,
+  0,
+  30,
+  0,
+  0,
+  1028,
+  0,
+  1050,
+  739,
+  113,
+  0,
+  2135,
+  1415,
+  0,
+  4020,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4647,
+  31,
+  3197,
+  0,
+  0,
+  32,
+  33,
+  34,
+  35,
+  36,
+  37,
+  354,
+  809,
+  436,
+  1736,
+  39,
+  547,
+  708,
+  1945,
+  850,
+  367,
+  594,
+  1651,
+  388,
+  416,
+  1251,
+  705,
+  4230,
+  0,
+  1894,
+  0,
+  886,
+  424,
+  40,
+  4586,
+  2250,
+  1941,
+  0,
+  0,
+  4635,
+  41,
+  1224,
+  1391,
+  813,
+  1807,
+  3757,
+  308,
+  442,
+  43,
+  439,
+  121,
+  4198,
+  1596,
+  1298,
+  529,
+  1244,
+  1948,
+  4367,
+  4591,
+  2500,
+  2808,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4473,
+  44,
+  45,
+  239,
+  1073,
+  1218,
+  543,
+  506,
+  124,
+  47,
+  128,
+  772,
+  725,
+  291,
+  3715,
+  357,
+  3693,
+  4339,
+  759,
+  0,
+  2181,
+  0,
+  0,
+  0,
+  3076,
+  48,
+  2065,
+  0,
+  3213,
+  49,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1375,
+  50,
+  1333,
+  0,
+  1993,
+  1665,
+  0,
+  52,
+  0,
+  0,
+  1352,
+  0,
+  3457,
+  53,
+  1249,
+  55,
+  0,
+  0,
+  0,
+  1627,
+  0,
+  0,
+  0,
+  0,
+  1920,
+  56,
+  2143,
+  0,
+  0,
+  0,
+  58,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2970,
+  59,
+  60,
+  61,
+  62,
+  63,
+  65,
+  0,
+  0,
+  0,
+  1683,
+  403,
+  1593,
+  1555,
+  862,
+  2420,
+  151,
+  259,
+  1010,
+  2377,
+  2719,
+  385,
+  2542,
+  0,
+  0,
+  0,
+  826,
+  894,
+  66,
+  610,
+  0,
+  2676,
+  513,
+  90,
+  452,
+  1152,
+  1560,
+  470,
+  3342,
+  0,
+  0,
+  67,
+  0,
+  4191,
+  0,
+  4103,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1443,
+  68,
+  69,
+  70,
+  71,
+  72,
+  539,
+  985,
+  74,
+  1870,
+  0,
+  675,
+  1542,
+  75,
+  0,
+  1085,
+  210,
+  2259,
+  2582,
+  498,
+  295,
+  76,
+  0,
+  3605,
+  0,
+  0,
+  4323,
+  0,
+  0,
+  0,
+  0,
+  1741,
+  77,
+  78,
+  79,
+  80,
+  81,
+  2790,
+  587,
+  0,
+  0,
+  978,
+  1368,
+  83,
+  4492,
+  0,
+  0,
+  161,
+  2601,
+  0,
+  0,
+  628,
+  4245,
+  2052,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2488,
+  2098,
+  1037,
+  84,
+  85,
+  86,
+  87,
+  88,
+  89,
+  372,
+  0,
+  154,
+  0,
+  3528,
+  0,
+  1493,
+  0,
+  91,
+  0,
+  1275,
+  0,
+  4271,
+  0,
+  2079,
+  92,
+  93,
+  94,
+  95,
+  96,
+  3288,
+  1345,
+  1907,
+  99,
+  1176,
+  2738,
+  0,
+  3255,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1615,
+  2341,
+  764,
+  0,
+  0,
+  1103,
+  0,
+  1711,
+  2982,
+  100,
+  143,
+  0,
+  4150,
+  0,
+  0,
+  0,
+  3444,
+  101,
+  102,
+  103,
+  104,
+  105,
+  527,
+  881,
+  0,
+  0,
+  0,
+  0,
+  0,
+  107,
+  0,
+  0,
+  0,
+  4111,
+  4319,
+  0,
+  2519,
+  2853,
+  108,
+  1939,
+  0,
+  0,
+  110,
+  0,
+  0,
+  0,
+  0,
+  3917,
+  0,
+  0,
+  0,
+  2192,
+  1883,
+  1470,
+  1202,
+  111,
+  318,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  114,
+  2770,
+  0,
+  0,
+  115,
+  116,
+  117,
+  118,
+  119,
+  120,
+  4389,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2672,
+  0,
+  2002,
+  0,
+  0,
+  122,
+  123,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  179,
+  925,
+  125,
+  0,
+  0,
+  1310,
+  0,
+  1686,
+  0,
+  0,
+  1571,
+  3387,
+  4056,
+  1539,
+  0,
+  0,
+  3187,
+  126,
+  0,
+  954,
+  127,
+  1047,
+  0,
+  0,
+  1771,
+  0,
+  0,
+  3590,
+  0,
+  3849,
+  3246,
+  0,
+  0,
+  129,
+  0,
+  0,
+  433,
+  130,
+  131,
+  3069,
+  133,
+  197,
+  168,
+  1797,
+  0,
+  0,
+  579,
+  1377,
+  445,
+  2552,
+  460,
+  2528,
+  1957,
+  1845,
+  134,
+  2847,
+  901,
+  1326,
+  3859,
+  3234,
+  1193,
+  993,
+  753,
+  3534,
+  520,
+  2171,
+  2023,
+  135,
+  136,
+  137,
+  138,
+  0,
+  4306,
+  181,
+  182,
+  0,
+  0,
+  0,
+  0,
+  180,
+  0,
+  0,
+  0,
+  0,
+  139,
+  842,
+  1889,
+  1537,
+  0,
+  2198,
+  3252,
+  0,
+  0,
+  0,
+  2711,
+  3762,
+  3357,
+  4313,
+  4259,
+  141,
+  142,
+  144,
+  145,
+  146,
+  147,
+  160,
+  0,
+  0,
+  0,
+  150,
+  0,
+  149,
+  0,
+  148,
+  3760,
+  0,
+  0,
+  0,
+  152,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2861,
+  153,
+  155,
+  156,
+  157,
+  158,
+  159,
+  1382,
+  1759,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  162,
+  163,
+  164,
+  165,
+  166,
+  0,
+  958,
+  799,
+  167,
+  0,
+  175,
+  0,
+  0,
+  0,
+  0,
+  0,
+  177,
+  4413,
+  312,
+  479,
+  792,
+  561,
+  169,
+  3769,
+  3920,
+  1487,
+  230,
+  1065,
+  2427,
+  3365,
+  573,
+  1452,
+  204,
+  170,
+  171,
+  172,
+  962,
+  1366,
+  173,
+  2855,
+  174,
+  0,
+  0,
+  0,
+  176,
+  178,
+  0,
+  0,
+  0,
+  0,
+  220,
+  3165,
+  0,
+  2515,
+  4072,
+  0,
+  3470,
+  2736,
+  685,
+  0,
+  0,
+  0,
+  4065,
+  956,
+  1426,
+  184,
+  185,
+  1529,
+  1199,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1294,
+  252,
+  187,
+  406,
+  263,
+  802,
+  3985,
+  0,
+  0,
+  0,
+  188,
+  0,
+  0,
+  0,
+  2521,
+  0,
+  0,
+  4211,
+  4207,
+  1549,
+  4210,
+  189,
+  190,
+  191,
+  3706,
+  192,
+  193,
+  195,
+  4482,
+  0,
+  0,
+  0,
+  4447,
+  196,
+  3144,
+  0,
+  198,
+  1689,
+  1971,
+  3023,
+  3687,
+  844,
+  1257,
+  816,
+  2650,
+  199,
+  200,
+  201,
+  1569,
+  202,
+  623,
+  1006,
+  203,
+  205,
+  206,
+  207,
+  2194,
+  208,
+  2835,
+  209,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1869,
+  2545,
+  2111,
+  0,
+  0,
+  4458,
+  3207,
+  0,
+  0,
+  3111,
+  491,
+  243,
+  211,
+  212,
+  213,
+  214,
+  215,
+  216,
+  218,
+  0,
+  0,
+  3956,
+  4074,
+  0,
+  0,
+  0,
+  2374,
+  0,
+  2864,
+  0,
+  2217,
+  0,
+  4093,
+  219,
+  4624,
+  0,
+  0,
+  0,
+  0,
+  3181,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1313,
+  0,
+  0,
+  222,
+  223,
+  225,
+  0,
+  960,
+  0,
+  0,
+  0,
+  0,
+  3964,
+  0,
+  2070,
+  0,
+  0,
+  3710,
+  3722,
+  1821,
+  226,
+  228,
+  0,
+  2337,
+  2010,
+  1739,
+  3930,
+  0,
+  2844,
+  0,
+  2205,
+  0,
+  4089,
+  229,
+  231,
+  232,
+  233,
+  234,
+  2125,
+  1147,
+  1504,
+  1852,
+  1853,
+  1854,
+  1855,
+  1856,
+  0,
+  1857,
+  0,
+  1858,
+  1859,
+  0,
+  0,
+  235,
+  0,
+  0,
+  1893,
+  2151,
+  0,
+  0,
+  2478,
+  0,
+  237,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3627,
+  238,
+  3084,
+  0,
+  0,
+  0,
+  240,
+  3098,
+  0,
+  3417,
+  0,
+  2733,
+  288,
+  4042,
+  241,
+  0,
+  3183,
+  242,
+  244,
+  245,
+  246,
+  247,
+  248,
+  1464,
+  1829,
+  0,
+  2409,
+  4575,
+  250,
+  0,
+  1026,
+  0,
+  0,
+  0,
+  0,
+  422,
+  3040,
+  3298,
+  3659,
+  311,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  251,
+  3254,
+  1774,
+  0,
+  0,
+  0,
+  253,
+  0,
+  378,
+  0,
+  2976,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2353,
+  254,
+  255,
+  256,
+  4532,
+  257,
+  262,
+  258,
+  3195,
+  260,
+  0,
+  0,
+  2060,
+  0,
+  0,
+  0,
+  0,
+  3061,
+  261,
+  4183,
+  0,
+  0,
+  0,
+  2127,
+  0,
+  0,
+  0,
+  1703,
+  2090,
+  1263,
+  4685,
+  4693,
+  264,
+  265,
+  266,
+  267,
+  268,
+  269,
+  1017,
+  644,
+  271,
+  4507,
+  4332,
+  0,
+  0,
+  3482,
+  3765,
+  3492,
+  3442,
+  3526,
+  3205,
+  2857,
+  2559,
+  701,
+  272,
+  307,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  274,
+  2989,
+  3322,
+  0,
+  0,
+  1608,
+  4469,
+  0,
+  0,
+  2068,
+  302,
+  1380,
+  276,
+  626,
+  4351,
+  277,
+  3593,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  279,
+  280,
+  281,
+  282,
+  3789,
+  0,
+  0,
+  0,
+  283,
+  284,
+  4369,
+  0,
+  286,
+  0,
+  0,
+  0,
+  3021,
+  3494,
+  1812,
+  0,
+  0,
+  2284,
+  0,
+  0,
+  4465,
+  287,
+  289,
+  290,
+  1317,
+  4386,
+  2437,
+  292,
+  0,
+  0,
+  4656,
+  293,
+  294,
+  2033,
+  4164,
+  296,
+  3461,
+  297,
+  298,
+  299,
+  300,
+  301,
+  1015,
+  0,
+  0,
+  1016,
+  0,
+  0,
+  303,
+  1905,
+  0,
+  2597,
+  2301,
+  305,
+  2348,
+  2104,
+  3179,
+  0,
+  3830,
+  0,
+  2359,
+  306,
+  309,
+  0,
+  477,
+  4208,
+  310,
+  313,
+  314,
+  315,
+  4099,
+  316,
+  4095,
+  317,
+  319,
+  3561,
+  320,
+  321,
+  322,
+  3163,
+  0,
+  323,
+  324,
+  4595,
+  326,
+  4122,
+  2012,
+  0,
+  1788,
+  719,
+  0,
+  2058,
+  0,
+  2075,
+  0,
+  0,
+  0,
+  3390,
+  327,
+  1058,
+  0,
+  712,
+  408,
+  0,
+  0,
+  0,
+  329,
+  1629,
+  1110,
+  330,
+  2162,
+  331,
+  332,
+  333,
+  334,
+  335,
+  0,
+  0,
+  0,
+  339,
+  3940,
+  0,
+  3286,
+  0,
+  0,
+  337,
+  4436,
+  0,
+  1343,
+  871,
+  1287,
+  0,
+  1301,
+  3655,
+  0,
+  2995,
+  338,
+  341,
+  342,
+  343,
+  344,
+  345,
+  347,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3013,
+  0,
+  3885,
+  3735,
+  2293,
+  919,
+  348,
+  0,
+  0,
+  0,
+  0,
+  1396,
+  2223,
+  349,
+  350,
+  351,
+  352,
+  353,
+  2502,
+  0,
+  2168,
+  1591,
+  0,
+  0,
+  355,
+  0,
+  4411,
+  4124,
+  0,
+  1008,
+  3222,
+  402,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  401,
+  0,
+  0,
+  0,
+  0,
+  0,
+  356,
+  3038,
+  0,
+  2386,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  358,
+  359,
+  2866,
+  0,
+  0,
+  0,
+  0,
+  3271,
+  0,
+  361,
+  4641,
+  362,
+  4399,
+  0,
+  364,
+  0,
+  0,
+  0,
+  3883,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3876,
+  0,
+  1922,
+  2314,
+  366,
+  365,
+  3249,
+  1663,
+  1241,
+  1558,
+  1903,
+  2215,
+  368,
+  0,
+  4541,
+  0,
+  687,
+  0,
+  3490,
+  370,
+  369,
+  371,
+  373,
+  374,
+  375,
+  376,
+  377,
+  379,
+  380,
+  381,
+  382,
+  865,
+  0,
+  0,
+  1924,
+  383,
+  384,
+  3670,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  386,
+  387,
+  1408,
+  0,
+  0,
+  2423,
+  0,
+  0,
+  4484,
+  0,
+  2946,
+  0,
+  4633,
+  389,
+  1864,
+  0,
+  0,
+  0,
+  1879,
+  390,
+  392,
+  393,
+  394,
+  3865,
+  0,
+  0,
+  0,
+  395,
+  396,
+  0,
+  0,
+  397,
+  399,
+  0,
+  1969,
+  0,
+  3392,
+  2333,
+  400,
+  404,
+  405,
+  407,
+  1019,
+  0,
+  0,
+  0,
+  2745,
+  0,
+  1136,
+  0,
+  415,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2949,
+  835,
+  409,
+  410,
+  411,
+  412,
+  413,
+  414,
+  653,
+  4423,
+  4176,
+  3845,
+  0,
+  0,
+  0,
+  417,
+  0,
+  0,
+  0,
+  2599,
+  2291,
+  1934,
+  0,
+  0,
+  3574,
+  418,
+  4616,
+  420,
+  4120,
+  0,
+  1510,
+  1862,
+  762,
+  1191,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3095,
+  3484,
+  421,
+  505,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  423,
+  425,
+  999,
+  597,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  427,
+  428,
+  429,
+  430,
+  3914,
+  0,
+  0,
+  0,
+  431,
+  432,
+  434,
+  435,
+  437,
+  1581,
+  1239,
+  0,
+  3895,
+  4677,
+  0,
+  3603,
+  3274,
+  0,
+  0,
+  1507,
+  0,
+  0,
+  3082,
+  438,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1726,
+  4241,
+  4357,
+  703,
+  440,
+  0,
+  1043,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2797,
+  3720,
+  441,
+  2824,
+  0,
+  2177,
+  0,
+  0,
+  1092,
+  1434,
+  0,
+  4525,
+  4317,
+  4409,
+  0,
+  443,
+  3123,
+  459,
+  444,
+  1512,
+  0,
+  855,
+  446,
+  3312,
+  970,
+  0,
+  0,
+  2722,
+  0,
+  0,
+  0,
+  0,
+  1838,
+  447,
+  448,
+  449,
+  450,
+  451,
+  1523,
+  0,
+  0,
+  3410,
+  0,
+  689,
+  0,
+  453,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  875,
+  454,
+  455,
+  456,
+  457,
+  458,
+  1727,
+  0,
+  2305,
+  928,
+  485,
+  461,
+  0,
+  0,
+  2278,
+  0,
+  0,
+  0,
+  0,
+  1823,
+  462,
+  463,
+  464,
+  465,
+  466,
+  1932,
+  0,
+  0,
+  0,
+  468,
+  0,
+  0,
+  1303,
+  0,
+  3423,
+  469,
+  4127,
+  471,
+  4136,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2464,
+  472,
+  473,
+  474,
+  475,
+  476,
+  478,
+  480,
+  481,
+  482,
+  483,
+  0,
+  3191,
+  873,
+  484,
+  486,
+  487,
+  488,
+  489,
+  490,
+  0,
+  0,
+  497,
+  492,
+  493,
+  494,
+  495,
+  496,
+  3810,
+  0,
+  0,
+  0,
+  0,
+  0,
+  604,
+  2380,
+  0,
+  499,
+  500,
+  501,
+  502,
+  503,
+  504,
+  3552,
+  1954,
+  0,
+  0,
+  951,
+  4236,
+  3402,
+  0,
+  0,
+  0,
+  507,
+  0,
+  0,
+  2868,
+  2608,
+  0,
+  0,
+  0,
+  0,
+  0,
+  508,
+  509,
+  3887,
+  4146,
+  0,
+  0,
+  511,
+  0,
+  0,
+  2252,
+  0,
+  2122,
+  512,
+  3117,
+  0,
+  0,
+  0,
+  0,
+  1695,
+  0,
+  888,
+  0,
+  514,
+  515,
+  516,
+  517,
+  518,
+  519,
+  521,
+  522,
+  523,
+  524,
+  0,
+  1296,
+  525,
+  0,
+  0,
+  0,
+  0,
+  0,
+  526,
+  528,
+  2580,
+  0,
+  0,
+  0,
+  0,
+  1991,
+  0,
+  0,
+  0,
+  530,
+  531,
+  3472,
+  786,
+  3153,
+  4618,
+  3901,
+  4217,
+  2388,
+  3042,
+  2452,
+  2697,
+  533,
+  2908,
+  2873,
+  1753,
+  4083,
+  1402,
+  534,
+  535,
+  536,
+  537,
+  538,
+  540,
+  542,
+  541,
+  2449,
+  0,
+  544,
+  1667,
+  934,
+  0,
+  2403,
+  0,
+  3160,
+  0,
+  868,
+  0,
+  1133,
+  3542,
+  2266,
+  2186,
+  545,
+  546,
+  548,
+  4308,
+  0,
+  1670,
+  1967,
+  2289,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3487,
+  549,
+  3702,
+  0,
+  0,
+  0,
+  2401,
+  1428,
+  0,
+  672,
+  1045,
+  551,
+  4289,
+  4500,
+  552,
+  941,
+  554,
+  1337,
+  3724,
+  2535,
+  2509,
+  1599,
+  4665,
+  779,
+  1355,
+  3614,
+  4361,
+  4597,
+  3676,
+  638,
+  3948,
+  555,
+  556,
+  557,
+  1979,
+  0,
+  0,
+  0,
+  558,
+  559,
+  0,
+  0,
+  560,
+  562,
+  563,
+  564,
+  565,
+  0,
+  4475,
+  1430,
+  566,
+  0,
+  0,
+  0,
+  0,
+  4488,
+  568,
+  569,
+  570,
+  571,
+  572,
+  574,
+  575,
+  576,
+  1804,
+  0,
+  577,
+  578,
+  580,
+  581,
+  582,
+  583,
+  584,
+  0,
+  0,
+  0,
+  4239,
+  585,
+  586,
+  1815,
+  588,
+  589,
+  590,
+  591,
+  592,
+  3190,
+  593,
+  3819,
+  0,
+  0,
+  2153,
+  0,
+  0,
+  0,
+  770,
+  0,
+  0,
+  0,
+  2688,
+  0,
+  595,
+  596,
+  598,
+  599,
+  600,
+  601,
+  0,
+  0,
+  0,
+  2004,
+  602,
+  603,
+  605,
+  606,
+  607,
+  608,
+  609,
+  3435,
+  0,
+  0,
+  1585,
+  0,
+  0,
+  611,
+  0,
+  0,
+  617,
+  612,
+  613,
+  614,
+  615,
+  616,
+  950,
+  618,
+  619,
+  620,
+  621,
+  940,
+  622,
+  624,
+  0,
+  0,
+  0,
+  625,
+  627,
+  629,
+  1208,
+  630,
+  631,
+  632,
+  633,
+  634,
+  3269,
+  2006,
+  0,
+  0,
+  0,
+  0,
+  3731,
+  0,
+  4310,
+  636,
+  637,
+  639,
+  640,
+  641,
+  642,
+  643,
+  645,
+  1170,
+  1320,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1832,
+  647,
+  648,
+  649,
+  650,
+  651,
+  0,
+  0,
+  0,
+  2133,
+  3450,
+  652,
+  654,
+  655,
+  4063,
+  3782,
+  0,
+  0,
+  656,
+  657,
+  2885,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  659,
+  660,
+  661,
+  662,
+  663,
+  0,
+  0,
+  0,
+  2063,
+  665,
+  664,
+  667,
+  668,
+  669,
+  670,
+  671,
+  674,
+  0,
+  0,
+  673,
+  676,
+  0,
+  4679,
+  677,
+  678,
+  679,
+  680,
+  681,
+  2966,
+  3324,
+  0,
+  0,
+  683,
+  0,
+  4663,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1117,
+  1149,
+  1567,
+  1865,
+  684,
+  686,
+  688,
+  690,
+  691,
+  692,
+  693,
+  694,
+  696,
+  697,
+  698,
+  699,
+  0,
+  0,
+  0,
+  3891,
+  700,
+  2696,
+  702,
+  0,
+  0,
+  0,
+  0,
+  2247,
+  704,
+  706,
+  1228,
+  800,
+  0,
+  2859,
+  0,
+  0,
+  0,
+  3278,
+  711,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  707,
+  747,
+  3266,
+  0,
+  0,
+  4631,
+  0,
+  777,
+  0,
+  0,
+  0,
+  0,
+  0,
+  709,
+  0,
+  1574,
+  2565,
+  710,
+  1673,
+  713,
+  714,
+  715,
+  716,
+  717,
+  718,
+  720,
+  0,
+  721,
+  3508,
+  0,
+  0,
+  0,
+  4626,
+  0,
+  723,
+  1205,
+  3975,
+  0,
+  1965,
+  2339,
+  776,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  724,
+  2072,
+  3816,
+  0,
+  2900,
+  726,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4115,
+  727,
+  728,
+  4321,
+  0,
+  0,
+  1499,
+  1071,
+  730,
+  731,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3686,
+  2394,
+  2643,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  733,
+  4157,
+  734,
+  735,
+  736,
+  737,
+  738,
+  4197,
+  740,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3966,
+  1159,
+  741,
+  742,
+  743,
+  744,
+  745,
+  746,
+  749,
+  2517,
+  0,
+  0,
+  0,
+  3657,
+  3893,
+  0,
+  1363,
+  0,
+  0,
+  751,
+  752,
+  754,
+  755,
+  756,
+  1867,
+  0,
+  1168,
+  757,
+  758,
+  760,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2623,
+  761,
+  763,
+  765,
+  766,
+  767,
+  768,
+  769,
+  0,
+  3768,
+  771,
+  2350,
+  0,
+  1289,
+  0,
+  0,
+  0,
+  773,
+  0,
+  2914,
+  774,
+  775,
+  778,
+  780,
+  781,
+  782,
+  783,
+  0,
+  0,
+  0,
+  4148,
+  784,
+  785,
+  787,
+  788,
+  789,
+  2219,
+  0,
+  0,
+  0,
+  790,
+  791,
+  0,
+  0,
+  798,
+  793,
+  794,
+  795,
+  4643,
+  0,
+  796,
+  797,
+  801,
+  0,
+  0,
+  0,
+  0,
+  861,
+  803,
+  804,
+  805,
+  806,
+  807,
+  812,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  808,
+  1914,
+  0,
+  2611,
+  0,
+  0,
+  810,
+  0,
+  0,
+  1432,
+  3708,
+  811,
+  1166,
+  0,
+  0,
+  0,
+  1769,
+  0,
+  0,
+  0,
+  0,
+  0,
+  814,
+  841,
+  815,
+  817,
+  818,
+  819,
+  820,
+  0,
+  4659,
+  823,
+  822,
+  821,
+  4098,
+  825,
+  0,
+  0,
+  824,
+  834,
+  833,
+  827,
+  0,
+  0,
+  0,
+  0,
+  2482,
+  0,
+  3996,
+  0,
+  3381,
+  828,
+  829,
+  830,
+  831,
+  832,
+  836,
+  837,
+  838,
+  839,
+  840,
+  843,
+  845,
+  846,
+  847,
+  848,
+  0,
+  1583,
+  4046,
+  849,
+  853,
+  0,
+  0,
+  0,
+  0,
+  854,
+  4005,
+  851,
+  0,
+  4545,
+  0,
+  4593,
+  4394,
+  0,
+  0,
+  2882,
+  0,
+  0,
+  4672,
+  852,
+  856,
+  857,
+  858,
+  859,
+  860,
+  1124,
+  0,
+  0,
+  0,
+  2433,
+  2048,
+  0,
+  0,
+  0,
+  0,
+  3569,
+  0,
+  863,
+  864,
+  866,
+  867,
+  4516,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  869,
+  870,
+  872,
+  874,
+  876,
+  877,
+  878,
+  879,
+  880,
+  4396,
+  882,
+  1658,
+  0,
+  2361,
+  2656,
+  0,
+  0,
+  884,
+  0,
+  1410,
+  0,
+  0,
+  0,
+  4205,
+  916,
+  0,
+  915,
+  0,
+  918,
+  917,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  885,
+  887,
+  889,
+  890,
+  891,
+  892,
+  893,
+  2837,
+  0,
+  4562,
+  0,
+  1926,
+  0,
+  895,
+  0,
+  3048,
+  0,
+  2627,
+  0,
+  3696,
+  0,
+  3645,
+  896,
+  897,
+  898,
+  899,
+  900,
+  902,
+  903,
+  904,
+  905,
+  1292,
+  1638,
+  1952,
+  910,
+  911,
+  908,
+  909,
+  914,
+  0,
+  912,
+  913,
+  906,
+  907,
+  0,
+  0,
+  947,
+  0,
+  0,
+  948,
+  920,
+  921,
+  922,
+  923,
+  924,
+  926,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2229,
+  927,
+  929,
+  930,
+  931,
+  932,
+  933,
+  935,
+  936,
+  939,
+  0,
+  0,
+  0,
+  0,
+  938,
+  942,
+  943,
+  944,
+  2311,
+  0,
+  0,
+  0,
+  945,
+  946,
+  0,
+  0,
+  949,
+  952,
+  953,
+  955,
+  957,
+  959,
+  961,
+  966,
+  967,
+  968,
+  969,
+  963,
+  0,
+  964,
+  965,
+  976,
+  977,
+  0,
+  0,
+  1014,
+  0,
+  0,
+  1013,
+  971,
+  972,
+  973,
+  974,
+  975,
+  979,
+  2660,
+  980,
+  981,
+  982,
+  983,
+  4640,
+  984,
+  1126,
+  0,
+  0,
+  0,
+  986,
+  1472,
+  0,
+  987,
+  0,
+  4686,
+  988,
+  989,
+  990,
+  991,
+  992,
+  994,
+  995,
+  996,
+  997,
+  998,
+  1000,
+  1001,
+  1002,
+  1003,
+  0,
+  0,
+  0,
+  2368,
+  1005,
+  1004,
+  1007,
+  1009,
+  2233,
+  0,
+  0,
+  1011,
+  1012,
+  1018,
+  0,
+  0,
+  0,
+  1025,
+  1020,
+  1021,
+  1022,
+  1412,
+  1023,
+  0,
+  0,
+  2799,
+  4403,
+  1024,
+  1123,
+  0,
+  1119,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1027,
+  0,
+  1036,
+  2442,
+  1029,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1078,
+  1030,
+  0,
+  0,
+  3173,
+  1031,
+  1032,
+  1033,
+  1034,
+  1035,
+  1038,
+  1039,
+  1040,
+  1041,
+  1042,
+  1044,
+  1046,
+  0,
+  0,
+  0,
+  1094,
+  1048,
+  1049,
+  1051,
+  0,
+  0,
+  0,
+  0,
+  4049,
+  0,
+  0,
+  1184,
+  1052,
+  1053,
+  1054,
+  1055,
+  1056,
+  0,
+  3108,
+  1057,
+  1281,
+  1059,
+  1060,
+  1061,
+  1062,
+  1063,
+  1064,
+  1066,
+  1067,
+  1068,
+  1069,
+  1070,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1142,
+  1072,
+  3991,
+  0,
+  1987,
+  0,
+  0,
+  2577,
+  0,
+  2879,
+  0,
+  1074,
+  1709,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1075,
+  1077,
+  0,
+  1076,
+  1079,
+  1080,
+  1081,
+  1082,
+  1083,
+  0,
+  3836,
+  1084,
+  1478,
+  0,
+  0,
+  1086,
+  1095,
+  1087,
+  1088,
+  1089,
+  1090,
+  1091,
+  1093,
+  0,
+  0,
+  1109,
+  1096,
+  1097,
+  1098,
+  1099,
+  1100,
+  1102,
+  1104,
+  1105,
+  1106,
+  1107,
+  1108,
+  1111,
+  4603,
+  1112,
+  1113,
+  1114,
+  1115,
+  1116,
+  3852,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1118,
+  2021,
+  0,
+  0,
+  3625,
+  0,
+  0,
+  2625,
+  2303,
+  2658,
+  0,
+  2589,
+  2904,
+  0,
+  0,
+  1121,
+  1122,
+  0,
+  0,
+  0,
+  1207,
+  1125,
+  2923,
+  0,
+  3373,
+  0,
+  1127,
+  1128,
+  1129,
+  1130,
+  1131,
+  1132,
+  1134,
+  1135,
+  1137,
+  1138,
+  1139,
+  1484,
+  1140,
+  0,
+  0,
+  2785,
+  1143,
+  1141,
+  2440,
+  0,
+  1810,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1145,
+  1146,
+  1151,
+  0,
+  0,
+  0,
+  0,
+  1148,
+  1222,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1150,
+  2414,
+  0,
+  0,
+  3639,
+  0,
+  0,
+  2494,
+  0,
+  0,
+  1153,
+  1154,
+  1155,
+  1156,
+  1157,
+  1158,
+  1214,
+  3089,
+  0,
+  0,
+  0,
+  1160,
+  1161,
+  1162,
+  1163,
+  1164,
+  1165,
+  1204,
+  0,
+  0,
+  0,
+  1167,
+  1169,
+  0,
+  0,
+  0,
+  1183,
+  1171,
+  1172,
+  1173,
+  2506,
+  0,
+  0,
+  0,
+  1174,
+  1175,
+  1177,
+  0,
+  0,
+  0,
+  3127,
+  0,
+  0,
+  0,
+  1233,
+  0,
+  3545,
+  1178,
+  1179,
+  1180,
+  1181,
+  2768,
+  0,
+  1182,
+  0,
+  2776,
+  0,
+  0,
+  2818,
+  1185,
+  3803,
+  1186,
+  1187,
+  1188,
+  3874,
+  0,
+  1189,
+  1190,
+  1192,
+  1194,
+  1195,
+  1196,
+  1197,
+  3087,
+  3425,
+  2425,
+  2781,
+  2782,
+  2779,
+  2780,
+  2778,
+  0,
+  1201,
+  2777,
+  2769,
+  1198,
+  0,
+  0,
+  2823,
+  0,
+  0,
+  2820,
+  1200,
+  1203,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1223,
+  1206,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1227,
+  1209,
+  1210,
+  1211,
+  1212,
+  1213,
+  1216,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3668,
+  1217,
+  2275,
+  0,
+  4212,
+  0,
+  0,
+  1219,
+  0,
+  0,
+  0,
+  0,
+  1660,
+  1220,
+  1221,
+  4558,
+  4353,
+  0,
+  0,
+  0,
+  1225,
+  3785,
+  1885,
+  0,
+  0,
+  1520,
+  0,
+  0,
+  3067,
+  1226,
+  1229,
+  1701,
+  0,
+  0,
+  3309,
+  2997,
+  4002,
+  3661,
+  0,
+  0,
+  0,
+  4397,
+  0,
+  0,
+  4628,
+  1231,
+  1232,
+  1234,
+  1235,
+  1236,
+  1237,
+  1238,
+  1240,
+  1243,
+  1242,
+  3847,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4392,
+  0,
+  1247,
+  0,
+  1245,
+  1654,
+  0,
+  0,
+  2575,
+  1246,
+  1248,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1273,
+  1250,
+  4695,
+  0,
+  0,
+  1252,
+  1605,
+  1253,
+  4203,
+  2043,
+  2363,
+  0,
+  0,
+  3420,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3935,
+  1255,
+  4451,
+  0,
+  2077,
+  4228,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1256,
+  1258,
+  1259,
+  1260,
+  1261,
+  1262,
+  1274,
+  1264,
+  1265,
+  1266,
+  1267,
+  0,
+  0,
+  0,
+  4445,
+  1269,
+  1268,
+  2906,
+  0,
+  0,
+  1271,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1535,
+  0,
+  0,
+  0,
+  2783,
+  1272,
+  1276,
+  1277,
+  1278,
+  1279,
+  1280,
+  1282,
+  1283,
+  1284,
+  1285,
+  1286,
+  1288,
+  1290,
+  1291,
+  1293,
+  3557,
+  3556,
+  0,
+  3560,
+  1295,
+  3525,
+  0,
+  3524,
+  0,
+  3523,
+  3522,
+  1297,
+  1299,
+  3319,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1394,
+  1300,
+  1302,
+  3571,
+  0,
+  0,
+  0,
+  1304,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3624,
+  1306,
+  0,
+  0,
+  0,
+  1336,
+  1308,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3622,
+  3889,
+  0,
+  0,
+  2269,
+  0,
+  1622,
+  1309,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1335,
+  1311,
+  1312,
+  1314,
+  1316,
+  1318,
+  1319,
+  1321,
+  1322,
+  1323,
+  1324,
+  0,
+  0,
+  0,
+  2810,
+  1325,
+  1332,
+  1327,
+  1328,
+  1329,
+  1330,
+  1331,
+  1334,
+  1338,
+  1339,
+  1340,
+  1341,
+  1342,
+  1344,
+  3240,
+  0,
+  0,
+  4006,
+  0,
+  1346,
+  2690,
+  2940,
+  3138,
+  0,
+  4430,
+  0,
+  0,
+  0,
+  4251,
+  1347,
+  1348,
+  1349,
+  1350,
+  1354,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1351,
+  0,
+  1362,
+  1353,
+  1356,
+  1357,
+  1358,
+  1359,
+  0,
+  0,
+  0,
+  4489,
+  1361,
+  1360,
+  1365,
+  0,
+  0,
+  1364,
+  1367,
+  1369,
+  3349,
+  1370,
+  1371,
+  1372,
+  1373,
+  1374,
+  1376,
+  1379,
+  0,
+  0,
+  1378,
+  1425,
+  1381,
+  1383,
+  1384,
+  1385,
+  2029,
+  0,
+  1386,
+  1387,
+  2050,
+  2435,
+  1389,
+  1782,
+  2812,
+  3101,
+  3276,
+  2109,
+  3227,
+  4674,
+  0,
+  4133,
+  1436,
+  0,
+  0,
+  1437,
+  0,
+  1438,
+  0,
+  0,
+  0,
+  1390,
+  1392,
+  0,
+  0,
+  0,
+  0,
+  3712,
+  0,
+  0,
+  0,
+  0,
+  3478,
+  3827,
+  2821,
+  1439,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1393,
+  1395,
+  1397,
+  1398,
+  1399,
+  1400,
+  1401,
+  1403,
+  1404,
+  1405,
+  1406,
+  1407,
+  1409,
+  1411,
+  1414,
+  1413,
+  0,
+  0,
+  1423,
+  0,
+  1424,
+  1416,
+  1417,
+  1418,
+  1419,
+  1420,
+  2413,
+  1421,
+  1422,
+  1427,
+  1429,
+  1431,
+  1433,
+  1435,
+  1860,
+  1441,
+  0,
+  2179,
+  3151,
+  0,
+  3780,
+  0,
+  0,
+  4047,
+  2683,
+  4118,
+  0,
+  0,
+  0,
+  2207,
+  1442,
+  1444,
+  1445,
+  1446,
+  1447,
+  1509,
+  1448,
+  4611,
+  0,
+  0,
+  1765,
+  1450,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3775,
+  0,
+  3134,
+  1451,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1506,
+  1453,
+  1454,
+  1455,
+  2117,
+  0,
+  1456,
+  4549,
+  1502,
+  0,
+  0,
+  0,
+  1503,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1457,
+  1459,
+  1460,
+  1461,
+  1462,
+  1463,
+  1465,
+  1466,
+  1877,
+  4113,
+  4380,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1468,
+  1880,
+  1469,
+  3012,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1471,
+  1473,
+  1474,
+  1475,
+  1476,
+  1477,
+  1479,
+  1480,
+  1481,
+  1482,
+  1483,
+  1486,
+  1485,
+  1488,
+  1489,
+  1490,
+  2470,
+  0,
+  1767,
+  1491,
+  1492,
+  1494,
+  1495,
+  1496,
+  1497,
+  1498,
+  1500,
+  0,
+  0,
+  0,
+  1501,
+  1505,
+  1508,
+  1511,
+  1513,
+  1514,
+  1515,
+  1516,
+  1517,
+  1518,
+  0,
+  1519,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1522,
+  1521,
+  1524,
+  1525,
+  1526,
+  1527,
+  1528,
+  1530,
+  1531,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2637,
+  3193,
+  0,
+  0,
+  4091,
+  1891,
+  0,
+  0,
+  0,
+  0,
+  1533,
+  0,
+  0,
+  0,
+  0,
+  2184,
+  1534,
+  1536,
+  1538,
+  1540,
+  1541,
+  1543,
+  1544,
+  1545,
+  1546,
+  1547,
+  1548,
+  1550,
+  1551,
+  1552,
+  1553,
+  1554,
+  1556,
+  1557,
+  1580,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1579,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3060,
+  1559,
+  1561,
+  1562,
+  1563,
+  1564,
+  1565,
+  1566,
+  1568,
+  1570,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4513,
+  0,
+  0,
+  0,
+  0,
+  4529,
+  0,
+  0,
+  4527,
+  1572,
+  1573,
+  1575,
+  4401,
+  4142,
+  3854,
+  0,
+  3229,
+  2960,
+  0,
+  2287,
+  1943,
+  1613,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1577,
+  1722,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1578,
+  1582,
+  0,
+  0,
+  3268,
+  1584,
+  1586,
+  1587,
+  1588,
+  1589,
+  3081,
+  1590,
+  1592,
+  1636,
+  1594,
+  1595,
+  1597,
+  0,
+  0,
+  0,
+  0,
+  2613,
+  1598,
+  1600,
+  1601,
+  1602,
+  1603,
+  1604,
+  1606,
+  0,
+  0,
+  0,
+  1607,
+  1609,
+  4537,
+  0,
+  0,
+  2254,
+  0,
+  1611,
+  0,
+  0,
+  4428,
+  1612,
+  1614,
+  1616,
+  1897,
+  1617,
+  1618,
+  1619,
+  1620,
+  1621,
+  1623,
+  4530,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1625,
+  1984,
+  1626,
+  1628,
+  3280,
+  1630,
+  1631,
+  1632,
+  1633,
+  1634,
+  1635,
+  1637,
+  1650,
+  0,
+  0,
+  0,
+  1646,
+  1639,
+  0,
+  0,
+  0,
+  0,
+  1672,
+  1641,
+  1642,
+  1643,
+  1644,
+  0,
+  0,
+  0,
+  2937,
+  3683,
+  1645,
+  2324,
+  0,
+  1648,
+  0,
+  3576,
+  0,
+  0,
+  3058,
+  2816,
+  0,
+  4543,
+  1649,
+  1652,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3306,
+  1653,
+  1655,
+  1657,
+  0,
+  0,
+  0,
+  0,
+  1679,
+  1659,
+  3795,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1661,
+  1662,
+  1664,
+  0,
+  3635,
+  1666,
+  2248,
+  0,
+  0,
+  0,
+  1668,
+  0,
+  0,
+  3880,
+  3663,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1669,
+  1671,
+  1674,
+  1675,
+  1676,
+  1677,
+  1678,
+  3620,
+  0,
+  1681,
+  2621,
+  1682,
+  2245,
+  0,
+  2273,
+  0,
+  1684,
+  1685,
+  1687,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2633,
+  0,
+  0,
+  4243,
+  1688,
+  1690,
+  1691,
+  1692,
+  1693,
+  0,
+  2370,
+  1724,
+  1725,
+  0,
+  0,
+  0,
+  0,
+  1723,
+  0,
+  0,
+  0,
+  0,
+  1694,
+  1696,
+  1697,
+  1698,
+  1699,
+  1700,
+  1702,
+  1704,
+  1705,
+  1706,
+  1707,
+  2476,
+  0,
+  0,
+  3467,
+  2062,
+  1708,
+  1710,
+  1712,
+  1713,
+  1714,
+  1715,
+  1717,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1721,
+  0,
+  1716,
+  1719,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3558,
+  1720,
+  1728,
+  1729,
+  1730,
+  1731,
+  1733,
+  1734,
+  0,
+  1732,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1735,
+  1737,
+  0,
+  0,
+  0,
+  0,
+  2271,
+  3843,
+  0,
+  4471,
+  3684,
+  0,
+  4144,
+  1738,
+  1740,
+  1742,
+  1743,
+  1744,
+  1745,
+  1746,
+  1748,
+  1749,
+  1750,
+  1751,
+  1752,
+  1754,
+  1755,
+  1756,
+  1757,
+  1758,
+  1760,
+  1761,
+  1762,
+  2406,
+  0,
+  1763,
+  1764,
+  1766,
+  1851,
+  0,
+  0,
+  0,
+  1844,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1768,
+  1770,
+  1772,
+  1773,
+  1775,
+  1776,
+  1777,
+  1778,
+  2085,
+  0,
+  0,
+  3063,
+  1779,
+  1780,
+  0,
+  0,
+  1784,
+  0,
+  1781,
+  1783,
+  2190,
+  3056,
+  0,
+  0,
+  0,
+  1786,
+  0,
+  0,
+  4535,
+  0,
+  4638,
+  4426,
+  2962,
+  1787,
+  1831,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1789,
+  1791,
+  1792,
+  1793,
+  1794,
+  1795,
+  1796,
+  2014,
+  0,
+  2591,
+  2754,
+  2931,
+  3006,
+  2239,
+  3167,
+  1798,
+  4030,
+  3907,
+  1799,
+  1800,
+  1801,
+  1802,
+  1803,
+  1814,
+  1805,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1806,
+  1808,
+  0,
+  0,
+  0,
+  3672,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2159,
+  1809,
+  1811,
+  1813,
+  1816,
+  1817,
+  1818,
+  1819,
+  1820,
+  3653,
+  1822,
+  1824,
+  1825,
+  1826,
+  1827,
+  1828,
+  1830,
+  1833,
+  1834,
+  1835,
+  3105,
+  0,
+  0,
+  0,
+  1836,
+  1837,
+  1839,
+  1840,
+  1841,
+  1842,
+  1843,
+  1846,
+  1847,
+  1848,
+  2787,
+  0,
+  2149,
+  1849,
+  1850,
+  1861,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1887,
+  1863,
+  3714,
+  0,
+  1866,
+  1868,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1888,
+  2713,
+  0,
+  0,
+  0,
+  0,
+  1871,
+  0,
+  0,
+  4279,
+  1872,
+  1873,
+  1874,
+  1875,
+  1876,
+  1878,
+  1882,
+  0,
+  1881,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1896,
+  1884,
+  1886,
+  1890,
+  1892,
+  1895,
+  1898,
+  1899,
+  1900,
+  1901,
+  1902,
+  1904,
+  1936,
+  0,
+  0,
+  0,
+  1938,
+  0,
+  0,
+  0,
+  1906,
+  0,
+  1916,
+  1908,
+  0,
+  0,
+  0,
+  2801,
+  0,
+  0,
+  0,
+  3821,
+  0,
+  2893,
+  1909,
+  1910,
+  1911,
+  1912,
+  1919,
+  0,
+  1918,
+  0,
+  1913,
+  0,
+  0,
+  1937,
+  1917,
+  0,
+  0,
+  0,
+  1915,
+  1921,
+  1923,
+  1925,
+  1927,
+  1928,
+  1929,
+  1930,
+  1931,
+  1933,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1951,
+  1935,
+  1940,
+  1942,
+  1944,
+  3897,
+  2257,
+  0,
+  0,
+  2685,
+  0,
+  0,
+  0,
+  1946,
+  1947,
+  3840,
+  3567,
+  0,
+  2958,
+  0,
+  0,
+  0,
+  0,
+  1949,
+  3225,
+  1950,
+  1953,
+  1955,
+  1956,
+  1958,
+  1959,
+  1960,
+  1961,
+  2335,
+  2669,
+  2000,
+  2001,
+  1998,
+  1999,
+  1997,
+  0,
+  1995,
+  1996,
+  2008,
+  2009,
+  1964,
+  0,
+  1963,
+  0,
+  0,
+  1962,
+  1966,
+  1968,
+  1986,
+  0,
+  0,
+  0,
+  0,
+  1970,
+  1972,
+  1973,
+  1974,
+  2635,
+  0,
+  1975,
+  2299,
+  1978,
+  0,
+  0,
+  1976,
+  1977,
+  0,
+  0,
+  0,
+  0,
+  0,
+  1990,
+  1981,
+  1980,
+  1983,
+  1985,
+  1988,
+  0,
+  0,
+  0,
+  3394,
+  1989,
+  1992,
+  1994,
+  2003,
+  2005,
+  2007,
+  2011,
+  2013,
+  2015,
+  2016,
+  2017,
+  2018,
+  2020,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2019,
+  2022,
+  2024,
+  2025,
+  2026,
+  2027,
+  4061,
+  3801,
+  4344,
+  4343,
+  4342,
+  2028,
+  4338,
+  0,
+  4337,
+  4336,
+  4335,
+  4334,
+  0,
+  4379,
+  4378,
+  0,
+  0,
+  4371,
+  2032,
+  2031,
+  0,
+  2030,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2039,
+  2034,
+  2035,
+  2036,
+  2037,
+  2038,
+  4329,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2814,
+  0,
+  0,
+  0,
+  2041,
+  0,
+  0,
+  3079,
+  2042,
+  2044,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2087,
+  2365,
+  2046,
+  2047,
+  2049,
+  2097,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2051,
+  2053,
+  2054,
+  2055,
+  2056,
+  2057,
+  2059,
+  2061,
+  2064,
+  2066,
+  2067,
+  2069,
+  2071,
+  3878,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2073,
+  2074,
+  2076,
+  2089,
+  0,
+  2078,
+  2080,
+  2081,
+  2082,
+  2083,
+  2084,
+  2086,
+  2088,
+  2091,
+  2092,
+  2093,
+  2094,
+  0,
+  0,
+  0,
+  3400,
+  2095,
+  2096,
+  2099,
+  2100,
+  2101,
+  2102,
+  2103,
+  2105,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2222,
+  2107,
+  2108,
+  2110,
+  0,
+  2929,
+  2112,
+  2113,
+  2114,
+  2115,
+  2116,
+  2157,
+  2158,
+  0,
+  2161,
+  0,
+  0,
+  0,
+  2156,
+  0,
+  0,
+  0,
+  0,
+  2118,
+  3219,
+  0,
+  0,
+  2120,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2833,
+  2504,
+  2121,
+  2124,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2123,
+  2126,
+  2128,
+  2129,
+  2130,
+  3428,
+  3754,
+  0,
+  0,
+  2131,
+  2132,
+  2134,
+  2136,
+  2137,
+  2138,
+  2139,
+  2140,
+  3777,
+  2141,
+  2142,
+  2144,
+  2145,
+  2146,
+  2147,
+  2148,
+  2150,
+  2152,
+  2189,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2155,
+  0,
+  0,
+  0,
+  0,
+  2154,
+  2160,
+  2163,
+  2164,
+  2165,
+  2166,
+  2167,
+  0,
+  0,
+  0,
+  2170,
+  2169,
+  2172,
+  2173,
+  2174,
+  2175,
+  0,
+  4233,
+  4454,
+  3665,
+  3666,
+  0,
+  3664,
+  0,
+  0,
+  0,
+  3667,
+  0,
+  0,
+  0,
+  0,
+  2176,
+  2232,
+  0,
+  2178,
+  2180,
+  2182,
+  3136,
+  2183,
+  2185,
+  2187,
+  0,
+  0,
+  3185,
+  2188,
+  2191,
+  2193,
+  2202,
+  2201,
+  2204,
+  2203,
+  2197,
+  0,
+  2200,
+  2367,
+  2196,
+  2195,
+  0,
+  2238,
+  2237,
+  0,
+  0,
+  2236,
+  2199,
+  2206,
+  2208,
+  2210,
+  2211,
+  2212,
+  2213,
+  2214,
+  2216,
+  2218,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2235,
+  2221,
+  2220,
+  2224,
+  2225,
+  2226,
+  2227,
+  2228,
+  2230,
+  2231,
+  2234,
+  2240,
+  2241,
+  2242,
+  2871,
+  0,
+  2243,
+  2244,
+  2246,
+  2249,
+  2251,
+  0,
+  0,
+  0,
+  2256,
+  2253,
+  2255,
+  4135,
+  2258,
+  4372,
+  2762,
+  0,
+  0,
+  3000,
+  2260,
+  2261,
+  2262,
+  2263,
+  2264,
+  2265,
+  2267,
+  2268,
+  2270,
+  2272,
+  0,
+  0,
+  0,
+  0,
+  2286,
+  2274,
+  0,
+  2326,
+  2667,
+  2276,
+  2277,
+  2279,
+  2280,
+  2281,
+  2282,
+  2283,
+  2957,
+  0,
+  2956,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2948,
+  2285,
+  2288,
+  2290,
+  2292,
+  2294,
+  2295,
+  2296,
+  2297,
+  2298,
+  2300,
+  2302,
+  2304,
+  2306,
+  2307,
+  2308,
+  2309,
+  2310,
+  2312,
+  2313,
+  2315,
+  2317,
+  2318,
+  2319,
+  2320,
+  2321,
+  2322,
+  2323,
+  2325,
+  2328,
+  2329,
+  2330,
+  2331,
+  0,
+  0,
+  0,
+  3651,
+  3273,
+  2332,
+  2334,
+  0,
+  0,
+  0,
+  2930,
+  2336,
+  2338,
+  2340,
+  2342,
+  3502,
+  2343,
+  2344,
+  2345,
+  2346,
+  2347,
+  2349,
+  2731,
+  2351,
+  2352,
+  2354,
+  2355,
+  2356,
+  2357,
+  3408,
+  3730,
+  2358,
+  4346,
+  0,
+  0,
+  0,
+  2360,
+  2362,
+  2364,
+  2366,
+  2369,
+  2373,
+  0,
+  0,
+  2372,
+  2371,
+  2376,
+  0,
+  0,
+  0,
+  2375,
+  3704,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2378,
+  2379,
+  2381,
+  2382,
+  2383,
+  2384,
+  2385,
+  2387,
+  2389,
+  2390,
+  2391,
+  2392,
+  2393,
+  2395,
+  2396,
+  2397,
+  2398,
+  2399,
+  2400,
+  2402,
+  2404,
+  2405,
+  2407,
+  2408,
+  0,
+  2411,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2412,
+  2410,
+  2415,
+  2416,
+  2417,
+  2418,
+  2419,
+  2480,
+  2421,
+  0,
+  3065,
+  2422,
+  2424,
+  2426,
+  2428,
+  2429,
+  2430,
+  3054,
+  0,
+  2431,
+  3432,
+  2432,
+  0,
+  0,
+  0,
+  3753,
+  2434,
+  2436,
+  2438,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4503,
+  2439,
+  2441,
+  2443,
+  2444,
+  2445,
+  2446,
+  2447,
+  2448,
+  2450,
+  2451,
+  2453,
+  2454,
+  2455,
+  3750,
+  0,
+  0,
+  0,
+  2456,
+  3919,
+  0,
+  0,
+  2457,
+  2459,
+  2460,
+  2461,
+  2462,
+  2463,
+  2465,
+  2466,
+  2467,
+  2468,
+  2469,
+  2473,
+  0,
+  0,
+  0,
+  0,
+  2472,
+  2471,
+  0,
+  0,
+  0,
+  3832,
+  2475,
+  2477,
+  2481,
+  2479,
+  2483,
+  2484,
+  2485,
+  2486,
+  2487,
+  2489,
+  2490,
+  2491,
+  2492,
+  2493,
+  2495,
+  2496,
+  2497,
+  2498,
+  2499,
+  2551,
+  2501,
+  2508,
+  0,
+  0,
+  2503,
+  2541,
+  0,
+  0,
+  0,
+  0,
+  2505,
+  4102,
+  2507,
+  2510,
+  2511,
+  2512,
+  2513,
+  2514,
+  2516,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2564,
+  2518,
+  2520,
+  2522,
+  2523,
+  2524,
+  2525,
+  2827,
+  0,
+  0,
+  3797,
+  2526,
+  2527,
+  3942,
+  4265,
+  4298,
+  0,
+  2529,
+  0,
+  0,
+  0,
+  3359,
+  2530,
+  2531,
+  2532,
+  2533,
+  2534,
+  2536,
+  2537,
+  2538,
+  2539,
+  2540,
+  2543,
+  2544,
+  2546,
+  2547,
+  2548,
+  2549,
+  2550,
+  2553,
+  2567,
+  2917,
+  0,
+  2704,
+  0,
+  0,
+  0,
+  3584,
+  2554,
+  2555,
+  2556,
+  2557,
+  2562,
+  2561,
+  0,
+  2563,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2558,
+  2560,
+  2566,
+  2568,
+  2569,
+  2570,
+  2571,
+  2573,
+  0,
+  0,
+  2574,
+  0,
+  0,
+  0,
+  2572,
+  2610,
+  0,
+  0,
+  0,
+  0,
+  2576,
+  2578,
+  2579,
+  2581,
+  2583,
+  3744,
+  2584,
+  2585,
+  2586,
+  2587,
+  2588,
+  2590,
+  2592,
+  2593,
+  2594,
+  2595,
+  4059,
+  3125,
+  3459,
+  2596,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3767,
+  0,
+  0,
+  0,
+  0,
+  3719,
+  0,
+  0,
+  3718,
+  2598,
+  2600,
+  2602,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2615,
+  2603,
+  2604,
+  2605,
+  3296,
+  0,
+  2606,
+  2607,
+  2609,
+  2612,
+  2614,
+  2616,
+  2617,
+  2618,
+  2619,
+  2620,
+  2622,
+  2624,
+  2626,
+  2628,
+  2629,
+  2630,
+  2631,
+  2632,
+  2634,
+  2636,
+  0,
+  0,
+  0,
+  0,
+  2671,
+  2638,
+  2639,
+  2640,
+  2641,
+  2642,
+  2644,
+  2645,
+  2646,
+  2647,
+  2649,
+  2648,
+  2651,
+  2652,
+  2653,
+  3572,
+  0,
+  2964,
+  2654,
+  2655,
+  2657,
+  2659,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2687,
+  2661,
+  2662,
+  2663,
+  2664,
+  2665,
+  2666,
+  2668,
+  2674,
+  0,
+  2675,
+  0,
+  0,
+  2670,
+  2673,
+  2677,
+  2678,
+  2679,
+  2680,
+  2681,
+  2682,
+  2684,
+  2686,
+  2689,
+  2691,
+  2692,
+  2693,
+  2694,
+  2695,
+  0,
+  2703,
+  2698,
+  2699,
+  2700,
+  3961,
+  0,
+  0,
+  0,
+  2701,
+  2702,
+  0,
+  0,
+  2710,
+  2705,
+  2706,
+  2707,
+  2708,
+  2709,
+  2712,
+  2714,
+  2715,
+  2716,
+  2717,
+  2718,
+  3326,
+  2720,
+  2721,
+  2723,
+  2724,
+  2725,
+  2726,
+  2729,
+  2728,
+  0,
+  2730,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2727,
+  2732,
+  2734,
+  2735,
+  3799,
+  2737,
+  2739,
+  2740,
+  2741,
+  2742,
+  2743,
+  2744,
+  2746,
+  2747,
+  2748,
+  2749,
+  4180,
+  4425,
+  2750,
+  4654,
+  4415,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2752,
+  0,
+  0,
+  4287,
+  2753,
+  2755,
+  2756,
+  2757,
+  3355,
+  0,
+  2758,
+  2759,
+  0,
+  0,
+  2761,
+  2760,
+  2763,
+  2764,
+  2765,
+  2766,
+  2767,
+  2771,
+  2772,
+  2773,
+  4355,
+  2774,
+  2775,
+  2784,
+  2789,
+  0,
+  0,
+  2786,
+  2788,
+  3029,
+  2791,
+  2792,
+  2793,
+  2794,
+  2795,
+  4350,
+  2796,
+  0,
+  4347,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4345,
+  2798,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2826,
+  2807,
+  0,
+  0,
+  2800,
+  2802,
+  2803,
+  2804,
+  2805,
+  2806,
+  2809,
+  2811,
+  2813,
+  2815,
+  2819,
+  2817,
+  2822,
+  2825,
+  2828,
+  2829,
+  2832,
+  0,
+  0,
+  2831,
+  2834,
+  2836,
+  0,
+  0,
+  0,
+  0,
+  2843,
+  2838,
+  2839,
+  2840,
+  2841,
+  2842,
+  2845,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2846,
+  2848,
+  2849,
+  2850,
+  2851,
+  0,
+  3519,
+  3203,
+  2852,
+  0,
+  0,
+  0,
+  0,
+  2863,
+  2854,
+  2856,
+  2858,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2903,
+  2860,
+  2862,
+  2865,
+  2867,
+  2869,
+  3232,
+  2870,
+  2872,
+  2874,
+  2875,
+  2876,
+  2877,
+  2878,
+  2880,
+  2881,
+  2883,
+  0,
+  2884,
+  2886,
+  2887,
+  2888,
+  2889,
+  2890,
+  2899,
+  0,
+  0,
+  0,
+  2892,
+  2894,
+  2895,
+  2896,
+  2897,
+  2898,
+  2901,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4384,
+  2902,
+  2905,
+  2907,
+  2909,
+  2910,
+  2911,
+  2912,
+  2913,
+  2915,
+  2916,
+  2918,
+  2919,
+  2920,
+  2921,
+  2922,
+  2924,
+  2925,
+  2926,
+  2927,
+  2928,
+  2932,
+  2933,
+  2934,
+  2935,
+  0,
+  3601,
+  3899,
+  2968,
+  2969,
+  0,
+  0,
+  0,
+  2936,
+  2939,
+  0,
+  0,
+  2938,
+  2941,
+  2942,
+  2943,
+  2944,
+  2945,
+  2947,
+  2950,
+  2951,
+  2952,
+  2953,
+  3328,
+  2954,
+  2955,
+  2959,
+  3551,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  2961,
+  2963,
+  2965,
+  2967,
+  2971,
+  2972,
+  2973,
+  2974,
+  2975,
+  2977,
+  2978,
+  2979,
+  2980,
+  3302,
+  2991,
+  2992,
+  0,
+  0,
+  2994,
+  0,
+  2993,
+  0,
+  2981,
+  2983,
+  2984,
+  2985,
+  2986,
+  2987,
+  0,
+  2988,
+  2990,
+  2996,
+  0,
+  0,
+  0,
+  2999,
+  2998,
+  3001,
+  3002,
+  3003,
+  3004,
+  3005,
+  3007,
+  3008,
+  3009,
+  3331,
+  3010,
+  3980,
+  3674,
+  3020,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3011,
+  3014,
+  3015,
+  3016,
+  3017,
+  3018,
+  3019,
+  3022,
+  3024,
+  3025,
+  3026,
+  3973,
+  3733,
+  3337,
+  3027,
+  3028,
+  3030,
+  3031,
+  3032,
+  3033,
+  3034,
+  3035,
+  0,
+  3036,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3037,
+  3039,
+  3041,
+  3043,
+  3044,
+  3045,
+  3046,
+  3047,
+  3049,
+  3050,
+  3051,
+  3052,
+  3053,
+  3097,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3055,
+  3057,
+  3059,
+  3062,
+  3064,
+  3066,
+  3104,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3068,
+  3637,
+  4170,
+  3070,
+  3578,
+  3071,
+  3072,
+  3073,
+  3074,
+  3075,
+  3077,
+  3078,
+  3080,
+  3083,
+  3085,
+  3086,
+  3088,
+  3090,
+  3091,
+  3092,
+  3093,
+  4028,
+  3094,
+  3096,
+  3099,
+  3100,
+  3103,
+  0,
+  0,
+  3231,
+  0,
+  3102,
+  3107,
+  3106,
+  3109,
+  3110,
+  3112,
+  3113,
+  3114,
+  3115,
+  3116,
+  3118,
+  3119,
+  3120,
+  3121,
+  3122,
+  3124,
+  3295,
+  3126,
+  0,
+  0,
+  0,
+  3133,
+  3128,
+  3129,
+  3130,
+  3131,
+  3132,
+  3135,
+  3137,
+  3139,
+  3140,
+  3141,
+  3142,
+  3143,
+  0,
+  0,
+  0,
+  4457,
+  0,
+  4464,
+  0,
+  4456,
+  3145,
+  3146,
+  3147,
+  3148,
+  3150,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3149,
+  3159,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3152,
+  3154,
+  3155,
+  3156,
+  3157,
+  3158,
+  3161,
+  3162,
+  3164,
+  3166,
+  0,
+  0,
+  0,
+  0,
+  3224,
+  0,
+  0,
+  3221,
+  3168,
+  3169,
+  3170,
+  3787,
+  0,
+  3171,
+  3172,
+  3174,
+  3175,
+  3176,
+  3177,
+  3178,
+  3180,
+  3182,
+  3184,
+  3186,
+  3188,
+  3189,
+  3192,
+  3194,
+  3196,
+  3198,
+  3199,
+  3200,
+  3201,
+  3202,
+  3204,
+  3218,
+  0,
+  3206,
+  3208,
+  3209,
+  3210,
+  3211,
+  3212,
+  4505,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3214,
+  3215,
+  3217,
+  3220,
+  3223,
+  3226,
+  3265,
+  0,
+  0,
+  3228,
+  3230,
+  3233,
+  3235,
+  3236,
+  3237,
+  3238,
+  0,
+  3838,
+  3264,
+  0,
+  0,
+  0,
+  0,
+  3263,
+  3262,
+  0,
+  0,
+  0,
+  3239,
+  3241,
+  3242,
+  3243,
+  3244,
+  3245,
+  0,
+  3251,
+  3247,
+  3248,
+  3250,
+  3253,
+  3496,
+  3256,
+  3257,
+  3258,
+  3259,
+  3260,
+  3261,
+  3267,
+  3270,
+  3272,
+  3275,
+  3277,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3842,
+  3279,
+  3281,
+  3282,
+  3283,
+  3284,
+  3285,
+  3287,
+  3289,
+  3290,
+  3291,
+  3292,
+  3293,
+  3294,
+  3300,
+  3301,
+  0,
+  3304,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3297,
+  3321,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3299,
+  3303,
+  3305,
+  3308,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3307,
+  0,
+  0,
+  3311,
+  3310,
+  3313,
+  3314,
+  3315,
+  3316,
+  3318,
+  0,
+  0,
+  3317,
+  3320,
+  3323,
+  3325,
+  3327,
+  3329,
+  3330,
+  3333,
+  3332,
+  3335,
+  3334,
+  3336,
+  0,
+  3339,
+  0,
+  3341,
+  3340,
+  3371,
+  3379,
+  4692,
+  0,
+  0,
+  3380,
+  3338,
+  4468,
+  0,
+  0,
+  0,
+  3348,
+  0,
+  0,
+  0,
+  0,
+  3372,
+  3343,
+  3344,
+  3345,
+  3346,
+  3347,
+  3350,
+  3351,
+  3352,
+  3353,
+  3354,
+  3406,
+  3405,
+  0,
+  0,
+  0,
+  0,
+  3407,
+  0,
+  0,
+  0,
+  0,
+  3356,
+  3416,
+  3358,
+  0,
+  4528,
+  3360,
+  3361,
+  3362,
+  3363,
+  3397,
+  3398,
+  0,
+  0,
+  3399,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3364,
+  3366,
+  3367,
+  3368,
+  3369,
+  0,
+  3982,
+  4257,
+  3370,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3396,
+  3374,
+  3375,
+  3376,
+  3377,
+  3378,
+  3382,
+  3383,
+  3384,
+  3385,
+  3386,
+  3388,
+  3389,
+  3391,
+  3393,
+  3395,
+  3401,
+  3403,
+  3404,
+  3422,
+  3409,
+  3411,
+  3412,
+  3413,
+  3414,
+  3415,
+  3418,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4661,
+  3419,
+  3421,
+  3424,
+  3426,
+  0,
+  0,
+  0,
+  0,
+  3427,
+  3429,
+  3430,
+  0,
+  0,
+  3431,
+  0,
+  3434,
+  0,
+  3441,
+  3433,
+  3436,
+  3437,
+  3438,
+  3439,
+  3481,
+  3440,
+  3443,
+  3445,
+  3446,
+  3447,
+  3448,
+  3449,
+  3452,
+  3453,
+  3454,
+  3455,
+  3456,
+  3458,
+  4004,
+  3460,
+  3462,
+  3463,
+  3464,
+  3465,
+  3466,
+  3468,
+  0,
+  0,
+  3469,
+  3489,
+  3471,
+  3473,
+  3474,
+  3475,
+  4588,
+  0,
+  0,
+  0,
+  3476,
+  3480,
+  0,
+  0,
+  3477,
+  3479,
+  3486,
+  0,
+  0,
+  0,
+  0,
+  3483,
+  3485,
+  3488,
+  3491,
+  3493,
+  3495,
+  3497,
+  3498,
+  3499,
+  3500,
+  3501,
+  3503,
+  3504,
+  3505,
+  3506,
+  3507,
+  3510,
+  0,
+  0,
+  0,
+  3509,
+  3512,
+  4579,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4551,
+  4291,
+  3513,
+  3514,
+  3515,
+  3516,
+  3518,
+  3517,
+  3520,
+  0,
+  0,
+  0,
+  3521,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3541,
+  3527,
+  3529,
+  3530,
+  3531,
+  3532,
+  3533,
+  3535,
+  3536,
+  3537,
+  4109,
+  0,
+  3538,
+  3834,
+  3539,
+  0,
+  0,
+  0,
+  3540,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3555,
+  3543,
+  3544,
+  3546,
+  3547,
+  3548,
+  3549,
+  3550,
+  3553,
+  3554,
+  3559,
+  3562,
+  3563,
+  3564,
+  3565,
+  3566,
+  3568,
+  3570,
+  3630,
+  3629,
+  0,
+  0,
+  0,
+  0,
+  3632,
+  0,
+  0,
+  0,
+  0,
+  3573,
+  3575,
+  3577,
+  3579,
+  3580,
+  3581,
+  3582,
+  3583,
+  3585,
+  3586,
+  3587,
+  3588,
+  3599,
+  3600,
+  0,
+  0,
+  3589,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3638,
+  3591,
+  3592,
+  3594,
+  3595,
+  3596,
+  3597,
+  3598,
+  3636,
+  0,
+  0,
+  3633,
+  3634,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3602,
+  3604,
+  3606,
+  3607,
+  3608,
+  3609,
+  3610,
+  3612,
+  3613,
+  3615,
+  3616,
+  3617,
+  3618,
+  3619,
+  3621,
+  3623,
+  3626,
+  3631,
+  0,
+  0,
+  0,
+  3628,
+  3640,
+  3641,
+  3642,
+  3643,
+  3682,
+  3644,
+  3646,
+  3647,
+  3648,
+  3649,
+  3650,
+  3654,
+  0,
+  0,
+  3652,
+  3656,
+  3658,
+  3660,
+  3662,
+  3669,
+  3671,
+  3673,
+  3675,
+  3677,
+  3678,
+  3679,
+  3680,
+  3681,
+  3685,
+  3688,
+  3689,
+  3690,
+  3691,
+  0,
+  4263,
+  3692,
+  3694,
+  3695,
+  3697,
+  3698,
+  3699,
+  3700,
+  3701,
+  3703,
+  3705,
+  4515,
+  3707,
+  0,
+  0,
+  4514,
+  0,
+  4512,
+  0,
+  4524,
+  3709,
+  3711,
+  3713,
+  3716,
+  3717,
+  3721,
+  3723,
+  3725,
+  3726,
+  3727,
+  3728,
+  3729,
+  3732,
+  3734,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3764,
+  3736,
+  3737,
+  3738,
+  3739,
+  3740,
+  3742,
+  0,
+  0,
+  0,
+  0,
+  4510,
+  4304,
+  4285,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4539,
+  3743,
+  3745,
+  3746,
+  3747,
+  3748,
+  3749,
+  3751,
+  3752,
+  3756,
+  3755,
+  3758,
+  3759,
+  3761,
+  3763,
+  3766,
+  3770,
+  3771,
+  3772,
+  3773,
+  3774,
+  3776,
+  3778,
+  0,
+  3779,
+  3781,
+  3783,
+  3784,
+  3786,
+  3794,
+  3793,
+  3792,
+  0,
+  0,
+  0,
+  0,
+  3788,
+  3800,
+  0,
+  3833,
+  3790,
+  3791,
+  3796,
+  3798,
+  3802,
+  0,
+  0,
+  0,
+  0,
+  3809,
+  3804,
+  3805,
+  3806,
+  3807,
+  3808,
+  3811,
+  3812,
+  3813,
+  3814,
+  3815,
+  3817,
+  3818,
+  3820,
+  3822,
+  3823,
+  3824,
+  3825,
+  3826,
+  3828,
+  0,
+  0,
+  3829,
+  3831,
+  3835,
+  3837,
+  3856,
+  0,
+  0,
+  0,
+  3853,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3839,
+  3857,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3841,
+  3858,
+  0,
+  0,
+  0,
+  3844,
+  3882,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3846,
+  3848,
+  3850,
+  3851,
+  3855,
+  3860,
+  3861,
+  3862,
+  4382,
+  0,
+  3863,
+  3864,
+  3866,
+  3867,
+  3869,
+  3870,
+  3871,
+  3872,
+  3873,
+  3875,
+  3877,
+  3879,
+  3881,
+  3884,
+  3886,
+  3888,
+  0,
+  0,
+  0,
+  3937,
+  3890,
+  3892,
+  0,
+  0,
+  3913,
+  3938,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3894,
+  3896,
+  3898,
+  3900,
+  3902,
+  3903,
+  3904,
+  3905,
+  3906,
+  3908,
+  3909,
+  3910,
+  3911,
+  0,
+  4443,
+  4215,
+  3933,
+  3934,
+  0,
+  0,
+  0,
+  0,
+  3932,
+  0,
+  0,
+  0,
+  0,
+  3912,
+  3915,
+  3916,
+  3918,
+  3921,
+  3922,
+  3923,
+  3924,
+  0,
+  4438,
+  3929,
+  3928,
+  0,
+  3927,
+  0,
+  3925,
+  3926,
+  0,
+  0,
+  0,
+  0,
+  3939,
+  3931,
+  3936,
+  3941,
+  3943,
+  3944,
+  3945,
+  3946,
+  3955,
+  3954,
+  0,
+  3947,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3959,
+  3949,
+  3950,
+  3951,
+  3952,
+  3953,
+  3960,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3958,
+  3957,
+  0,
+  0,
+  0,
+  3994,
+  3963,
+  3962,
+  3965,
+  3967,
+  3968,
+  3969,
+  3970,
+  3971,
+  3972,
+  4262,
+  4229,
+  4019,
+  4018,
+  4017,
+  0,
+  4016,
+  0,
+  4014,
+  4013,
+  3979,
+  3978,
+  3977,
+  0,
+  0,
+  3974,
+  3976,
+  4015,
+  4027,
+  0,
+  0,
+  0,
+  4012,
+  0,
+  0,
+  0,
+  0,
+  3981,
+  3984,
+  0,
+  0,
+  0,
+  3983,
+  0,
+  0,
+  0,
+  0,
+  0,
+  3995,
+  3986,
+  3987,
+  3988,
+  3989,
+  3990,
+  3992,
+  3993,
+  3997,
+  3998,
+  3999,
+  4000,
+  4001,
+  4201,
+  0,
+  0,
+  4003,
+  4007,
+  4008,
+  4009,
+  4010,
+  4011,
+  4076,
+  0,
+  4021,
+  4022,
+  4023,
+  4024,
+  4025,
+  4026,
+  4029,
+  4037,
+  4031,
+  4032,
+  4033,
+  4034,
+  0,
+  4547,
+  4039,
+  4038,
+  4041,
+  4040,
+  4035,
+  0,
+  0,
+  4036,
+  4045,
+  4044,
+  4071,
+  4043,
+  4048,
+  4050,
+  4051,
+  4052,
+  4053,
+  4054,
+  4055,
+  4057,
+  4058,
+  4060,
+  4082,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4062,
+  4068,
+  4067,
+  0,
+  0,
+  4069,
+  0,
+  4070,
+  0,
+  4064,
+  4066,
+  4073,
+  4075,
+  4077,
+  4078,
+  4079,
+  4080,
+  4081,
+  4084,
+  4085,
+  4086,
+  4087,
+  4088,
+  4090,
+  4092,
+  4094,
+  4097,
+  0,
+  4096,
+  0,
+  0,
+  4101,
+  4571,
+  4572,
+  4573,
+  4574,
+  4100,
+  0,
+  4577,
+  4578,
+  4560,
+  4561,
+  4609,
+  0,
+  4610,
+  0,
+  0,
+  4613,
+  4104,
+  4105,
+  4106,
+  4107,
+  4108,
+  4110,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4126,
+  4112,
+  4114,
+  4116,
+  4117,
+  4119,
+  4121,
+  4123,
+  4125,
+  4128,
+  4129,
+  4130,
+  4131,
+  4132,
+  4134,
+  4137,
+  4138,
+  4139,
+  4140,
+  4141,
+  4143,
+  0,
+  0,
+  0,
+  4202,
+  4145,
+  4189,
+  0,
+  0,
+  4147,
+  4149,
+  0,
+  0,
+  4156,
+  4151,
+  4152,
+  4153,
+  4154,
+  4155,
+  4158,
+  4159,
+  4160,
+  4161,
+  4163,
+  4162,
+  4165,
+  4166,
+  4167,
+  4168,
+  4169,
+  4171,
+  4172,
+  4173,
+  4174,
+  4175,
+  4177,
+  4179,
+  4182,
+  4181,
+  4184,
+  4185,
+  4186,
+  4187,
+  4188,
+  4190,
+  4192,
+  4193,
+  4194,
+  4195,
+  4196,
+  4199,
+  4200,
+  4204,
+  4206,
+  4209,
+  4223,
+  4213,
+  4214,
+  4216,
+  4218,
+  4219,
+  4220,
+  4221,
+  4222,
+  4224,
+  4225,
+  4226,
+  4227,
+  4232,
+  0,
+  0,
+  4231,
+  4235,
+  0,
+  0,
+  0,
+  4234,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4261,
+  4237,
+  4238,
+  4240,
+  4242,
+  4244,
+  4246,
+  4247,
+  4248,
+  4249,
+  4250,
+  4252,
+  4253,
+  4254,
+  4255,
+  4256,
+  4258,
+  4260,
+  4264,
+  4266,
+  4267,
+  4268,
+  4269,
+  4277,
+  0,
+  0,
+  4270,
+  0,
+  0,
+  0,
+  4278,
+  4272,
+  4273,
+  4274,
+  4275,
+  4276,
+  4280,
+  4281,
+  4282,
+  4283,
+  4284,
+  4286,
+  4288,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4316,
+  4290,
+  4292,
+  4293,
+  4294,
+  4295,
+  4296,
+  4297,
+  4299,
+  4300,
+  4301,
+  4302,
+  4303,
+  4305,
+  4307,
+  4309,
+  4312,
+  4311,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4315,
+  4314,
+  4318,
+  4320,
+  4322,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4360,
+  4324,
+  4325,
+  4326,
+  4327,
+  4328,
+  4330,
+  4331,
+  4333,
+  4340,
+  4341,
+  4349,
+  4352,
+  4354,
+  4356,
+  0,
+  0,
+  0,
+  0,
+  4359,
+  4358,
+  4362,
+  4363,
+  4364,
+  4365,
+  4366,
+  4368,
+  4370,
+  4373,
+  4374,
+  4375,
+  4376,
+  4377,
+  4381,
+  4404,
+  4405,
+  0,
+  4406,
+  0,
+  4407,
+  4408,
+  0,
+  0,
+  0,
+  0,
+  4383,
+  4385,
+  4387,
+  4388,
+  4391,
+  4390,
+  4393,
+  4395,
+  4398,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4414,
+  4400,
+  4402,
+  4410,
+  4412,
+  4416,
+  4418,
+  4419,
+  4420,
+  4421,
+  4422,
+  4424,
+  4427,
+  0,
+  0,
+  0,
+  4449,
+  4450,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4429,
+  4431,
+  4432,
+  4433,
+  4434,
+  4435,
+  4467,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4437,
+  4439,
+  4441,
+  4442,
+  4444,
+  4446,
+  4448,
+  4452,
+  4453,
+  4455,
+  4459,
+  4460,
+  4461,
+  4462,
+  4463,
+  4466,
+  4470,
+  4472,
+  4474,
+  4476,
+  0,
+  0,
+  0,
+  4479,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4499,
+  4478,
+  4481,
+  4483,
+  4485,
+  4487,
+  4490,
+  0,
+  0,
+  4491,
+  4493,
+  4494,
+  4495,
+  4496,
+  4497,
+  4498,
+  4502,
+  0,
+  4501,
+  4504,
+  4506,
+  4508,
+  4509,
+  4511,
+  4517,
+  4519,
+  4520,
+  4521,
+  4522,
+  4523,
+  4526,
+  4531,
+  4533,
+  4534,
+  4536,
+  4538,
+  4540,
+  4542,
+  4544,
+  4546,
+  4548,
+  4550,
+  4552,
+  4553,
+  4554,
+  4555,
+  4557,
+  4556,
+  4559,
+  4563,
+  4564,
+  4565,
+  4566,
+  4567,
+  4570,
+  4569,
+  4576,
+  4580,
+  4581,
+  4582,
+  4583,
+  4584,
+  4585,
+  4587,
+  4589,
+  4590,
+  4592,
+  4594,
+  4596,
+  4598,
+  4599,
+  4600,
+  4601,
+  4602,
+  4604,
+  4605,
+  4606,
+  4607,
+  4608,
+  4612,
+  4615,
+  4617,
+  4619,
+  4620,
+  4621,
+  4622,
+  4623,
+  4625,
+  4627,
+  4629,
+  4630,
+  4632,
+  4637,
+  0,
+  0,
+  0,
+  4634,
+  4636,
+  4639,
+  4642,
+  4645,
+  4644,
+  0,
+  0,
+  0,
+  0,
+  4646,
+  0,
+  0,
+  0,
+  0,
+  4694,
+  4648,
+  4649,
+  4650,
+  4651,
+  4652,
+  4653,
+  4655,
+  4657,
+  4658,
+  4660,
+  4662,
+  4671,
+  0,
+  0,
+  4664,
+  4666,
+  4667,
+  4668,
+  4669,
+  4670,
+  4673,
+  4676,
+  0,
+  4675,
+  4678,
+  4680,
+  4681,
+  4682,
+  4683,
+  4684,
+  4687,
+  4688,
+  4689,
+  4690,
+  4691,
+  4696,
+  0,
+  0,
+  0,
+  0,
+  0,
+  0,
+  4697,
+};
+
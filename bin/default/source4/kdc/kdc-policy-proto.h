@@ -0,0 +1,22 @@
+#ifndef __DEFAULT_SOURCE4_KDC_KDC_POLICY_PROTO_H__
+#define __DEFAULT_SOURCE4_KDC_KDC_POLICY_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/kdc/policy.c  */
+
+void kdc_get_policy(struct loadparm_context *lp_ctx, 
+		    struct smb_krb5_context *smb_krb5_context, 
+		    struct lsa_DomainInfoKerberos *k);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_KDC_KDC_POLICY_PROTO_H__ */
+
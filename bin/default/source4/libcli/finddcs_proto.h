@@ -0,0 +1,51 @@
+#ifndef __DEFAULT_SOURCE4_LIBCLI_FINDDCS_PROTO_H__
+#define __DEFAULT_SOURCE4_LIBCLI_FINDDCS_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/libcli/finddcs_nbt.c  */
+
+struct tevent_req *finddcs_nbt_send(TALLOC_CTX *mem_ctx,
+				const char *my_netbios_name,
+				uint16_t nbt_port,
+				const char *domain_name,
+				int name_type,
+				struct dom_sid *domain_sid,
+				struct resolve_context *resolve_ctx,
+				struct tevent_context *event_ctx,
+				struct imessaging_context *msg_ctx);
+NTSTATUS finddcs_nbt_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx,
+		      int *num_dcs, struct nbt_dc_name **dcs);
+NTSTATUS finddcs_nbt(TALLOC_CTX *mem_ctx,
+		 const char *my_netbios_name,
+		 uint16_t nbt_port,
+		 const char *domain_name, int name_type,
+		 struct dom_sid *domain_sid,
+		 struct resolve_context *resolve_ctx,
+		 struct tevent_context *event_ctx,
+		 struct imessaging_context *msg_ctx,
+		 int *num_dcs, struct nbt_dc_name **dcs);
+
+/* The following definitions come from ../source4/libcli/finddcs_cldap.c  */
+
+struct tevent_req *finddcs_cldap_send(TALLOC_CTX *mem_ctx,
+				      struct finddcs *io,
+				      struct resolve_context *resolve_ctx,
+				      struct tevent_context *event_ctx);
+NTSTATUS finddcs_cldap_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx, struct finddcs *io);
+NTSTATUS finddcs_cldap(TALLOC_CTX *mem_ctx,
+		       struct finddcs *io,
+		       struct resolve_context *resolve_ctx,
+		       struct tevent_context *event_ctx);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_LIBCLI_FINDDCS_PROTO_H__ */
+
@@ -0,0 +1,83 @@
+#ifndef __DEFAULT_SOURCE4_LIBCLI_WREPL_WINSREPL_PROTO_H__
+#define __DEFAULT_SOURCE4_LIBCLI_WREPL_WINSREPL_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/libcli/wrepl/winsrepl.c  */
+
+bool wrepl_socket_is_connected(struct wrepl_socket *wrepl_sock);
+struct wrepl_socket *wrepl_socket_init(TALLOC_CTX *mem_ctx,
+				       struct tevent_context *event_ctx);
+NTSTATUS wrepl_socket_donate_stream(struct wrepl_socket *wrepl_socket,
+				    struct tstream_context **stream);
+NTSTATUS wrepl_socket_split_stream(struct wrepl_socket *wrepl_socket,
+				   TALLOC_CTX *mem_ctx,
+				   struct tstream_context **stream);
+const char *wrepl_best_ip(struct loadparm_context *lp_ctx, const char *peer_ip);
+struct tevent_req *wrepl_connect_send(TALLOC_CTX *mem_ctx,
+				      struct tevent_context *ev,
+				      struct wrepl_socket *wrepl_socket,
+				      const char *our_ip, const char *peer_ip);
+NTSTATUS wrepl_connect_recv(struct tevent_req *req);
+NTSTATUS wrepl_connect(struct wrepl_socket *wrepl_socket,
+		       const char *our_ip, const char *peer_ip);
+struct tevent_req *wrepl_request_send(TALLOC_CTX *mem_ctx,
+				      struct tevent_context *ev,
+				      struct wrepl_socket *wrepl_socket,
+				      const struct wrepl_packet *packet,
+				      const struct wrepl_send_ctrl *ctrl);
+NTSTATUS wrepl_request_recv(struct tevent_req *req,
+			    TALLOC_CTX *mem_ctx,
+			    struct wrepl_packet **packet);
+NTSTATUS wrepl_request(struct wrepl_socket *wrepl_socket,
+		       TALLOC_CTX *mem_ctx,
+		       const struct wrepl_packet *req_packet,
+		       struct wrepl_packet **reply_packet);
+struct tevent_req *wrepl_associate_send(TALLOC_CTX *mem_ctx,
+					struct tevent_context *ev,
+					struct wrepl_socket *wrepl_socket,
+					const struct wrepl_associate *io);
+NTSTATUS wrepl_associate_recv(struct tevent_req *req,
+			      struct wrepl_associate *io);
+NTSTATUS wrepl_associate(struct wrepl_socket *wrepl_socket,
+			 struct wrepl_associate *io);
+struct tevent_req *wrepl_associate_stop_send(TALLOC_CTX *mem_ctx,
+					     struct tevent_context *ev,
+					     struct wrepl_socket *wrepl_socket,
+					     const struct wrepl_associate_stop *io);
+NTSTATUS wrepl_associate_stop_recv(struct tevent_req *req,
+				   struct wrepl_associate_stop *io);
+NTSTATUS wrepl_associate_stop(struct wrepl_socket *wrepl_socket,
+			      struct wrepl_associate_stop *io);
+struct tevent_req *wrepl_pull_table_send(TALLOC_CTX *mem_ctx,
+					 struct tevent_context *ev,
+					 struct wrepl_socket *wrepl_socket,
+					 const struct wrepl_pull_table *io);
+NTSTATUS wrepl_pull_table_recv(struct tevent_req *req,
+			       TALLOC_CTX *mem_ctx,
+			       struct wrepl_pull_table *io);
+NTSTATUS wrepl_pull_table(struct wrepl_socket *wrepl_socket,
+			  TALLOC_CTX *mem_ctx,
+			  struct wrepl_pull_table *io);
+struct tevent_req *wrepl_pull_names_send(TALLOC_CTX *mem_ctx,
+					 struct tevent_context *ev,
+					 struct wrepl_socket *wrepl_socket,
+					 const struct wrepl_pull_names *io);
+NTSTATUS wrepl_pull_names_recv(struct tevent_req *req,
+			       TALLOC_CTX *mem_ctx,
+			       struct wrepl_pull_names *io);
+NTSTATUS wrepl_pull_names(struct wrepl_socket *wrepl_socket,
+			  TALLOC_CTX *mem_ctx,
+			  struct wrepl_pull_names *io);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_LIBCLI_WREPL_WINSREPL_PROTO_H__ */
+
@@ -0,0 +1,33 @@
+#ifndef __DEFAULT_SOURCE4_NTVFS_CIFS_POSIX_CLI_PROTO_H__
+#define __DEFAULT_SOURCE4_NTVFS_CIFS_POSIX_CLI_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/ntvfs/cifs_posix_cli/vfs_cifs_posix.c  */
+
+NTSTATUS ntvfs_cifs_posix_init(void);
+
+/* The following definitions come from ../source4/ntvfs/cifs_posix_cli/svfs_util.c  */
+
+char *cifspsx_unix_path(struct ntvfs_module_context *ntvfs,
+		     struct ntvfs_request *req, const char *name);
+struct cifspsx_dir *cifspsx_list_unix(TALLOC_CTX *mem_ctx, struct ntvfs_request *req, const char *unix_path);
+struct cifspsx_dir *cifspsx_list(struct ntvfs_module_context *ntvfs, struct ntvfs_request *req, const char *pattern);
+
+/*******************************************************************
+set the time on a file via file descriptor
+*******************************************************************/
+int cifspsx_file_utime(int fd, struct utimbuf *times);
+uint16_t cifspsx_unix_to_dos_attrib(mode_t mode);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_NTVFS_CIFS_POSIX_CLI_PROTO_H__ */
+
@@ -0,0 +1,63 @@
+#ifndef __DEFAULT_SOURCE4_NTVFS_POSIX_VFS_ACL_PROTO_H__
+#define __DEFAULT_SOURCE4_NTVFS_POSIX_VFS_ACL_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/ntvfs/posix/pvfs_acl.c  */
+
+NTSTATUS pvfs_acl_register(const struct pvfs_acl_ops *ops);
+const struct pvfs_acl_ops *pvfs_acl_backend_byname(const char *name);
+NTSTATUS pvfs_acl_init(void);
+NTSTATUS pvfs_acl_set(struct pvfs_state *pvfs, 
+		      struct ntvfs_request *req,
+		      struct pvfs_filename *name, int fd, 
+		      uint32_t access_mask,
+		      union smb_setfileinfo *info);
+NTSTATUS pvfs_acl_query(struct pvfs_state *pvfs, 
+			struct ntvfs_request *req,
+			struct pvfs_filename *name, int fd, 
+			union smb_fileinfo *info);
+NTSTATUS pvfs_access_check(struct pvfs_state *pvfs, 
+			   struct ntvfs_request *req,
+			   struct pvfs_filename *name,
+			   uint32_t *access_mask);
+NTSTATUS pvfs_access_check_simple(struct pvfs_state *pvfs, 
+				  struct ntvfs_request *req,
+				  struct pvfs_filename *name,
+				  uint32_t access_needed);
+NTSTATUS pvfs_access_check_create(struct pvfs_state *pvfs, 
+				  struct ntvfs_request *req,
+				  struct pvfs_filename *name,
+				  uint32_t *access_mask,
+				  bool container,
+				  struct security_descriptor **sd);
+NTSTATUS pvfs_access_check_parent(struct pvfs_state *pvfs, 
+				  struct ntvfs_request *req,
+				  struct pvfs_filename *name,
+				  uint32_t access_mask);
+NTSTATUS pvfs_acl_inherited_sd(struct pvfs_state *pvfs, 
+			       TALLOC_CTX *mem_ctx,
+			       struct ntvfs_request *req,
+			       struct pvfs_filename *parent,
+			       bool container,
+			       struct security_descriptor **ret_sd);
+NTSTATUS pvfs_acl_inherit(struct pvfs_state *pvfs, 
+			  struct ntvfs_request *req,
+			  struct pvfs_filename *name,
+			  int fd);
+NTSTATUS pvfs_access_maximal_allowed(struct pvfs_state *pvfs, 
+				     struct ntvfs_request *req,
+				     struct pvfs_filename *name,
+				     uint32_t *maximal_access);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_NTVFS_POSIX_VFS_ACL_PROTO_H__ */
+
@@ -0,0 +1,38 @@
+#ifndef __DEFAULT_SOURCE4_RPC_SERVER_DCERPC_SERVER_PROTO_H__
+#define __DEFAULT_SOURCE4_RPC_SERVER_DCERPC_SERVER_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/rpc_server/dcerpc_server.c  */
+
+NTSTATUS dcesrv_inherited_session_key(struct dcesrv_connection *p,
+				      DATA_BLOB *session_key);
+NTSTATUS dcesrv_process_ncacn_packet(struct dcesrv_connection *dce_conn,
+				     struct ncacn_packet *pkt,
+				     DATA_BLOB blob);
+const struct dcesrv_endpoint_server *dcesrv_ep_server_byname(const char *name);
+void dcerpc_server_init(struct loadparm_context *lp_ctx);
+const struct dcesrv_critical_sizes *dcerpc_module_version(void);
+NTSTATUS dcesrv_add_ep(struct dcesrv_context *dce_ctx,
+		       struct loadparm_context *lp_ctx,
+		       struct dcesrv_endpoint *e,
+		       struct tevent_context *event_ctx,
+		       const struct model_ops *model_ops);
+
+/* The following definitions come from ../source4/rpc_server/dcesrv_mgmt.c  */
+
+
+/* The following definitions come from ../source4/rpc_server/handles.c  */
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_RPC_SERVER_DCERPC_SERVER_PROTO_H__ */
+
@@ -0,0 +1,26 @@
+#ifndef __DEFAULT_SOURCE4_RPC_SERVER_SRVSVC_PROTO_H__
+#define __DEFAULT_SOURCE4_RPC_SERVER_SRVSVC_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/rpc_server/srvsvc/dcesrv_srvsvc.c  */
+
+
+/* The following definitions come from ../source4/rpc_server/srvsvc/srvsvc_ntvfs.c  */
+
+NTSTATUS srvsvc_create_ntvfs_context(struct dcesrv_call_state *dce_call,
+				     TALLOC_CTX *mem_ctx,
+				     const char *share,
+				     struct ntvfs_context **_ntvfs);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_RPC_SERVER_SRVSVC_PROTO_H__ */
+
@@ -0,0 +1,30 @@
+#ifndef __DEFAULT_SOURCE4_SMBD_PIDFILE_H__
+#define __DEFAULT_SOURCE4_SMBD_PIDFILE_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/smbd/pidfile.c  */
+
+
+/**
+ * return the pid in a pidfile. return 0 if the process (or pidfile)
+ * does not exist 
+ */
+pid_t pidfile_pid(const char *piddir, const char *name);
+
+/**
+ * create a pid file in the pid directory. open it and leave it locked 
+ */
+void pidfile_create(const char *piddir, const char *name);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_SMBD_PIDFILE_H__ */
+
@@ -0,0 +1,169 @@
+#ifndef __DEFAULT_SOURCE4_TORTURE_LOCAL_PROTO_H__
+#define __DEFAULT_SOURCE4_TORTURE_LOCAL_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../lib/util/charset/tests/iconv.c  */
+
+struct torture_suite *torture_local_iconv(TALLOC_CTX *mem_ctx);
+struct torture_suite *torture_local_iconv(TALLOC_CTX *mem_ctx) ;
+
+/* The following definitions come from ../lib/talloc/testsuite.c  */
+
+bool torture_local_talloc(struct torture_context *tctx);
+
+/* The following definitions come from ../source4/lib/messaging/tests/messaging.c  */
+
+struct torture_suite *torture_local_messaging(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/lib/messaging/tests/irpc.c  */
+
+struct torture_suite *torture_local_irpc(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/librpc/tests/binding_string.c  */
+
+struct torture_suite *torture_local_binding_string(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/idtree.c  */
+
+struct torture_suite *torture_local_idtree(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/dlinklist.c  */
+
+struct torture_suite *torture_local_dlinklist(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/lib/socket/testsuite.c  */
+
+
+/**
+  basic testing of udp routines
+*/
+struct torture_suite *torture_local_socket(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/libcli/resolve/testsuite.c  */
+
+struct torture_suite *torture_local_resolve(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/strlist.c  */
+
+struct torture_suite *torture_local_util_strlist(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/parmlist.c  */
+
+struct torture_suite *torture_local_util_parmlist(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/str.c  */
+
+struct torture_suite *torture_local_util_str(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/time.c  */
+
+struct torture_suite *torture_local_util_time(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/asn1_tests.c  */
+
+struct torture_suite *torture_local_util_asn1(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/data_blob.c  */
+
+struct torture_suite *torture_local_util_data_blob(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/file.c  */
+
+struct torture_suite *torture_local_util_file(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/genrand.c  */
+
+struct torture_suite *torture_local_genrand(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/compression/testsuite.c  */
+
+struct torture_suite *torture_local_compression(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/charset/tests/charset.c  */
+
+struct torture_suite *torture_local_charset(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/charset/tests/convert_string.c  */
+
+struct torture_suite *torture_local_convert_string_handle(TALLOC_CTX *mem_ctx);
+struct torture_suite *torture_local_string_case_handle(TALLOC_CTX *mem_ctx);
+struct torture_suite *torture_local_convert_string(TALLOC_CTX *mem_ctx);
+struct torture_suite *torture_local_string_case(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/libcli/security/tests/sddl.c  */
+
+struct torture_suite *torture_local_sddl(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/tdr/testsuite.c  */
+
+struct torture_suite *torture_local_tdr(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/tevent/testsuite.c  */
+
+struct torture_suite *torture_local_event(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/param/tests/share.c  */
+
+struct torture_suite *torture_local_share(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/param/tests/loadparm.c  */
+
+struct torture_suite *torture_local_loadparm(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../auth/credentials/tests/simple.c  */
+
+struct torture_suite *torture_local_credentials(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/torture/local/local.c  */
+
+NTSTATUS torture_local_init(void);
+
+/* The following definitions come from ../source4/torture/local/dbspeed.c  */
+
+struct torture_suite *torture_local_dbspeed(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/torture/local/torture.c  */
+
+struct torture_suite *torture_local_torture(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/torture/ldb/ldb.c  */
+
+struct torture_suite *torture_ldb(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/dsdb/common/tests/dsdb_dn.c  */
+
+struct torture_suite *torture_dsdb_dn(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../source4/dsdb/schema/tests/schema_syntax.c  */
+
+DATA_BLOB hexstr_to_data_blob(TALLOC_CTX *mem_ctx, const char *string) ;
+
+/**
+ * DSDB-SYNTAX test suite creation
+ */
+struct torture_suite *torture_dsdb_syntax(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/util/tests/anonymous_shared.c  */
+
+struct torture_suite *torture_local_util_anonymous_shared(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/nss_wrapper/testsuite.c  */
+
+struct torture_suite *torture_local_nss_wrapper(TALLOC_CTX *mem_ctx);
+
+/* The following definitions come from ../lib/socket_wrapper/testsuite.c  */
+
+struct torture_suite *torture_local_socket_wrapper(TALLOC_CTX *mem_ctx);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_TORTURE_LOCAL_PROTO_H__ */
+
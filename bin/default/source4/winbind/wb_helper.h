@@ -0,0 +1,48 @@
+#ifndef __DEFAULT_SOURCE4_WINBIND_WB_HELPER_H__
+#define __DEFAULT_SOURCE4_WINBIND_WB_HELPER_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/winbind/wb_async_helpers.c  */
+
+struct composite_context *wb_lsa_lookupsids_send(TALLOC_CTX *mem_ctx,
+						 struct dcerpc_pipe *lsa_pipe,
+						 struct policy_handle *handle,
+						 uint32_t num_sids,
+						 const struct dom_sid **sids);
+NTSTATUS wb_lsa_lookupsids_recv(struct composite_context *c,
+				TALLOC_CTX *mem_ctx,
+				struct wb_sid_object ***names);
+struct composite_context *wb_lsa_lookupnames_send(TALLOC_CTX *mem_ctx,
+						  struct dcerpc_pipe *lsa_pipe,
+						  struct policy_handle *handle,
+						  uint32_t num_names,
+						  const char **names);
+NTSTATUS wb_lsa_lookupnames_recv(struct composite_context *c,
+				 TALLOC_CTX *mem_ctx,
+				 struct wb_sid_object ***sids);
+struct composite_context *wb_samr_userdomgroups_send(TALLOC_CTX *mem_ctx,
+						     struct dcerpc_pipe *samr_pipe,
+						     struct policy_handle *domain_handle,
+						     uint32_t rid);
+NTSTATUS wb_samr_userdomgroups_recv(struct composite_context *ctx,
+				    TALLOC_CTX *mem_ctx,
+				    uint32_t *num_rids, uint32_t **rids);
+
+/* The following definitions come from ../source4/winbind/wb_utils.c  */
+
+bool wb_samba3_split_username(TALLOC_CTX *mem_ctx, struct loadparm_context *lp_ctx,
+			      const char *domuser,
+				 char **domain, char **user);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_WINBIND_WB_HELPER_H__ */
+
@@ -0,0 +1,398 @@
+#ifndef __DEFAULT_SOURCE4_WINBIND_WB_PROTO_H__
+#define __DEFAULT_SOURCE4_WINBIND_WB_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../source4/winbind/wb_server.c  */
+
+void wbsrv_terminate_connection(struct wbsrv_connection *wbconn, const char *reason);
+NTSTATUS server_service_winbind_init(void);
+
+/* The following definitions come from ../source4/winbind/wb_irpc.c  */
+
+NTSTATUS wbsrv_init_irpc(struct wbsrv_service *service);
+
+/* The following definitions come from ../source4/winbind/wb_samba3_protocol.c  */
+
+NTSTATUS wbsrv_samba3_packet_full_request(void *private_data, DATA_BLOB blob, size_t *size);
+NTSTATUS wbsrv_samba3_pull_request(struct wbsrv_samba3_call *call);
+NTSTATUS wbsrv_samba3_handle_call(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_send_reply(struct wbsrv_samba3_call *call);
+NTSTATUS wbsrv_samba3_process(struct wbsrv_samba3_call *call);
+
+/* The following definitions come from ../source4/winbind/wb_samba3_cmd.c  */
+
+NTSTATUS wbsrv_samba3_interface_version(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_info(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_domain_name(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_netbios_name(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_priv_pipe_dir(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_ping(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_domain_info(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_check_machacc(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getdcname(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_userdomgroups(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_usersids(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_lookupname(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_lookupsid(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_pam_logoff(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_pam_auth_crap(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_pam_auth(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_list_trustdom(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_list_groups(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_list_users(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getpwnam(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getpwuid(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_setpwent(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getpwent(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_endpwent(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getgrnam(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getgrgid(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getgroups(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_setgrent(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_getgrent(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_endgrent(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_sid2uid(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_sid2gid(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_uid2sid(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_gid2sid(struct wbsrv_samba3_call *s3call);
+NTSTATUS wbsrv_samba3_sids2xids(struct wbsrv_samba3_call *s3call);
+
+/* The following definitions come from ../source4/winbind/wb_init_domain.c  */
+
+struct composite_context *wb_init_domain_send(TALLOC_CTX *mem_ctx,
+					      struct wbsrv_service *service,
+					      struct wb_dom_info *dom_info);
+NTSTATUS wb_init_domain_recv(struct composite_context *c,
+			     TALLOC_CTX *mem_ctx,
+			     struct wbsrv_domain **result);
+NTSTATUS wb_init_domain(TALLOC_CTX *mem_ctx, struct wbsrv_service *service,
+			struct wb_dom_info *dom_info,
+			struct wbsrv_domain **result);
+
+/* The following definitions come from ../source4/winbind/wb_dom_info.c  */
+
+struct composite_context *wb_get_dom_info_send(TALLOC_CTX *mem_ctx,
+					       struct wbsrv_service *service,
+					       const char *domain_name,
+					       const char *dns_domain_name,
+					       const struct dom_sid *sid);
+NTSTATUS wb_get_dom_info_recv(struct composite_context *ctx,
+			      TALLOC_CTX *mem_ctx,
+			      struct wb_dom_info **result);
+NTSTATUS wb_get_dom_info(TALLOC_CTX *mem_ctx,
+			 struct wbsrv_service *service,
+			 const char *domain_name,
+			 const char *dns_domain_name,
+			 const struct dom_sid *sid,
+			 struct wb_dom_info **result);
+
+/* The following definitions come from ../source4/winbind/wb_dom_info_trusted.c  */
+
+struct composite_context *wb_trusted_dom_info_send(TALLOC_CTX *mem_ctx,
+						   struct wbsrv_service *service,
+						   const char *domain_name,
+						   const struct dom_sid *sid);
+NTSTATUS wb_trusted_dom_info_recv(struct composite_context *ctx,
+				  TALLOC_CTX *mem_ctx,
+				  struct wb_dom_info **result);
+NTSTATUS wb_trusted_dom_info(TALLOC_CTX *mem_ctx,
+			     struct wbsrv_service *service,
+			     const char *domain_name,
+			     const struct dom_sid *sid,
+			     struct wb_dom_info **result);
+
+/* The following definitions come from ../source4/winbind/wb_sid2domain.c  */
+
+struct composite_context *wb_sid2domain_send(TALLOC_CTX *mem_ctx,
+					     struct wbsrv_service *service,
+					     const struct dom_sid *sid);
+NTSTATUS wb_sid2domain_recv(struct composite_context *ctx,
+			    struct wbsrv_domain **result);
+NTSTATUS wb_sid2domain(TALLOC_CTX *mem_ctx, struct wbsrv_service *service,
+		       const struct dom_sid *sid,
+		       struct wbsrv_domain **result);
+
+/* The following definitions come from ../source4/winbind/wb_name2domain.c  */
+
+struct composite_context *wb_name2domain_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, const char* name);
+NTSTATUS wb_name2domain_recv(struct composite_context *ctx,
+		struct wbsrv_domain **result);
+
+/* The following definitions come from ../source4/winbind/wb_sids2xids.c  */
+
+struct composite_context *wb_sids2xids_send(TALLOC_CTX *mem_ctx,
+					    struct wbsrv_service *service,
+					    unsigned int count, struct id_map *ids);
+NTSTATUS wb_sids2xids_recv(struct composite_context *ctx,
+			   struct id_map **ids, unsigned *count);
+
+/* The following definitions come from ../source4/winbind/wb_xids2sids.c  */
+
+struct composite_context *wb_xids2sids_send(TALLOC_CTX *mem_ctx,
+					    struct wbsrv_service *service,
+					    unsigned int count, struct id_map *ids);
+NTSTATUS wb_xids2sids_recv(struct composite_context *ctx,
+			   struct id_map **ids);
+
+/* The following definitions come from ../source4/winbind/wb_gid2sid.c  */
+
+struct composite_context *wb_gid2sid_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, gid_t gid);
+NTSTATUS wb_gid2sid_recv(struct composite_context *ctx, TALLOC_CTX *mem_ctx,
+		struct dom_sid **sid);
+
+/* The following definitions come from ../source4/winbind/wb_sid2uid.c  */
+
+struct composite_context *wb_sid2uid_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, const struct dom_sid *sid);
+NTSTATUS wb_sid2uid_recv(struct composite_context *ctx, uid_t *uid);
+
+/* The following definitions come from ../source4/winbind/wb_sid2gid.c  */
+
+struct composite_context *wb_sid2gid_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, const struct dom_sid *sid);
+NTSTATUS wb_sid2gid_recv(struct composite_context *ctx, gid_t *gid);
+
+/* The following definitions come from ../source4/winbind/wb_uid2sid.c  */
+
+struct composite_context *wb_uid2sid_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, uid_t uid);
+NTSTATUS wb_uid2sid_recv(struct composite_context *ctx, TALLOC_CTX *mem_ctx,
+		struct dom_sid **sid);
+
+/* The following definitions come from ../source4/winbind/wb_connect_lsa.c  */
+
+struct composite_context *wb_init_lsa_send(TALLOC_CTX *mem_ctx,
+					   struct wbsrv_domain *domain);
+NTSTATUS wb_init_lsa_recv(struct composite_context *c,
+			  TALLOC_CTX *mem_ctx,
+			  struct dcerpc_pipe **lsa_pipe,
+			  struct policy_handle **lsa_policy);
+
+/* The following definitions come from ../source4/winbind/wb_connect_sam.c  */
+
+struct composite_context *wb_connect_samr_send(TALLOC_CTX *mem_ctx,
+					   struct wbsrv_domain *domain);
+NTSTATUS wb_connect_samr_recv(struct composite_context *c,
+			     TALLOC_CTX *mem_ctx,
+			     struct dcerpc_pipe **samr_pipe,
+			     struct policy_handle *connect_handle,
+			     struct policy_handle *domain_handle);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_lookupname.c  */
+
+struct composite_context *wb_cmd_lookupname_send(TALLOC_CTX *mem_ctx,
+						 struct wbsrv_service *service,
+						 const char *dom_name,
+						 const char *name);
+NTSTATUS wb_cmd_lookupname_recv(struct composite_context *c,
+				TALLOC_CTX *mem_ctx,
+				struct wb_sid_object **sid);
+NTSTATUS wb_cmd_lookupname(TALLOC_CTX *mem_ctx,
+			   struct wbsrv_service *service,
+			   const char *dom_name,
+			   const char *name,
+			   struct wb_sid_object **sid);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_lookupsid.c  */
+
+struct composite_context *wb_cmd_lookupsid_send(TALLOC_CTX *mem_ctx,
+						struct wbsrv_service *service,
+						const struct dom_sid *sid);
+NTSTATUS wb_cmd_lookupsid_recv(struct composite_context *c,
+			       TALLOC_CTX *mem_ctx,
+			       struct wb_sid_object **sid);
+NTSTATUS wb_cmd_lookupsid(TALLOC_CTX *mem_ctx, struct wbsrv_service *service,
+			  const struct dom_sid *sid,
+			  struct wb_sid_object **name);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getdcname.c  */
+
+struct composite_context *wb_cmd_getdcname_send(TALLOC_CTX *mem_ctx,
+						struct wbsrv_service *service,
+						const char *domain_name);
+NTSTATUS wb_cmd_getdcname_recv(struct composite_context *c,
+			       TALLOC_CTX *mem_ctx,
+			       const char **dcname);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getgrnam.c  */
+
+struct composite_context *wb_cmd_getgrnam_send(TALLOC_CTX *mem_ctx,
+						 struct wbsrv_service *service,
+						 const char *name);
+NTSTATUS wb_cmd_getgrnam_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct winbindd_gr **gr);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getgrgid.c  */
+
+struct composite_context *wb_cmd_getgrgid_send(TALLOC_CTX *mem_ctx,
+						 struct wbsrv_service *service,
+						 gid_t gid);
+NTSTATUS wb_cmd_getgrgid_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct winbindd_gr **gr);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getpwnam.c  */
+
+struct composite_context *wb_cmd_getpwnam_send(TALLOC_CTX *mem_ctx,
+						 struct wbsrv_service *service,
+						 const char *name);
+NTSTATUS wb_cmd_getpwnam_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct winbindd_pw **pw);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getpwuid.c  */
+
+struct composite_context *wb_cmd_getpwuid_send(TALLOC_CTX *mem_ctx,
+						 struct wbsrv_service *service,
+						 uid_t uid);
+NTSTATUS wb_cmd_getpwuid_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct winbindd_pw **pw);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_userdomgroups.c  */
+
+struct composite_context *wb_cmd_userdomgroups_send(TALLOC_CTX *mem_ctx,
+						    struct wbsrv_service *service,
+						    const struct dom_sid *sid);
+NTSTATUS wb_cmd_userdomgroups_recv(struct composite_context *c,
+				   TALLOC_CTX *mem_ctx,
+				   uint32_t *num_sids, struct dom_sid ***sids);
+NTSTATUS wb_cmd_userdomgroups(TALLOC_CTX *mem_ctx,
+			      struct wbsrv_service *service,
+			      const struct dom_sid *sid,
+			      uint32_t *num_sids, struct dom_sid ***sids);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_usersids.c  */
+
+struct composite_context *wb_cmd_usersids_send(TALLOC_CTX *mem_ctx,
+					       struct wbsrv_service *service,
+					       const struct dom_sid *sid);
+NTSTATUS wb_cmd_usersids_recv(struct composite_context *ctx,
+			      TALLOC_CTX *mem_ctx,
+			      uint32_t *num_sids, struct dom_sid ***sids);
+NTSTATUS wb_cmd_usersids(TALLOC_CTX *mem_ctx, struct wbsrv_service *service,
+			 const struct dom_sid *sid,
+			 uint32_t *num_sids, struct dom_sid ***sids);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_list_groups.c  */
+
+struct composite_context *wb_cmd_list_groups_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, const char *domain_name);
+NTSTATUS wb_cmd_list_groups_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, uint32_t *extra_data_len,
+		char **extra_data, uint32_t *num_groups);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_list_trustdom.c  */
+
+struct composite_context *wb_cmd_list_trustdoms_send(TALLOC_CTX *mem_ctx,
+						     struct wbsrv_service *service);
+NTSTATUS wb_cmd_list_trustdoms_recv(struct composite_context *ctx,
+				    TALLOC_CTX *mem_ctx,
+				    uint32_t *num_domains,
+				    struct wb_dom_info ***domains);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_list_users.c  */
+
+struct composite_context *wb_cmd_list_users_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, const char *domain_name);
+NTSTATUS wb_cmd_list_users_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, uint32_t *extra_data_len,
+		char **extra_data, uint32_t *num_users);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_setpwent.c  */
+
+struct composite_context *wb_cmd_setpwent_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service);
+NTSTATUS wb_cmd_setpwent_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct wbsrv_pwent **pwent);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getpwent.c  */
+
+struct composite_context *wb_cmd_getpwent_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, struct wbsrv_pwent *pwent,
+		uint32_t max_users);
+NTSTATUS wb_cmd_getpwent_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct winbindd_pw **pw,
+		uint32_t *num_users);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getgrent.c  */
+
+struct composite_context *wb_cmd_getgrent_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service, struct wbsrv_grent *grent,
+		uint32_t max_groups);
+NTSTATUS wb_cmd_getgrent_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct winbindd_gr **gr,
+		uint32_t *num_groups);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_setgrent.c  */
+
+struct composite_context *wb_cmd_setgrent_send(TALLOC_CTX *mem_ctx,
+		struct wbsrv_service *service);
+NTSTATUS wb_cmd_setgrent_recv(struct composite_context *ctx,
+		TALLOC_CTX *mem_ctx, struct wbsrv_grent **grent);
+
+/* The following definitions come from ../source4/winbind/wb_cmd_getgroups.c  */
+
+struct composite_context *wb_cmd_getgroups_send(TALLOC_CTX *mem_ctx,
+						struct wbsrv_service *service,
+						const char* username);
+NTSTATUS wb_cmd_getgroups_recv(struct composite_context *ctx,
+			       TALLOC_CTX *mem_ctx, gid_t **groups,
+			       uint32_t *num_groups);
+
+/* The following definitions come from ../source4/winbind/wb_pam_auth.c  */
+
+struct composite_context *wb_cmd_pam_auth_crap_send(TALLOC_CTX *mem_ctx,
+						    struct wbsrv_service *service,
+						    uint32_t logon_parameters,
+						    const char *domain,
+						    const char *user,
+						    const char *workstation,
+						    DATA_BLOB chal,
+						    DATA_BLOB nt_resp,
+						    DATA_BLOB lm_resp);
+NTSTATUS wb_cmd_pam_auth_crap_recv(struct composite_context *c,
+				   TALLOC_CTX *mem_ctx,
+				   DATA_BLOB *info3,
+				   struct netr_UserSessionKey *user_session_key,
+				   struct netr_LMSessionKey *lm_key,
+				   char **unix_username);
+struct composite_context *wb_cmd_pam_auth_send(TALLOC_CTX *mem_ctx,
+					       struct wbsrv_service *service,
+					       struct cli_credentials *credentials);
+NTSTATUS wb_cmd_pam_auth_recv(struct composite_context *c,
+			      TALLOC_CTX *mem_ctx,
+			      DATA_BLOB *info3,
+			      struct netr_UserSessionKey *user_session_key,
+			      struct netr_LMSessionKey *lm_key,
+			      char **unix_username);
+
+/* The following definitions come from ../source4/winbind/wb_sam_logon.c  */
+
+struct composite_context *wb_sam_logon_send(TALLOC_CTX *mem_ctx,
+					    struct wbsrv_service *service,
+					    struct winbind_SamLogon *req);
+NTSTATUS wb_sam_logon_recv(struct composite_context *c,
+			   TALLOC_CTX *mem_ctx,
+			   struct winbind_SamLogon *req);
+
+/* The following definitions come from ../source4/winbind/wb_update_rodc_dns.c  */
+
+struct composite_context *wb_update_rodc_dns_send(TALLOC_CTX *mem_ctx,
+					    struct wbsrv_service *service,
+					    struct winbind_DsrUpdateReadOnlyServerDnsRecords *req);
+NTSTATUS wb_update_rodc_dns_recv(struct composite_context *c,
+			   TALLOC_CTX *mem_ctx,
+			   struct winbind_DsrUpdateReadOnlyServerDnsRecords *req);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_SOURCE4_WINBIND_WB_PROTO_H__ */
+
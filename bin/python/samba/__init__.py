@@ -0,0 +1 @@
+/root/repo/source4/scripting/python/samba/__init__.py
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/source4/librpc/rpc/dcerpc.py
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/source4/scripting/python/samba/kcc_utils.py
\ No newline at end of file
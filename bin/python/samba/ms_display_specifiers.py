@@ -0,0 +1 @@
+/root/repo/source4/scripting/python/samba/ms_display_specifiers.py
\ No newline at end of file
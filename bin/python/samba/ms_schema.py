@@ -0,0 +1 @@
+/root/repo/source4/scripting/python/samba/ms_schema.py
\ No newline at end of file
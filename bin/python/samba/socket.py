@@ -0,0 +1 @@
+/root/repo/lib/socket_wrapper/socket.py
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/source4/scripting/python/samba/tests/blackbox/samba_tool_drs.py
\ No newline at end of file
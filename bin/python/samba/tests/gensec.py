@@ -0,0 +1 @@
+/root/repo/source4/scripting/python/samba/tests/gensec.py
\ No newline at end of file
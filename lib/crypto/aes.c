@@ -35,6 +35,7 @@
 
 #include "rijndael-alg-fst.h"
 #include "aes.h"
+#include "cpu.h"
 
 int
 AES_set_encrypt_key(const unsigned char *userkey, const int bits, AES_KEY *key)
@@ -57,12 +58,24 @@ AES_set_decrypt_key(const unsigned char *userkey, const int bits, AES_KEY *key)
 void
 AES_encrypt(const unsigned char *in, unsigned char *out, const AES_KEY *key)
 {
+#ifdef SAMBA_CRYPTO_X86
+    if (samba_crypto_cpu_features() & SAMBA_CRYPTO_CPU_AESNI) {
+	samba_aes_encrypt_x86(key->key, key->rounds, in, out);
+	return;
+    }
+#endif
     rijndaelEncrypt(key->key, key->rounds, in, out);
 }
 
 void
 AES_decrypt(const unsigned char *in, unsigned char *out, const AES_KEY *key)
 {
+#ifdef SAMBA_CRYPTO_X86
+    if (samba_crypto_cpu_features() & SAMBA_CRYPTO_CPU_AESNI) {
+	samba_aes_decrypt_x86(key->key, key->rounds, in, out);
+	return;
+    }
+#endif
     rijndaelDecrypt(key->key, key->rounds, in, out);
 }
 
@@ -0,0 +1,76 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   AES block functions using AES-NI
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "replace.h"
+#include "../lib/crypto/cpu.h"
+
+#ifdef SAMBA_CRYPTO_X86
+
+#include <immintrin.h>
+
+/*
+ * The key schedules come from rijndaelKeySetupEnc() and
+ * rijndaelKeySetupDec(), which store each round key as four big endian
+ * words. The decryption schedule is already in the reversed order and
+ * with InvMixColumns applied, which is what AESDEC expects.
+ */
+
+__attribute__((target("aes,ssse3")))
+static inline __m128i aes_round_key(const uint32_t *rk, int round)
+{
+	const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+					     0x0405060700010203ULL);
+
+	return _mm_shuffle_epi8(
+		_mm_loadu_si128((const __m128i *)&rk[4*round]), bswap);
+}
+
+__attribute__((target("aes,ssse3")))
+void samba_aes_encrypt_x86(const uint32_t *rk, int rounds,
+			   const uint8_t in[16], uint8_t out[16])
+{
+	__m128i s;
+	int i;
+
+	s = _mm_loadu_si128((const __m128i *)in);
+	s = _mm_xor_si128(s, aes_round_key(rk, 0));
+	for (i = 1; i < rounds; i++) {
+		s = _mm_aesenc_si128(s, aes_round_key(rk, i));
+	}
+	s = _mm_aesenclast_si128(s, aes_round_key(rk, rounds));
+	_mm_storeu_si128((__m128i *)out, s);
+}
+
+__attribute__((target("aes,ssse3")))
+void samba_aes_decrypt_x86(const uint32_t *rk, int rounds,
+			   const uint8_t in[16], uint8_t out[16])
+{
+	__m128i s;
+	int i;
+
+	s = _mm_loadu_si128((const __m128i *)in);
+	s = _mm_xor_si128(s, aes_round_key(rk, 0));
+	for (i = 1; i < rounds; i++) {
+		s = _mm_aesdec_si128(s, aes_round_key(rk, i));
+	}
+	s = _mm_aesdeclast_si128(s, aes_round_key(rk, rounds));
+	_mm_storeu_si128((__m128i *)out, s);
+}
+
+#endif /* SAMBA_CRYPTO_X86 */
@@ -0,0 +1,115 @@
+/*
+   Unix SMB/CIFS implementation.
+   AES tests
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "replace.h"
+#include "../lib/util/samba_util.h"
+#include "../lib/crypto/crypto.h"
+#include "../lib/crypto/cpu.h"
+
+struct torture_context;
+
+/*
+ This uses the test values from FIPS-197 appendix C. Each test is run
+ with the accelerated routines of this CPU, if any, and with the
+ portable code.
+*/
+bool torture_local_crypto_aes(struct torture_context *torture)
+{
+	bool ret = true;
+	uint32_t i, m;
+	unsigned int masks[2] = { ~0U, 0 };
+	unsigned int old_mask;
+	uint8_t cbc[2][256];
+	uint8_t buf[256];
+	struct {
+		DATA_BLOB key;
+		DATA_BLOB plaintext;
+		DATA_BLOB ciphertext;
+	} testarray[4];
+
+	TALLOC_CTX *tctx = talloc_new(torture);
+	if (!tctx) { return false; };
+
+	testarray[0].key	= strhex_to_data_blob(tctx, "000102030405060708090a0b0c0d0e0f");
+	testarray[0].plaintext	= strhex_to_data_blob(tctx, "00112233445566778899aabbccddeeff");
+	testarray[0].ciphertext	= strhex_to_data_blob(tctx, "69c4e0d86a7b0430d8cdb78070b4c55a");
+
+	testarray[1].key	= strhex_to_data_blob(tctx, "000102030405060708090a0b0c0d0e0f"
+							"1011121314151617");
+	testarray[1].plaintext	= strhex_to_data_blob(tctx, "00112233445566778899aabbccddeeff");
+	testarray[1].ciphertext	= strhex_to_data_blob(tctx, "dda97ca4864cdfe06eaf70a0ec0d7191");
+
+	testarray[2].key	= strhex_to_data_blob(tctx, "000102030405060708090a0b0c0d0e0f"
+							"101112131415161718191a1b1c1d1e1f");
+	testarray[2].plaintext	= strhex_to_data_blob(tctx, "00112233445566778899aabbccddeeff");
+	testarray[2].ciphertext	= strhex_to_data_blob(tctx, "8ea2b7ca516745bfeafc49904b496089");
+
+	testarray[3].key	= data_blob(NULL, 0);
+
+	for (i=0; i<sizeof(buf); i++) {
+		buf[i] = i * 13 + 5;
+	}
+
+	old_mask = samba_crypto_cpu_set_mask(masks[0]);
+
+	for (m=0; m<2; m++) {
+		AES_KEY key;
+		uint8_t iv[AES_BLOCK_SIZE];
+		uint8_t out[AES_BLOCK_SIZE];
+
+		samba_crypto_cpu_set_mask(masks[m]);
+
+		for (i=0; testarray[i].key.data; i++) {
+			AES_set_encrypt_key(testarray[i].key.data,
+					    testarray[i].key.length * 8, &key);
+			AES_encrypt(testarray[i].plaintext.data, out, &key);
+			if (memcmp(out, testarray[i].ciphertext.data,
+				   AES_BLOCK_SIZE) != 0) {
+				printf("aes encrypt test[%u] (cpu features 0x%x): failed\n",
+				       i, samba_crypto_cpu_features());
+				dump_data(0, out, AES_BLOCK_SIZE);
+				ret = false;
+			}
+
+			AES_set_decrypt_key(testarray[i].key.data,
+					    testarray[i].key.length * 8, &key);
+			AES_decrypt(testarray[i].ciphertext.data, out, &key);
+			if (memcmp(out, testarray[i].plaintext.data,
+				   AES_BLOCK_SIZE) != 0) {
+				printf("aes decrypt test[%u] (cpu features 0x%x): failed\n",
+				       i, samba_crypto_cpu_features());
+				dump_data(0, out, AES_BLOCK_SIZE);
+				ret = false;
+			}
+		}
+
+		/* both implementations must agree on a longer CBC stream */
+		AES_set_encrypt_key(testarray[2].key.data, 256, &key);
+		memset(iv, 0, sizeof(iv));
+		AES_cbc_encrypt(buf, cbc[m], sizeof(buf), &key, iv, AES_ENCRYPT);
+	}
+
+	samba_crypto_cpu_set_mask(old_mask);
+
+	if (memcmp(cbc[0], cbc[1], sizeof(buf)) != 0) {
+		printf("aes cbc: accelerated and portable code differ\n");
+		ret = false;
+	}
+
+	talloc_free(tctx);
+	return ret;
+}
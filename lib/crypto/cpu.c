@@ -0,0 +1,75 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   Run time selection of CPU accelerated crypto routines
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "replace.h"
+#include "../lib/crypto/cpu.h"
+
+#ifdef SAMBA_CRYPTO_X86
+#include <cpuid.h>
+#endif
+
+static bool cpu_features_probed;
+static unsigned int cpu_features;
+static unsigned int cpu_features_mask = ~0U;
+
+static unsigned int cpu_features_probe(void)
+{
+	unsigned int features = 0;
+#ifdef SAMBA_CRYPTO_X86
+	unsigned int eax, ebx, ecx, edx;
+	unsigned int max_leaf;
+
+	max_leaf = __get_cpuid_max(0, NULL);
+	if (max_leaf < 1) {
+		return 0;
+	}
+
+	__cpuid(1, eax, ebx, ecx, edx);
+
+	if ((ecx & bit_AES) && (ecx & bit_SSSE3)) {
+		features |= SAMBA_CRYPTO_CPU_AESNI;
+	}
+
+	if (max_leaf >= 7 && (ecx & bit_SSE4_1)) {
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		/* CPUID.(EAX=7,ECX=0):EBX bit 29 */
+		if (ebx & (1U << 29)) {
+			features |= SAMBA_CRYPTO_CPU_SHA;
+		}
+	}
+#endif
+	return features;
+}
+
+_PUBLIC_ unsigned int samba_crypto_cpu_features(void)
+{
+	if (!cpu_features_probed) {
+		cpu_features = cpu_features_probe();
+		cpu_features_probed = true;
+	}
+	return cpu_features & cpu_features_mask;
+}
+
+_PUBLIC_ unsigned int samba_crypto_cpu_set_mask(unsigned int mask)
+{
+	unsigned int old = cpu_features_mask;
+
+	cpu_features_mask = mask;
+	return old;
+}
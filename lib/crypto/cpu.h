@@ -0,0 +1,63 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   Run time selection of CPU accelerated crypto routines
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LIB_CRYPTO_CPU_H
+#define LIB_CRYPTO_CPU_H
+
+/*
+ * The x86 routines need a compiler that knows the AES-NI and SHA
+ * intrinsics and the target function attribute, so they can be built
+ * without -maes/-msha and only used when the CPU has them.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__clang__)
+#if __clang_major__ > 3 || (__clang_major__ == 3 && __clang_minor__ >= 8)
+#define SAMBA_CRYPTO_X86 1
+#endif
+#elif defined(__GNUC__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)
+#define SAMBA_CRYPTO_X86 1
+#endif
+#endif
+#endif
+
+#define SAMBA_CRYPTO_CPU_AESNI	0x0001	/* AES-NI and SSSE3 */
+#define SAMBA_CRYPTO_CPU_SHA	0x0002	/* SHA extensions and SSE4.1 */
+
+/*
+ * The accelerated routines available on this CPU, limited by the mask
+ * set with samba_crypto_cpu_set_mask().
+ */
+unsigned int samba_crypto_cpu_features(void);
+
+/*
+ * Only use the accelerated routines in "mask", 0 forces the portable
+ * C code. Returns the previous mask. Used by the tests and benchmarks
+ * to compare the implementations.
+ */
+unsigned int samba_crypto_cpu_set_mask(unsigned int mask);
+
+void samba_sha256_blocks_x86(uint32_t state[8], const uint8_t *data,
+			     size_t num_blocks);
+void samba_aes_encrypt_x86(const uint32_t *rk, int rounds,
+			   const uint8_t in[16], uint8_t out[16]);
+void samba_aes_decrypt_x86(const uint32_t *rk, int rounds,
+			   const uint8_t in[16], uint8_t out[16]);
+
+#endif /* LIB_CRYPTO_CPU_H */
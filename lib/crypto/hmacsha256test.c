@@ -0,0 +1,158 @@
+/*
+   Unix SMB/CIFS implementation.
+   HMAC SHA256 tests
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "replace.h"
+#include "../lib/util/samba_util.h"
+#include "../lib/crypto/crypto.h"
+#include "../lib/crypto/cpu.h"
+
+struct torture_context;
+
+static DATA_BLOB data_blob_repeat_byte(uint8_t byte, size_t length)
+{
+	DATA_BLOB b = data_blob(NULL, length);
+	memset(b.data, byte, length);
+	return b;
+}
+
+/*
+ * Hash data in pieces of all sizes up to 130 bytes, so every way of
+ * filling and flushing the partial block buffer is used.
+ */
+static bool sha256_split_test(const uint8_t *data, size_t len)
+{
+	uint8_t whole[SHA256_DIGEST_LENGTH];
+	uint8_t split[SHA256_DIGEST_LENGTH];
+	SHA256_CTX ctx;
+	size_t piece, ofs;
+
+	samba_SHA256_Init(&ctx);
+	samba_SHA256_Update(&ctx, data, len);
+	samba_SHA256_Final(whole, &ctx);
+
+	for (piece = 1; piece <= 130; piece++) {
+		samba_SHA256_Init(&ctx);
+		for (ofs = 0; ofs < len; ofs += piece) {
+			samba_SHA256_Update(&ctx, data + ofs,
+					    MIN(piece, len - ofs));
+		}
+		samba_SHA256_Final(split, &ctx);
+		if (memcmp(whole, split, sizeof(whole)) != 0) {
+			printf("sha256 split test: piece size %u failed\n",
+			       (unsigned int)piece);
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+ This uses the test values from rfc 4231. Each test is run with the
+ accelerated routines of this CPU, if any, and with the portable code.
+*/
+bool torture_local_crypto_hmacsha256(struct torture_context *torture)
+{
+	bool ret = true;
+	uint32_t i, m;
+	unsigned int masks[2] = { ~0U, 0 };
+	unsigned int old_mask;
+	uint8_t buf[1000];
+	struct {
+		DATA_BLOB key;
+		DATA_BLOB data;
+		DATA_BLOB sha256;
+	} testarray[7];
+
+	TALLOC_CTX *tctx = talloc_new(torture);
+	if (!tctx) { return false; };
+
+	testarray[0].key	= data_blob_repeat_byte(0x0b, 20);
+	testarray[0].data	= data_blob_string_const("Hi There");
+	testarray[0].sha256	= strhex_to_data_blob(tctx, "b0344c61d8db38535ca8afceaf0bf12b"
+							    "881dc200c9833da726e9376c2e32cff7");
+
+	testarray[1].key	= data_blob_string_const("Jefe");
+	testarray[1].data	= data_blob_string_const("what do ya want for nothing?");
+	testarray[1].sha256	= strhex_to_data_blob(tctx, "5bdcc146bf60754e6a042426089575c7"
+							    "5a003f089d2739839dec58b964ec3843");
+
+	testarray[2].key	= data_blob_repeat_byte(0xaa, 20);
+	testarray[2].data	= data_blob_repeat_byte(0xdd, 50);
+	testarray[2].sha256	= strhex_to_data_blob(tctx, "773ea91e36800e46854db8ebd09181a7"
+							    "2959098b3ef8c122d9635514ced565fe");
+
+	testarray[3].key	= strhex_to_data_blob(tctx, "0102030405060708090a0b0c0d0e0f10111213141516171819");
+	testarray[3].data	= data_blob_repeat_byte(0xcd, 50);
+	testarray[3].sha256	= strhex_to_data_blob(tctx, "82558a389a443c0ea4cc819899f2083a"
+							    "85f0faa3e578f8077a2e3ff46729665b");
+
+	testarray[4].key	= data_blob_repeat_byte(0xaa, 131);
+	testarray[4].data	= data_blob_string_const("Test Using Larger Than Block-Size Key - Hash Key First");
+	testarray[4].sha256	= strhex_to_data_blob(tctx, "60e431591ee0b67f0d8a26aacbf5b77f"
+							    "8e0bc6213728c5140546040f0ee37f54");
+
+	testarray[5].key	= data_blob_repeat_byte(0xaa, 131);
+	testarray[5].data	= data_blob_string_const("This is a test using a larger than block-size key "
+							 "and a larger than block-size data. The key needs to "
+							 "be hashed before being used by the HMAC algorithm.");
+	testarray[5].sha256	= strhex_to_data_blob(tctx, "9b09ffa71b942fcb27635fbcd5b0e944"
+							    "bfdc63644f0713938a7f51535c3a35e2");
+
+	testarray[6].key        = data_blob(NULL, 0);
+
+	for (i=0; i<sizeof(buf); i++) {
+		buf[i] = i * 7 + (i >> 8);
+	}
+
+	old_mask = samba_crypto_cpu_set_mask(masks[0]);
+
+	for (m=0; m<2; m++) {
+		samba_crypto_cpu_set_mask(masks[m]);
+
+		for (i=0; testarray[i].key.data; i++) {
+			struct HMACSHA256Context ctx;
+			uint8_t sha256[SHA256_DIGEST_LENGTH];
+			int e;
+
+			hmac_sha256_init(testarray[i].key.data, testarray[i].key.length, &ctx);
+			hmac_sha256_update(testarray[i].data.data, testarray[i].data.length, &ctx);
+			hmac_sha256_final(sha256, &ctx);
+
+			e = memcmp(testarray[i].sha256.data,
+				   sha256,
+				   MIN(testarray[i].sha256.length, SHA256_DIGEST_LENGTH));
+			if (e != 0) {
+				printf("hmacsha256 test[%u] (cpu features 0x%x): failed\n",
+				       i, samba_crypto_cpu_features());
+				dump_data(0, testarray[i].key.data, testarray[i].key.length);
+				dump_data(0, testarray[i].data.data, testarray[i].data.length);
+				dump_data(0, testarray[i].sha256.data, testarray[i].sha256.length);
+				dump_data(0, sha256, SHA256_DIGEST_LENGTH);
+				ret = false;
+			}
+		}
+
+		if (!sha256_split_test(buf, sizeof(buf))) {
+			ret = false;
+		}
+	}
+
+	samba_crypto_cpu_set_mask(old_mask);
+
+	talloc_free(tctx);
+	return ret;
+}
@@ -40,6 +40,7 @@
 
 #include "replace.h"
 #include "sha256.h"
+#include "cpu.h"
 
 #define Ch(x,y,z) (((x) & (y)) ^ ((~(x)) & (z)))
 #define Maj(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
@@ -142,49 +143,29 @@ calc (SHA256_CTX *m, uint32_t *in)
     H += HH;
 }
 
-/*
- * From `Performance analysis of MD5' by Joseph D. Touch <touch@isi.edu>
- */
-
-#if !defined(WORDS_BIGENDIAN) || defined(_CRAY)
-/* Vector Crays doesn't have a good 32-bit type, or more precisely,
-   int32_t as defined by <bind/bitypes.h> isn't 32 bits, and we don't
-   want to depend in being able to redefine this type.  To cope with
-   this we have to clamp the result in some places to [0,2^32); no
-   need to do this on other machines.  Did I say this was a mess?
-   */
-
-#ifdef _CRAY
-#define CRAYFIX(X) ((X) & 0xffffffff)
-#else
-#define CRAYFIX(X) (X)
-#endif
-
-static inline uint32_t
-cshift (uint32_t x, unsigned int n)
-{
-    x = CRAYFIX(x);
-    return CRAYFIX((x << n) | (x >> (32 - n)));
-}
-
-static inline uint32_t
-swap_uint32_t (uint32_t t)
+static void
+sha256_blocks (SHA256_CTX *m, const unsigned char *p, size_t num_blocks)
 {
-    uint32_t temp1, temp2;
-
-    temp1   = cshift(t, 16);
-    temp2   = temp1 >> 8;
-    temp1  &= 0x00ff00ff;
-    temp2  &= 0x00ff00ff;
-    temp1 <<= 8;
-    return temp1 | temp2;
-}
+#ifdef SAMBA_CRYPTO_X86
+    if (samba_crypto_cpu_features() & SAMBA_CRYPTO_CPU_SHA) {
+	samba_sha256_blocks_x86(m->counter, p, num_blocks);
+	return;
+    }
 #endif
+    while (num_blocks-- > 0) {
+	uint32_t current[16];
+	int i;
 
-struct x32{
-    unsigned int a:32;
-    unsigned int b:32;
-};
+	for (i = 0; i < 16; i++) {
+	    current[i] = ((uint32_t)p[4*i] << 24) |
+		((uint32_t)p[4*i+1] << 16) |
+		((uint32_t)p[4*i+2] << 8) |
+		((uint32_t)p[4*i+3]);
+	}
+	calc(m, current);
+	p += 64;
+    }
+}
 
 void
 samba_SHA256_Update (SHA256_CTX *m, const void *v, size_t len)
@@ -192,33 +173,30 @@ samba_SHA256_Update (SHA256_CTX *m, const void *v, size_t len)
     const unsigned char *p = (const unsigned char *)v;
     size_t old_sz = m->sz[0];
     size_t offset;
+    size_t num_blocks;
 
     m->sz[0] += len * 8;
     if (m->sz[0] < old_sz)
 	++m->sz[1];
     offset = (old_sz / 8) % 64;
-    while(len > 0){
+    if (offset > 0) {
 	size_t l = MIN(len, 64 - offset);
 	memcpy(m->save + offset, p, l);
 	offset += l;
 	p += l;
 	len -= l;
-	if(offset == 64){
-#if !defined(WORDS_BIGENDIAN) || defined(_CRAY)
-	    int i;
-	    uint32_t current[16];
-	    struct x32 *u = (struct x32*)m->save;
-	    for(i = 0; i < 8; i++){
-		current[2*i+0] = swap_uint32_t(u[i].a);
-		current[2*i+1] = swap_uint32_t(u[i].b);
-	    }
-	    calc(m, current);
-#else
-	    calc(m, (uint32_t*)m->save);
-#endif
-	    offset = 0;
-	}
+	if (offset < 64)
+	    return;
+	sha256_blocks(m, m->save, 1);
+    }
+    /* hash whole blocks straight from the caller's buffer */
+    num_blocks = len / 64;
+    if (num_blocks > 0) {
+	sha256_blocks(m, p, num_blocks);
+	p += num_blocks * 64;
+	len -= num_blocks * 64;
     }
+    memcpy(m->save, p, len);
 }
 
 void
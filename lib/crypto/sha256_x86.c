@@ -0,0 +1,137 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   SHA-256 block function using the x86 SHA extensions
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "replace.h"
+#include "../lib/crypto/cpu.h"
+
+#ifdef SAMBA_CRYPTO_X86
+
+#include <immintrin.h>
+
+static const uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* four rounds with the message words in w */
+#define SHA256_ROUNDS4(i, w) do { \
+	msg = _mm_add_epi32(w, \
+		_mm_loadu_si128((const __m128i *)&sha256_k[4*(i)])); \
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg); \
+	msg = _mm_shuffle_epi32(msg, 0x0E); \
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg); \
+} while (0)
+
+/* first half of the schedule for the words 16 positions after w0 */
+#define SHA256_MSG1(w0, w1) \
+	w0 = _mm_sha256msg1_epu32(w0, w1)
+
+/* second half, w0 becomes the next four words */
+#define SHA256_MSG2(w0, w3, w2) \
+	w0 = _mm_sha256msg2_epu32( \
+		_mm_add_epi32(w0, _mm_alignr_epi8(w3, w2, 4)), w3)
+
+__attribute__((target("sha,sse4.1")))
+void samba_sha256_blocks_x86(uint32_t state[8], const uint8_t *data,
+			     size_t num_blocks)
+{
+	const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+					     0x0405060700010203ULL);
+	__m128i state0, state1, tmp, msg;
+	__m128i m0, m1, m2, m3;
+	__m128i abef, cdgh;
+
+	/* the instructions want the state as ABEF and CDGH */
+	tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+	state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xB1);
+	state1 = _mm_shuffle_epi32(state1, 0x1B);
+	state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+	while (num_blocks-- > 0) {
+		abef = state0;
+		cdgh = state1;
+
+		m0 = _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i *)(data + 0)), bswap);
+		m1 = _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i *)(data + 16)), bswap);
+		m2 = _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i *)(data + 32)), bswap);
+		m3 = _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i *)(data + 48)), bswap);
+
+		SHA256_ROUNDS4(0, m0);
+		SHA256_ROUNDS4(1, m1); SHA256_MSG1(m0, m1);
+		SHA256_ROUNDS4(2, m2); SHA256_MSG1(m1, m2);
+		SHA256_ROUNDS4(3, m3); SHA256_MSG2(m0, m3, m2);
+		SHA256_MSG1(m2, m3);
+		SHA256_ROUNDS4(4, m0); SHA256_MSG2(m1, m0, m3);
+		SHA256_MSG1(m3, m0);
+		SHA256_ROUNDS4(5, m1); SHA256_MSG2(m2, m1, m0);
+		SHA256_MSG1(m0, m1);
+		SHA256_ROUNDS4(6, m2); SHA256_MSG2(m3, m2, m1);
+		SHA256_MSG1(m1, m2);
+		SHA256_ROUNDS4(7, m3); SHA256_MSG2(m0, m3, m2);
+		SHA256_MSG1(m2, m3);
+		SHA256_ROUNDS4(8, m0); SHA256_MSG2(m1, m0, m3);
+		SHA256_MSG1(m3, m0);
+		SHA256_ROUNDS4(9, m1); SHA256_MSG2(m2, m1, m0);
+		SHA256_MSG1(m0, m1);
+		SHA256_ROUNDS4(10, m2); SHA256_MSG2(m3, m2, m1);
+		SHA256_MSG1(m1, m2);
+		SHA256_ROUNDS4(11, m3); SHA256_MSG2(m0, m3, m2);
+		SHA256_MSG1(m2, m3);
+		SHA256_ROUNDS4(12, m0); SHA256_MSG2(m1, m0, m3);
+		SHA256_MSG1(m3, m0);
+		SHA256_ROUNDS4(13, m1); SHA256_MSG2(m2, m1, m0);
+		SHA256_ROUNDS4(14, m2); SHA256_MSG2(m3, m2, m1);
+		SHA256_ROUNDS4(15, m3);
+
+		state0 = _mm_add_epi32(state0, abef);
+		state1 = _mm_add_epi32(state1, cdgh);
+
+		data += 64;
+	}
+
+	/* back to ABCD and EFGH */
+	tmp = _mm_shuffle_epi32(state0, 0x1B);
+	state1 = _mm_shuffle_epi32(state1, 0xB1);
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+	state1 = _mm_alignr_epi8(state1, tmp, 8);
+	_mm_storeu_si128((__m128i *)&state[0], state0);
+	_mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#endif /* SAMBA_CRYPTO_X86 */
@@ -0,0 +1 @@
+/root/repo/lib/tevent/tevent.py
\ No newline at end of file
@@ -271,6 +271,14 @@ struct ldb_utf8_fns {
 */
 #define LDB_FLG_ENABLE_TRACING 32
 
+/**
+   Flag to tell backends to share the final sync of concurrent
+   transaction commits. The tdb backend only honours it when it
+   creates the database, which can then only be written in
+   transactions.
+*/
+#define LDB_FLG_GROUP_COMMIT 64
+
 /*
    structures for ldb_parse_tree handling code
 */
@@ -364,6 +364,8 @@ int ltdb_cache_load(struct ldb_module *module)
 	}
 	ltdb->cache->one_level_indexes = false;
 	ltdb->cache->attribute_indexes = false;
+	ltdb->cache->paged_indexes = false;
+	ltdb->cache->GUID_index_attribute = NULL;
 	    
 	indexlist_dn = ldb_dn_new(module, ldb, LTDB_INDEXLIST);
 	if (indexlist_dn == NULL) goto failed;
@@ -379,6 +381,12 @@ int ltdb_cache_load(struct ldb_module *module)
 	if (ldb_msg_find_element(ltdb->cache->indexlist, LTDB_IDXATTR) != NULL) {
 		ltdb->cache->attribute_indexes = true;
 	}
+	if (ldb_msg_find_element(ltdb->cache->indexlist, LTDB_IDXPAGED) != NULL) {
+		ltdb->cache->paged_indexes = true;
+	}
+	ltdb->cache->GUID_index_attribute
+		= ldb_msg_find_attr_as_string(ltdb->cache->indexlist,
+					      LTDB_IDXGUID, NULL);
 
 	if (ltdb_attributes_load(module) == -1) {
 		goto failed;
@@ -33,9 +33,23 @@
 
 #include "ldb_tdb.h"
 
+/*
+  the DNs of an index entry are kept sorted. Short lists live in a
+  single @INDEX record, long ones (with @IDXPAGED) are split into
+  @INDEXPAGE records of at most LTDB_INDEX_PAGE_MAX DNs, with the
+  @INDEX record just listing the first DN and the id of each page.
+
+  With @IDXPAGED there is also an @INDEXVALUES record per indexed
+  attribute, listing the indexed values in the order of the
+  attribute syntax, paged the same way. That's what >= and <=
+  searches walk.
+ */
 struct dn_list {
 	unsigned int count;
 	struct ldb_val *dn;
+	/* only set on the head of a paged list, in which case dn
+	   holds the first entry of each page */
+	unsigned int *pages;
 };
 
 struct ltdb_idxptr {
@@ -44,9 +58,17 @@ struct ltdb_idxptr {
 };
 
 /* we put a @IDXVERSION attribute on index entries. This
-   allows us to tell if it was written by an older version
+   allows us to tell if it was written by an older version.
+   Since version 3 the lists are sorted.
 */
-#define LTDB_INDEXING_VERSION 2
+#define LTDB_INDEXING_VERSION 3
+
+/* split a page once it gets larger than this */
+#define LTDB_INDEX_PAGE_MAX 2000
+
+/* a >= or <= search covering more values than this is left to a
+   full search */
+#define LTDB_INDEX_RANGE_MAX 10000
 
 /* enable the idxptr mode when transactions start */
 int ltdb_index_transaction_start(struct ldb_module *module)
@@ -60,39 +82,98 @@ int ltdb_index_transaction_start(struct ldb_module *module)
  * differences in string termination */
 static int dn_list_cmp(const struct ldb_val *v1, const struct ldb_val *v2)
 {
-	if (v1->length > v2->length && v1->data[v2->length] != 0) {
-		return -1;
+	size_t len1 = strnlen((const char *)v1->data, v1->length);
+	size_t len2 = strnlen((const char *)v2->data, v2->length);
+	int ret;
+
+	ret = memcmp(v1->data, v2->data, MIN(len1, len2));
+	if (ret != 0) {
+		return ret;
 	}
-	if (v1->length < v2->length && v2->data[v1->length] != 0) {
-		return 1;
+	if (len1 == len2) {
+		return 0;
 	}
-	return strncmp((char *)v1->data, (char *)v2->data, v1->length);
+	return len1 < len2 ? -1 : 1;
 }
 
+/*
+  the order of a sorted list: DNs, or if a is given, values of that
+  attribute in the @INDEXVALUES directory
+ */
+static int ltdb_index_cmp(struct ldb_context *ldb,
+			  const struct ldb_schema_attribute *a,
+			  const struct ldb_val *v1, const struct ldb_val *v2)
+{
+	if (a == NULL) {
+		return dn_list_cmp(v1, v2);
+	}
+	return a->syntax->comparison_fn(ldb, ldb, v1, v2);
+}
 
 /*
-  find a entry in a dn_list, using a ldb_val. Uses a case sensitive
-  comparison with the dn returns -1 if not found
+  binary search a sorted list. Returns true if v was found at *idx,
+  otherwise *idx is where it would have to be inserted
  */
-static int ltdb_dn_list_find_val(const struct dn_list *list, const struct ldb_val *v)
+static bool ltdb_dn_list_bsearch(struct ldb_context *ldb,
+				 const struct ldb_schema_attribute *a,
+				 const struct dn_list *list,
+				 const struct ldb_val *v, unsigned int *idx)
 {
-	unsigned int i;
-	for (i=0; i<list->count; i++) {
-		if (dn_list_cmp(&list->dn[i], v) == 0) return i;
+	unsigned int lo = 0, hi = list->count;
+
+	while (lo < hi) {
+		unsigned int mid = lo + (hi - lo) / 2;
+		int r = ltdb_index_cmp(ldb, a, &list->dn[mid], v);
+		if (r == 0) {
+			*idx = mid;
+			return true;
+		}
+		if (r < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
 	}
-	return -1;
+	*idx = lo;
+	return false;
 }
 
 /*
-  find a entry in a dn_list. Uses a case sensitive comparison with the dn
-  returns -1 if not found
+  the page of a paged list v belongs on. Returns false if v sorts
+  before the first page
  */
-static int ltdb_dn_list_find_str(struct dn_list *list, const char *dn)
+static bool ltdb_dn_list_page(struct ldb_context *ldb,
+			      const struct ldb_schema_attribute *a,
+			      const struct dn_list *head,
+			      const struct ldb_val *v, unsigned int *p)
 {
-	struct ldb_val v;
-	v.data = discard_const_p(unsigned char, dn);
-	v.length = strlen(dn);
-	return ltdb_dn_list_find_val(list, &v);
+	if (ltdb_dn_list_bsearch(ldb, a, head, v, p)) {
+		return true;
+	}
+	if (*p == 0) {
+		return false;
+	}
+	(*p)--;
+	return true;
+}
+
+/*
+  sort a DN list, unless it already is. Lists written before
+  LTDB_INDEXING_VERSION 3 are in insertion order
+ */
+static void ltdb_dn_list_sort(struct dn_list *list)
+{
+	unsigned int i;
+
+	for (i=1; i<list->count; i++) {
+		if (dn_list_cmp(&list->dn[i-1], &list->dn[i]) > 0) {
+			break;
+		}
+	}
+	if (i >= list->count) {
+		return;
+	}
+	TYPESAFE_QSORT(list->dn, list->count, dn_list_cmp);
 }
 
 /*
@@ -145,6 +226,7 @@ static int ltdb_dn_list_load(struct ldb_module *module,
 
 	list->dn = NULL;
 	list->count = 0;
+	list->pages = NULL;
 
 	/* see if we have any in-memory index entries */
 	if (ltdb->idxptr == NULL ||
@@ -183,7 +265,32 @@ normal_index:
 		return ret;
 	}
 
-	/* TODO: check indexing version number */
+	el = ldb_msg_find_element(msg, LTDB_IDXPAGE);
+	if (el != NULL) {
+		struct ldb_message_element *el_ids;
+		unsigned int i;
+
+		el_ids = ldb_msg_find_element(msg, LTDB_IDXPAGEID);
+		if (el_ids == NULL || el_ids->num_values != el->num_values) {
+			ldb_asprintf_errstring(ldb_module_get_ctx(module),
+					       "Bad page list in index %s",
+					       ldb_dn_get_linearized(dn));
+			talloc_free(msg);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		list->pages = talloc_array(list, unsigned int, el->num_values);
+		if (list->pages == NULL) {
+			talloc_free(msg);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		for (i=0; i<el_ids->num_values; i++) {
+			list->pages[i] = strtoul((char *)el_ids->values[i].data, NULL, 10);
+		}
+		list->dn = talloc_steal(list, el->values);
+		list->count = el->num_values;
+		talloc_free(msg);
+		return LDB_SUCCESS;
+	}
 
 	el = ldb_msg_find_element(msg, LTDB_IDX);
 	if (!el) {
@@ -195,6 +302,10 @@ normal_index:
 	list->dn = talloc_steal(list, el->values);
 	list->count = el->num_values;
 
+	if (ldb_msg_find_attr_as_uint(msg, LTDB_IDXVERSION, 0) < 3) {
+		ltdb_dn_list_sort(list);
+	}
+
 	return LDB_SUCCESS;
 }
 
@@ -228,7 +339,26 @@ static int ltdb_dn_list_store_full(struct ldb_module *module, struct ldb_dn *dn,
 	}
 
 	msg->dn = dn;
-	if (list->count > 0) {
+	if (list->pages != NULL) {
+		struct ldb_message_element *el;
+		unsigned int i;
+
+		ret = ldb_msg_add_empty(msg, LTDB_IDXPAGE, LDB_FLAG_MOD_ADD, &el);
+		if (ret != LDB_SUCCESS) {
+			talloc_free(msg);
+			return ldb_module_oom(module);
+		}
+		el->values = list->dn;
+		el->num_values = list->count;
+
+		for (i=0; i<list->count; i++) {
+			ret = ldb_msg_add_fmt(msg, LTDB_IDXPAGEID, "%u", list->pages[i]);
+			if (ret != LDB_SUCCESS) {
+				talloc_free(msg);
+				return ldb_module_oom(module);
+			}
+		}
+	} else if (list->count > 0) {
 		struct ldb_message_element *el;
 
 		ret = ldb_msg_add_empty(msg, LTDB_IDX, LDB_FLAG_MOD_ADD, &el);
@@ -280,6 +410,7 @@ static int ltdb_dn_list_store(struct ldb_module *module, struct ldb_dn *dn,
 		free(rec.dptr);
 		list2->dn = talloc_steal(list2, list->dn);
 		list2->count = list->count;
+		list2->pages = talloc_steal(list2, list->pages);
 		return LDB_SUCCESS;
 	}
 
@@ -289,6 +420,7 @@ static int ltdb_dn_list_store(struct ldb_module *module, struct ldb_dn *dn,
 	}
 	list2->dn = talloc_steal(list2, list->dn);
 	list2->count = list->count;
+	list2->pages = talloc_steal(list2, list->pages);
 
 	rec.dptr = (uint8_t *)&list2;
 	rec.dsize = sizeof(void *);
@@ -454,182 +586,1096 @@ static bool ltdb_is_indexed(const struct ldb_message *index_list, const char *at
 }
 
 /*
-  in the following logic functions, the return value is treated as
-  follows:
-
-     LDB_SUCCESS: we found some matching index values
-
-     LDB_ERR_NO_SUCH_OBJECT: we know for sure that no object matches
-
-     LDB_ERR_OPERATIONS_ERROR: indexing could not answer the call,
-                               we'll need a full search
+  the dn of page id of the paged list stored under dn
  */
+static struct ldb_dn *ltdb_index_page_key(TALLOC_CTX *mem_ctx,
+					  struct ldb_context *ldb,
+					  struct ldb_dn *dn, unsigned int id)
+{
+	return ldb_dn_new_fmt(mem_ctx, ldb, "%s:%u:%s", LTDB_INDEXPAGE, id,
+			      ldb_dn_get_linearized(dn));
+}
 
 /*
-  return a list of dn's that might match a simple indexed search (an
-  equality search only)
+  the dn of the @INDEXVALUES directory for an attribute
  */
-static int ltdb_index_dn_simple(struct ldb_module *module,
-				const struct ldb_parse_tree *tree,
-				const struct ldb_message *index_list,
-				struct dn_list *list)
+static struct ldb_dn *ltdb_index_values_key(TALLOC_CTX *mem_ctx,
+					    struct ldb_context *ldb,
+					    const char *attr)
 {
-	struct ldb_context *ldb;
-	struct ldb_dn *dn;
-	int ret;
+	struct ldb_dn *ret;
+	char *attr_folded;
 
-	ldb = ldb_module_get_ctx(module);
+	attr_folded = ldb_attr_casefold(mem_ctx, attr);
+	if (attr_folded == NULL) {
+		return NULL;
+	}
+	ret = ldb_dn_new_fmt(mem_ctx, ldb, "%s:%s", LTDB_INDEXVALUES, attr_folded);
+	talloc_free(attr_folded);
+	return ret;
+}
 
-	list->count = 0;
-	list->dn = NULL;
+static int ltdb_dn_list_load_page(struct ldb_module *module, struct ldb_dn *dn,
+				  unsigned int id, struct dn_list *list)
+{
+	struct ldb_dn *key;
+	int ret;
 
-	/* if the attribute isn't in the list of indexed attributes then
-	   this node needs a full search */
-	if (!ltdb_is_indexed(index_list, tree->u.equality.attr)) {
+	key = ltdb_index_page_key(list, ldb_module_get_ctx(module), dn, id);
+	if (key == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	ret = ltdb_dn_list_load(module, key, list);
+	talloc_free(key);
+	if (ret == LDB_ERR_NO_SUCH_OBJECT) {
+		ldb_asprintf_errstring(ldb_module_get_ctx(module),
+				       "Missing page %u of index %s",
+				       id, ldb_dn_get_linearized(dn));
 		return LDB_ERR_OPERATIONS_ERROR;
 	}
-
-	/* the attribute is indexed. Pull the list of DNs that match the 
-	   search criterion */
-	dn = ltdb_index_key(ldb, tree->u.equality.attr, &tree->u.equality.value, NULL);
-	if (!dn) return LDB_ERR_OPERATIONS_ERROR;
-
-	ret = ltdb_dn_list_load(module, dn, list);
-	talloc_free(dn);
 	return ret;
 }
 
+static int ltdb_dn_list_store_page(struct ldb_module *module, struct ldb_dn *dn,
+				   unsigned int id, struct dn_list *list)
+{
+	struct ldb_dn *key;
+	int ret;
 
-static bool list_union(struct ldb_context *, struct dn_list *, const struct dn_list *);
+	key = ltdb_index_page_key(list, ldb_module_get_ctx(module), dn, id);
+	if (key == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	ret = ltdb_dn_list_store(module, key, list);
+	talloc_free(key);
+	return ret;
+}
 
 /*
-  return a list of dn's that might match a leaf indexed search
+  return the whole list stored under dn, concatenating the pages of
+  a paged list
  */
-static int ltdb_index_dn_leaf(struct ldb_module *module,
-			      const struct ldb_parse_tree *tree,
-			      const struct ldb_message *index_list,
-			      struct dn_list *list)
+static int ltdb_dn_list_load_all(struct ldb_module *module,
+				 struct ldb_dn *dn, struct dn_list *list)
 {
-	if (ldb_attr_dn(tree->u.equality.attr) == 0) {
-		list->dn = talloc_array(list, struct ldb_val, 1);
+	struct dn_list head;
+	unsigned int i;
+	int ret;
+
+	ret = ltdb_dn_list_load(module, dn, list);
+	if (ret != LDB_SUCCESS || list->pages == NULL) {
+		return ret;
+	}
+
+	head = *list;
+	list->dn = NULL;
+	list->count = 0;
+	list->pages = NULL;
+
+	for (i=0; i<head.count; i++) {
+		struct dn_list *page;
+
+		/* the page stays around, list points into it */
+		page = talloc_zero(list, struct dn_list);
+		if (page == NULL) {
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		ret = ltdb_dn_list_load_page(module, dn, head.pages[i], page);
+		if (ret != LDB_SUCCESS) {
+			return ret;
+		}
+
+		list->dn = talloc_realloc(list, list->dn, struct ldb_val,
+					  list->count + page->count);
 		if (list->dn == NULL) {
-			ldb_module_oom(module);
 			return LDB_ERR_OPERATIONS_ERROR;
 		}
-		list->dn[0] = tree->u.equality.value;
-		list->count = 1;
-		return LDB_SUCCESS;
+		memcpy(&list->dn[list->count], page->dn,
+		       sizeof(page->dn[0]) * page->count);
+		list->count += page->count;
 	}
-	return ltdb_index_dn_simple(module, tree, index_list, list);
-}
 
+	return LDB_SUCCESS;
+}
 
 /*
-  list intersection
-  list = list & list2
-*/
-static bool list_intersect(struct ldb_context *ldb,
-			   struct dn_list *list, const struct dn_list *list2)
+  insert a copy of v at position idx of a list
+ */
+static int ltdb_dn_list_insert(struct dn_list *list, unsigned int idx,
+			       const struct ldb_val *v)
 {
-	struct dn_list *list3;
-	unsigned int i;
+	unsigned alloc_len;
 
-	if (list->count == 0) {
-		/* 0 & X == 0 */
-		return true;
+	/* overallocate the list a bit, to reduce the number of
+	 * realloc trigered copies */
+	alloc_len = ((list->count+1)+7) & ~7;
+	list->dn = talloc_realloc(list, list->dn, struct ldb_val, alloc_len);
+	if (list->dn == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
 	}
-	if (list2->count == 0) {
-		/* X & 0 == 0 */
-		list->count = 0;
-		list->dn = NULL;
-		return true;
+	memmove(&list->dn[idx+1], &list->dn[idx],
+		sizeof(list->dn[0]) * (list->count - idx));
+	list->dn[idx] = ldb_val_dup(list->dn, v);
+	if (list->dn[idx].data == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
 	}
+	list->count++;
+	return LDB_SUCCESS;
+}
 
-	/* the indexing code is allowed to return a longer list than
-	   what really matches, as all results are filtered by the
-	   full expression at the end - this shortcut avoids a lot of
-	   work in some cases */
-	if (list->count < 2 && list2->count > 10) {
-		return true;
-	}
-	if (list2->count < 2 && list->count > 10) {
-		list->count = list2->count;
-		list->dn = list2->dn;
-		/* note that list2 may not be the parent of list2->dn,
-		   as list2->dn may be owned by ltdb->idxptr. In that
-		   case we expect this reparent call to fail, which is
-		   OK */
-		talloc_reparent(list2, list, list2->dn);
-		return true;
+/*
+  remove entry idx of a list. We never shrink the array, the strings
+  may be referenced from elsewhere
+ */
+static void ltdb_dn_list_remove(struct dn_list *list, unsigned int idx)
+{
+	memmove(&list->dn[idx], &list->dn[idx+1],
+		sizeof(list->dn[0]) * (list->count - (idx+1)));
+	if (list->pages != NULL) {
+		memmove(&list->pages[idx], &list->pages[idx+1],
+			sizeof(list->pages[0]) * (list->count - (idx+1)));
 	}
+	list->count--;
+}
 
-	list3 = talloc_zero(list, struct dn_list);
-	if (list3 == NULL) {
-		return false;
+/*
+  copy count entries of src starting at idx into a new page. The
+  strings are copied as well, so the page doesn't depend on src
+ */
+static struct dn_list *ltdb_dn_list_copy(TALLOC_CTX *mem_ctx,
+					 const struct dn_list *src,
+					 unsigned int idx, unsigned int count)
+{
+	struct dn_list *page;
+	unsigned int i;
+
+	page = talloc_zero(mem_ctx, struct dn_list);
+	if (page == NULL) {
+		return NULL;
+	}
+	page->dn = talloc_array(page, struct ldb_val, count);
+	if (page->dn == NULL) {
+		talloc_free(page);
+		return NULL;
+	}
+	for (i=0; i<count; i++) {
+		page->dn[i] = ldb_val_dup(page->dn, &src->dn[idx+i]);
+		if (page->dn[i].data == NULL) {
+			talloc_free(page);
+			return NULL;
+		}
 	}
+	page->count = count;
+	return page;
+}
 
-	list3->dn = talloc_array(list3, struct ldb_val, list->count);
-	if (!list3->dn) {
-		talloc_free(list3);
-		return false;
+/*
+  turn a single record list that got too long into a paged one
+ */
+static int ltdb_dn_list_paginate(struct ldb_module *module, struct ldb_dn *dn,
+				 struct dn_list *list)
+{
+	struct dn_list *head;
+	unsigned int i, num_pages, per_page = LTDB_INDEX_PAGE_MAX / 2;
+	int ret;
+
+	num_pages = (list->count + per_page - 1) / per_page;
+
+	head = talloc_zero(list, struct dn_list);
+	if (head == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	head->dn = talloc_array(head, struct ldb_val, num_pages);
+	head->pages = talloc_array(head, unsigned int, num_pages);
+	if (head->dn == NULL || head->pages == NULL) {
+		talloc_free(head);
+		return LDB_ERR_OPERATIONS_ERROR;
 	}
-	list3->count = 0;
 
-	for (i=0;i<list->count;i++) {
-		if (ltdb_dn_list_find_val(list2, &list->dn[i]) != -1) {
-			list3->dn[list3->count] = list->dn[i];
-			list3->count++;
+	for (i=0; i<num_pages; i++) {
+		unsigned int idx = i * per_page;
+		struct dn_list *page;
+
+		page = ltdb_dn_list_copy(head, list, idx,
+					 MIN(per_page, list->count - idx));
+		if (page == NULL) {
+			talloc_free(head);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		ret = ltdb_dn_list_store_page(module, dn, i, page);
+		if (ret != LDB_SUCCESS) {
+			talloc_free(head);
+			return ret;
 		}
+		head->dn[i] = ldb_val_dup(head->dn, &list->dn[idx]);
+		if (head->dn[i].data == NULL) {
+			talloc_free(head);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		head->pages[i] = i;
 	}
+	head->count = num_pages;
 
-	list->dn = talloc_steal(list, list3->dn);
-	list->count = list3->count;
-	talloc_free(list3);
-
-	return true;
+	ret = ltdb_dn_list_store(module, dn, head);
+	talloc_free(head);
+	return ret;
 }
 
-
 /*
-  list union
-  list = list | list2
-*/
-static bool list_union(struct ldb_context *ldb,
-		       struct dn_list *list, const struct dn_list *list2)
+  split page p of a paged list in two
+ */
+static int ltdb_dn_list_split(struct ldb_module *module, struct ldb_dn *dn,
+			      struct dn_list *head, unsigned int p,
+			      struct dn_list *page)
 {
-	struct ldb_val *dn3;
+	struct dn_list *page2;
+	unsigned int i, id = 0, half = page->count / 2;
+	int ret;
+
+	for (i=0; i<head->count; i++) {
+		if (head->pages[i] >= id) {
+			id = head->pages[i] + 1;
+		}
+	}
+
+	page2 = ltdb_dn_list_copy(page, page, half, page->count - half);
+	if (page2 == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	page->count = half;
+
+	ret = ltdb_dn_list_insert(head, p + 1, &page2->dn[0]);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+	head->pages = talloc_realloc(head, head->pages, unsigned int,
+				     talloc_array_length(head->dn));
+	if (head->pages == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	memmove(&head->pages[p+2], &head->pages[p+1],
+		sizeof(head->pages[0]) * (head->count - (p+2)));
+	head->pages[p+1] = id;
+
+	ret = ltdb_dn_list_store_page(module, dn, head->pages[p], page);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+	ret = ltdb_dn_list_store_page(module, dn, id, page2);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+	return ltdb_dn_list_store(module, dn, head);
+}
+
+/*
+  add v to the sorted list stored under dn, ordered by a (see
+  ltdb_index_cmp()). *added is false if v was in the list already,
+  *first is true if the list was empty before
+ */
+static int ltdb_index_list_add(struct ldb_module *module, struct ldb_dn *dn,
+			       const struct ldb_schema_attribute *a,
+			       const struct ldb_val *v,
+			       bool *added, bool *first)
+{
+	struct ldb_context *ldb = ldb_module_get_ctx(module);
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	struct dn_list *head, *page;
+	unsigned int p, idx;
+	int ret;
+
+	*added = false;
+	*first = false;
+
+	head = talloc_zero(module, struct dn_list);
+	if (head == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	ret = ltdb_dn_list_load(module, dn, head);
+	if (ret != LDB_SUCCESS && ret != LDB_ERR_NO_SUCH_OBJECT) {
+		talloc_free(head);
+		return ret;
+	}
+	*first = (head->count == 0);
+
+	if (head->pages == NULL) {
+		if (ltdb_dn_list_bsearch(ldb, a, head, v, &idx)) {
+			talloc_free(head);
+			return LDB_SUCCESS;
+		}
+		ret = ltdb_dn_list_insert(head, idx, v);
+		if (ret != LDB_SUCCESS) {
+			talloc_free(head);
+			return ret;
+		}
+		*added = true;
+
+		if (head->count > LTDB_INDEX_PAGE_MAX &&
+		    ltdb->cache->paged_indexes) {
+			ret = ltdb_dn_list_paginate(module, dn, head);
+		} else {
+			ret = ltdb_dn_list_store(module, dn, head);
+		}
+		talloc_free(head);
+		return ret;
+	}
+
+	if (!ltdb_dn_list_page(ldb, a, head, v, &p)) {
+		/* a new first entry */
+		p = 0;
+	}
+
+	page = talloc_zero(head, struct dn_list);
+	if (page == NULL) {
+		talloc_free(head);
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	ret = ltdb_dn_list_load_page(module, dn, head->pages[p], page);
+	if (ret != LDB_SUCCESS) {
+		talloc_free(head);
+		return ret;
+	}
+
+	if (ltdb_dn_list_bsearch(ldb, a, page, v, &idx)) {
+		talloc_free(head);
+		return LDB_SUCCESS;
+	}
+	ret = ltdb_dn_list_insert(page, idx, v);
+	if (ret != LDB_SUCCESS) {
+		talloc_free(head);
+		return ret;
+	}
+	*added = true;
+
+	if (idx == 0) {
+		head->dn[p] = ldb_val_dup(head->dn, v);
+		if (head->dn[p].data == NULL) {
+			talloc_free(head);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+	}
+
+	if (page->count > LTDB_INDEX_PAGE_MAX) {
+		ret = ltdb_dn_list_split(module, dn, head, p, page);
+	} else {
+		ret = ltdb_dn_list_store_page(module, dn, head->pages[p], page);
+		if (ret == LDB_SUCCESS && idx == 0) {
+			ret = ltdb_dn_list_store(module, dn, head);
+		}
+	}
+
+	talloc_free(head);
+	return ret;
+}
+
+/*
+  remove v from the sorted list stored under dn. *removed is false if
+  v was not in the list, *last is true if the list is empty now
+ */
+static int ltdb_index_list_del(struct ldb_module *module, struct ldb_dn *dn,
+			       const struct ldb_schema_attribute *a,
+			       const struct ldb_val *v,
+			       bool *removed, bool *last)
+{
+	struct ldb_context *ldb = ldb_module_get_ctx(module);
+	struct dn_list *head, *page;
+	unsigned int p, idx;
+	int ret;
+
+	*removed = false;
+	*last = false;
+
+	head = talloc_zero(module, struct dn_list);
+	if (head == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	ret = ltdb_dn_list_load(module, dn, head);
+	if (ret == LDB_ERR_NO_SUCH_OBJECT) {
+		/* it wasn't indexed. Did we have an earlier error? If we did then
+		   its gone now */
+		talloc_free(head);
+		return LDB_SUCCESS;
+	}
+	if (ret != LDB_SUCCESS) {
+		talloc_free(head);
+		return ret;
+	}
+
+	if (head->pages == NULL) {
+		if (!ltdb_dn_list_bsearch(ldb, a, head, v, &idx)) {
+			/* nothing to delete */
+			talloc_free(head);
+			return LDB_SUCCESS;
+		}
+		ltdb_dn_list_remove(head, idx);
+		*removed = true;
+		*last = (head->count == 0);
+
+		ret = ltdb_dn_list_store(module, dn, head);
+		talloc_free(head);
+		return ret;
+	}
+
+	if (!ltdb_dn_list_page(ldb, a, head, v, &p)) {
+		talloc_free(head);
+		return LDB_SUCCESS;
+	}
+
+	page = talloc_zero(head, struct dn_list);
+	if (page == NULL) {
+		talloc_free(head);
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	ret = ltdb_dn_list_load_page(module, dn, head->pages[p], page);
+	if (ret != LDB_SUCCESS) {
+		talloc_free(head);
+		return ret;
+	}
+
+	if (!ltdb_dn_list_bsearch(ldb, a, page, v, &idx)) {
+		talloc_free(head);
+		return LDB_SUCCESS;
+	}
+	ltdb_dn_list_remove(page, idx);
+	*removed = true;
+
+	ret = ltdb_dn_list_store_page(module, dn, head->pages[p], page);
+	if (ret != LDB_SUCCESS) {
+		talloc_free(head);
+		return ret;
+	}
+
+	if (page->count == 0) {
+		ltdb_dn_list_remove(head, p);
+		if (head->count == 0) {
+			head->pages = NULL;
+			*last = true;
+		}
+	} else if (idx == 0) {
+		head->dn[p] = ldb_val_dup(head->dn, &page->dn[0]);
+		if (head->dn[p].data == NULL) {
+			talloc_free(head);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+	} else {
+		talloc_free(head);
+		return LDB_SUCCESS;
+	}
+
+	ret = ltdb_dn_list_store(module, dn, head);
+	talloc_free(head);
+	return ret;
+}
+
+/*
+  add a value to or remove it from the @INDEXVALUES directory of
+  its attribute
+ */
+static int ltdb_index_values_update(struct ldb_module *module,
+				    const char *attr,
+				    const struct ldb_val *value, bool add)
+{
+	struct ldb_context *ldb = ldb_module_get_ctx(module);
+	const struct ldb_schema_attribute *a;
+	struct ldb_dn *dn;
+	struct ldb_val v;
+	bool changed, empty;
+	int ret;
+
+	a = ldb_schema_attribute_by_name(ldb, attr);
+	ret = a->syntax->canonicalise_fn(ldb, module, value, &v);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+
+	dn = ltdb_index_values_key(module, ldb, attr);
+	if (dn == NULL) {
+		ret = LDB_ERR_OPERATIONS_ERROR;
+	} else if (add) {
+		ret = ltdb_index_list_add(module, dn, a, &v, &changed, &empty);
+	} else {
+		ret = ltdb_index_list_del(module, dn, a, &v, &changed, &empty);
+	}
+
+	if (v.data != value->data) {
+		talloc_free(v.data);
+	}
+	talloc_free(dn);
+	return ret;
+}
+
+/*
+  the @IDXDN key holding the index entry of a dn in a GUID keyed database
+*/
+static struct ldb_dn *ltdb_index_dn_index_key(struct ldb_context *ldb,
+					      struct ldb_dn *dn)
+{
+	struct ldb_val val;
+
+	val.data = (uint8_t *)((uintptr_t)ldb_dn_get_casefold(dn));
+	if (val.data == NULL) {
+		return NULL;
+	}
+	val.length = strlen((char *)val.data);
+	return ltdb_index_key(ldb, LTDB_IDXDN, &val, NULL);
+}
+
+/*
+  find the index entry for a dn: the dn itself, or in a GUID keyed
+  database the hex GUID found via the DN index
+*/
+static int ltdb_index_dn_entry(struct ldb_module *module, TALLOC_CTX *mem_ctx,
+			       struct ldb_dn *dn, struct ldb_val *entry)
+{
+	struct ldb_context *ldb = ldb_module_get_ctx(module);
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	struct dn_list *list;
+	struct ldb_dn *key;
+	int ret;
+
+	if (ltdb->cache->GUID_index_attribute == NULL) {
+		entry->data = discard_const_p(uint8_t, ldb_dn_get_linearized(dn));
+		if (entry->data == NULL) {
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		entry->length = strlen((char *)entry->data);
+		return LDB_SUCCESS;
+	}
+
+	key = ltdb_index_dn_index_key(ldb, dn);
+	if (key == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	list = talloc_zero(key, struct dn_list);
+	if (list == NULL) {
+		talloc_free(key);
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	ret = ltdb_dn_list_load(module, key, list);
+	if (ret != LDB_SUCCESS && ret != LDB_ERR_NO_SUCH_OBJECT) {
+		talloc_free(key);
+		return ret;
+	}
+	if (list->count == 0) {
+		talloc_free(key);
+		return LDB_ERR_NO_SUCH_OBJECT;
+	}
+	if (list->count != 1) {
+		ldb_asprintf_errstring(ldb, "DN index for %s has %u entries",
+				       ldb_dn_get_linearized(dn), list->count);
+		talloc_free(key);
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	entry->data = talloc_memdup(mem_ctx, list->dn[0].data, list->dn[0].length + 1);
+	talloc_free(key);
+	if (entry->data == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	entry->data[list->dn[0].length] = 0;
+	entry->length = list->dn[0].length;
+	return LDB_SUCCESS;
+}
+
+/*
+  the index entry for a message, see ltdb_index_dn_entry()
+*/
+static int ltdb_index_msg_entry(struct ldb_module *module, TALLOC_CTX *mem_ctx,
+				const struct ldb_message *msg, struct ldb_val *entry)
+{
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+
+	if (ltdb->cache->GUID_index_attribute != NULL) {
+		return ltdb_guid_entry(mem_ctx, module, msg, entry);
+	}
+
+	entry->data = discard_const_p(uint8_t, ldb_dn_get_linearized(msg->dn));
+	if (entry->data == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	entry->length = strlen((char *)entry->data);
+	return LDB_SUCCESS;
+}
+
+/*
+  form the key of the record for a dn in a GUID keyed database
+*/
+int ltdb_index_dn_key(struct ldb_module *module, struct ldb_dn *dn, TDB_DATA *key)
+{
+	struct ldb_val entry;
+	int ret;
+
+	ret = ltdb_index_dn_entry(module, module, dn, &entry);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+
+	*key = ltdb_guid_to_key(module, &entry);
+	talloc_free(entry.data);
+	if (key->dptr == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	return LDB_SUCCESS;
+}
+
+/*
+  in the following logic functions, the return value is treated as
+  follows:
+
+     LDB_SUCCESS: we found some matching index values
+
+     LDB_ERR_NO_SUCH_OBJECT: we know for sure that no object matches
+
+     LDB_ERR_OPERATIONS_ERROR: indexing could not answer the call,
+                               we'll need a full search
+ */
+
+/*
+  return a list of dn's that might match a simple indexed search (an
+  equality search only)
+ */
+static int ltdb_index_dn_simple(struct ldb_module *module,
+				const struct ldb_parse_tree *tree,
+				const struct ldb_message *index_list,
+				struct dn_list *list)
+{
+	struct ldb_context *ldb;
+	struct ldb_dn *dn;
+	int ret;
+
+	ldb = ldb_module_get_ctx(module);
+
+	list->count = 0;
+	list->dn = NULL;
+
+	/* if the attribute isn't in the list of indexed attributes then
+	   this node needs a full search */
+	if (!ltdb_is_indexed(index_list, tree->u.equality.attr)) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	/* the attribute is indexed. Pull the list of DNs that match the 
+	   search criterion */
+	dn = ltdb_index_key(ldb, tree->u.equality.attr, &tree->u.equality.value, NULL);
+	if (!dn) return LDB_ERR_OPERATIONS_ERROR;
+
+	ret = ltdb_dn_list_load_all(module, dn, list);
+	talloc_free(dn);
+	return ret;
+}
+
+
+static bool list_union(struct ldb_context *, struct dn_list *, const struct dn_list *);
+
+/*
+  return a list of dn's that might match a leaf indexed search
+ */
+static int ltdb_index_dn_leaf(struct ldb_module *module,
+			      const struct ldb_parse_tree *tree,
+			      const struct ldb_message *index_list,
+			      struct dn_list *list)
+{
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+
+	if (ldb_attr_dn(tree->u.equality.attr) == 0) {
+		list->dn = talloc_array(list, struct ldb_val, 1);
+		if (list->dn == NULL) {
+			ldb_module_oom(module);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		if (ltdb->cache->GUID_index_attribute != NULL) {
+			struct ldb_dn *dn;
+			int ret;
+
+			dn = ldb_dn_from_ldb_val(list, ldb_module_get_ctx(module),
+						 &tree->u.equality.value);
+			if (dn == NULL || !ldb_dn_validate(dn)) {
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+			ret = ltdb_index_dn_entry(module, list, dn, &list->dn[0]);
+			talloc_free(dn);
+			if (ret != LDB_SUCCESS) {
+				return ret;
+			}
+		} else {
+			list->dn[0] = tree->u.equality.value;
+		}
+		list->count = 1;
+		return LDB_SUCCESS;
+	}
+	return ltdb_index_dn_simple(module, tree, index_list, list);
+}
+
+
+/*
+  list intersection
+  list = list & list2
+*/
+static bool list_intersect(struct ldb_context *ldb,
+			   struct dn_list *list, struct dn_list *list2)
+{
+	struct dn_list *list3;
+	unsigned int i, j;
+
+	if (list->count == 0) {
+		/* 0 & X == 0 */
+		return true;
+	}
+	if (list2->count == 0) {
+		/* X & 0 == 0 */
+		list->count = 0;
+		list->dn = NULL;
+		return true;
+	}
+
+	/* the indexing code is allowed to return a longer list than
+	   what really matches, as all results are filtered by the
+	   full expression at the end - this shortcut avoids a lot of
+	   work in some cases */
+	if (list->count < 2 && list2->count > 10) {
+		return true;
+	}
+	if (list2->count < 2 && list->count > 10) {
+		list->count = list2->count;
+		list->dn = list2->dn;
+		/* note that list2 may not be the parent of list2->dn,
+		   as list2->dn may be owned by ltdb->idxptr. In that
+		   case we expect this reparent call to fail, which is
+		   OK */
+		talloc_reparent(list2, list, list2->dn);
+		return true;
+	}
+
+	list3 = talloc_zero(list, struct dn_list);
+	if (list3 == NULL) {
+		return false;
+	}
+
+	list3->dn = talloc_array(list3, struct ldb_val, list->count);
+	if (!list3->dn) {
+		talloc_free(list3);
+		return false;
+	}
+	list3->count = 0;
+
+	/* index lists are sorted, unions of them may not be */
+	ltdb_dn_list_sort(list);
+	ltdb_dn_list_sort(list2);
+
+	i = j = 0;
+	while (i < list->count && j < list2->count) {
+		int r = dn_list_cmp(&list->dn[i], &list2->dn[j]);
+		if (r < 0) {
+			i++;
+		} else if (r > 0) {
+			j++;
+		} else {
+			list3->dn[list3->count] = list->dn[i];
+			list3->count++;
+			i++;
+			j++;
+		}
+	}
+
+	list->dn = talloc_steal(list, list3->dn);
+	list->count = list3->count;
+	talloc_free(list3);
+
+	return true;
+}
+
+
+/*
+  list union
+  list = list | list2
+*/
+static bool list_union(struct ldb_context *ldb,
+		       struct dn_list *list, const struct dn_list *list2)
+{
+	struct ldb_val *dn3;
+
+	if (list2->count == 0) {
+		/* X | 0 == X */
+		return true;
+	}
+
+	if (list->count == 0) {
+		/* 0 | X == X */
+		list->count = list2->count;
+		list->dn = list2->dn;
+		/* note that list2 may not be the parent of list2->dn,
+		   as list2->dn may be owned by ltdb->idxptr. In that
+		   case we expect this reparent call to fail, which is
+		   OK */
+		talloc_reparent(list2, list, list2->dn);
+		return true;
+	}
+
+	dn3 = talloc_array(list, struct ldb_val, list->count + list2->count);
+	if (!dn3) {
+		ldb_oom(ldb);
+		return false;
+	}
+
+	/* we allow for duplicates here, and get rid of them later */
+	memcpy(dn3, list->dn, sizeof(list->dn[0])*list->count);
+	memcpy(dn3+list->count, list2->dn, sizeof(list2->dn[0])*list2->count);
+
+	list->dn = dn3;
+	list->count += list2->count;
+
+	return true;
+}
+
+/*
+  the head of the index list for an equality test, if it's a paged
+  one, and in *dnp the dn it is stored under. Returns NULL otherwise
+ */
+static struct dn_list *ltdb_index_paged_head(struct ldb_module *module,
+					     TALLOC_CTX *mem_ctx,
+					     const struct ldb_parse_tree *tree,
+					     const struct ldb_message *index_list,
+					     struct ldb_dn **dnp)
+{
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	struct ldb_context *ldb = ldb_module_get_ctx(module);
+	struct dn_list *head;
+	struct ldb_dn *dn;
+	int ret;
+
+	if (!ltdb->cache->paged_indexes ||
+	    tree->operation != LDB_OP_EQUALITY ||
+	    ldb_attr_dn(tree->u.equality.attr) == 0 ||
+	    !ltdb_is_indexed(index_list, tree->u.equality.attr)) {
+		return NULL;
+	}
+
+	dn = ltdb_index_key(ldb, tree->u.equality.attr, &tree->u.equality.value, NULL);
+	if (dn == NULL) {
+		return NULL;
+	}
+
+	head = talloc_zero(mem_ctx, struct dn_list);
+	if (head == NULL) {
+		talloc_free(dn);
+		return NULL;
+	}
+	talloc_steal(head, dn);
+
+	ret = ltdb_dn_list_load(module, dn, head);
+	if (ret != LDB_SUCCESS || head->pages == NULL) {
+		talloc_free(head);
+		return NULL;
+	}
+	*dnp = dn;
+	return head;
+}
+
+/*
+  list = list & the DNs matching an equality test with a paged index
+  list. Rather than loading the whole index list we only look at the
+  pages the DNs in list fall on
+ */
+static int ltdb_index_dn_probe(struct ldb_module *module,
+			       const struct ldb_parse_tree *tree,
+			       const struct ldb_message *index_list,
+			       struct dn_list *list)
+{
+	struct ldb_context *ldb = ldb_module_get_ctx(module);
+	struct dn_list *head, *page = NULL;
+	struct ldb_dn *dn;
+	struct ldb_val *dn2;
+	unsigned int i, count = 0, current = 0;
+
+	head = ltdb_index_paged_head(module, list, tree, index_list, &dn);
+	if (head == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	dn2 = talloc_array(list, struct ldb_val, list->count);
+	if (dn2 == NULL) {
+		talloc_free(head);
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	ltdb_dn_list_sort(list);
+
+	for (i=0; i<list->count; i++) {
+		unsigned int p, idx;
+
+		if (!ltdb_dn_list_page(ldb, NULL, head, &list->dn[i], &p)) {
+			continue;
+		}
+		if (page == NULL || p != current) {
+			int ret;
+
+			talloc_free(page);
+			page = talloc_zero(head, struct dn_list);
+			if (page == NULL) {
+				talloc_free(head);
+				talloc_free(dn2);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+			ret = ltdb_dn_list_load_page(module, dn, head->pages[p], page);
+			if (ret != LDB_SUCCESS) {
+				talloc_free(head);
+				talloc_free(dn2);
+				return ret;
+			}
+			current = p;
+		}
+		if (ltdb_dn_list_bsearch(ldb, NULL, page, &list->dn[i], &idx)) {
+			dn2[count++] = list->dn[i];
+		}
+	}
+
+	talloc_free(head);
+
+	list->dn = dn2;
+	list->count = count;
+	if (count == 0) {
+		return LDB_ERR_NO_SUCH_OBJECT;
+	}
+	return LDB_SUCCESS;
+}
+
+/*
+  return a list of dn's that might match a >= or <= search, by
+  walking the @INDEXVALUES directory of the attribute
+ */
+static int ltdb_index_dn_range(struct ldb_module *module,
+			       const struct ldb_parse_tree *tree,
+			       const struct ldb_message *index_list,
+			       struct dn_list *list)
+{
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	struct ldb_context *ldb = ldb_module_get_ctx(module);
+	const char *attr = tree->u.comparison.attr;
+	const struct ldb_schema_attribute *a;
+	struct dn_list *head, *page;
+	struct ldb_dn *dn;
+	struct ldb_val v;
+	unsigned int p, num_values = 0;
+	int ret;
+
+	list->dn = NULL;
+	list->count = 0;
+
+	if (!ltdb->cache->paged_indexes ||
+	    !ltdb_is_indexed(index_list, attr)) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	a = ldb_schema_attribute_by_name(ldb, attr);
+
+	head = talloc_zero(list, struct dn_list);
+	if (head == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	ret = a->syntax->canonicalise_fn(ldb, head, &tree->u.comparison.value, &v);
+	if (ret != LDB_SUCCESS) {
+		talloc_free(head);
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
 
-	if (list2->count == 0) {
-		/* X | 0 == X */
-		return true;
+	dn = ltdb_index_values_key(head, ldb, attr);
+	if (dn == NULL) {
+		talloc_free(head);
+		return LDB_ERR_OPERATIONS_ERROR;
 	}
 
-	if (list->count == 0) {
-		/* 0 | X == X */
-		list->count = list2->count;
-		list->dn = list2->dn;
-		/* note that list2 may not be the parent of list2->dn,
-		   as list2->dn may be owned by ltdb->idxptr. In that
-		   case we expect this reparent call to fail, which is
-		   OK */
-		talloc_reparent(list2, list, list2->dn);
-		return true;
+	ret = ltdb_dn_list_load(module, dn, head);
+	if (ret != LDB_SUCCESS && ret != LDB_ERR_NO_SUCH_OBJECT) {
+		talloc_free(head);
+		return ret;
 	}
 
-	dn3 = talloc_array(list, struct ldb_val, list->count + list2->count);
-	if (!dn3) {
-		ldb_oom(ldb);
-		return false;
+	p = 0;
+	if (head->pages != NULL && tree->operation == LDB_OP_GREATER) {
+		/* no need to look at the pages before v */
+		if (!ltdb_dn_list_page(ldb, a, head, &v, &p)) {
+			p = 0;
+		}
 	}
 
-	/* we allow for duplicates here, and get rid of them later */
-	memcpy(dn3, list->dn, sizeof(list->dn[0])*list->count);
-	memcpy(dn3+list->count, list2->dn, sizeof(list2->dn[0])*list2->count);
+	for (; head->count > 0 && (head->pages == NULL || p < head->count); p++) {
+		unsigned int i;
+		bool done = false;
 
-	list->dn = dn3;
-	list->count += list2->count;
+		if (head->pages == NULL) {
+			page = head;
+		} else {
+			page = talloc_zero(head, struct dn_list);
+			if (page == NULL) {
+				talloc_free(head);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+			ret = ltdb_dn_list_load_page(module, dn, head->pages[p], page);
+			if (ret != LDB_SUCCESS) {
+				talloc_free(head);
+				return ret;
+			}
+		}
 
-	return true;
+		for (i=0; i<page->count; i++) {
+			int r = ltdb_index_cmp(ldb, a, &page->dn[i], &v);
+			struct dn_list *list2;
+			struct ldb_dn *key;
+
+			if (tree->operation == LDB_OP_GREATER && r < 0) {
+				continue;
+			}
+			if (tree->operation == LDB_OP_LESS && r > 0) {
+				done = true;
+				break;
+			}
+
+			if (++num_values > LTDB_INDEX_RANGE_MAX) {
+				/* a full search is cheaper */
+				talloc_free(head);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+
+			key = ltdb_index_key(ldb, attr, &page->dn[i], NULL);
+			if (key == NULL) {
+				talloc_free(head);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+			list2 = talloc_zero(list, struct dn_list);
+			if (list2 == NULL) {
+				talloc_free(key);
+				talloc_free(head);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+			ret = ltdb_dn_list_load_all(module, key, list2);
+			talloc_free(key);
+			if (ret == LDB_ERR_NO_SUCH_OBJECT) {
+				talloc_free(list2);
+				continue;
+			}
+			if (ret != LDB_SUCCESS || !list_union(ldb, list, list2)) {
+				talloc_free(head);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+		}
+
+		if (done || head->pages == NULL) {
+			break;
+		}
+		talloc_free(page);
+	}
+
+	talloc_free(head);
+
+	if (list->count == 0) {
+		return LDB_ERR_NO_SUCH_OBJECT;
+	}
+	return LDB_SUCCESS;
 }
 
 static int ltdb_index_dn(struct ldb_module *module,
@@ -731,8 +1777,9 @@ static int ltdb_index_dn_and(struct ldb_module *module,
 			     struct dn_list *list)
 {
 	struct ldb_context *ldb;
-	unsigned int i;
-	bool found;
+	const struct ldb_parse_tree **order;
+	unsigned int i, n, num_plain;
+	bool found, *paged;
 
 	ldb = ldb_module_get_ctx(module);
 
@@ -765,14 +1812,61 @@ static int ltdb_index_dn_and(struct ldb_module *module,
 		}
 	}	
 
-	/* now do a full intersection */
-	found = false;
-
+	/* now do a full intersection. Equality tests with a paged
+	   index list go last, so we can just probe them with what we
+	   found so far */
+	order = talloc_array(list, const struct ldb_parse_tree *,
+			     tree->u.list.num_elements);
+	paged = talloc_array(list, bool, tree->u.list.num_elements);
+	if (order == NULL || paged == NULL) {
+		return ldb_module_oom(module);
+	}
+	n = 0;
 	for (i=0; i<tree->u.list.num_elements; i++) {
 		const struct ldb_parse_tree *subtree = tree->u.list.elements[i];
+		struct ldb_dn *dn;
+		struct dn_list *head;
+
+		head = ltdb_index_paged_head(module, list, subtree, index_list, &dn);
+		if (head == NULL) {
+			order[n++] = subtree;
+		}
+		paged[i] = (head != NULL);
+		talloc_free(head);
+	}
+	num_plain = n;
+	for (i=0; i<tree->u.list.num_elements; i++) {
+		if (paged[i]) {
+			order[n++] = tree->u.list.elements[i];
+		}
+	}
+
+	found = false;
+
+	for (i=0; i<n; i++) {
+		const struct ldb_parse_tree *subtree = order[i];
 		struct dn_list *list2;
 		int ret;
 
+		if (found && i >= num_plain) {
+			ret = ltdb_index_dn_probe(module, subtree, index_list, list);
+			if (ret == LDB_ERR_NO_SUCH_OBJECT) {
+				/* X && 0 == 0 */
+				list->dn = NULL;
+				list->count = 0;
+				return LDB_ERR_NO_SUCH_OBJECT;
+			}
+			if (ret != LDB_SUCCESS) {
+				/* this didn't adding anything */
+				continue;
+			}
+			if (list->count < 2) {
+				/* it isn't worth loading the next part of the tree */
+				return LDB_SUCCESS;
+			}
+			continue;
+		}
+
 		list2 = talloc_zero(list, struct dn_list);
 		if (list2 == NULL) {
 			return ldb_module_oom(module);
@@ -846,7 +1940,7 @@ static int ltdb_index_dn_one(struct ldb_module *module,
 		return LDB_ERR_OPERATIONS_ERROR;
 	}
 
-	ret = ltdb_dn_list_load(module, key, list);
+	ret = ltdb_dn_list_load_all(module, key, list);
 	talloc_free(key);
 	if (ret != LDB_SUCCESS) {
 		return ret;
@@ -887,9 +1981,12 @@ static int ltdb_index_dn(struct ldb_module *module,
 		ret = ltdb_index_dn_leaf(module, tree, index_list, list);
 		break;
 
-	case LDB_OP_SUBSTRING:
 	case LDB_OP_GREATER:
 	case LDB_OP_LESS:
+		ret = ltdb_index_dn_range(module, tree, index_list, list);
+		break;
+
+	case LDB_OP_SUBSTRING:
 	case LDB_OP_PRESENT:
 	case LDB_OP_APPROX:
 	case LDB_OP_EXTENDED:
@@ -909,6 +2006,7 @@ static int ltdb_index_filter(const struct dn_list *dn_list,
 			     struct ltdb_context *ac, 
 			     uint32_t *match_count)
 {
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(ac->module), struct ltdb_private);
 	struct ldb_context *ldb;
 	struct ldb_message *msg;
 	unsigned int i;
@@ -925,14 +2023,26 @@ static int ltdb_index_filter(const struct dn_list *dn_list,
 			return LDB_ERR_OPERATIONS_ERROR;
 		}
 
-		dn = ldb_dn_from_ldb_val(msg, ldb, &dn_list->dn[i]);
-		if (dn == NULL) {
-			talloc_free(msg);
-			return LDB_ERR_OPERATIONS_ERROR;
-		}
+		if (ltdb->cache->GUID_index_attribute != NULL) {
+			TDB_DATA key;
 
-		ret = ltdb_search_dn1(ac->module, dn, msg);
-		talloc_free(dn);
+			key = ltdb_guid_to_key(msg, &dn_list->dn[i]);
+			if (key.dptr == NULL) {
+				talloc_free(msg);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+			ret = ltdb_search_key(ac->module, key, msg);
+			talloc_free(key.dptr);
+		} else {
+			dn = ldb_dn_from_ldb_val(msg, ldb, &dn_list->dn[i]);
+			if (dn == NULL) {
+				talloc_free(msg);
+				return LDB_ERR_OPERATIONS_ERROR;
+			}
+
+			ret = ltdb_search_dn1(ac->module, dn, msg);
+			talloc_free(dn);
+		}
 		if (ret == LDB_ERR_NO_SUCH_OBJECT) {
 			/* the record has disappeared? yes, this can happen */
 			talloc_free(msg);
@@ -990,7 +2100,7 @@ static void ltdb_dn_list_remove_duplicates(struct dn_list *list)
 		return;
 	}
 
-	TYPESAFE_QSORT(list->dn, list->count, dn_list_cmp);
+	ltdb_dn_list_sort(list);
 
 	new_count = 1;
 	for (i=1; i<list->count; i++) {
@@ -1036,12 +2146,12 @@ int ltdb_search_indexed(struct ltdb_context *ac, uint32_t *match_count)
 			talloc_free(dn_list);
 			return ldb_module_oom(ac->module);
 		}
-		dn_list->dn[0].data = discard_const_p(unsigned char, ldb_dn_get_linearized(ac->base));
-		if (dn_list->dn[0].data == NULL) {
+		ret = ltdb_index_dn_entry(ac->module, dn_list, ac->base,
+					  &dn_list->dn[0]);
+		if (ret != LDB_SUCCESS) {
 			talloc_free(dn_list);
-			return ldb_module_oom(ac->module);
+			return ret;
 		}
-		dn_list->dn[0].length = strlen((char *)dn_list->dn[0].data);
 		dn_list->count = 1;
 		break;		
 
@@ -1080,64 +2190,61 @@ int ltdb_search_indexed(struct ltdb_context *ac, uint32_t *match_count)
 /*
   add an index entry for one message element
 */
-static int ltdb_index_add1(struct ldb_module *module, const char *dn,
+static int ltdb_index_add1(struct ldb_module *module, const struct ldb_val *entry,
 			   struct ldb_message_element *el, int v_idx)
 {
 	struct ldb_context *ldb;
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
 	struct ldb_dn *dn_key;
 	int ret;
 	const struct ldb_schema_attribute *a;
-	struct dn_list *list;
-	unsigned alloc_len;
+	struct ldb_val v;
+	bool added, first;
 
 	ldb = ldb_module_get_ctx(module);
 
-	list = talloc_zero(module, struct dn_list);
-	if (list == NULL) {
-		return LDB_ERR_OPERATIONS_ERROR;
-	}
-
 	dn_key = ltdb_index_key(ldb, el->name, &el->values[v_idx], &a);
 	if (!dn_key) {
-		talloc_free(list);
 		return LDB_ERR_OPERATIONS_ERROR;
 	}
-	talloc_steal(list, dn_key);
 
-	ret = ltdb_dn_list_load(module, dn_key, list);
-	if (ret != LDB_SUCCESS && ret != LDB_ERR_NO_SUCH_OBJECT) {
-		talloc_free(list);
-		return ret;
-	}
+	v = *entry;
 
-	if (ltdb_dn_list_find_str(list, dn) != -1) {
-		talloc_free(list);
-		return LDB_SUCCESS;
-	}
+	/* a dn maps to exactly one record */
+	if ((a->flags & LDB_ATTR_FLAG_UNIQUE_INDEX) ||
+	    ldb_attr_cmp(el->name, LTDB_IDXDN) == 0) {
+		struct dn_list *list;
+		unsigned int idx;
 
-	if (list->count > 0 &&
-	    a->flags & LDB_ATTR_FLAG_UNIQUE_INDEX) {
+		list = talloc_zero(dn_key, struct dn_list);
+		if (list == NULL) {
+			talloc_free(dn_key);
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		ret = ltdb_dn_list_load(module, dn_key, list);
+		if (ret != LDB_SUCCESS && ret != LDB_ERR_NO_SUCH_OBJECT) {
+			talloc_free(dn_key);
+			return ret;
+		}
+		if (list->count > 0 &&
+		    (list->pages != NULL ||
+		     !ltdb_dn_list_bsearch(ldb, NULL, list, &v, &idx))) {
+			talloc_free(dn_key);
+			ldb_asprintf_errstring(ldb, __location__ ": unique index violation on %s in %.*s",
+					       el->name, (int)entry->length, (const char *)entry->data);
+			return LDB_ERR_ENTRY_ALREADY_EXISTS;
+		}
 		talloc_free(list);
-		ldb_asprintf_errstring(ldb, __location__ ": unique index violation on %s in %s",
-				       el->name, dn);
-		return LDB_ERR_ENTRY_ALREADY_EXISTS;		
 	}
 
-	/* overallocate the list a bit, to reduce the number of
-	 * realloc trigered copies */	 
-	alloc_len = ((list->count+1)+7) & ~7;
-	list->dn = talloc_realloc(list, list->dn, struct ldb_val, alloc_len);
-	if (list->dn == NULL) {
-		talloc_free(list);
-		return LDB_ERR_OPERATIONS_ERROR;
+	ret = ltdb_index_list_add(module, dn_key, NULL, &v, &added, &first);
+	if (ret == LDB_SUCCESS && first && ltdb->cache->paged_indexes &&
+	    el->name[0] != '@') {
+		ret = ltdb_index_values_update(module, el->name,
+					       &el->values[v_idx], true);
 	}
-	list->dn[list->count].data = (uint8_t *)talloc_strdup(list->dn, dn);
-	list->dn[list->count].length = strlen(dn);
-	list->count++;
-
-	ret = ltdb_dn_list_store(module, dn_key, list);
 
-	talloc_free(list);
+	talloc_free(dn_key);
 
 	return ret;
 }
@@ -1145,12 +2252,12 @@ static int ltdb_index_add1(struct ldb_module *module, const char *dn,
 /*
   add index entries for one elements in a message
  */
-static int ltdb_index_add_el(struct ldb_module *module, const char *dn,
+static int ltdb_index_add_el(struct ldb_module *module, const struct ldb_val *entry,
 			     struct ldb_message_element *el)
 {
 	unsigned int i;
 	for (i = 0; i < el->num_values; i++) {
-		int ret = ltdb_index_add1(module, dn, el, i);
+		int ret = ltdb_index_add1(module, entry, el, i);
 		if (ret != LDB_SUCCESS) {
 			return ret;
 		}
@@ -1162,32 +2269,30 @@ static int ltdb_index_add_el(struct ldb_module *module, const char *dn,
 /*
   add index entries for all elements in a message
  */
-static int ltdb_index_add_all(struct ldb_module *module, const char *dn,
-			      struct ldb_message_element *elements, int num_el)
+static int ltdb_index_add_all(struct ldb_module *module, const struct ldb_val *entry,
+			      const struct ldb_message *msg)
 {
 	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	struct ldb_message_element *elements = msg->elements;
 	unsigned int i;
 
-	if (dn[0] == '@') {
-		return LDB_SUCCESS;
-	}
-
 	if (ltdb->cache->indexlist->num_elements == 0) {
 		/* no indexed fields */
 		return LDB_SUCCESS;
 	}
 
-	for (i = 0; i < num_el; i++) {
+	for (i = 0; i < msg->num_elements; i++) {
 		int ret;
 		if (!ltdb_is_indexed(ltdb->cache->indexlist, elements[i].name)) {
 			continue;
 		}
-		ret = ltdb_index_add_el(module, dn, &elements[i]);
+		ret = ltdb_index_add_el(module, entry, &elements[i]);
 		if (ret != LDB_SUCCESS) {
 			struct ldb_context *ldb = ldb_module_get_ctx(module);
 			ldb_asprintf_errstring(ldb,
 					       __location__ ": Failed to re-index %s in %s - %s",
-					       elements[i].name, dn, ldb_errstring(ldb));
+					       elements[i].name, ldb_dn_get_linearized(msg->dn),
+					       ldb_errstring(ldb));
 			return ret;
 		}
 	}
@@ -1196,18 +2301,45 @@ static int ltdb_index_add_all(struct ldb_module *module, const char *dn,
 }
 
 
+static int ltdb_index_del_value1(struct ldb_module *module,
+				 const struct ldb_val *entry,
+				 struct ldb_message_element *el,
+				 unsigned int v_idx);
+
 /*
-  insert a one level index for a message
+  insert or remove the one level index and, in a GUID keyed database,
+  the DN index entry for a message
 */
-static int ltdb_index_onelevel(struct ldb_module *module, const struct ldb_message *msg, int add)
+static int ltdb_index_dn_update1(struct ldb_module *module,
+				 const struct ldb_message *msg,
+				 const struct ldb_val *entry, bool add)
 {
 	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
 	struct ldb_message_element el;
 	struct ldb_val val;
 	struct ldb_dn *pdn;
-	const char *dn;
 	int ret;
 
+	if (ltdb->cache->GUID_index_attribute != NULL) {
+		val.data = (uint8_t *)((uintptr_t)ldb_dn_get_casefold(msg->dn));
+		if (val.data == NULL) {
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+		val.length = strlen((char *)val.data);
+		el.name = LTDB_IDXDN;
+		el.values = &val;
+		el.num_values = 1;
+
+		if (add) {
+			ret = ltdb_index_add1(module, entry, &el, 0);
+		} else {
+			ret = ltdb_index_del_value1(module, entry, &el, 0);
+		}
+		if (ret != LDB_SUCCESS) {
+			return ret;
+		}
+	}
+
 	/* We index for ONE Level only if requested */
 	if (!ltdb->cache->one_level_indexes) {
 		return LDB_SUCCESS;
@@ -1218,12 +2350,6 @@ static int ltdb_index_onelevel(struct ldb_module *module, const struct ldb_messa
 		return LDB_ERR_OPERATIONS_ERROR;
 	}
 
-	dn = ldb_dn_get_linearized(msg->dn);
-	if (dn == NULL) {
-		talloc_free(pdn);
-		return LDB_ERR_OPERATIONS_ERROR;
-	}
-
 	val.data = (uint8_t *)((uintptr_t)ldb_dn_get_casefold(pdn));
 	if (val.data == NULL) {
 		talloc_free(pdn);
@@ -1236,9 +2362,9 @@ static int ltdb_index_onelevel(struct ldb_module *module, const struct ldb_messa
 	el.num_values = 1;
 
 	if (add) {
-		ret = ltdb_index_add1(module, dn, &el, 0);
+		ret = ltdb_index_add1(module, entry, &el, 0);
 	} else { /* delete */
-		ret = ltdb_index_del_value(module, msg->dn, &el, 0);
+		ret = ltdb_index_del_value1(module, entry, &el, 0);
 	}
 
 	talloc_free(pdn);
@@ -1246,6 +2372,35 @@ static int ltdb_index_onelevel(struct ldb_module *module, const struct ldb_messa
 	return ret;
 }
 
+/*
+  update the indexes that depend on the dn of a record, used directly
+  when renaming within a GUID keyed database
+*/
+int ltdb_index_dn_update(struct ldb_module *module,
+			 const struct ldb_message *msg, bool add)
+{
+	TALLOC_CTX *tmp_ctx;
+	struct ldb_val entry;
+	int ret;
+
+	if (ldb_dn_is_special(msg->dn)) {
+		return LDB_SUCCESS;
+	}
+
+	tmp_ctx = talloc_new(module);
+	if (tmp_ctx == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	ret = ltdb_index_msg_entry(module, tmp_ctx, msg, &entry);
+	if (ret == LDB_SUCCESS) {
+		ret = ltdb_index_dn_update1(module, msg, &entry, add);
+	}
+
+	talloc_free(tmp_ctx);
+	return ret;
+}
+
 /*
   add the index entries for a new element in a record
   The caller guarantees that these element values are not yet indexed
@@ -1254,13 +2409,21 @@ int ltdb_index_add_element(struct ldb_module *module, struct ldb_dn *dn,
 			   struct ldb_message_element *el)
 {
 	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	struct ldb_val entry;
+	int ret;
+
 	if (ldb_dn_is_special(dn)) {
 		return LDB_SUCCESS;
 	}
 	if (!ltdb_is_indexed(ltdb->cache->indexlist, el->name)) {
 		return LDB_SUCCESS;
 	}
-	return ltdb_index_add_el(module, ldb_dn_get_linearized(dn), el);
+
+	ret = ltdb_index_dn_entry(module, el, dn, &entry);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+	return ltdb_index_add_el(module, &entry, el);
 }
 
 /*
@@ -1268,94 +2431,109 @@ int ltdb_index_add_element(struct ldb_module *module, struct ldb_dn *dn,
 */
 int ltdb_index_add_new(struct ldb_module *module, const struct ldb_message *msg)
 {
-	const char *dn;
+	TALLOC_CTX *tmp_ctx;
+	struct ldb_val entry;
 	int ret;
 
 	if (ldb_dn_is_special(msg->dn)) {
 		return LDB_SUCCESS;
 	}
 
-	dn = ldb_dn_get_linearized(msg->dn);
-	if (dn == NULL) {
+	tmp_ctx = talloc_new(module);
+	if (tmp_ctx == NULL) {
 		return LDB_ERR_OPERATIONS_ERROR;
 	}
 
-	ret = ltdb_index_add_all(module, dn, msg->elements, msg->num_elements);
+	ret = ltdb_index_msg_entry(module, tmp_ctx, msg, &entry);
 	if (ret != LDB_SUCCESS) {
+		talloc_free(tmp_ctx);
 		return ret;
 	}
 
-	return ltdb_index_onelevel(module, msg, 1);
+	/* the DN index goes first, catching a duplicate dn before
+	   anything else is touched */
+	ret = ltdb_index_dn_update1(module, msg, &entry, true);
+	if (ret == LDB_SUCCESS) {
+		ret = ltdb_index_add_all(module, &entry, msg);
+	}
+
+	talloc_free(tmp_ctx);
+	return ret;
 }
 
 
 /*
   delete an index entry for one message element
 */
-int ltdb_index_del_value(struct ldb_module *module, struct ldb_dn *dn,
-			 struct ldb_message_element *el, unsigned int v_idx)
+static int ltdb_index_del_value1(struct ldb_module *module,
+				 const struct ldb_val *entry,
+				 struct ldb_message_element *el,
+				 unsigned int v_idx)
 {
 	struct ldb_context *ldb;
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
 	struct ldb_dn *dn_key;
-	const char *dn_str;
-	int ret, i;
-	unsigned int j;
-	struct dn_list *list;
+	bool removed, last;
+	int ret;
 
 	ldb = ldb_module_get_ctx(module);
 
-	dn_str = ldb_dn_get_linearized(dn);
-	if (dn_str == NULL) {
+	dn_key = ltdb_index_key(ldb, el->name, &el->values[v_idx], NULL);
+	if (!dn_key) {
 		return LDB_ERR_OPERATIONS_ERROR;
 	}
 
-	if (dn_str[0] == '@') {
-		return LDB_SUCCESS;
+	ret = ltdb_index_list_del(module, dn_key, NULL, entry, &removed, &last);
+	if (ret == LDB_SUCCESS && last && ltdb->cache->paged_indexes &&
+	    el->name[0] != '@') {
+		ret = ltdb_index_values_update(module, el->name,
+					       &el->values[v_idx], false);
 	}
 
-	dn_key = ltdb_index_key(ldb, el->name, &el->values[v_idx], NULL);
-	if (!dn_key) {
-		return LDB_ERR_OPERATIONS_ERROR;
-	}
+	talloc_free(dn_key);
 
-	list = talloc_zero(dn_key, struct dn_list);
-	if (list == NULL) {
-		talloc_free(dn_key);
-		return LDB_ERR_OPERATIONS_ERROR;
+	return ret;
+}
+
+/*
+  delete the index entries for all values of an element
+*/
+static int ltdb_index_del_el(struct ldb_module *module,
+			     const struct ldb_val *entry,
+			     struct ldb_message_element *el)
+{
+	unsigned int i;
+	int ret;
+
+	for (i = 0; i < el->num_values; i++) {
+		ret = ltdb_index_del_value1(module, entry, el, i);
+		if (ret != LDB_SUCCESS) {
+			return ret;
+		}
 	}
 
-	ret = ltdb_dn_list_load(module, dn_key, list);
-	if (ret == LDB_ERR_NO_SUCH_OBJECT) {
-		/* it wasn't indexed. Did we have an earlier error? If we did then
-		   its gone now */
-		talloc_free(dn_key);
+	return LDB_SUCCESS;
+}
+
+/*
+  delete an index entry for one message element
+*/
+int ltdb_index_del_value(struct ldb_module *module, struct ldb_dn *dn,
+			 struct ldb_message_element *el, unsigned int v_idx)
+{
+	struct ldb_val entry;
+	int ret;
+
+	if (ldb_dn_is_special(dn)) {
 		return LDB_SUCCESS;
 	}
 
+	ret = ltdb_index_dn_entry(module, el, dn, &entry);
 	if (ret != LDB_SUCCESS) {
-		talloc_free(dn_key);
 		return ret;
 	}
 
-	i = ltdb_dn_list_find_str(list, dn_str);
-	if (i == -1) {
-		/* nothing to delete */
-		talloc_free(dn_key);
-		return LDB_SUCCESS;		
-	}
-
-	j = (unsigned int) i;
-	if (j != list->count - 1) {
-		memmove(&list->dn[j], &list->dn[j+1], sizeof(list->dn[0])*(list->count - (j+1)));
-	}
-	list->count--;
-	list->dn = talloc_realloc(list, list->dn, struct ldb_val, list->count);
-
-	ret = ltdb_dn_list_store(module, dn_key, list);
-
-	talloc_free(dn_key);
-
-	return ret;
+	return ltdb_index_del_value1(module, &entry, el, v_idx);
 }
 
 /*
@@ -1366,35 +2544,28 @@ int ltdb_index_del_element(struct ldb_module *module, struct ldb_dn *dn,
 			   struct ldb_message_element *el)
 {
 	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
-	const char *dn_str;
+	struct ldb_val entry;
 	int ret;
-	unsigned int i;
 
 	if (!ltdb->cache->attribute_indexes) {
 		/* no indexed fields */
 		return LDB_SUCCESS;
 	}
 
-	dn_str = ldb_dn_get_linearized(dn);
-	if (dn_str == NULL) {
-		return LDB_ERR_OPERATIONS_ERROR;
-	}
-
-	if (dn_str[0] == '@') {
+	if (ldb_dn_is_special(dn)) {
 		return LDB_SUCCESS;
 	}
 
 	if (!ltdb_is_indexed(ltdb->cache->indexlist, el->name)) {
 		return LDB_SUCCESS;
 	}
-	for (i = 0; i < el->num_values; i++) {
-		ret = ltdb_index_del_value(module, dn, el, i);
-		if (ret != LDB_SUCCESS) {
-			return ret;
-		}
+
+	ret = ltdb_index_dn_entry(module, el, dn, &entry);
+	if (ret != LDB_SUCCESS) {
+		return ret;
 	}
 
-	return LDB_SUCCESS;
+	return ltdb_index_del_el(module, &entry, el);
 }
 
 /*
@@ -1404,6 +2575,8 @@ int ltdb_index_del_element(struct ldb_module *module, struct ldb_dn *dn,
 int ltdb_index_delete(struct ldb_module *module, const struct ldb_message *msg)
 {
 	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	TALLOC_CTX *tmp_ctx;
+	struct ldb_val entry;
 	int ret;
 	unsigned int i;
 
@@ -1411,47 +2584,64 @@ int ltdb_index_delete(struct ldb_module *module, const struct ldb_message *msg)
 		return LDB_SUCCESS;
 	}
 
-	ret = ltdb_index_onelevel(module, msg, 0);
+	tmp_ctx = talloc_new(module);
+	if (tmp_ctx == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+
+	ret = ltdb_index_msg_entry(module, tmp_ctx, msg, &entry);
 	if (ret != LDB_SUCCESS) {
+		talloc_free(tmp_ctx);
 		return ret;
 	}
 
-	if (!ltdb->cache->attribute_indexes) {
-		/* no indexed fields */
-		return LDB_SUCCESS;
+	ret = ltdb_index_dn_update1(module, msg, &entry, false);
+	if (ret != LDB_SUCCESS || !ltdb->cache->attribute_indexes) {
+		talloc_free(tmp_ctx);
+		return ret;
 	}
 
 	for (i = 0; i < msg->num_elements; i++) {
-		ret = ltdb_index_del_element(module, msg->dn, &msg->elements[i]);
+		if (!ltdb_is_indexed(ltdb->cache->indexlist, msg->elements[i].name)) {
+			continue;
+		}
+		ret = ltdb_index_del_el(module, &entry, &msg->elements[i]);
 		if (ret != LDB_SUCCESS) {
-			return ret;
+			break;
 		}
 	}
 
-	return LDB_SUCCESS;
+	talloc_free(tmp_ctx);
+	return ret;
 }
 
 
 /*
-  traversal function that deletes all @INDEX records
+  traversal function that deletes all @INDEX, @INDEXPAGE and
+  @INDEXVALUES records
 */
 static int delete_index(struct tdb_context *tdb, TDB_DATA key, TDB_DATA data, void *state)
 {
 	struct ldb_module *module = state;
 	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
 	const char *dnstr = "DN=" LTDB_INDEX ":";
+	const char *pagestr = "DN=" LTDB_INDEXPAGE ":";
+	const char *valuesstr = "DN=" LTDB_INDEXVALUES ":";
 	struct dn_list list;
 	struct ldb_dn *dn;
 	struct ldb_val v;
 	int ret;
 
-	if (strncmp((char *)key.dptr, dnstr, strlen(dnstr)) != 0) {
+	if (strncmp((char *)key.dptr, dnstr, strlen(dnstr)) != 0 &&
+	    strncmp((char *)key.dptr, pagestr, strlen(pagestr)) != 0 &&
+	    strncmp((char *)key.dptr, valuesstr, strlen(valuesstr)) != 0) {
 		return 0;
 	}
 	/* we need to put a empty list in the internal tdb for this
 	 * index entry */
 	list.dn = NULL;
 	list.count = 0;
+	list.pages = NULL;
 
 	/* the offset of 3 is to remove the DN= prefix. */
 	v.data = key.dptr + 3;
@@ -1484,14 +2674,15 @@ static int re_index(struct tdb_context *tdb, TDB_DATA key, TDB_DATA data, void *
 	struct ltdb_reindex_context *ctx = (struct ltdb_reindex_context *)state;
 	struct ldb_module *module = ctx->module;
 	struct ldb_message *msg;
-	const char *dn = NULL;
+	struct ldb_val entry;
 	int ret;
 	TDB_DATA key2;
 
 	ldb = ldb_module_get_ctx(module);
 
 	if (strncmp((char *)key.dptr, "DN=@", 4) == 0 ||
-	    strncmp((char *)key.dptr, "DN=", 3) != 0) {
+	    (strncmp((char *)key.dptr, "DN=", 3) != 0 &&
+	     strncmp((char *)key.dptr, "GUID=", 5) != 0)) {
 		return 0;
 	}
 
@@ -1501,16 +2692,26 @@ static int re_index(struct tdb_context *tdb, TDB_DATA key, TDB_DATA data, void *
 	}
 
 	ret = ltdb_unpack_data(module, &data, msg);
-	if (ret != 0) {
+	if (ret != 0 || msg->dn == NULL) {
 		ldb_debug(ldb, LDB_DEBUG_ERROR, "Invalid data for index %s\n",
-						ldb_dn_get_linearized(msg->dn));
+						(char *)key.dptr);
+		talloc_free(msg);
+		return -1;
+	}
+
+	/* in a GUID keyed database a record without a GUID can't be
+	   stored or indexed */
+	ret = ltdb_index_msg_entry(module, msg, msg, &entry);
+	if (ret != LDB_SUCCESS) {
+		ctx->error = ret;
 		talloc_free(msg);
 		return -1;
 	}
 
-	/* check if the DN key has changed, perhaps due to the
-	   case insensitivity of an element changing */
-	key2 = ltdb_key(module, msg->dn);
+	/* check if the key has changed, perhaps due to the case
+	   insensitivity of an element changing, or because the
+	   database has been switched to or from GUID keys */
+	key2 = ltdb_key_msg(module, msg);
 	if (key2.dptr == NULL) {
 		/* probably a corrupt record ... darn */
 		ldb_debug(ldb, LDB_DEBUG_ERROR, "Invalid DN in re_index: %s",
@@ -1524,22 +2725,17 @@ static int re_index(struct tdb_context *tdb, TDB_DATA key, TDB_DATA data, void *
 	}
 	talloc_free(key2.dptr);
 
-	if (msg->dn == NULL) {
-		dn = (char *)key.dptr + 3;
-	} else {
-		dn = ldb_dn_get_linearized(msg->dn);
-	}
-
-	ret = ltdb_index_onelevel(module, msg, 1);
+	ret = ltdb_index_dn_update1(module, msg, &entry, true);
 	if (ret != LDB_SUCCESS) {
 		ldb_debug(ldb, LDB_DEBUG_ERROR,
 			  "Adding special ONE LEVEL index failed (%s)!",
 						ldb_dn_get_linearized(msg->dn));
+		ctx->error = ret;
 		talloc_free(msg);
 		return -1;
 	}
 
-	ret = ltdb_index_add_all(module, dn, msg->elements, msg->num_elements);
+	ret = ltdb_index_add_all(module, &entry, msg);
 
 	if (ret != LDB_SUCCESS) {
 		ctx->error = ret;
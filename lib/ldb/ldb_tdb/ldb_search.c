@@ -213,15 +213,16 @@ static int ltdb_search_base(struct ldb_module *module, struct ldb_dn *dn)
 	void *data = ldb_module_get_private(module);
 	struct ltdb_private *ltdb = talloc_get_type(data, struct ltdb_private);
 	TDB_DATA tdb_key, tdb_data;
+	int ret;
 
 	if (ldb_dn_is_null(dn)) {
 		return LDB_ERR_NO_SUCH_OBJECT;
 	}
 
 	/* form the key */
-	tdb_key = ltdb_key(module, dn);
-	if (!tdb_key.dptr) {
-		return LDB_ERR_OPERATIONS_ERROR;
+	ret = ltdb_key_dn(module, dn, &tdb_key);
+	if (ret != LDB_SUCCESS) {
+		return ret;
 	}
 
 	tdb_data = tdb_fetch_compat(ltdb->tdb, tdb_key);
@@ -235,29 +236,22 @@ static int ltdb_search_base(struct ldb_module *module, struct ldb_dn *dn)
 }
 
 /*
-  search the database for a single simple dn, returning all attributes
-  in a single message
+  fetch the record stored under a key, returning all attributes in
+  a single message
 
   return LDB_ERR_NO_SUCH_OBJECT on record-not-found
   and LDB_SUCCESS on success
 */
-int ltdb_search_dn1(struct ldb_module *module, struct ldb_dn *dn, struct ldb_message *msg)
+int ltdb_search_key(struct ldb_module *module, TDB_DATA tdb_key, struct ldb_message *msg)
 {
 	void *data = ldb_module_get_private(module);
 	struct ltdb_private *ltdb = talloc_get_type(data, struct ltdb_private);
 	int ret;
-	TDB_DATA tdb_key, tdb_data;
+	TDB_DATA tdb_data;
 
 	memset(msg, 0, sizeof(*msg));
 
-	/* form the key */
-	tdb_key = ltdb_key(module, dn);
-	if (!tdb_key.dptr) {
-		return LDB_ERR_OPERATIONS_ERROR;
-	}
-
 	tdb_data = tdb_fetch_compat(ltdb->tdb, tdb_key);
-	talloc_free(tdb_key.dptr);
 	if (!tdb_data.dptr) {
 		return LDB_ERR_NO_SUCH_OBJECT;
 	}
@@ -274,6 +268,35 @@ int ltdb_search_dn1(struct ldb_module *module, struct ldb_dn *dn, struct ldb_mes
 		return LDB_ERR_OPERATIONS_ERROR;		
 	}
 
+	return LDB_SUCCESS;
+}
+
+/*
+  search the database for a single simple dn, returning all attributes
+  in a single message
+
+  return LDB_ERR_NO_SUCH_OBJECT on record-not-found
+  and LDB_SUCCESS on success
+*/
+int ltdb_search_dn1(struct ldb_module *module, struct ldb_dn *dn, struct ldb_message *msg)
+{
+	int ret;
+	TDB_DATA tdb_key;
+
+	memset(msg, 0, sizeof(*msg));
+
+	/* form the key */
+	ret = ltdb_key_dn(module, dn, &tdb_key);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+
+	ret = ltdb_search_key(module, tdb_key, msg);
+	talloc_free(tdb_key.dptr);
+	if (ret != LDB_SUCCESS) {
+		return ret;
+	}
+
 	if (!msg->dn) {
 		msg->dn = ldb_dn_copy(msg, dn);
 	}
@@ -408,7 +431,8 @@ static int search_func(struct tdb_context *tdb, TDB_DATA key, TDB_DATA data, voi
 	ldb = ldb_module_get_ctx(ac->module);
 
 	if (key.dsize < 4 || 
-	    strncmp((char *)key.dptr, "DN=", 3) != 0) {
+	    (strncmp((char *)key.dptr, "DN=", 3) != 0 &&
+	     strncmp((char *)key.dptr, "GUID=", 5) != 0)) {
 		return 0;
 	}
 
@@ -424,7 +448,7 @@ static int search_func(struct tdb_context *tdb, TDB_DATA key, TDB_DATA data, voi
 		return -1;
 	}
 
-	if (!msg->dn) {
+	if (!msg->dn && strncmp((char *)key.dptr, "DN=", 3) == 0) {
 		msg->dn = ldb_dn_new(msg, ldb,
 				     (char *)key.dptr + 3);
 		if (msg->dn == NULL) {
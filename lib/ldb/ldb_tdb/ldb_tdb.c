@@ -182,6 +182,122 @@ failed:
 	return key;
 }
 
+/*
+  the value index lists hold for a record in a GUID keyed database:
+  the hex encoded GUID attribute
+*/
+int ltdb_guid_entry(TALLOC_CTX *mem_ctx, struct ldb_module *module,
+		    const struct ldb_message *msg, struct ldb_val *entry)
+{
+	static const char hexchars[] = "0123456789ABCDEF";
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+	const struct ldb_message_element *el;
+	char *hex;
+	size_t i;
+
+	el = ldb_msg_find_element(msg, ltdb->cache->GUID_index_attribute);
+	if (el == NULL || el->num_values != 1 || el->values[0].length == 0) {
+		ldb_asprintf_errstring(ldb_module_get_ctx(module),
+				       "Entry %s needs a single valued %s "
+				       "in a GUID keyed database",
+				       ldb_dn_get_linearized(msg->dn),
+				       ltdb->cache->GUID_index_attribute);
+		return LDB_ERR_UNWILLING_TO_PERFORM;
+	}
+
+	hex = talloc_array(mem_ctx, char, el->values[0].length * 2 + 1);
+	if (hex == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	for (i=0; i<el->values[0].length; i++) {
+		hex[i*2] = hexchars[el->values[0].data[i] >> 4];
+		hex[i*2+1] = hexchars[el->values[0].data[i] & 0xF];
+	}
+	hex[i*2] = 0;
+
+	entry->data = (uint8_t *)hex;
+	entry->length = i*2;
+	return LDB_SUCCESS;
+}
+
+/*
+  form the key of a record in a GUID keyed database from its index
+  entry (see ltdb_guid_entry())
+*/
+TDB_DATA ltdb_guid_to_key(TALLOC_CTX *mem_ctx, const struct ldb_val *guid)
+{
+	TDB_DATA key;
+	char *key_str;
+
+	key_str = talloc_asprintf(mem_ctx, "GUID=%.*s",
+				  (int)guid->length, (const char *)guid->data);
+	if (key_str == NULL) {
+		errno = ENOMEM;
+		key.dptr = NULL;
+		key.dsize = 0;
+		return key;
+	}
+
+	key.dptr = (uint8_t *)key_str;
+	key.dsize = strlen(key_str) + 1;
+	return key;
+}
+
+static bool ltdb_guid_keyed(struct ldb_module *module, struct ldb_dn *dn)
+{
+	struct ltdb_private *ltdb = talloc_get_type(ldb_module_get_private(module), struct ltdb_private);
+
+	return !ldb_dn_is_special(dn) &&
+		ltdb->cache != NULL &&
+		ltdb->cache->GUID_index_attribute != NULL;
+}
+
+/*
+  form the key for the record stored for a dn. Unlike ltdb_key() this
+  also works for GUID keyed databases, where it has to look at the
+  DN index. Returns LDB_ERR_NO_SUCH_OBJECT if there is no such
+  record.
+
+  caller frees
+*/
+int ltdb_key_dn(struct ldb_module *module, struct ldb_dn *dn, TDB_DATA *key)
+{
+	if (ltdb_guid_keyed(module, dn)) {
+		return ltdb_index_dn_key(module, dn, key);
+	}
+
+	*key = ltdb_key(module, dn);
+	if (key->dptr == NULL) {
+		return LDB_ERR_OPERATIONS_ERROR;
+	}
+	return LDB_SUCCESS;
+}
+
+/*
+  form the key a message is to be stored under
+
+  caller frees
+*/
+TDB_DATA ltdb_key_msg(struct ldb_module *module, const struct ldb_message *msg)
+{
+	TDB_DATA key;
+	struct ldb_val entry;
+
+	if (!ltdb_guid_keyed(module, msg->dn)) {
+		return ltdb_key(module, msg->dn);
+	}
+
+	if (ltdb_guid_entry(module, module, msg, &entry) != LDB_SUCCESS) {
+		key.dptr = NULL;
+		key.dsize = 0;
+		return key;
+	}
+
+	key = ltdb_guid_to_key(module, &entry);
+	talloc_free(entry.data);
+	return key;
+}
+
 /*
   check special dn's have valid attributes
   currently only @ATTRIBUTES is checked
@@ -263,7 +379,7 @@ int ltdb_store(struct ldb_module *module, const struct ldb_message *msg, int flg
 	TDB_DATA tdb_key, tdb_data;
 	int ret = LDB_SUCCESS;
 
-	tdb_key = ltdb_key(module, msg->dn);
+	tdb_key = ltdb_key_msg(module, msg);
 	if (tdb_key.dptr == NULL) {
 		return LDB_ERR_OTHER;
 	}
@@ -342,6 +458,31 @@ static int ltdb_add_internal(struct ldb_module *module,
 		}
 	}
 
+	if (ltdb_guid_keyed(module, msg->dn)) {
+		struct ldb_val entry;
+		TDB_DATA tdb_key;
+
+		/* the record key won't tell us about an existing
+		   record with the same DN */
+		ret = ltdb_key_dn(module, msg->dn, &tdb_key);
+		if (ret == LDB_SUCCESS) {
+			talloc_free(tdb_key.dptr);
+			ldb_asprintf_errstring(ldb,
+					       "Entry %s already exists",
+					       ldb_dn_get_linearized(msg->dn));
+			return LDB_ERR_ENTRY_ALREADY_EXISTS;
+		}
+		if (ret != LDB_ERR_NO_SUCH_OBJECT) {
+			return ret;
+		}
+
+		ret = ltdb_guid_entry(module, module, msg, &entry);
+		if (ret != LDB_SUCCESS) {
+			return ret;
+		}
+		talloc_free(entry.data);
+	}
+
 	ret = ltdb_store(module, msg, TDB_INSERT);
 	if (ret != LDB_SUCCESS) {
 		if (ret == LDB_ERR_ENTRY_ALREADY_EXISTS) {
@@ -398,9 +539,9 @@ int ltdb_delete_noindex(struct ldb_module *module, struct ldb_dn *dn)
 	TDB_DATA tdb_key;
 	int ret;
 
-	tdb_key = ltdb_key(module, dn);
-	if (!tdb_key.dptr) {
-		return LDB_ERR_OTHER;
+	ret = ltdb_key_dn(module, dn, &tdb_key);
+	if (ret != LDB_SUCCESS) {
+		return ret;
 	}
 
 	ret = tdb_delete(ltdb->tdb, tdb_key);
@@ -663,9 +804,9 @@ int ltdb_modify_internal(struct ldb_module *module,
 					LDB_CONTROL_PERMISSIVE_MODIFY_OID);
 	}
 
-	tdb_key = ltdb_key(module, msg->dn);
-	if (!tdb_key.dptr) {
-		return LDB_ERR_OTHER;
+	ret = ltdb_key_dn(module, msg->dn, &tdb_key);
+	if (ret != LDB_SUCCESS) {
+		return ret;
 	}
 
 	tdb_data = tdb_fetch_compat(ltdb->tdb, tdb_key);
@@ -924,6 +1065,28 @@ int ltdb_modify_internal(struct ldb_module *module,
 		}
 	}
 
+	if (ltdb_guid_keyed(module, msg2->dn)) {
+		TDB_DATA tdb_key2;
+
+		/* the record is stored under its GUID */
+		tdb_key2 = ltdb_key_msg(module, msg2);
+		if (tdb_key2.dptr == NULL) {
+			ret = LDB_ERR_UNWILLING_TO_PERFORM;
+			goto done;
+		}
+		if (tdb_key2.dsize != tdb_key.dsize ||
+		    memcmp(tdb_key2.dptr, tdb_key.dptr, tdb_key.dsize) != 0) {
+			talloc_free(tdb_key2.dptr);
+			ldb_asprintf_errstring(ldb,
+					       "%s of '%s' can't be modified in a GUID keyed database",
+					       ltdb->cache->GUID_index_attribute,
+					       ldb_dn_get_linearized(msg->dn));
+			ret = LDB_ERR_UNWILLING_TO_PERFORM;
+			goto done;
+		}
+		talloc_free(tdb_key2.dptr);
+	}
+
 	ret = ltdb_store(module, msg2, TDB_MODIFY);
 	if (ret != LDB_SUCCESS) {
 		goto done;
@@ -993,6 +1156,50 @@ static int ltdb_rename(struct ltdb_context *ctx)
 		return ret;
 	}
 
+	if (ltdb_guid_keyed(module, msg->dn) &&
+	    ltdb_guid_keyed(module, req->op.rename.newdn)) {
+		/* the record stays under its GUID and the attribute
+		   indexes point at that, so only the DN indexes need
+		   to change */
+		TDB_DATA tdb_key;
+
+		if (ldb_dn_compare(msg->dn, req->op.rename.newdn) != 0) {
+			ret = ltdb_key_dn(module, req->op.rename.newdn, &tdb_key);
+			if (ret == LDB_SUCCESS) {
+				talloc_free(tdb_key.dptr);
+				ldb_asprintf_errstring(ldb_module_get_ctx(module),
+						       "Entry %s already exists",
+						       ldb_dn_get_linearized(req->op.rename.newdn));
+				return LDB_ERR_ENTRY_ALREADY_EXISTS;
+			}
+			if (ret != LDB_ERR_NO_SUCH_OBJECT) {
+				return ret;
+			}
+		}
+
+		ret = ltdb_index_dn_update(module, msg, false);
+		if (ret != LDB_SUCCESS) {
+			return ret;
+		}
+
+		msg->dn = ldb_dn_copy(msg, req->op.rename.newdn);
+		if (msg->dn == NULL) {
+			return LDB_ERR_OPERATIONS_ERROR;
+		}
+
+		ret = ltdb_index_dn_update(module, msg, true);
+		if (ret != LDB_SUCCESS) {
+			return ret;
+		}
+
+		ret = ltdb_store(module, msg, TDB_MODIFY);
+		if (ret != LDB_SUCCESS) {
+			return ret;
+		}
+
+		return ltdb_modified(module, msg->dn);
+	}
+
 	/* Always delete first then add, to avoid conflicts with
 	 * unique indexes. We rely on the transaction to make this
 	 * atomic
@@ -1476,6 +1683,13 @@ static int ltdb_connect(struct ldb_context *ldb, const char *url,
 		tdb_flags |= TDB_NOMMAP;
 	}
 
+#ifdef TDB_GROUP_COMMIT
+	/* and group commit, ldb only writes in transactions */
+	if (flags & LDB_FLG_GROUP_COMMIT) {
+		tdb_flags |= TDB_GROUP_COMMIT;
+	}
+#endif
+
 	if (flags & LDB_FLG_RDONLY) {
 		open_flags = O_RDONLY;
 	} else {
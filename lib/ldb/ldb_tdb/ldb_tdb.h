@@ -21,6 +21,10 @@ struct ltdb_private {
 		struct ldb_message *attributes;
 		bool one_level_indexes;
 		bool attribute_indexes;
+		bool paged_indexes;
+		/* records are keyed by this attribute rather than
+		   by DN, see ltdb_key_msg() */
+		const char *GUID_index_attribute;
 	} *cache;
 
 	int in_transaction;
@@ -50,11 +54,18 @@ struct ltdb_context {
 
 /* special record types */
 #define LTDB_INDEX      "@INDEX"
+#define LTDB_INDEXPAGE  "@INDEXPAGE"
+#define LTDB_INDEXVALUES "@INDEXVALUES"
 #define LTDB_INDEXLIST  "@INDEXLIST"
 #define LTDB_IDX        "@IDX"
 #define LTDB_IDXVERSION "@IDXVERSION"
+#define LTDB_IDXPAGE    "@IDXPAGE"
+#define LTDB_IDXPAGEID  "@IDXPAGEID"
 #define LTDB_IDXATTR    "@IDXATTR"
 #define LTDB_IDXONE     "@IDXONE"
+#define LTDB_IDXPAGED   "@IDXPAGED"
+#define LTDB_IDXGUID    "@IDXGUID"
+#define LTDB_IDXDN      "@IDXDN"
 #define LTDB_BASEINFO   "@BASEINFO"
 #define LTDB_OPTIONS    "@OPTIONS"
 #define LTDB_ATTRIBUTES "@ATTRIBUTES"
@@ -85,6 +96,10 @@ int ltdb_index_add_element(struct ldb_module *module, struct ldb_dn *dn,
 			   struct ldb_message_element *el);
 int ltdb_index_del_value(struct ldb_module *module, struct ldb_dn *dn,
 			 struct ldb_message_element *el, unsigned int v_idx);
+int ltdb_index_dn_update(struct ldb_module *module,
+			 const struct ldb_message *msg, bool add);
+int ltdb_index_dn_key(struct ldb_module *module, struct ldb_dn *dn,
+		      TDB_DATA *key);
 int ltdb_reindex(struct ldb_module *module);
 int ltdb_index_transaction_start(struct ldb_module *module);
 int ltdb_index_transaction_commit(struct ldb_module *module);
@@ -107,6 +122,7 @@ int ltdb_has_wildcard(struct ldb_module *module, const char *attr_name,
 		      const struct ldb_val *val);
 void ltdb_search_dn1_free(struct ldb_module *module, struct ldb_message *msg);
 int ltdb_search_dn1(struct ldb_module *module, struct ldb_dn *dn, struct ldb_message *msg);
+int ltdb_search_key(struct ldb_module *module, TDB_DATA tdb_key, struct ldb_message *msg);
 int ltdb_add_attr_results(struct ldb_module *module,
  			  TALLOC_CTX *mem_ctx, 
 			  struct ldb_message *msg,
@@ -120,6 +136,11 @@ int ltdb_search(struct ltdb_context *ctx);
 int ltdb_lock_read(struct ldb_module *module);
 int ltdb_unlock_read(struct ldb_module *module);
 TDB_DATA ltdb_key(struct ldb_module *module, struct ldb_dn *dn);
+int ltdb_key_dn(struct ldb_module *module, struct ldb_dn *dn, TDB_DATA *key);
+TDB_DATA ltdb_key_msg(struct ldb_module *module, const struct ldb_message *msg);
+TDB_DATA ltdb_guid_to_key(TALLOC_CTX *mem_ctx, const struct ldb_val *guid);
+int ltdb_guid_entry(TALLOC_CTX *mem_ctx, struct ldb_module *module,
+		    const struct ldb_message *msg, struct ldb_val *entry);
 int ltdb_store(struct ldb_module *module, const struct ldb_message *msg, int flgs);
 int ltdb_modify_internal(struct ldb_module *module, const struct ldb_message *msg, struct ldb_request *req);
 int ltdb_delete_noindex(struct ldb_module *module, struct ldb_dn *dn);
@@ -3373,6 +3373,7 @@ void initldb(void)
 	PyModule_AddObject(m, "FLG_NOSYNC", PyInt_FromLong(LDB_FLG_NOSYNC));
 	PyModule_AddObject(m, "FLG_RECONNECT", PyInt_FromLong(LDB_FLG_RECONNECT));
 	PyModule_AddObject(m, "FLG_NOMMAP", PyInt_FromLong(LDB_FLG_NOMMAP));
+	PyModule_AddObject(m, "FLG_GROUP_COMMIT", PyInt_FromLong(LDB_FLG_GROUP_COMMIT));
 
 	PyModule_AddObject(m, "__docformat__", PyString_FromString("restructuredText"));
 
@@ -0,0 +1,123 @@
+#!/bin/sh
+
+echo "Running paged index tests"
+
+rm -f $LDB_URL*
+
+checkcount() {
+    count=$1
+    expression="$2"
+    n=`$VALGRIND ldbsearch$EXEEXT "$expression" | grep '^dn' | wc -l`
+    if [ $n != $count ]; then
+	echo "Got $n but expected $count for $expression"
+	exit 1
+    fi
+    echo "OK: $count $expression"
+}
+
+# like checkcount, but also fail if the search did not use the index
+checkindexed() {
+    checkcount $1 "$2"
+    full=`LDB_WARN_UNINDEXED=1 $VALGRIND ldbsearch$EXEEXT "$2" 2>&1 >/dev/null | grep 'FULL SEARCH'`
+    if [ -n "$full" ]; then
+	echo "$2 did not use the index"
+	exit 1
+    fi
+}
+
+checkunindexed() {
+    full=`LDB_WARN_UNINDEXED=1 $VALGRIND ldbsearch$EXEEXT "$1" 2>&1 >/dev/null | grep 'FULL SEARCH'`
+    if [ -z "$full" ]; then
+	echo "$1 unexpectedly used the index"
+	exit 1
+    fi
+    echo "OK: full search for $1"
+}
+
+checkpaged() {
+    base="$1"
+    n=`$VALGRIND ldbsearch$EXEEXT -s base -b "$base" | grep '^@IDXPAGE:' | wc -l`
+    if [ $n = 0 ]; then
+	echo "$base is not paged"
+	$VALGRIND ldbsearch$EXEEXT -s base -b "$base" | head -20
+	exit 1
+    fi
+    echo "OK: $base has $n pages"
+}
+
+cat <<EOF | $VALGRIND ldbadd$EXEEXT || exit 1
+dn: @ATTRIBUTES
+num: INTEGER
+
+dn: @INDEXLIST
+@IDXATTR: objectClass
+@IDXATTR: num
+@IDXATTR: grp
+@IDXPAGED: 1
+EOF
+
+echo "Adding 3000 records"
+awk 'BEGIN { for (i = 0; i < 3000; i++) {
+	printf "dn: cn=u%d,cn=paged\nobjectClass: pagedclass\n", i;
+	printf "cn: u%d\nnum: %d\ngrp: g%d\n\n", i, i, i % 3 } }' < /dev/null |
+	$VALGRIND ldbadd$EXEEXT > /dev/null || exit 1
+
+checkpaged '@INDEX:OBJECTCLASS:PAGEDCLASS'
+checkpaged '@INDEXVALUES:NUM'
+
+# cn is not indexed yet, make sure a full search is noticed
+checkunindexed '(&(cn>=u2990)(cn<=u2999))'
+
+checkcount 3000 '(objectClass=pagedclass)'
+checkcount 1000 '(grp=g1)'
+checkcount 1000 '(&(objectClass=pagedclass)(grp=g1))'
+checkcount 1 '(&(objectClass=pagedclass)(num=42))'
+checkcount 0 '(&(objectClass=pagedclass)(num=3000))'
+checkindexed 10 '(num>=2990)'
+checkindexed 10 '(num<=9)'
+checkindexed 100 '(&(num>=100)(num<=199))'
+checkindexed 33 '(&(grp=g0)(num>=2900))'
+checkindexed 0 '(num>=3000)'
+checkindexed 0 '(num<=-1)'
+
+echo "Splitting a page"
+awk 'BEGIN { for (i = 0; i < 1100; i++) {
+	printf "dn: cn=u1x%d,cn=paged\nobjectClass: pagedclass\n", i;
+	printf "cn: u1x%d\ngrp: g1\n\n", i } }' < /dev/null |
+	$VALGRIND ldbadd$EXEEXT > /dev/null || exit 1
+
+checkcount 4100 '(objectClass=pagedclass)'
+checkcount 2100 '(&(objectClass=pagedclass)(grp=g1))'
+checkcount 1 '(&(objectClass=pagedclass)(cn=u1x1099))'
+
+dns=`awk 'BEGIN { for (i = 0; i < 1100; i++) printf "cn=u1x%d,cn=paged ", i }' < /dev/null`
+$VALGRIND ldbdel$EXEEXT $dns > /dev/null || exit 1
+unset dns
+checkcount 3000 '(objectClass=pagedclass)'
+
+echo "Deleting every other record"
+dns=`awk 'BEGIN { for (i = 0; i < 3000; i += 2) printf "cn=u%d,cn=paged ", i }' < /dev/null`
+$VALGRIND ldbdel$EXEEXT $dns > /dev/null || exit 1
+unset dns
+
+checkcount 1500 '(objectClass=pagedclass)'
+checkcount 500 '(&(objectClass=pagedclass)(grp=g1))'
+checkcount 0 '(&(objectClass=pagedclass)(num=42))'
+checkcount 1 '(&(objectClass=pagedclass)(num=43))'
+checkindexed 5 '(num>=2990)'
+checkindexed 50 '(&(num>=100)(num<=199))'
+
+echo "Reindexing"
+cat <<EOF | $VALGRIND ldbmodify$EXEEXT || exit 1
+dn: @INDEXLIST
+changetype: modify
+add: @IDXATTR
+@IDXATTR: cn
+EOF
+
+checkcount 1500 '(objectClass=pagedclass)'
+checkcount 500 '(&(objectClass=pagedclass)(grp=g1))'
+checkindexed 1 '(&(objectClass=pagedclass)(cn=u43))'
+checkindexed 5 '(&(cn>=u2990)(cn<=u2999))'
+checkindexed 5 '(num<=9)'
+checkindexed 50 '(&(num>=100)(num<=199))'
@@ -0,0 +1,149 @@
+#!/bin/sh
+
+echo "Running GUID keyed database tests"
+
+rm -f $LDB_URL*
+
+checkcount() {
+    count=$1
+    shift
+    n=`$VALGRIND ldbsearch$EXEEXT "$@" | grep '^dn' | wc -l`
+    if [ $n != $count ]; then
+	echo "Got $n but expected $count for $*"
+	exit 1
+    fi
+    echo "OK: $count $*"
+}
+
+checkkeys() {
+    count=$1
+    n=`$VALGRIND tdbdump$EXEEXT $LDB_URL | grep '^key(.*) = "GUID=' | wc -l`
+    if [ $n != $count ]; then
+	echo "Got $n but expected $count GUID keyed records"
+	exit 1
+    fi
+    echo "OK: $count GUID keyed records"
+}
+
+cat <<EOF | $VALGRIND ldbadd$EXEEXT || exit 1
+dn: @INDEXLIST
+@IDXATTR: cn
+@IDXATTR: objectClass
+@IDXONE: 1
+@IDXGUID: objectGUID
+EOF
+
+cat <<EOF | $VALGRIND ldbadd$EXEEXT || exit 1
+dn: ou=top
+objectClass: container
+objectGUID: guid-top
+
+dn: ou=a,ou=top
+objectClass: container
+objectGUID: guid-a
+
+dn: ou=b,ou=top
+objectClass: container
+objectGUID: guid-b
+
+dn: cn=one,ou=a,ou=top
+objectClass: person
+objectGUID: guid-one
+cn: one
+
+dn: cn=two,ou=a,ou=top
+objectClass: person
+objectGUID: guid-two
+cn: two
+EOF
+
+checkkeys 5
+checkcount 1 -s base -b 'cn=one,ou=a,ou=top'
+checkcount 1 -s base -b 'CN=ONE,OU=A,OU=TOP'
+checkcount 0 -s base -b 'cn=three,ou=a,ou=top'
+checkcount 2 -s one -b 'ou=a,ou=top'
+checkcount 2 -s one -b 'ou=top'
+checkcount 2 '(objectClass=person)'
+checkcount 1 '(cn=two)'
+checkcount 1 '(dn=cn=two,ou=a,ou=top)'
+checkcount 0 '(dn=cn=three,ou=a,ou=top)'
+
+echo "Adding a duplicate DN"
+cat <<EOF | $VALGRIND ldbadd$EXEEXT > /dev/null 2>&1 && exit 1
+dn: cn=one,ou=a,ou=top
+objectClass: person
+objectGUID: guid-other
+cn: one
+EOF
+
+echo "Adding an entry without a GUID"
+cat <<EOF | $VALGRIND ldbadd$EXEEXT > /dev/null 2>&1 && exit 1
+dn: cn=noguid,ou=a,ou=top
+objectClass: person
+cn: noguid
+EOF
+checkkeys 5
+
+echo "Modifying an entry"
+cat <<EOF | $VALGRIND ldbmodify$EXEEXT || exit 1
+dn: cn=one,ou=a,ou=top
+changetype: modify
+add: cn
+cn: uno
+EOF
+checkcount 1 '(cn=uno)'
+checkcount 1 '(cn=one)'
+
+cat <<EOF | $VALGRIND ldbmodify$EXEEXT > /dev/null 2>&1 && exit 1
+dn: cn=one,ou=a,ou=top
+changetype: modify
+replace: objectGUID
+objectGUID: guid-changed
+EOF
+
+echo "Renaming an entry"
+$VALGRIND ldbrename$EXEEXT 'cn=one,ou=a,ou=top' 'cn=one,ou=b,ou=top' || exit 1
+checkkeys 5
+checkcount 0 -s base -b 'cn=one,ou=a,ou=top'
+checkcount 1 -s base -b 'cn=one,ou=b,ou=top'
+checkcount 1 -s one -b 'ou=a,ou=top'
+checkcount 1 -s one -b 'ou=b,ou=top'
+checkcount 1 -s one -b 'ou=b,ou=top' '(cn=uno)'
+$VALGRIND ldbrename$EXEEXT 'cn=one,ou=b,ou=top' 'cn=two,ou=a,ou=top' > /dev/null 2>&1 && exit 1
+$VALGRIND ldbrename$EXEEXT 'cn=one,ou=b,ou=top' 'CN=One,ou=b,ou=top' || exit 1
+checkcount 1 -s base -b 'cn=one,ou=b,ou=top'
+
+echo "Deleting an entry"
+$VALGRIND ldbdel$EXEEXT 'cn=two,ou=a,ou=top' || exit 1
+checkkeys 4
+checkcount 0 -s one -b 'ou=a,ou=top'
+checkcount 0 '(cn=two)'
+checkcount 1 '(objectClass=person)'
+
+echo "Switching an existing database to GUID keys"
+rm -f $LDB_URL*
+
+cat <<EOF | $VALGRIND ldbadd$EXEEXT || exit 1
+dn: @INDEXLIST
+@IDXATTR: cn
+@IDXONE: 1
+
+dn: ou=top
+objectGUID: guid-top
+
+dn: cn=one,ou=top
+objectGUID: guid-one
+cn: one
+EOF
+checkkeys 0
+
+cat <<EOF | $VALGRIND ldbmodify$EXEEXT || exit 1
+dn: @INDEXLIST
+changetype: modify
+add: @IDXGUID
+@IDXGUID: objectGUID
+EOF
+checkkeys 2
+checkcount 1 -s base -b 'cn=one,ou=top'
+checkcount 1 -s one -b 'ou=top'
+checkcount 1 '(cn=one)'
@@ -30,4 +30,8 @@ $VALGRIND ldbadd$EXEEXT $LDBDIR/tests/init.ldif || exit 1
 
 . $LDBDIR/tests/test-tdb-features.sh
 
+. $LDBDIR/tests/test-index-paged.sh
+
+. $LDBDIR/tests/test-tdb-guid.sh
+
 . $LDBDIR/tests/test-controls.sh
@@ -39,7 +39,16 @@ static bool tdb_check_header(struct tdb_context *tdb, tdb_off_t *recovery)
 	if (hdr.version != TDB_VERSION)
 		goto corrupt;
 
-	if (hdr.rwlocks != 0 && hdr.rwlocks != TDB_HASH_RWLOCK_MAGIC)
+	if (hdr.rwlocks != 0 && hdr.rwlocks != TDB_HASH_RWLOCK_MAGIC &&
+	    hdr.rwlocks != TDB_FEATURE_FLAG_MAGIC)
+		goto corrupt;
+
+	if (hdr.rwlocks == TDB_FEATURE_FLAG_MAGIC &&
+	    (hdr.feature_flags != tdb->header.feature_flags ||
+	     hdr.seqlock_start != tdb->header.seqlock_start ||
+	     hdr.seqlock_count != tdb->header.seqlock_count ||
+	     hdr.mutex_start != tdb->header.mutex_start ||
+	     hdr.mutex_size != tdb->header.mutex_size))
 		goto corrupt;
 
 	tdb_header_hash(tdb, &h1, &h2);
@@ -66,6 +75,33 @@ corrupt:
 	return false;
 }
 
+/* Feature areas sit behind the hash table at fixed offsets. */
+static bool tdb_check_feature_record(struct tdb_context *tdb,
+				     tdb_off_t off,
+				     const struct tdb_record *rec,
+				     uint32_t feature,
+				     tdb_off_t start, tdb_len_t len)
+{
+	tdb_off_t expect = TDB_DATA_START(tdb->header.hash_size);
+
+	if (feature == TDB_FEATURE_FLAG_MUTEX && tdb_have_seqlock(tdb)) {
+		expect = tdb_feature_area_end(
+			tdb->header.seqlock_start,
+			tdb_seqlock_size(tdb->header.seqlock_count));
+	}
+
+	if (!TDB_HAVE_FEATURE(tdb, feature) || off != expect ||
+	    start < off + sizeof(*rec) ||
+	    off + sizeof(*rec) + rec->rec_len
+	    != tdb_feature_area_end(start, len)) {
+		TDB_LOG((tdb, TDB_DEBUG_ERROR,
+			 "Unexpected feature record 0x%x at offset %d\n",
+			 rec->magic, off));
+		return false;
+	}
+	return true;
+}
+
 /* Generic record header check. */
 static bool tdb_check_record(struct tdb_context *tdb,
 			     tdb_off_t off,
@@ -328,9 +364,10 @@ _PUBLIC_ int tdb_check(struct tdb_context *tdb,
 {
 	unsigned int h;
 	unsigned char **hashes;
-	tdb_off_t off, recovery_start;
+	tdb_off_t off, recovery_start, table;
+	uint32_t buckets;
 	struct tdb_record rec;
-	bool found_recovery = false;
+	bool found_recovery = false, found_table = false;
 	tdb_len_t dead;
 	bool locked;
 
@@ -381,6 +418,20 @@ _PUBLIC_ int tdb_check(struct tdb_context *tdb,
 			record_offset(hashes[h], off);
 	}
 
+	/* Grown buckets are accounted to the chain lock covering them,
+	   the original heads are empty then. */
+	if (tdb_hash_buckets(tdb, &table, &buckets) == -1)
+		goto free;
+	if (table != FREELIST_TOP + sizeof(tdb_off_t)) {
+		for (h = 0; h < buckets; h++) {
+			if (tdb_ofs_read(tdb, table + h*sizeof(tdb_off_t),
+					 &off) == -1)
+				goto free;
+			if (off)
+				record_offset(hashes[BUCKET(h)+1], off);
+		}
+	}
+
 	/* For each record, read it in and check it's ok. */
 	for (off = TDB_DATA_START(tdb->header.hash_size);
 	     off < tdb->map_size;
@@ -415,6 +466,36 @@ _PUBLIC_ int tdb_check(struct tdb_context *tdb,
 				 off, off + dead, tdb->map_size));
 			rec.rec_len = dead - sizeof(rec);
 			break;
+		case TDB_SEQLOCK_MAGIC:
+			if (!tdb_check_feature_record(
+				    tdb, off, &rec, TDB_FEATURE_FLAG_SEQLOCK,
+				    tdb->header.seqlock_start,
+				    tdb_seqlock_size(tdb->header.seqlock_count)))
+				goto free;
+			if (!tdb_check_record(tdb, off, &rec))
+				goto free;
+			break;
+		case TDB_MUTEX_MAGIC:
+			if (!tdb_check_feature_record(
+				    tdb, off, &rec, TDB_FEATURE_FLAG_MUTEX,
+				    tdb->header.mutex_start,
+				    tdb->header.mutex_size))
+				goto free;
+			if (!tdb_check_record(tdb, off, &rec))
+				goto free;
+			break;
+		case TDB_HASHTABLE_MAGIC:
+			if (off + sizeof(rec) != table ||
+			    rec.data_len != buckets * sizeof(tdb_off_t)) {
+				TDB_LOG((tdb, TDB_DEBUG_ERROR,
+					 "Unexpected hash table at offset %d\n",
+					 off));
+				goto free;
+			}
+			if (!tdb_check_record(tdb, off, &rec))
+				goto free;
+			found_table = true;
+			break;
 		case TDB_RECOVERY_MAGIC:
 			if (recovery_start != off) {
 				TDB_LOG((tdb, TDB_DEBUG_ERROR,
@@ -448,6 +529,13 @@ _PUBLIC_ int tdb_check(struct tdb_context *tdb,
 		}
 	}
 
+	/* We must have found the grown buckets if there are some. */
+	if (table != FREELIST_TOP + sizeof(tdb_off_t) && !found_table) {
+		TDB_LOG((tdb, TDB_DEBUG_ERROR,
+			 "Expected a hash table at %u\n", table));
+		goto free;
+	}
+
 	/* We must have found recovery area if there was one. */
 	if (recovery_start != 0 && !found_recovery) {
 		TDB_LOG((tdb, TDB_DEBUG_ERROR,
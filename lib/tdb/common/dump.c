@@ -61,14 +61,19 @@ static tdb_off_t tdb_dump_record(struct tdb_context *tdb, int hash,
 static int tdb_dump_chain(struct tdb_context *tdb, int i)
 {
 	tdb_off_t rec_ptr, top;
+	int list = (i == -1) ? -1 : (int)BUCKET(i);
 
-	top = TDB_HASH_TOP(i);
-
-	if (tdb_lock(tdb, i, F_WRLCK) != 0)
+	if (tdb_lock(tdb, list, F_WRLCK) != 0)
 		return -1;
 
+	if (i == -1) {
+		top = TDB_HASH_TOP(i);
+	} else if (tdb_hash_top(tdb, i, &top) == -1) {
+		return tdb_unlock(tdb, list, F_WRLCK);
+	}
+
 	if (tdb_ofs_read(tdb, top, &rec_ptr) == -1)
-		return tdb_unlock(tdb, i, F_WRLCK);
+		return tdb_unlock(tdb, list, F_WRLCK);
 
 	if (rec_ptr)
 		printf("hash=%d\n", i);
@@ -77,13 +82,19 @@ static int tdb_dump_chain(struct tdb_context *tdb, int i)
 		rec_ptr = tdb_dump_record(tdb, i, rec_ptr);
 	}
 
-	return tdb_unlock(tdb, i, F_WRLCK);
+	return tdb_unlock(tdb, list, F_WRLCK);
 }
 
 _PUBLIC_ void tdb_dump_all(struct tdb_context *tdb)
 {
+	tdb_off_t table;
+	uint32_t count;
 	int i;
-	for (i=0;i<tdb->header.hash_size;i++) {
+
+	if (tdb_hash_buckets(tdb, &table, &count) == -1) {
+		return;
+	}
+	for (i=0;i<count;i++) {
 		tdb_dump_chain(tdb, i);
 	}
 	printf("freelist:\n");
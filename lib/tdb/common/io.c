@@ -186,16 +186,23 @@ static int tdb_read(struct tdb_context *tdb, tdb_off_t off, void *buf,
 static void tdb_next_hash_chain(struct tdb_context *tdb, uint32_t *chain)
 {
 	uint32_t h = *chain;
-	if (tdb->map_ptr) {
-		for (;h < tdb->header.hash_size;h++) {
-			if (0 != *(uint32_t *)(TDB_HASH_TOP(h) + (unsigned char *)tdb->map_ptr)) {
+	tdb_off_t table;
+	uint32_t count;
+
+	if (tdb_hash_buckets(tdb, &table, &count) != 0) {
+		/* let the caller look at it */
+		return;
+	}
+	if (tdb->map_ptr && table + count * sizeof(tdb_off_t) <= tdb->map_size) {
+		for (;h < count;h++) {
+			if (0 != *(uint32_t *)(table + h * sizeof(tdb_off_t) + (unsigned char *)tdb->map_ptr)) {
 				break;
 			}
 		}
 	} else {
 		uint32_t off=0;
-		for (;h < tdb->header.hash_size;h++) {
-			if (tdb_ofs_read(tdb, TDB_HASH_TOP(h), &off) != 0 || off != 0) {
+		for (;h < count;h++) {
+			if (tdb_ofs_read(tdb, table + h * sizeof(tdb_off_t), &off) != 0 || off != 0) {
 				break;
 			}
 		}
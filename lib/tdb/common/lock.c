@@ -36,6 +36,11 @@ static int fcntl_lock(struct tdb_context *tdb,
 		      int rw, off_t off, off_t len, bool waitflag)
 {
 	struct flock fl;
+	int ret;
+
+	if (tdb_mutex_lock(tdb, rw, off, len, waitflag, &ret)) {
+		return ret;
+	}
 
 	fl.l_type = rw;
 	fl.l_whence = SEEK_SET;
@@ -52,6 +57,7 @@ static int fcntl_lock(struct tdb_context *tdb,
 static int fcntl_unlock(struct tdb_context *tdb, int rw, off_t off, off_t len)
 {
 	struct flock fl;
+	int ret;
 #if 0 /* Check they matched up locks and unlocks correctly. */
 	char line[80];
 	FILE *locks;
@@ -110,6 +116,10 @@ static int fcntl_unlock(struct tdb_context *tdb, int rw, off_t off, off_t len)
 	fclose(locks);
 #endif
 
+	if (tdb_mutex_unlock(tdb, rw, off, len, &ret)) {
+		return ret;
+	}
+
 	fl.l_type = F_UNLCK;
 	fl.l_whence = SEEK_SET;
 	fl.l_start = off;
@@ -125,6 +135,16 @@ static tdb_off_t lock_offset(int list)
 	return FREELIST_TOP + 4*list;
 }
 
+/* the hash chain locked by offset, -1 if it's no chain lock */
+static int lock_list(struct tdb_context *tdb, tdb_off_t offset)
+{
+	if (offset < lock_offset(0) ||
+	    offset >= lock_offset(tdb->header.hash_size)) {
+		return -1;
+	}
+	return (offset - lock_offset(0)) / 4;
+}
+
 /* a byte range locking function - return 0 on success
    this functions locks/unlocks 1 byte at the specified offset.
 
@@ -224,8 +244,12 @@ int tdb_allrecord_upgrade(struct tdb_context *tdb)
 		struct timeval tv;
 		if (tdb_brlock(tdb, F_WRLCK, FREELIST_TOP, 0,
 			       TDB_LOCK_WAIT|TDB_LOCK_PROBE) == 0) {
+			if (tdb_have_mutexes(tdb)) {
+				tdb_mutex_allrecord_upgrade(tdb);
+			}
 			tdb->allrecord_lock.ltype = F_WRLCK;
 			tdb->allrecord_lock.off = 0;
+			tdb_seqlock_write_begin_all(tdb);
 			return 0;
 		}
 		if (errno != EDEADLK) {
@@ -275,6 +299,12 @@ int tdb_nest_lock(struct tdb_context *tdb, uint32_t offset, int ltype,
 		 * don't stack.
 		 */
 		new_lck->count++;
+		if (ltype == F_WRLCK && new_lck->ltype != F_WRLCK &&
+		    lock_list(tdb, offset) != -1) {
+			/* lock-free readers must stay off this chain */
+			tdb_seqlock_write_begin(tdb, lock_list(tdb, offset));
+			new_lck->ltype = F_WRLCK;
+		}
 		return 0;
 	}
 
@@ -298,6 +328,10 @@ int tdb_nest_lock(struct tdb_context *tdb, uint32_t offset, int ltype,
 	tdb->lockrecs[tdb->num_lockrecs].ltype = ltype;
 	tdb->num_lockrecs++;
 
+	if (ltype == F_WRLCK) {
+		tdb_seqlock_write_begin(tdb, lock_list(tdb, offset));
+	}
+
 	return 0;
 }
 
@@ -306,21 +340,35 @@ static int tdb_lock_and_recover(struct tdb_context *tdb)
 	int ret;
 
 	/* We need to match locking order in transaction commit. */
-	if (tdb_brlock(tdb, F_WRLCK, FREELIST_TOP, 0, TDB_LOCK_WAIT)) {
+	if (tdb_have_mutexes(tdb) &&
+	    tdb_mutex_allrecord_lock(tdb, F_WRLCK, TDB_LOCK_WAIT)) {
 		return -1;
 	}
 
+	if (tdb_brlock(tdb, F_WRLCK, FREELIST_TOP, 0, TDB_LOCK_WAIT)) {
+		goto unlock_mutexes;
+	}
+
 	if (tdb_brlock(tdb, F_WRLCK, OPEN_LOCK, 1, TDB_LOCK_WAIT)) {
 		tdb_brunlock(tdb, F_WRLCK, FREELIST_TOP, 0);
-		return -1;
+		goto unlock_mutexes;
 	}
 
 	ret = tdb_transaction_recover(tdb);
 
 	tdb_brunlock(tdb, F_WRLCK, OPEN_LOCK, 1);
 	tdb_brunlock(tdb, F_WRLCK, FREELIST_TOP, 0);
+	if (tdb_have_mutexes(tdb)) {
+		tdb_mutex_allrecord_unlock(tdb);
+	}
 
 	return ret;
+
+unlock_mutexes:
+	if (tdb_have_mutexes(tdb)) {
+		tdb_mutex_allrecord_unlock(tdb);
+	}
+	return -1;
 }
 
 static bool have_data_locks(const struct tdb_context *tdb)
@@ -419,6 +467,10 @@ int tdb_nest_unlock(struct tdb_context *tdb, uint32_t offset, int ltype,
 	 * anyway.
 	 */
 
+	if (lck->ltype == F_WRLCK) {
+		tdb_seqlock_write_end(tdb, lock_list(tdb, offset));
+	}
+
 	if (mark_lock) {
 		ret = 0;
 	} else {
@@ -566,17 +618,25 @@ int tdb_allrecord_lock(struct tdb_context *tdb, int ltype,
 	 *    chain locks.
 	 *
 	 * It is (1) which cause the starvation problem, so we're only
-	 * gradual for that. */
-	if (tdb_chainlock_gradual(tdb, ltype, flags, FREELIST_TOP,
-				  tdb->header.hash_size * 4) == -1) {
+	 * gradual for that. Chain mutexes can't starve us. */
+	if (tdb_have_mutexes(tdb) && !(flags & TDB_LOCK_MARK_ONLY)) {
+		if (tdb_mutex_allrecord_lock(tdb, ltype, flags) == -1) {
+			return -1;
+		}
+	} else if (tdb_chainlock_gradual(tdb, ltype, flags, FREELIST_TOP,
+					 tdb->header.hash_size * 4) == -1) {
 		return -1;
 	}
 
 	/* Grab individual record locks. */
 	if (tdb_brlock(tdb, ltype, lock_offset(tdb->header.hash_size), 0,
 		       flags) == -1) {
-		tdb_brunlock(tdb, ltype, FREELIST_TOP,
-			     tdb->header.hash_size * 4);
+		if (tdb_have_mutexes(tdb) && !(flags & TDB_LOCK_MARK_ONLY)) {
+			tdb_mutex_allrecord_unlock(tdb);
+		} else {
+			tdb_brunlock(tdb, ltype, FREELIST_TOP,
+				     tdb->header.hash_size * 4);
+		}
 		return -1;
 	}
 
@@ -601,6 +661,11 @@ int tdb_allrecord_lock(struct tdb_context *tdb, int ltype,
 		return tdb_allrecord_lock(tdb, ltype, flags, upgradable);
 	}
 
+	/* An upgradable lock only modifies once upgraded */
+	if (ltype == F_WRLCK && !upgradable) {
+		tdb_seqlock_write_begin_all(tdb);
+	}
+
 	return 0;
 }
 
@@ -632,6 +697,14 @@ int tdb_allrecord_unlock(struct tdb_context *tdb, int ltype, bool mark_lock)
 		return 0;
 	}
 
+	tdb_seqlock_write_end_all(tdb);
+
+	if (!mark_lock && tdb_have_mutexes(tdb) &&
+	    tdb_mutex_allrecord_unlock(tdb)) {
+		TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_unlockall failed (%s)\n", strerror(errno)));
+		return -1;
+	}
+
 	if (!mark_lock && tdb_brunlock(tdb, ltype, FREELIST_TOP, 0)) {
 		TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_unlockall failed (%s)\n", strerror(errno)));
 		return -1;
@@ -840,6 +913,10 @@ void tdb_release_transaction_locks(struct tdb_context *tdb)
 	unsigned int i, active = 0;
 
 	if (tdb->allrecord_lock.count != 0) {
+		tdb_seqlock_write_end_all(tdb);
+		if (tdb_have_mutexes(tdb)) {
+			tdb_mutex_allrecord_unlock(tdb);
+		}
 		tdb_brunlock(tdb, tdb->allrecord_lock.ltype, FREELIST_TOP, 0);
 		tdb->allrecord_lock.count = 0;
 	}
@@ -851,6 +928,10 @@ void tdb_release_transaction_locks(struct tdb_context *tdb)
 		if (lck->off == ACTIVE_LOCK) {
 			tdb->lockrecs[active++] = *lck;
 		} else {
+			if (lck->ltype == F_WRLCK) {
+				tdb_seqlock_write_end(tdb,
+						      lock_list(tdb, lck->off));
+			}
 			tdb_brunlock(tdb, lck->ltype, lck->off, 1);
 		}
 	}
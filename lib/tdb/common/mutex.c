@@ -0,0 +1,455 @@
+ /*
+   Unix SMB/CIFS implementation.
+
+   trivial database library - robust process shared mutexes
+
+     ** NOTE! The following LGPL license applies to the tdb
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "tdb_private.h"
+
+/*
+  A database created with TDB_MUTEX_LOCKING carries a feature area
+  with one robust process shared mutex per hash chain plus one for the
+  freelist. Every opener then locks chains with these mutexes instead
+  of fcntl locks on the corresponding bytes; all other locks (open,
+  active, transaction, records) stay fcntl locks.
+
+  Chain mutexes are exclusive, F_RDLCK and F_WRLCK are the same to
+  them. If a process dies holding one, the next locker gets it with
+  EOWNERDEAD, just as the kernel drops fcntl locks of dead processes.
+
+  The allrecord lock can't be a range lock anymore. Instead the
+  holder of allrecord_mutex sets allrecord_lock, then locks and
+  unlocks every chain mutex to wait for current chain lockers, and
+  finally keeps the freelist mutex. Chain lockers which find
+  allrecord_lock set after getting their mutex back off and wait on
+  allrecord_mutex, unless they already hold other chains. So
+  allrecord locks are always exclusive here.
+
+  Mutexes don't return EINTR, so tdb_setalarm_sigptr() can't
+  interrupt a blocking lock in this mode.
+*/
+
+#ifdef USE_TDB_MUTEX_LOCKING
+
+struct tdb_mutexes {
+	pthread_mutex_t allrecord_mutex;	/* protects allrecord_lock */
+	short int allrecord_lock;		/* F_UNLCK or the holder's type */
+	pthread_mutex_t hashchains[1];		/* freelist, then the chains */
+};
+
+/* size of the struct tdb_mutexes for hash_size chains */
+tdb_len_t tdb_mutex_size(uint32_t hash_size)
+{
+	return offsetof(struct tdb_mutexes, hashchains)
+		+ (hash_size + 1) * sizeof(pthread_mutex_t);
+}
+
+bool tdb_have_mutexes(struct tdb_context *tdb)
+{
+	return tdb->mutexes != NULL;
+}
+
+static int tdb_mutexattr_init(pthread_mutexattr_t *ma)
+{
+	int ret;
+
+	ret = pthread_mutexattr_init(ma);
+	if (ret != 0) {
+		return ret;
+	}
+	ret = pthread_mutexattr_settype(ma, PTHREAD_MUTEX_ERRORCHECK);
+	if (ret == 0) {
+		ret = pthread_mutexattr_setpshared(ma, PTHREAD_PROCESS_SHARED);
+	}
+	if (ret == 0) {
+		ret = pthread_mutexattr_setrobust(ma, PTHREAD_MUTEX_ROBUST);
+	}
+	if (ret != 0) {
+		pthread_mutexattr_destroy(ma);
+	}
+	return ret;
+}
+
+/* can we create robust process shared mutexes here? */
+bool tdb_mutex_supported(void)
+{
+	static bool initialized;
+	static bool supported;
+	pthread_mutexattr_t ma;
+	pthread_mutex_t m;
+
+	if (initialized) {
+		return supported;
+	}
+	initialized = true;
+
+	if (tdb_mutexattr_init(&ma) != 0) {
+		return false;
+	}
+	if (pthread_mutex_init(&m, &ma) == 0) {
+		pthread_mutex_destroy(&m);
+		supported = true;
+	}
+	pthread_mutexattr_destroy(&ma);
+	return supported;
+}
+
+/* set up the mutexes of a freshly created database */
+int tdb_mutex_init(struct tdb_context *tdb)
+{
+	struct tdb_mutexes *m = tdb->mutexes;
+	pthread_mutexattr_t ma;
+	uint32_t i;
+	int ret;
+
+	ret = tdb_mutexattr_init(&ma);
+	if (ret != 0) {
+		goto fail;
+	}
+	ret = pthread_mutex_init(&m->allrecord_mutex, &ma);
+	for (i = 0; ret == 0 && i < tdb->header.hash_size + 1; i++) {
+		ret = pthread_mutex_init(&m->hashchains[i], &ma);
+	}
+	pthread_mutexattr_destroy(&ma);
+	if (ret != 0) {
+		goto fail;
+	}
+	m->allrecord_lock = F_UNLCK;
+	return 0;
+
+fail:
+	TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_mutex_init: "
+		 "failed to initialise mutexes: %s\n", strerror(ret)));
+	errno = ret;
+	return -1;
+}
+
+/*
+  map the mutex area. The mapping is separate from tdb->map_ptr, it
+  never moves and also exists for TDB_NOMMAP. Read-only openers need
+  to lock as well, so they map through a read-write descriptor.
+*/
+int tdb_mutex_mmap(struct tdb_context *tdb)
+{
+	size_t len = tdb->header.mutex_start + tdb->header.mutex_size;
+	int fd = tdb->fd;
+	void *ptr;
+
+	if (tdb->read_only) {
+		fd = open(tdb->name, O_RDWR);
+		if (fd == -1) {
+			TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_mutex_mmap: "
+				 "%s needs to be writable for its mutexes: "
+				 "%s\n", tdb->name, strerror(errno)));
+			return -1;
+		}
+	}
+
+	ptr = mmap(NULL, len, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_FILE,
+		   fd, 0);
+	if (fd != tdb->fd) {
+		close(fd);
+	}
+	if (ptr == MAP_FAILED) {
+		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_mutex_mmap: "
+			 "mmap of %u bytes failed: %s\n",
+			 (unsigned)len, strerror(errno)));
+		return -1;
+	}
+
+	tdb->mutex_map = ptr;
+	tdb->mutex_map_size = len;
+	tdb->mutexes = (struct tdb_mutexes *)
+		((char *)ptr + tdb->header.mutex_start);
+	return 0;
+}
+
+int tdb_mutex_munmap(struct tdb_context *tdb)
+{
+	int ret;
+
+	if (tdb->mutex_map == NULL) {
+		return 0;
+	}
+	ret = munmap(tdb->mutex_map, tdb->mutex_map_size);
+	tdb->mutex_map = NULL;
+	tdb->mutex_map_size = 0;
+	tdb->mutexes = NULL;
+	return ret;
+}
+
+/* lock a mutex, taking over from a dead owner. Returns an errno. */
+static int tdb_mutex_take(pthread_mutex_t *m, bool waitflag)
+{
+	int ret;
+
+	ret = waitflag ? pthread_mutex_lock(m) : pthread_mutex_trylock(m);
+	if (ret == EOWNERDEAD) {
+		ret = pthread_mutex_consistent(m);
+	}
+	if (ret == EBUSY) {
+		/* what fcntl says for a conflicting lock */
+		ret = EAGAIN;
+	}
+	return ret;
+}
+
+/* which mutex stands for a 1 byte lock at off, if any */
+static bool tdb_mutex_index(struct tdb_context *tdb, off_t off, off_t len,
+			    uint32_t *idx)
+{
+	if (tdb->mutexes == NULL || len != 1) {
+		return false;
+	}
+	if (off < FREELIST_TOP - sizeof(tdb_off_t) ||
+	    off >= FREELIST_TOP + tdb->header.hash_size * sizeof(tdb_off_t)) {
+		return false;
+	}
+	*idx = (off - (FREELIST_TOP - sizeof(tdb_off_t))) / sizeof(tdb_off_t);
+	return true;
+}
+
+/*
+  An allrecord locker has to wait for every chain we hold, so as long
+  as we hold one it can't be through yet and we may take more.
+  Backing off would deadlock.
+*/
+static bool tdb_mutex_holding_chains(struct tdb_context *tdb)
+{
+	unsigned int i;
+
+	for (i = 0; i < tdb->num_lockrecs; i++) {
+		uint32_t idx;
+
+		if (tdb_mutex_index(tdb, tdb->lockrecs[i].off, 1, &idx)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+  take the chain mutex for a lock fcntl_lock() was asked for. Returns
+  false if that's no chain lock, else *pret is set like fcntl would.
+*/
+bool tdb_mutex_lock(struct tdb_context *tdb, int rw, off_t off, off_t len,
+		    bool waitflag, int *pret)
+{
+	struct tdb_mutexes *m = tdb->mutexes;
+	pthread_mutex_t *chain;
+	uint32_t idx;
+	int ret;
+
+	if (!tdb_mutex_index(tdb, off, len, &idx)) {
+		return false;
+	}
+	chain = &m->hashchains[idx];
+
+again:
+	ret = tdb_mutex_take(chain, waitflag);
+	if (ret != 0) {
+		goto fail;
+	}
+
+	if (idx == 0) {
+		/* the allrecord holder keeps the freelist mutex */
+		*pret = 0;
+		return true;
+	}
+
+	if (m->allrecord_lock == F_UNLCK || tdb_mutex_holding_chains(tdb)) {
+		*pret = 0;
+		return true;
+	}
+
+	/* someone wants or has the allrecord lock, get out of its way */
+	pthread_mutex_unlock(chain);
+
+	if (!waitflag) {
+		ret = EAGAIN;
+		goto fail;
+	}
+
+	ret = tdb_mutex_take(&m->allrecord_mutex, true);
+	if (ret != 0) {
+		goto fail;
+	}
+	/* we hold allrecord_mutex, so nobody holds the allrecord
+	 * lock. Clear what a dead holder left behind. */
+	m->allrecord_lock = F_UNLCK;
+	pthread_mutex_unlock(&m->allrecord_mutex);
+	goto again;
+
+fail:
+	errno = ret;
+	*pret = -1;
+	return true;
+}
+
+bool tdb_mutex_unlock(struct tdb_context *tdb, int rw, off_t off, off_t len,
+		      int *pret)
+{
+	uint32_t idx;
+	int ret;
+
+	if (!tdb_mutex_index(tdb, off, len, &idx)) {
+		return false;
+	}
+
+	ret = pthread_mutex_unlock(&tdb->mutexes->hashchains[idx]);
+	if (ret != 0) {
+		errno = ret;
+		*pret = -1;
+		return true;
+	}
+	*pret = 0;
+	return true;
+}
+
+/*
+  the chain part of an allrecord lock: keep chain lockers out and
+  wait for the ones inside to leave.
+*/
+int tdb_mutex_allrecord_lock(struct tdb_context *tdb, int ltype,
+			     enum tdb_lock_flags flags)
+{
+	struct tdb_mutexes *m = tdb->mutexes;
+	bool waitflag = (flags & TDB_LOCK_WAIT);
+	uint32_t i;
+	int ret;
+
+	ret = tdb_mutex_take(&m->allrecord_mutex, waitflag);
+	if (ret != 0) {
+		goto fail;
+	}
+	m->allrecord_lock = ltype;
+
+	for (i = 1; i < tdb->header.hash_size + 1; i++) {
+		ret = tdb_mutex_take(&m->hashchains[i], waitflag);
+		if (ret != 0) {
+			goto undo;
+		}
+		pthread_mutex_unlock(&m->hashchains[i]);
+	}
+
+	ret = tdb_mutex_take(&m->hashchains[0], waitflag);
+	if (ret != 0) {
+		goto undo;
+	}
+	return 0;
+
+undo:
+	m->allrecord_lock = F_UNLCK;
+	pthread_mutex_unlock(&m->allrecord_mutex);
+fail:
+	tdb->ecode = TDB_ERR_LOCK;
+	errno = ret;
+	return -1;
+}
+
+int tdb_mutex_allrecord_unlock(struct tdb_context *tdb)
+{
+	struct tdb_mutexes *m = tdb->mutexes;
+	int ret;
+
+	ret = pthread_mutex_unlock(&m->hashchains[0]);
+	if (ret != 0) {
+		TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_mutex_allrecord_unlock: "
+			 "not holding the allrecord lock: %s\n",
+			 strerror(ret)));
+		errno = ret;
+		return -1;
+	}
+	m->allrecord_lock = F_UNLCK;
+	pthread_mutex_unlock(&m->allrecord_mutex);
+	return 0;
+}
+
+/* the mutexes are exclusive anyway, just say what we have now */
+void tdb_mutex_allrecord_upgrade(struct tdb_context *tdb)
+{
+	tdb->mutexes->allrecord_lock = F_WRLCK;
+}
+
+#else
+
+tdb_len_t tdb_mutex_size(uint32_t hash_size)
+{
+	return 0;
+}
+
+bool tdb_have_mutexes(struct tdb_context *tdb)
+{
+	return false;
+}
+
+bool tdb_mutex_supported(void)
+{
+	return false;
+}
+
+int tdb_mutex_init(struct tdb_context *tdb)
+{
+	errno = ENOSYS;
+	return -1;
+}
+
+int tdb_mutex_mmap(struct tdb_context *tdb)
+{
+	errno = ENOSYS;
+	return -1;
+}
+
+int tdb_mutex_munmap(struct tdb_context *tdb)
+{
+	return 0;
+}
+
+bool tdb_mutex_lock(struct tdb_context *tdb, int rw, off_t off, off_t len,
+		    bool waitflag, int *pret)
+{
+	return false;
+}
+
+bool tdb_mutex_unlock(struct tdb_context *tdb, int rw, off_t off, off_t len,
+		      int *pret)
+{
+	return false;
+}
+
+int tdb_mutex_allrecord_lock(struct tdb_context *tdb, int ltype,
+			     enum tdb_lock_flags flags)
+{
+	tdb->ecode = TDB_ERR_LOCK;
+	errno = ENOSYS;
+	return -1;
+}
+
+int tdb_mutex_allrecord_unlock(struct tdb_context *tdb)
+{
+	errno = ENOSYS;
+	return -1;
+}
+
+void tdb_mutex_allrecord_upgrade(struct tdb_context *tdb)
+{
+}
+
+#endif
@@ -50,15 +50,79 @@ void tdb_header_hash(struct tdb_context *tdb,
 		*magic1_hash = 1;
 }
 
+/*
+  Feature areas (seqlock counters, mutexes) are records behind the
+  hash table, in that order. Their contents start on a
+  TDB_FEATURE_AREA_ALIGN boundary and are padded to one.
+*/
+static tdb_off_t tdb_feature_area_start(tdb_off_t off)
+{
+	return TDB_ALIGN(off + sizeof(struct tdb_record),
+			 TDB_FEATURE_AREA_ALIGN);
+}
+
+tdb_off_t tdb_feature_area_end(tdb_off_t start, tdb_len_t len)
+{
+	return start + TDB_ALIGN(len, TDB_FEATURE_AREA_ALIGN)
+		+ sizeof(tdb_off_t);
+}
+
+/* write the record of a feature area at off into a new database
+   image, returning the offset of its contents */
+static tdb_off_t tdb_feature_area_init(struct tdb_context *tdb,
+				       unsigned char *image, tdb_off_t off,
+				       tdb_len_t len, uint32_t magic)
+{
+	struct tdb_record rec;
+	tdb_off_t start = tdb_feature_area_start(off);
+	tdb_off_t tailer = tdb_feature_area_end(start, len) - off;
+
+	memset(&rec, 0, sizeof(rec));
+	rec.rec_len = tailer - sizeof(rec);
+	rec.magic = magic;
+
+	CONVERT(rec);
+	CONVERT(tailer);
+	memcpy(image + off, &rec, sizeof(rec));
+	memcpy(image + tdb_feature_area_end(start, len) - sizeof(tailer),
+	       &tailer, sizeof(tailer));
+	return start;
+}
+
+/* the first offset available for records */
+tdb_off_t tdb_data_start(struct tdb_context *tdb)
+{
+	if (TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_MUTEX)) {
+		return tdb_feature_area_end(tdb->header.mutex_start,
+					    tdb->header.mutex_size);
+	}
+	if (TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_SEQLOCK)) {
+		return tdb_feature_area_end(
+			tdb->header.seqlock_start,
+			tdb_seqlock_size(tdb->header.seqlock_count));
+	}
+	return TDB_DATA_START(tdb->header.hash_size);
+}
+
 /* initialise a new database with a specified hash size */
 static int tdb_new_database(struct tdb_context *tdb, int hash_size)
 {
 	struct tdb_header *newdb;
-	size_t size;
+	size_t size, seqlock_off = 0, mutex_off = 0;
 	int ret = -1;
 
 	/* We make it up in memory, then write it out if not internal */
 	size = sizeof(struct tdb_header) + (hash_size+1)*sizeof(tdb_off_t);
+	if (tdb->flags & TDB_SEQLOCK) {
+		seqlock_off = size;
+		size = tdb_feature_area_end(tdb_feature_area_start(size),
+					    tdb_seqlock_size(hash_size));
+	}
+	if (tdb->flags & TDB_MUTEX_LOCKING) {
+		mutex_off = size;
+		size = tdb_feature_area_end(tdb_feature_area_start(size),
+					    tdb_mutex_size(hash_size));
+	}
 	if (!(newdb = (struct tdb_header *)calloc(size, 1))) {
 		tdb->ecode = TDB_ERR_OOM;
 		return -1;
@@ -75,6 +139,38 @@ static int tdb_new_database(struct tdb_context *tdb, int hash_size)
 	if (tdb->flags & TDB_INCOMPATIBLE_HASH)
 		newdb->rwlocks = TDB_HASH_RWLOCK_MAGIC;
 
+	/* Feature areas follow the hash table. Older tdbs would not
+	 * maintain them, so lock them out via rwlocks. */
+	if (tdb->flags & TDB_SEQLOCK) {
+		newdb->rwlocks = TDB_FEATURE_FLAG_MAGIC;
+		newdb->feature_flags |= TDB_FEATURE_FLAG_SEQLOCK;
+		newdb->seqlock_start = tdb_feature_area_init(
+			tdb, (unsigned char *)newdb, seqlock_off,
+			tdb_seqlock_size(hash_size), TDB_SEQLOCK_MAGIC);
+		newdb->seqlock_count = hash_size;
+	}
+	/* The buckets start out as the hash table above */
+	if (tdb->flags & TDB_RESIZABLE_HASH) {
+		newdb->rwlocks = TDB_FEATURE_FLAG_MAGIC;
+		newdb->feature_flags |= TDB_FEATURE_FLAG_RESIZABLE_HASH;
+	}
+	/* Older tdbs would overwrite a recovery area that is not
+	 * known to be invalid on disk */
+	if (tdb->flags & TDB_GROUP_COMMIT) {
+		newdb->rwlocks = TDB_FEATURE_FLAG_MAGIC;
+		newdb->feature_flags |= TDB_FEATURE_FLAG_GROUP_COMMIT;
+	}
+	/* The mutexes themselves are initialised once the file is
+	 * mapped, see tdb_mutex_init() */
+	if (tdb->flags & TDB_MUTEX_LOCKING) {
+		newdb->rwlocks = TDB_FEATURE_FLAG_MAGIC;
+		newdb->feature_flags |= TDB_FEATURE_FLAG_MUTEX;
+		newdb->mutex_start = tdb_feature_area_init(
+			tdb, (unsigned char *)newdb, mutex_off,
+			tdb_mutex_size(hash_size), TDB_MUTEX_MAGIC);
+		newdb->mutex_size = tdb_mutex_size(hash_size);
+	}
+
 	if (tdb->flags & TDB_INTERNAL) {
 		tdb->map_size = size;
 		tdb->map_ptr = (char *)newdb;
@@ -170,6 +266,7 @@ _PUBLIC_ struct tdb_context *tdb_open_ex(const char *name, int hash_size, int td
 	struct tdb_context *tdb;
 	struct stat st;
 	int rev = 0, locked = 0;
+	bool created = false;
 	unsigned char *vp;
 	uint32_t vertest;
 	unsigned v;
@@ -284,7 +381,8 @@ _PUBLIC_ struct tdb_context *tdb_open_ex(const char *name, int hash_size, int td
 	/* internal databases don't mmap or lock, and start off cleared */
 	if (tdb->flags & TDB_INTERNAL) {
 		tdb->flags |= (TDB_NOLOCK | TDB_NOMMAP);
-		tdb->flags &= ~TDB_CLEAR_IF_FIRST;
+		tdb->flags &= ~(TDB_CLEAR_IF_FIRST|TDB_SEQLOCK|TDB_MUTEX_LOCKING|
+				TDB_RESIZABLE_HASH|TDB_GROUP_COMMIT);
 		if (tdb_new_database(tdb, hash_size) != 0) {
 			TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_open_ex: tdb_new_database failed!"));
 			goto fail;
@@ -292,6 +390,12 @@ _PUBLIC_ struct tdb_context *tdb_open_ex(const char *name, int hash_size, int td
 		goto internal;
 	}
 
+	if ((tdb->flags & TDB_MUTEX_LOCKING) && !tdb_mutex_supported()) {
+		TDB_LOG((tdb, TDB_DEBUG_TRACE, "tdb_open_ex: no robust "
+			 "mutexes, using fcntl locks for %s\n", name));
+		tdb->flags &= ~TDB_MUTEX_LOCKING;
+	}
+
 	if ((tdb->fd = open(name, open_flags, mode)) == -1) {
 		TDB_LOG((tdb, TDB_DEBUG_WARNING, "tdb_open_ex: could not open file %s: %s\n",
 			 name, strerror(errno)));
@@ -332,6 +436,7 @@ _PUBLIC_ struct tdb_context *tdb_open_ex(const char *name, int hash_size, int td
 			goto fail;
 		}
 		rev = (tdb->flags & TDB_CONVERT);
+		created = true;
 	} else if (tdb->header.version != TDB_VERSION
 		   && !(rev = (tdb->header.version==TDB_BYTEREV(TDB_VERSION)))) {
 		/* wrong version */
@@ -351,12 +456,54 @@ _PUBLIC_ struct tdb_context *tdb_open_ex(const char *name, int hash_size, int td
 	if (fstat(tdb->fd, &st) == -1)
 		goto fail;
 
-	if (tdb->header.rwlocks != 0 &&
-	    tdb->header.rwlocks != TDB_HASH_RWLOCK_MAGIC) {
+	if (tdb->header.rwlocks == TDB_FEATURE_FLAG_MAGIC) {
+		if (tdb->header.feature_flags & ~TDB_SUPPORTED_FEATURE_FLAGS) {
+			TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_open_ex: "
+				 "unsupported features 0x%x in %s\n",
+				 tdb->header.feature_flags, name));
+			errno = EINVAL;
+			goto fail;
+		}
+		if ((tdb_have_seqlock(tdb) && tdb->header.seqlock_count == 0)
+		    || tdb_data_start(tdb) > st.st_size) {
+			TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_open_ex: "
+				 "invalid feature areas in %s\n", name));
+			errno = EIO;
+			goto fail;
+		}
+		if (TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_MUTEX) &&
+		    (!tdb_mutex_supported() ||
+		     tdb->header.mutex_size !=
+		     tdb_mutex_size(tdb->header.hash_size))) {
+			/* All openers have to use the same locks */
+			TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_open_ex: "
+				 "%s needs robust mutexes we don't "
+				 "support\n", name));
+			errno = EINVAL;
+			goto fail;
+		}
+	} else if (tdb->header.rwlocks != 0 &&
+		   tdb->header.rwlocks != TDB_HASH_RWLOCK_MAGIC) {
 		TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_open_ex: spinlocks no longer supported\n"));
 		goto fail;
 	}
 
+	/* Lock-free reads need the counters in the file, which are
+	 * only created with the database. */
+	if ((tdb->flags & TDB_SEQLOCK) && !tdb_have_seqlock(tdb)) {
+		TDB_LOG((tdb, TDB_DEBUG_TRACE, "tdb_open_ex: "
+			 "%s was not created with TDB_SEQLOCK, "
+			 "using locked reads\n", name));
+		tdb->flags &= ~TDB_SEQLOCK;
+	}
+
+	/* The locking method is a property of the file */
+	if (TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_MUTEX)) {
+		tdb->flags |= TDB_MUTEX_LOCKING;
+	} else {
+		tdb->flags &= ~TDB_MUTEX_LOCKING;
+	}
+
 	if ((tdb->header.magic1_hash == 0) && (tdb->header.magic2_hash == 0)) {
 		/* older TDB without magic hash references */
 		tdb->hash_fn = tdb_old_hash;
@@ -399,6 +546,15 @@ _PUBLIC_ struct tdb_context *tdb_open_ex(const char *name, int hash_size, int td
 	tdb->device = st.st_dev;
 	tdb->inode = st.st_ino;
 	tdb_mmap(tdb);
+
+	if ((tdb->flags & TDB_MUTEX_LOCKING) && !(tdb->flags & TDB_NOLOCK)) {
+		if (tdb_mutex_mmap(tdb) == -1) {
+			goto fail;
+		}
+		if (created && tdb_mutex_init(tdb) == -1) {
+			goto fail;
+		}
+	}
 	if (locked) {
 		if (tdb_nest_unlock(tdb, ACTIVE_LOCK, F_WRLCK, false) == -1) {
 			TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_open_ex: "
@@ -467,6 +623,7 @@ _PUBLIC_ struct tdb_context *tdb_open_ex(const char *name, int hash_size, int td
 		else
 			tdb_munmap(tdb);
 	}
+	tdb_mutex_munmap(tdb);
 	if (tdb->fd != -1)
 		if (close(tdb->fd) != 0)
 			TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_open_ex: failed to close tdb->fd on error!\n"));
@@ -508,6 +665,7 @@ _PUBLIC_ int tdb_close(struct tdb_context *tdb)
 		else
 			tdb_munmap(tdb);
 	}
+	tdb_mutex_munmap(tdb);
 	SAFE_FREE(tdb->name);
 	if (tdb->fd != -1) {
 		ret = close(tdb->fd);
@@ -0,0 +1,324 @@
+ /*
+   Unix SMB/CIFS implementation.
+
+   trivial database library - growing the bucket array
+
+     ** NOTE! The following LGPL license applies to the tdb
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "tdb_private.h"
+
+/*
+  In a database created with TDB_RESIZABLE_HASH the hash chains hang
+  off a bucket array which can grow, while the locks stay as they
+  are. header.hash_size keeps fixing the number of chain locks; the
+  buckets start out as the hash table behind the header and are later
+  moved into a record of their own, with header.hash_buckets always a
+  multiple of hash_size. So bucket (hash % hash_buckets) is covered by
+  lock (hash % hash_size), and growing never moves a record to
+  another lock.
+
+  The buckets are grown by whoever stores into a database after a
+  lookup walked a long chain, in a transaction of its own: its
+  allrecord lock keeps everybody else off the chains, and everybody
+  reads the bucket array position from the header under their chain
+  lock.
+*/
+
+/* where the current bucket array is, and how many buckets it has */
+int tdb_hash_buckets(struct tdb_context *tdb, tdb_off_t *table,
+		     uint32_t *count)
+{
+	tdb_off_t buckets[2];
+
+	*table = FREELIST_TOP + sizeof(tdb_off_t);
+	*count = tdb->header.hash_size;
+
+	if (!TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_RESIZABLE_HASH)) {
+		return 0;
+	}
+
+	if (tdb->methods->tdb_read(tdb, offsetof(struct tdb_header, hash_table),
+				   buckets, sizeof(buckets), DOCONV()) == -1) {
+		return -1;
+	}
+	if (buckets[0] == 0) {
+		return 0;
+	}
+	if (buckets[1] == 0 || buckets[1] % tdb->header.hash_size != 0) {
+		tdb->ecode = TDB_ERR_CORRUPT;
+		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_hash_buckets: "
+			 "%u buckets for %u hash chains\n",
+			 buckets[1], tdb->header.hash_size));
+		return -1;
+	}
+	*table = buckets[0];
+	*count = buckets[1];
+	return 0;
+}
+
+/* offset of the head of the chain hash belongs to. hash may also be a
+   bucket number. */
+int tdb_hash_top(struct tdb_context *tdb, uint32_t hash, tdb_off_t *top)
+{
+	tdb_off_t table;
+	uint32_t count;
+
+	if (!TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_RESIZABLE_HASH)) {
+		*top = TDB_HASH_TOP(hash);
+		return 0;
+	}
+
+	if (tdb_hash_buckets(tdb, &table, &count) == -1) {
+		return -1;
+	}
+	*top = table + (hash % count) * sizeof(tdb_off_t);
+	return 0;
+}
+
+/* a lookup walked chain_length records */
+void tdb_rehash_note(struct tdb_context *tdb, uint32_t chain_length)
+{
+	if (chain_length > TDB_REHASH_CHAIN_LENGTH &&
+	    TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_RESIZABLE_HASH)) {
+		tdb->rehash_wanted = true;
+	}
+}
+
+/* go back to the original hash table, for tdb_wipe_all(). The caller
+   has zeroed it and frees the bucket array. */
+int tdb_rehash_reset(struct tdb_context *tdb)
+{
+	tdb_off_t zero = 0;
+
+	if (!TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_RESIZABLE_HASH)) {
+		return 0;
+	}
+	if (tdb_ofs_write(tdb, offsetof(struct tdb_header, hash_table),
+			  &zero) == -1 ||
+	    tdb_ofs_write(tdb, offsetof(struct tdb_header, hash_buckets),
+			  &zero) == -1) {
+		return -1;
+	}
+	return 0;
+}
+
+/* count the records in all chains */
+static int tdb_rehash_count(struct tdb_context *tdb, tdb_off_t table,
+			    uint32_t count, uint32_t *records)
+{
+	struct tdb_record rec;
+	tdb_off_t rec_ptr;
+	uint32_t b;
+
+	*records = 0;
+	for (b = 0; b < count; b++) {
+		if (tdb_ofs_read(tdb, table + b * sizeof(tdb_off_t),
+				 &rec_ptr) == -1) {
+			return -1;
+		}
+		while (rec_ptr) {
+			if (tdb_rec_read(tdb, rec_ptr, &rec) == -1) {
+				return -1;
+			}
+			if (rec_ptr == rec.next) {
+				tdb->ecode = TDB_ERR_CORRUPT;
+				TDB_LOG((tdb, TDB_DEBUG_FATAL,
+					 "tdb_rehash: loop detected.\n"));
+				return -1;
+			}
+			(*records)++;
+			rec_ptr = rec.next;
+		}
+	}
+	return 0;
+}
+
+/* move all chains from the old buckets into a new array of count
+   buckets. Runs in a transaction. */
+static int tdb_rehash_move(struct tdb_context *tdb, tdb_off_t old_table,
+			   uint32_t old_count, uint32_t count)
+{
+	struct tdb_record rec;
+	tdb_off_t *buckets, rec_ptr, table, next;
+	tdb_len_t len = count * sizeof(tdb_off_t);
+	uint32_t b, nb;
+	int ret = -1;
+
+	buckets = (tdb_off_t *)calloc(count, sizeof(tdb_off_t));
+	if (buckets == NULL) {
+		tdb->ecode = TDB_ERR_OOM;
+		return -1;
+	}
+
+	for (b = 0; b < old_count; b++) {
+		if (tdb_ofs_read(tdb, old_table + b * sizeof(tdb_off_t),
+				 &rec_ptr) == -1) {
+			goto out;
+		}
+		while (rec_ptr) {
+			if (tdb_rec_read(tdb, rec_ptr, &rec) == -1) {
+				goto out;
+			}
+			next = rec.next;
+			nb = rec.full_hash % count;
+
+			/* next ptr is at start of record */
+			if (tdb_ofs_write(tdb, rec_ptr, &buckets[nb]) == -1) {
+				goto out;
+			}
+			buckets[nb] = rec_ptr;
+			rec_ptr = next;
+		}
+	}
+
+	table = tdb_allocate(tdb, len, &rec);
+	if (table == 0) {
+		goto out;
+	}
+	rec.next = 0;
+	rec.key_len = 0;
+	rec.data_len = len;
+	rec.full_hash = 0;
+	rec.magic = TDB_HASHTABLE_MAGIC;
+	if (tdb_rec_write(tdb, table, &rec) == -1) {
+		goto out;
+	}
+	table += sizeof(rec);
+
+	if (tdb->flags & TDB_CONVERT) {
+		tdb_convert(buckets, len);
+	}
+	if (tdb->methods->tdb_write(tdb, table, buckets, len) == -1) {
+		goto out;
+	}
+
+	/* retire the old buckets */
+	if (old_table == FREELIST_TOP + sizeof(tdb_off_t)) {
+		memset(buckets, 0, old_count * sizeof(tdb_off_t));
+		if (tdb->methods->tdb_write(tdb, old_table, buckets,
+					    old_count * sizeof(tdb_off_t)) == -1) {
+			goto out;
+		}
+	} else {
+		/* tdb_rec_read() would refuse the table's magic */
+		if (tdb->methods->tdb_read(tdb, old_table - sizeof(rec), &rec,
+					   sizeof(rec), DOCONV()) == -1) {
+			goto out;
+		}
+		if (rec.magic != TDB_HASHTABLE_MAGIC) {
+			tdb->ecode = TDB_ERR_CORRUPT;
+			TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_rehash: bad magic "
+				 "0x%x for the hash table at offset=%d\n",
+				 rec.magic, (int)(old_table - sizeof(rec))));
+			goto out;
+		}
+		if (tdb_free(tdb, old_table - sizeof(rec), &rec) == -1) {
+			goto out;
+		}
+	}
+
+	if (tdb_ofs_write(tdb, offsetof(struct tdb_header, hash_table),
+			  &table) == -1 ||
+	    tdb_ofs_write(tdb, offsetof(struct tdb_header, hash_buckets),
+			  &count) == -1) {
+		goto out;
+	}
+	ret = 0;
+out:
+	free(buckets);
+	return ret;
+}
+
+/* grow the bucket array if the chains are long on average */
+static int tdb_rehash(struct tdb_context *tdb)
+{
+	tdb_off_t table;
+	uint32_t count, new_count, records;
+
+	/* somebody else is busy, let them or the next store do it */
+	if (tdb_transaction_start_nonblock(tdb) == -1) {
+		return -1;
+	}
+
+	if (tdb_hash_buckets(tdb, &table, &count) == -1 ||
+	    tdb_rehash_count(tdb, table, count, &records) == -1) {
+		goto cancel;
+	}
+
+	if (records / count < TDB_REHASH_MIN_AVERAGE) {
+		/* just a few long chains. Take another look once the
+		 * database could have grown substantially. */
+		tdb->rehash_skip = records;
+		goto cancel;
+	}
+
+	new_count = count;
+	while (new_count < records && new_count * 2 <= TDB_REHASH_MAX_BUCKETS) {
+		new_count *= 2;
+	}
+	if (new_count == count) {
+		tdb->rehash_skip = records;
+		goto cancel;
+	}
+
+	if (tdb_rehash_move(tdb, table, count, new_count) == -1) {
+		goto cancel;
+	}
+
+	TDB_LOG((tdb, TDB_DEBUG_TRACE, "tdb_rehash: %u records, "
+		 "%u -> %u buckets\n", records, count, new_count));
+
+	return tdb_transaction_commit(tdb);
+
+cancel:
+	tdb_transaction_cancel(tdb);
+	return -1;
+}
+
+/*
+  called by writers once they dropped their chain lock. We can't
+  rehash inside a transaction or traverse, or while holding locks,
+  including the record lock tdb_nextkey() keeps.
+*/
+void tdb_rehash_maybe(struct tdb_context *tdb)
+{
+	enum TDB_ERROR ecode;
+
+	if (!tdb->rehash_wanted) {
+		return;
+	}
+	tdb->rehash_wanted = false;
+
+	if (tdb->rehash_skip > 0) {
+		tdb->rehash_skip--;
+		return;
+	}
+
+	if (tdb->transaction != NULL || tdb->travlocks.next != NULL ||
+	    tdb->travlocks.off != 0 ||
+	    tdb->allrecord_lock.count != 0 || tdb_have_extra_locks(tdb) ||
+	    tdb->read_only || tdb->traverse_read || tdb->traverse_write) {
+		return;
+	}
+
+	/* the caller's store went through, don't spoil its result */
+	ecode = tdb->ecode;
+	tdb_rehash(tdb);
+	tdb->ecode = ecode;
+}
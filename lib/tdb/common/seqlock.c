@@ -0,0 +1,302 @@
+ /*
+   Unix SMB/CIFS implementation.
+
+   trivial database library - lock-free reads via seqlocked hash chains
+
+     ** NOTE! The following LGPL license applies to the tdb
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "tdb_private.h"
+
+/*
+  A database created with TDB_SEQLOCK carries one 32 bit counter per
+  hash chain in a feature area directly behind the hash table:
+
+     header | hash table | seqlock record | data ...
+
+  The counters are kept in host byte order and are only ever accessed
+  directly, never through tdb->methods.
+
+  Whoever holds a write lock on a chain makes its counter odd when
+  taking the lock and even (and different) again before dropping it.
+  An allrecord write lock, a transaction commit and a recovery do the
+  same for all counters. This happens for every writer of such a
+  file, whether or not it passed TDB_SEQLOCK itself.
+
+  Readers that passed TDB_SEQLOCK and have the file mmap'ed then walk
+  a chain without the fcntl lock: they sample the counter, walk the
+  chain copying out what they need, and accept the result only if
+  the counter was even and did not change meanwhile. Everything else
+  falls back to the normal locked path.
+*/
+
+#if defined(__GNUC__) && \
+	((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 1)))
+#define HAVE_TDB_SEQLOCK_BARRIER 1
+#define tdb_seqlock_barrier() __sync_synchronize()
+#else
+#define tdb_seqlock_barrier()
+#endif
+
+bool tdb_have_seqlock(struct tdb_context *tdb)
+{
+	return TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_SEQLOCK);
+}
+
+/* size of the counters for count hash chains */
+tdb_len_t tdb_seqlock_size(uint32_t count)
+{
+	return count * sizeof(uint32_t);
+}
+
+static bool tdb_seqlock_writable(struct tdb_context *tdb)
+{
+	return tdb_have_seqlock(tdb) && !tdb->read_only;
+}
+
+static tdb_off_t tdb_seqlock_offset(struct tdb_context *tdb, uint32_t idx)
+{
+	return tdb->header.seqlock_start + idx * sizeof(uint32_t);
+}
+
+static volatile uint32_t *tdb_seqlock_ptr(struct tdb_context *tdb,
+					  uint32_t idx)
+{
+	return (volatile uint32_t *)
+		((char *)tdb->map_ptr + tdb_seqlock_offset(tdb, idx));
+}
+
+/*
+  set a range of counters to odd (begin) or to the next even value
+  (end). We're the only writer of these counters, as we hold the
+  corresponding write locks.
+*/
+static void tdb_seqlock_update(struct tdb_context *tdb, uint32_t idx,
+			       uint32_t count, bool begin)
+{
+	uint32_t *buf;
+	uint32_t i;
+	size_t len = count * sizeof(uint32_t);
+
+	if (tdb->map_ptr != NULL) {
+		for (i = idx; i < idx + count; i++) {
+			volatile uint32_t *p = tdb_seqlock_ptr(tdb, i);
+			*p = begin ? (*p | 1) : ((*p | 1) + 1);
+		}
+		return;
+	}
+
+	buf = (uint32_t *)malloc(len);
+	if (buf == NULL) {
+		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_seqlock_update: "
+			 "failed to allocate %u counters\n", count));
+		return;
+	}
+	if (pread(tdb->fd, buf, len, tdb_seqlock_offset(tdb, idx)) != len) {
+		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_seqlock_update: "
+			 "failed to read counters (%s)\n", strerror(errno)));
+		free(buf);
+		return;
+	}
+	for (i = 0; i < count; i++) {
+		buf[i] = begin ? (buf[i] | 1) : ((buf[i] | 1) + 1);
+	}
+	if (pwrite(tdb->fd, buf, len, tdb_seqlock_offset(tdb, idx)) != len) {
+		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_seqlock_update: "
+			 "failed to write counters (%s)\n", strerror(errno)));
+	}
+	free(buf);
+}
+
+/* mark a hash chain as being modified. Must hold its write lock. */
+void tdb_seqlock_write_begin(struct tdb_context *tdb, int list)
+{
+	if (list < 0 || tdb->seqlock_all || !tdb_seqlock_writable(tdb)) {
+		return;
+	}
+	tdb_seqlock_update(tdb, list % tdb->header.seqlock_count, 1, true);
+	tdb_seqlock_barrier();
+}
+
+/* done modifying a hash chain, called before dropping its write lock */
+void tdb_seqlock_write_end(struct tdb_context *tdb, int list)
+{
+	if (list < 0 || tdb->seqlock_all || !tdb_seqlock_writable(tdb)) {
+		return;
+	}
+	tdb_seqlock_barrier();
+	tdb_seqlock_update(tdb, list % tdb->header.seqlock_count, 1, false);
+}
+
+/*
+  mark all hash chains as being modified, for allrecord write locks.
+  Returns false if there's nothing to do or someone up the stack
+  already did it, in which case tdb_seqlock_write_end_all() is left
+  to them.
+*/
+bool tdb_seqlock_write_begin_all(struct tdb_context *tdb)
+{
+	if (tdb->seqlock_all || !tdb_seqlock_writable(tdb)) {
+		return false;
+	}
+	tdb_seqlock_update(tdb, 0, tdb->header.seqlock_count, true);
+	tdb_seqlock_barrier();
+	tdb->seqlock_all = true;
+	return true;
+}
+
+void tdb_seqlock_write_end_all(struct tdb_context *tdb)
+{
+	if (!tdb->seqlock_all) {
+		return;
+	}
+	tdb_seqlock_barrier();
+	tdb_seqlock_update(tdb, 0, tdb->header.seqlock_count, false);
+	tdb->seqlock_all = false;
+}
+
+#ifdef HAVE_TDB_SEQLOCK_BARRIER
+/*
+  walk a hash chain in the mmap without any lock. Anything we read
+  may be garbage if a writer is active, so everything is bounds
+  checked against our map. Returns false if the chain could not be
+  walked, in which case nothing is allocated.
+*/
+static bool tdb_seqlock_find(struct tdb_context *tdb, TDB_DATA key,
+			     uint32_t hash, TDB_DATA *data, bool *found)
+{
+	const unsigned char *map = (const unsigned char *)tdb->map_ptr;
+	tdb_len_t map_size = tdb->map_size;
+	tdb_len_t loops = map_size / sizeof(struct tdb_record);
+	struct tdb_record rec;
+	tdb_off_t rec_ptr, off, top = TDB_HASH_TOP(hash);
+
+	*found = false;
+
+	if (TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_RESIZABLE_HASH)) {
+		tdb_off_t buckets[2];
+
+		/* see tdb_hash_buckets(), but trust nothing */
+		memcpy(buckets, map + offsetof(struct tdb_header, hash_table),
+		       sizeof(buckets));
+		CONVERT(buckets);
+		if (buckets[0] != 0) {
+			if (buckets[1] == 0 ||
+			    buckets[0] > map_size ||
+			    buckets[1] > (map_size - buckets[0])
+					 / sizeof(tdb_off_t)) {
+				return false;
+			}
+			top = buckets[0] + (hash % buckets[1]) * sizeof(tdb_off_t);
+		}
+	}
+
+	memcpy(&rec_ptr, map + top, sizeof(rec_ptr));
+	CONVERT(rec_ptr);
+
+	while (rec_ptr != 0) {
+		if (loops-- == 0) {
+			return false;
+		}
+		if (rec_ptr > map_size - sizeof(rec)) {
+			/* someone expanded the file, or garbage */
+			return false;
+		}
+		memcpy(&rec, map + rec_ptr, sizeof(rec));
+		CONVERT(rec);
+
+		if (TDB_BAD_MAGIC(&rec)) {
+			return false;
+		}
+
+		off = rec_ptr + sizeof(rec);
+		if (!TDB_DEAD(&rec) && hash == rec.full_hash
+		    && key.dsize == rec.key_len
+		    && rec.key_len <= map_size - off
+		    && memcmp(map + off, key.dptr, key.dsize) == 0) {
+			off += rec.key_len;
+			if (rec.data_len > map_size - off) {
+				return false;
+			}
+			if (data != NULL) {
+				/* some systems don't like zero length malloc */
+				data->dptr = (unsigned char *)malloc(
+					rec.data_len ? rec.data_len : 1);
+				if (data->dptr == NULL) {
+					return false;
+				}
+				memcpy(data->dptr, map + off, rec.data_len);
+				data->dsize = rec.data_len;
+			}
+			*found = true;
+			return true;
+		}
+		rec_ptr = rec.next;
+	}
+	return true;
+}
+#endif
+
+/*
+  try to look up a record without taking the chain lock. If data is
+  not NULL, it gets a malloc'ed copy of the record's data.
+
+  Returns false if the caller has to use the locked path instead,
+  otherwise *found tells whether the record exists.
+*/
+bool tdb_seqlock_fetch(struct tdb_context *tdb, TDB_DATA key, uint32_t hash,
+		       TDB_DATA *data, bool *found)
+{
+#ifdef HAVE_TDB_SEQLOCK_BARRIER
+	volatile uint32_t *counter;
+	uint32_t seq;
+	bool ok;
+	int i;
+
+	if (!(tdb->flags & TDB_SEQLOCK) || tdb->map_ptr == NULL ||
+	    tdb->transaction != NULL) {
+		return false;
+	}
+
+	counter = tdb_seqlock_ptr(tdb,
+				  BUCKET(hash) % tdb->header.seqlock_count);
+
+	for (i = 0; i < TDB_SEQLOCK_RETRIES; i++) {
+		seq = *counter;
+		if (seq & 1) {
+			/* a writer holds the chain, wait for it in
+			 * the locked path */
+			return false;
+		}
+		tdb_seqlock_barrier();
+
+		ok = tdb_seqlock_find(tdb, key, hash, data, found);
+
+		tdb_seqlock_barrier();
+		if (*counter == seq) {
+			/* a stable chain we can't walk is for the
+			 * locked path to diagnose */
+			return ok;
+		}
+		if (ok && *found && data != NULL) {
+			SAFE_FREE(data->dptr);
+		}
+	}
+#endif
+	return false;
+}
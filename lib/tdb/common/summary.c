@@ -67,10 +67,11 @@ static size_t tally_mean(const struct tally *tally)
 
 static size_t get_hash_length(struct tdb_context *tdb, unsigned int i)
 {
-	tdb_off_t rec_ptr;
+	tdb_off_t rec_ptr, top;
 	size_t count = 0;
 
-	if (tdb_ofs_read(tdb, TDB_HASH_TOP(i), &rec_ptr) == -1)
+	if (tdb_hash_top(tdb, i, &top) == -1 ||
+	    tdb_ofs_read(tdb, top, &rec_ptr) == -1)
 		return 0;
 
 	/* keep looking until we find the right record */
@@ -86,7 +87,8 @@ static size_t get_hash_length(struct tdb_context *tdb, unsigned int i)
 
 _PUBLIC_ char *tdb_summary(struct tdb_context *tdb)
 {
-	tdb_off_t off, rec_off;
+	tdb_off_t off, rec_off, table;
+	uint32_t buckets;
 	struct tally freet, keys, data, dead, extra, hash, uncoal;
 	struct tdb_record rec;
 	char *ret = NULL;
@@ -149,6 +151,11 @@ _PUBLIC_ char *tdb_summary(struct tdb_context *tdb)
 		case TDB_DEAD_MAGIC:
 			tally_add(&dead, rec.rec_len);
 			break;
+		case TDB_SEQLOCK_MAGIC:
+		case TDB_MUTEX_MAGIC:
+		case TDB_HASHTABLE_MAGIC:
+			/* part of the header, really */
+			break;
 		default:
 			TDB_LOG((tdb, TDB_DEBUG_ERROR,
 				 "Unexpected record magic 0x%x at offset %d\n",
@@ -159,7 +166,9 @@ _PUBLIC_ char *tdb_summary(struct tdb_context *tdb)
 	if (unc > 1)
 		tally_add(&uncoal, unc - 1);
 
-	for (off = 0; off < tdb->header.hash_size; off++)
+	if (tdb_hash_buckets(tdb, &table, &buckets) == -1)
+		goto unlock;
+	for (off = 0; off < buckets; off++)
 		tally_add(&hash, get_hash_length(tdb, off));
 
 	/* 20 is max length of a %zu. */
@@ -190,7 +199,7 @@ _PUBLIC_ char *tdb_summary(struct tdb_context *tdb)
 		 (keys.num + freet.num + dead.num)
 		 * (sizeof(struct tdb_record) + sizeof(uint32_t))
 		 * 100.0 / tdb->map_size,
-		 tdb->header.hash_size * sizeof(tdb_off_t)
+		 buckets * sizeof(tdb_off_t)
 		 * 100.0 / tdb->map_size);
 
 unlock:
@@ -79,10 +79,12 @@ static int tdb_key_compare(TDB_DATA key, TDB_DATA data, void *private_data)
 static tdb_off_t tdb_find(struct tdb_context *tdb, TDB_DATA key, uint32_t hash,
 			struct tdb_record *r)
 {
-	tdb_off_t rec_ptr;
+	tdb_off_t rec_ptr, top;
+	uint32_t chain_length = 0;
 
 	/* read in the hash top */
-	if (tdb_ofs_read(tdb, TDB_HASH_TOP(hash), &rec_ptr) == -1)
+	if (tdb_hash_top(tdb, hash, &top) == -1 ||
+	    tdb_ofs_read(tdb, top, &rec_ptr) == -1)
 		return 0;
 
 	/* keep looking until we find the right record */
@@ -90,11 +92,13 @@ static tdb_off_t tdb_find(struct tdb_context *tdb, TDB_DATA key, uint32_t hash,
 		if (tdb_rec_read(tdb, rec_ptr, r) == -1)
 			return 0;
 
+		chain_length++;
 		if (!TDB_DEAD(r) && hash==r->full_hash
 		    && key.dsize==r->key_len
 		    && tdb_parse_data(tdb, key, rec_ptr + sizeof(*r),
 				      r->key_len, tdb_key_compare,
 				      NULL) == 0) {
+			tdb_rehash_note(tdb, chain_length);
 			return rec_ptr;
 		}
 		/* detect tight infinite loop */
@@ -105,6 +109,7 @@ static tdb_off_t tdb_find(struct tdb_context *tdb, TDB_DATA key, uint32_t hash,
 		}
 		rec_ptr = r->next;
 	}
+	tdb_rehash_note(tdb, chain_length);
 	tdb->ecode = TDB_ERR_NOEXIST;
 	return 0;
 }
@@ -190,9 +195,19 @@ static TDB_DATA _tdb_fetch(struct tdb_context *tdb, TDB_DATA key)
 	struct tdb_record rec;
 	TDB_DATA ret;
 	uint32_t hash;
+	bool found;
 
 	/* find which hash bucket it is in */
 	hash = tdb->hash_fn(&key);
+
+	if (tdb_seqlock_fetch(tdb, key, hash, &ret, &found)) {
+		if (!found) {
+			tdb->ecode = TDB_ERR_NOEXIST;
+			return tdb_null;
+		}
+		return ret;
+	}
+
 	if (!(rec_ptr = tdb_find_lock_hash(tdb,key,hash,F_RDLCK,&rec)))
 		return tdb_null;
 
@@ -223,6 +238,9 @@ _PUBLIC_ TDB_DATA tdb_fetch(struct tdb_context *tdb, TDB_DATA key)
  * case. If a transaction is open or no mmap is available, it has to do
  * malloc/read/parse/free.
  *
+ * With TDB_SEQLOCK the record is copied out without taking the chain lock
+ * and the parser runs on the copy, with no lock held.
+ *
  * This is interesting for all readers of potentially large data structures in
  * the tdb records, ldb indexes being one example.
  *
@@ -236,12 +254,26 @@ _PUBLIC_ int tdb_parse_record(struct tdb_context *tdb, TDB_DATA key,
 {
 	tdb_off_t rec_ptr;
 	struct tdb_record rec;
+	TDB_DATA data;
 	int ret;
 	uint32_t hash;
+	bool found;
 
 	/* find which hash bucket it is in */
 	hash = tdb->hash_fn(&key);
 
+	if (tdb_seqlock_fetch(tdb, key, hash, &data, &found)) {
+		if (!found) {
+			tdb_trace_1rec_ret(tdb, "tdb_parse_record", key, -1);
+			tdb->ecode = TDB_ERR_NOEXIST;
+			return -1;
+		}
+		tdb_trace_1rec_ret(tdb, "tdb_parse_record", key, 0);
+		ret = parser(key, data, private_data);
+		SAFE_FREE(data.dptr);
+		return ret;
+	}
+
 	if (!(rec_ptr = tdb_find_lock_hash(tdb,key,hash,F_RDLCK,&rec))) {
 		/* record not found */
 		tdb_trace_1rec_ret(tdb, "tdb_parse_record", key, -1);
@@ -267,6 +299,11 @@ _PUBLIC_ int tdb_parse_record(struct tdb_context *tdb, TDB_DATA key,
 static int tdb_exists_hash(struct tdb_context *tdb, TDB_DATA key, uint32_t hash)
 {
 	struct tdb_record rec;
+	bool found;
+
+	if (tdb_seqlock_fetch(tdb, key, hash, NULL, &found)) {
+		return found ? 1 : 0;
+	}
 
 	if (tdb_find_lock_hash(tdb, key, hash, F_RDLCK, &rec) == 0)
 		return 0;
@@ -287,7 +324,7 @@ _PUBLIC_ int tdb_exists(struct tdb_context *tdb, TDB_DATA key)
 /* actually delete an entry in the database given the offset */
 int tdb_do_delete(struct tdb_context *tdb, tdb_off_t rec_ptr, struct tdb_record *rec)
 {
-	tdb_off_t last_ptr, i;
+	tdb_off_t last_ptr, i, top;
 	struct tdb_record lastrec;
 
 	if (tdb->read_only || tdb->traverse_read) return -1;
@@ -302,7 +339,8 @@ int tdb_do_delete(struct tdb_context *tdb, tdb_off_t rec_ptr, struct tdb_record
 		return -1;
 
 	/* find previous record in hash chain */
-	if (tdb_ofs_read(tdb, TDB_HASH_TOP(rec->full_hash), &i) == -1)
+	if (tdb_hash_top(tdb, rec->full_hash, &top) == -1 ||
+	    tdb_ofs_read(tdb, top, &i) == -1)
 		return -1;
 	for (last_ptr = 0; i != rec_ptr; last_ptr = i, i = lastrec.next)
 		if (tdb_rec_read(tdb, i, &lastrec) == -1)
@@ -310,7 +348,7 @@ int tdb_do_delete(struct tdb_context *tdb, tdb_off_t rec_ptr, struct tdb_record
 
 	/* unlink it: next ptr is at start of record. */
 	if (last_ptr == 0)
-		last_ptr = TDB_HASH_TOP(rec->full_hash);
+		last_ptr = top;
 	if (tdb_ofs_write(tdb, last_ptr, &rec->next) == -1)
 		return -1;
 
@@ -323,11 +361,12 @@ int tdb_do_delete(struct tdb_context *tdb, tdb_off_t rec_ptr, struct tdb_record
 static int tdb_count_dead(struct tdb_context *tdb, uint32_t hash)
 {
 	int res = 0;
-	tdb_off_t rec_ptr;
+	tdb_off_t rec_ptr, top;
 	struct tdb_record rec;
 
 	/* read in the hash top */
-	if (tdb_ofs_read(tdb, TDB_HASH_TOP(hash), &rec_ptr) == -1)
+	if (tdb_hash_top(tdb, hash, &top) == -1 ||
+	    tdb_ofs_read(tdb, top, &rec_ptr) == -1)
 		return 0;
 
 	while (rec_ptr) {
@@ -349,14 +388,15 @@ static int tdb_purge_dead(struct tdb_context *tdb, uint32_t hash)
 {
 	int res = -1;
 	struct tdb_record rec;
-	tdb_off_t rec_ptr;
+	tdb_off_t rec_ptr, top;
 
 	if (tdb_lock(tdb, -1, F_WRLCK) == -1) {
 		return -1;
 	}
 
 	/* read in the hash top */
-	if (tdb_ofs_read(tdb, TDB_HASH_TOP(hash), &rec_ptr) == -1)
+	if (tdb_hash_top(tdb, hash, &top) == -1 ||
+	    tdb_ofs_read(tdb, top, &rec_ptr) == -1)
 		goto fail;
 
 	while (rec_ptr) {
@@ -438,6 +478,10 @@ _PUBLIC_ int tdb_delete(struct tdb_context *tdb, TDB_DATA key)
 	uint32_t hash = tdb->hash_fn(&key);
 	int ret;
 
+	if (tdb_write_needs_transaction(tdb, "tdb_delete")) {
+		return -1;
+	}
+
 	ret = tdb_delete_hash(tdb, key, hash);
 	tdb_trace_1rec_ret(tdb, "tdb_delete", key, ret);
 	return ret;
@@ -449,10 +493,11 @@ _PUBLIC_ int tdb_delete(struct tdb_context *tdb, TDB_DATA key)
 static tdb_off_t tdb_find_dead(struct tdb_context *tdb, uint32_t hash,
 			       struct tdb_record *r, tdb_len_t length)
 {
-	tdb_off_t rec_ptr;
+	tdb_off_t rec_ptr, top;
 
 	/* read in the hash top */
-	if (tdb_ofs_read(tdb, TDB_HASH_TOP(hash), &rec_ptr) == -1)
+	if (tdb_hash_top(tdb, hash, &top) == -1 ||
+	    tdb_ofs_read(tdb, top, &rec_ptr) == -1)
 		return 0;
 
 	/* keep looking until we find the right record */
@@ -476,7 +521,7 @@ static int _tdb_store(struct tdb_context *tdb, TDB_DATA key,
 		       TDB_DATA dbuf, int flag, uint32_t hash)
 {
 	struct tdb_record rec;
-	tdb_off_t rec_ptr;
+	tdb_off_t rec_ptr, top;
 	int ret = -1;
 
 	/* check for it existing, on insert. */
@@ -561,7 +606,8 @@ static int _tdb_store(struct tdb_context *tdb, TDB_DATA key,
 	}
 
 	/* Read hash top into next ptr */
-	if (tdb_ofs_read(tdb, TDB_HASH_TOP(hash), &rec.next) == -1)
+	if (tdb_hash_top(tdb, hash, &top) == -1 ||
+	    tdb_ofs_read(tdb, top, &rec.next) == -1)
 		goto fail;
 
 	rec.key_len = key.dsize;
@@ -575,7 +621,7 @@ static int _tdb_store(struct tdb_context *tdb, TDB_DATA key,
 				       key.dptr, key.dsize) == -1
 	    || tdb->methods->tdb_write(tdb, rec_ptr+sizeof(rec)+key.dsize,
 				       dbuf.dptr, dbuf.dsize) == -1
-	    || tdb_ofs_write(tdb, TDB_HASH_TOP(hash), &rec_ptr) == -1) {
+	    || tdb_ofs_write(tdb, top, &rec_ptr) == -1) {
 		/* Need to tdb_unallocate() here */
 		goto fail;
 	}
@@ -604,6 +650,9 @@ _PUBLIC_ int tdb_store(struct tdb_context *tdb, TDB_DATA key, TDB_DATA dbuf, int
 		tdb_trace_2rec_flag_ret(tdb, "tdb_store", key, dbuf, flag, -1);
 		return -1;
 	}
+	if (tdb_write_needs_transaction(tdb, "tdb_store")) {
+		return -1;
+	}
 
 	/* find which hash bucket it is in */
 	hash = tdb->hash_fn(&key);
@@ -613,6 +662,7 @@ _PUBLIC_ int tdb_store(struct tdb_context *tdb, TDB_DATA key, TDB_DATA dbuf, int
 	ret = _tdb_store(tdb, key, dbuf, flag, hash);
 	tdb_trace_2rec_flag_ret(tdb, "tdb_store", key, dbuf, flag, ret);
 	tdb_unlock(tdb, BUCKET(hash), F_WRLCK);
+	tdb_rehash_maybe(tdb);
 	return ret;
 }
 
@@ -623,6 +673,10 @@ _PUBLIC_ int tdb_append(struct tdb_context *tdb, TDB_DATA key, TDB_DATA new_dbuf
 	TDB_DATA dbuf;
 	int ret = -1;
 
+	if (tdb_write_needs_transaction(tdb, "tdb_append")) {
+		return -1;
+	}
+
 	/* find which hash bucket it is in */
 	hash = tdb->hash_fn(&key);
 	if (tdb_lock(tdb, BUCKET(hash), F_WRLCK) == -1)
@@ -660,6 +714,97 @@ _PUBLIC_ int tdb_append(struct tdb_context *tdb, TDB_DATA key, TDB_DATA new_dbuf
 failed:
 	tdb_unlock(tdb, BUCKET(hash), F_WRLCK);
 	SAFE_FREE(dbuf.dptr);
+	tdb_rehash_maybe(tdb);
+	return ret;
+}
+
+/*
+  Overwrite part of an existing entry and set its new data size. The
+  record is changed where it lies if its allocation has room for
+  new_size bytes, only a growing record has to be rewritten as a whole.
+*/
+_PUBLIC_ int tdb_store_range(struct tdb_context *tdb, TDB_DATA key,
+			     uint32_t offset, TDB_DATA buf, uint32_t new_size)
+{
+	struct tdb_record rec;
+	tdb_off_t rec_ptr;
+	uint32_t hash;
+	TDB_DATA dbuf;
+	int ret = -1;
+
+	if (tdb->read_only || tdb->traverse_read) {
+		tdb->ecode = TDB_ERR_RDONLY;
+		return -1;
+	}
+	if (tdb_write_needs_transaction(tdb, "tdb_store_range")) {
+		return -1;
+	}
+	if ((offset + buf.dsize < offset) ||
+	    (offset + buf.dsize > new_size)) {
+		tdb->ecode = TDB_ERR_EINVAL;
+		return -1;
+	}
+
+	/* find which hash bucket it is in */
+	hash = tdb->hash_fn(&key);
+	if (tdb_lock(tdb, BUCKET(hash), F_WRLCK) == -1)
+		return -1;
+
+	if (!(rec_ptr = tdb_find(tdb, key, hash, &rec)))
+		goto failed;
+
+	/* no holes: everything up to new_size must be defined */
+	if ((offset > rec.data_len) ||
+	    ((new_size > rec.data_len) && (new_size > offset + buf.dsize))) {
+		tdb->ecode = TDB_ERR_EINVAL;
+		goto failed;
+	}
+
+	/* must be long enough key, data and tailer */
+	if (rec.rec_len >= rec.key_len + new_size + sizeof(tdb_off_t)) {
+		if (buf.dsize != 0 &&
+		    tdb->methods->tdb_write(
+			    tdb, rec_ptr + sizeof(rec) + rec.key_len + offset,
+			    buf.dptr, buf.dsize) == -1) {
+			goto failed;
+		}
+		if (new_size != rec.data_len) {
+			rec.data_len = new_size;
+			if (tdb_rec_write(tdb, rec_ptr, &rec) == -1) {
+				goto failed;
+			}
+		}
+		tdb_increment_seqnum(tdb);
+		ret = 0;
+		goto failed;
+	}
+
+	/* no room, rewrite the record with the range applied */
+	dbuf.dptr = tdb_alloc_read(tdb, rec_ptr + sizeof(rec) + rec.key_len,
+				   rec.data_len);
+	if (dbuf.dptr == NULL) {
+		goto failed;
+	}
+	if (new_size > rec.data_len) {
+		unsigned char *new_dptr;
+
+		new_dptr = (unsigned char *)realloc(dbuf.dptr, new_size);
+		if (new_dptr == NULL) {
+			SAFE_FREE(dbuf.dptr);
+			tdb->ecode = TDB_ERR_OOM;
+			goto failed;
+		}
+		dbuf.dptr = new_dptr;
+	}
+	dbuf.dsize = new_size;
+	memcpy(dbuf.dptr + offset, buf.dptr, buf.dsize);
+
+	ret = _tdb_store(tdb, key, dbuf, TDB_MODIFY, hash);
+	SAFE_FREE(dbuf.dptr);
+
+failed:
+	tdb_unlock(tdb, BUCKET(hash), F_WRLCK);
+	tdb_rehash_maybe(tdb);
 	return ret;
 }
 
@@ -805,7 +950,8 @@ static int tdb_free_region(struct tdb_context *tdb, tdb_off_t offset, ssize_t le
   very fast by using a allrecord lock. The entire data portion of the
   file becomes a single entry in the freelist.
 
-  This code carefully steps around the recovery area, leaving it alone
+  This code carefully steps around the recovery area, leaving it alone.
+  The same goes for the seqlock counters, which always come first.
  */
 _PUBLIC_ int tdb_wipe_all(struct tdb_context *tdb)
 {
@@ -814,6 +960,11 @@ _PUBLIC_ int tdb_wipe_all(struct tdb_context *tdb)
 	ssize_t data_len;
 	tdb_off_t recovery_head;
 	tdb_len_t recovery_size = 0;
+	tdb_off_t data_start;
+
+	if (tdb_write_needs_transaction(tdb, "tdb_wipe_all")) {
+		return -1;
+	}
 
 	if (tdb_lockall(tdb) != 0) {
 		return -1;
@@ -821,6 +972,8 @@ _PUBLIC_ int tdb_wipe_all(struct tdb_context *tdb)
 
 	tdb_trace(tdb, "tdb_wipe_all");
 
+	data_start = tdb_data_start(tdb);
+
 	/* see if the tdb has a recovery area, and remember its size
 	   if so. We don't want to lose this as otherwise each
 	   tdb_wipe_all() in a transaction will increase the size of
@@ -847,6 +1000,12 @@ _PUBLIC_ int tdb_wipe_all(struct tdb_context *tdb)
 		}
 	}
 
+	/* go back to those, the bucket array goes with the data */
+	if (tdb_rehash_reset(tdb) == -1) {
+		TDB_LOG((tdb, TDB_DEBUG_FATAL,"tdb_wipe_all: failed to reset buckets\n"));
+		goto failed;
+	}
+
 	/* wipe the freelist */
 	if (tdb_ofs_write(tdb, FREELIST_TOP, &offset) == -1) {
 		TDB_LOG((tdb, TDB_DEBUG_FATAL,"tdb_wipe_all: failed to write freelist\n"));
@@ -857,8 +1016,8 @@ _PUBLIC_ int tdb_wipe_all(struct tdb_context *tdb)
 	   for the recovery area */
 	if (recovery_size == 0) {
 		/* the simple case - the whole file can be used as a freelist */
-		data_len = (tdb->map_size - TDB_DATA_START(tdb->header.hash_size));
-		if (tdb_free_region(tdb, TDB_DATA_START(tdb->header.hash_size), data_len) != 0) {
+		data_len = (tdb->map_size - data_start);
+		if (tdb_free_region(tdb, data_start, data_len) != 0) {
 			goto failed;
 		}
 	} else {
@@ -870,8 +1029,8 @@ _PUBLIC_ int tdb_wipe_all(struct tdb_context *tdb)
 		   move the recovery area or we risk subtle data
 		   corruption
 		*/
-		data_len = (recovery_head - TDB_DATA_START(tdb->header.hash_size));
-		if (tdb_free_region(tdb, TDB_DATA_START(tdb->header.hash_size), data_len) != 0) {
+		data_len = (recovery_head - data_start);
+		if (tdb_free_region(tdb, data_start, data_len) != 0) {
 			goto failed;
 		}
 		/* and the 2nd free list entry after the recovery area - if any */
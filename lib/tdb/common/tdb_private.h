@@ -31,6 +31,12 @@
 #include "system/wait.h"
 #include "tdb.h"
 
+#if defined(HAVE_PTHREAD_MUTEXATTR_SETROBUST) && \
+	defined(HAVE_PTHREAD_MUTEX_CONSISTENT)
+#define USE_TDB_MUTEX_LOCKING 1
+#include <pthread.h>
+#endif
+
 /* #define TDB_TRACE 1 */
 #ifndef HAVE_GETPAGESIZE
 #define getpagesize() 0x2000
@@ -51,6 +57,10 @@ typedef uint32_t tdb_off_t;
 #define TDB_RECOVERY_MAGIC (0xf53bc0e7U)
 #define TDB_RECOVERY_INVALID_MAGIC (0x0)
 #define TDB_HASH_RWLOCK_MAGIC (0xbad1a51U)
+#define TDB_FEATURE_FLAG_MAGIC (0xbad1a52U)
+#define TDB_SEQLOCK_MAGIC (0x5e91c0deU)
+#define TDB_MUTEX_MAGIC (0x3e7e0c4bU)
+#define TDB_HASHTABLE_MAGIC (0x4a5eb1e5U)
 #define TDB_ALIGNMENT 4
 #define DEFAULT_HASH_SIZE 131
 #define FREELIST_TOP (sizeof(struct tdb_header))
@@ -66,6 +76,31 @@ typedef uint32_t tdb_off_t;
 #define TDB_PAD_BYTE 0x42
 #define TDB_PAD_U32  0x42424242
 
+/* on-disk features, only valid if rwlocks == TDB_FEATURE_FLAG_MAGIC */
+#define TDB_FEATURE_FLAG_SEQLOCK 0x00000001
+#define TDB_FEATURE_FLAG_MUTEX 0x00000002
+#define TDB_FEATURE_FLAG_RESIZABLE_HASH 0x00000004
+#define TDB_FEATURE_FLAG_GROUP_COMMIT 0x00000008
+#define TDB_SUPPORTED_FEATURE_FLAGS \
+	(TDB_FEATURE_FLAG_SEQLOCK|TDB_FEATURE_FLAG_MUTEX| \
+	 TDB_FEATURE_FLAG_RESIZABLE_HASH|TDB_FEATURE_FLAG_GROUP_COMMIT)
+#define TDB_HAVE_FEATURE(tdb, f) \
+	((tdb)->header.rwlocks == TDB_FEATURE_FLAG_MAGIC && \
+	 ((tdb)->header.feature_flags & (f)))
+
+/* Feature areas are records behind the hash table. Their contents are
+   kept on their own transaction blocks, so a transaction commit never
+   writes back a stale copy of them. */
+#define TDB_FEATURE_AREA_ALIGN 4096
+#define TDB_SEQLOCK_RETRIES 10
+
+/* A lookup walking more records than this asks for a bigger bucket
+   array, which is then grown until there's at most one record per
+   bucket on average. */
+#define TDB_REHASH_CHAIN_LENGTH 32
+#define TDB_REHASH_MIN_AVERAGE 4
+#define TDB_REHASH_MAX_BUCKETS (1U<<24)
+
 /* NB assumes there is a local variable called "tdb" that is the
  * current context, also takes doubly-parenthesized print-style
  * argument. */
@@ -106,6 +141,7 @@ void tdb_trace_2rec_retrec(struct tdb_context *tdb, const char *op,
 #define OPEN_LOCK        0
 #define ACTIVE_LOCK      4
 #define TRANSACTION_LOCK 8
+#define GROUP_COMMIT_LOCK 12
 
 /* free memory if the pointer is valid and zero the pointer */
 #ifndef SAFE_FREE
@@ -150,7 +186,17 @@ struct tdb_header {
 	tdb_off_t sequence_number; /* used when TDB_SEQNUM is set */
 	uint32_t magic1_hash; /* hash of TDB_MAGIC_FOOD. */
 	uint32_t magic2_hash; /* hash of TDB_MAGIC. */
-	tdb_off_t reserved[27];
+	tdb_off_t feature_flags; /* TDB_FEATURE_FLAG_* */
+	tdb_off_t seqlock_start; /* offset of the seqlock counters */
+	tdb_off_t seqlock_count; /* number of seqlock counters */
+	tdb_off_t mutex_start; /* offset of the struct tdb_mutexes */
+	tdb_off_t mutex_size; /* size of the struct tdb_mutexes */
+	tdb_off_t hash_table; /* bucket array if grown, 0 otherwise. Changes
+				 under us, never use the cached copy */
+	tdb_off_t hash_buckets; /* number of buckets in hash_table */
+	tdb_off_t commit_seq; /* transactions committed, TDB_GROUP_COMMIT */
+	tdb_off_t synced_seq; /* commit_seq as of the last group sync */
+	tdb_off_t reserved[18];
 };
 
 struct tdb_lock_type {
@@ -209,6 +255,12 @@ struct tdb_context {
 	struct tdb_transaction *transaction;
 	int page_size;
 	int max_dead_records;
+	bool seqlock_all; /* we hold all seqlock counters odd */
+	struct tdb_mutexes *mutexes; /* NULL unless locking with mutexes */
+	void *mutex_map; /* where mutexes are mapped from */
+	size_t mutex_map_size;
+	bool rehash_wanted; /* a lookup found a long hash chain */
+	uint32_t rehash_skip; /* don't look at the average again so soon */
 #ifdef TDB_TRACE
 	int tracefd;
 #endif
@@ -258,6 +310,7 @@ int tdb_ofs_write(struct tdb_context *tdb, tdb_off_t offset, tdb_off_t *d);
 int tdb_lock_record(struct tdb_context *tdb, tdb_off_t off);
 int tdb_unlock_record(struct tdb_context *tdb, tdb_off_t off);
 bool tdb_needs_recovery(struct tdb_context *tdb);
+bool tdb_write_needs_transaction(struct tdb_context *tdb, const char *caller);
 int tdb_rec_read(struct tdb_context *tdb, tdb_off_t offset, struct tdb_record *rec);
 int tdb_rec_write(struct tdb_context *tdb, tdb_off_t offset, struct tdb_record *rec);
 int tdb_do_delete(struct tdb_context *tdb, tdb_off_t rec_ptr, struct tdb_record *rec);
@@ -280,3 +333,33 @@ void tdb_header_hash(struct tdb_context *tdb,
 		     uint32_t *magic1_hash, uint32_t *magic2_hash);
 unsigned int tdb_old_hash(TDB_DATA *key);
 size_t tdb_dead_space(struct tdb_context *tdb, tdb_off_t off);
+tdb_off_t tdb_feature_area_end(tdb_off_t start, tdb_len_t len);
+tdb_off_t tdb_data_start(struct tdb_context *tdb);
+bool tdb_have_seqlock(struct tdb_context *tdb);
+tdb_len_t tdb_seqlock_size(uint32_t count);
+void tdb_seqlock_write_begin(struct tdb_context *tdb, int list);
+void tdb_seqlock_write_end(struct tdb_context *tdb, int list);
+bool tdb_seqlock_write_begin_all(struct tdb_context *tdb);
+void tdb_seqlock_write_end_all(struct tdb_context *tdb);
+bool tdb_seqlock_fetch(struct tdb_context *tdb, TDB_DATA key, uint32_t hash,
+		       TDB_DATA *data, bool *found);
+bool tdb_mutex_supported(void);
+tdb_len_t tdb_mutex_size(uint32_t hash_size);
+int tdb_mutex_init(struct tdb_context *tdb);
+int tdb_mutex_mmap(struct tdb_context *tdb);
+int tdb_mutex_munmap(struct tdb_context *tdb);
+bool tdb_have_mutexes(struct tdb_context *tdb);
+bool tdb_mutex_lock(struct tdb_context *tdb, int rw, off_t off, off_t len,
+		    bool waitflag, int *pret);
+bool tdb_mutex_unlock(struct tdb_context *tdb, int rw, off_t off, off_t len,
+		      int *pret);
+int tdb_mutex_allrecord_lock(struct tdb_context *tdb, int ltype,
+			     enum tdb_lock_flags flags);
+int tdb_mutex_allrecord_unlock(struct tdb_context *tdb);
+void tdb_mutex_allrecord_upgrade(struct tdb_context *tdb);
+int tdb_hash_buckets(struct tdb_context *tdb, tdb_off_t *table,
+		     uint32_t *count);
+int tdb_hash_top(struct tdb_context *tdb, uint32_t hash, tdb_off_t *top);
+void tdb_rehash_note(struct tdb_context *tdb, uint32_t chain_length);
+void tdb_rehash_maybe(struct tdb_context *tdb);
+int tdb_rehash_reset(struct tdb_context *tdb);
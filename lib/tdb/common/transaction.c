@@ -81,6 +81,15 @@
     usual. This allows for smooth crash recovery with no administrator
     intervention.
 
+  - databases created with TDB_GROUP_COMMIT checksum the recovery
+    data, so it can be written together with its magic and synced
+    once: a torn recovery record is ignored on recovery. The last sync,
+    making the invalidated magic durable, happens after the locks are
+    dropped, and one process does it on behalf of all committers
+    waiting for it. Until then a crash rolls back the commit, which
+    nobody was told about yet, so only 2 syncs are done under the
+    locks. Other processes can see the data before it is durable.
+
   - if TDB_NOSYNC is passed to flags in tdb_open then transactions are
     still available, but no transaction recovery area is used and no
     fsync/msync calls are made.
@@ -370,6 +379,14 @@ static int transaction_write_existing(struct tdb_context *tdb, tdb_off_t off,
 static void transaction_next_hash_chain(struct tdb_context *tdb, uint32_t *chain)
 {
 	uint32_t h = *chain;
+	tdb_off_t table;
+	uint32_t count;
+
+	/* only the original hash table heads are cached */
+	if (tdb_hash_buckets(tdb, &table, &count) != 0 ||
+	    table != FREELIST_TOP + sizeof(tdb_off_t)) {
+		return;
+	}
 	for (;h < tdb->header.hash_size;h++) {
 		/* the +1 takes account of the freelist */
 		if (0 != tdb->transaction->hash_heads[h+1]) {
@@ -472,6 +489,13 @@ static int _tdb_transaction_start(struct tdb_context *tdb,
 	/* a page at a time seems like a reasonable compromise between compactness and efficiency */
 	tdb->transaction->block_size = tdb->page_size;
 
+	/* but never write back a stale copy of a feature area, like
+	   the seqlock counters or the mutexes */
+	if (tdb->header.rwlocks == TDB_FEATURE_FLAG_MAGIC &&
+	    tdb->transaction->block_size > TDB_FEATURE_AREA_ALIGN) {
+		tdb->transaction->block_size = TDB_FEATURE_AREA_ALIGN;
+	}
+
 	/* get the transaction write lock. This is a blocking lock. As
 	   discussed with Volker, there are a number of ways we could
 	   make this async, which we will probably do in the future */
@@ -574,6 +598,121 @@ static int transaction_sync(struct tdb_context *tdb, tdb_off_t offset, tdb_len_t
 }
 
 
+static bool transaction_group_commit(struct tdb_context *tdb)
+{
+	return TDB_HAVE_FEATURE(tdb, TDB_FEATURE_FLAG_GROUP_COMMIT);
+}
+
+/*
+  TDB_GROUP_COMMIT databases only sync in transaction commits, and a
+  commit leaves the invalidated recovery area unsynced until the
+  group sync. A write outside a transaction could land on top of a
+  recovery area that a crash would then replay, so refuse it.
+*/
+bool tdb_write_needs_transaction(struct tdb_context *tdb, const char *caller)
+{
+	if (tdb->transaction != NULL || !transaction_group_commit(tdb)) {
+		return false;
+	}
+	tdb->ecode = TDB_ERR_EINVAL;
+	TDB_LOG((tdb, TDB_DEBUG_ERROR, "%s: TDB_GROUP_COMMIT database "
+		 "can only be written in a transaction\n", caller));
+	return true;
+}
+
+/*
+  checksum of the recovery data for TDB_GROUP_COMMIT, covering the
+  eof and length kept in the recovery record
+*/
+static uint32_t transaction_recovery_hash(tdb_off_t eof, tdb_len_t len,
+					  unsigned char *data)
+{
+	uint32_t v[3];
+	TDB_DATA d;
+
+	d.dptr = data;
+	d.dsize = len;
+
+	v[0] = eof;
+	v[1] = len;
+	v[2] = tdb_jenkins_hash(&d);
+
+	d.dptr = (unsigned char *)v;
+	d.dsize = sizeof(v);
+	return tdb_jenkins_hash(&d);
+}
+
+/*
+  sync the file on behalf of all committers up to seq, unless someone
+  else already did. Called without any locks held.
+*/
+static int transaction_group_sync(struct tdb_context *tdb, tdb_off_t seq)
+{
+	tdb_off_t synced, committed;
+	int ret = -1;
+
+	if (tdb_nest_lock(tdb, GROUP_COMMIT_LOCK, F_WRLCK, TDB_LOCK_WAIT) == -1) {
+		return -1;
+	}
+
+	if (tdb_ofs_read(tdb, offsetof(struct tdb_header, synced_seq),
+			 &synced) == -1) {
+		goto out;
+	}
+	if ((int32_t)(synced - seq) >= 0) {
+		/* the last one holding the lock synced for us */
+		ret = 0;
+		goto out;
+	}
+
+	/* everything up to here will be on disk */
+	if (tdb_ofs_read(tdb, offsetof(struct tdb_header, commit_seq),
+			 &committed) == -1) {
+		goto out;
+	}
+	if (transaction_sync(tdb, 0, tdb->map_size) == -1) {
+		goto out;
+	}
+	if (tdb_ofs_write(tdb, offsetof(struct tdb_header, synced_seq),
+			  &committed) == -1) {
+		goto out;
+	}
+	ret = 0;
+out:
+	tdb_nest_unlock(tdb, GROUP_COMMIT_LOCK, F_WRLCK, false);
+	return ret;
+}
+
+/*
+  the commit is on disk: invalidate the recovery magic without syncing
+  it, and note which commit this was. Leaves the sync to
+  transaction_group_sync() or the cancel.
+*/
+static int transaction_group_invalidate(struct tdb_context *tdb,
+					tdb_off_t *seq)
+{
+	const struct tdb_methods *methods = tdb->transaction->io_methods;
+	uint32_t invalid = TDB_RECOVERY_INVALID_MAGIC;
+	tdb_off_t committed;
+
+	if (methods->tdb_read(tdb, offsetof(struct tdb_header, commit_seq),
+			      &committed, sizeof(committed), DOCONV()) == -1) {
+		return -1;
+	}
+	*seq = ++committed;
+
+	CONVERT(invalid);
+	CONVERT(committed);
+	if (methods->tdb_write(tdb, tdb->transaction->magic_offset,
+			       &invalid, sizeof(invalid)) == -1 ||
+	    methods->tdb_write(tdb, offsetof(struct tdb_header, commit_seq),
+			       &committed, sizeof(committed)) == -1) {
+		return -1;
+	}
+	tdb->transaction->magic_offset = 0;
+	return 0;
+}
+
 static int _tdb_transaction_cancel(struct tdb_context *tdb)
 {	
 	int i, ret = 0;
@@ -869,6 +1008,16 @@ static int transaction_setup_recovery(struct tdb_context *tdb,
 		tdb_convert(p, 4);
 	}
 
+	/* a torn write of this is caught by the checksum, so it can
+	   carry the magic right away */
+	if (transaction_group_commit(tdb)) {
+		rec->magic = TDB_RECOVERY_MAGIC;
+		rec->full_hash = transaction_recovery_hash(
+			old_map_size, recovery_size, data + sizeof(*rec));
+		CONVERT(rec->magic);
+		CONVERT(rec->full_hash);
+	}
+
 	/* write the recovery data to the recovery area */
 	if (methods->tdb_write(tdb, recovery_offset, data, sizeof(*rec) + recovery_size) == -1) {
 		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_transaction_setup_recovery: failed to write recovery data\n"));
@@ -893,11 +1042,16 @@ static int transaction_setup_recovery(struct tdb_context *tdb,
 
 	free(data);
 
+	*magic_offset = recovery_offset + offsetof(struct tdb_record, magic);
+
+	if (transaction_group_commit(tdb)) {
+		/* the magic went out with the checksummed data */
+		return 0;
+	}
+
 	magic = TDB_RECOVERY_MAGIC;
 	CONVERT(magic);
 
-	*magic_offset = recovery_offset + offsetof(struct tdb_record, magic);
-
 	if (methods->tdb_write(tdb, *magic_offset, &magic, sizeof(magic)) == -1) {
 		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_transaction_setup_recovery: failed to write recovery magic\n"));
 		tdb->ecode = TDB_ERR_IO;
@@ -1045,6 +1199,8 @@ _PUBLIC_ int tdb_transaction_commit(struct tdb_context *tdb)
 	const struct tdb_methods *methods;
 	int i;
 	bool need_repack = false;
+	bool group_sync = false;
+	tdb_off_t seq = 0;
 
 	if (tdb->transaction == NULL) {
 		TDB_LOG((tdb, TDB_DEBUG_ERROR, "tdb_transaction_commit: no transaction\n"));
@@ -1140,10 +1296,21 @@ _PUBLIC_ int tdb_transaction_commit(struct tdb_context *tdb)
 	utime(tdb->name, NULL);
 #endif
 
+	if (transaction_group_commit(tdb) && tdb->transaction->magic_offset &&
+	    transaction_group_invalidate(tdb, &seq) == 0) {
+		group_sync = true;
+	}
+
 	/* use a transaction cancel to free memory and remove the
 	   transaction locks */
 	_tdb_transaction_cancel(tdb);
 
+	if (group_sync && transaction_group_sync(tdb, seq) == -1) {
+		TDB_LOG((tdb, TDB_DEBUG_FATAL, "tdb_transaction_commit: "
+			 "group sync failed\n"));
+		return -1;
+	}
+
 	if (need_repack) {
 		return tdb_repack(tdb);
 	}
@@ -1157,7 +1324,7 @@ _PUBLIC_ int tdb_transaction_commit(struct tdb_context *tdb)
   database write access already established (including the open
   lock to prevent new processes attaching)
 */
-int tdb_transaction_recover(struct tdb_context *tdb)
+static int _tdb_transaction_recover(struct tdb_context *tdb)
 {
 	tdb_off_t recovery_head, recovery_eof;
 	unsigned char *data, *p;
@@ -1212,6 +1379,16 @@ int tdb_transaction_recover(struct tdb_context *tdb)
 		return -1;
 	}
 
+	/* torn on the way to disk, before the commit touched anything */
+	if (transaction_group_commit(tdb) &&
+	    rec.full_hash != transaction_recovery_hash(recovery_eof,
+						       rec.data_len, data)) {
+		free(data);
+		TDB_LOG((tdb, TDB_DEBUG_WARNING, "tdb_transaction_recover: "
+			 "ignoring recovery data with bad checksum\n"));
+		goto remove_magic;
+	}
+
 	/* recover the file data */
 	p = data;
 	while (p+8 < data + rec.data_len) {
@@ -1248,6 +1425,7 @@ int tdb_transaction_recover(struct tdb_context *tdb)
 		}
 	}
 
+remove_magic:
 	/* remove the recovery magic */
 	if (tdb_ofs_write(tdb, recovery_head + offsetof(struct tdb_record, magic),
 			  &zero) == -1) {
@@ -1269,6 +1447,24 @@ int tdb_transaction_recover(struct tdb_context *tdb)
 	return 0;
 }
 
+int tdb_transaction_recover(struct tdb_context *tdb)
+{
+	bool seqlocked;
+	int ret;
+
+	if (!tdb_have_seqlock(tdb) || !tdb_needs_recovery(tdb)) {
+		return _tdb_transaction_recover(tdb);
+	}
+
+	/* lock-free readers must not see the half recovered file */
+	seqlocked = tdb_seqlock_write_begin_all(tdb);
+	ret = _tdb_transaction_recover(tdb);
+	if (seqlocked) {
+		tdb_seqlock_write_end_all(tdb);
+	}
+	return ret;
+}
+
 /* Any I/O failures we say "needs recovery". */
 bool tdb_needs_recovery(struct tdb_context *tdb)
 {
@@ -80,6 +80,10 @@ extern "C" {
 #define TDB_ALLOW_NESTING 512 /** Allow transactions to nest */
 #define TDB_DISALLOW_NESTING 1024 /** Disallow transactions to nest */
 #define TDB_INCOMPATIBLE_HASH 2048 /** Better hashing: can't be opened by tdb < 1.2.6. */
+#define TDB_SEQLOCK 4096 /** Lock-free reads via per-chain sequence counters: can't be opened by tdb < 1.2.10. */
+#define TDB_MUTEX_LOCKING 8192 /** Lock chains with robust process shared mutexes: can't be opened by tdb < 1.2.10. */
+#define TDB_RESIZABLE_HASH 16384 /** Grow the hash table as chains get long: can't be opened by tdb < 1.2.10. */
+#define TDB_GROUP_COMMIT 32768 /** Share the last sync of transaction commits between processes: can't be opened by tdb < 1.2.10. */
 
 /** The tdb error codes */
 enum TDB_ERROR {TDB_SUCCESS=0, TDB_ERR_CORRUPT, TDB_ERR_IO, TDB_ERR_LOCK, 
@@ -143,6 +147,31 @@ struct tdb_logging_context {
  *                                        default 5.\n
  *                         TDB_ALLOW_NESTING - Allow transactions to nest.\n
  *                         TDB_DISALLOW_NESTING - Disallow transactions to nest.\n
+ *                         TDB_SEQLOCK - Read records without taking the
+ *                                       chain lock, retrying if a writer
+ *                                       changed the chain meanwhile. Only
+ *                                       effective for mmap'ed databases
+ *                                       created with this flag.\n
+ *                         TDB_MUTEX_LOCKING - Lock hash chains with robust
+ *                                       process shared mutexes instead of
+ *                                       fcntl locks. Only effective when
+ *                                       creating the database, all openers
+ *                                       use them then. Ignored if the
+ *                                       platform lacks robust mutexes.\n
+ *                         TDB_RESIZABLE_HASH - Grow the number of hash
+ *                                       chains when they get long, in a
+ *                                       transaction of its own. The
+ *                                       hash_size stays the number of
+ *                                       chain locks. Only effective when
+ *                                       creating the database.\n
+ *                         TDB_GROUP_COMMIT - Checksum the transaction
+ *                                       recovery data and share the last
+ *                                       sync of a commit with concurrent
+ *                                       committers, after dropping the
+ *                                       locks. Only effective when
+ *                                       creating the database, which
+ *                                       can then only be written in
+ *                                       transactions.\n
  *
  * @param[in]  open_flags Flags for the open(2) function.
  *
@@ -179,6 +208,31 @@ struct tdb_context *tdb_open(const char *name, int hash_size, int tdb_flags,
  *                                        default 5.\n
  *                         TDB_ALLOW_NESTING - Allow transactions to nest.\n
  *                         TDB_DISALLOW_NESTING - Disallow transactions to nest.\n
+ *                         TDB_SEQLOCK - Read records without taking the
+ *                                       chain lock, retrying if a writer
+ *                                       changed the chain meanwhile. Only
+ *                                       effective for mmap'ed databases
+ *                                       created with this flag.\n
+ *                         TDB_MUTEX_LOCKING - Lock hash chains with robust
+ *                                       process shared mutexes instead of
+ *                                       fcntl locks. Only effective when
+ *                                       creating the database, all openers
+ *                                       use them then. Ignored if the
+ *                                       platform lacks robust mutexes.\n
+ *                         TDB_RESIZABLE_HASH - Grow the number of hash
+ *                                       chains when they get long, in a
+ *                                       transaction of its own. The
+ *                                       hash_size stays the number of
+ *                                       chain locks. Only effective when
+ *                                       creating the database.\n
+ *                         TDB_GROUP_COMMIT - Checksum the transaction
+ *                                       recovery data and share the last
+ *                                       sync of a commit with concurrent
+ *                                       committers, after dropping the
+ *                                       locks. Only effective when
+ *                                       creating the database, which
+ *                                       can then only be written in
+ *                                       transactions.\n
  *
  * @param[in]  open_flags Flags for the open(2) function.
  *
@@ -358,6 +412,37 @@ int tdb_store(struct tdb_context *tdb, TDB_DATA key, TDB_DATA dbuf, int flag);
  */
 int tdb_append(struct tdb_context *tdb, TDB_DATA key, TDB_DATA new_dbuf);
 
+/**
+ * @brief Overwrite part of an existing entry.
+ *
+ * The data in buf is written at the given offset into the entry, and the
+ * entry's data size is set to new_size. This can change a few bytes of a
+ * large entry, append to it or cut it short without the caller copying
+ * the whole entry. The entry is updated where it lies if there is room
+ * for new_size bytes, otherwise it is rewritten.
+ *
+ * The offset must not be beyond the current end of the entry, and no
+ * bytes between the old end and new_size may be left undefined.
+ *
+ * @param[in]  tdb      The database to use.
+ *
+ * @param[in]  key      The key of the entry to change.
+ *
+ * @param[in]  offset   The offset into the data to write buf to.
+ *
+ * @param[in]  buf      The data to write.
+ *
+ * @param[in]  new_size The data size of the entry afterwards.
+ *
+ * @return              0 on success, -1 on error with error code set.
+ *                      TDB_ERR_NOEXIST if the entry does not exist.
+ *
+ * @see tdb_error()
+ * @see tdb_errorstr()
+ */
+int tdb_store_range(struct tdb_context *tdb, TDB_DATA key,
+		    uint32_t offset, TDB_DATA buf, uint32_t new_size);
+
 /**
  * @brief Close a database.
  *
@@ -13,7 +13,7 @@ if test x"$tdbdir" = "x"; then
    AC_MSG_ERROR([cannot find tdb source in $tdbpaths])
 fi
 TDB_OBJ="common/tdb.o common/dump.o common/transaction.o common/error.o common/traverse.o"
-TDB_OBJ="$TDB_OBJ common/freelist.o common/freelistcheck.o common/io.o common/lock.o common/open.o common/check.o common/hash.o common/summary.o"
+TDB_OBJ="$TDB_OBJ common/freelist.o common/freelistcheck.o common/io.o common/lock.o common/open.o common/check.o common/hash.o common/summary.o common/seqlock.o common/mutex.o common/rehash.o"
 AC_SUBST(TDB_OBJ)
 AC_SUBST(LIBREPLACEOBJ)
 
@@ -24,6 +24,13 @@ TDB_DEPS=""
 if test x$libreplace_cv_HAVE_FDATASYNC_IN_LIBRT = xyes ; then
 	TDB_DEPS="$TDB_DEPS -lrt"
 fi
+
+AC_CHECK_HEADERS(pthread.h)
+AC_SEARCH_LIBS(pthread_mutex_consistent, pthread)
+AC_CHECK_FUNCS(pthread_mutexattr_setrobust pthread_mutex_consistent)
+if test x"$ac_cv_search_pthread_mutex_consistent" = x"-lpthread"; then
+	TDB_DEPS="$TDB_DEPS -lpthread"
+fi
 AC_SUBST(TDB_DEPS)
 
 TDB_CFLAGS="-I$tdbdir/include"
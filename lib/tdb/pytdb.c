@@ -591,6 +591,10 @@ void inittdb(void)
 	PyModule_AddObject(m, "ALLOW_NESTING", PyInt_FromLong(TDB_ALLOW_NESTING));
 	PyModule_AddObject(m, "DISALLOW_NESTING", PyInt_FromLong(TDB_DISALLOW_NESTING));
 	PyModule_AddObject(m, "INCOMPATIBLE_HASH", PyInt_FromLong(TDB_INCOMPATIBLE_HASH));
+	PyModule_AddObject(m, "SEQLOCK", PyInt_FromLong(TDB_SEQLOCK));
+	PyModule_AddObject(m, "MUTEX_LOCKING", PyInt_FromLong(TDB_MUTEX_LOCKING));
+	PyModule_AddObject(m, "RESIZABLE_HASH", PyInt_FromLong(TDB_RESIZABLE_HASH));
+	PyModule_AddObject(m, "GROUP_COMMIT", PyInt_FromLong(TDB_GROUP_COMMIT));
 
 	PyModule_AddObject(m, "__docformat__", PyString_FromString("restructuredText"));
 
@@ -17,6 +17,7 @@
 #define DELETE_PROB 8
 #define STORE_PROB 4
 #define APPEND_PROB 6
+#define STORE_RANGE_PROB 8
 #define TRANSACTION_PROB 10
 #define TRANSACTION_PREPARE_PROB 2
 #define LOCKSTORE_PROB 5
@@ -25,11 +26,14 @@
 #define CULL_PROB 100
 #define KEYLEN 3
 #define DATALEN 100
+#define COMMIT_COUNT_KEY "commit-count"
+#define COMMIT_LOG_KEY "commit-log"
 
 static struct tdb_context *db;
 static int in_transaction;
 static int error_count;
 static int always_transaction = 0;
+static int tdb_flags = TDB_DEFAULT;
 static int hash_size = 2;
 static int loopnum;
 static int count_pipe;
@@ -81,9 +85,78 @@ static char *randbuf(int len)
 	return buf;
 }
 
+static TDB_DATA string_key(const char *str)
+{
+	TDB_DATA key;
+
+	key.dptr = (unsigned char *)discard_const_p(char, str);
+	key.dsize = strlen(str);
+	return key;
+}
+
+/*
+  With TDB_GROUP_COMMIT every transaction bumps a counter and appends
+  a byte to a log in another chain. Children get killed half way
+  through commits, so a mismatch means a commit was torn or replayed
+  wrongly by the recovery of the next opener.
+*/
+static void count_commit(void)
+{
+	TDB_DATA key, data;
+	uint32_t count = 0;
+	unsigned char c = 'c';
+
+	key = string_key(COMMIT_COUNT_KEY);
+	data = tdb_fetch(db, key);
+	if (data.dsize == sizeof(count)) {
+		memcpy(&count, data.dptr, sizeof(count));
+	}
+	free(data.dptr);
+	count++;
+
+	data.dptr = (unsigned char *)&count;
+	data.dsize = sizeof(count);
+	if (tdb_store(db, key, data, TDB_REPLACE) != 0) {
+		fatal("tdb_store failed");
+	}
+
+	data.dptr = &c;
+	data.dsize = 1;
+	if (tdb_append(db, string_key(COMMIT_LOG_KEY), data) != 0) {
+		fatal("tdb_append failed");
+	}
+}
+
+static void check_commits(void)
+{
+	TDB_DATA data;
+	uint32_t count = 0;
+	size_t logged;
+
+	data = tdb_fetch(db, string_key(COMMIT_COUNT_KEY));
+	if (data.dsize == sizeof(count)) {
+		memcpy(&count, data.dptr, sizeof(count));
+	}
+	free(data.dptr);
+
+	data = tdb_fetch(db, string_key(COMMIT_LOG_KEY));
+	logged = data.dsize;
+	free(data.dptr);
+
+	if (count != logged) {
+		printf("commit count %u but %u commits logged\n",
+		       (unsigned)count, (unsigned)logged);
+		error_count++;
+	}
+}
+
 static int cull_traverse(struct tdb_context *tdb, TDB_DATA key, TDB_DATA dbuf,
 			 void *state)
 {
+	if (key.dsize > KEYLEN + 1) {
+		/* the commit counter and log go together */
+		return 0;
+	}
 #if CULL_PROB
 	if (random() % CULL_PROB == 0) {
 		tdb_delete(tdb, key);
@@ -124,6 +197,9 @@ static void addrec_db(void)
 			fatal("tdb_transaction_start failed");
 		}
 		in_transaction++;
+		if (tdb_flags & TDB_GROUP_COMMIT) {
+			count_commit();
+		}
 		goto next;
 	}
 	if (in_transaction && random() % TRANSACTION_PROB == 0) {
@@ -172,6 +248,41 @@ static void addrec_db(void)
 	}
 #endif
 
+#if STORE_RANGE_PROB
+	if (random() % STORE_RANGE_PROB == 0) {
+		TDB_DATA old, check;
+		uint32_t offset, new_size, end;
+
+		tdb_chainlock(db, key);
+		old = tdb_fetch(db, key);
+		if (old.dptr != NULL) {
+			offset = random() % (old.dsize + 1);
+			end = offset + data.dsize;
+			new_size = end;
+			if (end < old.dsize && random() % 2) {
+				new_size = old.dsize;
+			}
+			if (tdb_store_range(db, key, offset, data,
+					    new_size) != 0) {
+				fatal("tdb_store_range failed");
+			}
+			check = tdb_fetch(db, key);
+			if (check.dsize != new_size ||
+			    memcmp(check.dptr, old.dptr, offset) != 0 ||
+			    memcmp(check.dptr + offset, data.dptr,
+				   data.dsize) != 0 ||
+			    memcmp(check.dptr + end, old.dptr + end,
+				   new_size - end) != 0) {
+				fatal("tdb_store_range stored wrong data");
+			}
+			free(check.dptr);
+			free(old.dptr);
+		}
+		tdb_chainunlock(db, key);
+		goto next;
+	}
+#endif
+
 #if LOCKSTORE_PROB
 	if (random() % LOCKSTORE_PROB == 0) {
 		tdb_chainlock(db, key);
@@ -216,7 +327,7 @@ static int traverse_fn(struct tdb_context *tdb, TDB_DATA key, TDB_DATA dbuf,
 
 static void usage(void)
 {
-	printf("Usage: tdbtorture [-t] [-k] [-n NUM_PROCS] [-l NUM_LOOPS] [-s SEED] [-H HASH_SIZE]\n");
+	printf("Usage: tdbtorture [-t] [-k] [-r] [-m] [-g] [-c] [-n NUM_PROCS] [-l NUM_LOOPS] [-s SEED] [-H HASH_SIZE]\n");
 	exit(0);
 }
 
@@ -230,7 +341,7 @@ static void send_count_and_suicide(int sig)
 
 static int run_child(const char *filename, int i, int seed, unsigned num_loops, unsigned start)
 {
-	db = tdb_open_ex(filename, hash_size, TDB_DEFAULT,
+	db = tdb_open_ex(filename, hash_size, tdb_flags,
 			 O_RDWR | O_CREAT, 0600, &log_ctx, NULL);
 	if (!db) {
 		fatal("db open failed");
@@ -239,6 +350,15 @@ static int run_child(const char *filename, int i, int seed, unsigned num_loops,
 	srand(seed + i);
 	srandom(seed + i);
 
+	if (db && (tdb_flags & TDB_GROUP_COMMIT)) {
+		/* the open recovered whatever a killed child left */
+		if (tdb_transaction_start(db) != 0) {
+			fatal("tdb_transaction_start failed");
+		}
+		check_commits();
+		tdb_transaction_cancel(db);
+	}
+
 	/* Set global, then we're ready to handle being killed. */
 	loopnum = start;
 	signal(SIGUSR1, send_count_and_suicide);
@@ -256,6 +376,9 @@ static int run_child(const char *filename, int i, int seed, unsigned num_loops,
 			}
 			if (tdb_transaction_start(db) != 0)
 				fatal("tdb_transaction_start failed");
+			if (tdb_flags & TDB_GROUP_COMMIT) {
+				check_commits();
+			}
 		}
 		tdb_traverse(db, traverse_fn, NULL);
 		tdb_traverse(db, traverse_fn, NULL);
@@ -302,7 +425,7 @@ int main(int argc, char * const *argv)
 
 	log_ctx.log_fn = tdb_log;
 
-	while ((c = getopt(argc, argv, "n:l:s:H:thk")) != -1) {
+	while ((c = getopt(argc, argv, "n:l:s:H:thkrmgc")) != -1) {
 		switch (c) {
 		case 'n':
 			num_procs = strtol(optarg, NULL, 0);
@@ -322,6 +445,20 @@ int main(int argc, char * const *argv)
 		case 'k':
 			kill_random = 1;
 			break;
+		case 'r':
+			tdb_flags |= TDB_SEQLOCK;
+			break;
+		case 'm':
+			tdb_flags |= TDB_MUTEX_LOCKING;
+			break;
+		case 'g':
+			tdb_flags |= TDB_RESIZABLE_HASH;
+			break;
+		case 'c':
+			/* can only be written in transactions */
+			tdb_flags |= TDB_GROUP_COMMIT;
+			always_transaction = 1;
+			break;
 		default:
 			usage();
 		}
@@ -435,7 +572,7 @@ int main(int argc, char * const *argv)
 
 done:
 	if (error_count == 0) {
-		db = tdb_open_ex(test_tdb, hash_size, TDB_DEFAULT,
+		db = tdb_open_ex(test_tdb, hash_size, tdb_flags,
 				 O_RDWR, 0, &log_ctx, NULL);
 		if (!db) {
 			fatal("db open failed");
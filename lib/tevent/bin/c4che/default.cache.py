@@ -0,0 +1,467 @@
+ABI_CHECK = False
+AR = '/usr/bin/ar'
+ARFLAGS = 'rcs'
+AUTOCONF_BUILD = ''
+AUTOCONF_HOST = ''
+AUTOCONF_PROGRAM_PREFIX = ''
+BINDIR = '${PREFIX}/bin'
+BUILD_DIRECTORY = '/root/repo/lib/tevent/bin'
+BUILD_SYSTEM = 'Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux'
+BUILTIN_LIBRARIES = ['replace']
+BUNDLED_LIBS = ['']
+CC = ['/usr/bin/gcc']
+CCDEFINES = ['_GNU_SOURCE=1', '_XOPEN_SOURCE_EXTENDED=1']
+CCDEFINES_ST = '-D%s'
+CCFLAGS_DEBUG = ['-g']
+CCFLAGS_MACBUNDLE = ['-fPIC']
+CCFLAGS_PYEMBED = ['-fno-strict-aliasing']
+CCFLAGS_PYEXT = ['-fno-strict-aliasing']
+CCFLAGS_RELEASE = ['-O2']
+CCFLAGS_crypt = []
+CCLNK_SRC_F = ''
+CCLNK_TGT_F = ['-o', '']
+CC_NAME = 'gcc'
+CC_SRC_F = ''
+CC_TGT_F = ['-c', '-o', '']
+CC_VERSION = ('12', '2', '0')
+COMPILER_CC = 'gcc'
+CPP = '/usr/bin/cpp'
+CPPPATH_PYEMBED = ['/root/.pyenv/versions/2.7.18/include/python2.7']
+CPPPATH_PYEXT = ['/root/.pyenv/versions/2.7.18/include/python2.7']
+CPPPATH_ST = '-I%s'
+CROSS_ANSWERS = ''
+CROSS_COMPILE = False
+CROSS_EXECUTE = ''
+DATADIR = '/usr/local/share'
+DATAROOTDIR = '/usr/local/share'
+DEST_BINFMT = 'elf'
+DEST_CPU = 'x86_64'
+DEST_OS = 'linux'
+DISABLE_SHARED = False
+DLOPEN_TAKES_UNSIGNED_FLAGS = ()
+DOCDIR = '/usr/local/share/doc/tevent'
+DVIDIR = '/usr/local/share/doc/tevent'
+EXEC_PREFIX = '/usr/local'
+EXTRA_CFLAGS = ['-fPIC']
+EXTRA_LDFLAGS = ['-Wl,-no-undefined', '-Wl,-no-undefined']
+FOUND_SYSTEMLIB_pytalloc-util = False
+FOUND_SYSTEMLIB_talloc = False
+FULLSTATIC_MARKER = '-static'
+GIT = '/usr/bin/git'
+GIT_LOCAL_CHANGES = False
+HAVE_AIO_H = 1
+HAVE_ALLOCA_H = 1
+HAVE_ARPA_INET_H = 1
+HAVE_ARPA_NAMESER_H = 1
+HAVE_ASM_UNISTD_H = 1
+HAVE_ASPRINTF = 1
+HAVE_ASSERT_H = 1
+HAVE_BOOL = 1
+HAVE_BSD_STRTOLL = ()
+HAVE_BZERO = 1
+HAVE_C99_VSNPRINTF = 1
+HAVE_CHOWN = 1
+HAVE_CHROOT = 1
+HAVE_CHSIZE = ()
+HAVE_CLOCK_GETTIME = 1
+HAVE_CLOCK_MONOTONIC = 1
+HAVE_CLOCK_PROCESS_CPUTIME_ID = 1
+HAVE_CLOCK_REALTIME = 1
+HAVE_COMPARISON_FN_T = 1
+HAVE_CONNECT = 1
+HAVE_CRYPT = 1
+HAVE_CRYPT_H = 1
+HAVE_CTYPE_H = 1
+HAVE_DECL_ASPRINTF = 1
+HAVE_DECL_DLOPEN = 1
+HAVE_DECL_FDATASYNC = 1
+HAVE_DECL_GETGRENT_R = 1
+HAVE_DECL_GETPWENT_R = 1
+HAVE_DECL_RL_EVENT_HOOK = 1
+HAVE_DECL_SNPRINTF = 1
+HAVE_DECL_VASPRINTF = 1
+HAVE_DECL_VSNPRINTF = 1
+HAVE_DGETTEXT = 1
+HAVE_DIRENT_H = 1
+HAVE_DLCLOSE = 1
+HAVE_DLERROR = 1
+HAVE_DLFCN_H = 1
+HAVE_DLOPEN = 1
+HAVE_DLSYM = 1
+HAVE_DPRINTF = 1
+HAVE_DUP2 = 1
+HAVE_ENVIRON_DECL = 1
+HAVE_EPOLL = 1
+HAVE_EPOLL_CREATE = 1
+HAVE_ERRNO_DECL = 1
+HAVE_ERRNO_H = 1
+HAVE_EVENTFD = 1
+HAVE_FCNTL_H = 1
+HAVE_FDATASYNC = 1
+HAVE_FLOAT_H = 1
+HAVE_FNMATCH_H = 1
+HAVE_FREEADDRINFO = 1
+HAVE_FREEIFADDRS = 1
+HAVE_FTRUNCATE = 1
+HAVE_FUNCTION_MACRO = 1
+HAVE_GAI_STRERROR = 1
+HAVE_GCRYPT_H = 1
+HAVE_GETADDRINFO = 1
+HAVE_GETDENTS = ()
+HAVE_GETDIRENTRIES = 1
+HAVE_GETGRENT_R = 1
+HAVE_GETGRENT_R_DECL = 1
+HAVE_GETGRGID_R = 1
+HAVE_GETGRNAM_R = 1
+HAVE_GETGROUPLIST = 1
+HAVE_GETHOSTBYNAME = 1
+HAVE_GETIFADDRS = 1
+HAVE_GETNAMEINFO = 1
+HAVE_GETOPT_H = 1
+HAVE_GETPAGESIZE = 1
+HAVE_GETPASS = 1
+HAVE_GETPASSPHRASE = ()
+HAVE_GETPGRP = 1
+HAVE_GETPWENT_R = 1
+HAVE_GETPWENT_R_DECL = 1
+HAVE_GETPWNAM_R = 1
+HAVE_GETPWUID_R = 1
+HAVE_GETTEXT = 1
+HAVE_GETTIMEOFDAY_TZ = 1
+HAVE_GET_CURRENT_DIR_NAME = 1
+HAVE_GLOB_H = 1
+HAVE_GRP_H = 1
+HAVE_ICONV_H = 1
+HAVE_IFACE_GETIFADDRS = 1
+HAVE_IFADDRS_H = 1
+HAVE_IF_NAMETOINDEX = 1
+HAVE_IMMEDIATE_STRUCTURES = 1
+HAVE_INET_ATON = 1
+HAVE_INET_NTOA = 1
+HAVE_INET_NTOP = 1
+HAVE_INET_PTON = 1
+HAVE_INITGROUPS = 1
+HAVE_INO_T = 1
+HAVE_INT16_T = 1
+HAVE_INT32_T = 1
+HAVE_INT64_T = 1
+HAVE_INT8_T = 1
+HAVE_INTPTR_T = 1
+HAVE_INTTYPES_H = 1
+HAVE_IPV6 = 1
+HAVE_IPV6_V6ONLY = 1
+HAVE_ISATTY = 1
+HAVE_LANGINFO_H = 1
+HAVE_LARGEFILE = 1
+HAVE_LASTLOG_H = 1
+HAVE_LCHOWN = 1
+HAVE_LD_VERSION_SCRIPT = True
+HAVE_LIBCRYPT = 1
+HAVE_LIBINTL_H = 1
+HAVE_LIBREPLACE = 1
+HAVE_LIMITS_H = 1
+HAVE_LINK = 1
+HAVE_LINUX_TYPES_H = 1
+HAVE_LOCALE_H = 1
+HAVE_LOFF_T = 1
+HAVE_LONG_LONG = 1
+HAVE_LSTAT = 1
+HAVE_MALLOC_H = 1
+HAVE_MEMCPY = 1
+HAVE_MEMMEM = 1
+HAVE_MEMMOVE = 1
+HAVE_MEMORY_H = 1
+HAVE_MEMSET = 1
+HAVE_MKDIR_MODE = 1
+HAVE_MKDTEMP = 1
+HAVE_MKTIME = 1
+HAVE_MMAP = 1
+HAVE_MNTENT_H = 1
+HAVE_NETDB_H = 1
+HAVE_NETINET_IN_H = 1
+HAVE_NETINET_IN_SYSTM_H = 1
+HAVE_NETINET_IP_H = 1
+HAVE_NETINET_TCP_H = 1
+HAVE_NET_IF_H = 1
+HAVE_NSS_H = 1
+HAVE_OFFSET_T = ()
+HAVE_PIPE = 1
+HAVE_POLL = 1
+HAVE_POLL_H = 1
+HAVE_PREAD = 1
+HAVE_PREAD_DECL = 1
+HAVE_PRINTF = 1
+HAVE_PTHREAD_CREATE = 1
+HAVE_PTHREAD_H = 1
+HAVE_PTRDIFF_T = 1
+HAVE_PWD_H = 1
+HAVE_PWRITE = 1
+HAVE_PWRITE_DECL = 1
+HAVE_PYTHON_H = 1
+HAVE_RAND = 1
+HAVE_RANDOM = 1
+HAVE_READLINE_HISTORY_H = 1
+HAVE_READLINE_READLINE_H = 1
+HAVE_READLINK = 1
+HAVE_REALPATH = 1
+HAVE_RENAME = 1
+HAVE_RESOLV_H = 1
+HAVE_RES_SEARCH = 1
+HAVE_RPCSVC_YPCLNT_H = 1
+HAVE_SA_FAMILY_T = 1
+HAVE_SECURE_MKSTEMP = 1
+HAVE_SETBUFFER = 1
+HAVE_SETEGID = 1
+HAVE_SETENV = 1
+HAVE_SETENV_DECL = 1
+HAVE_SETEUID = 1
+HAVE_SETGROUPS = 1
+HAVE_SETJMP_H = 1
+HAVE_SETLINEBUF = 1
+HAVE_SETREGID = 1
+HAVE_SETRESGID = 1
+HAVE_SETRESGID_DECL = 1
+HAVE_SETRESUID = 1
+HAVE_SETRESUID_DECL = 1
+HAVE_SETREUID = 1
+HAVE_SETSID = 1
+HAVE_SHADOW_H = 1
+HAVE_SHL_FINDSYM = ()
+HAVE_SHL_LOAD = ()
+HAVE_SHL_UNLOAD = ()
+HAVE_SIGNAL_H = 1
+HAVE_SIG_ATOMIC_T_TYPE = 1
+HAVE_SIMPLE_C_PROG = 1
+HAVE_SIZE_T = 1
+HAVE_SNPRINTF = 1
+HAVE_SOCKADDR_SA_LEN = ()
+HAVE_SOCKETPAIR = 1
+HAVE_SOCKLEN_T = 1
+HAVE_SOCK_SIN_LEN = ()
+HAVE_SRAND = 1
+HAVE_SRANDOM = 1
+HAVE_SSIZE_T = 1
+HAVE_SS_FAMILY = 1
+HAVE_STAT_TV_NSEC = 1
+HAVE_STDARG_H = 1
+HAVE_STDBOOL_H = 1
+HAVE_STDDEF_H = 1
+HAVE_STDINT_H = 1
+HAVE_STDIO_H = 1
+HAVE_STDLIB_H = 1
+HAVE_STRCASESTR = 1
+HAVE_STRCPY = 1
+HAVE_STRDUP = 1
+HAVE_STRERROR = 1
+HAVE_STRERROR_R = 1
+HAVE_STRFTIME = 1
+HAVE_STRINGS_H = 1
+HAVE_STRING_H = 1
+HAVE_STRLCAT = ()
+HAVE_STRLCPY = ()
+HAVE_STRNCPY = 1
+HAVE_STRNDUP = 1
+HAVE_STRNLEN = 1
+HAVE_STRPTIME = 1
+HAVE_STRTOK_R = 1
+HAVE_STRTOLL = 1
+HAVE_STRTOQ = 1
+HAVE_STRTOULL = 1
+HAVE_STRTOUQ = 1
+HAVE_STRUCT_ADDRINFO = 1
+HAVE_STRUCT_IFADDRS = 1
+HAVE_STRUCT_SOCKADDR = 1
+HAVE_STRUCT_SOCKADDR_IN6 = 1
+HAVE_STRUCT_SOCKADDR_STORAGE = 1
+HAVE_STRUCT_STAT_ST_RDEV = 1
+HAVE_STRUCT_TIMESPEC = 1
+HAVE_ST_RDEV = 1
+HAVE_SYMLINK = 1
+HAVE_SYSCALL_H = 1
+HAVE_SYSLOG = 1
+HAVE_SYSLOG_H = 1
+HAVE_SYS_CDEFS_H = 1
+HAVE_SYS_DIR_H = 1
+HAVE_SYS_EPOLL_H = 1
+HAVE_SYS_EVENTFD_H = 1
+HAVE_SYS_FCNTL_H = 1
+HAVE_SYS_FILE_H = 1
+HAVE_SYS_INOTIFY_H = 1
+HAVE_SYS_IOCTL_H = 1
+HAVE_SYS_IPC_H = 1
+HAVE_SYS_MMAN_H = 1
+HAVE_SYS_MOUNT_H = 1
+HAVE_SYS_PARAM_H = 1
+HAVE_SYS_PRCTL_H = 1
+HAVE_SYS_RESOURCE_H = 1
+HAVE_SYS_SELECT_H = 1
+HAVE_SYS_SHM_H = 1
+HAVE_SYS_SOCKET_H = 1
+HAVE_SYS_STATFS_H = 1
+HAVE_SYS_STATVFS_H = 1
+HAVE_SYS_STAT_H = 1
+HAVE_SYS_SYSCALL_H = 1
+HAVE_SYS_SYSLOG_H = 1
+HAVE_SYS_SYSMACROS_H = 1
+HAVE_SYS_TIME_H = 1
+HAVE_SYS_TYPES_H = 1
+HAVE_SYS_UIO_H = 1
+HAVE_SYS_UNISTD_H = 1
+HAVE_SYS_UN_H = 1
+HAVE_SYS_UTSNAME_H = 1
+HAVE_SYS_VFS_H = 1
+HAVE_SYS_WAIT_H = 1
+HAVE_SYS_XATTR_H = 1
+HAVE_TERMIOS_H = 1
+HAVE_TERMIO_H = 1
+HAVE_TIMEGM = 1
+HAVE_TIME_H = 1
+HAVE_UINT16_T = 1
+HAVE_UINT32_T = 1
+HAVE_UINT64_T = 1
+HAVE_UINT8_T = 1
+HAVE_UINTPTR_T = 1
+HAVE_UINT_T = ()
+HAVE_UNISTD_H = 1
+HAVE_UNIXSOCKET = 1
+HAVE_UNSETENV = 1
+HAVE_USLEEP = 1
+HAVE_UTIME = 1
+HAVE_UTIMES = 1
+HAVE_UTIME_H = 1
+HAVE_UTMPX_H = 1
+HAVE_UTMP_H = 1
+HAVE_VASPRINTF = 1
+HAVE_VA_COPY = 1
+HAVE_VDPRINTF = 1
+HAVE_VISIBILITY_ATTR = 1
+HAVE_VOLATILE = 1
+HAVE_VSNPRINTF = 1
+HAVE_VSYSLOG = 1
+HAVE_WAIT4 = 1
+HAVE_WAITPID = 1
+HAVE_ZLIB_H = 1
+HAVE__Bool = 1
+HAVE__VA_ARGS__MACRO = 1
+HAVE___SS_FAMILY = ()
+HAVE___STRTOLL = ()
+HAVE___STRTOULL = ()
+HOSTCC = False
+HTMLDIR = '/usr/local/share/doc/tevent'
+INCLUDEDIR = '/usr/local/include'
+INFODIR = '/usr/local/share/info'
+INLINE_MACRO = 1
+LIBDIR = '${PREFIX}/lib'
+LIBEXECDIR = '/usr/local/libexec'
+LIBPATH_PYEMBED = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_PYEXT = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_PYTHON2.7 = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_ST = '-L%s'
+LIBREPLACE_NETWORK_CHECKS = 1
+LIB_CRYPT = 'crypt'
+LIB_PYEMBED = ['m', 'dl', 'python2.7']
+LIB_PYEXT = ['m', 'dl', 'python2.7']
+LIB_PYTHON2.7 = ['python2.7']
+LIB_ST = '-l%s'
+LIB_crypt = ['crypt']
+LINKFLAGS_MACBUNDLE = ['-bundle', '-undefined', 'dynamic_lookup']
+LINKFLAGS_PYEMBED = ['-L/root/.pyenv/versions/2.7.18/lib', '-Wl,-rpath,/root/.pyenv/versions/2.7.18/lib', '-L/root/.pyenv/versions/2.7.18/lib', '-Wl,-rpath,/root/.pyenv/versions/2.7.18/lib']
+LINK_CC = ['/usr/bin/gcc']
+LOCALEDIR = '/usr/local/share/locale'
+LOCALSTATEDIR = '/usr/local/var'
+MANDIR = '/usr/local/share/man'
+MODULESDIR = '${PREFIX}/modules'
+NONSHARED_BINARIES = ['']
+OLDINCLUDEDIR = '/usr/include'
+PACKAGE = 'tevent'
+PDFDIR = '/usr/local/share/doc/tevent'
+PREFIX = '/usr/local'
+PRIVATELIBDIR = '${PREFIX}/lib/tevent'
+PRIVATE_EXTENSION = 'tevent'
+PRIVATE_EXTENSION_EXCEPTION = ['tevent']
+PSDIR = '/usr/local/share/doc/tevent'
+PYC = 1
+PYCMD = '"import sys, py_compile;py_compile.compile(sys.argv[1], sys.argv[2])"'
+PYFLAGS = ''
+PYFLAGS_OPT = '-O'
+PYO = 1
+PYTHON = '/root/.pyenv/versions/2.7.18/bin/python'
+PYTHONARCHDIR = '/usr/local/lib/python2.7/site-packages'
+PYTHONDIR = '/usr/local/lib/python2.7/site-packages'
+PYTHON_CONFIG = '/root/.pyenv/versions/2.7.18/bin/python2.7-config'
+PYTHON_VERSION = '2.7'
+RANLIB = '/usr/bin/ranlib'
+REPLACE_GETPASS = 1
+REPLACE_STRPTIME = ()
+RETSIGTYPE = 'void'
+RETSIGTYPE_INT = ()
+RPATH_ON_BUILD = True
+RPATH_ON_INSTALL = True
+RPATH_ON_INSTALL_PRIVATE = True
+RPATH_ST = '-Wl,-rpath,%s'
+SBINDIR = '${PREFIX}/sbin'
+SHAREDSTATEDIR = '/usr/local/com'
+SHLIBEXT = 'so'
+SHLIB_MARKER = '-Wl,-Bdynamic'
+SIZEOF_BOOL = '1'
+SIZEOF_CHAR = '1'
+SIZEOF_DEV_T = '8'
+SIZEOF_INO_T = '8'
+SIZEOF_INT = '4'
+SIZEOF_INT16_T = '2'
+SIZEOF_INT32_T = '4'
+SIZEOF_INT64_T = '8'
+SIZEOF_INT8_T = '1'
+SIZEOF_LONG = '8'
+SIZEOF_LONG_LONG = '8'
+SIZEOF_OFF_T = '8'
+SIZEOF_SHORT = '2'
+SIZEOF_SIZE_T = '8'
+SIZEOF_SSIZE_T = '8'
+SIZEOF_TIME_T = '8'
+SIZEOF_UINT16_T = '2'
+SIZEOF_UINT32_T = '4'
+SIZEOF_UINT64_T = '8'
+SIZEOF_UINT8_T = '1'
+SIZEOF_VOID_P = '8'
+SOLARIS_GETGRENT_R = ()
+SOLARIS_GETPWENT_R = ()
+SONAME_ST = '-Wl,-h,%s'
+STATICLIBPATH_ST = '-L%s'
+STATICLIB_MARKER = '-Wl,-Bstatic'
+STATICLIB_ST = '-l%s'
+STDC_HEADERS = 1
+SYSCONFDIR = '/usr/local/etc'
+SYSTEM_UNAME_MACHINE = 'x86_64'
+SYSTEM_UNAME_RELEASE = '6.18.44-fc-v139'
+SYSTEM_UNAME_SYSNAME = 'Linux'
+SYSTEM_UNAME_VERSION = '#1 SMP PREEMPT_DYNAMIC @0'
+TALLOC_COMPAT1 = False
+TARGET_TYPE = {'rt': 'EMPTY', 'dl': 'EMPTY', 'nsl': 'EMPTY', 'socket': 'EMPTY', 'intl': 'EMPTY', 'resolv': 'EMPTY', 'crypt': 'SYSLIB', 'pthread': 'EMPTY'}
+TIME_WITH_SYS_TIME = 1
+VISIBILITY_CFLAGS = '-fvisibility=hidden'
+WORDS_BIGENDIAN = ()
+XSLTPROC = ''
+_GNU_SOURCE = 1
+_XOPEN_SOURCE_EXTENDED = 1
+cfg_files = ['config.h']
+defines = {'HAVE_INO_T': 1, 'HAVE_ERRNO_H': 1, 'HAVE_SYS_IOCTL_H': 1, 'HAVE_CRYPT': 1, 'HAVE_GAI_STRERROR': 1, 'RETSIGTYPE_INT': (), 'HAVE_RPCSVC_YPCLNT_H': 1, 'SIZEOF_INT64_T': '8', 'SIZEOF_UINT8_T': '1', 'HAVE_SOCKLEN_T': 1, 'HAVE_SYS_UIO_H': 1, 'HAVE_SETRESUID_DECL': 1, 'HAVE_CLOCK_GETTIME': 1, 'HAVE_SETGROUPS': 1, 'HAVE_ERRNO_DECL': 1, 'HAVE_SECURE_MKSTEMP': 1, 'HAVE_STDINT_H': 1, 'BUILD_SYSTEM': '"Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux"', 'HAVE_GETGRENT_R_DECL': 1, 'HAVE_PRINTF': 1, 'HAVE_ASM_UNISTD_H': 1, 'DLOPEN_TAKES_UNSIGNED_FLAGS': (), 'HAVE_SYS_SHM_H': 1, 'HAVE_STDIO_H': 1, 'HAVE_WAIT4': 1, 'HAVE_SETRESGID': 1, 'HAVE_MMAP': 1, 'HAVE_PTHREAD_CREATE': 1, 'HAVE_UINT32_T': 1, 'HAVE_PTRDIFF_T': 1, 'HAVE_DLOPEN': 1, 'HAVE_GETPWENT_R': 1, 'HAVE_MEMMEM': 1, 'HAVE_STRCASESTR': 1, 'HAVE_STRNLEN': 1, 'HAVE_MNTENT_H': 1, 'STDC_HEADERS': 1, 'HAVE_SYS_MOUNT_H': 1, 'HAVE_STRTOLL': 1, 'HAVE_SYS_WAIT_H': 1, 'HAVE_SYS_CDEFS_H': 1, 'HAVE_STRNDUP': 1, 'HAVE_STRLCAT': (), 'HAVE_LINK': 1, 'HAVE_ALLOCA_H': 1, 'HAVE_LIBINTL_H': 1, 'HAVE_STRUCT_SOCKADDR': 1, 'HAVE_GETDENTS': (), 'HAVE_SYS_SYSCALL_H': 1, 'SIZEOF_LONG': '8', 'HAVE_PWRITE_DECL': 1, 'HAVE_STRUCT_SOCKADDR_IN6': 1, 'HAVE_GETGRNAM_R': 1, 'HAVE_EVENTFD': 1, 'HAVE_FREEIFADDRS': 1, 'HAVE_MEMORY_H': 1, 'HAVE_STRDUP': 1, 'HAVE_READLINK': 1, 'HAVE_TIMEGM': 1, 'HAVE_SYS_SYSLOG_H': 1, 'HAVE_CTYPE_H': 1, 'HAVE_SYS_FILE_H': 1, 'HAVE_READLINE_HISTORY_H': 1, 'HAVE_SYS_RESOURCE_H': 1, 'TIME_WITH_SYS_TIME': 1, 'SIZEOF_SHORT': '2', 'HAVE_MALLOC_H': 1, 'HAVE_INET_NTOA': 1, 'HAVE_RESOLV_H': 1, 'HAVE_SETEUID': 1, 'HAVE_SYS_MMAN_H': 1, 'HAVE_FCNTL_H': 1, 'SIZEOF_LONG_LONG': '8', 'HAVE_SETBUFFER': 1, 'HAVE_BOOL': 1, 'HAVE_IPV6': 1, 'HAVE_SETENV': 1, 'HAVE_LANGINFO_H': 1, 'HAVE___STRTOLL': (), 'HAVE_INET_NTOP': 1, 'HAVE_VA_COPY': 1, 'HAVE_LONG_LONG': 1, 'HAVE_NETINET_TCP_H': 1, 'SIZEOF_CHAR': '1', 'HAVE_MKDIR_MODE': 1, 'HAVE_SYSCALL_H': 1, 'SIZEOF_INT': '4', 'SIZEOF_INT8_T': '1', 'HAVE_SYS_TIME_H': 1, 'PYTHONDIR': '"/usr/local/lib/python2.7/site-packages"', 'SIZEOF_UINT64_T': '8', 'SOLARIS_GETGRENT_R': (), 'HAVE_SHL_FINDSYM': (), 'HAVE_DECL_RL_EVENT_HOOK': 1, 'HAVE_SRAND': 1, 'HAVE_SIZE_T': 1, 'HAVE_UINT64_T': 1, 'HAVE_STRUCT_IFADDRS': 1, 'HAVE_SYS_PRCTL_H': 1, 'HAVE_GETOPT_H': 1, 'HAVE_RES_SEARCH': 1, 'HAVE_LASTLOG_H': 1, 'HAVE_DUP2': 1, 'SIZEOF_BOOL': '1', 'HAVE_UTMP_H': 1, 'HAVE_TIME_H': 1, 'SIZEOF_UINT32_T': '4', 'HAVE_SYS_IPC_H': 1, 'HAVE_SHADOW_H': 1, 'HAVE_INET_PTON': 1, 'HAVE_NSS_H': 1, 'HAVE_GLOB_H': 1, 'HAVE_INITGROUPS': 1, 'HAVE_DLCLOSE': 1, 'HAVE_DECL_DLOPEN': 1, 'HAVE_IFACE_GETIFADDRS': 1, 'HAVE_GETPASS': 1, 'HAVE_STDLIB_H': 1, 'HAVE_SYS_EPOLL_H': 1, 'HAVE_IPV6_V6ONLY': 1, 'HAVE_UTIME_H': 1, 'HAVE_STRERROR_R': 1, 'HAVE_FREEADDRINFO': 1, 'HAVE_ST_RDEV': 1, 'HAVE_CHOWN': 1, 'HAVE_GETADDRINFO': 1, 'HAVE_BZERO': 1, 'REPLACE_STRPTIME': (), 'HAVE_LOFF_T': 1, 'HAVE_TERMIO_H': 1, 'HAVE_USLEEP': 1, 'HAVE_GETGRGID_R': 1, 'HAVE_SETEGID': 1, 'SIZEOF_INT16_T': '2', 'HAVE_STDARG_H': 1, 'HAVE_MKTIME': 1, 'SIZEOF_INO_T': '8', 'HAVE_AIO_H': 1, 'INLINE_MACRO': 1, 'HAVE_LOCALE_H': 1, 'HAVE_FLOAT_H': 1, 'LIBREPLACE_NETWORK_CHECKS': 1, 'HAVE_INT16_T': 1, 'HAVE_SYMLINK': 1, 'HAVE_STDDEF_H': 1, 'HAVE_PTHREAD_H': 1, 'HAVE_ASPRINTF': 1, 'HAVE_GCRYPT_H': 1, 'HAVE_STRUCT_ADDRINFO': 1, 'HAVE_STRFTIME': 1, 'HAVE_NETINET_IN_SYSTM_H': 1, 'HAVE_SNPRINTF': 1, 'HAVE_IF_NAMETOINDEX': 1, 'HAVE_SYS_SYSMACROS_H': 1, 'SIZEOF_DEV_T': '8', 'HAVE_STDBOOL_H': 1, 'HAVE_UNSETENV': 1, 'HAVE_SYS_XATTR_H': 1, 'HAVE_STRINGS_H': 1, 'HAVE_RANDOM': 1, 'HAVE_STRUCT_STAT_ST_RDEV': 1, 'HAVE_PWRITE': 1, 'HAVE_EPOLL': 1, 'HAVE_LIBREPLACE': 1, 'HAVE_SETRESUID': 1, 'HAVE_GETTEXT': 1, 'HAVE_UINTPTR_T': 1, 'HAVE_POLL': 1, 'HAVE_CHROOT': 1, 'HAVE_GETGROUPLIST': 1, 'HAVE_CRYPT_H': 1, 'HAVE_PYTHON_H': 1, 'HAVE_NETINET_IP_H': 1, 'HAVE_EPOLL_CREATE': 1, 'HAVE_SYS_INOTIFY_H': 1, 'HAVE_STRING_H': 1, 'HAVE_SIGNAL_H': 1, 'RETSIGTYPE': 'void', 'HAVE_VOLATILE': 1, 'HAVE_STRUCT_SOCKADDR_STORAGE': 1, 'SYSTEM_UNAME_SYSNAME': '"Linux"', 'HAVE_SHL_LOAD': (), 'HAVE_MEMSET': 1, 'HAVE_PIPE': 1, 'HAVE_GETPASSPHRASE': (), 'HAVE_ENVIRON_DECL': 1, 'HAVE_LCHOWN': 1, 'HAVE_ISATTY': 1, 'HAVE_SIMPLE_C_PROG': 1, 'HAVE_STRTOULL': 1, 'HAVE_SYS_STATFS_H': 1, 'REPLACE_GETPASS': 1, 'HAVE_FNMATCH_H': 1, 'HAVE_CLOCK_MONOTONIC': 1, 'HAVE_SYS_UNISTD_H': 1, 'HAVE_LINUX_TYPES_H': 1, 'HAVE_WAITPID': 1, 'HAVE_GETGRENT_R': 1, 'SIZEOF_VOID_P': '8', 'HAVE_SETRESGID_DECL': 1, 'HAVE_SYSLOG': 1, 'HAVE_SYS_FCNTL_H': 1, 'HAVE_POLL_H': 1, 'HAVE_SS_FAMILY': 1, 'HAVE_CHSIZE': (), 'HAVE_INTTYPES_H': 1, 'HAVE_DECL_VSNPRINTF': 1, 'PYTHONARCHDIR': '"/usr/local/lib/python2.7/site-packages"', 'HAVE_SYS_PARAM_H': 1, 'HAVE_SYS_SOCKET_H': 1, 'HAVE_MEMMOVE': 1, 'HAVE_DECL_FDATASYNC': 1, 'HAVE_UNISTD_H': 1, 'HAVE_DLSYM': 1, 'uint_t': 'unsigned int', 'HAVE_SETREGID': 1, 'HAVE_SYS_UN_H': 1, 'HAVE_SETLINEBUF': 1, 'HAVE_SETJMP_H': 1, 'HAVE_LIMITS_H': 1, 'HAVE_SYS_STAT_H': 1, 'HAVE_GETHOSTBYNAME': 1, 'HAVE_MEMCPY': 1, 'HAVE_DPRINTF': 1, 'HAVE_STRTOK_R': 1, 'HAVE_DGETTEXT': 1, 'HAVE_SETENV_DECL': 1, 'HAVE_FTRUNCATE': 1, 'HAVE_INT64_T': 1, 'SIZEOF_SIZE_T': '8', 'SIZEOF_INT32_T': '4', 'HAVE_GETTIMEOFDAY_TZ': 1, 'HAVE_TERMIOS_H': 1, 'HAVE_FUNCTION_MACRO': 1, 'HAVE_SOCKADDR_SA_LEN': (), 'HAVE_STRNCPY': 1, 'HAVE_SYS_UTSNAME_H': 1, 'WORDS_BIGENDIAN': (), 'HAVE_LIBCRYPT': 1, 'HAVE_NETDB_H': 1, 'HAVE_GETDIRENTRIES': 1, 'SIZEOF_UINT16_T': '2', 'HAVE_GETIFADDRS': 1, 'HAVE_STRCPY': 1, 'HAVE_DECL_GETGRENT_R': 1, 'HAVE___SS_FAMILY': (), 'HAVE_VDPRINTF': 1, 'HAVE_COMPARISON_FN_T': 1, 'HAVE_SYS_VFS_H': 1, 'SHLIBEXT': '"so"', 'HAVE_GETPGRP': 1, 'HAVE_ICONV_H': 1, 'HAVE_REALPATH': 1, 'HAVE_LSTAT': 1, 'HAVE_UTMPX_H': 1, 'HAVE_OFFSET_T': (), 'HAVE_GETPAGESIZE': 1, 'HAVE_SYS_DIR_H': 1, 'HAVE_RENAME': 1, 'HAVE_CLOCK_PROCESS_CPUTIME_ID': 1, 'HAVE_UINT16_T': 1, 'HAVE___STRTOULL': (), 'HAVE_STRPTIME': 1, 'HAVE_VSNPRINTF': 1, 'HAVE_VASPRINTF': 1, 'HAVE_STRTOUQ': 1, 'HAVE_DLFCN_H': 1, 'SIZEOF_SSIZE_T': '8', 'HAVE_INT8_T': 1, 'HAVE_SYS_TYPES_H': 1, 'HAVE_C99_VSNPRINTF': 1, 'HAVE_SYSLOG_H': 1, 'HAVE_UTIME': 1, 'HAVE_SYS_EVENTFD_H': 1, 'HAVE_GETPWENT_R_DECL': 1, 'HAVE_SYS_SELECT_H': 1, 'HAVE_SSIZE_T': 1, 'SYSTEM_UNAME_VERSION': '"#1 SMP PREEMPT_DYNAMIC @0"', '_GNU_SOURCE': 1, 'HAVE_DIRENT_H': 1, 'HAVE_SA_FAMILY_T': 1, 'HAVE_CONNECT': 1, 'HAVE_SYS_STATVFS_H': 1, 'SOLARIS_GETPWENT_R': (), 'HAVE_FDATASYNC': 1, 'HAVE_INTPTR_T': 1, '_XOPEN_SOURCE_EXTENDED': 1, 'SIZEOF_OFF_T': '8', 'HAVE_DECL_GETPWENT_R': 1, 'HAVE_NET_IF_H': 1, 'HAVE_ARPA_NAMESER_H': 1, 'HAVE_ASSERT_H': 1, 'SYSTEM_UNAME_MACHINE': '"x86_64"', 'HAVE_GETNAMEINFO': 1, 'HAVE_PREAD_DECL': 1, 'offset_t': 'loff_t', 'HAVE_MKDTEMP': 1, 'HAVE_STAT_TV_NSEC': 1, 'HAVE_CLOCK_REALTIME': 1, 'HAVE__VA_ARGS__MACRO': 1, 'HAVE_LARGEFILE': 1, 'HAVE_STRTOQ': 1, 'HAVE_ARPA_INET_H': 1, 'HAVE_DECL_VASPRINTF': 1, 'HAVE_VISIBILITY_ATTR': 1, 'HAVE_INT32_T': 1, 'HAVE_SOCKETPAIR': 1, 'HAVE_GET_CURRENT_DIR_NAME': 1, 'HAVE_SRANDOM': 1, 'HAVE_NETINET_IN_H': 1, 'HAVE_UINT_T': (), 'HAVE_SOCK_SIN_LEN': (), 'HAVE_IMMEDIATE_STRUCTURES': 1, 'HAVE_STRERROR': 1, 'HAVE_UINT8_T': 1, 'HAVE_DLERROR': 1, 'HAVE_GETPWNAM_R': 1, 'HAVE_SIG_ATOMIC_T_TYPE': 1, 'HAVE_INET_ATON': 1, 'SYSTEM_UNAME_RELEASE': '"6.18.44-fc-v139"', 'HAVE_ZLIB_H': 1, 'HAVE_UNIXSOCKET': 1, 'HAVE_STRUCT_TIMESPEC': 1, 'HAVE_DECL_ASPRINTF': 1, 'HAVE_DECL_SNPRINTF': 1, 'HAVE_PWD_H': 1, 'HAVE__Bool': 1, 'HAVE_PREAD': 1, 'HAVE_GRP_H': 1, 'SIZEOF_TIME_T': '8', 'HAVE_SHL_UNLOAD': (), 'HAVE_RAND': 1, 'HAVE_GETPWUID_R': 1, 'HAVE_UTIMES': 1, 'HAVE_VSYSLOG': 1, 'HAVE_READLINE_READLINE_H': 1, 'HAVE_BSD_STRTOLL': (), 'HAVE_STRLCPY': (), 'HAVE_SETSID': 1, 'HAVE_IFADDRS_H': 1, 'HAVE_SETREUID': 1}
+disable_python = False
+hlist = ['stdio.h', 'sys/types.h', 'sys/stat.h', 'stdlib.h', 'stddef.h', 'memory.h', 'string.h', 'strings.h', 'inttypes.h', 'stdint.h', 'unistd.h', 'ctype.h', 'stdbool.h', 'stdarg.h']
+in_compound = 0
+macbundle_PATTERN = '%s.bundle'
+offset_t = 'loff_t'
+program_PATTERN = '%s'
+pyext_PATTERN = '%s.so'
+python_headers_checked = 'yes'
+shlib_CCFLAGS = ['-fPIC', '-DPIC']
+shlib_LINKFLAGS = ['-shared']
+shlib_PATTERN = 'lib%s.so'
+srcdir = '/root/repo'
+standalone_replace = False
+standalone_talloc = False
+standalone_tevent = True
+staticlib_LINKFLAGS = ['-Wl,-Bstatic']
+staticlib_PATTERN = 'lib%s.a'
+uint_t = 'unsigned int'
+undefined_ldflags = ['-Wl,-no-undefined']
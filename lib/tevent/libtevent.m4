@@ -30,12 +30,12 @@ TEVENT_OBJ="tevent.o tevent_debug.o tevent_util.o"
 TEVENT_OBJ="$TEVENT_OBJ tevent_fd.o tevent_timed.o tevent_immediate.o tevent_signal.o"
 TEVENT_OBJ="$TEVENT_OBJ tevent_req.o tevent_wakeup.o tevent_queue.o"
 TEVENT_OBJ="$TEVENT_OBJ tevent_standard.o tevent_select.o"
-TEVENT_OBJ="$TEVENT_OBJ tevent_poll.o"
+TEVENT_OBJ="$TEVENT_OBJ tevent_poll.o tevent_threads.o"
 
-AC_CHECK_HEADERS(sys/epoll.h)
-AC_CHECK_FUNCS(epoll_create)
+AC_CHECK_HEADERS(sys/epoll.h sys/eventfd.h)
+AC_CHECK_FUNCS(epoll_create eventfd)
 if test x"$ac_cv_header_sys_epoll_h" = x"yes" -a x"$ac_cv_func_epoll_create" = x"yes"; then
-   TEVENT_OBJ="$TEVENT_OBJ tevent_epoll.o"
+   TEVENT_OBJ="$TEVENT_OBJ tevent_epoll.o tevent_epoll_batch.o"
    AC_DEFINE(HAVE_EPOLL, 1, [Whether epoll available])
 fi
 
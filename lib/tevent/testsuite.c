@@ -26,7 +26,11 @@
 #include "includes.h"
 #include "lib/events/events.h"
 #include "system/filesys.h"
+#include "system/network.h"
 #include "torture/torture.h"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 
 static int fde_count;
 
@@ -146,6 +150,760 @@ static bool test_event_context(struct torture_context *test,
 	return true;
 }
 
+#define FD_BATCH_PAIRS 64
+
+struct fd_batch_end {
+	struct fd_batch_state *state;
+	struct tevent_fd *fde;
+	int fds[2];
+	int num_calls;
+};
+
+struct fd_batch_state {
+	struct fd_batch_end ends[FD_BATCH_PAIRS];
+	int num_ends;
+	int num_calls;
+	int num_spurious;
+};
+
+static int fd_batch_state_destructor(struct fd_batch_state *state)
+{
+	int i;
+
+	/* the fd events have to go before the fds are closed */
+	for (i=0; i<state->num_ends; i++) {
+		struct fd_batch_end *end = &state->ends[i];
+
+		TALLOC_FREE(end->fde);
+		if (end->fds[0] != -1) {
+			close(end->fds[0]);
+		}
+		if (end->fds[1] != -1) {
+			close(end->fds[1]);
+		}
+	}
+	return 0;
+}
+
+/*
+ * Set up socketpairs with one byte waiting to be read on each
+ */
+static struct fd_batch_state *fd_batch_setup(struct tevent_context *ev_ctx,
+					     int num,
+					     tevent_fd_handler_t handler)
+{
+	struct fd_batch_state *state;
+	int i;
+
+	state = talloc_zero(ev_ctx, struct fd_batch_state);
+	if (state == NULL) {
+		return NULL;
+	}
+	talloc_set_destructor(state, fd_batch_state_destructor);
+
+	for (i=0; i<num; i++) {
+		struct fd_batch_end *end = &state->ends[i];
+		char c = 0;
+
+		end->state = state;
+		end->fds[0] = end->fds[1] = -1;
+		state->num_ends += 1;
+
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, end->fds) == -1) {
+			talloc_free(state);
+			return NULL;
+		}
+		fcntl(end->fds[0], F_SETFL, O_NONBLOCK);
+		if (write(end->fds[1], &c, 1) != 1) {
+			talloc_free(state);
+			return NULL;
+		}
+		end->fde = tevent_add_fd(ev_ctx, state, end->fds[0],
+					 TEVENT_FD_READ, handler, end);
+		if (end->fde == NULL) {
+			talloc_free(state);
+			return NULL;
+		}
+	}
+	return state;
+}
+
+static void fd_batch_handler(struct tevent_context *ev_ctx,
+			     struct tevent_fd *fde,
+			     uint16_t flags, void *private_data)
+{
+	struct fd_batch_end *end = (struct fd_batch_end *)private_data;
+	char c;
+
+	end->num_calls += 1;
+	end->state->num_calls += 1;
+
+	if (read(end->fds[0], &c, 1) != 1) {
+		end->state->num_spurious += 1;
+	}
+}
+
+/*
+ * Many fds get readable at the same time, every handler must be
+ * called exactly once. The batching backends do it in a single loop.
+ */
+static bool test_event_fd_batch(struct torture_context *test,
+				const void *test_data)
+{
+	const char *backend = (const char *)test_data;
+	struct tevent_context *ev_ctx;
+	struct fd_batch_state *state;
+	int i, num_loops = 0, finished = 0;
+	int num_spurious, num_wrong = 0;
+
+	ev_ctx = tevent_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	state = fd_batch_setup(ev_ctx, FD_BATCH_PAIRS, fd_batch_handler);
+	if (state == NULL) {
+		talloc_free(ev_ctx);
+		torture_fail(test, "fd_batch_setup failed");
+	}
+
+	while (state->num_calls < FD_BATCH_PAIRS) {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "Failed event loop");
+		}
+		num_loops += 1;
+	}
+
+	/* nothing is readable anymore, nothing must be called */
+	tevent_add_timer(ev_ctx, ev_ctx, timeval_current_ofs(0, 100000),
+			 finished_handler, &finished);
+	while (!finished) {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "Failed event loop");
+		}
+	}
+
+	num_spurious = state->num_spurious;
+	for (i=0; i<FD_BATCH_PAIRS; i++) {
+		if (state->ends[i].num_calls != 1) {
+			num_wrong += 1;
+		}
+	}
+
+	talloc_free(ev_ctx);
+
+	torture_assert_int_equal(test, num_spurious, 0,
+				 "handler called without data");
+	torture_assert_int_equal(test, num_wrong, 0,
+				 "handler not called exactly once");
+	if (strcmp(backend, "epoll_batch") == 0) {
+		torture_assert_int_equal(test, num_loops, 1,
+					 "readable fds not dispatched "
+					 "in one batch");
+	}
+	return true;
+}
+
+static void fd_stale_handler(struct tevent_context *ev_ctx,
+			     struct tevent_fd *fde,
+			     uint16_t flags, void *private_data)
+{
+	struct fd_batch_end *end = (struct fd_batch_end *)private_data;
+	struct fd_batch_state *state = end->state;
+	char c;
+	int i;
+
+	end->num_calls += 1;
+	state->num_calls += 1;
+
+	if (read(end->fds[0], &c, 1) != 1) {
+		state->num_spurious += 1;
+	}
+	if (state->num_calls > 1) {
+		return;
+	}
+
+	/*
+	 * The others are readable too, and might already be part of
+	 * the current batch. Take away interest in half of them and
+	 * free the others.
+	 */
+	for (i=0; i<FD_BATCH_PAIRS; i++) {
+		struct fd_batch_end *other = &state->ends[i];
+
+		if (other == end) {
+			continue;
+		}
+		if (i % 2) {
+			tevent_fd_set_flags(other->fde, 0);
+		} else {
+			TALLOC_FREE(other->fde);
+		}
+	}
+}
+
+/*
+ * Events that were ready before tevent_fd_set_flags() or
+ * talloc_free() of the fd event must not be delivered afterwards
+ */
+static bool test_event_fd_stale(struct torture_context *test,
+				const void *test_data)
+{
+	const char *backend = (const char *)test_data;
+	struct tevent_context *ev_ctx;
+	struct fd_batch_state *state;
+	int num_calls, num_spurious, finished = 0;
+
+	ev_ctx = tevent_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	state = fd_batch_setup(ev_ctx, FD_BATCH_PAIRS, fd_stale_handler);
+	if (state == NULL) {
+		talloc_free(ev_ctx);
+		torture_fail(test, "fd_batch_setup failed");
+	}
+
+	tevent_add_timer(ev_ctx, ev_ctx, timeval_current_ofs(0, 100000),
+			 finished_handler, &finished);
+	while (!finished) {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "Failed event loop");
+		}
+	}
+
+	num_calls = state->num_calls;
+	num_spurious = state->num_spurious;
+
+	talloc_free(ev_ctx);
+
+	torture_assert_int_equal(test, num_calls, 1,
+				 "stale fd events delivered");
+	torture_assert_int_equal(test, num_spurious, 0,
+				 "handler called without data");
+	return true;
+}
+
+
+#define FD_BENCH_PAIRS 500
+
+struct fd_bench_end {
+	struct fd_bench_state *state;
+	struct tevent_fd *fde;
+	int fd;
+};
+
+struct fd_bench_state {
+	struct fd_bench_end ends[FD_BENCH_PAIRS * 2];
+	uint64_t num_msgs;
+	bool failed;
+};
+
+/*
+ * Every socketpair bounces one byte back and forth, each end switches
+ * between waiting for read and waiting for write, like a request
+ * queue that runs empty and fills up again
+ */
+static void fd_bench_handler(struct tevent_context *ev_ctx,
+			     struct tevent_fd *fde,
+			     uint16_t flags, void *private_data)
+{
+	struct fd_bench_end *end = (struct fd_bench_end *)private_data;
+	char c = 0;
+
+	if (flags & TEVENT_FD_READ) {
+		if (read(end->fd, &c, 1) != 1) {
+			end->state->failed = true;
+			return;
+		}
+		end->state->num_msgs += 1;
+		TEVENT_FD_NOT_READABLE(fde);
+		TEVENT_FD_WRITEABLE(fde);
+		return;
+	}
+
+	if (write(end->fd, &c, 1) != 1) {
+		end->state->failed = true;
+		return;
+	}
+	TEVENT_FD_NOT_WRITEABLE(fde);
+	TEVENT_FD_READABLE(fde);
+}
+
+static bool test_event_fd_bench(struct torture_context *test,
+				const void *test_data)
+{
+	const char *backend = (const char *)test_data;
+	struct tevent_context *ev_ctx;
+	struct fd_bench_state *state;
+	struct timeval t;
+	int i;
+
+	ev_ctx = tevent_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	state = talloc_zero(ev_ctx, struct fd_bench_state);
+	if (state == NULL) {
+		talloc_free(ev_ctx);
+		torture_fail(test, "talloc failed");
+	}
+
+	for (i=0; i<FD_BENCH_PAIRS; i++) {
+		struct fd_bench_end *e0 = &state->ends[i*2];
+		struct fd_bench_end *e1 = &state->ends[i*2+1];
+		int fds[2];
+
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "socketpair failed");
+		}
+		e0->state = state;
+		e0->fd = fds[0];
+		e0->fde = tevent_add_fd(ev_ctx, state, fds[0], TEVENT_FD_WRITE,
+					fd_bench_handler, e0);
+		e1->state = state;
+		e1->fd = fds[1];
+		e1->fde = tevent_add_fd(ev_ctx, state, fds[1], TEVENT_FD_READ,
+					fd_bench_handler, e1);
+		if ((e0->fde == NULL) || (e1->fde == NULL)) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "tevent_add_fd failed");
+		}
+		tevent_fd_set_auto_close(e0->fde);
+		tevent_fd_set_auto_close(e1->fde);
+	}
+
+	t = timeval_current();
+	while (timeval_elapsed(&t) < 1.0) {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "Failed event loop");
+		}
+		if (state->failed) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "short read or write");
+		}
+	}
+
+	torture_comment(test, "%s: %d socketpairs, %.0f msgs/sec\n",
+			backend, FD_BENCH_PAIRS,
+			state->num_msgs / timeval_elapsed(&t));
+
+	talloc_free(ev_ctx);
+	return true;
+}
+
+#define TIMER_BENCH_NUM 10000
+
+struct timer_bench_state {
+	struct timeval last;
+	int num_fired;
+	int num_misordered;
+};
+
+struct timer_bench_timer {
+	struct timer_bench_state *state;
+	struct tevent_timer *te;
+	struct timeval next;
+};
+
+static void timer_bench_handler(struct tevent_context *ev_ctx,
+				struct tevent_timer *te,
+				struct timeval tval, void *private_data)
+{
+	struct timer_bench_timer *timer =
+		(struct timer_bench_timer *)private_data;
+	struct timer_bench_state *state = timer->state;
+
+	if (timeval_compare(&timer->next, &state->last) < 0) {
+		state->num_misordered += 1;
+	}
+	state->last = timer->next;
+	state->num_fired += 1;
+}
+
+#define TIMER_ORDER_NUM 1000
+
+/*
+ * Timers that are due already, added in random order with half of
+ * them cancelled: The others must fire in order, the cancelled ones
+ * not at all
+ */
+static bool test_event_timer_order(struct torture_context *test,
+				   const void *test_data)
+{
+	const char *backend = (const char *)test_data;
+	struct tevent_context *ev_ctx;
+	struct timer_bench_state state;
+	struct timer_bench_timer *timers;
+	struct timeval now;
+	int i, finished = 0;
+
+	ev_ctx = tevent_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	timers = talloc_array(ev_ctx, struct timer_bench_timer,
+			      TIMER_ORDER_NUM);
+	if (timers == NULL) {
+		talloc_free(ev_ctx);
+		torture_fail(test, "talloc failed");
+	}
+
+	ZERO_STRUCT(state);
+	srandom(TIMER_ORDER_NUM);
+	now = timeval_current();
+
+	for (i=0; i<TIMER_ORDER_NUM; i++) {
+		timers[i].state = &state;
+		timers[i].next = timeval_add(&now, 0, random() % 1000000);
+		timers[i].next.tv_sec -= 1;
+		timers[i].te = tevent_add_timer(ev_ctx, ev_ctx,
+						timers[i].next,
+						timer_bench_handler,
+						&timers[i]);
+		if (timers[i].te == NULL) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "tevent_add_timer failed");
+		}
+	}
+	for (i=0; i<TIMER_ORDER_NUM; i+=2) {
+		TALLOC_FREE(timers[i].te);
+	}
+
+	tevent_add_timer(ev_ctx, ev_ctx, timeval_current_ofs(0, 10000),
+			 finished_handler, &finished);
+	while (!finished) {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "Failed event loop");
+		}
+	}
+
+	talloc_free(ev_ctx);
+
+	torture_assert_int_equal(test, state.num_fired, TIMER_ORDER_NUM/2,
+				 "wrong number of timers fired");
+	torture_assert_int_equal(test, state.num_misordered, 0,
+				 "timers fired out of order");
+	return true;
+}
+
+/*
+ * Add timers in random order, cancel half of them and wait for the
+ * rest, the way smbd does with per request timeouts
+ */
+static bool test_event_timer_bench(struct torture_context *test,
+				   const void *test_data)
+{
+	const char *backend = (const char *)test_data;
+	struct tevent_context *ev_ctx;
+	struct timer_bench_state state;
+	struct timer_bench_timer *timers;
+	struct timeval now, t;
+	double add_time, del_time, run_time;
+	int i;
+
+	ev_ctx = tevent_context_init_byname(test, backend);
+	if (ev_ctx == NULL) {
+		torture_comment(test, "event backend '%s' not supported\n", backend);
+		return true;
+	}
+
+	timers = talloc_array(ev_ctx, struct timer_bench_timer,
+			      TIMER_BENCH_NUM);
+	if (timers == NULL) {
+		talloc_free(ev_ctx);
+		torture_fail(test, "talloc failed");
+	}
+
+	ZERO_STRUCT(state);
+	srandom(TIMER_BENCH_NUM);
+	now = timeval_current();
+
+	t = timeval_current();
+	for (i=0; i<TIMER_BENCH_NUM; i++) {
+		timers[i].state = &state;
+		timers[i].next = timeval_add(&now, 0, random() % 500000);
+		timers[i].te = tevent_add_timer(ev_ctx, ev_ctx,
+						timers[i].next,
+						timer_bench_handler,
+						&timers[i]);
+		if (timers[i].te == NULL) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "tevent_add_timer failed");
+		}
+	}
+	add_time = timeval_elapsed(&t);
+
+	t = timeval_current();
+	for (i=0; i<TIMER_BENCH_NUM; i+=2) {
+		TALLOC_FREE(timers[i].te);
+	}
+	del_time = timeval_elapsed(&t);
+
+	t = timeval_current();
+	while (state.num_fired < TIMER_BENCH_NUM/2) {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "Failed event loop");
+		}
+	}
+	run_time = timeval_elapsed(&t);
+
+	torture_comment(test, "%s: %d timers, add %.3f sec, "
+			"cancel %.3f sec, run %.3f sec\n",
+			backend, TIMER_BENCH_NUM, add_time, del_time,
+			run_time);
+
+	talloc_free(ev_ctx);
+
+	torture_assert_int_equal(test, state.num_misordered, 0,
+				 "timers fired out of order");
+	return true;
+}
+
+static const uint32_t timer_stress_num = 10000;
+static const uint32_t timer_stress_bench_num = 1000000;
+
+/*
+ * Add and remove lots of timers in random order. With the sorted list
+ * a million of them would take hours.
+ */
+static bool test_event_timer_stress(struct torture_context *test,
+				    const void *test_data)
+{
+	const uint32_t num = *(const uint32_t *)test_data;
+	struct tevent_context *ev_ctx;
+	struct timer_bench_state state;
+	struct timer_bench_timer *timers;
+	uint32_t *order;
+	struct timeval now, t;
+	double add_time, del_time, run_time;
+	uint32_t i;
+
+	ev_ctx = tevent_context_init(test);
+	torture_assert(test, ev_ctx != NULL, "tevent_context_init failed");
+
+	timers = talloc_array(ev_ctx, struct timer_bench_timer, num);
+	order = talloc_array(ev_ctx, uint32_t, num);
+	if ((timers == NULL) || (order == NULL)) {
+		talloc_free(ev_ctx);
+		torture_fail(test, "talloc failed");
+	}
+
+	ZERO_STRUCT(state);
+	srandom(num);
+
+	for (i=0; i<num; i++) {
+		uint32_t j = random() % (i + 1);
+		order[i] = order[j];
+		order[j] = i;
+	}
+
+	/* none of these is due, they're all cancelled in random order */
+	now = timeval_current();
+	t = timeval_current();
+	for (i=0; i<num; i++) {
+		timers[i].state = &state;
+		timers[i].next = timeval_add(&now, 3600 + random() % 3600,
+					     random() % 1000000);
+		timers[i].te = tevent_add_timer(ev_ctx, ev_ctx,
+						timers[i].next,
+						timer_bench_handler,
+						&timers[i]);
+		if (timers[i].te == NULL) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "tevent_add_timer failed");
+		}
+	}
+	add_time = timeval_elapsed(&t);
+
+	t = timeval_current();
+	for (i=0; i<num; i++) {
+		TALLOC_FREE(timers[order[i]].te);
+	}
+	del_time = timeval_elapsed(&t);
+
+	torture_comment(test, "%u timers: add %.3f sec, cancel %.3f sec\n",
+			(unsigned)num, add_time, del_time);
+
+	/*
+	 * all of these are due, every second one is cancelled and
+	 * the rest must fire in order
+	 */
+	now = timeval_current();
+	for (i=0; i<num; i++) {
+		timers[i].next = timeval_add(&now, 0, random() % 1000000);
+		timers[i].next.tv_sec -= 1;
+		timers[i].te = tevent_add_timer(ev_ctx, ev_ctx,
+						timers[i].next,
+						timer_bench_handler,
+						&timers[i]);
+		if (timers[i].te == NULL) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "tevent_add_timer failed");
+		}
+	}
+	for (i=0; i<num; i++) {
+		if (order[i] % 2 == 0) {
+			TALLOC_FREE(timers[order[i]].te);
+		}
+	}
+
+	t = timeval_current();
+	while (state.num_fired < num/2) {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "Failed event loop");
+		}
+	}
+	run_time = timeval_elapsed(&t);
+
+	torture_comment(test, "%u timers: run %.3f sec\n",
+			(unsigned)num/2, run_time);
+
+	talloc_free(ev_ctx);
+
+	torture_assert_int_equal(test, state.num_misordered, 0,
+				 "timers fired out of order");
+	return true;
+}
+
+#ifdef HAVE_PTHREAD_CREATE
+
+#define THREADED_NUM_THREADS 4
+#define THREADED_NUM_IMMEDIATES 100000
+
+struct threaded_test_thread {
+	struct tevent_threaded_context *tctx;
+	struct tevent_immediate **ims;
+	int *counters;
+	int idx;
+	int num_run;
+	int num_misordered;
+};
+
+static void threaded_test_handler(struct tevent_context *ev_ctx,
+				  struct tevent_immediate *im,
+				  void *private_data)
+{
+	struct threaded_test_thread *thread =
+		(struct threaded_test_thread *)private_data;
+	int i = thread->num_run;
+
+	/* each thread's immediates must run in the order scheduled */
+	if (thread->ims[i] != im) {
+		thread->num_misordered += 1;
+	}
+	thread->num_run += 1;
+}
+
+static void *threaded_test_thread_fn(void *private_data)
+{
+	struct threaded_test_thread *thread =
+		(struct threaded_test_thread *)private_data;
+	int i;
+
+	for (i=0; i<THREADED_NUM_IMMEDIATES; i++) {
+		tevent_threaded_schedule_immediate(
+			thread->tctx, thread->ims[i], threaded_test_handler,
+			thread);
+	}
+	return NULL;
+}
+
+/*
+ * A few threads schedule immediates as fast as they can, the main
+ * thread runs them
+ */
+static bool test_event_threaded(struct torture_context *test)
+{
+	struct tevent_context *ev_ctx;
+	struct tevent_threaded_context *tctx;
+	struct threaded_test_thread threads[THREADED_NUM_THREADS];
+	pthread_t ids[THREADED_NUM_THREADS];
+	struct timeval t;
+	int i, j, num_run;
+
+	ev_ctx = tevent_context_init(test);
+	torture_assert(test, ev_ctx != NULL, "tevent_context_init failed");
+
+	tctx = tevent_threaded_context_create(ev_ctx, ev_ctx);
+	if (tctx == NULL) {
+		talloc_free(ev_ctx);
+		torture_fail(test, "tevent_threaded_context_create failed");
+	}
+
+	for (i=0; i<THREADED_NUM_THREADS; i++) {
+		threads[i].tctx = tctx;
+		threads[i].num_run = 0;
+		threads[i].num_misordered = 0;
+		threads[i].ims = talloc_array(ev_ctx, struct tevent_immediate *,
+					      THREADED_NUM_IMMEDIATES);
+		if (threads[i].ims == NULL) {
+			talloc_free(ev_ctx);
+			torture_fail(test, "talloc failed");
+		}
+		for (j=0; j<THREADED_NUM_IMMEDIATES; j++) {
+			threads[i].ims[j] = tevent_create_immediate(
+				threads[i].ims);
+			if (threads[i].ims[j] == NULL) {
+				talloc_free(ev_ctx);
+				torture_fail(test, "talloc failed");
+			}
+		}
+	}
+
+	t = timeval_current();
+
+	for (i=0; i<THREADED_NUM_THREADS; i++) {
+		if (pthread_create(&ids[i], NULL, threaded_test_thread_fn,
+				   &threads[i]) != 0) {
+			torture_fail(test, "pthread_create failed");
+		}
+	}
+
+	do {
+		if (tevent_loop_once(ev_ctx) == -1) {
+			torture_fail(test, "Failed event loop");
+		}
+		num_run = 0;
+		for (i=0; i<THREADED_NUM_THREADS; i++) {
+			num_run += threads[i].num_run;
+		}
+	} while (num_run < THREADED_NUM_THREADS * THREADED_NUM_IMMEDIATES);
+
+	torture_comment(test, "%d threads: %.0f immediates/sec\n",
+			THREADED_NUM_THREADS,
+			num_run / timeval_elapsed(&t));
+
+	for (i=0; i<THREADED_NUM_THREADS; i++) {
+		pthread_join(ids[i], NULL);
+	}
+
+	talloc_free(ev_ctx);
+
+	for (i=0; i<THREADED_NUM_THREADS; i++) {
+		torture_assert_int_equal(test, threads[i].num_misordered, 0,
+					 "immediates ran out of order");
+	}
+	return true;
+}
+
+#endif
+
 struct torture_suite *torture_local_event(TALLOC_CTX *mem_ctx)
 {
 	struct torture_suite *suite = torture_suite_create(mem_ctx, "event");
@@ -156,7 +914,50 @@ struct torture_suite *torture_local_event(TALLOC_CTX *mem_ctx)
 		torture_suite_add_simple_tcase_const(suite, list[i],
 					       test_event_context,
 					       (const void *)list[i]);
+		torture_suite_add_simple_tcase_const(suite,
+			talloc_asprintf(suite, "%s-fd-batch", list[i]),
+			test_event_fd_batch, (const void *)list[i]);
+		torture_suite_add_simple_tcase_const(suite,
+			talloc_asprintf(suite, "%s-fd-stale", list[i]),
+			test_event_fd_stale, (const void *)list[i]);
+		torture_suite_add_simple_tcase_const(suite,
+			talloc_asprintf(suite, "%s-timer-order", list[i]),
+			test_event_timer_order, (const void *)list[i]);
+	}
+
+	torture_suite_add_simple_tcase_const(suite, "timer_stress",
+					     test_event_timer_stress,
+					     &timer_stress_num);
+#ifdef HAVE_PTHREAD_CREATE
+	torture_suite_add_simple_test(suite, "threaded",
+				      test_event_threaded);
+#endif
+
+	return suite;
+}
+
+/*
+ * Benchmarks, not run by selftest
+ */
+struct torture_suite *torture_local_event_bench(TALLOC_CTX *mem_ctx)
+{
+	struct torture_suite *suite = torture_suite_create(mem_ctx,
+							   "event-bench");
+	const char **list = event_backend_list(suite);
+	int i;
+
+	for (i=0;list && list[i];i++) {
+		torture_suite_add_simple_tcase_const(suite,
+			talloc_asprintf(suite, "%s-fd", list[i]),
+			test_event_fd_bench, (const void *)list[i]);
+		torture_suite_add_simple_tcase_const(suite,
+			talloc_asprintf(suite, "%s-timer", list[i]),
+			test_event_timer_bench, (const void *)list[i]);
 	}
 
+	torture_suite_add_simple_tcase_const(suite, "timer_stress",
+					     test_event_timer_stress,
+					     &timer_stress_bench_num);
+
 	return suite;
 }
@@ -117,6 +117,7 @@ static void tevent_backend_init(void)
 	tevent_standard_init();
 #ifdef HAVE_EPOLL
 	tevent_epoll_init();
+	tevent_epoll_batch_init();
 #endif
 }
 
@@ -164,6 +165,7 @@ int tevent_common_context_destructor(struct tevent_context *ev)
 		te->event_ctx = NULL;
 		DLIST_REMOVE(ev->timer_events, te);
 	}
+	ev->timer_heap.num = 0;
 
 	for (ie = ev->immediate_events; ie; ie = in) {
 		in = ie->next;
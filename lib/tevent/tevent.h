@@ -38,6 +38,7 @@ struct tevent_ops;
 struct tevent_fd;
 struct tevent_timer;
 struct tevent_immediate;
+struct tevent_threaded_context;
 struct tevent_signal;
 
 /**
@@ -281,6 +282,59 @@ void _tevent_schedule_immediate(struct tevent_immediate *im,
 				   #handler, __location__);
 #endif
 
+/**
+ * @brief Create a context to schedule immediates from other threads
+ *
+ * A tevent_context and everything hanging off it is bound to the
+ * thread running the event loop. A tevent_threaded_context is the one
+ * exception: any thread may pass it to tevent_threaded_schedule_immediate().
+ *
+ * @param[in]  mem_ctx  The talloc memory context to use.
+ *
+ * @param[in]  ev       The event context the immediates will run on.
+ *
+ * @return              A new threaded context, NULL on error.
+ *
+ * @note The caller has to make sure that no thread is still using
+ * the threaded context when it or the event context is freed.
+ */
+struct tevent_threaded_context *tevent_threaded_context_create(
+	TALLOC_CTX *mem_ctx, struct tevent_context *ev);
+
+#ifdef DOXYGEN
+/**
+ * @brief Schedule an immediate event from any thread
+ *
+ * This is the thread safe variant of tevent_schedule_immediate(). The
+ * event is queued without taking a lock. The event loop thread is only
+ * woken up for the first event of a batch, it then runs the handlers
+ * of all queued events like normal immediate events.
+ *
+ * @param[in] tctx     The threaded context to use
+ * @param[in] im       The tevent_immediate object to populate and use,
+ *                     created by the event loop thread
+ * @param[in] handler  The event handler to run when this event fires
+ * @param[in] private_data  Data to pass to the event handler
+ *
+ * @note The immediate must not be used or freed by any thread until
+ * its handler runs in the event loop thread.
+ */
+void tevent_threaded_schedule_immediate(struct tevent_threaded_context *tctx,
+					struct tevent_immediate *im,
+					tevent_immediate_handler_t handler,
+					void *private_data);
+#else
+void _tevent_threaded_schedule_immediate(struct tevent_threaded_context *tctx,
+					 struct tevent_immediate *im,
+					 tevent_immediate_handler_t handler,
+					 void *private_data,
+					 const char *handler_name,
+					 const char *location);
+#define tevent_threaded_schedule_immediate(tctx, im, handler, private_data) \
+	_tevent_threaded_schedule_immediate(tctx, im, handler, private_data, \
+				   #handler, __location__);
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief Add a tevent signal handler
@@ -0,0 +1,556 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   main select loop and event handling - batched epoll implementation
+
+   Copyright (C) Andrew Tridgell	2003-2005
+   Copyright (C) Stefan Metzmacher	2005-2009
+
+     ** NOTE! The following LGPL license applies to the tevent
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  This differs from the "epoll" backend in two ways:
+
+  - tevent_fd_set_flags() only remembers the fd event as changed, the
+    epoll_ctl() calls happen just before the next epoll_wait(). Flags
+    that are toggled back and forth in between (a common pattern when
+    a writer queue runs empty and fills up again) cost nothing.
+
+  - all events of one epoll_wait() call are dispatched, not just one.
+
+  epoll is still used level-triggered: a tevent_fd handler is free to
+  only consume part of the available data and expects to be called
+  again.
+*/
+
+#include "replace.h"
+#include "system/filesys.h"
+#include "system/select.h"
+#include "tevent.h"
+#include "tevent_internal.h"
+#include "tevent_util.h"
+
+#define EPOLL_BATCH_MAXEVENTS 256
+
+struct epoll_batch_context {
+	/* a pointer back to the generic event_context */
+	struct tevent_context *ev;
+
+	/* when using epoll this is the handle from epoll_create */
+	int epoll_fd;
+
+	pid_t pid;
+
+	/* fd events with changes not yet passed to epoll_ctl() */
+	struct tevent_fd **changed;
+	size_t num_changed;
+	size_t changed_size;
+
+	/*
+	 * the result of the last epoll_wait(), a nested event loop
+	 * continues where the outer one was interrupted
+	 */
+	struct epoll_event events[EPOLL_BATCH_MAXEVENTS];
+	int num_events;
+	int next_event;
+
+	/* tells epoll_batch_dispatch() a handler freed the context */
+	bool *was_freed;
+};
+
+#define EPOLL_BATCH_FD_FLAG_HAS_EVENT	(1<<0)
+#define EPOLL_BATCH_FD_FLAG_GOT_ERROR	(1<<1)
+#define EPOLL_BATCH_FD_FLAG_CHANGED	(1<<2)
+
+/* the events registered with epoll_ctl() live in the upper 32 bits */
+#define EPOLL_BATCH_FD_EVENTS(fde) ((uint32_t)((fde)->additional_flags >> 32))
+
+/*
+  called when a epoll call fails
+*/
+static void epoll_batch_panic(struct epoll_batch_context *epoll_ev,
+			      const char *reason)
+{
+	tevent_debug(epoll_ev->ev, TEVENT_DEBUG_FATAL,
+		 "%s (%s) - calling abort()\n", reason, strerror(errno));
+	abort();
+}
+
+/*
+  map from TEVENT_FD_* to EPOLLIN/EPOLLOUT
+*/
+static uint32_t epoll_batch_map_flags(uint16_t flags)
+{
+	uint32_t ret = 0;
+	if (flags & TEVENT_FD_READ) ret |= (EPOLLIN | EPOLLERR | EPOLLHUP);
+	if (flags & TEVENT_FD_WRITE) ret |= (EPOLLOUT | EPOLLERR | EPOLLHUP);
+	return ret;
+}
+
+/*
+  free the epoll fd
+*/
+static int epoll_batch_ctx_destructor(struct epoll_batch_context *epoll_ev)
+{
+	if (epoll_ev->was_freed != NULL) {
+		*epoll_ev->was_freed = true;
+	}
+	close(epoll_ev->epoll_fd);
+	epoll_ev->epoll_fd = -1;
+	return 0;
+}
+
+static int epoll_batch_create(struct epoll_batch_context *epoll_ev)
+{
+	epoll_ev->epoll_fd = epoll_create(64);
+	if (epoll_ev->epoll_fd == -1) {
+		return -1;
+	}
+
+	if (!ev_set_close_on_exec(epoll_ev->epoll_fd)) {
+		tevent_debug(epoll_ev->ev, TEVENT_DEBUG_WARNING,
+			     "Failed to set close-on-exec, file descriptor may be leaked to children.\n");
+	}
+
+	epoll_ev->pid = getpid();
+	return 0;
+}
+
+/*
+  bring the epoll registration of an fd event in line with its flags
+*/
+static void epoll_batch_update_event(struct epoll_batch_context *epoll_ev,
+				     struct tevent_fd *fde)
+{
+	bool got_error = (fde->additional_flags & EPOLL_BATCH_FD_FLAG_GOT_ERROR);
+	bool want_read = (fde->flags & TEVENT_FD_READ);
+	bool want_write= (fde->flags & TEVENT_FD_WRITE);
+	struct epoll_event event;
+	uint32_t events = 0;
+	int op;
+
+	fde->additional_flags &= ~EPOLL_BATCH_FD_FLAG_CHANGED;
+
+	if (epoll_ev->epoll_fd == -1) return;
+
+	/*
+	 * if we want to match the select behavior, we need to remove
+	 * the epoll_event when the caller isn't interested in events.
+	 *
+	 * this is because epoll reports EPOLLERR and EPOLLHUP, even
+	 * without asking for them
+	 */
+	if (want_read || (want_write && !got_error)) {
+		events = epoll_batch_map_flags(fde->flags);
+	}
+
+	if (fde->additional_flags & EPOLL_BATCH_FD_FLAG_HAS_EVENT) {
+		if (events == EPOLL_BATCH_FD_EVENTS(fde)) {
+			return;
+		}
+		op = (events == 0) ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
+	} else {
+		if (events == 0) {
+			return;
+		}
+		op = EPOLL_CTL_ADD;
+	}
+
+	ZERO_STRUCT(event);
+	event.events = events;
+	event.data.ptr = fde;
+	if (epoll_ctl(epoll_ev->epoll_fd, op, fde->fd, &event) != 0) {
+		if (op == EPOLL_CTL_DEL) {
+			tevent_debug(epoll_ev->ev, TEVENT_DEBUG_FATAL,
+				     "epoll_batch_update_event failed! probable early close bug (%s)\n",
+				     strerror(errno));
+		} else {
+			epoll_batch_panic(epoll_ev, "epoll_ctl failed");
+		}
+	}
+
+	fde->additional_flags &= 0xffffffff;
+	if (events == 0) {
+		fde->additional_flags &= ~EPOLL_BATCH_FD_FLAG_HAS_EVENT;
+		return;
+	}
+	fde->additional_flags |= EPOLL_BATCH_FD_FLAG_HAS_EVENT;
+	fde->additional_flags |= ((uint64_t)events) << 32;
+}
+
+/*
+  remember an fd event for the next epoll_batch_flush()
+*/
+static void epoll_batch_mark_changed(struct epoll_batch_context *epoll_ev,
+				     struct tevent_fd *fde)
+{
+	if (fde->additional_flags & EPOLL_BATCH_FD_FLAG_CHANGED) {
+		return;
+	}
+
+	if (epoll_ev->num_changed == epoll_ev->changed_size) {
+		struct tevent_fd **changed;
+		size_t size = epoll_ev->changed_size * 2;
+
+		if (size < 16) {
+			size = 16;
+		}
+		changed = talloc_realloc(epoll_ev, epoll_ev->changed,
+					 struct tevent_fd *, size);
+		if (changed == NULL) {
+			/* no batching then */
+			epoll_batch_update_event(epoll_ev, fde);
+			return;
+		}
+		epoll_ev->changed = changed;
+		epoll_ev->changed_size = size;
+	}
+
+	epoll_ev->changed[epoll_ev->num_changed++] = fde;
+	fde->additional_flags |= EPOLL_BATCH_FD_FLAG_CHANGED;
+}
+
+/*
+  pass all pending changes to epoll_ctl()
+*/
+static void epoll_batch_flush(struct epoll_batch_context *epoll_ev)
+{
+	size_t i;
+
+	for (i=0; i<epoll_ev->num_changed; i++) {
+		epoll_batch_update_event(epoll_ev, epoll_ev->changed[i]);
+	}
+	epoll_ev->num_changed = 0;
+}
+
+/*
+  reopen the epoll handle when our pid changes
+  see http://junkcode.samba.org/ftp/unpacked/junkcode/epoll_fork.c for an
+  demonstration of why this is needed
+ */
+static void epoll_batch_check_reopen(struct epoll_batch_context *epoll_ev)
+{
+	struct tevent_fd *fde;
+
+	if (epoll_ev->pid == getpid()) {
+		return;
+	}
+
+	close(epoll_ev->epoll_fd);
+	epoll_ev->num_events = 0;
+	epoll_ev->next_event = 0;
+
+	if (epoll_batch_create(epoll_ev) != 0) {
+		tevent_debug(epoll_ev->ev, TEVENT_DEBUG_FATAL,
+			     "Failed to recreate epoll handle after fork\n");
+		return;
+	}
+
+	for (fde=epoll_ev->ev->fd_events;fde;fde=fde->next) {
+		fde->additional_flags &= ~EPOLL_BATCH_FD_FLAG_HAS_EVENT;
+		epoll_batch_mark_changed(epoll_ev, fde);
+	}
+}
+
+/*
+  dispatch the events left over from the last epoll_wait()
+*/
+static void epoll_batch_dispatch(struct epoll_batch_context *epoll_ev)
+{
+	bool *caller_freed = epoll_ev->was_freed;
+	bool freed = false;
+
+	epoll_ev->was_freed = &freed;
+
+	while (epoll_ev->next_event < epoll_ev->num_events) {
+		struct epoll_event *e = &epoll_ev->events[epoll_ev->next_event];
+		struct tevent_fd *fde;
+		uint16_t flags = 0;
+
+		epoll_ev->next_event += 1;
+
+		if (e->data.ptr == NULL) {
+			/* freed by an earlier handler of this batch */
+			continue;
+		}
+
+		fde = talloc_get_type(e->data.ptr, struct tevent_fd);
+		if (fde == NULL) {
+			epoll_batch_panic(epoll_ev, "epoll_wait() gave bad data");
+		}
+		if (e->events & (EPOLLHUP|EPOLLERR)) {
+			fde->additional_flags |= EPOLL_BATCH_FD_FLAG_GOT_ERROR;
+			/*
+			 * if we only wait for TEVENT_FD_WRITE, we should
+			 * not tell the event handler about it, and remove
+			 * the epoll_event, as we only report errors when
+			 * waiting for read events, to match the select()
+			 * behavior
+			 */
+			if (!(fde->flags & TEVENT_FD_READ)) {
+				epoll_batch_mark_changed(epoll_ev, fde);
+				continue;
+			}
+			flags |= TEVENT_FD_READ;
+		}
+		if (e->events & EPOLLIN) flags |= TEVENT_FD_READ;
+		if (e->events & EPOLLOUT) flags |= TEVENT_FD_WRITE;
+
+		/* an earlier handler might have changed the flags */
+		flags &= fde->flags;
+		if (flags) {
+			fde->handler(epoll_ev->ev, fde, flags, fde->private_data);
+			if (freed) {
+				if (caller_freed != NULL) {
+					*caller_freed = true;
+				}
+				return;
+			}
+		}
+	}
+
+	epoll_ev->was_freed = caller_freed;
+}
+
+/*
+  event loop handling using epoll
+*/
+static int epoll_batch_event_loop(struct epoll_batch_context *epoll_ev,
+				  struct timeval *tvalp)
+{
+	int ret;
+	int timeout = -1;
+
+	if (epoll_ev->epoll_fd == -1) return -1;
+
+	if (tvalp) {
+		/* it's better to trigger timed events a bit later than to early */
+		timeout = ((tvalp->tv_usec+999) / 1000) + (tvalp->tv_sec*1000);
+	}
+
+	if (epoll_ev->ev->signal_events &&
+	    tevent_common_check_signal(epoll_ev->ev)) {
+		return 0;
+	}
+
+	epoll_batch_flush(epoll_ev);
+
+	ret = epoll_wait(epoll_ev->epoll_fd, epoll_ev->events,
+			 EPOLL_BATCH_MAXEVENTS, timeout);
+
+	if (ret == -1 && errno == EINTR && epoll_ev->ev->signal_events) {
+		if (tevent_common_check_signal(epoll_ev->ev)) {
+			return 0;
+		}
+	}
+
+	if (ret == -1 && errno != EINTR) {
+		epoll_batch_panic(epoll_ev, "epoll_wait() failed");
+		return -1;
+	}
+
+	if (ret == 0 && tvalp) {
+		/* we don't care about a possible delay here */
+		tevent_common_loop_timer_delay(epoll_ev->ev);
+		return 0;
+	}
+
+	epoll_ev->num_events = MAX(ret, 0);
+	epoll_ev->next_event = 0;
+
+	epoll_batch_dispatch(epoll_ev);
+
+	return 0;
+}
+
+/*
+  create a epoll_batch_context structure.
+*/
+static int epoll_batch_event_context_init(struct tevent_context *ev)
+{
+	struct epoll_batch_context *epoll_ev;
+
+	epoll_ev = talloc_zero(ev, struct epoll_batch_context);
+	if (!epoll_ev) return -1;
+	epoll_ev->ev = ev;
+	epoll_ev->epoll_fd = -1;
+
+	if (epoll_batch_create(epoll_ev) != 0) {
+		tevent_debug(ev, TEVENT_DEBUG_FATAL,
+			     "Failed to create epoll handle.\n");
+		talloc_free(epoll_ev);
+		return -1;
+	}
+	talloc_set_destructor(epoll_ev, epoll_batch_ctx_destructor);
+
+	ev->additional_data = epoll_ev;
+	return 0;
+}
+
+/*
+  destroy an fd_event
+*/
+static int epoll_batch_event_fd_destructor(struct tevent_fd *fde)
+{
+	struct tevent_context *ev = fde->event_ctx;
+	struct epoll_batch_context *epoll_ev = NULL;
+	int i;
+
+	if (ev == NULL) {
+		return tevent_common_fd_destructor(fde);
+	}
+
+	epoll_ev = talloc_get_type(ev->additional_data,
+				   struct epoll_batch_context);
+
+	epoll_batch_check_reopen(epoll_ev);
+
+	if (fde->additional_flags & EPOLL_BATCH_FD_FLAG_CHANGED) {
+		size_t j;
+
+		for (j=0; j<epoll_ev->num_changed; j++) {
+			if (epoll_ev->changed[j] == fde) {
+				epoll_ev->changed[j] =
+					epoll_ev->changed[--epoll_ev->num_changed];
+				break;
+			}
+		}
+	}
+
+	/*
+	 * The fd is likely to be closed right after this, so this
+	 * can't wait for the next epoll_batch_flush()
+	 */
+	fde->flags = 0;
+	epoll_batch_update_event(epoll_ev, fde);
+
+	for (i=epoll_ev->next_event; i<epoll_ev->num_events; i++) {
+		if (epoll_ev->events[i].data.ptr == fde) {
+			epoll_ev->events[i].data.ptr = NULL;
+		}
+	}
+
+	return tevent_common_fd_destructor(fde);
+}
+
+/*
+  add a fd based event
+  return NULL on failure (memory allocation error)
+*/
+static struct tevent_fd *epoll_batch_event_add_fd(struct tevent_context *ev,
+						  TALLOC_CTX *mem_ctx,
+						  int fd, uint16_t flags,
+						  tevent_fd_handler_t handler,
+						  void *private_data,
+						  const char *handler_name,
+						  const char *location)
+{
+	struct epoll_batch_context *epoll_ev = talloc_get_type(
+		ev->additional_data, struct epoll_batch_context);
+	struct tevent_fd *fde;
+
+	epoll_batch_check_reopen(epoll_ev);
+
+	fde = tevent_common_add_fd(ev, mem_ctx, fd, flags,
+				   handler, private_data,
+				   handler_name, location);
+	if (!fde) return NULL;
+
+	talloc_set_destructor(fde, epoll_batch_event_fd_destructor);
+
+	epoll_batch_mark_changed(epoll_ev, fde);
+
+	return fde;
+}
+
+/*
+  set the fd event flags
+*/
+static void epoll_batch_event_set_fd_flags(struct tevent_fd *fde,
+					   uint16_t flags)
+{
+	struct tevent_context *ev;
+	struct epoll_batch_context *epoll_ev;
+
+	if (fde->flags == flags) return;
+
+	ev = fde->event_ctx;
+	epoll_ev = talloc_get_type(ev->additional_data,
+				   struct epoll_batch_context);
+
+	fde->flags = flags;
+
+	epoll_batch_check_reopen(epoll_ev);
+
+	epoll_batch_mark_changed(epoll_ev, fde);
+}
+
+/*
+  do a single event loop using the events defined in ev
+*/
+static int epoll_batch_event_loop_once(struct tevent_context *ev,
+				       const char *location)
+{
+	struct epoll_batch_context *epoll_ev = talloc_get_type(
+		ev->additional_data, struct epoll_batch_context);
+	struct timeval tval;
+
+	if (ev->signal_events &&
+	    tevent_common_check_signal(ev)) {
+		return 0;
+	}
+
+	if (ev->immediate_events &&
+	    tevent_common_loop_immediate(ev)) {
+		return 0;
+	}
+
+	tval = tevent_common_loop_timer_delay(ev);
+	if (tevent_timeval_is_zero(&tval)) {
+		return 0;
+	}
+
+	epoll_batch_check_reopen(epoll_ev);
+
+	if (epoll_ev->next_event < epoll_ev->num_events) {
+		/* we're nested in a handler of the current batch */
+		epoll_batch_dispatch(epoll_ev);
+		return 0;
+	}
+
+	return epoll_batch_event_loop(epoll_ev, &tval);
+}
+
+static const struct tevent_ops epoll_batch_event_ops = {
+	.context_init		= epoll_batch_event_context_init,
+	.add_fd			= epoll_batch_event_add_fd,
+	.set_fd_close_fn	= tevent_common_fd_set_close_fn,
+	.get_fd_flags		= tevent_common_fd_get_flags,
+	.set_fd_flags		= epoll_batch_event_set_fd_flags,
+	.add_timer		= tevent_common_add_timer,
+	.schedule_immediate	= tevent_common_schedule_immediate,
+	.add_signal		= tevent_common_add_signal,
+	.loop_once		= epoll_batch_event_loop_once,
+	.loop_wait		= tevent_common_loop_wait,
+};
+
+_PRIVATE_ bool tevent_epoll_batch_init(void)
+{
+	return tevent_register_backend("epoll_batch", &epoll_batch_event_ops);
+}
@@ -184,6 +184,9 @@ struct tevent_timer {
 	const char *location;
 	/* this is private for the events_ops implementation */
 	void *additional_data;
+	/* position in ev->timer_heap and tie breaker for equal times */
+	size_t heap_idx;
+	uint64_t heap_seq;
 };
 
 struct tevent_immediate {
@@ -232,9 +235,17 @@ struct tevent_context {
 	/* list of fd events - used by common code */
 	struct tevent_fd *fd_events;
 
-	/* list of timed events - used by common code */
+	/* list of timed events - used by common code, not ordered */
 	struct tevent_timer *timer_events;
 
+	/* the same timed events as a binary heap ordered by next_event */
+	struct {
+		struct tevent_timer **array;
+		size_t num;
+		size_t size;
+		uint64_t seq;
+	} timer_heap;
+
 	/* list of immediate events - used by common code */
 	struct tevent_immediate *immediate_events;
 
@@ -312,4 +323,5 @@ bool tevent_select_init(void);
 bool tevent_poll_init(void);
 #ifdef HAVE_EPOLL
 bool tevent_epoll_init(void);
+bool tevent_epoll_batch_init(void);
 #endif
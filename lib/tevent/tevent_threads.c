@@ -0,0 +1,211 @@
+/*
+   Unix SMB/CIFS implementation.
+
+   scheduling immediate events from other threads
+
+     ** NOTE! The following LGPL license applies to the tevent
+     ** library. This does NOT imply that all of Samba is released
+     ** under the LGPL
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 3 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "replace.h"
+#include "system/filesys.h"
+#include "tevent.h"
+#include "tevent_internal.h"
+#include "tevent_util.h"
+
+#ifdef HAVE_SYS_EVENTFD_H
+#include <sys/eventfd.h>
+#endif
+
+/*
+  The queue is a lock-free stack: producers push with a compare and
+  swap on "queue", the event loop thread takes the whole stack at once
+  and reverses it to run the events in the order they were scheduled.
+  Taking everything at once avoids the ABA problem of popping single
+  elements.
+
+  Only the producer that finds the stack empty wakes up the event
+  loop, the others know a wakeup is already on its way.
+*/
+
+struct tevent_threaded_context {
+	struct tevent_immediate * volatile queue;
+	struct tevent_fd *fde;
+	int read_fd;
+	int write_fd;
+};
+
+static void tevent_threaded_wakeup(struct tevent_threaded_context *tctx)
+{
+	ssize_t ret;
+
+#ifdef HAVE_EVENTFD
+	uint64_t val = 1;
+
+	do {
+		ret = write(tctx->write_fd, &val, sizeof(val));
+	} while ((ret == -1) && (errno == EINTR));
+#else
+	char c = 0;
+
+	/*
+	 * EAGAIN means the pipe is full, the event loop is woken up
+	 * anyway
+	 */
+	do {
+		ret = write(tctx->write_fd, &c, 1);
+	} while ((ret == -1) && (errno == EINTR));
+#endif
+}
+
+static void tevent_threaded_handler(struct tevent_context *ev,
+				    struct tevent_fd *fde,
+				    uint16_t flags,
+				    void *private_data)
+{
+	struct tevent_threaded_context *tctx = talloc_get_type_abort(
+		private_data, struct tevent_threaded_context);
+	struct tevent_immediate *im, *next, *list = NULL;
+	char buf[64];
+	ssize_t nread;
+
+	/*
+	 * Reset the wakeup before looking at the queue, so that events
+	 * pushed after the swap below wake us up again
+	 */
+	do {
+		nread = read(tctx->read_fd, buf, sizeof(buf));
+	} while ((nread == -1) && (errno == EINTR));
+
+	im = __sync_lock_test_and_set(&tctx->queue, NULL);
+
+	while (im != NULL) {
+		next = im->next;
+		im->next = list;
+		list = im;
+		im = next;
+	}
+
+	for (im = list; im != NULL; im = next) {
+		tevent_immediate_handler_t handler = im->handler;
+		void *handler_private = im->private_data;
+		const char *handler_name = im->handler_name;
+		const char *location = im->schedule_location;
+
+		next = im->next;
+		im->prev = NULL;
+		im->next = NULL;
+		im->handler = NULL;
+
+		_tevent_schedule_immediate(im, ev, handler, handler_private,
+					   handler_name, location);
+	}
+}
+
+static int tevent_threaded_context_destructor(
+	struct tevent_threaded_context *tctx)
+{
+	TALLOC_FREE(tctx->fde);
+	if (tctx->write_fd != tctx->read_fd) {
+		close(tctx->write_fd);
+	}
+	close(tctx->read_fd);
+	return 0;
+}
+
+struct tevent_threaded_context *tevent_threaded_context_create(
+	TALLOC_CTX *mem_ctx, struct tevent_context *ev)
+{
+	struct tevent_threaded_context *tctx;
+	int fds[2];
+
+	tctx = talloc_zero(mem_ctx, struct tevent_threaded_context);
+	if (tctx == NULL) {
+		return NULL;
+	}
+
+#ifdef HAVE_EVENTFD
+	fds[0] = eventfd(0, EFD_NONBLOCK|EFD_CLOEXEC);
+	if (fds[0] == -1) {
+		talloc_free(tctx);
+		return NULL;
+	}
+	fds[1] = fds[0];
+#else
+	if (pipe(fds) != 0) {
+		talloc_free(tctx);
+		return NULL;
+	}
+	ev_set_blocking(fds[0], false);
+	ev_set_blocking(fds[1], false);
+	if (!ev_set_close_on_exec(fds[0]) ||
+	    !ev_set_close_on_exec(fds[1])) {
+		tevent_debug(ev, TEVENT_DEBUG_WARNING,
+			     "Failed to set close-on-exec, file descriptor may be leaked to children.\n");
+	}
+#endif
+	tctx->read_fd = fds[0];
+	tctx->write_fd = fds[1];
+	talloc_set_destructor(tctx, tevent_threaded_context_destructor);
+
+	tctx->fde = tevent_add_fd(ev, tctx, tctx->read_fd, TEVENT_FD_READ,
+				  tevent_threaded_handler, tctx);
+	if (tctx->fde == NULL) {
+		talloc_free(tctx);
+		return NULL;
+	}
+
+	return tctx;
+}
+
+void _tevent_threaded_schedule_immediate(struct tevent_threaded_context *tctx,
+					 struct tevent_immediate *im,
+					 tevent_immediate_handler_t handler,
+					 void *private_data,
+					 const char *handler_name,
+					 const char *location)
+{
+	struct tevent_immediate *old, *cur;
+
+	if (handler == NULL) {
+		return;
+	}
+
+	/*
+	 * Nothing but this thread looks at im until the compare and
+	 * swap below, which is a full barrier
+	 */
+	im->handler		= handler;
+	im->private_data	= private_data;
+	im->handler_name	= handler_name;
+	im->schedule_location	= location;
+
+	/*
+	 * A stale value read here just makes the compare and swap
+	 * fail and hand us the current one
+	 */
+	cur = tctx->queue;
+	do {
+		old = cur;
+		im->next = old;
+		cur = __sync_val_compare_and_swap(&tctx->queue, old, im);
+	} while (cur != old);
+
+	if (old == NULL) {
+		tevent_threaded_wakeup(tctx);
+	}
+}
@@ -128,6 +128,94 @@ struct timeval tevent_timeval_current_ofs(uint32_t secs, uint32_t usecs)
 	return tevent_timeval_add(&tv, secs, usecs);
 }
 
+/*
+  the heap is ordered by next_event, timers with the same next_event
+  fire in the order they were added
+*/
+static bool tevent_timer_heap_before(const struct tevent_timer *te1,
+				     const struct tevent_timer *te2)
+{
+	int cmp = tevent_timeval_compare(&te1->next_event, &te2->next_event);
+	if (cmp != 0) {
+		return (cmp < 0);
+	}
+	return (te1->heap_seq < te2->heap_seq);
+}
+
+static void tevent_timer_heap_set(struct tevent_context *ev, size_t idx,
+				  struct tevent_timer *te)
+{
+	ev->timer_heap.array[idx] = te;
+	te->heap_idx = idx;
+}
+
+static void tevent_timer_heap_up(struct tevent_context *ev, size_t idx)
+{
+	struct tevent_timer *te = ev->timer_heap.array[idx];
+
+	while (idx > 0) {
+		size_t parent = (idx - 1) / 2;
+		struct tevent_timer *pe = ev->timer_heap.array[parent];
+
+		if (!tevent_timer_heap_before(te, pe)) {
+			break;
+		}
+		tevent_timer_heap_set(ev, idx, pe);
+		idx = parent;
+	}
+	tevent_timer_heap_set(ev, idx, te);
+}
+
+static void tevent_timer_heap_down(struct tevent_context *ev, size_t idx)
+{
+	struct tevent_timer *te = ev->timer_heap.array[idx];
+	size_t num = ev->timer_heap.num;
+
+	while (true) {
+		size_t child = idx * 2 + 1;
+		struct tevent_timer *ce;
+
+		if (child >= num) {
+			break;
+		}
+		ce = ev->timer_heap.array[child];
+		if ((child + 1 < num) &&
+		    tevent_timer_heap_before(ev->timer_heap.array[child+1],
+					     ce)) {
+			child += 1;
+			ce = ev->timer_heap.array[child];
+		}
+		if (!tevent_timer_heap_before(ce, te)) {
+			break;
+		}
+		tevent_timer_heap_set(ev, idx, ce);
+		idx = child;
+	}
+	tevent_timer_heap_set(ev, idx, te);
+}
+
+static void tevent_timer_heap_remove(struct tevent_context *ev,
+				     struct tevent_timer *te)
+{
+	size_t idx = te->heap_idx;
+	struct tevent_timer *last;
+
+	ev->timer_heap.num -= 1;
+	if (idx == ev->timer_heap.num) {
+		return;
+	}
+
+	last = ev->timer_heap.array[ev->timer_heap.num];
+	tevent_timer_heap_set(ev, idx, last);
+	if ((idx > 0) &&
+	    tevent_timer_heap_before(last,
+				     ev->timer_heap.array[(idx - 1) / 2])) {
+		tevent_timer_heap_up(ev, idx);
+	} else {
+		tevent_timer_heap_down(ev, idx);
+	}
+}
+
 /*
   destroy a timed event
 */
@@ -139,6 +227,7 @@ static int tevent_common_timed_destructor(struct tevent_timer *te)
 
 	if (te->event_ctx) {
 		DLIST_REMOVE(te->event_ctx->timer_events, te);
+		tevent_timer_heap_remove(te->event_ctx, te);
 	}
 
 	return 0;
@@ -150,7 +239,7 @@ static int tevent_common_timed_deny_destructor(struct tevent_timer *te)
 }
 
 /*
-  add a timed event
+  add a timed event, this is O(log n) in the number of timed events
   return NULL on failure (memory allocation error)
 */
 struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev, TALLOC_CTX *mem_ctx,
@@ -160,7 +249,23 @@ struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev, TALLOC_C
 					     const char *handler_name,
 					     const char *location)
 {
-	struct tevent_timer *te, *last_te, *cur_te;
+	struct tevent_timer *te;
+
+	if (ev->timer_heap.num == ev->timer_heap.size) {
+		struct tevent_timer **array;
+		size_t size = ev->timer_heap.size * 2;
+
+		if (size < 16) {
+			size = 16;
+		}
+		array = talloc_realloc(ev, ev->timer_heap.array,
+				       struct tevent_timer *, size);
+		if (array == NULL) {
+			return NULL;
+		}
+		ev->timer_heap.array = array;
+		ev->timer_heap.size = size;
+	}
 
 	te = talloc(mem_ctx?mem_ctx:ev, struct tevent_timer);
 	if (te == NULL) return NULL;
@@ -172,19 +277,14 @@ struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev, TALLOC_C
 	te->handler_name	= handler_name;
 	te->location		= location;
 	te->additional_data	= NULL;
+	te->heap_seq		= ev->timer_heap.seq++;
 
-	/* keep the list ordered */
-	last_te = NULL;
-	for (cur_te = ev->timer_events; cur_te; cur_te = cur_te->next) {
-		/* if the new event comes before the current one break */
-		if (tevent_timeval_compare(&te->next_event, &cur_te->next_event) < 0) {
-			break;
-		}
-
-		last_te = cur_te;
-	}
+	ev->timer_heap.num += 1;
+	tevent_timer_heap_set(ev, ev->timer_heap.num - 1, te);
+	tevent_timer_heap_up(ev, te->heap_idx);
 
-	DLIST_ADD_AFTER(ev->timer_events, te, last_te);
+	/* the list is not ordered, the heap is */
+	DLIST_ADD(ev->timer_events, te);
 
 	talloc_set_destructor(te, tevent_common_timed_destructor);
 
@@ -203,15 +303,17 @@ struct tevent_timer *tevent_common_add_timer(struct tevent_context *ev, TALLOC_C
 struct timeval tevent_common_loop_timer_delay(struct tevent_context *ev)
 {
 	struct timeval current_time = tevent_timeval_zero();
-	struct tevent_timer *te = ev->timer_events;
+	struct tevent_timer *te;
 
-	if (!te) {
+	if (ev->timer_heap.num == 0) {
 		/* have a default tick time of 30 seconds. This guarantees
 		   that code that uses its own timeout checking will be
 		   able to proceed eventually */
 		return tevent_timeval_set(30, 0);
 	}
 
+	te = ev->timer_heap.array[0];
+
 	/*
 	 * work out the right timeout for the next timed event
 	 *
@@ -243,6 +345,7 @@ struct timeval tevent_common_loop_timer_delay(struct tevent_context *ev)
 	 * handler because in a semi-async inner event loop called from the
 	 * handler we don't want to come across this event again -- vl */
 	DLIST_REMOVE(ev->timer_events, te);
+	tevent_timer_heap_remove(ev, te);
 
 	/*
 	 * If the timed event was registered for a zero current_time,
@@ -265,4 +368,3 @@ struct timeval tevent_common_loop_timer_delay(struct tevent_context *ev)
 
 	return tevent_timeval_zero();
 }
-
@@ -99,6 +99,8 @@ sub setup_env($$$)
 		return $self->setup_maptoguest("$path/maptoguest");
 	} elsif ($envname eq "ktest") {
 		return $self->setup_ktest("$path/ktest");
+	} elsif ($envname eq "namecache") {
+		return $self->setup_namecache("$path/namecache");
 	} elsif ($envname eq "secserver") {
 		if (not defined($self->{vars}->{s3dc})) {
 			if (not defined($self->setup_s3dc("$path/s3dc"))) {
@@ -523,6 +525,37 @@ map to guest = bad user
 	return $vars;
 }
 
+sub setup_namecache($$)
+{
+	my ($self, $path) = @_;
+
+	print "PROVISIONING server with shared name caches...";
+
+	my $namecache_options = "
+	name index = yes
+	stat cache shared = yes
+	directory stat cache = yes
+";
+
+	my $vars = $self->provision($path,
+				    "LOCALNAMECACHE8",
+				    8,
+				    "localnamecache8pass",
+				    $namecache_options);
+
+	$vars or return undef;
+
+	$self->check_or_start($vars, "yes", "no", "yes");
+
+	if (not $self->wait_for_start($vars)) {
+	       return undef;
+	}
+
+	$self->{vars}->{namecache} = $vars;
+
+	return $vars;
+}
+
 sub stop_sig_term($$) {
 	my ($self, $pid) = @_;
 	kill("USR1", $pid) or kill("ALRM", $pid) or warn("Unable to kill $pid: $!");
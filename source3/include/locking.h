@@ -54,13 +54,15 @@ struct byte_range_lock {
 	bool read_only;
 	struct file_id key;
 	struct lock_struct *lock_data;
+	br_off *tree_ends;	/* see brl_tree_build() */
 	struct db_record *record;
 };
 
 /* Internal structure in brlock.tdb. 
-   The data in brlock records is an unsorted linear array of these
-   records.  It is unnecessary to store the count as tdb provides the
-   size of the record */
+   The data in brlock records is a linear array of these records,
+   sorted by start offset. Locks with the same start are kept in the
+   order they were added. It is unnecessary to store the count as tdb
+   provides the size of the record */
 
 struct lock_struct {
 	struct lock_context context;
@@ -82,6 +82,7 @@ struct messaging_context {
 
 	struct messaging_backend *local;
 	struct messaging_backend *remote;
+	struct messaging_bcast *bcast;
 };
 
 struct messaging_backend {
@@ -98,6 +99,20 @@ NTSTATUS messaging_tdb_init(struct messaging_context *msg_ctx,
 
 bool messaging_tdb_parent_init(TALLOC_CTX *mem_ctx);
 
+NTSTATUS messaging_dgm_init(struct messaging_context *msg_ctx,
+			    TALLOC_CTX *mem_ctx,
+			    struct messaging_backend **presult);
+
+struct messaging_bcast;
+NTSTATUS messaging_bcast_init(struct messaging_context *msg_ctx,
+			      TALLOC_CTX *mem_ctx,
+			      struct messaging_bcast **presult);
+NTSTATUS messaging_bcast_outsider(void);
+void messaging_bcast_subscribe(struct messaging_bcast *b, uint32_t msg_type);
+void messaging_bcast_forget(struct messaging_bcast *b, pid_t pid);
+NTSTATUS messaging_bcast_send(struct messaging_bcast *b, uint32_t msg_type,
+			      const DATA_BLOB *data, int *pnum_sent);
+
 NTSTATUS messaging_ctdbd_init(struct messaging_context *msg_ctx,
 			      TALLOC_CTX *mem_ctx,
 			      struct messaging_backend **presult);
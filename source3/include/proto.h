@@ -211,6 +211,7 @@ ssize_t drain_socket(int sockfd, size_t count);
 /* The following definitions come from lib/sendfile.c  */
 
 ssize_t sys_sendfile(int tofd, int fromfd, const DATA_BLOB *header, SMB_OFF_T offset, size_t count);
+ssize_t sys_splicefile(int tofd, int fromfd, SMB_OFF_T offset, size_t count);
 
 /* The following definitions come from lib/server_mutex.c  */
 
@@ -1305,6 +1306,9 @@ int lp_passwd_chat_timeout(void);
 bool lp_nt_pipe_support(void);
 bool lp_nt_status_support(void);
 bool lp_stat_cache(void);
+bool lp_name_index(void);
+bool lp_stat_cache_shared(void);
+bool lp_dir_stat_cache(void);
 int lp_max_stat_cache_size(void);
 bool lp_allow_trusted_domains(void);
 bool lp_map_untrusted_to_domain(void);
@@ -1367,6 +1371,7 @@ int lp_smb2_max_read(void);
 int lp_smb2_max_write(void);
 int lp_smb2_max_trans(void);
 int lp_smb2_max_credits(void);
+int lp_smb2_worker_threads(void);
 char *lp_preexec(int );
 char *lp_postexec(int );
 char *lp_rootpreexec(int );
@@ -1388,6 +1393,7 @@ int lp_cups_connection_timeout(void);
 const char *lp_ctdbd_socket(void);
 const char **lp_cluster_addresses(void);
 bool lp_clustering(void);
+bool lp_messaging_sockets(void);
 int lp_ctdb_timeout(void);
 int lp_ctdb_locktime_warn_threshold(void);
 char *lp_printcommand(int );
@@ -1698,6 +1704,7 @@ struct tevent_req *fncall_send(TALLOC_CTX *mem_ctx, struct tevent_context *ev,
 			       void (*fn)(void *private_data),
 			       void *private_data);
 int fncall_recv(struct tevent_req *req, int *perr);
+int fncall_num_pending(struct fncall_context *ctx);
 
 /* The following definitions come from libsmb/smbsock_connect.c */
 
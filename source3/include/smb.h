@@ -228,6 +228,7 @@ typedef struct files_struct {
 	struct fd_handle *fh;
 	unsigned int num_smb_operations;
 	struct file_id file_id;
+	struct files_struct *file_id_next; /* see fsp_id_hash_add() */
 	uint64_t initial_allocation_size; /* Faked up initial allocation on disk. */
 	mode_t mode;
 	uint16 file_pid;
@@ -70,6 +70,49 @@ NTSTATUS dbwrap_record_store(struct db_record *rec, TDB_DATA data, int flags)
 	return rec->store(rec, data, flags);
 }
 
+/*
+ * Overwrite part of a record and set its new size, see
+ * tdb_store_range(). Backends that can't change a record in place get
+ * it rewritten from rec->value, which is kept current for that. Don't
+ * mix this with dbwrap_record_store() on the same record.
+ */
+NTSTATUS dbwrap_record_store_range(struct db_record *rec, uint32_t ofs,
+				   TDB_DATA data, uint32_t new_size)
+{
+	uint8_t *buf;
+	NTSTATUS status;
+
+	if (rec->store_range != NULL) {
+		return rec->store_range(rec, ofs, data, new_size);
+	}
+
+	if (rec->value.dptr == NULL) {
+		return NT_STATUS_NOT_FOUND;
+	}
+	if ((ofs > rec->value.dsize) ||
+	    (ofs + data.dsize < ofs) ||
+	    (ofs + data.dsize > new_size) ||
+	    ((new_size > rec->value.dsize) &&
+	     (new_size > ofs + data.dsize))) {
+		return NT_STATUS_INVALID_PARAMETER;
+	}
+
+	buf = talloc_array(rec, uint8_t, new_size);
+	if (buf == NULL) {
+		return NT_STATUS_NO_MEMORY;
+	}
+	memcpy(buf, rec->value.dptr, MIN(rec->value.dsize, new_size));
+	memcpy(buf + ofs, data.dptr, data.dsize);
+
+	status = dbwrap_record_store(rec, make_tdb_data(buf, new_size), 0);
+	if (!NT_STATUS_IS_OK(status)) {
+		TALLOC_FREE(buf);
+		return status;
+	}
+	rec->value = make_tdb_data(buf, new_size);
+	return NT_STATUS_OK;
+}
+
 NTSTATUS dbwrap_record_delete(struct db_record *rec)
 {
 	return rec->delete_rec(rec);
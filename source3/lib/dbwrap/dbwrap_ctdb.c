@@ -531,6 +531,7 @@ static struct db_record *db_ctdb_fetch_locked_transaction(struct db_ctdb_ctx *ct
 	}
 
 	result->store = db_ctdb_store_transaction;
+	result->store_range = NULL;
 	result->delete_rec = db_ctdb_delete_transaction;
 
 	if (pull_newest_from_marshall_buffer(ctx->transaction->m_write, key,
@@ -1054,6 +1055,7 @@ again:
 	}
 
 	result->store = db_ctdb_store;
+	result->store_range = NULL;
 	result->delete_rec = db_ctdb_delete;
 	talloc_set_destructor(result, db_ctdb_record_destr);
 
@@ -1354,6 +1356,7 @@ static void traverse_read_callback(TDB_DATA key, TDB_DATA data, void *private_da
 	rec.key = key;
 	rec.value = data;
 	rec.store = db_ctdb_store_deny;
+	rec.store_range = NULL;
 	rec.delete_rec = db_ctdb_delete_deny;
 	rec.private_data = state->db;
 	state->fn(&rec, state->private_data);
@@ -1378,6 +1381,7 @@ static int traverse_persistent_callback_read(TDB_CONTEXT *tdb, TDB_DATA kbuf, TD
 	rec.key = kbuf;
 	rec.value = dbuf;
 	rec.store = db_ctdb_store_deny;
+	rec.store_range = NULL;
 	rec.delete_rec = db_ctdb_delete_deny;
 	rec.private_data = state->db;
 
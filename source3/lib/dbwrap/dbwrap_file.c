@@ -96,6 +96,7 @@ static struct db_record *db_file_fetch_locked(struct db_context *db,
 
 	result->private_data = file;
 	result->store = db_file_store;
+	result->store_range = NULL;
 	result->delete_rec = db_file_delete;
 
 	result->key.dsize = key.dsize;
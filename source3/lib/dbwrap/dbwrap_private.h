@@ -26,6 +26,8 @@
 struct db_record {
 	TDB_DATA key, value;
 	NTSTATUS (*store)(struct db_record *rec, TDB_DATA data, int flag);
+	NTSTATUS (*store_range)(struct db_record *rec, uint32_t ofs,
+				TDB_DATA data, uint32_t new_size);
 	NTSTATUS (*delete_rec)(struct db_record *rec);
 	void *private_data;
 };
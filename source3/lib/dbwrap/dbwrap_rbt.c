@@ -293,6 +293,7 @@ static struct db_record *db_rbt_fetch_locked(struct db_context *db_ctx,
 	rec_priv->db_ctx = ctx;
 
 	result->store = db_rbt_store;
+	result->store_range = NULL;
 	result->delete_rec = db_rbt_delete;
 	result->private_data = rec_priv;
 
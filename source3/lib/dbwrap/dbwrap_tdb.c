@@ -30,6 +30,8 @@ struct db_tdb_ctx {
 };
 
 static NTSTATUS db_tdb_store(struct db_record *rec, TDB_DATA data, int flag);
+static NTSTATUS db_tdb_store_range(struct db_record *rec, uint32_t ofs,
+				   TDB_DATA data, uint32_t new_size);
 static NTSTATUS db_tdb_delete(struct db_record *rec);
 
 static void db_tdb_log_key(const char *prefix, TDB_DATA key)
@@ -133,6 +135,7 @@ static struct db_record *db_tdb_fetch_locked(struct db_context *db,
 
 	state.result->private_data = talloc_reference(state.result, ctx);
 	state.result->store = db_tdb_store;
+	state.result->store_range = db_tdb_store_range;
 	state.result->delete_rec = db_tdb_delete;
 
 	DEBUG(10, ("Allocated locked data 0x%p\n", state.result));
@@ -210,6 +213,22 @@ static NTSTATUS db_tdb_store(struct db_record *rec, TDB_DATA data, int flag)
 		NT_STATUS_OK : NT_STATUS_UNSUCCESSFUL;
 }
 
+static NTSTATUS db_tdb_store_range(struct db_record *rec, uint32_t ofs,
+				   TDB_DATA data, uint32_t new_size)
+{
+	struct db_tdb_ctx *ctx = talloc_get_type_abort(rec->private_data,
+						       struct db_tdb_ctx);
+
+	if (tdb_store_range(ctx->wtdb->tdb, rec->key, ofs, data,
+			    new_size) == 0) {
+		return NT_STATUS_OK;
+	}
+	if (tdb_error(ctx->wtdb->tdb) == TDB_ERR_NOEXIST) {
+		return NT_STATUS_NOT_FOUND;
+	}
+	return NT_STATUS_UNSUCCESSFUL;
+}
+
 static NTSTATUS db_tdb_delete(struct db_record *rec)
 {
 	struct db_tdb_ctx *ctx = talloc_get_type_abort(rec->private_data,
@@ -242,6 +261,7 @@ static int db_tdb_traverse_func(TDB_CONTEXT *tdb, TDB_DATA kbuf, TDB_DATA dbuf,
 	rec.key = kbuf;
 	rec.value = dbuf;
 	rec.store = db_tdb_store;
+	rec.store_range = db_tdb_store_range;
 	rec.delete_rec = db_tdb_delete;
 	rec.private_data = ctx->db->private_data;
 
@@ -282,6 +302,7 @@ static int db_tdb_traverse_read_func(TDB_CONTEXT *tdb, TDB_DATA kbuf, TDB_DATA d
 	rec.key = kbuf;
 	rec.value = dbuf;
 	rec.store = db_tdb_store_deny;
+	rec.store_range = NULL;
 	rec.delete_rec = db_tdb_delete_deny;
 	rec.private_data = ctx->db->private_data;
 
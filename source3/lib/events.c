@@ -171,7 +171,7 @@ bool event_add_to_poll_args(struct tevent_context *ev, TALLOC_CTX *mem_ctx,
 	}
 
 	now = timeval_current();
-	diff = timeval_until(&now, &ev->timer_events->next_event);
+	diff = timeval_until(&now, &ev->timer_heap.array[0]->next_event);
 	timeout = timeval_to_msec(diff);
 
 	if (timeout < *ptimeout) {
@@ -187,7 +187,6 @@ bool run_events_poll(struct tevent_context *ev, int pollrtn,
 	struct tevent_poll_private *state;
 	int *pollfd_idx;
 	struct tevent_fd *fde;
-	struct timeval now;
 
 	if (ev->signal_events &&
 	    tevent_common_check_signal(ev)) {
@@ -199,34 +198,18 @@ bool run_events_poll(struct tevent_context *ev, int pollrtn,
 		return true;
 	}
 
-	GetTimeOfDay(&now);
-
-	if ((ev->timer_events != NULL)
-	    && (timeval_compare(&now, &ev->timer_events->next_event) >= 0)) {
-		/* this older events system did not auto-free timed
-		   events on running them, and had a race condition
-		   where the event could be called twice if the
-		   talloc_free of the te happened after the callback
-		   made a call which invoked the event loop. To avoid
-		   this while still allowing old code which frees the
-		   te, we need to create a temporary context which
-		   will be used to ensure the te is freed. We also
-		   remove the te from the timed event list before we
-		   call the handler, to ensure we can't loop */
-
-		struct tevent_timer *te = ev->timer_events;
-		TALLOC_CTX *tmp_ctx = talloc_new(ev);
-
-		DEBUG(10, ("Running timed event \"%s\" %p\n",
-			   ev->timer_events->handler_name, ev->timer_events));
-
-		DLIST_REMOVE(ev->timer_events, te);
-		talloc_steal(tmp_ctx, te);
-
-		te->handler(ev, te, now, te->private_data);
+	if (ev->timer_events != NULL) {
+		/*
+		 * This runs at most one timed event that is due. The
+		 * handler may still talloc_free() the te like the
+		 * older events system allowed, the common code denies
+		 * that and frees it after the handler returns.
+		 */
+		struct timeval delay = tevent_common_loop_timer_delay(ev);
 
-		talloc_free(tmp_ctx);
-		return true;
+		if (timeval_is_zero(&delay)) {
+			return true;
+		}
 	}
 
 	if (pollrtn <= 0) {
@@ -305,7 +288,7 @@ struct timeval *get_timed_events_timeout(struct tevent_context *ev,
 	}
 
 	now = timeval_current();
-	*to_ret = timeval_until(&now, &ev->timer_events->next_event);
+	*to_ret = timeval_until(&now, &ev->timer_heap.array[0]->next_event);
 
 	DEBUG(10, ("timed_events_timeout: %d/%d\n", (int)to_ret->tv_sec,
 		(int)to_ret->tv_usec));
@@ -324,6 +324,16 @@ int fncall_recv(struct tevent_req *req, int *perr)
 	return 0;
 }
 
+/*
+ * Number of jobs handed to the helper threads that have not been
+ * collected yet, including the ones whose caller went away.
+ */
+
+int fncall_num_pending(struct fncall_context *ctx)
+{
+	return talloc_array_length(ctx->pending) + ctx->num_orphaned;
+}
+
 #else  /* WITH_PTHREADPOOL */
 
 struct fncall_context {
@@ -362,4 +372,9 @@ int fncall_recv(struct tevent_req *req, int *perr)
 	return 0;
 }
 
+int fncall_num_pending(struct fncall_context *ctx)
+{
+	return 0;
+}
+
 #endif
@@ -132,9 +132,12 @@ static int traverse_fn(struct db_record *rec, const struct server_id *id,
 /**
  * Send a message to all smbd processes.
  *
- * It isn't very efficient, but should be OK for the sorts of
- * applications that use it. When we need efficient broadcast we can add
- * it.
+ * With the broadcast ring the message is stored once and only the
+ * processes with a handler for msg_type are woken up. The few that
+ * don't read the ring, for example those running with "messaging
+ * sockets = no", are listed next to it and get the message directly.
+ * Without the ring, for example with clustering, we walk serverid.tdb,
+ * which isn't very efficient.
  *
  * @param n_sent Set to the number of messages sent.  This should be
  * equal to the number of processes, but be careful for races.
@@ -165,6 +168,24 @@ bool message_send_all(struct messaging_context *msg_ctx,
 		return false;
 	}
 
+	if (msg_ctx->bcast != NULL) {
+		DATA_BLOB blob = data_blob_const(buf, len);
+		NTSTATUS status;
+		int num_sent = 0;
+
+		status = messaging_bcast_send(msg_ctx->bcast, msg_type,
+					      &blob, &num_sent);
+		if (!NT_STATUS_IS_OK(status)) {
+			DEBUG(1, ("messaging_bcast_send failed: %s\n",
+				  nt_errstr(status)));
+			return false;
+		}
+		if (n_sent) {
+			*n_sent = num_sent;
+		}
+		return true;
+	}
+
 	msg_all.buf = buf;
 	msg_all.len = len;
 	msg_all.n_sent = 0;
@@ -181,6 +202,64 @@ struct event_context *messaging_event_context(struct messaging_context *msg_ctx)
 	return msg_ctx->event_ctx;
 }
 
+/*
+ * Broadcasts among the processes on this node go through a shared
+ * ring, the doorbell for it is a datagram. With clustering they have
+ * to reach the other nodes too, message_send_all walks serverid.tdb
+ * then.
+ */
+static void messaging_bcast_setup(struct messaging_context *msg_ctx)
+{
+	struct messaging_callback *cb;
+	NTSTATUS status;
+
+	if (lp_clustering()) {
+		return;
+	}
+
+	status = messaging_bcast_init(msg_ctx, msg_ctx, &msg_ctx->bcast);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(2, ("messaging_bcast_init failed: %s\n",
+			  nt_errstr(status)));
+		messaging_bcast_outsider();
+		return;
+	}
+
+	/* After a fork we inherit the handlers */
+	for (cb = msg_ctx->callbacks; cb != NULL; cb = cb->next) {
+		messaging_bcast_subscribe(msg_ctx->bcast, cb->msg_type);
+	}
+}
+
+/*
+ * Set up the backend for messages to processes on this node. The
+ * datagram socket backend still reaches processes without a socket
+ * through messages.tdb, so the tdb backend alone is only needed if
+ * we can't bind our socket.
+ */
+static NTSTATUS messaging_local_init(struct messaging_context *msg_ctx)
+{
+	NTSTATUS status;
+
+	if (lp_messaging_sockets()) {
+		status = messaging_dgm_init(msg_ctx, msg_ctx,
+					    &msg_ctx->local);
+		if (NT_STATUS_IS_OK(status)) {
+			messaging_bcast_setup(msg_ctx);
+			return NT_STATUS_OK;
+		}
+		DEBUG(2, ("messaging_dgm_init failed: %s, "
+			  "using messages.tdb only\n", nt_errstr(status)));
+	}
+
+	status = messaging_tdb_init(msg_ctx, msg_ctx, &msg_ctx->local);
+	if (NT_STATUS_IS_OK(status) && !lp_clustering()) {
+		/* Senders using the broadcast ring have to know us */
+		messaging_bcast_outsider();
+	}
+	return status;
+}
+
 struct messaging_context *messaging_init(TALLOC_CTX *mem_ctx, 
 					 struct event_context *ev)
 {
@@ -194,10 +273,10 @@ struct messaging_context *messaging_init(TALLOC_CTX *mem_ctx,
 	ctx->id = procid_self();
 	ctx->event_ctx = ev;
 
-	status = messaging_tdb_init(ctx, ctx, &ctx->local);
+	status = messaging_local_init(ctx);
 
 	if (!NT_STATUS_IS_OK(status)) {
-		DEBUG(2, ("messaging_tdb_init failed: %s\n",
+		DEBUG(2, ("messaging_local_init failed: %s\n",
 			  nt_errstr(status)));
 		TALLOC_FREE(ctx);
 		return NULL;
@@ -240,13 +319,14 @@ NTSTATUS messaging_reinit(struct messaging_context *msg_ctx)
 {
 	NTSTATUS status;
 
+	TALLOC_FREE(msg_ctx->bcast);
 	TALLOC_FREE(msg_ctx->local);
 
 	msg_ctx->id = procid_self();
 
-	status = messaging_tdb_init(msg_ctx, msg_ctx, &msg_ctx->local);
+	status = messaging_local_init(msg_ctx);
 	if (!NT_STATUS_IS_OK(status)) {
-		DEBUG(0, ("messaging_tdb_init failed: %s\n",
+		DEBUG(0, ("messaging_local_init failed: %s\n",
 			  nt_errstr(status)));
 		return status;
 	}
@@ -306,6 +386,10 @@ NTSTATUS messaging_register(struct messaging_context *msg_ctx,
 		}
 	}
 
+	if (msg_ctx->bcast != NULL) {
+		messaging_bcast_subscribe(msg_ctx->bcast, msg_type);
+	}
+
 	if (!(cb = talloc(msg_ctx, struct messaging_callback))) {
 		return NT_STATUS_NO_MEMORY;
 	}
@@ -0,0 +1,867 @@
+/*
+   Unix SMB/CIFS implementation.
+   Broadcast messages through a shared ring buffer
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * lock_path("msg/broadcast") is mapped shared by all processes using
+ * the datagram messaging backend. It holds a table of subscribers and
+ * a ring of broadcast records.
+ *
+ * A sender appends the NDR encoded messaging_rec once under an fcntl
+ * lock. Message types are hashed onto MESSAGING_BCAST_NUM_LISTS lists,
+ * every subscriber is on the lists of the types it has handlers for.
+ * The sender walks only the list of msg_type and sends a
+ * MSG_BROADCAST_RING doorbell to those that did not get one since
+ * they last looked at the ring. Processes not interested in msg_type
+ * cost the sender nothing. The subscriber then reads all records from
+ * its cursor up to the head of the ring without taking any lock.
+ *
+ * The sender never waits for slow subscribers. When the ring is full
+ * it drops the oldest records, after announcing the range in
+ * write_end. A reader that finds its record in that range afterwards
+ * was too slow, it continues at tail and loses the broadcasts in
+ * between.
+ *
+ * Processes without a slot, because they run with "messaging sockets =
+ * no" or all slots are taken, put their pid into a small table of
+ * outsiders. They get every broadcast sent directly.
+ */
+
+#include "includes.h"
+#include "system/filesys.h"
+#include "system/shmem.h"
+#include "messages.h"
+
+#define MESSAGING_BCAST_MAGIC 0x3254534342534d53ULL	/* "SMSBCST2" */
+
+#define MESSAGING_BCAST_RING_SIZE (1024*1024)
+#define MESSAGING_BCAST_NUM_SLOTS 16384
+#define MESSAGING_BCAST_NUM_LISTS 32
+#define MESSAGING_BCAST_NUM_OUTSIDERS 64
+
+#define MESSAGING_BCAST_HDR_SPACE 4096
+
+/*
+ * length, msg_type, length of the NDR blob, unused. Records are
+ * aligned to 16 bytes, so a record header always fits in front of
+ * the end of the ring.
+ */
+#define MESSAGING_BCAST_REC_HDR 16
+
+#define messaging_bcast_barrier() __sync_synchronize()
+
+/*
+ * Slots are linked by their index + 1, 0 ends a list
+ */
+struct messaging_bcast_header {
+	uint64_t magic;
+	uint32_t ring_size;
+	uint32_t num_slots;
+	uint32_t num_lists;
+	uint32_t slots_used;
+	uint64_t head;
+	uint64_t write_end;
+	uint64_t tail;
+	uint16_t lists[MESSAGING_BCAST_NUM_LISTS];
+	uint32_t outsiders[MESSAGING_BCAST_NUM_OUTSIDERS];
+};
+
+struct messaging_bcast_slot {
+	uint32_t pid;
+	uint32_t wake_pending;
+	uint64_t cursor;
+	uint32_t lists;		/* bitmap of the lists we are on */
+	uint32_t unused;
+	uint16_t next[MESSAGING_BCAST_NUM_LISTS];
+	uint16_t prev[MESSAGING_BCAST_NUM_LISTS];
+};
+
+struct messaging_bcast {
+	struct messaging_context *msg_ctx;
+	pid_t pid;
+	int fd;
+	uint8_t *map;
+	size_t maplen;
+	struct messaging_bcast_header *hdr;
+	struct messaging_bcast_slot *slots;
+	uint8_t *ring;
+	struct messaging_bcast_slot *slot;
+};
+
+static void messaging_bcast_doorbell(struct messaging_context *msg_ctx,
+				     void *private_data,
+				     uint32_t msg_type,
+				     struct server_id server_id,
+				     DATA_BLOB *data);
+
+static unsigned messaging_bcast_list(uint32_t msg_type)
+{
+	return ((msg_type & MSG_TYPE_MASK) * 2654435761U) >> 27;
+}
+
+static bool messaging_bcast_lock(struct messaging_bcast *b)
+{
+	return fcntl_lock(b->fd, SMB_F_SETLKW, 0, 1, F_WRLCK);
+}
+
+static void messaging_bcast_unlock(struct messaging_bcast *b)
+{
+	fcntl_lock(b->fd, SMB_F_SETLKW, 0, 1, F_UNLCK);
+}
+
+/*
+ * The list functions are called with the lock held. Senders walk the
+ * lists without it, so a slot taken off a list keeps its next pointer.
+ */
+static void messaging_bcast_list_add(struct messaging_bcast *b,
+				     struct messaging_bcast_slot *slot,
+				     unsigned n)
+{
+	uint16_t idx = (slot - b->slots) + 1;
+	uint16_t first = b->hdr->lists[n];
+
+	slot->prev[n] = 0;
+	slot->next[n] = first;
+	if (first != 0) {
+		b->slots[first-1].prev[n] = idx;
+	}
+	slot->lists |= (1U << n);
+	messaging_bcast_barrier();
+	b->hdr->lists[n] = idx;
+}
+
+static void messaging_bcast_list_del(struct messaging_bcast *b,
+				     struct messaging_bcast_slot *slot,
+				     unsigned n)
+{
+	uint16_t next = slot->next[n];
+	uint16_t prev = slot->prev[n];
+
+	if (next != 0) {
+		b->slots[next-1].prev[n] = prev;
+	}
+	if (prev != 0) {
+		b->slots[prev-1].next[n] = next;
+	} else {
+		b->hdr->lists[n] = next;
+	}
+	slot->lists &= ~(1U << n);
+}
+
+static void messaging_bcast_release(struct messaging_bcast *b,
+				    struct messaging_bcast_slot *slot)
+{
+	unsigned n;
+
+	for (n=0; n<MESSAGING_BCAST_NUM_LISTS; n++) {
+		if (slot->lists & (1U << n)) {
+			messaging_bcast_list_del(b, slot, n);
+		}
+	}
+	slot->wake_pending = 0;
+	messaging_bcast_barrier();
+	slot->pid = 0;
+}
+
+/*
+ * Free the slot of a subscriber that is gone, unless somebody else
+ * already did and the slot has been taken again
+ */
+static void messaging_bcast_reap(struct messaging_bcast *b,
+				 struct messaging_bcast_slot *slot,
+				 uint32_t pid)
+{
+	if (!messaging_bcast_lock(b)) {
+		return;
+	}
+	if (slot->pid == pid) {
+		messaging_bcast_release(b, slot);
+	}
+	messaging_bcast_unlock(b);
+}
+
+static int messaging_bcast_destructor(struct messaging_bcast *b)
+{
+	if ((b->slot != NULL) && (b->pid == getpid()) &&
+	    messaging_bcast_lock(b)) {
+		messaging_bcast_release(b, b->slot);
+		messaging_bcast_unlock(b);
+	}
+	if (b->map != NULL) {
+		munmap(b->map, b->maplen);
+	}
+	if (b->fd != -1) {
+		close(b->fd);
+	}
+	return 0;
+}
+
+/*
+ * Map the broadcast file, setting it up if we are the first. Returns
+ * with the lock held.
+ */
+static NTSTATUS messaging_bcast_open(TALLOC_CTX *mem_ctx,
+				     struct messaging_bcast **presult)
+{
+	struct messaging_bcast *b;
+	struct messaging_bcast_header *hdr;
+	struct stat st;
+	NTSTATUS status;
+
+	b = talloc_zero(mem_ctx, struct messaging_bcast);
+	if (b == NULL) {
+		return NT_STATUS_NO_MEMORY;
+	}
+	b->pid = getpid();
+	b->fd = -1;
+	b->maplen = MESSAGING_BCAST_HDR_SPACE +
+		MESSAGING_BCAST_NUM_SLOTS * sizeof(struct messaging_bcast_slot) +
+		MESSAGING_BCAST_RING_SIZE;
+
+	talloc_set_destructor(b, messaging_bcast_destructor);
+
+	b->fd = open(lock_path("msg/broadcast"), O_RDWR|O_CREAT, 0600);
+	if (b->fd == -1) {
+		status = map_nt_error_from_unix(errno);
+		DEBUG(1, ("Could not open %s: %s\n",
+			  lock_path("msg/broadcast"), strerror(errno)));
+		TALLOC_FREE(b);
+		return status;
+	}
+	smb_set_close_on_exec(b->fd);
+
+	if (!messaging_bcast_lock(b)) {
+		TALLOC_FREE(b);
+		return NT_STATUS_LOCK_NOT_GRANTED;
+	}
+
+	if (fstat(b->fd, &st) == -1) {
+		status = map_nt_error_from_unix(errno);
+		goto fail;
+	}
+	if ((st.st_size != b->maplen) && (ftruncate(b->fd, b->maplen) == -1)) {
+		status = map_nt_error_from_unix(errno);
+		DEBUG(1, ("Could not size %s: %s\n",
+			  lock_path("msg/broadcast"), strerror(errno)));
+		goto fail;
+	}
+
+	b->map = (uint8_t *)mmap(NULL, b->maplen, PROT_READ|PROT_WRITE,
+				 MAP_SHARED|MAP_FILE, b->fd, 0);
+	if (b->map == (uint8_t *)MAP_FAILED) {
+		status = map_nt_error_from_unix(errno);
+		DEBUG(1, ("mmap failed: %s\n", strerror(errno)));
+		b->map = NULL;
+		goto fail;
+	}
+
+	hdr = b->hdr = (struct messaging_bcast_header *)b->map;
+	b->slots = (struct messaging_bcast_slot *)
+		(b->map + MESSAGING_BCAST_HDR_SPACE);
+	b->ring = (uint8_t *)(b->slots + MESSAGING_BCAST_NUM_SLOTS);
+
+	if ((hdr->magic != MESSAGING_BCAST_MAGIC) ||
+	    (hdr->ring_size != MESSAGING_BCAST_RING_SIZE) ||
+	    (hdr->num_slots != MESSAGING_BCAST_NUM_SLOTS) ||
+	    (hdr->num_lists != MESSAGING_BCAST_NUM_LISTS)) {
+		/* New file or one of a different layout */
+		memset(b->map, 0, MESSAGING_BCAST_HDR_SPACE +
+		       MESSAGING_BCAST_NUM_SLOTS *
+		       sizeof(struct messaging_bcast_slot));
+		hdr->ring_size = MESSAGING_BCAST_RING_SIZE;
+		hdr->num_slots = MESSAGING_BCAST_NUM_SLOTS;
+		hdr->num_lists = MESSAGING_BCAST_NUM_LISTS;
+		messaging_bcast_barrier();
+		hdr->magic = MESSAGING_BCAST_MAGIC;
+	}
+
+	*presult = b;
+	return NT_STATUS_OK;
+
+fail:
+	messaging_bcast_unlock(b);
+	TALLOC_FREE(b);
+	return status;
+}
+
+/*
+ * Take a slot in the subscriber table, reusing those of exited
+ * processes. Called with the lock held.
+ */
+static bool messaging_bcast_attach(struct messaging_bcast *b)
+{
+	struct messaging_bcast_header *hdr = b->hdr;
+	struct messaging_bcast_slot *slot = NULL;
+	uint32_t i;
+
+	/* A process that had our pid before might have been an outsider */
+	for (i=0; i<MESSAGING_BCAST_NUM_OUTSIDERS; i++) {
+		if (hdr->outsiders[i] == (uint32_t)b->pid) {
+			hdr->outsiders[i] = 0;
+		}
+	}
+
+	for (i=0; i<hdr->slots_used; i++) {
+		if (b->slots[i].pid == 0) {
+			slot = &b->slots[i];
+			break;
+		}
+	}
+	if ((slot == NULL) && (hdr->slots_used == hdr->num_slots)) {
+		/*
+		 * Only look for processes that died without cleaning
+		 * up when we have to, it's a syscall per slot
+		 */
+		for (i=0; i<hdr->slots_used; i++) {
+			if (!process_exists_by_pid(b->slots[i].pid)) {
+				slot = &b->slots[i];
+				messaging_bcast_release(b, slot);
+				break;
+			}
+		}
+		if (slot == NULL) {
+			return false;
+		}
+	}
+	if (slot == NULL) {
+		slot = &b->slots[hdr->slots_used];
+	}
+
+	slot->lists = 0;
+	slot->wake_pending = 0;
+	slot->cursor = hdr->head;
+	messaging_bcast_barrier();
+	slot->pid = b->pid;
+
+	if (slot == &b->slots[hdr->slots_used]) {
+		messaging_bcast_barrier();
+		hdr->slots_used += 1;
+	}
+
+	b->slot = slot;
+	return true;
+}
+
+NTSTATUS messaging_bcast_init(struct messaging_context *msg_ctx,
+			      TALLOC_CTX *mem_ctx,
+			      struct messaging_bcast **presult)
+{
+	struct messaging_bcast *b;
+	NTSTATUS status;
+	bool ok;
+
+	status = messaging_bcast_open(mem_ctx, &b);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+	b->msg_ctx = msg_ctx;
+
+	ok = messaging_bcast_attach(b);
+	messaging_bcast_unlock(b);
+
+	if (!ok) {
+		DEBUG(1, ("All %u broadcast slots are in use\n",
+			  (unsigned)MESSAGING_BCAST_NUM_SLOTS));
+		TALLOC_FREE(b);
+		return NT_STATUS_INSUFFICIENT_RESOURCES;
+	}
+
+	status = messaging_register(msg_ctx, NULL, MSG_BROADCAST_RING,
+				    messaging_bcast_doorbell);
+	if (!NT_STATUS_IS_OK(status)) {
+		TALLOC_FREE(b);
+		return status;
+	}
+
+	*presult = b;
+	return NT_STATUS_OK;
+}
+
+/*
+ * For processes that can't read the ring: Have broadcasts sent to us
+ * directly. The entry is removed by the first sender that finds us
+ * gone.
+ */
+NTSTATUS messaging_bcast_outsider(void)
+{
+	struct messaging_bcast *b;
+	struct messaging_bcast_header *hdr;
+	uint32_t pid = getpid();
+	int i, idx = -1;
+	NTSTATUS status;
+
+	if (!directory_create_or_exist(lock_path("msg"), sec_initial_uid(),
+				       0700)) {
+		return map_nt_error_from_unix(errno);
+	}
+
+	status = messaging_bcast_open(talloc_tos(), &b);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+	hdr = b->hdr;
+
+	for (i=0; i<MESSAGING_BCAST_NUM_OUTSIDERS; i++) {
+		if (hdr->outsiders[i] == pid) {
+			goto done;
+		}
+		if ((idx == -1) && (hdr->outsiders[i] == 0)) {
+			idx = i;
+		}
+	}
+	for (i=0; (idx == -1) && (i<MESSAGING_BCAST_NUM_OUTSIDERS); i++) {
+		if (!process_exists_by_pid(hdr->outsiders[i])) {
+			idx = i;
+		}
+	}
+	if (idx == -1) {
+		DEBUG(1, ("%u processes run without a broadcast slot, "
+			  "process %u will not receive broadcasts\n",
+			  (unsigned)MESSAGING_BCAST_NUM_OUTSIDERS,
+			  (unsigned)pid));
+		status = NT_STATUS_INSUFFICIENT_RESOURCES;
+		goto done;
+	}
+	hdr->outsiders[idx] = pid;
+done:
+	messaging_bcast_unlock(b);
+	TALLOC_FREE(b);
+	return status;
+}
+
+/*
+ * Let senders of msg_type wake us up. Deregistering a handler does
+ * not take us off the list again, the other types sharing it might
+ * still be wanted. That costs a spurious wakeup at most.
+ */
+void messaging_bcast_subscribe(struct messaging_bcast *b, uint32_t msg_type)
+{
+	unsigned n = messaging_bcast_list(msg_type);
+
+	if (b->slot->lists & (1U << n)) {
+		return;
+	}
+	if (!messaging_bcast_lock(b)) {
+		DEBUG(1, ("Could not subscribe to broadcasts of type %u\n",
+			  (unsigned)msg_type));
+		return;
+	}
+	messaging_bcast_list_add(b, b->slot, n);
+	messaging_bcast_unlock(b);
+}
+
+/*
+ * Free the slot of a process that died without doing it itself
+ */
+void messaging_bcast_forget(struct messaging_bcast *b, pid_t pid)
+{
+	struct messaging_bcast_header *hdr = b->hdr;
+	uint32_t i;
+
+	if (!messaging_bcast_lock(b)) {
+		return;
+	}
+	for (i=0; i<MESSAGING_BCAST_NUM_OUTSIDERS; i++) {
+		if (hdr->outsiders[i] == (uint32_t)pid) {
+			hdr->outsiders[i] = 0;
+		}
+	}
+	for (i=0; i<hdr->slots_used; i++) {
+		if (b->slots[i].pid == (uint32_t)pid) {
+			DEBUG(10, ("Freed broadcast slot %u of pid %u\n",
+				   (unsigned)i, (unsigned)pid));
+			messaging_bcast_release(b, &b->slots[i]);
+			break;
+		}
+	}
+	messaging_bcast_unlock(b);
+}
+
+/*
+ * Append one record to the ring, dropping the oldest ones if
+ * necessary
+ */
+static NTSTATUS messaging_bcast_append(struct messaging_bcast *b,
+				       uint32_t msg_type,
+				       const DATA_BLOB *blob)
+{
+	struct messaging_bcast_header *hdr = b->hdr;
+	uint32_t reclen, room;
+	uint64_t start, tail;
+	uint8_t *p;
+
+	reclen = MESSAGING_BCAST_REC_HDR + blob->length;
+	reclen = (reclen + 15) & ~15;
+
+	if (reclen > MESSAGING_BCAST_RING_SIZE / 4) {
+		return NT_STATUS_BUFFER_TOO_SMALL;
+	}
+
+	if (!messaging_bcast_lock(b)) {
+		return NT_STATUS_LOCK_NOT_GRANTED;
+	}
+
+	start = hdr->head;
+	room = MESSAGING_BCAST_RING_SIZE - (start % MESSAGING_BCAST_RING_SIZE);
+	if (room < reclen) {
+		/* Records don't wrap, skip the end of the ring */
+		start += room;
+	}
+
+	/*
+	 * Drop the oldest records and announce what we overwrite before
+	 * touching it. We don't look for subscribers that did not read
+	 * them yet, they skip what they missed.
+	 */
+	tail = hdr->tail;
+	while (start + reclen - tail > MESSAGING_BCAST_RING_SIZE) {
+		uint32_t len;
+
+		p = b->ring + (tail % MESSAGING_BCAST_RING_SIZE);
+		len = IVAL(p, 0);
+		if ((len == 0) || (tail + len > hdr->head)) {
+			/* Can only happen with a corrupt file */
+			tail = hdr->head;
+			break;
+		}
+		tail += len;
+	}
+	hdr->tail = tail;
+	messaging_bcast_barrier();
+	hdr->write_end = start + reclen;
+	messaging_bcast_barrier();
+
+	if (start != hdr->head) {
+		p = b->ring + (hdr->head % MESSAGING_BCAST_RING_SIZE);
+		SIVAL(p, 0, room);
+		SIVAL(p, 4, 0);
+		SIVAL(p, 8, 0);
+	}
+
+	p = b->ring + (start % MESSAGING_BCAST_RING_SIZE);
+	SIVAL(p, 0, reclen);
+	SIVAL(p, 4, msg_type);
+	SIVAL(p, 8, blob->length);
+	SIVAL(p, 12, 0);
+	memcpy(p + MESSAGING_BCAST_REC_HDR, blob->data, blob->length);
+
+	messaging_bcast_barrier();
+	hdr->head = start + reclen;
+
+	messaging_bcast_unlock(b);
+	return NT_STATUS_OK;
+}
+
+/*
+ * Walk the list of msg_type and ring the doorbell of every subscriber
+ * that did not get one since looking at the ring the last time. If
+ * the record did not make it into the ring, "direct" is the message
+ * to send instead. Returns the number of messages we sent,
+ * subscribers that still have a doorbell pending from an earlier
+ * broadcast are not counted.
+ */
+static int messaging_bcast_wake(struct messaging_bcast *b, uint32_t msg_type,
+				const DATA_BLOB *direct)
+{
+	unsigned n = messaging_bcast_list(msg_type);
+	uint32_t steps;
+	uint16_t idx;
+	int num_sent = 0;
+
+	idx = b->hdr->lists[n];
+
+	/*
+	 * A slot leaving and joining again while we look at it can
+	 * lead us back to the start of the list, don't loop forever
+	 */
+	for (steps=0; (idx != 0) && (idx <= MESSAGING_BCAST_NUM_SLOTS) &&
+		     (steps < MESSAGING_BCAST_NUM_SLOTS); steps++) {
+		struct messaging_bcast_slot *slot = &b->slots[idx-1];
+		uint32_t pid = slot->pid;
+		NTSTATUS status;
+
+		messaging_bcast_barrier();
+		idx = slot->next[n];
+
+		if ((pid == 0) || ((slot->lists & (1U << n)) == 0)) {
+			continue;
+		}
+
+		if (direct != NULL) {
+			status = messaging_send(b->msg_ctx, pid_to_procid(pid),
+						msg_type, direct);
+		} else {
+			if (__sync_lock_test_and_set(&slot->wake_pending,
+						     1) != 0) {
+				continue;
+			}
+			status = messaging_send(b->msg_ctx, pid_to_procid(pid),
+						MSG_BROADCAST_RING,
+						&data_blob_null);
+			if (!NT_STATUS_IS_OK(status)) {
+				/*
+				 * No doorbell is on its way, the next
+				 * broadcast has to try again
+				 */
+				slot->wake_pending = 0;
+			}
+		}
+		if (NT_STATUS_IS_OK(status)) {
+			num_sent += 1;
+			continue;
+		}
+
+		if (NT_STATUS_EQUAL(status, NT_STATUS_INVALID_HANDLE)) {
+			DEBUG(2, ("broadcast subscriber %u is gone\n",
+				  (unsigned)pid));
+			messaging_bcast_reap(b, slot, pid);
+			continue;
+		}
+		DEBUG(2, ("Could not wake broadcast subscriber %u: %s\n",
+			  (unsigned)pid, nt_errstr(status)));
+	}
+
+	return num_sent;
+}
+
+/*
+ * Processes without a slot get every broadcast directly
+ */
+static int messaging_bcast_send_outsiders(struct messaging_bcast *b,
+					  uint32_t msg_type,
+					  const DATA_BLOB *data)
+{
+	uint32_t *outsiders = b->hdr->outsiders;
+	int i, num_sent = 0;
+
+	for (i=0; i<MESSAGING_BCAST_NUM_OUTSIDERS; i++) {
+		uint32_t pid = outsiders[i];
+		NTSTATUS status;
+
+		if (pid == 0) {
+			continue;
+		}
+		status = messaging_send(b->msg_ctx, pid_to_procid(pid),
+					msg_type, data);
+		if (NT_STATUS_IS_OK(status)) {
+			num_sent += 1;
+			continue;
+		}
+		if (NT_STATUS_EQUAL(status, NT_STATUS_INVALID_HANDLE)) {
+			__sync_bool_compare_and_swap(&outsiders[i], pid, 0);
+		}
+	}
+	return num_sent;
+}
+
+/*
+ * Send a message to all processes with a handler for msg_type. The
+ * cost for the sender depends neither on the number of processes
+ * that are not interested nor on slow subscribers.
+ */
+NTSTATUS messaging_bcast_send(struct messaging_bcast *b, uint32_t msg_type,
+			      const DATA_BLOB *data, int *pnum_sent)
+{
+	struct messaging_rec rec;
+	enum ndr_err_code ndr_err;
+	DATA_BLOB blob;
+	NTSTATUS status;
+	int num_sent;
+
+	ZERO_STRUCT(rec);
+	rec.msg_version = MESSAGE_VERSION;
+	rec.msg_type = msg_type & MSG_TYPE_MASK;
+	rec.src = b->msg_ctx->id;
+	rec.buf = *data;
+
+	ndr_err = ndr_push_struct_blob(
+		&blob, talloc_tos(), &rec,
+		(ndr_push_flags_fn_t)ndr_push_messaging_rec);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		return ndr_map_error2ntstatus(ndr_err);
+	}
+
+	status = messaging_bcast_append(b, rec.msg_type, &blob);
+	data_blob_free(&blob);
+
+	if (NT_STATUS_IS_OK(status)) {
+		num_sent = messaging_bcast_wake(b, rec.msg_type, NULL);
+	} else {
+		/* Too large for the ring, still only the interested */
+		DEBUG(5, ("messaging_bcast_append failed: %s\n",
+			  nt_errstr(status)));
+		num_sent = messaging_bcast_wake(b, rec.msg_type, data);
+	}
+	num_sent += messaging_bcast_send_outsiders(b, rec.msg_type, data);
+
+	if (pnum_sent != NULL) {
+		*pnum_sent = num_sent;
+	}
+	return NT_STATUS_OK;
+}
+
+/*
+ * Copy the records between our cursor and the head of the ring
+ */
+static NTSTATUS messaging_bcast_read(struct messaging_bcast *b,
+				     TALLOC_CTX *mem_ctx,
+				     struct messaging_rec **precs,
+				     uint32_t *pnum_recs)
+{
+	struct messaging_bcast_header *hdr = b->hdr;
+	struct messaging_rec *recs = NULL;
+	uint32_t num_recs = 0;
+	uint64_t cursor = b->slot->cursor;
+
+	while (true) {
+		uint64_t head, write_end;
+		uint32_t reclen, msg_type, bloblen;
+		unsigned n;
+		DATA_BLOB blob = data_blob_null;
+		const uint8_t *p;
+
+		head = hdr->head;
+		messaging_bcast_barrier();
+
+		if (cursor == head) {
+			break;
+		}
+		if (cursor < hdr->tail) {
+			goto overrun;
+		}
+
+		p = b->ring + (cursor % MESSAGING_BCAST_RING_SIZE);
+		reclen = IVAL(p, 0);
+		msg_type = IVAL(p, 4);
+		bloblen = IVAL(p, 8);
+
+		if ((reclen < MESSAGING_BCAST_REC_HDR) || (reclen % 16 != 0) ||
+		    (reclen > MESSAGING_BCAST_RING_SIZE -
+		     (cursor % MESSAGING_BCAST_RING_SIZE)) ||
+		    (msg_type != 0 &&
+		     bloblen > reclen - MESSAGING_BCAST_REC_HDR)) {
+			goto overrun;
+		}
+
+		n = messaging_bcast_list(msg_type);
+		if ((msg_type != 0) && (b->slot->lists & (1U << n))) {
+			blob = data_blob_talloc(mem_ctx,
+						p + MESSAGING_BCAST_REC_HDR,
+						bloblen);
+			if (blob.data == NULL) {
+				return NT_STATUS_NO_MEMORY;
+			}
+		}
+
+		/*
+		 * Did a writer overwrite what we just looked at?
+		 */
+		messaging_bcast_barrier();
+		write_end = hdr->write_end;
+		if (write_end - cursor > MESSAGING_BCAST_RING_SIZE) {
+			data_blob_free(&blob);
+			goto overrun;
+		}
+
+		cursor += reclen;
+		b->slot->cursor = cursor;
+
+		if (blob.data != NULL) {
+			struct messaging_rec *tmp;
+			enum ndr_err_code ndr_err;
+
+			tmp = talloc_realloc(mem_ctx, recs,
+					     struct messaging_rec,
+					     num_recs + 1);
+			if (tmp == NULL) {
+				return NT_STATUS_NO_MEMORY;
+			}
+			recs = tmp;
+
+			ndr_err = ndr_pull_struct_blob_all(
+				&blob, recs, &recs[num_recs],
+				(ndr_pull_flags_fn_t)ndr_pull_messaging_rec);
+			if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err) ||
+			    (recs[num_recs].msg_version != MESSAGE_VERSION)) {
+				DEBUG(1, ("Ignoring invalid broadcast\n"));
+				continue;
+			}
+			num_recs += 1;
+		}
+		continue;
+
+	overrun:
+		/*
+		 * Nobody waits for us. Usually the records we missed
+		 * are ours or of types we are not interested in, but
+		 * if we were too slow we lose broadcasts here.
+		 */
+		DEBUG(5, ("Process %u skips overwritten broadcasts\n",
+			  (unsigned)b->pid));
+		cursor = hdr->tail;
+		messaging_bcast_barrier();
+	}
+
+	b->slot->cursor = cursor;
+
+	*precs = recs;
+	*pnum_recs = num_recs;
+	return NT_STATUS_OK;
+}
+
+static void messaging_bcast_doorbell(struct messaging_context *msg_ctx,
+				     void *private_data,
+				     uint32_t msg_type,
+				     struct server_id server_id,
+				     DATA_BLOB *data)
+{
+	struct messaging_bcast *b = msg_ctx->bcast;
+	struct messaging_rec *recs;
+	uint32_t i, num_recs;
+	NTSTATUS status;
+	TALLOC_CTX *frame;
+
+	if (b == NULL) {
+		return;
+	}
+
+	frame = talloc_stackframe();
+
+	/*
+	 * Clear before reading: A record appended after we looked
+	 * will ring again.
+	 */
+	b->slot->wake_pending = 0;
+	messaging_bcast_barrier();
+
+	status = messaging_bcast_read(b, frame, &recs, &num_recs);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(1, ("Could not read broadcasts: %s\n",
+			  nt_errstr(status)));
+		TALLOC_FREE(frame);
+		return;
+	}
+
+	/*
+	 * b might be gone after the first callback
+	 */
+	for (i=0; i<num_recs; i++) {
+		messaging_dispatch_rec(msg_ctx, &recs[i]);
+	}
+
+	TALLOC_FREE(frame);
+}
@@ -0,0 +1,958 @@
+/*
+   Unix SMB/CIFS implementation.
+   Samba internal messaging over unix datagram sockets
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * Every process binds a unix datagram socket named after its pid in
+ * lock_path("msg"). A message is a single datagram carrying the NDR
+ * encoded messaging_rec, so sending is one sendto() and there is no
+ * shared database to lock and no signal to deliver.
+ *
+ * Records larger than MESSAGING_DGM_MAX_INLINE are written to an
+ * unlinked temporary file whose descriptor is passed with
+ * SCM_RIGHTS, only the length goes into the datagram.
+ *
+ * We send on a socket connected to the receiver. The socket
+ * directory is only accessible for root, the kernel checks that when
+ * we connect, so only connecting needs root. The connected sockets
+ * are kept for the receivers we talked to last.
+ *
+ * If a receiver's socket queue is full, its messages are queued here
+ * in order and sent from a timer until the queue is empty, later
+ * messages to it go behind them. Mixing in messages.tdb for a busy
+ * receiver would reorder them, it reads the socket and messages.tdb
+ * independently. The queue is bounded, a receiver that does not read
+ * makes us drop messages like messages.tdb drops low priority ones.
+ *
+ * Processes that did not bind a socket (older binaries, "messaging
+ * sockets = no") are reached through the messages.tdb backend, which
+ * we keep open for that and to receive from such processes.
+ */
+
+#include "includes.h"
+#include "system/filesys.h"
+#include "system/network.h"
+#include "messages.h"
+
+#define MESSAGING_DGM_MAGIC 0x4d534744	/* "MSGD" */
+
+#define MESSAGING_DGM_KIND_INLINE 1
+#define MESSAGING_DGM_KIND_FD 2
+
+/* magic, kind, 64-bit length */
+#define MESSAGING_DGM_HDR_LEN 16
+
+#define MESSAGING_DGM_MAX_INLINE 32768
+
+/* Datagrams we read per fd event before returning to the main loop */
+#define MESSAGING_DGM_MAX_BATCH 100
+
+/* Connected sockets we keep to the receivers we talked to last */
+#define MESSAGING_DGM_MAX_PEERS 64
+
+/* Messages we queue for a busy receiver before we drop new ones */
+#define MESSAGING_DGM_MAX_QUEUED 1000
+
+/* Retry interval for a busy receiver, doubled while it stays busy */
+#define MESSAGING_DGM_RETRY_MIN_USEC 1000
+#define MESSAGING_DGM_RETRY_MAX_USEC 100000
+
+struct messaging_dgm_out {
+	struct messaging_dgm_out *prev, *next;
+	DATA_BLOB dgram;
+	int fd;
+};
+
+struct messaging_dgm_peer {
+	struct messaging_dgm_peer *prev, *next;
+	struct messaging_dgm_context *ctx;
+	pid_t pid;
+	int sock;
+	struct messaging_dgm_out *queue;
+	uint32_t num_queued;
+	struct tevent_timer *te;
+	uint32_t retry_usec;
+};
+
+struct messaging_dgm_context {
+	struct messaging_context *msg_ctx;
+	pid_t pid;
+	int sock;
+	char *dir;
+	char *path;
+	struct tevent_fd *fde;
+	struct messaging_backend *tdb;
+	uint8_t *buf;
+	struct messaging_dgm_peer *peers;
+	uint32_t num_peers;
+};
+
+static NTSTATUS messaging_dgm_send(struct messaging_context *msg_ctx,
+				   struct server_id pid, int msg_type,
+				   const DATA_BLOB *data,
+				   struct messaging_backend *backend);
+static void messaging_dgm_read_handler(struct tevent_context *ev,
+				       struct tevent_fd *fde,
+				       uint16_t flags, void *private_data);
+
+static int messaging_dgm_context_destructor(struct messaging_dgm_context *c)
+{
+	/*
+	 * The fde must go before the socket is closed, it might be
+	 * watched by an epoll fd
+	 */
+	TALLOC_FREE(c->fde);
+
+	if (c->sock != -1) {
+		close(c->sock);
+		c->sock = -1;
+	}
+
+	/*
+	 * messaging_reinit frees the context inherited over fork(),
+	 * the socket file still belongs to the parent then.
+	 */
+	if (c->pid == getpid()) {
+		unlink(c->path);
+	}
+	return 0;
+}
+
+static bool messaging_dgm_addr(const char *dir, pid_t pid,
+			       struct sockaddr_un *addr)
+{
+	int len;
+
+	ZERO_STRUCTP(addr);
+	addr->sun_family = AF_UNIX;
+
+	len = snprintf(addr->sun_path, sizeof(addr->sun_path), "%s/%u",
+		       dir, (unsigned)pid);
+	return ((len > 0) && (len < sizeof(addr->sun_path)));
+}
+
+/****************************************************************************
+ Initialise the messaging functions.
+****************************************************************************/
+
+NTSTATUS messaging_dgm_init(struct messaging_context *msg_ctx,
+			    TALLOC_CTX *mem_ctx,
+			    struct messaging_backend **presult)
+{
+	struct messaging_backend *result;
+	struct messaging_dgm_context *ctx;
+	struct sockaddr_un addr;
+	NTSTATUS status;
+	int ret;
+
+	if (!(result = talloc(mem_ctx, struct messaging_backend))) {
+		DEBUG(0, ("talloc failed\n"));
+		return NT_STATUS_NO_MEMORY;
+	}
+
+	ctx = talloc_zero(result, struct messaging_dgm_context);
+	if (ctx == NULL) {
+		DEBUG(0, ("talloc failed\n"));
+		TALLOC_FREE(result);
+		return NT_STATUS_NO_MEMORY;
+	}
+	result->private_data = ctx;
+	result->send_fn = messaging_dgm_send;
+
+	ctx->msg_ctx = msg_ctx;
+	ctx->pid = getpid();
+	ctx->sock = -1;
+
+	ctx->buf = talloc_array(ctx, uint8_t,
+				MESSAGING_DGM_HDR_LEN +
+				MESSAGING_DGM_MAX_INLINE);
+	ctx->dir = talloc_strdup(ctx, lock_path("msg"));
+	if ((ctx->buf == NULL) || (ctx->dir == NULL)) {
+		TALLOC_FREE(result);
+		return NT_STATUS_NO_MEMORY;
+	}
+
+	if (!messaging_dgm_addr(ctx->dir, ctx->pid, &addr)) {
+		DEBUG(1, ("messaging socket directory %s too long\n",
+			  ctx->dir));
+		TALLOC_FREE(result);
+		return NT_STATUS_NAME_TOO_LONG;
+	}
+	ctx->path = talloc_strdup(ctx, addr.sun_path);
+	if (ctx->path == NULL) {
+		TALLOC_FREE(result);
+		return NT_STATUS_NO_MEMORY;
+	}
+
+	if (!directory_create_or_exist(ctx->dir, sec_initial_uid(), 0700)) {
+		TALLOC_FREE(result);
+		return NT_STATUS_ACCESS_DENIED;
+	}
+
+	/*
+	 * We got our pid from the kernel, so whatever still sits
+	 * under our name was left behind by a dead process.
+	 */
+	unlink(ctx->path);
+
+	ctx->sock = socket(AF_UNIX, SOCK_DGRAM, 0);
+	if (ctx->sock == -1) {
+		status = map_nt_error_from_unix(errno);
+		DEBUG(1, ("socket failed: %s\n", strerror(errno)));
+		TALLOC_FREE(result);
+		return status;
+	}
+
+	talloc_set_destructor(ctx, messaging_dgm_context_destructor);
+
+	ret = bind(ctx->sock, (struct sockaddr *)(void *)&addr, sizeof(addr));
+	if (ret == -1) {
+		status = map_nt_error_from_unix(errno);
+		DEBUG(1, ("bind to %s failed: %s\n", ctx->path,
+			  strerror(errno)));
+		TALLOC_FREE(result);
+		return status;
+	}
+
+	set_blocking(ctx->sock, false);
+	smb_set_close_on_exec(ctx->sock);
+
+	ctx->fde = tevent_add_fd(msg_ctx->event_ctx, ctx, ctx->sock,
+				 TEVENT_FD_READ, messaging_dgm_read_handler,
+				 ctx);
+	if (ctx->fde == NULL) {
+		TALLOC_FREE(result);
+		return NT_STATUS_NO_MEMORY;
+	}
+
+	status = messaging_tdb_init(msg_ctx, ctx, &ctx->tdb);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(2, ("messaging_tdb_init failed: %s\n",
+			  nt_errstr(status)));
+		TALLOC_FREE(result);
+		return status;
+	}
+
+	*presult = result;
+	return NT_STATUS_OK;
+}
+
+/*
+ * Put a record too large for a datagram into an unlinked file
+ */
+static int messaging_dgm_payload_fd(struct messaging_dgm_context *ctx,
+				    const DATA_BLOB *blob)
+{
+	char *fname;
+	ssize_t written;
+	int fd, saved_errno;
+
+	/*
+	 * Only the descriptor is passed on, the file is unlinked right
+	 * away. So it can live in the temp directory, created with
+	 * whatever euid we run as.
+	 */
+	fname = talloc_asprintf(talloc_tos(), "%s/smbmsg.XXXXXX", tmpdir());
+	if (fname == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	fd = mkstemp(fname);
+	saved_errno = errno;
+	if (fd != -1) {
+		unlink(fname);
+	}
+
+	TALLOC_FREE(fname);
+	if (fd == -1) {
+		errno = saved_errno;
+		return -1;
+	}
+
+	written = write_data(fd, (const char *)blob->data, blob->length);
+	if (written != blob->length) {
+		saved_errno = errno;
+		close(fd);
+		errno = saved_errno;
+		return -1;
+	}
+	return fd;
+}
+
+/*
+ * Returns 0 or an errno value
+ */
+static int messaging_dgm_sendmsg(int sock, const DATA_BLOB *dgram, int fd)
+{
+	struct msghdr msg;
+	struct iovec iov;
+	ssize_t ret;
+#ifdef HAVE_MSGHDR_MSG_CONTROL
+	union {
+		struct cmsghdr cm;
+		char control[CMSG_SPACE(sizeof(int))];
+	} control_un;
+	struct cmsghdr *cmptr;
+#endif
+
+	ZERO_STRUCT(msg);
+
+	iov.iov_base = dgram->data;
+	iov.iov_len = dgram->length;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+
+	if (fd != -1) {
+#ifdef HAVE_MSGHDR_MSG_CONTROL
+		ZERO_STRUCT(control_un);
+		msg.msg_control = control_un.control;
+		msg.msg_controllen = sizeof(control_un.control);
+
+		cmptr = CMSG_FIRSTHDR(&msg);
+		cmptr->cmsg_len = CMSG_LEN(sizeof(int));
+		cmptr->cmsg_level = SOL_SOCKET;
+		cmptr->cmsg_type = SCM_RIGHTS;
+		memcpy(CMSG_DATA(cmptr), &fd, sizeof(int));
+#else
+		return ENOTSUP;
+#endif
+	}
+
+	ret = sendmsg(sock, &msg, 0);
+	if (ret == -1) {
+		return errno;
+	}
+	return 0;
+}
+
+static bool messaging_dgm_busy(int err)
+{
+	switch (err) {
+	case EAGAIN:
+#if defined(EWOULDBLOCK) && (EWOULDBLOCK != EAGAIN)
+	case EWOULDBLOCK:
+#endif
+	case ENOBUFS:
+		return true;
+	}
+	return false;
+}
+
+static int messaging_dgm_out_destructor(struct messaging_dgm_out *out)
+{
+	if (out->fd != -1) {
+		close(out->fd);
+		out->fd = -1;
+	}
+	return 0;
+}
+
+static int messaging_dgm_peer_destructor(struct messaging_dgm_peer *peer)
+{
+	struct messaging_dgm_context *ctx = peer->ctx;
+
+	TALLOC_FREE(peer->te);
+	while (peer->queue != NULL) {
+		struct messaging_dgm_out *out = peer->queue;
+		DLIST_REMOVE(peer->queue, out);
+		TALLOC_FREE(out);
+	}
+	if (peer->sock != -1) {
+		close(peer->sock);
+		peer->sock = -1;
+	}
+	DLIST_REMOVE(ctx->peers, peer);
+	ctx->num_peers -= 1;
+	return 0;
+}
+
+/*
+ * Find the connected socket to pid, or connect one. Returns NULL with
+ * *perr set if pid has no socket we can connect to.
+ */
+static struct messaging_dgm_peer *messaging_dgm_peer(
+	struct messaging_dgm_context *ctx, pid_t pid, int *perr)
+{
+	struct messaging_dgm_peer *peer;
+	struct sockaddr_un addr;
+	uid_t euid = geteuid();
+	int sock, ret, saved_errno;
+
+	for (peer = ctx->peers; peer != NULL; peer = peer->next) {
+		if (peer->pid == pid) {
+			DLIST_PROMOTE(ctx->peers, peer);
+			return peer;
+		}
+	}
+
+	if (!messaging_dgm_addr(ctx->dir, pid, &addr)) {
+		*perr = ENAMETOOLONG;
+		return NULL;
+	}
+
+	sock = socket(AF_UNIX, SOCK_DGRAM, 0);
+	if (sock == -1) {
+		*perr = errno;
+		return NULL;
+	}
+
+	if (euid != 0) {
+		/* The socket directory is only accessible for root */
+		save_re_uid();
+		set_effective_uid(0);
+	}
+
+	ret = connect(sock, (struct sockaddr *)(void *)&addr, sizeof(addr));
+	saved_errno = errno;
+
+	if (euid != 0) {
+		restore_re_uid_fromroot();
+	}
+
+	if (ret == -1) {
+		close(sock);
+		*perr = saved_errno;
+		return NULL;
+	}
+
+	set_blocking(sock, false);
+	smb_set_close_on_exec(sock);
+
+	peer = talloc_zero(ctx, struct messaging_dgm_peer);
+	if (peer == NULL) {
+		close(sock);
+		*perr = ENOMEM;
+		return NULL;
+	}
+	peer->ctx = ctx;
+	peer->pid = pid;
+	peer->sock = sock;
+
+	DLIST_ADD(ctx->peers, peer);
+	ctx->num_peers += 1;
+	talloc_set_destructor(peer, messaging_dgm_peer_destructor);
+
+	/*
+	 * Close the least recently used idle sockets, keep the ones
+	 * with queued messages
+	 */
+	if (ctx->num_peers > MESSAGING_DGM_MAX_PEERS) {
+		struct messaging_dgm_peer *p, *prev;
+
+		for (p = DLIST_TAIL(ctx->peers); p != peer; p = prev) {
+			prev = p->prev;
+			if (p->queue == NULL) {
+				TALLOC_FREE(p);
+			}
+			if (ctx->num_peers <= MESSAGING_DGM_MAX_PEERS) {
+				break;
+			}
+		}
+	}
+
+	return peer;
+}
+
+static void messaging_dgm_retry(struct tevent_context *ev,
+				struct tevent_timer *te,
+				struct timeval now,
+				void *private_data);
+
+static bool messaging_dgm_schedule(struct messaging_dgm_peer *peer)
+{
+	peer->te = tevent_add_timer(
+		peer->ctx->msg_ctx->event_ctx, peer,
+		timeval_current_ofs(0, peer->retry_usec),
+		messaging_dgm_retry, peer);
+	return (peer->te != NULL);
+}
+
+/*
+ * Send what is queued for a busy receiver, in order
+ */
+static void messaging_dgm_retry(struct tevent_context *ev,
+				struct tevent_timer *te,
+				struct timeval now,
+				void *private_data)
+{
+	struct messaging_dgm_peer *peer = talloc_get_type_abort(
+		private_data, struct messaging_dgm_peer);
+	struct messaging_dgm_out *out;
+	bool progress = false;
+	int err;
+
+	peer->te = NULL;
+
+	while ((out = peer->queue) != NULL) {
+		err = messaging_dgm_sendmsg(peer->sock, &out->dgram, out->fd);
+		if (messaging_dgm_busy(err)) {
+			if (progress) {
+				peer->retry_usec = MESSAGING_DGM_RETRY_MIN_USEC;
+			} else {
+				peer->retry_usec = MIN(
+					peer->retry_usec * 2,
+					MESSAGING_DGM_RETRY_MAX_USEC);
+			}
+			if (!messaging_dgm_schedule(peer)) {
+				break;
+			}
+			return;
+		}
+		if (err != 0) {
+			break;
+		}
+		DLIST_REMOVE(peer->queue, out);
+		peer->num_queued -= 1;
+		TALLOC_FREE(out);
+		progress = true;
+	}
+
+	if (peer->queue != NULL) {
+		DEBUG(2, ("Dropping %u messages for process %u\n",
+			  (unsigned)peer->num_queued, (unsigned)peer->pid));
+		TALLOC_FREE(peer);
+	}
+}
+
+/*
+ * Queue a message behind the ones the receiver did not take yet. The
+ * queue takes over fd.
+ */
+static NTSTATUS messaging_dgm_enqueue(struct messaging_dgm_peer *peer,
+				      const DATA_BLOB *dgram, int fd)
+{
+	struct messaging_dgm_out *out;
+
+	if (peer->num_queued >= MESSAGING_DGM_MAX_QUEUED) {
+		DEBUG(5, ("Dropping message for process %u\n",
+			  (unsigned)peer->pid));
+		return NT_STATUS_INSUFFICIENT_RESOURCES;
+	}
+
+	out = talloc(peer, struct messaging_dgm_out);
+	if (out == NULL) {
+		return NT_STATUS_NO_MEMORY;
+	}
+	out->dgram = data_blob_talloc(out, dgram->data, dgram->length);
+	if (out->dgram.data == NULL) {
+		TALLOC_FREE(out);
+		return NT_STATUS_NO_MEMORY;
+	}
+	out->fd = fd;
+	talloc_set_destructor(out, messaging_dgm_out_destructor);
+
+	if (peer->te == NULL) {
+		peer->retry_usec = MESSAGING_DGM_RETRY_MIN_USEC;
+		if (!messaging_dgm_schedule(peer)) {
+			out->fd = -1;
+			TALLOC_FREE(out);
+			return NT_STATUS_NO_MEMORY;
+		}
+	}
+
+	DLIST_ADD_END(peer->queue, out, struct messaging_dgm_out *);
+	peer->num_queued += 1;
+	return NT_STATUS_OK;
+}
+
+/*
+ * No socket under that pid: The process does not listen on a socket
+ * or it is gone. messages.tdb finds out which.
+ */
+static NTSTATUS messaging_dgm_no_peer(struct messaging_dgm_context *ctx,
+				      struct messaging_context *msg_ctx,
+				      struct server_id pid, int msg_type,
+				      const DATA_BLOB *data, int err)
+{
+	pid_t dst = procid_to_pid(&pid);
+	NTSTATUS status;
+
+	if ((err != ENOENT) && (err != ECONNREFUSED)) {
+		DEBUG(2, ("message to process %u failed - %s\n",
+			  (unsigned)dst, strerror(err)));
+		return map_nt_error_from_unix(err);
+	}
+
+	status = ctx->tdb->send_fn(msg_ctx, pid, msg_type, data, ctx->tdb);
+	if (NT_STATUS_EQUAL(status, NT_STATUS_INVALID_HANDLE)
+	    && (err == ECONNREFUSED)) {
+		struct sockaddr_un addr;
+		if (messaging_dgm_addr(ctx->dir, dst, &addr)) {
+			DEBUG(2, ("Removing stale socket %s\n",
+				  addr.sun_path));
+			unlink(addr.sun_path);
+		}
+	}
+	return status;
+}
+
+/****************************************************************************
+ Send a message to a particular pid.
+****************************************************************************/
+
+static NTSTATUS messaging_dgm_send(struct messaging_context *msg_ctx,
+				   struct server_id pid, int msg_type,
+				   const DATA_BLOB *data,
+				   struct messaging_backend *backend)
+{
+	struct messaging_dgm_context *ctx = talloc_get_type_abort(
+		backend->private_data, struct messaging_dgm_context);
+	struct messaging_rec rec;
+	DATA_BLOB blob, dgram;
+	enum ndr_err_code ndr_err;
+	struct messaging_dgm_peer *peer;
+	pid_t dst = procid_to_pid(&pid);
+	NTSTATUS status;
+	int fd = -1;
+	int err;
+	TALLOC_CTX *frame;
+
+	/* NULL pointer means implicit length zero. */
+	if (!data->data) {
+		SMB_ASSERT(data->length == 0);
+	}
+
+	SMB_ASSERT(dst > 0);
+
+	frame = talloc_stackframe();
+
+	rec.msg_version = MESSAGE_VERSION;
+	rec.msg_type = msg_type & MSG_TYPE_MASK;
+	rec.dest = pid;
+	rec.src = msg_ctx->id;
+	rec.buf = *data;
+
+	ndr_err = ndr_push_struct_blob(
+		&blob, frame, &rec,
+		(ndr_push_flags_fn_t)ndr_push_messaging_rec);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		TALLOC_FREE(frame);
+		return ndr_map_error2ntstatus(ndr_err);
+	}
+
+	dgram = data_blob_talloc(
+		frame, NULL,
+		MESSAGING_DGM_HDR_LEN +
+		((blob.length > MESSAGING_DGM_MAX_INLINE) ? 0 : blob.length));
+	if (dgram.data == NULL) {
+		TALLOC_FREE(frame);
+		return NT_STATUS_NO_MEMORY;
+	}
+
+	SIVAL(dgram.data, 0, MESSAGING_DGM_MAGIC);
+	SBVAL(dgram.data, 8, blob.length);
+
+	if (blob.length > MESSAGING_DGM_MAX_INLINE) {
+#ifndef HAVE_MSGHDR_MSG_CONTROL
+		TALLOC_FREE(frame);
+		return ctx->tdb->send_fn(msg_ctx, pid, msg_type, data,
+					 ctx->tdb);
+#endif
+		SIVAL(dgram.data, 4, MESSAGING_DGM_KIND_FD);
+		fd = messaging_dgm_payload_fd(ctx, &blob);
+		if (fd == -1) {
+			status = map_nt_error_from_unix(errno);
+			DEBUG(1, ("Could not store message for pid %u: %s\n",
+				  (unsigned)dst, strerror(errno)));
+			TALLOC_FREE(frame);
+			return status;
+		}
+	} else {
+		SIVAL(dgram.data, 4, MESSAGING_DGM_KIND_INLINE);
+		memcpy(dgram.data + MESSAGING_DGM_HDR_LEN, blob.data,
+		       blob.length);
+	}
+
+	peer = messaging_dgm_peer(ctx, dst, &err);
+	if (peer == NULL) {
+		status = messaging_dgm_no_peer(ctx, msg_ctx, pid, msg_type,
+					       data, err);
+		goto done;
+	}
+
+	if (peer->queue != NULL) {
+		/* Stay behind what the receiver did not take yet */
+		status = messaging_dgm_enqueue(peer, &dgram, fd);
+		if (NT_STATUS_IS_OK(status)) {
+			fd = -1;
+		}
+		goto done;
+	}
+
+	err = messaging_dgm_sendmsg(peer->sock, &dgram, fd);
+
+	if (err == ECONNREFUSED) {
+		/*
+		 * The receiver went away since we connected. Its pid
+		 * might have a new socket by now.
+		 */
+		TALLOC_FREE(peer);
+		peer = messaging_dgm_peer(ctx, dst, &err);
+		if (peer == NULL) {
+			status = messaging_dgm_no_peer(ctx, msg_ctx, pid,
+						       msg_type, data, err);
+			goto done;
+		}
+		err = messaging_dgm_sendmsg(peer->sock, &dgram, fd);
+	}
+
+	if (err == 0) {
+		status = NT_STATUS_OK;
+	} else if (messaging_dgm_busy(err)) {
+		/*
+		 * The receiver's queue is full, it is busy. Don't
+		 * block, queue the message and the ones that follow.
+		 */
+		status = messaging_dgm_enqueue(peer, &dgram, fd);
+		if (NT_STATUS_IS_OK(status)) {
+			fd = -1;
+		}
+	} else {
+		DEBUG(2, ("message to process %u failed - %s\n",
+			  (unsigned)dst, strerror(err)));
+		TALLOC_FREE(peer);
+		status = map_nt_error_from_unix(err);
+	}
+
+done:
+	if (fd != -1) {
+		close(fd);
+	}
+	TALLOC_FREE(frame);
+	return status;
+}
+
+/*
+ * Returns the length of the datagram in ctx->buf, 0 for "try again
+ * later", -1 for "nothing left"
+ */
+static ssize_t messaging_dgm_recv(struct messaging_dgm_context *ctx,
+				  int *pfd)
+{
+	struct msghdr msg;
+	struct iovec iov;
+	ssize_t received;
+#ifdef HAVE_MSGHDR_MSG_CONTROL
+	union {
+		struct cmsghdr cm;
+		char control[CMSG_SPACE(sizeof(int))];
+	} control_un;
+	struct cmsghdr *cmptr;
+#endif
+
+	*pfd = -1;
+
+	ZERO_STRUCT(msg);
+	iov.iov_base = ctx->buf;
+	iov.iov_len = MESSAGING_DGM_HDR_LEN + MESSAGING_DGM_MAX_INLINE;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+#ifdef HAVE_MSGHDR_MSG_CONTROL
+	ZERO_STRUCT(control_un);
+	msg.msg_control = control_un.control;
+	msg.msg_controllen = sizeof(control_un.control);
+#endif
+
+	received = recvmsg(ctx->sock, &msg, 0);
+	if (received == -1) {
+		if (errno == EINTR) {
+			return 0;
+		}
+		return -1;
+	}
+
+#ifdef HAVE_MSGHDR_MSG_CONTROL
+	for (cmptr = CMSG_FIRSTHDR(&msg); cmptr != NULL;
+	     cmptr = CMSG_NXTHDR(&msg, cmptr)) {
+		if ((cmptr->cmsg_level == SOL_SOCKET)
+		    && (cmptr->cmsg_type == SCM_RIGHTS)
+		    && (cmptr->cmsg_len == CMSG_LEN(sizeof(int)))) {
+			int fd;
+			memcpy(&fd, CMSG_DATA(cmptr), sizeof(int));
+			if (*pfd != -1) {
+				close(fd);
+				continue;
+			}
+			*pfd = fd;
+		}
+	}
+#endif
+
+	if (msg.msg_flags & (MSG_TRUNC|MSG_CTRUNC)) {
+		DEBUG(1, ("Dropping truncated message\n"));
+		if (*pfd != -1) {
+			close(*pfd);
+			*pfd = -1;
+		}
+		return 0;
+	}
+
+	return received;
+}
+
+static bool messaging_dgm_parse(struct messaging_dgm_context *ctx,
+				TALLOC_CTX *mem_ctx,
+				size_t received, int fd,
+				struct messaging_rec *rec)
+{
+	enum ndr_err_code ndr_err;
+	DATA_BLOB blob;
+	uint64_t len;
+
+	if (received < MESSAGING_DGM_HDR_LEN) {
+		DEBUG(1, ("Dropping short message (%u bytes)\n",
+			  (unsigned)received));
+		return false;
+	}
+	if (IVAL(ctx->buf, 0) != MESSAGING_DGM_MAGIC) {
+		DEBUG(1, ("Dropping message with invalid magic\n"));
+		return false;
+	}
+
+	len = BVAL(ctx->buf, 8);
+
+	switch (IVAL(ctx->buf, 4)) {
+	case MESSAGING_DGM_KIND_INLINE:
+		if (len != received - MESSAGING_DGM_HDR_LEN) {
+			DEBUG(1, ("Dropping message with invalid length\n"));
+			return false;
+		}
+		blob = data_blob_const(ctx->buf + MESSAGING_DGM_HDR_LEN, len);
+		break;
+	case MESSAGING_DGM_KIND_FD: {
+		ssize_t nread;
+
+		if (fd == -1) {
+			DEBUG(1, ("Dropping message without payload fd\n"));
+			return false;
+		}
+		if (len > UINT32_MAX) {
+			DEBUG(1, ("Dropping oversized message (%llu bytes)\n",
+				  (unsigned long long)len));
+			return false;
+		}
+		blob = data_blob_talloc(mem_ctx, NULL, len);
+		if (blob.data == NULL) {
+			return false;
+		}
+		nread = pread(fd, blob.data, len, 0);
+		if (nread != len) {
+			DEBUG(1, ("Could not read message payload: %s\n",
+				  (nread == -1) ? strerror(errno) : "short"));
+			return false;
+		}
+		break;
+	}
+	default:
+		DEBUG(1, ("Dropping message of unknown kind %u\n",
+			  (unsigned)IVAL(ctx->buf, 4)));
+		return false;
+	}
+
+	ndr_err = ndr_pull_struct_blob_all(
+		&blob, mem_ctx, rec,
+		(ndr_pull_flags_fn_t)ndr_pull_messaging_rec);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		DEBUG(1, ("Could not parse message: %s\n",
+			  ndr_errstr(ndr_err)));
+		return false;
+	}
+
+	if (rec->msg_version != MESSAGE_VERSION) {
+		DEBUG(1, ("Dropping message of version %u\n",
+			  (unsigned)rec->msg_version));
+		return false;
+	}
+
+	/*
+	 * An inline blob points into ctx->buf which the next recvmsg
+	 * overwrites
+	 */
+	if (rec->buf.length != 0) {
+		rec->buf = data_blob_talloc(mem_ctx, rec->buf.data,
+					    rec->buf.length);
+		if (rec->buf.data == NULL) {
+			return false;
+		}
+	}
+
+	if (DEBUGLEVEL >= 10) {
+		DEBUG(10, ("messaging_dgm_parse:\n"));
+		NDR_PRINT_DEBUG(messaging_rec, rec);
+	}
+
+	return true;
+}
+
+/****************************************************************************
+ Receive and dispatch the messages waiting on our socket.
+ *NOTE*: Dispatch functions must be able to cope with incoming
+ messages on an *odd* byte boundary.
+****************************************************************************/
+
+static void messaging_dgm_read_handler(struct tevent_context *ev,
+				       struct tevent_fd *fde,
+				       uint16_t flags, void *private_data)
+{
+	struct messaging_dgm_context *ctx = talloc_get_type_abort(
+		private_data, struct messaging_dgm_context);
+	struct messaging_context *msg_ctx = ctx->msg_ctx;
+	struct messaging_rec *recs;
+	uint32_t i, num_recs = 0;
+	TALLOC_CTX *frame = talloc_stackframe();
+
+	recs = talloc_array(frame, struct messaging_rec,
+			    MESSAGING_DGM_MAX_BATCH);
+	if (recs == NULL) {
+		TALLOC_FREE(frame);
+		return;
+	}
+
+	/*
+	 * Collect first, then dispatch: A callback might end up in
+	 * messaging_reinit() which frees ctx.
+	 */
+	for (i=0; i<MESSAGING_DGM_MAX_BATCH; i++) {
+		ssize_t received;
+		bool ok;
+		int fd;
+
+		received = messaging_dgm_recv(ctx, &fd);
+		if (received == -1) {
+			break;
+		}
+		if (received == 0) {
+			continue;
+		}
+
+		ok = messaging_dgm_parse(ctx, recs, received, fd,
+					 &recs[num_recs]);
+		if (fd != -1) {
+			close(fd);
+		}
+		if (ok) {
+			num_recs += 1;
+		}
+	}
+
+	for (i=0; i<num_recs; i++) {
+		messaging_dispatch_rec(msg_ctx, &recs[i]);
+	}
+
+	TALLOC_FREE(frame);
+}
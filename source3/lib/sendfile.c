@@ -24,6 +24,9 @@
  */
 
 #include "includes.h"
+#include "system/filesys.h"
+#include "system/select.h"
+#include "../lib/util/select.h"
 
 #if defined(LINUX_SENDFILE_API)
 
@@ -491,3 +494,135 @@ ssize_t sys_sendfile(int tofd, int fromfd, const DATA_BLOB *header, SMB_OFF_T of
 	return -1;
 }
 #endif
+
+#if defined(HAVE_LINUX_SPLICE)
+
+/*
+ * Move count bytes from fromfd at offset to the socket tofd through a
+ * pipe, so the file pages never get copied into userspace. This works
+ * in some places where sendfile does not and is tried before falling
+ * back to fake_sendfile. Same return convention as sys_sendfile,
+ * except that "not supported" is reported as ENOSYS. That is only
+ * done if nothing was sent yet, once data went out an error returns
+ * a short count, so the caller never sends the start of the range
+ * twice. A client that does not take any data for
+ * SPLICE_WRITE_TIMEOUT milliseconds fails the call with ETIMEDOUT.
+ */
+
+#define SPLICE_WRITE_TIMEOUT 60000
+
+static int splice_wait_writable(int fd)
+{
+	struct pollfd pfd;
+	int ret;
+
+	pfd.fd = fd;
+	pfd.events = POLLOUT;
+	pfd.revents = 0;
+
+	ret = sys_poll_intr(&pfd, 1, SPLICE_WRITE_TIMEOUT);
+	if (ret == -1) {
+		return -1;
+	}
+	if (ret == 0) {
+		errno = ETIMEDOUT;
+		return -1;
+	}
+	return 0;
+}
+
+ssize_t sys_splicefile(int tofd, int fromfd, SMB_OFF_T offset, size_t count)
+{
+	static int pipefd[2] = { -1, -1 };
+	loff_t splice_offset = offset;
+	size_t total = 0;
+
+	if ((pipefd[0] == -1) && (pipe(pipefd) == -1)) {
+		return -1;
+	}
+
+	while (total < count) {
+		ssize_t nread;
+		ssize_t to_write;
+
+		do {
+			nread = splice(fromfd, &splice_offset, pipefd[1], NULL,
+				       count - total,
+				       SPLICE_F_MOVE|SPLICE_F_MORE);
+		} while (nread == -1 && errno == EINTR);
+		if (nread == -1) {
+			if (total > 0) {
+				break;
+			}
+			if (errno == EINVAL) {
+				errno = ENOSYS;
+			}
+			return -1;
+		}
+		if (nread == 0) {
+			/* EOF, return a short read */
+			break;
+		}
+
+		to_write = nread;
+		while (to_write > 0) {
+			ssize_t nwritten;
+
+			nwritten = splice(pipefd[0], NULL, tofd, NULL,
+					  to_write,
+					  SPLICE_F_MOVE|SPLICE_F_MORE);
+			if (nwritten == -1 && errno == EINTR) {
+				continue;
+			}
+#if defined(EWOULDBLOCK)
+			if (nwritten == -1 && (errno == EAGAIN ||
+					errno == EWOULDBLOCK)) {
+#else
+			if (nwritten == -1 && errno == EAGAIN) {
+#endif
+				if (splice_wait_writable(tofd) == 0) {
+					continue;
+				}
+				if (errno == ETIMEDOUT) {
+					/*
+					 * The client is stuck, don't
+					 * send it a padded reply
+					 */
+					close(pipefd[0]);
+					close(pipefd[1]);
+					pipefd[0] = pipefd[1] = -1;
+					errno = ETIMEDOUT;
+					return -1;
+				}
+			}
+			if (nwritten <= 0) {
+				/*
+				 * The pipe still holds data for this
+				 * request, don't reuse it.
+				 */
+				int saved_errno = errno;
+				close(pipefd[0]);
+				close(pipefd[1]);
+				pipefd[0] = pipefd[1] = -1;
+				total += nread - to_write;
+				if (total > 0) {
+					return total;
+				}
+				errno = saved_errno;
+				return -1;
+			}
+			to_write -= nwritten;
+		}
+		total += nread;
+	}
+	return total;
+}
+
+#else
+
+ssize_t sys_splicefile(int tofd, int fromfd, SMB_OFF_T offset, size_t count)
+{
+	errno = ENOSYS;
+	return -1;
+}
+#endif
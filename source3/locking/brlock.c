@@ -220,6 +220,199 @@ static bool brl_conflict_other(const struct lock_struct *lck1, const struct lock
 	return brl_overlap(lck1, lck2);
 } 
 
+/****************************************************************************
+ Sort locks by start offset. The array is almost always sorted already
+ apart from a few locks appended at the end, so a binary insertion sort
+ is linear in practice. It is stable, locks with the same start keep
+ their order, which matters for unlocking stacked locks.
+****************************************************************************/
+
+static void brl_sort_locks(struct lock_struct *locks, unsigned int num_locks)
+{
+	unsigned int i;
+
+	for (i = 1; i < num_locks; i++) {
+		struct lock_struct tmp;
+		unsigned int lo = 0, hi = i;
+
+		if (locks[i].start >= locks[i-1].start) {
+			continue;
+		}
+
+		tmp = locks[i];
+
+		/* Find the first lock starting after tmp. */
+		while (lo < hi) {
+			unsigned int mid = lo + (hi - lo) / 2;
+			if (locks[mid].start <= tmp.start) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+
+		memmove(&locks[lo+1], &locks[lo], sizeof(*locks) * (i - lo));
+		locks[lo] = tmp;
+	}
+}
+
+/****************************************************************************
+ The end of a lock, locks going beyond the end of 64 bit file space
+ count as ending there.
+****************************************************************************/
+
+static br_off brl_lock_end(const struct lock_struct *lock)
+{
+	br_off end = lock->start + lock->size;
+
+	if (end < lock->start) {
+		return UINT64_MAX;
+	}
+	return end;
+}
+
+/****************************************************************************
+ The sorted lock array is read as a balanced binary search tree: the
+ root of the locks [lo, hi) is the middle one, its subtrees are the
+ halves left and right of it. The tree is augmented with
+ tree_ends[mid], the highest end of all locks in the subtree rooted
+ at mid, so a search can skip subtrees nothing in which reaches the
+ range it looks for.
+****************************************************************************/
+
+static br_off brl_tree_build(const struct lock_struct *locks,
+			     br_off *tree_ends,
+			     unsigned int lo, unsigned int hi)
+{
+	unsigned int mid;
+	br_off end;
+
+	if (lo >= hi) {
+		return 0;
+	}
+	mid = lo + (hi - lo) / 2;
+
+	end = brl_lock_end(&locks[mid]);
+	end = MAX(end, brl_tree_build(locks, tree_ends, lo, mid));
+	end = MAX(end, brl_tree_build(locks, tree_ends, mid + 1, hi));
+
+	tree_ends[mid] = end;
+	return end;
+}
+
+static bool brl_build_tree(struct byte_range_lock *br_lck)
+{
+	if (br_lck->tree_ends != NULL) {
+		return true;
+	}
+
+	br_lck->tree_ends = talloc_array(br_lck, br_off, br_lck->num_locks);
+	if (br_lck->tree_ends == NULL) {
+		return false;
+	}
+
+	brl_sort_locks(br_lck->lock_data, br_lck->num_locks);
+	brl_tree_build(br_lck->lock_data, br_lck->tree_ends,
+		       0, br_lck->num_locks);
+	return true;
+}
+
+/****************************************************************************
+ The lock array changed, the tree has to be built again.
+****************************************************************************/
+
+static void brl_locks_changed(struct byte_range_lock *br_lck)
+{
+	br_lck->modified = true;
+	TALLOC_FREE(br_lck->tree_ends);
+}
+
+/****************************************************************************
+ Search the locks [lo, hi) in order for one that conflicts with plock,
+ ending at end. A lock can only overlap plock if it starts before end
+ and ends after the start of plock.
+****************************************************************************/
+
+static const struct lock_struct *brl_tree_find(
+	const struct byte_range_lock *br_lck,
+	unsigned int lo, unsigned int hi,
+	const struct lock_struct *plock, br_off end,
+	bool (*conflict)(const struct lock_struct *lck1,
+			 const struct lock_struct *lck2))
+{
+	const struct lock_struct *locks = br_lck->lock_data;
+
+	while (lo < hi) {
+		unsigned int mid = lo + (hi - lo) / 2;
+		const struct lock_struct *found;
+
+		if (br_lck->tree_ends[mid] <= plock->start) {
+			/* Nothing in this subtree reaches plock. */
+			return NULL;
+		}
+
+		found = brl_tree_find(br_lck, lo, mid, plock, end, conflict);
+		if (found != NULL) {
+			return found;
+		}
+
+		if (locks[mid].start >= end) {
+			/* mid and everything right of it start too late. */
+			return NULL;
+		}
+		if (conflict(&locks[mid], plock)) {
+			return &locks[mid];
+		}
+		lo = mid + 1;
+	}
+	return NULL;
+}
+
+/****************************************************************************
+ Find the first lock that conflicts with plock, in O(log n) plus the
+ number of locks overlapping plock. The tree is built once per record
+ fetch; the read only view of the locks, that read and write check
+ against, is cached per fsp until brlock.tdb changes, and keeps its
+ tree with it. Returns NULL if nothing conflicts.
+****************************************************************************/
+
+static const struct lock_struct *brl_find_conflict(
+	struct byte_range_lock *br_lck,
+	const struct lock_struct *plock,
+	bool (*conflict)(const struct lock_struct *lck1,
+			 const struct lock_struct *lck2))
+{
+	const struct lock_struct *locks = br_lck->lock_data;
+	unsigned int i;
+	br_off end = plock->start + plock->size;
+
+	if ((end < plock->start) || !brl_build_tree(br_lck)) {
+		for (i = 0; i < br_lck->num_locks; i++) {
+			if (conflict(&locks[i], plock)) {
+				return &locks[i];
+			}
+		}
+		return NULL;
+	}
+
+	return brl_tree_find(br_lck, 0, br_lck->num_locks, plock, end,
+			     conflict);
+}
+
+/****************************************************************************
+ The conflict check for lock queries, depending on the flavour of the
+ existing lock.
+****************************************************************************/
+
+static bool brl_conflict_query(const struct lock_struct *exlock,
+			       const struct lock_struct *lock)
+{
+	if (exlock->lock_flav == WINDOWS_LOCK) {
+		return brl_conflict(exlock, lock);
+	}
+	return brl_conflict_posix(exlock, lock);
+}
+
 /****************************************************************************
  Check if an unlock overlaps a pending lock.
 ****************************************************************************/
@@ -332,9 +525,9 @@ static int lock_compare(const struct lock_struct *lck1,
 NTSTATUS brl_lock_windows_default(struct byte_range_lock *br_lck,
     struct lock_struct *plock, bool blocking_lock)
 {
-	unsigned int i;
 	files_struct *fsp = br_lck->fsp;
-	struct lock_struct *locks = br_lck->lock_data;
+	struct lock_struct *locks;
+	const struct lock_struct *exlock;
 	NTSTATUS status;
 
 	SMB_ASSERT(plock->lock_type != UNLOCK_LOCK);
@@ -344,21 +537,17 @@ NTSTATUS brl_lock_windows_default(struct byte_range_lock *br_lck,
 		return NT_STATUS_INVALID_LOCK_RANGE;
 	}
 
-	for (i=0; i < br_lck->num_locks; i++) {
-		/* Do any Windows or POSIX locks conflict ? */
-		if (brl_conflict(&locks[i], plock)) {
-			/* Remember who blocked us. */
-			plock->context.smblctx = locks[i].context.smblctx;
-			return brl_lock_failed(fsp,plock,blocking_lock);
-		}
-#if ZERO_ZERO
-		if (plock->start == 0 && plock->size == 0 && 
-				locks[i].size == 0) {
-			break;
-		}
-#endif
+	/* Do any Windows or POSIX locks conflict ? */
+	exlock = brl_find_conflict(br_lck, plock, brl_conflict);
+	if (exlock != NULL) {
+		/* Remember who blocked us. */
+		plock->context.smblctx = exlock->context.smblctx;
+		return brl_lock_failed(fsp,plock,blocking_lock);
 	}
 
+	/* brl_find_conflict() may have sorted the locks. */
+	locks = br_lck->lock_data;
+
 	if (!IS_PENDING_LOCK(plock->lock_type)) {
 		contend_level2_oplocks_begin(fsp, LEVEL2_CONTEND_WINDOWS_BRL);
 	}
@@ -401,7 +590,7 @@ NTSTATUS brl_lock_windows_default(struct byte_range_lock *br_lck,
 	memcpy(&locks[br_lck->num_locks], plock, sizeof(struct lock_struct));
 	br_lck->num_locks += 1;
 	br_lck->lock_data = locks;
-	br_lck->modified = True;
+	brl_locks_changed(br_lck);
 
 	return NT_STATUS_OK;
  fail:
@@ -856,7 +1045,7 @@ static NTSTATUS brl_lock_posix(struct messaging_context *msg_ctx,
 	SAFE_FREE(br_lck->lock_data);
 	br_lck->lock_data = tp;
 	locks = tp;
-	br_lck->modified = True;
+	brl_locks_changed(br_lck);
 
 	/* A successful downgrade from write to read lock can trigger a lock
 	   re-evalutation where waiting readers can now proceed. */
@@ -1034,7 +1223,7 @@ bool brl_unlock_windows_default(struct messaging_context *msg_ctx,
 	}
 
 	br_lck->num_locks -= 1;
-	br_lck->modified = True;
+	brl_locks_changed(br_lck);
 
 	/* Unlock the underlying POSIX regions. */
 	if(lp_posix_locking(br_lck->fsp->conn->params)) {
@@ -1201,7 +1390,7 @@ static bool brl_unlock_posix(struct messaging_context *msg_ctx,
 	SAFE_FREE(br_lck->lock_data);
 	locks = tp;
 	br_lck->lock_data = tp;
-	br_lck->modified = True;
+	brl_locks_changed(br_lck);
 
 	/* Send unlock messages to any pending waiters that overlap. */
 
@@ -1281,9 +1470,7 @@ bool brl_locktest(struct byte_range_lock *br_lck,
 		enum brl_flavour lock_flav)
 {
 	bool ret = True;
-	unsigned int i;
 	struct lock_struct lock;
-	const struct lock_struct *locks = br_lck->lock_data;
 	files_struct *fsp = br_lck->fsp;
 
 	lock.context.smblctx = smblctx;
@@ -1295,14 +1482,12 @@ bool brl_locktest(struct byte_range_lock *br_lck,
 	lock.lock_type = lock_type;
 	lock.lock_flav = lock_flav;
 
-	/* Make sure existing locks don't conflict */
-	for (i=0; i < br_lck->num_locks; i++) {
-		/*
-		 * Our own locks don't conflict.
-		 */
-		if (brl_conflict_other(&locks[i], &lock)) {
-			return False;
-		}
+	/*
+	 * Make sure existing locks don't conflict.
+	 * Our own locks don't conflict.
+	 */
+	if (brl_find_conflict(br_lck, &lock, brl_conflict_other) != NULL) {
+		return False;
 	}
 
 	/*
@@ -1338,9 +1523,8 @@ NTSTATUS brl_lockquery(struct byte_range_lock *br_lck,
 		enum brl_type *plock_type,
 		enum brl_flavour lock_flav)
 {
-	unsigned int i;
 	struct lock_struct lock;
-	const struct lock_struct *locks = br_lck->lock_data;
+	const struct lock_struct *exlock;
 	files_struct *fsp = br_lck->fsp;
 
 	lock.context.smblctx = *psmblctx;
@@ -1353,23 +1537,13 @@ NTSTATUS brl_lockquery(struct byte_range_lock *br_lck,
 	lock.lock_flav = lock_flav;
 
 	/* Make sure existing locks don't conflict */
-	for (i=0; i < br_lck->num_locks; i++) {
-		const struct lock_struct *exlock = &locks[i];
-		bool conflict = False;
-
-		if (exlock->lock_flav == WINDOWS_LOCK) {
-			conflict = brl_conflict(exlock, &lock);
-		} else {	
-			conflict = brl_conflict_posix(exlock, &lock);
-		}
-
-		if (conflict) {
-			*psmblctx = exlock->context.smblctx;
-        		*pstart = exlock->start;
-		        *psize = exlock->size;
-        		*plock_type = exlock->lock_type;
-			return NT_STATUS_LOCK_NOT_GRANTED;
-		}
+	exlock = brl_find_conflict(br_lck, &lock, brl_conflict_query);
+	if (exlock != NULL) {
+		*psmblctx = exlock->context.smblctx;
+		*pstart = exlock->start;
+		*psize = exlock->size;
+		*plock_type = exlock->lock_type;
+		return NT_STATUS_LOCK_NOT_GRANTED;
 	}
 
 	/*
@@ -1471,7 +1645,7 @@ bool brl_lock_cancel_default(struct byte_range_lock *br_lck,
 	}
 
 	br_lck->num_locks -= 1;
-	br_lck->modified = True;
+	brl_locks_changed(br_lck);
 	return True;
 }
 
@@ -1702,6 +1876,8 @@ static void byte_range_lock_flush(struct byte_range_lock *br_lck)
 		TDB_DATA data;
 		NTSTATUS status;
 
+		brl_sort_locks(br_lck->lock_data, br_lck->num_locks);
+
 		data.dptr = (uint8 *)br_lck->lock_data;
 		data.dsize = br_lck->num_locks * sizeof(struct lock_struct);
 
@@ -1781,6 +1957,7 @@ static struct byte_range_lock *brl_get_locks_internal(TALLOC_CTX *mem_ctx,
 
 	br_lck->read_only = do_read_only;
 	br_lck->lock_data = NULL;
+	br_lck->tree_ends = NULL;
 
 	talloc_set_destructor(br_lck, byte_range_lock_destructor);
 
@@ -1796,6 +1973,9 @@ static struct byte_range_lock *brl_get_locks_internal(TALLOC_CTX *mem_ctx,
 		}
 
 		memcpy(br_lck->lock_data, data.dptr, data.dsize);
+
+		/* Records written by older versions are not sorted. */
+		brl_sort_locks(br_lck->lock_data, br_lck->num_locks);
 	}
 
 	if (!fsp->lockdb_clean) {
@@ -1814,7 +1994,7 @@ static struct byte_range_lock *brl_get_locks_internal(TALLOC_CTX *mem_ctx,
 
 		/* Ensure invalid locks are cleaned up in the destructor. */
 		if (orig_num_locks != br_lck->num_locks) {
-			br_lck->modified = True;
+			brl_locks_changed(br_lck);
 		}
 
 		/* Mark the lockdb as "clean" as seen from this open file. */
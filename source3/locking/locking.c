@@ -444,7 +444,8 @@ static bool locking_init_internal(bool read_only)
 
 	lock_db = db_open(NULL, lock_path("locking.tdb"),
 			  lp_open_files_db_hash_size(),
-			  TDB_DEFAULT|TDB_VOLATILE|TDB_CLEAR_IF_FIRST|TDB_INCOMPATIBLE_HASH,
+			  TDB_DEFAULT|TDB_VOLATILE|TDB_CLEAR_IF_FIRST|TDB_INCOMPATIBLE_HASH|
+			  TDB_RESIZABLE_HASH,
 			  read_only?O_RDONLY:O_RDWR|O_CREAT, 0644);
 
 	if (!lock_db) {
@@ -509,6 +510,169 @@ char *share_mode_str(TALLOC_CTX *ctx, int num, const struct share_mode_entry *e)
 		 (unsigned int)e->name_hash);
 }
 
+/*******************************************************************
+ The layout of a locking.tdb record:
+
+ [0]  uint32 version (SHARE_MODE_RECORD_VERSION)
+ [4]  uint32 number of share mode entries
+ [8]  uint32 length of the header
+ [12] the NDR encoded share_mode_hdr: names, delete tokens, write times
+ [12+header length] the share mode entries, SHARE_MODE_ENTRY_SIZE each
+
+ The entries are at the end of the record in a fixed size layout, so
+ packing and unpacking them is a plain copy loop, and reading the
+ header does not have to look at the entries at all. If only entries
+ changed, the record is not rebuilt: the changed entries and the count
+ are written into it in place with dbwrap_record_store_range().
+********************************************************************/
+
+#define SHARE_MODE_RECORD_VERSION 2
+#define SHARE_MODE_RECORD_HDR_SIZE 12
+#define SHARE_MODE_ENTRY_SIZE 104
+
+static void share_mode_entry_pack(uint8_t *buf,
+				  const struct share_mode_entry *e)
+{
+	SBVAL(buf, 0, e->pid.pid);
+	SIVAL(buf, 8, e->pid.task_id);
+	SIVAL(buf, 12, e->pid.vnn);
+	SBVAL(buf, 16, e->pid.unique_id);
+	SBVAL(buf, 24, e->op_mid);
+	SSVAL(buf, 32, e->op_type);
+	SSVAL(buf, 34, e->flags);
+	SIVAL(buf, 36, e->access_mask);
+	SIVAL(buf, 40, e->share_access);
+	SIVAL(buf, 44, e->private_options);
+	SBVAL(buf, 48, e->time.tv_sec);
+	SIVAL(buf, 56, e->time.tv_usec);
+	SIVAL(buf, 60, e->uid);
+	SBVAL(buf, 64, e->id.devid);
+	SBVAL(buf, 72, e->id.inode);
+	SBVAL(buf, 80, e->id.extid);
+	SBVAL(buf, 88, e->share_file_id);
+	SIVAL(buf, 96, e->name_hash);
+	SIVAL(buf, 100, 0);
+}
+
+static void share_mode_entry_unpack(const uint8_t *buf,
+				    struct share_mode_entry *e)
+{
+	e->pid.pid = BVAL(buf, 0);
+	e->pid.task_id = IVAL(buf, 8);
+	e->pid.vnn = IVAL(buf, 12);
+	e->pid.unique_id = BVAL(buf, 16);
+	e->op_mid = BVAL(buf, 24);
+	e->op_type = SVAL(buf, 32);
+	e->flags = SVAL(buf, 34);
+	e->access_mask = IVAL(buf, 36);
+	e->share_access = IVAL(buf, 40);
+	e->private_options = IVAL(buf, 44);
+	e->time.tv_sec = BVAL(buf, 48);
+	e->time.tv_usec = IVAL(buf, 56);
+	e->uid = IVAL(buf, 60);
+	e->id.devid = BVAL(buf, 64);
+	e->id.inode = BVAL(buf, 72);
+	e->id.extid = BVAL(buf, 80);
+	e->share_file_id = BVAL(buf, 88);
+	e->name_hash = IVAL(buf, 96);
+}
+
+/*******************************************************************
+ Find the header and the entries in a record.
+********************************************************************/
+
+static bool share_mode_record_split(const TDB_DATA dbuf, DATA_BLOB *hdr,
+				    uint32_t *num_share_modes,
+				    const uint8_t **entries)
+{
+	uint32_t num, hdr_len;
+
+	if (dbuf.dsize < SHARE_MODE_RECORD_HDR_SIZE) {
+		DEBUG(1, ("share mode record too short: %u\n",
+			  (unsigned)dbuf.dsize));
+		return false;
+	}
+	if (IVAL(dbuf.dptr, 0) != SHARE_MODE_RECORD_VERSION) {
+		DEBUG(1, ("unknown share mode record version %u\n",
+			  (unsigned)IVAL(dbuf.dptr, 0)));
+		return false;
+	}
+	num = IVAL(dbuf.dptr, 4);
+	hdr_len = IVAL(dbuf.dptr, 8);
+
+	if ((hdr_len > dbuf.dsize - SHARE_MODE_RECORD_HDR_SIZE) ||
+	    (num > (dbuf.dsize - SHARE_MODE_RECORD_HDR_SIZE - hdr_len) /
+	     SHARE_MODE_ENTRY_SIZE)) {
+		DEBUG(1, ("invalid share mode record: %u entries, header "
+			  "%u bytes, record %u bytes\n", (unsigned)num,
+			  (unsigned)hdr_len, (unsigned)dbuf.dsize));
+		return false;
+	}
+
+	*hdr = data_blob_const(dbuf.dptr + SHARE_MODE_RECORD_HDR_SIZE,
+			       hdr_len);
+	*num_share_modes = num;
+	*entries = dbuf.dptr + SHARE_MODE_RECORD_HDR_SIZE + hdr_len;
+	return true;
+}
+
+static bool parse_share_mode_hdr(DATA_BLOB blob, struct share_mode_lock *lck)
+{
+	struct share_mode_hdr hdr;
+	enum ndr_err_code ndr_err;
+
+	ndr_err = ndr_pull_struct_blob(
+		&blob, lck, &hdr,
+		(ndr_pull_flags_fn_t)ndr_pull_share_mode_hdr);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		DEBUG(1, ("ndr_pull_share_mode_hdr failed\n"));
+		return false;
+	}
+
+	lck->servicepath = hdr.servicepath;
+	lck->base_name = hdr.base_name;
+	lck->stream_name = hdr.stream_name;
+	lck->id = hdr.id;
+	lck->num_delete_tokens = hdr.num_delete_tokens;
+	lck->delete_tokens = hdr.delete_tokens;
+	lck->old_write_time = hdr.old_write_time;
+	lck->changed_write_time = hdr.changed_write_time;
+	return true;
+}
+
+/*******************************************************************
+ Unmarshall a whole record, without looking at the processes.
+********************************************************************/
+
+static bool parse_share_mode_record(const TDB_DATA dbuf,
+				    struct share_mode_lock *lck)
+{
+	DATA_BLOB hdr;
+	const uint8_t *entries;
+	uint32_t i, num_share_modes;
+
+	if (!share_mode_record_split(dbuf, &hdr, &num_share_modes,
+				     &entries)) {
+		return false;
+	}
+	if (!parse_share_mode_hdr(hdr, lck)) {
+		return false;
+	}
+
+	lck->share_modes = talloc_array(lck, struct share_mode_entry,
+					num_share_modes);
+	if ((num_share_modes != 0) && (lck->share_modes == NULL)) {
+		DEBUG(0, ("talloc failed\n"));
+		return false;
+	}
+	for (i=0; i<num_share_modes; i++) {
+		share_mode_entry_unpack(entries + i * SHARE_MODE_ENTRY_SIZE,
+					&lck->share_modes[i]);
+	}
+	lck->num_share_modes = num_share_modes;
+	return true;
+}
+
 /*******************************************************************
  Get all share mode entries for a dev/inode pair.
 ********************************************************************/
@@ -518,17 +682,8 @@ static bool parse_share_modes(const TDB_DATA dbuf, struct share_mode_lock *lck)
 	int i;
 	struct server_id *pids;
 	bool *pid_exists;
-	enum ndr_err_code ndr_err;
-	DATA_BLOB blob;
 
-	blob.data = dbuf.dptr;
-	blob.length = dbuf.dsize;
-
-	ndr_err = ndr_pull_struct_blob(
-		&blob, lck, lck,
-		(ndr_pull_flags_fn_t)ndr_pull_share_mode_lock);
-	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
-		DEBUG(1, ("ndr_pull_share_mode_lock failed\n"));
+	if (!parse_share_mode_record(dbuf, lck)) {
 		return false;
 	}
 
@@ -566,6 +721,7 @@ static bool parse_share_modes(const TDB_DATA dbuf, struct share_mode_lock *lck)
 		struct share_mode_entry *e = &lck->share_modes[i];
 		if (!pid_exists[i]) {
 			*e = lck->share_modes[lck->num_share_modes-1];
+			pid_exists[i] = pid_exists[lck->num_share_modes-1];
 			lck->num_share_modes -= 1;
 			lck->modified = True;
 			continue;
@@ -580,8 +736,12 @@ static bool parse_share_modes(const TDB_DATA dbuf, struct share_mode_lock *lck)
 
 static TDB_DATA unparse_share_modes(struct share_mode_lock *lck)
 {
+	struct share_mode_hdr hdr;
 	DATA_BLOB blob;
 	enum ndr_err_code ndr_err;
+	uint8_t *buf, *entries;
+	size_t len;
+	int i;
 
 	if (DEBUGLEVEL >= 10) {
 		DEBUG(10, ("unparse_share_modes:\n"));
@@ -593,14 +753,105 @@ static TDB_DATA unparse_share_modes(struct share_mode_lock *lck)
 		return make_tdb_data(NULL, 0);
 	}
 
+	hdr.servicepath = lck->servicepath;
+	hdr.base_name = lck->base_name;
+	hdr.stream_name = lck->stream_name;
+	hdr.id = lck->id;
+	hdr.num_delete_tokens = lck->num_delete_tokens;
+	hdr.delete_tokens = lck->delete_tokens;
+	hdr.old_write_time = lck->old_write_time;
+	hdr.changed_write_time = lck->changed_write_time;
+
 	ndr_err = ndr_push_struct_blob(
-		&blob, lck, lck,
-		(ndr_push_flags_fn_t)ndr_push_share_mode_lock);
+		&blob, talloc_tos(), &hdr,
+		(ndr_push_flags_fn_t)ndr_push_share_mode_hdr);
 	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
-		smb_panic("ndr_push_share_mode_lock failed");
+		smb_panic("ndr_push_share_mode_hdr failed");
+	}
+
+	len = SHARE_MODE_RECORD_HDR_SIZE + blob.length +
+		(size_t)lck->num_share_modes * SHARE_MODE_ENTRY_SIZE;
+	buf = talloc_array(lck, uint8_t, len);
+	if (buf == NULL) {
+		smb_panic("unparse_share_modes: talloc failed");
 	}
 
-	return make_tdb_data(blob.data, blob.length);
+	SIVAL(buf, 0, SHARE_MODE_RECORD_VERSION);
+	SIVAL(buf, 4, lck->num_share_modes);
+	SIVAL(buf, 8, blob.length);
+	memcpy(buf + SHARE_MODE_RECORD_HDR_SIZE, blob.data, blob.length);
+	data_blob_free(&blob);
+
+	entries = buf + len -
+		(size_t)lck->num_share_modes * SHARE_MODE_ENTRY_SIZE;
+	for (i=0; i<lck->num_share_modes; i++) {
+		share_mode_entry_pack(entries + i * SHARE_MODE_ENTRY_SIZE,
+				      &lck->share_modes[i]);
+	}
+
+	return make_tdb_data(buf, len);
+}
+
+/*******************************************************************
+ Write back a record whose header did not change. Entries are
+ appended and removed at the end (removal moves the last entry into
+ the hole), so this writes the entries that differ from the stored
+ ones and the count, and cuts the record short after removals.
+********************************************************************/
+
+static bool store_share_mode_entries(struct share_mode_lock *lck)
+{
+	TDB_DATA old = dbwrap_record_get_value(lck->record);
+	DATA_BLOB hdr;
+	const uint8_t *old_entries;
+	uint8_t buf[SHARE_MODE_ENTRY_SIZE];
+	uint32_t i, old_num, ofs, size, new_size;
+	NTSTATUS status;
+
+	if (lck->fresh || lck->hdr_modified || (lck->num_share_modes == 0)) {
+		return false;
+	}
+	if (!share_mode_record_split(old, &hdr, &old_num, &old_entries)) {
+		return false;
+	}
+
+	ofs = SHARE_MODE_RECORD_HDR_SIZE + hdr.length;
+	size = old.dsize;
+	new_size = ofs + lck->num_share_modes * SHARE_MODE_ENTRY_SIZE;
+
+	for (i=0; i<lck->num_share_modes; i++) {
+		uint32_t end = ofs + (i+1) * SHARE_MODE_ENTRY_SIZE;
+
+		share_mode_entry_pack(buf, &lck->share_modes[i]);
+		if ((i < old_num) &&
+		    (memcmp(buf, old_entries + i * SHARE_MODE_ENTRY_SIZE,
+			    SHARE_MODE_ENTRY_SIZE) == 0)) {
+			continue;
+		}
+		size = MAX(size, end);
+		status = dbwrap_record_store_range(
+			lck->record, end - SHARE_MODE_ENTRY_SIZE,
+			make_tdb_data(buf, sizeof(buf)), size);
+		if (!NT_STATUS_IS_OK(status)) {
+			DEBUG(5, ("dbwrap_record_store_range failed: %s\n",
+				  nt_errstr(status)));
+			return false;
+		}
+	}
+
+	if (lck->num_share_modes == old_num) {
+		return true;
+	}
+
+	SIVAL(buf, 0, lck->num_share_modes);
+	status = dbwrap_record_store_range(lck->record, 4,
+					   make_tdb_data(buf, 4), new_size);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(5, ("dbwrap_record_store_range failed: %s\n",
+			  nt_errstr(status)));
+		return false;
+	}
+	return true;
 }
 
 static int share_mode_lock_destructor(struct share_mode_lock *lck)
@@ -612,6 +863,10 @@ static int share_mode_lock_destructor(struct share_mode_lock *lck)
 		return 0;
 	}
 
+	if (store_share_mode_entries(lck)) {
+		return 0;
+	}
+
 	data = unparse_share_modes(lck);
 
 	if (data.dptr == NULL) {
@@ -677,6 +932,7 @@ static bool fill_share_mode_lock(struct share_mode_lock *lck,
 	lck->delete_tokens = NULL;
 	ZERO_STRUCT(lck->old_write_time);
 	ZERO_STRUCT(lck->changed_write_time);
+	lck->hdr_modified = false;
 
 	fresh = (share_mode_data.dptr == NULL);
 
@@ -750,32 +1006,54 @@ struct share_mode_lock *get_share_mode_lock(TALLOC_CTX *mem_ctx,
 	return lck;
 }
 
+struct fetch_share_mode_unlocked_state {
+	struct share_mode_lock *lck;
+	bool ok;
+};
+
+static void fetch_share_mode_unlocked_parser(TDB_DATA key, TDB_DATA data,
+					     void *private_data)
+{
+	struct fetch_share_mode_unlocked_state *state =
+		(struct fetch_share_mode_unlocked_state *)private_data;
+	const uint8_t *entries;
+	uint32_t num_share_modes;
+	DATA_BLOB hdr;
+
+	if (!share_mode_record_split(data, &hdr, &num_share_modes,
+				     &entries)) {
+		return;
+	}
+	state->ok = parse_share_mode_hdr(hdr, state->lck);
+}
+
+/*******************************************************************
+ Get the names, delete tokens and write times of an open file without
+ locking the record. The share mode entries are not read, the
+ returned share_mode_lock has num_share_modes == 0.
+********************************************************************/
+
 struct share_mode_lock *fetch_share_mode_unlocked(TALLOC_CTX *mem_ctx,
 						  const struct file_id id)
 {
+	struct fetch_share_mode_unlocked_state state;
 	struct share_mode_lock *lck;
 	struct file_id tmp;
 	TDB_DATA key = locking_key(&id, &tmp);
-	TDB_DATA data;
 	NTSTATUS status;
 
-	if (!(lck = talloc(mem_ctx, struct share_mode_lock))) {
+	if (!(lck = talloc_zero(mem_ctx, struct share_mode_lock))) {
 		DEBUG(0, ("talloc failed\n"));
 		return NULL;
 	}
+	lck->id = id;
 
-	status = dbwrap_fetch(lock_db, lck, key, &data);
-	if (!NT_STATUS_IS_OK(status)) {
-		DEBUG(3, ("Could not fetch share entry\n"));
-		TALLOC_FREE(lck);
-		return NULL;
-	}
-	if (data.dptr == NULL) {
-		TALLOC_FREE(lck);
-		return NULL;
-	}
+	state.lck = lck;
+	state.ok = false;
 
-	if (!fill_share_mode_lock(lck, id, NULL, NULL, data, NULL)) {
+	status = dbwrap_parse_record(lock_db, key,
+				     fetch_share_mode_unlocked_parser, &state);
+	if (!NT_STATUS_IS_OK(status) || !state.ok) {
 		DEBUG(10, ("fetch_share_mode_unlocked: no share_mode record "
 			   "around (file not open)\n"));
 		TALLOC_FREE(lck);
@@ -833,6 +1111,7 @@ bool rename_share_filename(struct messaging_context *msg_ctx,
 		return False;
 	}
 	lck->modified = True;
+	lck->hdr_modified = True;
 
 	sp_len = strlen(lck->servicepath);
 	bn_len = strlen(lck->base_name);
@@ -1211,6 +1490,7 @@ static bool add_delete_on_close_token(struct share_mode_lock *lck,
 	}
 	lck->num_delete_tokens += 1;
 	lck->modified = true;
+	lck->hdr_modified = true;
 	return true;
 }
 
@@ -1243,6 +1523,7 @@ void set_delete_on_close_lck(files_struct *fsp,
 		struct delete_token *dt = &lck->delete_tokens[i];
 		if (dt->name_hash == fsp->name_hash) {
 			lck->modified = true;
+			lck->hdr_modified = true;
 			if (delete_on_close == false) {
 				/* Delete this entry. */
 				TALLOC_FREE(dt->delete_token);
@@ -1338,6 +1619,7 @@ bool set_sticky_write_time(struct file_id fileid, struct timespec write_time)
 
 	if (timespec_compare(&lck->changed_write_time, &write_time) != 0) {
 		lck->modified = True;
+		lck->hdr_modified = True;
 		lck->changed_write_time = write_time;
 	}
 
@@ -1361,6 +1643,7 @@ bool set_write_time(struct file_id fileid, struct timespec write_time)
 
 	if (timespec_compare(&lck->old_write_time, &write_time) != 0) {
 		lck->modified = True;
+		lck->hdr_modified = True;
 		lck->old_write_time = write_time;
 	}
 
@@ -1383,8 +1666,6 @@ static int traverse_fn(struct db_record *rec, void *_state)
 	uint32_t i;
 	TDB_DATA key;
 	TDB_DATA value;
-	DATA_BLOB blob;
-	enum ndr_err_code ndr_err;
 	struct share_mode_lock *lck;
 
 	key = dbwrap_record_get_key(rec);
@@ -1394,19 +1675,13 @@ static int traverse_fn(struct db_record *rec, void *_state)
 	if (key.dsize != sizeof(struct file_id))
 		return 0;
 
-	lck = talloc(talloc_tos(), struct share_mode_lock);
+	lck = talloc_zero(talloc_tos(), struct share_mode_lock);
 	if (lck == NULL) {
 		return 0;
 	}
 
-	blob.data = value.dptr;
-	blob.length = value.dsize;
-
-	ndr_err = ndr_pull_struct_blob(
-		&blob, lck, lck,
-		(ndr_pull_flags_fn_t)ndr_pull_share_mode_lock);
-	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
-		DEBUG(1, ("ndr_pull_share_mode_lock failed\n"));
+	if (!parse_share_mode_record(value, lck)) {
+		TALLOC_FREE(lck);
 		return 0;
 	}
 	for (i=0; i<lck->num_share_modes; i++) {
@@ -303,7 +303,7 @@ static NTSTATUS onefs_open_file(files_struct *fsp,
 	}
 
 	fsp->mode = smb_fname->st.st_ex_mode;
-	fsp->file_id = vfs_file_id_from_sbuf(conn, &smb_fname->st);
+	fsp_set_file_id(fsp, vfs_file_id_from_sbuf(conn, &smb_fname->st));
 	fsp->vuid = req ? req->vuid : UID_FIELD_INVALID;
 	fsp->file_pid = req ? req->smbpid : 0;
 	fsp->can_lock = True;
@@ -1617,7 +1617,7 @@ static NTSTATUS onefs_open_directory(connection_struct *conn,
 
 	/* Setup the files_struct for it. */
 	fsp->mode = smb_dname->st.st_ex_mode;
-	fsp->file_id = vfs_file_id_from_sbuf(conn, &smb_dname->st);
+	fsp_set_file_id(fsp, vfs_file_id_from_sbuf(conn, &smb_dname->st));
 	fsp->vuid = req ? req->vuid : UID_FIELD_INVALID;
 	fsp->file_pid = req ? req->smbpid : 0;
 	fsp->can_lock = False;
@@ -0,0 +1,1006 @@
+/*
+ * Posix AIO on top of the Linux io_uring interface.
+ *
+ * Based on the vfs_aio_pthread module.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "includes.h"
+#include "system/filesys.h"
+#include "system/shmem.h"
+#include "smbd/smbd.h"
+
+#include <sys/syscall.h>
+#include <sys/eventfd.h>
+#include <linux/io_uring.h>
+
+/*
+ * We talk to the kernel directly instead of depending on liburing.
+ * Requests queued by aio_read/aio_write are only put into the
+ * submission ring, a tevent immediate then submits everything that
+ * was queued during one pass through the event loop with a single
+ * io_uring_enter call. Completions are signalled through an eventfd
+ * registered with the ring, all completions that are ready are
+ * reaped with one read of that eventfd.
+ */
+
+struct aio_extra;
+
+struct io_uring_sq {
+	unsigned *head;
+	unsigned *tail;
+	unsigned *ring_mask;
+	unsigned *ring_entries;
+	unsigned *array;
+	struct io_uring_sqe *sqes;
+	void *ring_ptr;
+	size_t ring_size;
+	size_t sqes_size;
+	unsigned to_submit;
+};
+
+struct io_uring_cq {
+	unsigned *head;
+	unsigned *tail;
+	unsigned *ring_mask;
+	struct io_uring_cqe *cqes;
+	void *ring_ptr;
+	size_t ring_size;
+};
+
+struct io_uring_ctx {
+	int ring_fd;
+	int event_fd;
+	struct io_uring_sq sq;
+	struct io_uring_cq cq;
+	struct fd_event *fde;
+	struct tevent_immediate *submit_im;
+	bool submit_scheduled;
+};
+
+static struct io_uring_ctx *uring;
+static uint64_t io_uring_next_id;
+
+/*
+ * The kernel looks at the sqe and at pd->iov until the request has
+ * completed, so the private data hangs off the ring and not off the
+ * aio_extra. The aio_extra only owns a link to it. If the aio_extra
+ * goes away first, the link's destructor orphans the private data,
+ * which is then freed once its completion has been reaped.
+ */
+
+struct io_uring_pd_link;
+
+struct io_uring_private_data {
+	struct io_uring_private_data *prev, *next;
+	struct io_uring_pd_link *link;
+	uint64_t id;
+	SMB_STRUCT_AIOCB *aiocb;
+	struct iovec iov;
+	ssize_t ret_size;
+	int ret_errno;
+	bool completed;
+	bool submit_failed;
+	bool cancelled;
+	bool write_command;
+};
+
+struct io_uring_pd_link {
+	struct io_uring_private_data *pd;
+};
+
+/* List of outstanding requests we have. */
+static struct io_uring_private_data *pd_list;
+
+static void io_uring_handle_completion(struct event_context *event_ctx,
+				struct fd_event *event,
+				uint16 flags,
+				void *p);
+static struct io_uring_private_data *find_private_data_by_id(uint64_t id);
+
+/************************************************************************
+ Thin syscall wrappers, glibc does not provide them.
+***********************************************************************/
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params *p)
+{
+	return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit,
+			      unsigned min_complete, unsigned flags)
+{
+	return syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+		       flags, NULL, 0);
+}
+
+static int sys_io_uring_register(int fd, unsigned opcode,
+				 const void *arg, unsigned nr_args)
+{
+	return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/************************************************************************
+ How many submission queue entries ? The aio code in smbd limits
+ the number of outstanding requests itself, so this only needs to be
+ larger than "aio_pending_size" to never make us fall back to
+ synchronous I/O. The completion queue is twice as large.
+***********************************************************************/
+
+static int io_uring_get_num_entries(struct vfs_handle_struct *handle)
+{
+	return lp_parm_int(SNUM(handle->conn),
+			   "io_uring",
+			   "num entries",
+			   128);
+}
+
+static int io_uring_ctx_destructor(struct io_uring_ctx *ctx)
+{
+	TALLOC_FREE(ctx->fde);
+	TALLOC_FREE(ctx->submit_im);
+	if (ctx->sq.sqes != NULL) {
+		munmap(ctx->sq.sqes, ctx->sq.sqes_size);
+	}
+	if (ctx->sq.ring_ptr != NULL) {
+		munmap(ctx->sq.ring_ptr, ctx->sq.ring_size);
+	}
+	if (ctx->cq.ring_ptr != NULL) {
+		munmap(ctx->cq.ring_ptr, ctx->cq.ring_size);
+	}
+	if (ctx->event_fd != -1) {
+		close(ctx->event_fd);
+	}
+	if (ctx->ring_fd != -1) {
+		close(ctx->ring_fd);
+	}
+	return 0;
+}
+
+/************************************************************************
+ Map the rings shared with the kernel.
+***********************************************************************/
+
+static bool io_uring_map_rings(struct io_uring_ctx *ctx,
+			       const struct io_uring_params *p)
+{
+	struct io_uring_sq *sq = &ctx->sq;
+	struct io_uring_cq *cq = &ctx->cq;
+	uint8_t *ptr;
+
+	sq->ring_size = p->sq_off.array + p->sq_entries * sizeof(unsigned);
+	ptr = mmap(NULL, sq->ring_size, PROT_READ|PROT_WRITE,
+		   MAP_SHARED|MAP_POPULATE, ctx->ring_fd,
+		   IORING_OFF_SQ_RING);
+	if (ptr == MAP_FAILED) {
+		return false;
+	}
+	sq->ring_ptr = ptr;
+	sq->head = (unsigned *)(ptr + p->sq_off.head);
+	sq->tail = (unsigned *)(ptr + p->sq_off.tail);
+	sq->ring_mask = (unsigned *)(ptr + p->sq_off.ring_mask);
+	sq->ring_entries = (unsigned *)(ptr + p->sq_off.ring_entries);
+	sq->array = (unsigned *)(ptr + p->sq_off.array);
+
+	sq->sqes_size = p->sq_entries * sizeof(struct io_uring_sqe);
+	ptr = mmap(NULL, sq->sqes_size, PROT_READ|PROT_WRITE,
+		   MAP_SHARED|MAP_POPULATE, ctx->ring_fd,
+		   IORING_OFF_SQES);
+	if (ptr == MAP_FAILED) {
+		return false;
+	}
+	sq->sqes = (struct io_uring_sqe *)ptr;
+
+	cq->ring_size = p->cq_off.cqes +
+		p->cq_entries * sizeof(struct io_uring_cqe);
+	ptr = mmap(NULL, cq->ring_size, PROT_READ|PROT_WRITE,
+		   MAP_SHARED|MAP_POPULATE, ctx->ring_fd,
+		   IORING_OFF_CQ_RING);
+	if (ptr == MAP_FAILED) {
+		return false;
+	}
+	cq->ring_ptr = ptr;
+	cq->head = (unsigned *)(ptr + p->cq_off.head);
+	cq->tail = (unsigned *)(ptr + p->cq_off.tail);
+	cq->ring_mask = (unsigned *)(ptr + p->cq_off.ring_mask);
+	cq->cqes = (struct io_uring_cqe *)(ptr + p->cq_off.cqes);
+
+	return true;
+}
+
+/************************************************************************
+ Ensure the ring is initialized.
+***********************************************************************/
+
+static bool init_io_uring(struct vfs_handle_struct *handle)
+{
+	static bool tried_setup = false;
+	struct io_uring_params params;
+	struct io_uring_ctx *ctx;
+	int num_entries;
+	int ret;
+
+	if (uring) {
+		return true;
+	}
+	if (tried_setup) {
+		errno = ENOSYS;
+		return false;
+	}
+	tried_setup = true;
+
+	ctx = talloc_zero(NULL, struct io_uring_ctx);
+	if (ctx == NULL) {
+		errno = ENOMEM;
+		return false;
+	}
+	ctx->ring_fd = -1;
+	ctx->event_fd = -1;
+	talloc_set_destructor(ctx, io_uring_ctx_destructor);
+
+	num_entries = io_uring_get_num_entries(handle);
+
+	ZERO_STRUCT(params);
+	ctx->ring_fd = sys_io_uring_setup(num_entries, &params);
+	if (ctx->ring_fd == -1) {
+		DEBUG(1, ("init_io_uring: io_uring_setup failed: %s\n",
+			  strerror(errno)));
+		goto fail;
+	}
+
+	if (!io_uring_map_rings(ctx, &params)) {
+		DEBUG(1, ("init_io_uring: mmap failed: %s\n",
+			  strerror(errno)));
+		goto fail;
+	}
+
+	ctx->event_fd = eventfd(0, EFD_NONBLOCK|EFD_CLOEXEC);
+	if (ctx->event_fd == -1) {
+		goto fail;
+	}
+
+	ret = sys_io_uring_register(ctx->ring_fd, IORING_REGISTER_EVENTFD,
+				    &ctx->event_fd, 1);
+	if (ret == -1) {
+		DEBUG(1, ("init_io_uring: registering eventfd failed: %s\n",
+			  strerror(errno)));
+		goto fail;
+	}
+
+	ctx->submit_im = tevent_create_immediate(ctx);
+	if (ctx->submit_im == NULL) {
+		errno = ENOMEM;
+		goto fail;
+	}
+
+	ctx->fde = tevent_add_fd(server_event_context(),
+				ctx,
+				ctx->event_fd,
+				TEVENT_FD_READ,
+				io_uring_handle_completion,
+				NULL);
+	if (ctx->fde == NULL) {
+		errno = ENOMEM;
+		goto fail;
+	}
+
+	DEBUG(10,("init_io_uring: initialized with %u sq entries\n",
+		  params.sq_entries));
+
+	uring = ctx;
+	return true;
+
+  fail:
+	ret = errno;
+	TALLOC_FREE(ctx);
+	errno = ret;
+	return false;
+}
+
+/************************************************************************
+ Hand everything queued in the submission ring to the kernel.
+***********************************************************************/
+
+static int io_uring_flush_submissions(struct io_uring_ctx *ctx)
+{
+	while (ctx->sq.to_submit > 0) {
+		int ret = sys_io_uring_enter(ctx->ring_fd, ctx->sq.to_submit,
+					     0, 0);
+		if (ret == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+		ctx->sq.to_submit -= ret;
+	}
+	return 0;
+}
+
+/************************************************************************
+ The kernel refused to take the requests still sitting in the
+ submission ring. Without SQPOLL it only looks at the ring inside
+ io_uring_enter, so we can take them back and complete them with the
+ error ourselves.
+***********************************************************************/
+
+static void io_uring_fail_submissions(struct io_uring_ctx *ctx, int err)
+{
+	struct io_uring_sq *sq = &ctx->sq;
+	struct io_uring_private_data *pd;
+	unsigned tail = *sq->tail;
+	unsigned i;
+
+	for (i = 0; i < sq->to_submit; i++) {
+		unsigned idx = (tail - sq->to_submit + i) & *sq->ring_mask;
+		struct io_uring_sqe *sqe = &sq->sqes[sq->array[idx]];
+
+		pd = find_private_data_by_id(sqe->user_data);
+		if (pd == NULL) {
+			continue;
+		}
+		pd->ret_size = -1;
+		pd->ret_errno = err;
+		pd->completed = true;
+		pd->submit_failed = true;
+	}
+
+	__atomic_store_n(sq->tail, tail - sq->to_submit, __ATOMIC_RELEASE);
+	sq->to_submit = 0;
+
+	/*
+	 * Completing a request can change pd_list, start over after
+	 * every single one.
+	 */
+again:
+	for (pd = pd_list; pd != NULL; pd = pd->next) {
+		struct aio_extra *aio_ex;
+
+		if (!pd->submit_failed) {
+			continue;
+		}
+		pd->submit_failed = false;
+
+		if (pd->link == NULL) {
+			/* Nobody is waiting for it anymore. */
+			TALLOC_FREE(pd);
+			goto again;
+		}
+
+		aio_ex = (struct aio_extra *)pd->aiocb->aio_sigevent.sigev_value.sival_ptr;
+		smbd_aio_complete_aio_ex(aio_ex);
+		goto again;
+	}
+}
+
+static void io_uring_submit_immediate(struct tevent_context *ev,
+				struct tevent_immediate *im,
+				void *private_data)
+{
+	struct io_uring_ctx *ctx = talloc_get_type_abort(
+		private_data, struct io_uring_ctx);
+
+	ctx->submit_scheduled = false;
+
+	if (io_uring_flush_submissions(ctx) == -1) {
+		int err = errno;
+
+		DEBUG(1, ("io_uring_submit_immediate: io_uring_enter "
+			  "failed: %s\n", strerror(err)));
+		io_uring_fail_submissions(ctx, err);
+	}
+}
+
+/************************************************************************
+ Private data destructor.
+***********************************************************************/
+
+static int pd_destructor(struct io_uring_private_data *pd)
+{
+	if (pd->link != NULL) {
+		pd->link->pd = NULL;
+	}
+	DLIST_REMOVE(pd_list, pd);
+	return 0;
+}
+
+static int pd_link_destructor(struct io_uring_pd_link *link)
+{
+	struct io_uring_private_data *pd = link->pd;
+
+	if (pd == NULL) {
+		return 0;
+	}
+	pd->link = NULL;
+
+	if (pd->completed) {
+		TALLOC_FREE(pd);
+		return 0;
+	}
+
+	/* Still owned by the kernel, reaping the completion frees it. */
+	pd->aiocb = NULL;
+	return 0;
+}
+
+/************************************************************************
+ Create and initialize a private data struct.
+***********************************************************************/
+
+static struct io_uring_private_data *create_private_data(TALLOC_CTX *ctx,
+					SMB_STRUCT_AIOCB *aiocb)
+{
+	struct io_uring_private_data *pd;
+	struct io_uring_pd_link *link;
+
+	link = talloc_zero(ctx, struct io_uring_pd_link);
+	if (link == NULL) {
+		return NULL;
+	}
+	pd = talloc_zero(uring, struct io_uring_private_data);
+	if (pd == NULL) {
+		TALLOC_FREE(link);
+		return NULL;
+	}
+	pd->id = ++io_uring_next_id;
+	pd->aiocb = aiocb;
+	pd->ret_size = -1;
+	pd->ret_errno = EINPROGRESS;
+	pd->link = link;
+	link->pd = pd;
+	talloc_set_destructor(pd, pd_destructor);
+	talloc_set_destructor(link, pd_link_destructor);
+	DLIST_ADD_END(pd_list, pd, struct io_uring_private_data *);
+	return pd;
+}
+
+/************************************************************************
+ Put one readv/writev into the submission ring and make sure it gets
+ submitted at the end of this event loop pass.
+***********************************************************************/
+
+static int io_uring_queue_request(struct vfs_handle_struct *handle,
+				SMB_STRUCT_AIOCB *aiocb,
+				bool write_command)
+{
+	struct aio_extra *aio_ex = (struct aio_extra *)aiocb->aio_sigevent.sigev_value.sival_ptr;
+	struct io_uring_private_data *pd = NULL;
+	struct io_uring_sq *sq;
+	struct io_uring_sqe *sqe;
+	unsigned head, tail, idx;
+
+	if (!init_io_uring(handle)) {
+		return -1;
+	}
+	sq = &uring->sq;
+
+	head = __atomic_load_n(sq->head, __ATOMIC_ACQUIRE);
+	tail = *sq->tail;
+
+	if (tail - head >= *sq->ring_entries) {
+		/* Ring full, give the kernel what we have. */
+		if (io_uring_flush_submissions(uring) == -1) {
+			return -1;
+		}
+		head = __atomic_load_n(sq->head, __ATOMIC_ACQUIRE);
+		if (tail - head >= *sq->ring_entries) {
+			errno = EAGAIN;
+			return -1;
+		}
+	}
+
+	pd = create_private_data(aio_ex, aiocb);
+	if (pd == NULL) {
+		DEBUG(10, ("io_uring_queue_request: Could not create "
+			   "private data.\n"));
+		errno = ENOMEM;
+		return -1;
+	}
+	pd->write_command = write_command;
+	pd->iov.iov_base = discard_const(aiocb->aio_buf);
+	pd->iov.iov_len = aiocb->aio_nbytes;
+
+	idx = tail & *sq->ring_mask;
+	sqe = &sq->sqes[idx];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = write_command ? IORING_OP_WRITEV : IORING_OP_READV;
+	sqe->fd = aiocb->aio_fildes;
+	sqe->off = aiocb->aio_offset;
+	sqe->addr = (uint64_t)(uintptr_t)&pd->iov;
+	sqe->len = 1;
+	sqe->user_data = pd->id;
+
+	sq->array[idx] = idx;
+	__atomic_store_n(sq->tail, tail + 1, __ATOMIC_RELEASE);
+	sq->to_submit += 1;
+
+	if (!uring->submit_scheduled) {
+		tevent_schedule_immediate(uring->submit_im,
+					server_event_context(),
+					io_uring_submit_immediate,
+					uring);
+		uring->submit_scheduled = true;
+	}
+
+	DEBUG(10, ("io_uring_queue_request: id=%llu %s requested "
+		"of %llu bytes at offset %llu\n",
+		(unsigned long long)pd->id,
+		write_command ? "writev" : "readv",
+		(unsigned long long)aiocb->aio_nbytes,
+		(unsigned long long)aiocb->aio_offset));
+
+	return 0;
+}
+
+static int io_uring_aio_read(struct vfs_handle_struct *handle,
+				struct files_struct *fsp,
+				SMB_STRUCT_AIOCB *aiocb)
+{
+	return io_uring_queue_request(handle, aiocb, false);
+}
+
+static int io_uring_aio_write(struct vfs_handle_struct *handle,
+				struct files_struct *fsp,
+				SMB_STRUCT_AIOCB *aiocb)
+{
+	return io_uring_queue_request(handle, aiocb, true);
+}
+
+/************************************************************************
+ Find the private data by id.
+***********************************************************************/
+
+static struct io_uring_private_data *find_private_data_by_id(uint64_t id)
+{
+	struct io_uring_private_data *pd;
+
+	for (pd = pd_list; pd != NULL; pd = pd->next) {
+		if (pd->id == id) {
+			return pd;
+		}
+	}
+
+	return NULL;
+}
+
+/************************************************************************
+ Take one entry off the completion ring. Returns the private data it
+ belongs to or NULL if the ring is empty. *pempty tells the two cases
+ apart, a completion for a request that went away also returns NULL.
+***********************************************************************/
+
+static struct io_uring_private_data *io_uring_reap_one(bool *pempty)
+{
+	struct io_uring_cq *cq = &uring->cq;
+	struct io_uring_private_data *pd;
+	struct io_uring_cqe cqe;
+	unsigned head, tail;
+
+	head = *cq->head;
+	tail = __atomic_load_n(cq->tail, __ATOMIC_ACQUIRE);
+
+	if (head == tail) {
+		*pempty = true;
+		return NULL;
+	}
+	*pempty = false;
+
+	cqe = cq->cqes[head & *cq->ring_mask];
+	__atomic_store_n(cq->head, head + 1, __ATOMIC_RELEASE);
+
+	pd = find_private_data_by_id(cqe.user_data);
+	if (pd == NULL) {
+		DEBUG(1, ("io_uring_reap_one: cannot find id %llu\n",
+			  (unsigned long long)cqe.user_data));
+		return NULL;
+	}
+
+	if (pd->link == NULL) {
+		/* The aio_extra went away while the kernel had it. */
+		TALLOC_FREE(pd);
+		return NULL;
+	}
+
+	pd->completed = true;
+	if (cqe.res < 0) {
+		pd->ret_size = -1;
+		pd->ret_errno = -cqe.res;
+	} else {
+		pd->ret_size = cqe.res;
+		pd->ret_errno = 0;
+	}
+	return pd;
+}
+
+static void io_uring_clear_eventfd(void)
+{
+	uint64_t val;
+	ssize_t nread;
+
+	do {
+		nread = read(uring->event_fd, &val, sizeof(val));
+	} while (nread == -1 && errno == EINTR);
+}
+
+/************************************************************************
+ Callback when IOs complete.
+***********************************************************************/
+
+static void io_uring_handle_completion(struct event_context *event_ctx,
+				struct fd_event *event,
+				uint16 flags,
+				void *p)
+{
+	struct io_uring_private_data *pd = NULL;
+	bool empty = false;
+
+	DEBUG(10, ("io_uring_handle_completion called with flags=%d\n",
+			(int)flags));
+
+	if ((flags & EVENT_FD_READ) == 0) {
+		return;
+	}
+
+	io_uring_clear_eventfd();
+
+	while (true) {
+		struct aio_extra *aio_ex;
+
+		pd = io_uring_reap_one(&empty);
+		if (empty) {
+			break;
+		}
+		if (pd == NULL) {
+			continue;
+		}
+
+		DEBUG(10,("io_uring_handle_completion: id %llu completed\n",
+			(unsigned long long)pd->id));
+
+		aio_ex = (struct aio_extra *)pd->aiocb->aio_sigevent.sigev_value.sival_ptr;
+		smbd_aio_complete_aio_ex(aio_ex);
+	}
+}
+
+/************************************************************************
+ Find the private data by aiocb.
+***********************************************************************/
+
+static struct io_uring_private_data *find_private_data_by_aiocb(SMB_STRUCT_AIOCB *aiocb)
+{
+	struct io_uring_private_data *pd;
+
+	for (pd = pd_list; pd != NULL; pd = pd->next) {
+		if (pd->aiocb == aiocb) {
+			return pd;
+		}
+	}
+
+	return NULL;
+}
+
+/************************************************************************
+ Called to return the result of a completed AIO.
+ Should only be called if aio_error returns something other than EINPROGRESS.
+ Returns:
+	Any other value - return from IO operation.
+***********************************************************************/
+
+static ssize_t io_uring_return_fn(struct vfs_handle_struct *handle,
+				struct files_struct *fsp,
+				SMB_STRUCT_AIOCB *aiocb)
+{
+	struct io_uring_private_data *pd = find_private_data_by_aiocb(aiocb);
+
+	if (pd == NULL) {
+		errno = EINVAL;
+		DEBUG(0, ("io_uring_return_fn: returning EINVAL\n"));
+		return -1;
+	}
+
+	pd->aiocb = NULL;
+
+	if (pd->ret_size == -1) {
+		errno = pd->ret_errno;
+	}
+
+	return pd->ret_size;
+}
+
+/************************************************************************
+ Called to check the result of an AIO.
+ Returns:
+	EINPROGRESS - still in progress.
+	EINVAL - invalid aiocb.
+	ECANCELED - request was cancelled.
+	0 - request completed successfully.
+	Any other value - errno from IO operation.
+***********************************************************************/
+
+static int io_uring_error_fn(struct vfs_handle_struct *handle,
+			     struct files_struct *fsp,
+			     SMB_STRUCT_AIOCB *aiocb)
+{
+	struct io_uring_private_data *pd = find_private_data_by_aiocb(aiocb);
+
+	if (pd == NULL) {
+		return EINVAL;
+	}
+	if (pd->cancelled) {
+		return ECANCELED;
+	}
+	return pd->ret_errno;
+}
+
+/************************************************************************
+ Called to request the cancel of an AIO, or all of them on a specific
+ fsp if aiocb == NULL.
+***********************************************************************/
+
+static int io_uring_cancel(struct vfs_handle_struct *handle,
+			struct files_struct *fsp,
+			SMB_STRUCT_AIOCB *aiocb)
+{
+	struct io_uring_private_data *pd = NULL;
+
+	for (pd = pd_list; pd != NULL; pd = pd->next) {
+		if (pd->aiocb == NULL) {
+			continue;
+		}
+		if (pd->aiocb->aio_fildes != fsp->fh->fd) {
+			continue;
+		}
+		if ((aiocb != NULL) && (pd->aiocb != aiocb)) {
+			continue;
+		}
+
+		/*
+		 * We let the kernel do its job, but we discard the
+		 * result when it's finished.
+		 */
+
+		pd->cancelled = true;
+	}
+
+	return AIO_CANCELED;
+}
+
+/************************************************************************
+ Callback for a previously detected completion.
+***********************************************************************/
+
+static void io_uring_handle_immediate(struct tevent_context *ctx,
+				struct tevent_immediate *im,
+				void *private_data)
+{
+	struct aio_extra *aio_ex = NULL;
+	uint64_t *pid = (uint64_t *)private_data;
+	struct io_uring_private_data *pd = find_private_data_by_id(*pid);
+
+	if (pd == NULL) {
+		DEBUG(1, ("io_uring_handle_immediate cannot find id %llu\n",
+			  (unsigned long long)*pid));
+		TALLOC_FREE(pid);
+		return;
+	}
+
+	TALLOC_FREE(pid);
+	aio_ex = (struct aio_extra *)pd->aiocb->aio_sigevent.sigev_value.sival_ptr;
+	smbd_aio_complete_aio_ex(aio_ex);
+}
+
+/************************************************************************
+ Private data struct used in suspend completion code.
+***********************************************************************/
+
+struct suspend_private {
+	int num_entries;
+	int num_finished;
+	const SMB_STRUCT_AIOCB * const *aiocb_array;
+};
+
+/************************************************************************
+ Callback when IOs complete from a suspend call.
+***********************************************************************/
+
+static void io_uring_handle_suspend_completion(struct event_context *event_ctx,
+				struct fd_event *event,
+				uint16 flags,
+				void *p)
+{
+	struct suspend_private *sp = (struct suspend_private *)p;
+	struct io_uring_private_data *pd = NULL;
+	bool empty = false;
+
+	DEBUG(10, ("io_uring_handle_suspend_completion called with "
+		   "flags=%d\n", (int)flags));
+
+	if ((flags & EVENT_FD_READ) == 0) {
+		return;
+	}
+
+	io_uring_clear_eventfd();
+
+	while (true) {
+		struct tevent_immediate *im = NULL;
+		uint64_t *pid = NULL;
+		int i;
+
+		pd = io_uring_reap_one(&empty);
+		if (empty) {
+			break;
+		}
+		if (pd == NULL) {
+			continue;
+		}
+
+		/* Is this an aiocb we're interested in ? */
+		for (i = 0; i < sp->num_entries; i++) {
+			if (sp->aiocb_array[i] == pd->aiocb) {
+				sp->num_finished++;
+				break;
+			}
+		}
+		if (i < sp->num_entries) {
+			continue;
+		}
+
+		/* Completed one we weren't waiting for.
+		   We must reschedule this as an immediate event
+		   on the main event context. */
+		pid = talloc(NULL, uint64_t);
+		if (pid == NULL) {
+			smb_panic("io_uring_handle_suspend_completion: "
+				  "no memory.");
+		}
+		*pid = pd->id;
+
+		im = tevent_create_immediate(pid);
+		if (!im) {
+			exit_server_cleanly("io_uring_handle_suspend_completion: "
+					    "no memory");
+		}
+
+		DEBUG(10,("io_uring_handle_suspend_completion: "
+			"re-scheduling id %llu\n",
+			(unsigned long long)pd->id));
+
+		tevent_schedule_immediate(im,
+				server_event_context(),
+				io_uring_handle_immediate,
+				(void *)pid);
+	}
+}
+
+static void io_uring_suspend_timed_out(struct tevent_context *event_ctx,
+					struct tevent_timer *te,
+					struct timeval now,
+					void *private_data)
+{
+	bool *timed_out = (bool *)private_data;
+	/* Remove this timed event handler. */
+	TALLOC_FREE(te);
+	*timed_out = true;
+}
+
+/************************************************************************
+ Called to request everything to stop until all IO is completed.
+***********************************************************************/
+
+static int io_uring_suspend(struct vfs_handle_struct *handle,
+			struct files_struct *fsp,
+			const SMB_STRUCT_AIOCB * const aiocb_array[],
+			int n,
+			const struct timespec *timeout)
+{
+	struct event_context *ev = NULL;
+	struct fd_event *sock_event = NULL;
+	int ret = -1;
+	struct suspend_private sp;
+	bool timed_out = false;
+	TALLOC_CTX *frame = talloc_stackframe();
+
+	if (uring == NULL) {
+		errno = EINVAL;
+		goto out;
+	}
+
+	/*
+	 * Requests might still sit in the submission ring waiting
+	 * for the immediate on the main event context.
+	 */
+	if (io_uring_flush_submissions(uring) == -1) {
+		goto out;
+	}
+
+	/* This is a blocking call, and has to use a sub-event loop. */
+	ev = event_context_init(frame);
+	if (ev == NULL) {
+		errno = ENOMEM;
+		goto out;
+	}
+
+	if (timeout) {
+		struct timeval tv = convert_timespec_to_timeval(*timeout);
+		struct tevent_timer *te = tevent_add_timer(ev,
+						frame,
+						timeval_current_ofs(tv.tv_sec,
+								    tv.tv_usec),
+						io_uring_suspend_timed_out,
+						&timed_out);
+		if (!te) {
+			errno = ENOMEM;
+			goto out;
+		}
+	}
+
+	ZERO_STRUCT(sp);
+	sp.num_entries = n;
+	sp.aiocb_array = aiocb_array;
+	sp.num_finished = 0;
+
+	sock_event = tevent_add_fd(ev,
+				frame,
+				uring->event_fd,
+				TEVENT_FD_READ,
+				io_uring_handle_suspend_completion,
+				(void *)&sp);
+	if (sock_event == NULL) {
+		errno = ENOMEM;
+		goto out;
+	}
+
+	/*
+	 * Completions might have arrived before we registered the
+	 * eventfd with the sub-event loop, reap them first.
+	 */
+	io_uring_handle_suspend_completion(ev, sock_event, TEVENT_FD_READ,
+					   (void *)&sp);
+
+	while (sp.num_entries != sp.num_finished) {
+		if (tevent_loop_once(ev) == -1) {
+			goto out;
+		}
+
+		if (timed_out) {
+			errno = EAGAIN;
+			goto out;
+		}
+	}
+
+	ret = 0;
+
+  out:
+
+	TALLOC_FREE(frame);
+	return ret;
+}
+
+static struct vfs_fn_pointers vfs_io_uring_fns = {
+	.aio_read_fn = io_uring_aio_read,
+	.aio_write_fn = io_uring_aio_write,
+	.aio_return_fn = io_uring_return_fn,
+	.aio_cancel_fn = io_uring_cancel,
+	.aio_error_fn = io_uring_error_fn,
+	.aio_suspend_fn = io_uring_suspend,
+};
+
+NTSTATUS vfs_io_uring_init(void);
+NTSTATUS vfs_io_uring_init(void)
+{
+	return smb_register_vfs(SMB_VFS_INTERFACE_VERSION,
+				"io_uring", &vfs_io_uring_fns);
+}
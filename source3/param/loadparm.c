@@ -2097,6 +2097,15 @@ static struct parm_struct parm_table[] = {
 		.enum_list	= NULL,
 		.flags		= FLAG_ADVANCED | FLAG_GLOBAL,
 	},
+	{
+		.label		= "messaging sockets",
+		.type		= P_BOOL,
+		.p_class	= P_GLOBAL,
+		.offset		= GLOBAL_VAR(bMessagingSockets),
+		.special	= NULL,
+		.enum_list	= NULL,
+		.flags		= FLAG_ADVANCED | FLAG_GLOBAL,
+	},
 	{
 		.label		= "ctdb timeout",
 		.type		= P_INTEGER,
@@ -2151,6 +2160,15 @@ static struct parm_struct parm_table[] = {
 		.enum_list	= NULL,
 		.flags		= FLAG_ADVANCED,
 	},
+	{
+		.label		= "smb2 worker threads",
+		.type		= P_INTEGER,
+		.p_class	= P_GLOBAL,
+		.offset		= GLOBAL_VAR(ismb2_worker_threads),
+		.special	= NULL,
+		.enum_list	= NULL,
+		.flags		= FLAG_ADVANCED,
+	},
 
 	{N_("Printing Options"), P_SEP, P_SEPARATOR},
 
@@ -2691,6 +2709,33 @@ static struct parm_struct parm_table[] = {
 		.enum_list	= NULL,
 		.flags		= FLAG_ADVANCED,
 	},
+	{
+		.label		= "stat cache shared",
+		.type		= P_BOOL,
+		.p_class	= P_GLOBAL,
+		.offset		= GLOBAL_VAR(bStatCacheShared),
+		.special	= NULL,
+		.enum_list	= NULL,
+		.flags		= FLAG_ADVANCED,
+	},
+	{
+		.label		= "name index",
+		.type		= P_BOOL,
+		.p_class	= P_GLOBAL,
+		.offset		= GLOBAL_VAR(bNameIndex),
+		.special	= NULL,
+		.enum_list	= NULL,
+		.flags		= FLAG_ADVANCED,
+	},
+	{
+		.label		= "directory stat cache",
+		.type		= P_BOOL,
+		.p_class	= P_GLOBAL,
+		.offset		= GLOBAL_VAR(bDirStatCache),
+		.special	= NULL,
+		.enum_list	= NULL,
+		.flags		= FLAG_ADVANCED,
+	},
 	{
 		.label		= "store dos attributes",
 		.type		= P_BOOL,
@@ -4801,6 +4846,9 @@ static void init_globals(bool reinit_globals)
 	Globals.bNTPipeSupport = true;	/* Do NT pipes by default. */
 	Globals.bNTStatusSupport = true; /* Use NT status by default. */
 	Globals.bStatCache = true;	/* use stat cache by default */
+	Globals.bNameIndex = false;
+	Globals.bStatCacheShared = false;
+	Globals.bDirStatCache = false;
 	Globals.iMaxStatCacheSize = 256; /* 256k by default */
 	Globals.restrict_anonymous = 0;
 	Globals.bClientLanManAuth = false;	/* Do NOT use the LanMan hash if it is available */
@@ -4899,6 +4947,7 @@ static void init_globals(bool reinit_globals)
 	string_set(&Globals.ctdbdSocket, "");
 	Globals.szClusterAddresses = NULL;
 	Globals.clustering = false;
+	Globals.bMessagingSockets = true;
 	Globals.ctdb_timeout = 0;
 	Globals.ctdb_locktime_warn_threshold = 0;
 
@@ -4962,6 +5011,7 @@ static void init_globals(bool reinit_globals)
 	Globals.ismb2_max_write = DEFAULT_SMB2_MAX_WRITE;
 	Globals.ismb2_max_trans = DEFAULT_SMB2_MAX_TRANSACT;
 	Globals.ismb2_max_credits = DEFAULT_SMB2_MAX_CREDITS;
+	Globals.ismb2_worker_threads = 0;
 
 	string_set(&Globals.ncalrpc_dir, get_dyn_NCALRPCDIR());
 
@@ -5241,6 +5291,9 @@ FN_GLOBAL_INTEGER(lp_passwd_chat_timeout, iPasswdChatTimeout)
 FN_GLOBAL_BOOL(lp_nt_pipe_support, bNTPipeSupport)
 FN_GLOBAL_BOOL(lp_nt_status_support, bNTStatusSupport)
 FN_GLOBAL_BOOL(lp_stat_cache, bStatCache)
+FN_GLOBAL_BOOL(lp_name_index, bNameIndex)
+FN_GLOBAL_BOOL(lp_stat_cache_shared, bStatCacheShared)
+FN_GLOBAL_BOOL(lp_dir_stat_cache, bDirStatCache)
 FN_GLOBAL_INTEGER(lp_max_stat_cache_size, iMaxStatCacheSize)
 FN_GLOBAL_BOOL(lp_allow_trusted_domains, bAllowTrustedDomains)
 FN_GLOBAL_BOOL(lp_map_untrusted_to_domain, bMapUntrustedToDomain)
@@ -5319,6 +5372,7 @@ int lp_smb2_max_credits(void)
 	}
 	return Globals.ismb2_max_credits;
 }
+FN_GLOBAL_INTEGER(lp_smb2_worker_threads, ismb2_worker_threads)
 FN_GLOBAL_LIST(lp_svcctl_list, szServicesList)
 FN_GLOBAL_STRING(lp_cups_server, szCupsServer)
 int lp_cups_encrypt(void)
@@ -5344,6 +5398,7 @@ FN_GLOBAL_INTEGER(lp_cups_connection_timeout, cups_connection_timeout)
 FN_GLOBAL_CONST_STRING(lp_ctdbd_socket, ctdbdSocket)
 FN_GLOBAL_LIST(lp_cluster_addresses, szClusterAddresses)
 FN_GLOBAL_BOOL(lp_clustering, clustering)
+FN_GLOBAL_BOOL(lp_messaging_sockets, bMessagingSockets)
 FN_GLOBAL_INTEGER(lp_ctdb_timeout, ctdb_timeout)
 FN_GLOBAL_INTEGER(lp_ctdb_locktime_warn_threshold, ctdb_locktime_warn_threshold)
 FN_GLOBAL_BOOL(lp_async_smb_echo_handler, bAsyncSMBEchoHandler)
@@ -23,6 +23,7 @@
 #include "../librpc/gen_ndr/ndr_spoolss_c.h"
 #include "rpc_server/rpc_ncacn_np.h"
 #include "smbd/globals.h"
+#include "smbd/proto.h"
 #include "../libcli/security/security.h"
 
 void print_spool_terminate(struct connection_struct *conn,
@@ -188,7 +189,8 @@ NTSTATUS print_spool_open(files_struct *fsp,
 		goto done;
 	}
 
-	fsp->file_id = vfs_file_id_from_sbuf(fsp->conn, &fsp->fsp_name->st);
+	fsp_set_file_id(fsp, vfs_file_id_from_sbuf(fsp->conn,
+						   &fsp->fsp_name->st));
 	fsp->mode = fsp->fsp_name->st.st_ex_mode;
 	fsp->fh->fd = fd;
 
@@ -1136,7 +1136,7 @@ static bool smbd_dirptr_8_3_mode_fn(TALLOC_CTX *ctx,
 	connection_struct *conn = (connection_struct *)private_data;
 
 	if (!VALID_STAT(smb_fname->st)) {
-		if ((SMB_VFS_STAT(conn, smb_fname)) != 0) {
+		if ((dir_stat_cache_stat(conn, smb_fname)) != 0) {
 			DEBUG(5,("smbd_dirptr_8_3_mode_fn: "
 				 "Couldn't stat [%s]. Error "
 			         "= %s\n",
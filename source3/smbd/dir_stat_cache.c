@@ -0,0 +1,941 @@
+/*
+   Unix SMB/CIFS implementation.
+   Cache of stat information for directory listings
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * A directory listing has to stat every entry it returns. Clients
+ * tend to list the same directory over and over again, so for large
+ * directories we remember the stat information per name.
+ *
+ * As with the name index, a cache is only kept while the kernel
+ * watches the directory, here for name, attribute and write changes.
+ * All caches of a process share the inotify instance of the name
+ * index. Any event for a name drops its entry, the next listing stats
+ * it again. Before the first cached entry of a request is used, all
+ * events the kernel has queued are delivered, so changes other
+ * processes finished before the request came in are always seen. Our
+ * own changes come in through notify_fname(). Files we have open
+ * ourselves are always stat'ed, we might be writing to them.
+ * Subdirectories are not cached at all. Other cluster nodes don't
+ * show up in inotify, so there is no cache with clustering.
+ *
+ * A directory is only cached once a listing has stat'ed
+ * DIR_STAT_CACHE_MIN_ENTRIES names in it. Until then it sits on the
+ * list as a candidate without a watch or entries.
+ *
+ * Once watched, the cache is filled in one go. Processes share the
+ * result in dirstatcache.tdb, one record per directory stamped with
+ * the (monotonic) time its stats started. A process only takes over
+ * a record that started after its own watch was added and after the
+ * last change it saw, so every change the record might have missed
+ * shows up in its own watch. Whoever sees a change deletes the
+ * record. Without a usable record, on shares where opendir, readdir
+ * and stat end up in the default VFS module, the names are read
+ * directly and stat'ed in parallel on a pthreadpool, and the result
+ * is published. Otherwise the entries are stat'ed one by one through
+ * SMB_VFS_STAT() as the listings come along.
+ */
+
+#include "includes.h"
+#include "system/filesys.h"
+#include "smbd/smbd.h"
+#include "smbd/globals.h"
+#include "../librpc/gen_ndr/notify.h"
+#include "../lib/util/rbtree.h"
+#include "tdb_compat.h"
+#include "util_tdb.h"
+#include "dbwrap/dbwrap.h"
+#include "dbwrap/dbwrap_tdb.h"
+#if WITH_PTHREADPOOL
+#include "lib/pthreadpool/pthreadpool.h"
+#endif
+
+#define DIR_STAT_CACHE_MIN_ENTRIES 1000
+
+/*
+ * Number of directories a process keeps, each cached one needs a
+ * kernel watch.
+ */
+#define DIR_STAT_CACHE_MAX_DIRS 16
+
+/*
+ * Upper limit for the number of names per directory, at roughly 200
+ * bytes per entry.
+ */
+#define DIR_STAT_CACHE_MAX_ENTRIES 500000
+
+/*
+ * Directories with more names than this are not published in
+ * dirstatcache.tdb
+ */
+#define DIR_STAT_CACHE_MAX_SHARED 100000
+
+/*
+ * Names per stat job and parallel jobs when filling a cache
+ */
+#define DIR_STAT_CACHE_JOB_SIZE 512
+#define DIR_STAT_CACHE_THREADS 8
+
+struct dir_stat_cache_entry {
+	struct rb_node rb_node;
+	SMB_STRUCT_STAT st;
+	size_t namelength;
+	char name[1];
+};
+
+struct dir_stat_cache {
+	struct dir_stat_cache *prev, *next;
+	connection_struct *conn;
+	char *dirpath;
+	/* absolute, key in dirstatcache.tdb */
+	char *abspath;
+	struct rb_root tree;
+	size_t num_entries;
+	/* stats seen while we are a candidate */
+	size_t num_misses;
+	void *watch;
+	bool unwatchable;
+	/* set from the notify callback, can't free ourselves there */
+	bool stale;
+	/* tried to fill the cache in one go */
+	bool filled;
+	/* when the watch was added and when we last saw a change */
+	struct timespec watch_time;
+	struct timespec change_time;
+};
+
+/*
+ * A record in dirstatcache.tdb is this header followed by
+ * num_entries times a uint32_t name length, the SMB_STRUCT_STAT and
+ * the 0-terminated name.
+ */
+struct dir_stat_cache_shared_hdr {
+	struct timespec start;
+	uint32_t num_entries;
+};
+
+static struct dir_stat_cache *dir_stat_caches;
+static unsigned int num_dir_stat_caches;
+static struct db_context *dir_stat_cache_db;
+
+/* sconn->num_requests when we last delivered the queued events */
+static uint64_t dir_stat_cache_drained = UINT64_MAX;
+
+bool dir_stat_cache_parent_init(TALLOC_CTX *mem_ctx)
+{
+	if (!lp_dir_stat_cache() || lp_clustering()) {
+		return true;
+	}
+
+	/*
+	 * Opened in the parent like statcache.tdb, the children
+	 * inherit it
+	 */
+	dir_stat_cache_db = db_open_tdb(mem_ctx, lock_path("dirstatcache.tdb"),
+					0,
+					TDB_DEFAULT|TDB_CLEAR_IF_FIRST|
+					TDB_INCOMPATIBLE_HASH|TDB_NOSYNC,
+					O_RDWR|O_CREAT, 0644);
+	if (dir_stat_cache_db == NULL) {
+		DEBUG(0, ("could not open dirstatcache.tdb: %s, not sharing "
+			  "directory stat caches\n", strerror(errno)));
+	}
+	return true;
+}
+
+static struct dir_stat_cache_entry *dir_stat_cache_node2entry(
+	struct rb_node *node)
+{
+	return (struct dir_stat_cache_entry *)
+		((char *)node - offsetof(struct dir_stat_cache_entry,
+					 rb_node));
+}
+
+static int dir_stat_cache_compare(struct dir_stat_cache_entry *e,
+				  const char *name, size_t namelength)
+{
+	if (e->namelength < namelength) return 1;
+	if (e->namelength > namelength) return -1;
+	return memcmp(e->name, name, namelength);
+}
+
+static struct dir_stat_cache_entry *dir_stat_cache_find(
+	struct dir_stat_cache *c, const char *name)
+{
+	size_t namelength = strlen(name);
+	struct rb_node *node = c->tree.rb_node;
+
+	while (node != NULL) {
+		struct dir_stat_cache_entry *e =
+			dir_stat_cache_node2entry(node);
+		int cmp;
+
+		cmp = dir_stat_cache_compare(e, name, namelength);
+		if (cmp == 0) {
+			return e;
+		}
+		node = (cmp < 0) ? node->rb_left : node->rb_right;
+	}
+	return NULL;
+}
+
+static void dir_stat_cache_store(struct dir_stat_cache *c, const char *name,
+				 const SMB_STRUCT_STAT *st)
+{
+	struct dir_stat_cache_entry *e;
+	struct rb_node **p, *parent;
+	size_t namelength = strlen(name);
+
+	parent = NULL;
+	p = &c->tree.rb_node;
+
+	while (*p) {
+		struct dir_stat_cache_entry *elem =
+			dir_stat_cache_node2entry(*p);
+		int cmp;
+
+		parent = (*p);
+
+		cmp = dir_stat_cache_compare(elem, name, namelength);
+		if (cmp == 0) {
+			elem->st = *st;
+			return;
+		}
+
+		p = (cmp < 0) ? &(*p)->rb_left : &(*p)->rb_right;
+	}
+
+	if (c->num_entries >= DIR_STAT_CACHE_MAX_ENTRIES) {
+		return;
+	}
+
+	e = (struct dir_stat_cache_entry *)SMB_MALLOC(
+		sizeof(struct dir_stat_cache_entry) + namelength);
+	if (e == NULL) {
+		return;
+	}
+	e->st = *st;
+	e->namelength = namelength;
+	memcpy(e->name, name, namelength + 1);
+
+	rb_link_node(&e->rb_node, parent, p);
+	rb_insert_color(&e->rb_node, &c->tree);
+	c->num_entries += 1;
+}
+
+static void dir_stat_cache_remove(struct dir_stat_cache *c, const char *name)
+{
+	struct dir_stat_cache_entry *e;
+
+	e = dir_stat_cache_find(c, name);
+	if (e == NULL) {
+		return;
+	}
+	rb_erase(&e->rb_node, &c->tree);
+	SAFE_FREE(e);
+	c->num_entries -= 1;
+}
+
+static void dir_stat_cache_free_tree(struct rb_node *node)
+{
+	if (node == NULL) {
+		return;
+	}
+	dir_stat_cache_free_tree(node->rb_left);
+	dir_stat_cache_free_tree(node->rb_right);
+	SAFE_FREE(node);
+}
+
+static int dir_stat_cache_destructor(struct dir_stat_cache *c)
+{
+	DLIST_REMOVE(dir_stat_caches, c);
+	num_dir_stat_caches -= 1;
+	/* rb_node is the first member of dir_stat_cache_entry */
+	dir_stat_cache_free_tree(c->tree.rb_node);
+	c->tree.rb_node = NULL;
+	return 0;
+}
+
+/*
+ * Something in the directory changed: remember when, and stop others
+ * from taking over the published stats
+ */
+
+static void dir_stat_cache_changed(struct dir_stat_cache *c)
+{
+	clock_gettime_mono(&c->change_time);
+	if ((dir_stat_cache_db != NULL) && (c->abspath != NULL)) {
+		dbwrap_delete(dir_stat_cache_db,
+			      string_term_tdb_data(c->abspath));
+	}
+}
+
+static void dir_stat_cache_notify_cb(struct sys_notify_context *ctx,
+				     void *private_data,
+				     struct notify_event *ev)
+{
+	struct dir_stat_cache *c = talloc_get_type_abort(
+		private_data, struct dir_stat_cache);
+
+	DEBUG(10, ("dir_stat_cache_notify_cb: %s action %u name %s\n",
+		   c->dirpath, (unsigned)ev->action, ev->path));
+
+	dir_stat_cache_changed(c);
+
+	if (c->stale) {
+		return;
+	}
+	if ((ev->path == NULL) || (ev->path[0] == '\0') ||
+	    (strchr(ev->path, '/') != NULL)) {
+		/*
+		 * Don't know what changed. Freeing the cache would
+		 * free the watch we are called from,
+		 * dir_stat_cache_get() drops it
+		 */
+		dir_stat_cache_free_tree(c->tree.rb_node);
+		c->tree.rb_node = NULL;
+		c->num_entries = 0;
+		c->stale = true;
+		return;
+	}
+	dir_stat_cache_remove(c, ev->path);
+}
+
+static struct dir_stat_cache *dir_stat_cache_get(connection_struct *conn,
+						 const char *dirpath,
+						 size_t dirlen)
+{
+	struct dir_stat_cache *c;
+
+	for (c = dir_stat_caches; c != NULL; c = c->next) {
+		if ((c->conn == conn) &&
+		    (strlen(c->dirpath) == dirlen) &&
+		    (memcmp(c->dirpath, dirpath, dirlen) == 0)) {
+			break;
+		}
+	}
+	if (c == NULL) {
+		return NULL;
+	}
+	if (c->stale) {
+		DEBUG(10, ("dir_stat_cache_get: dropping %s\n", c->dirpath));
+		TALLOC_FREE(c);
+		return NULL;
+	}
+	DLIST_PROMOTE(dir_stat_caches, c);
+	return c;
+}
+
+static struct dir_stat_cache *dir_stat_cache_new(connection_struct *conn,
+						 const char *dirpath,
+						 size_t dirlen)
+{
+	struct dir_stat_cache *c, *victim;
+
+	if (num_dir_stat_caches >= DIR_STAT_CACHE_MAX_DIRS) {
+		/*
+		 * Prefer to replace a candidate, a client walking a
+		 * tree of small directories should not push out the
+		 * large one it keeps coming back to
+		 */
+		for (victim = DLIST_TAIL(dir_stat_caches); victim != NULL;
+		     victim = DLIST_PREV(victim)) {
+			if ((victim->watch == NULL) && !victim->unwatchable) {
+				break;
+			}
+		}
+		if (victim == NULL) {
+			victim = DLIST_TAIL(dir_stat_caches);
+		}
+		TALLOC_FREE(victim);
+	}
+
+	c = talloc_zero(conn, struct dir_stat_cache);
+	if (c == NULL) {
+		return NULL;
+	}
+	c->conn = conn;
+	c->tree = RB_ROOT;
+	c->dirpath = talloc_strndup(c, dirpath, dirlen);
+	if (c->dirpath == NULL) {
+		TALLOC_FREE(c);
+		return NULL;
+	}
+
+	DLIST_ADD(dir_stat_caches, c);
+	num_dir_stat_caches += 1;
+	talloc_set_destructor(c, dir_stat_cache_destructor);
+
+	return c;
+}
+
+/*
+ * Ask the VFS to tell us about all changes that show up in a
+ * listing.
+ */
+
+static bool dir_stat_cache_watch(struct dir_stat_cache *c)
+{
+	struct sys_notify_context *ctx;
+	struct notify_entry e;
+	NTSTATUS status;
+	uint32_t filter = FILE_NOTIFY_CHANGE_FILE_NAME|
+			  FILE_NOTIFY_CHANGE_DIR_NAME|
+			  FILE_NOTIFY_CHANGE_ATTRIBUTES|
+			  FILE_NOTIFY_CHANGE_LAST_WRITE|
+			  FILE_NOTIFY_CHANGE_SECURITY;
+
+	ctx = smbd_cache_notify_context(c->conn);
+	if (ctx == NULL) {
+		return false;
+	}
+
+	if (ISDOT(c->dirpath)) {
+		c->abspath = talloc_strdup(c, c->conn->connectpath);
+	} else if (c->dirpath[0] == '/') {
+		c->abspath = talloc_strdup(c, c->dirpath);
+	} else {
+		c->abspath = talloc_asprintf(c, "%s/%s",
+					     c->conn->connectpath, c->dirpath);
+	}
+	if (c->abspath == NULL) {
+		return false;
+	}
+
+	ZERO_STRUCT(e);
+	e.filter = filter;
+	e.subdir_filter = 0;
+	e.path = c->abspath;
+
+	status = sys_notify_watch(ctx, &e, dir_stat_cache_notify_cb, c,
+				  &c->watch);
+	if (!NT_STATUS_IS_OK(status) || (c->watch == NULL) ||
+	    ((e.filter & filter) != 0)) {
+		DEBUG(10, ("dir_stat_cache_watch: can't watch %s: %s\n",
+			   c->abspath, nt_errstr(status)));
+		TALLOC_FREE(c->watch);
+		return false;
+	}
+	talloc_steal(c, c->watch);
+	clock_gettime_mono(&c->watch_time);
+	return true;
+}
+
+/*
+ * Take over the stats another process published, if they started
+ * after anything we could have missed.
+ */
+
+struct dir_stat_cache_load_state {
+	struct dir_stat_cache *c;
+	bool loaded;
+};
+
+static void dir_stat_cache_load_fn(TDB_DATA key, TDB_DATA data,
+				   void *private_data)
+{
+	struct dir_stat_cache_load_state *state =
+		(struct dir_stat_cache_load_state *)private_data;
+	struct dir_stat_cache *c = state->c;
+	struct dir_stat_cache_shared_hdr hdr;
+	const uint8_t *p, *end;
+	uint32_t i;
+
+	if (data.dsize < sizeof(hdr)) {
+		return;
+	}
+	memcpy(&hdr, data.dptr, sizeof(hdr));
+
+	if ((timespec_compare(&hdr.start, &c->watch_time) <= 0) ||
+	    (timespec_compare(&hdr.start, &c->change_time) <= 0)) {
+		DEBUG(10, ("dir_stat_cache_load_fn: %s too old\n",
+			   c->abspath));
+		return;
+	}
+
+	p = data.dptr + sizeof(hdr);
+	end = data.dptr + data.dsize;
+
+	for (i = 0; i < hdr.num_entries; i++) {
+		SMB_STRUCT_STAT st;
+		uint32_t namelength;
+
+		if (PTR_DIFF(end, p) < sizeof(namelength) + sizeof(st)) {
+			break;
+		}
+		memcpy(&namelength, p, sizeof(namelength));
+		p += sizeof(namelength);
+		memcpy(&st, p, sizeof(st));
+		p += sizeof(st);
+		if ((PTR_DIFF(end, p) <= namelength) ||
+		    (p[namelength] != '\0')) {
+			break;
+		}
+		dir_stat_cache_store(c, (const char *)p, &st);
+		p += namelength + 1;
+	}
+	state->loaded = true;
+}
+
+static bool dir_stat_cache_load(struct dir_stat_cache *c)
+{
+	struct dir_stat_cache_load_state state;
+	struct smb_filename *smb_fname = NULL;
+	char *path;
+	NTSTATUS status;
+	int ret;
+
+	if (dir_stat_cache_db == NULL) {
+		return false;
+	}
+
+	/*
+	 * The record may come from another user. Only take it if we
+	 * could stat the entries ourselves, "dir/." needs the same
+	 * search permission.
+	 */
+	path = talloc_asprintf(talloc_tos(), "%s/.", c->dirpath);
+	if (path == NULL) {
+		return false;
+	}
+	status = create_synthetic_smb_fname(talloc_tos(), path, NULL, NULL,
+					    &smb_fname);
+	TALLOC_FREE(path);
+	if (!NT_STATUS_IS_OK(status)) {
+		return false;
+	}
+	ret = SMB_VFS_STAT(c->conn, smb_fname);
+	TALLOC_FREE(smb_fname);
+	if (ret != 0) {
+		return false;
+	}
+
+	state.c = c;
+	state.loaded = false;
+
+	status = dbwrap_parse_record(dir_stat_cache_db,
+				     string_term_tdb_data(c->abspath),
+				     dir_stat_cache_load_fn, &state);
+	if (!NT_STATUS_IS_OK(status)) {
+		return false;
+	}
+	return state.loaded;
+}
+
+/*
+ * Publish the stats of a fill that started at "start"
+ */
+
+static void dir_stat_cache_publish(struct dir_stat_cache *c,
+				   const struct timespec *start,
+				   char **names, SMB_STRUCT_STAT *sts,
+				   int *rets, size_t num_names)
+{
+	struct dir_stat_cache_shared_hdr hdr;
+	size_t i, len;
+	uint8_t *buf, *p;
+
+	if ((dir_stat_cache_db == NULL) ||
+	    (num_names > DIR_STAT_CACHE_MAX_SHARED)) {
+		return;
+	}
+
+	ZERO_STRUCT(hdr);
+	hdr.start = *start;
+
+	len = sizeof(hdr);
+	for (i = 0; i < num_names; i++) {
+		if ((rets[i] != 0) || S_ISDIR(sts[i].st_ex_mode)) {
+			continue;
+		}
+		len += sizeof(uint32_t) + sizeof(SMB_STRUCT_STAT) +
+			strlen(names[i]) + 1;
+		hdr.num_entries += 1;
+	}
+
+	buf = talloc_array(talloc_tos(), uint8_t, len);
+	if (buf == NULL) {
+		return;
+	}
+	memcpy(buf, &hdr, sizeof(hdr));
+	p = buf + sizeof(hdr);
+
+	for (i = 0; i < num_names; i++) {
+		uint32_t namelength;
+
+		if ((rets[i] != 0) || S_ISDIR(sts[i].st_ex_mode)) {
+			continue;
+		}
+		namelength = strlen(names[i]);
+		memcpy(p, &namelength, sizeof(namelength));
+		p += sizeof(namelength);
+		memcpy(p, &sts[i], sizeof(SMB_STRUCT_STAT));
+		p += sizeof(SMB_STRUCT_STAT);
+		memcpy(p, names[i], namelength + 1);
+		p += namelength + 1;
+	}
+
+	dbwrap_store(dir_stat_cache_db, string_term_tdb_data(c->abspath),
+		     make_tdb_data(buf, len), TDB_REPLACE);
+	TALLOC_FREE(buf);
+}
+
+/*
+ * A chunk of names to stat, relative to the share root we are
+ * chdir'ed into. The main thread waits for all jobs, so the
+ * directory does not change under the helper threads.
+ */
+
+struct dir_stat_cache_job {
+	char **paths;
+	SMB_STRUCT_STAT *sts;
+	int *rets;
+	size_t num;
+	bool fake_dir_create_times;
+};
+
+static void dir_stat_cache_job_fn(void *private_data)
+{
+	struct dir_stat_cache_job *job =
+		(struct dir_stat_cache_job *)private_data;
+	size_t i;
+
+	for (i = 0; i < job->num; i++) {
+		job->rets[i] = sys_stat(job->paths[i], &job->sts[i],
+					job->fake_dir_create_times);
+	}
+}
+
+#if WITH_PTHREADPOOL
+static struct pthreadpool *dir_stat_cache_pool;
+#endif
+
+static void dir_stat_cache_run_jobs(struct dir_stat_cache_job *jobs,
+				    size_t num_jobs)
+{
+	size_t i;
+#if WITH_PTHREADPOOL
+	size_t running = 0;
+	int ret;
+
+	if (dir_stat_cache_pool == NULL) {
+		ret = pthreadpool_init(DIR_STAT_CACHE_THREADS,
+				       &dir_stat_cache_pool);
+		if (ret != 0) {
+			DEBUG(10, ("pthreadpool_init failed: %s\n",
+				   strerror(ret)));
+			dir_stat_cache_pool = NULL;
+		}
+	}
+
+	for (i = 0; i < num_jobs; i++) {
+		if ((dir_stat_cache_pool != NULL) &&
+		    (pthreadpool_add_job(dir_stat_cache_pool, i,
+					 dir_stat_cache_job_fn,
+					 &jobs[i]) == 0)) {
+			running += 1;
+			continue;
+		}
+		dir_stat_cache_job_fn(&jobs[i]);
+	}
+
+	while (running > 0) {
+		int job_id;
+
+		ret = pthreadpool_finished_job(dir_stat_cache_pool, &job_id);
+		if (ret != 0) {
+			/* the threads still write into jobs */
+			smb_panic("dir_stat_cache_run_jobs: "
+				  "pthreadpool_finished_job failed");
+		}
+		running -= 1;
+	}
+#else
+	for (i = 0; i < num_jobs; i++) {
+		dir_stat_cache_job_fn(&jobs[i]);
+	}
+#endif
+}
+
+/*
+ * Read all names of the directory and stat them in parallel, behind
+ * the VFS' back. Only for shares where the VFS would do just that.
+ */
+
+static void dir_stat_cache_batch(struct dir_stat_cache *c)
+{
+	TALLOC_CTX *frame = talloc_stackframe();
+	struct dir_stat_cache_job *jobs;
+	struct timespec start;
+	char **names = NULL;
+	char **paths;
+	SMB_STRUCT_STAT *sts;
+	int *rets;
+	size_t i, num_names = 0, num_jobs;
+	bool fake_dir_create_times;
+	struct dirent *de;
+	DIR *d;
+
+	clock_gettime_mono(&start);
+
+	d = opendir(c->dirpath);
+	if (d == NULL) {
+		goto done;
+	}
+	while ((de = readdir(d)) != NULL) {
+		if (ISDOT(de->d_name) || ISDOTDOT(de->d_name)) {
+			continue;
+		}
+		if (num_names >= DIR_STAT_CACHE_MAX_ENTRIES) {
+			break;
+		}
+		if ((num_names % 1024) == 0) {
+			names = talloc_realloc(frame, names, char *,
+					       num_names + 1024);
+			if (names == NULL) {
+				break;
+			}
+		}
+		names[num_names] = talloc_strdup(names, de->d_name);
+		if (names[num_names] == NULL) {
+			break;
+		}
+		num_names += 1;
+	}
+	closedir(d);
+
+	if ((names == NULL) || (num_names == 0)) {
+		goto done;
+	}
+
+	paths = talloc_array(frame, char *, num_names);
+	sts = talloc_zero_array(frame, SMB_STRUCT_STAT, num_names);
+	rets = talloc_array(frame, int, num_names);
+	num_jobs = (num_names + DIR_STAT_CACHE_JOB_SIZE - 1) /
+		DIR_STAT_CACHE_JOB_SIZE;
+	jobs = talloc_zero_array(frame, struct dir_stat_cache_job, num_jobs);
+	if ((paths == NULL) || (sts == NULL) || (rets == NULL) ||
+	    (jobs == NULL)) {
+		goto done;
+	}
+
+	for (i = 0; i < num_names; i++) {
+		paths[i] = talloc_asprintf(paths, "%s/%s", c->dirpath,
+					   names[i]);
+		if (paths[i] == NULL) {
+			goto done;
+		}
+	}
+
+	fake_dir_create_times = lp_fake_dir_create_times(SNUM(c->conn));
+
+	for (i = 0; i < num_jobs; i++) {
+		size_t ofs = i * DIR_STAT_CACHE_JOB_SIZE;
+
+		jobs[i].paths = &paths[ofs];
+		jobs[i].sts = &sts[ofs];
+		jobs[i].rets = &rets[ofs];
+		jobs[i].num = MIN(DIR_STAT_CACHE_JOB_SIZE, num_names - ofs);
+		jobs[i].fake_dir_create_times = fake_dir_create_times;
+	}
+
+	dir_stat_cache_run_jobs(jobs, num_jobs);
+
+	for (i = 0; i < num_names; i++) {
+		if ((rets[i] != 0) || S_ISDIR(sts[i].st_ex_mode)) {
+			continue;
+		}
+		dir_stat_cache_store(c, names[i], &sts[i]);
+	}
+
+	DEBUG(10, ("dir_stat_cache_batch: %s: stat'ed %u names\n",
+		   c->dirpath, (unsigned)num_names));
+
+	if (num_names < DIR_STAT_CACHE_MAX_ENTRIES) {
+		dir_stat_cache_publish(c, &start, names, sts, rets,
+				       num_names);
+	}
+done:
+	TALLOC_FREE(frame);
+}
+
+/*
+ * Fill a freshly watched cache in one go, if we can
+ */
+
+static void dir_stat_cache_fill(struct dir_stat_cache *c)
+{
+	c->filled = true;
+
+	if (dir_stat_cache_load(c)) {
+		DEBUG(10, ("dir_stat_cache_fill: took over %s\n",
+			   c->abspath));
+		return;
+	}
+	if (vfs_plain_dir_stat(c->conn)) {
+		dir_stat_cache_batch(c);
+	}
+}
+
+/*
+ * Deliver what others changed since the event loop last looked. Done
+ * once per request, entries changed while a request is running may
+ * be listed with the information from before the change, just as if
+ * the listing had stat'ed them earlier.
+ */
+
+static bool dir_stat_cache_drain(connection_struct *conn)
+{
+	if (dir_stat_cache_drained == conn->sconn->num_requests) {
+		return true;
+	}
+	if (!sys_notify_drain(smbd_cache_notify_context(conn))) {
+		return false;
+	}
+	dir_stat_cache_drained = conn->sconn->num_requests;
+	return true;
+}
+
+/*
+ * Stat a directory entry during a listing, like SMB_VFS_STAT().
+ */
+
+int dir_stat_cache_stat(connection_struct *conn, struct smb_filename *smb_fname)
+{
+	struct dir_stat_cache *c;
+	struct dir_stat_cache_entry *e;
+	const char *name;
+	size_t dirlen;
+	bool cacheable;
+	int ret;
+
+	if (!lp_dir_stat_cache() || lp_clustering() ||
+	    (smb_fname->stream_name != NULL)) {
+		return SMB_VFS_STAT(conn, smb_fname);
+	}
+
+	name = strrchr_m(smb_fname->base_name, '/');
+	if ((name == NULL) || (name == smb_fname->base_name) ||
+	    ISDOT(name + 1) || ISDOTDOT(name + 1)) {
+		return SMB_VFS_STAT(conn, smb_fname);
+	}
+	dirlen = name - smb_fname->base_name;
+	name += 1;
+
+	c = dir_stat_cache_get(conn, smb_fname->base_name, dirlen);
+	if ((c != NULL) && c->unwatchable) {
+		return SMB_VFS_STAT(conn, smb_fname);
+	}
+
+	if ((c != NULL) && (c->watch != NULL)) {
+		if (!dir_stat_cache_drain(conn)) {
+			/* We can't trust the entries, don't watch again */
+			dir_stat_cache_free_tree(c->tree.rb_node);
+			c->tree.rb_node = NULL;
+			c->num_entries = 0;
+			TALLOC_FREE(c->watch);
+			c->unwatchable = true;
+			return SMB_VFS_STAT(conn, smb_fname);
+		}
+		if (c->stale) {
+			TALLOC_FREE(c);
+			return SMB_VFS_STAT(conn, smb_fname);
+		}
+		if (!c->filled) {
+			dir_stat_cache_fill(c);
+		}
+		e = dir_stat_cache_find(c, name);
+		if (e != NULL) {
+			struct file_id id;
+
+			id = vfs_file_id_from_sbuf(conn, &e->st);
+			if (file_find_di_first(conn->sconn, id) == NULL) {
+				smb_fname->st = e->st;
+				return 0;
+			}
+			dir_stat_cache_remove(c, name);
+		}
+	}
+
+	ret = SMB_VFS_STAT(conn, smb_fname);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (c == NULL) {
+		c = dir_stat_cache_new(conn, smb_fname->base_name, dirlen);
+		if (c == NULL) {
+			return ret;
+		}
+	}
+
+	if (c->watch == NULL) {
+		c->num_misses += 1;
+		if (c->num_misses < DIR_STAT_CACHE_MIN_ENTRIES) {
+			return ret;
+		}
+		if (!dir_stat_cache_watch(c)) {
+			/* Remember not to try this directory again */
+			c->unwatchable = true;
+			return ret;
+		}
+		DEBUG(10, ("dir_stat_cache_stat: caching %s\n", c->dirpath));
+		/*
+		 * We stat'ed this one before the watch was there, a
+		 * change in between would go unnoticed
+		 */
+		return ret;
+	}
+
+	/*
+	 * Changes inside a subdirectory don't show up in our watch,
+	 * but they change its times
+	 */
+	cacheable = !S_ISDIR(smb_fname->st.st_ex_mode) &&
+		(file_find_di_first(
+			 conn->sconn,
+			 vfs_file_id_from_sbuf(conn, &smb_fname->st))
+		 == NULL);
+	if (cacheable) {
+		dir_stat_cache_store(c, name, &smb_fname->st);
+	}
+	return ret;
+}
+
+/*
+ * Called from notify_fname() for our own changes.
+ */
+
+void dir_stat_cache_update(connection_struct *conn, const char *parent,
+			   const char *name)
+{
+	struct dir_stat_cache *c;
+
+	if (dir_stat_caches == NULL) {
+		return;
+	}
+	if ((parent == NULL) || (*parent == '\0')) {
+		parent = ".";
+	}
+
+	c = dir_stat_cache_get(conn, parent, strlen(parent));
+	if ((c == NULL) || (c->watch == NULL)) {
+		return;
+	}
+	dir_stat_cache_changed(c);
+	dir_stat_cache_remove(c, name);
+}
@@ -433,7 +433,7 @@ NTSTATUS unix_convert(TALLOC_CTX *ctx,
 				goto fail;
 			}
 			/* Add the path (not including the stream) to the cache. */
-			stat_cache_add(orig_path, smb_fname->base_name,
+			stat_cache_add(conn, orig_path, smb_fname->base_name,
 				       conn->case_sensitive);
 			DEBUG(5,("conversion of base_name finished %s -> %s\n",
 				 orig_path, smb_fname->base_name));
@@ -911,7 +911,7 @@ NTSTATUS unix_convert(TALLOC_CTX *ctx,
 		 * or wildcard components as this can change the size.
 		 */
 		if(!component_was_mangled && !name_has_wildcard) {
-			stat_cache_add(orig_path, dirpath,
+			stat_cache_add(conn, orig_path, dirpath,
 					conn->case_sensitive);
 		}
 
@@ -929,7 +929,7 @@ NTSTATUS unix_convert(TALLOC_CTX *ctx,
 	 */
 
 	if(!component_was_mangled && !name_has_wildcard) {
-		stat_cache_add(orig_path, smb_fname->base_name,
+		stat_cache_add(conn, orig_path, smb_fname->base_name,
 			       conn->case_sensitive);
 	}
 
@@ -1091,6 +1091,18 @@ static int get_real_filename_full_scan(connection_struct *conn,
 		}
 	}
 
+	if (!mangled) {
+		int ret;
+
+		/* Large directories may have an index of their names. */
+		ret = name_index_get_real_filename(conn, path, name, mem_ctx,
+						   found_name);
+		if (ret == 0 || (ret == -1 && errno != EOPNOTSUPP)) {
+			TALLOC_FREE(unmangled_name);
+			return ret;
+		}
+	}
+
 	/* open the directory */
 	if (!(cur_dir = OpenDir(talloc_tos(), conn, path, NULL, 0))) {
 		DEBUG(3,("scan dir didn't open dir [%s]\n",path));
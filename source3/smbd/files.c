@@ -23,12 +23,14 @@
 #include "libcli/security/security.h"
 #include "util_tdb.h"
 #include <ccan/hash/hash.h>
-#include "lib/util/bitmap.h"
 
 #define VALID_FNUM(fnum)   (((fnum) >= 0) && ((fnum) < real_max_open_files))
 
 #define FILE_HANDLE_OFFSET 0x1000
 
+/* Initial number of file_id hash chains, grows with the open files */
+#define FILE_ID_HASH_MIN_SIZE 256
+
 /****************************************************************************
  Return a unique number identifying this fsp over the life of this pid.
 ****************************************************************************/
@@ -42,6 +44,109 @@ static unsigned long get_gen_count(struct smbd_server_connection *sconn)
 	return sconn->file_gen_counter;
 }
 
+/****************************************************************************
+ Hash chains of open files by file_id. Every fsp is on a chain from
+ file_new() to file_free(), the ones without a file_id yet on the
+ chain of the zero file_id.
+****************************************************************************/
+
+static unsigned int fsp_id_hash_bucket(struct smbd_server_connection *sconn,
+				       const struct file_id *id)
+{
+	return hash(id, 1, 0) & (sconn->file_id_hash_size - 1);
+}
+
+static void fsp_id_hash_add(files_struct *fsp)
+{
+	struct smbd_server_connection *sconn = fsp->conn->sconn;
+	unsigned int b = fsp_id_hash_bucket(sconn, &fsp->file_id);
+
+	fsp->file_id_next = sconn->file_id_hash[b];
+	sconn->file_id_hash[b] = fsp;
+}
+
+static void fsp_id_hash_remove(files_struct *fsp)
+{
+	struct smbd_server_connection *sconn = fsp->conn->sconn;
+	files_struct **p;
+
+	p = &sconn->file_id_hash[fsp_id_hash_bucket(sconn, &fsp->file_id)];
+
+	while (*p != NULL) {
+		if (*p == fsp) {
+			*p = fsp->file_id_next;
+			fsp->file_id_next = NULL;
+			return;
+		}
+		p = &(*p)->file_id_next;
+	}
+	smb_panic("fsp_id_hash_remove: fsp not hashed");
+}
+
+/****************************************************************************
+ Double the number of hash chains once they get long. Keeps the
+ chain order, file_find_di_next() callers may be walking one.
+****************************************************************************/
+
+static void fsp_id_hash_grow(struct smbd_server_connection *sconn)
+{
+	files_struct **old_hash = sconn->file_id_hash;
+	unsigned int old_size = sconn->file_id_hash_size;
+	files_struct **tails;
+	unsigned int i;
+
+	if (sconn->files_used <= 2 * old_size) {
+		return;
+	}
+
+	sconn->file_id_hash = talloc_zero_array(sconn, files_struct *,
+						old_size * 2);
+	tails = talloc_zero_array(talloc_tos(), files_struct *, old_size * 2);
+	if ((sconn->file_id_hash == NULL) || (tails == NULL)) {
+		/* Just stay with the long chains */
+		TALLOC_FREE(sconn->file_id_hash);
+		TALLOC_FREE(tails);
+		sconn->file_id_hash = old_hash;
+		return;
+	}
+	sconn->file_id_hash_size = old_size * 2;
+
+	for (i=0; i<old_size; i++) {
+		files_struct *fsp, *next;
+
+		for (fsp = old_hash[i]; fsp != NULL; fsp = next) {
+			unsigned int b = fsp_id_hash_bucket(sconn,
+							    &fsp->file_id);
+			next = fsp->file_id_next;
+			fsp->file_id_next = NULL;
+			if (tails[b] == NULL) {
+				sconn->file_id_hash[b] = fsp;
+			} else {
+				tails[b]->file_id_next = fsp;
+			}
+			tails[b] = fsp;
+		}
+	}
+
+	DEBUG(10, ("fsp_id_hash_grow: %u chains for %d files\n",
+		   sconn->file_id_hash_size, sconn->files_used));
+
+	TALLOC_FREE(tails);
+	TALLOC_FREE(old_hash);
+}
+
+/****************************************************************************
+ Set the file_id of an fsp, all changes have to go through here to
+ keep the hash chains right.
+****************************************************************************/
+
+void fsp_set_file_id(files_struct *fsp, struct file_id id)
+{
+	fsp_id_hash_remove(fsp);
+	fsp->file_id = id;
+	fsp_id_hash_add(fsp);
+}
+
 /****************************************************************************
  Find first available file slot.
 ****************************************************************************/
@@ -64,17 +169,6 @@ NTSTATUS file_new(struct smb_request *req, connection_struct *conn,
 		sconn->first_file %= sconn->real_max_open_files;
 	}
 
-	/* TODO: Port the id-tree implementation from Samba4 */
-
-	i = bitmap_find(sconn->file_bmap, sconn->first_file);
-	if (i == -1) {
-		DEBUG(0,("ERROR! Out of file structures\n"));
-		/* TODO: We have to unconditionally return a DOS error here,
-		 * W2k3 even returns ERRDOS/ERRnofids for ntcreate&x with
-		 * NTSTATUS negotiated */
-		return NT_STATUS_TOO_MANY_OPENED_FILES;
-	}
-
 	/*
 	 * Make a child of the connection_struct as an fsp can't exist
 	 * independent of a connection.
@@ -84,6 +178,22 @@ NTSTATUS file_new(struct smb_request *req, connection_struct *conn,
 		return NT_STATUS_NO_MEMORY;
 	}
 
+	i = idr_get_new_above(sconn->file_idtree, fsp, sconn->first_file,
+			      sconn->real_max_open_files - 1);
+	if (i == -1) {
+		/* Wrap around */
+		i = idr_get_new_above(sconn->file_idtree, fsp, 0,
+				      sconn->real_max_open_files - 1);
+	}
+	if (i == -1) {
+		DEBUG(0,("ERROR! Out of file structures\n"));
+		TALLOC_FREE(fsp);
+		/* TODO: We have to unconditionally return a DOS error here,
+		 * W2k3 even returns ERRDOS/ERRnofids for ntcreate&x with
+		 * NTSTATUS negotiated */
+		return NT_STATUS_TOO_MANY_OPENED_FILES;
+	}
+
 	/*
 	 * This can't be a child of fsp because the file_handle can be ref'd
 	 * when doing a dos/fcb open, which will then share the file_handle
@@ -91,6 +201,7 @@ NTSTATUS file_new(struct smb_request *req, connection_struct *conn,
 	 */
 	fsp->fh = talloc_zero(conn, struct fd_handle);
 	if (!fsp->fh) {
+		idr_remove(sconn->file_idtree, i);
 		TALLOC_FREE(fsp);
 		return NT_STATUS_NO_MEMORY;
 	}
@@ -102,14 +213,6 @@ NTSTATUS file_new(struct smb_request *req, connection_struct *conn,
 	fsp->fh->gen_id = get_gen_count(sconn);
 	GetTimeOfDay(&fsp->open_time);
 
-	sconn->first_file = (i+1) % (sconn->real_max_open_files);
-
-	bitmap_set(sconn->file_bmap, i);
-	sconn->files_used += 1;
-
-	fsp->fnum = i + FILE_HANDLE_OFFSET;
-	SMB_ASSERT(fsp->fnum < 65536);
-
 	/*
 	 * Create an smb_filename with "" for the base_name.  There are very
 	 * few NULL checks, so make sure it's initialized with something. to
@@ -118,11 +221,21 @@ NTSTATUS file_new(struct smb_request *req, connection_struct *conn,
 	status = create_synthetic_smb_fname(fsp, "", NULL, NULL,
 					    &fsp->fsp_name);
 	if (!NT_STATUS_IS_OK(status)) {
-		TALLOC_FREE(fsp);
+		idr_remove(sconn->file_idtree, i);
 		TALLOC_FREE(fsp->fh);
+		TALLOC_FREE(fsp);
+		return status;
 	}
 
+	sconn->first_file = (i+1) % (sconn->real_max_open_files);
+	sconn->files_used += 1;
+
+	fsp->fnum = i + FILE_HANDLE_OFFSET;
+	SMB_ASSERT(fsp->fnum < 65536);
+
 	DLIST_ADD(sconn->files, fsp);
+	fsp_id_hash_add(fsp);
+	fsp_id_hash_grow(sconn);
 
 	DEBUG(5,("allocated file structure %d, fnum = %d (%d used)\n",
 		 i, fsp->fnum, sconn->files_used));
@@ -131,13 +244,6 @@ NTSTATUS file_new(struct smb_request *req, connection_struct *conn,
 		req->chain_fsp = fsp;
 	}
 
-	/* A new fsp invalidates the positive and
-	  negative fsp_fi_cache as the new fsp is pushed
-	  at the start of the list and we search from
-	  a cache hit to the *end* of the list. */
-
-	ZERO_STRUCT(sconn->fsp_fi_cache);
-
 	conn->num_files_open++;
 
 	*result = fsp;
@@ -208,9 +314,15 @@ bool file_init(struct smbd_server_connection *sconn)
 
 	SMB_ASSERT(sconn->real_max_open_files > 100);
 
-	sconn->file_bmap = bitmap_talloc(sconn, sconn->real_max_open_files);
+	sconn->file_idtree = idr_init(sconn);
+	if (sconn->file_idtree == NULL) {
+		return false;
+	}
 
-	if (!sconn->file_bmap) {
+	sconn->file_id_hash_size = FILE_ID_HASH_MIN_SIZE;
+	sconn->file_id_hash = talloc_zero_array(sconn, files_struct *,
+						sconn->file_id_hash_size);
+	if (sconn->file_id_hash == NULL) {
 		return false;
 	}
 	return true;
@@ -283,16 +395,14 @@ files_struct *file_find_fd(struct smbd_server_connection *sconn, int fd)
 files_struct *file_find_dif(struct smbd_server_connection *sconn,
 			    struct file_id id, unsigned long gen_id)
 {
-	int count=0;
 	files_struct *fsp;
 
-	for (fsp=sconn->files; fsp; fsp=fsp->next,count++) {
+	for (fsp = sconn->file_id_hash[fsp_id_hash_bucket(sconn, &id)];
+	     fsp != NULL;
+	     fsp = fsp->file_id_next) {
 		/* We can have a fsp->fh->fd == -1 here as it could be a stat open. */
 		if (file_id_equal(&fsp->file_id, &id) &&
 		    fsp->fh->gen_id == gen_id ) {
-			if (count > 10) {
-				DLIST_PROMOTE(sconn->files, fsp);
-			}
 			/* Paranoia check. */
 			if ((fsp->fh->fd == -1) &&
 			    (fsp->oplock_type != NO_OPLOCK) &&
@@ -315,8 +425,6 @@ files_struct *file_find_dif(struct smbd_server_connection *sconn,
 
 /****************************************************************************
  Find the first fsp given a device and inode.
- We use a singleton cache here to speed up searching from getfilepathinfo
- calls.
 ****************************************************************************/
 
 files_struct *file_find_di_first(struct smbd_server_connection *sconn,
@@ -324,23 +432,14 @@ files_struct *file_find_di_first(struct smbd_server_connection *sconn,
 {
 	files_struct *fsp;
 
-	if (file_id_equal(&sconn->fsp_fi_cache.id, &id)) {
-		/* Positive or negative cache hit. */
-		return sconn->fsp_fi_cache.fsp;
-	}
-
-	sconn->fsp_fi_cache.id = id;
-
-	for (fsp=sconn->files;fsp;fsp=fsp->next) {
+	for (fsp = sconn->file_id_hash[fsp_id_hash_bucket(sconn, &id)];
+	     fsp != NULL;
+	     fsp = fsp->file_id_next) {
 		if (file_id_equal(&fsp->file_id, &id)) {
-			/* Setup positive cache. */
-			sconn->fsp_fi_cache.fsp = fsp;
 			return fsp;
 		}
 	}
 
-	/* Setup negative cache. */
-	sconn->fsp_fi_cache.fsp = NULL;
 	return NULL;
 }
 
@@ -352,7 +451,7 @@ files_struct *file_find_di_next(files_struct *start_fsp)
 {
 	files_struct *fsp;
 
-	for (fsp = start_fsp->next;fsp;fsp=fsp->next) {
+	for (fsp = start_fsp->file_id_next; fsp; fsp = fsp->file_id_next) {
 		if (file_id_equal(&fsp->file_id, &start_fsp->file_id)) {
 			return fsp;
 		}
@@ -435,6 +534,7 @@ void file_free(struct smb_request *req, files_struct *fsp)
 	struct smbd_server_connection *sconn = fsp->conn->sconn;
 
 	DLIST_REMOVE(sconn->files, fsp);
+	fsp_id_hash_remove(fsp);
 
 	TALLOC_FREE(fsp->fake_file_handle);
 
@@ -459,7 +559,7 @@ void file_free(struct smb_request *req, files_struct *fsp)
 	/* Ensure this event will never fire. */
 	TALLOC_FREE(fsp->update_write_time_event);
 
-	bitmap_clear(sconn->file_bmap, fsp->fnum - FILE_HANDLE_OFFSET);
+	idr_remove(sconn->file_idtree, fsp->fnum - FILE_HANDLE_OFFSET);
 	sconn->files_used--;
 
 	DEBUG(5,("freed files structure %d (%d used)\n",
@@ -479,11 +579,6 @@ void file_free(struct smb_request *req, files_struct *fsp)
 		remove_smb2_chained_fsp(fsp);
 	}
 
-	/* Closing a file can invalidate the positive cache. */
-	if (fsp == sconn->fsp_fi_cache.fsp) {
-		ZERO_STRUCT(sconn->fsp_fi_cache);
-	}
-
 	/* Drop all remaining extensions. */
 	while (fsp->vfs_extension) {
 		vfs_remove_fsp_extension(fsp->vfs_extension->owner, fsp);
@@ -504,18 +599,21 @@ void file_free(struct smb_request *req, files_struct *fsp)
 static struct files_struct *file_fnum(struct smbd_server_connection *sconn,
 				      uint16 fnum)
 {
-	files_struct *fsp;
-	int count=0;
-
-	for (fsp=sconn->files; fsp; fsp=fsp->next, count++) {
-		if (fsp->fnum == fnum) {
-			if (count > 10) {
-				DLIST_PROMOTE(sconn->files, fsp);
-			}
-			return fsp;
-		}
+	if (fnum < FILE_HANDLE_OFFSET) {
+		return NULL;
 	}
-	return NULL;
+	return (files_struct *)idr_find(sconn->file_idtree,
+					fnum - FILE_HANDLE_OFFSET);
+}
+
+/****************************************************************************
+ Get an fsp from a 16 bit fnum without a packet. Used to validate an
+ SMB2 WRITE before its data is received with recvfile.
+****************************************************************************/
+
+files_struct *file_fsp_sconn(struct smbd_server_connection *sconn, uint16 fid)
+{
+	return file_fnum(sconn, fid);
 }
 
 /****************************************************************************
@@ -563,7 +661,7 @@ NTSTATUS dup_file_fsp(struct smb_request *req, files_struct *from,
 	to->fh = from->fh;
 	to->fh->ref_count++;
 
-	to->file_id = from->file_id;
+	fsp_set_file_id(to, from->file_id);
 	to->initial_allocation_size = from->initial_allocation_size;
 	to->mode = from->mode;
 	to->file_pid = from->file_pid;
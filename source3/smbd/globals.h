@@ -38,12 +38,6 @@ extern bool dfree_broken;
 /* how many write cache buffers have been allocated */
 extern unsigned int allocated_write_caches;
 
-/* A singleton cache to speed up searching by dev/inode. */
-struct fsp_singleton_cache {
-	files_struct *fsp;
-	struct file_id id;
-};
-
 extern const struct mangle_fns *mangle_fns;
 
 extern unsigned char *chartest;
@@ -260,6 +254,8 @@ void remove_smb2_chained_fsp(files_struct *fsp);
 
 NTSTATUS smbd_smb2_request_verify_sizes(struct smbd_smb2_request *req,
 					size_t expected_body_size);
+NTSTATUS smbd_smb2_request_verify_creditcharge(struct smbd_smb2_request *req,
+					       uint32_t data_length);
 
 NTSTATUS smbd_smb2_request_process_negprot(struct smbd_smb2_request *req);
 NTSTATUS smbd_smb2_request_process_sesssetup(struct smbd_smb2_request *req);
@@ -285,6 +281,11 @@ NTSTATUS smbd_smb2_request_dispatch(struct smbd_smb2_request *req);
 void smbd_smb2_request_dispatch_immediate(struct tevent_context *ctx,
 				struct tevent_immediate *im,
 				void *private_data);
+void smbd_smb2_msg_credit_stats(struct messaging_context *msg,
+				void *private_data,
+				uint32_t msg_type,
+				struct server_id server_id,
+				DATA_BLOB *data);
 
 /* SMB1 -> SMB2 glue. */
 void send_break_message_smb2(files_struct *fsp, int level);
@@ -342,6 +343,8 @@ struct smbd_smb2_request {
 	int current_idx;
 	bool do_signing;
 	struct tevent_timer *async_te;
+	/* when we started to process the request */
+	struct timespec request_time;
 	bool cancelled;
 	bool compound_related;
 
@@ -459,10 +462,13 @@ struct smbd_server_connection {
 	struct pollfd *pfds;
 
 	struct files_struct *files;
-	struct bitmap *file_bmap;
+	/* fnum - FILE_HANDLE_OFFSET to files_struct */
+	struct idr_context *file_idtree;
+	/* hash chains by file_id, see fsp_id_hash_add() */
+	struct files_struct **file_id_hash;
+	unsigned int file_id_hash_size;
 	int real_max_open_files;
 	int files_used;
-	struct fsp_singleton_cache fsp_fi_cache;
 	unsigned long file_gen_counter;
 	int first_file;
 
@@ -604,8 +610,40 @@ struct smbd_server_connection {
 		uint32_t max_trans;
 		uint32_t max_read;
 		uint32_t max_write;
+		/* SMB2_CAP_LARGE_MTU, requests carry a credit charge */
+		bool supports_multicredit;
 		struct bitmap *credits_bitmap;
+		/*
+		 * The number of credits we currently let the client
+		 * have outstanding, between credits_window_min and
+		 * max_credits. It grows while requests complete
+		 * quickly and shrinks when the aio or worker thread
+		 * backlog builds up.
+		 */
+		uint32_t credits_window;
+		uint32_t credits_window_min;
+		struct timespec credits_window_shrunk;
+		/* smoothed completion time of synchronous requests */
+		uint32_t credits_latency_usec;
+		struct {
+			uint64_t requests;
+			uint64_t credits;
+			uint64_t grown;
+			uint64_t shrunk;
+		} credit_stats;
 		bool compound_related_in_progress;
+		/*
+		 * Helper threads for SMB2 READ/WRITE file I/O,
+		 * NULL unless "smb2 worker threads" is set.
+		 */
+		struct fncall_context *workers;
+		/*
+		 * Number of bytes of the dynamic part of the SMB2
+		 * WRITE being dispatched that were left in the socket
+		 * so that they can be written to the file with
+		 * SMB_VFS_RECVFILE ("min receivefile size").
+		 */
+		size_t unread_bytes;
 	} smb2;
 };
 
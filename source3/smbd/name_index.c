@@ -0,0 +1,543 @@
+/*
+   Unix SMB/CIFS implementation.
+   Case insensitive directory name index
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * When the stat cache misses on a case insensitive share,
+ * get_real_filename() has to read the whole directory to find a case
+ * variant of a name. Creating a new file always misses, so filling a
+ * large directory is quadratic.
+ *
+ * For large directories we keep the upper cased names in a red-black
+ * tree instead. An index is only kept while the kernel watches the
+ * directory for name changes (inotify with the default VFS), that
+ * keeps it current with changes from other processes. The watch is
+ * installed before the directory is read, and all events the kernel
+ * has queued are delivered before we answer a lookup, so a name
+ * another process has just created is never reported missing. Our
+ * own creates, renames and deletes are applied directly from
+ * notify_fname(). Other cluster nodes don't show up in inotify, so
+ * there is no index with clustering.
+ *
+ * Directories that turn out not to be watchable stay on the list
+ * with an empty tree, so we don't try to watch them again.
+ */
+
+#include "includes.h"
+#include "smbd/smbd.h"
+#include "smbd/globals.h"
+#include "../librpc/gen_ndr/notify.h"
+#include "../lib/util/rbtree.h"
+
+/*
+ * Don't bother with an index for small directories, scanning those
+ * is cheap.
+ */
+#define NAME_INDEX_MIN_ENTRIES 1000
+
+/*
+ * Number of directory indexes a process keeps, each needs a kernel
+ * watch.
+ */
+#define NAME_INDEX_MAX_DIRS 16
+
+struct name_index_entry {
+	struct rb_node rb_node;
+	/*
+	 * Number of other names in the directory with the same upper
+	 * case form, possible on a case sensitive file system
+	 */
+	uint32_t dups;
+	size_t keylength;
+	const char *name;
+	char data[1];		/* key, then name */
+};
+
+struct name_index {
+	struct name_index *prev, *next;
+	connection_struct *conn;
+	char *dirpath;
+	struct rb_root tree;
+	size_t num_entries;
+	void *watch;
+	bool in_list;
+	bool unwatchable;
+	/* set from the notify callback, can't free ourselves there */
+	bool stale;
+};
+
+static struct name_index *name_indexes;
+static unsigned int num_name_indexes;
+
+static struct name_index_entry *name_index_node2entry(struct rb_node *node)
+{
+	return (struct name_index_entry *)
+		((char *)node - offsetof(struct name_index_entry, rb_node));
+}
+
+static int name_index_compare(struct name_index_entry *e,
+			      const char *key, size_t keylength)
+{
+	if (e->keylength < keylength) return 1;
+	if (e->keylength > keylength) return -1;
+	return memcmp(e->data, key, keylength);
+}
+
+static struct name_index_entry *name_index_find(struct name_index *idx,
+						const char *key)
+{
+	size_t keylength = strlen(key);
+	struct rb_node *node = idx->tree.rb_node;
+
+	while (node != NULL) {
+		struct name_index_entry *e = name_index_node2entry(node);
+		int cmp;
+
+		cmp = name_index_compare(e, key, keylength);
+		if (cmp == 0) {
+			return e;
+		}
+		node = (cmp < 0) ? node->rb_left : node->rb_right;
+	}
+	return NULL;
+}
+
+static bool name_index_insert(struct name_index *idx, const char *name)
+{
+	struct name_index_entry *e;
+	struct rb_node **p, *parent;
+	char *key;
+	size_t keylength, namelength;
+
+	key = talloc_strdup_upper(talloc_tos(), name);
+	if (key == NULL) {
+		return false;
+	}
+	keylength = strlen(key);
+	namelength = strlen(name);
+
+	parent = NULL;
+	p = &idx->tree.rb_node;
+
+	while (*p) {
+		struct name_index_entry *elem = name_index_node2entry(*p);
+		int cmp;
+
+		parent = (*p);
+
+		cmp = name_index_compare(elem, key, keylength);
+		if (cmp == 0) {
+			if (strcmp(elem->name, name) != 0) {
+				elem->dups += 1;
+			}
+			TALLOC_FREE(key);
+			return true;
+		}
+
+		p = (cmp < 0) ? &(*p)->rb_left : &(*p)->rb_right;
+	}
+
+	e = (struct name_index_entry *)SMB_MALLOC(
+		sizeof(struct name_index_entry) + keylength + namelength + 1);
+	if (e == NULL) {
+		TALLOC_FREE(key);
+		return false;
+	}
+	e->dups = 0;
+	e->keylength = keylength;
+	memcpy(e->data, key, keylength + 1);
+	memcpy(e->data + keylength + 1, name, namelength + 1);
+	e->name = e->data + keylength + 1;
+	TALLOC_FREE(key);
+
+	rb_link_node(&e->rb_node, parent, p);
+	rb_insert_color(&e->rb_node, &idx->tree);
+	idx->num_entries += 1;
+
+	return true;
+}
+
+static void name_index_free_tree(struct rb_node *node)
+{
+	if (node == NULL) {
+		return;
+	}
+	name_index_free_tree(node->rb_left);
+	name_index_free_tree(node->rb_right);
+	SAFE_FREE(node);
+}
+
+static int name_index_destructor(struct name_index *idx)
+{
+	if (idx->in_list) {
+		DLIST_REMOVE(name_indexes, idx);
+		num_name_indexes -= 1;
+	}
+	/* rb_node is the first member of name_index_entry */
+	name_index_free_tree(idx->tree.rb_node);
+	idx->tree.rb_node = NULL;
+	return 0;
+}
+
+static void name_index_drop(struct name_index *idx)
+{
+	DEBUG(10, ("name_index_drop: %s\n", idx->dirpath));
+	TALLOC_FREE(idx);
+}
+
+/*
+ * Apply a name change to an index. Returns false if the index can no
+ * longer be trusted.
+ */
+
+static bool name_index_apply(struct name_index *idx, uint32_t action,
+			     const char *name)
+{
+	struct name_index_entry *e;
+	char *key;
+
+	switch (action) {
+	case NOTIFY_ACTION_ADDED:
+	case NOTIFY_ACTION_NEW_NAME:
+		return name_index_insert(idx, name);
+	case NOTIFY_ACTION_REMOVED:
+	case NOTIFY_ACTION_OLD_NAME:
+		break;
+	default:
+		return true;
+	}
+
+	key = talloc_strdup_upper(talloc_tos(), name);
+	if (key == NULL) {
+		return false;
+	}
+	e = name_index_find(idx, key);
+	TALLOC_FREE(key);
+
+	if (e == NULL) {
+		return true;
+	}
+	if (strcmp(e->name, name) != 0) {
+		if (e->dups > 0) {
+			e->dups -= 1;
+		}
+		return true;
+	}
+	if (e->dups > 0) {
+		/*
+		 * We don't know which of the remaining case variants
+		 * the directory scan would return
+		 */
+		return false;
+	}
+
+	rb_erase(&e->rb_node, &idx->tree);
+	SAFE_FREE(e);
+	idx->num_entries -= 1;
+	return true;
+}
+
+static void name_index_notify_cb(struct sys_notify_context *ctx,
+				 void *private_data,
+				 struct notify_event *ev)
+{
+	struct name_index *idx = talloc_get_type_abort(
+		private_data, struct name_index);
+
+	DEBUG(10, ("name_index_notify_cb: %s action %u name %s\n",
+		   idx->dirpath, (unsigned)ev->action, ev->path));
+
+	if (idx->stale || (ev->path == NULL) ||
+	    (strchr(ev->path, '/') != NULL)) {
+		return;
+	}
+
+	if (!name_index_apply(idx, ev->action, ev->path)) {
+		/*
+		 * Freeing the index would free the watch we are
+		 * called from, our caller drops it
+		 */
+		name_index_free_tree(idx->tree.rb_node);
+		idx->tree.rb_node = NULL;
+		idx->stale = true;
+	}
+}
+
+static struct name_index *name_index_get(connection_struct *conn,
+					 const char *dirpath)
+{
+	struct name_index *idx;
+
+	for (idx = name_indexes; idx != NULL; idx = idx->next) {
+		if ((idx->conn == conn) && (strcmp(idx->dirpath, dirpath) == 0)) {
+			break;
+		}
+	}
+	if (idx == NULL) {
+		return NULL;
+	}
+	if (idx->stale) {
+		name_index_drop(idx);
+		return NULL;
+	}
+	DLIST_PROMOTE(name_indexes, idx);
+	return idx;
+}
+
+/*
+ * Ask the kernel to tell us about name changes in the directory.
+ */
+
+static bool name_index_watch(struct name_index *idx)
+{
+	struct sys_notify_context *ctx;
+	struct notify_entry e;
+	NTSTATUS status;
+	uint32_t filter = FILE_NOTIFY_CHANGE_FILE_NAME|
+			  FILE_NOTIFY_CHANGE_DIR_NAME;
+
+	ctx = smbd_cache_notify_context(idx->conn);
+	if (ctx == NULL) {
+		return false;
+	}
+
+	ZERO_STRUCT(e);
+	e.filter = filter;
+	e.subdir_filter = 0;
+	if (ISDOT(idx->dirpath)) {
+		e.path = idx->conn->connectpath;
+	} else if (idx->dirpath[0] == '/') {
+		e.path = idx->dirpath;
+	} else {
+		e.path = talloc_asprintf(talloc_tos(), "%s/%s",
+					 idx->conn->connectpath,
+					 idx->dirpath);
+		if (e.path == NULL) {
+			return false;
+		}
+	}
+
+	status = sys_notify_watch(ctx, &e, name_index_notify_cb, idx,
+				  &idx->watch);
+	if (!NT_STATUS_IS_OK(status) || (idx->watch == NULL) ||
+	    ((e.filter & filter) != 0)) {
+		/*
+		 * The backend has not taken over the name change bits
+		 * of the filter, so we would not hear about changes
+		 */
+		DEBUG(10, ("name_index_watch: can't watch %s: %s\n",
+			   e.path, nt_errstr(status)));
+		TALLOC_FREE(idx->watch);
+		return false;
+	}
+	talloc_steal(idx, idx->watch);
+	return true;
+}
+
+static struct name_index *name_index_new(connection_struct *conn,
+					 const char *dirpath)
+{
+	struct name_index *idx;
+
+	idx = talloc_zero(conn, struct name_index);
+	if (idx == NULL) {
+		return NULL;
+	}
+	idx->conn = conn;
+	idx->tree = RB_ROOT;
+	talloc_set_destructor(idx, name_index_destructor);
+
+	idx->dirpath = talloc_strdup(idx, dirpath);
+	if (idx->dirpath == NULL) {
+		TALLOC_FREE(idx);
+		return NULL;
+	}
+	return idx;
+}
+
+static void name_index_add_to_list(struct name_index *idx)
+{
+	if (num_name_indexes >= NAME_INDEX_MAX_DIRS) {
+		name_index_drop(DLIST_TAIL(name_indexes));
+	}
+	DLIST_ADD(name_indexes, idx);
+	num_name_indexes += 1;
+	idx->in_list = true;
+}
+
+/*
+ * Read the directory into an index that is already watched, so no
+ * change can slip through between reading and watching.
+ */
+
+static bool name_index_build(struct name_index *idx)
+{
+	struct smb_Dir *cur_dir;
+	const char *dname = NULL;
+	char *talloced = NULL;
+	long curpos;
+
+	cur_dir = OpenDir(talloc_tos(), idx->conn, idx->dirpath, NULL, 0);
+	if (cur_dir == NULL) {
+		DEBUG(3, ("name_index_build: didn't open dir [%s]\n",
+			  idx->dirpath));
+		return false;
+	}
+
+	curpos = 0;
+	while ((dname = ReadDirName(cur_dir, &curpos, NULL, &talloced))) {
+		bool ok;
+
+		if (ISDOT(dname) || ISDOTDOT(dname)) {
+			TALLOC_FREE(talloced);
+			continue;
+		}
+		ok = name_index_insert(idx, dname);
+		TALLOC_FREE(talloced);
+		if (!ok) {
+			TALLOC_FREE(cur_dir);
+			return false;
+		}
+	}
+	TALLOC_FREE(cur_dir);
+
+	DEBUG(10, ("name_index_build: %s has %u entries\n", idx->dirpath,
+		   (unsigned)idx->num_entries));
+
+	return true;
+}
+
+/*
+ * Find the name in a directory that matches "name" case
+ * insensitively. Follows the SMB_VFS_GET_REAL_FILENAME conventions:
+ * -1/EOPNOTSUPP means the caller has to scan the directory itself.
+ */
+
+int name_index_get_real_filename(connection_struct *conn, const char *path,
+				 const char *name, TALLOC_CTX *mem_ctx,
+				 char **found_name)
+{
+	struct name_index *idx;
+	struct name_index_entry *e;
+	char *key;
+	bool temporary = false;
+
+	if (!lp_name_index() || conn->case_sensitive || lp_clustering()) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if ((path == NULL) || (*path == '\0')) {
+		path = ".";
+	}
+
+	idx = name_index_get(conn, path);
+	if ((idx != NULL) && idx->unwatchable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+	if (idx == NULL) {
+		idx = name_index_new(conn, path);
+		if (idx == NULL) {
+			errno = EOPNOTSUPP;
+			return -1;
+		}
+		if (!name_index_watch(idx)) {
+			/* Remember not to try this directory again */
+			idx->unwatchable = true;
+			name_index_add_to_list(idx);
+			errno = EOPNOTSUPP;
+			return -1;
+		}
+		if (!name_index_build(idx)) {
+			TALLOC_FREE(idx);
+			errno = EOPNOTSUPP;
+			return -1;
+		}
+		if (idx->num_entries < NAME_INDEX_MIN_ENTRIES) {
+			/* Only good for this lookup */
+			temporary = true;
+		} else {
+			name_index_add_to_list(idx);
+		}
+	}
+
+	/*
+	 * Apply what others changed since the event loop last looked,
+	 * and everything that happened while we read the directory.
+	 */
+	if (!sys_notify_drain(smbd_cache_notify_context(conn)) ||
+	    idx->stale) {
+		name_index_drop(idx);
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	key = talloc_strdup_upper(talloc_tos(), name);
+	if (key == NULL) {
+		if (temporary) {
+			TALLOC_FREE(idx);
+		}
+		errno = ENOMEM;
+		return -1;
+	}
+	e = name_index_find(idx, key);
+	TALLOC_FREE(key);
+
+	if (e == NULL) {
+		if (temporary) {
+			TALLOC_FREE(idx);
+		}
+		errno = ENOENT;
+		return -1;
+	}
+
+	*found_name = talloc_strdup(mem_ctx, e->name);
+	if (temporary) {
+		TALLOC_FREE(idx);
+	}
+	if (*found_name == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * Called from notify_fname() for our own name changes.
+ */
+
+void name_index_update(connection_struct *conn, uint32_t action,
+		       const char *parent, const char *name)
+{
+	struct name_index *idx;
+
+	if (name_indexes == NULL) {
+		return;
+	}
+	if ((parent == NULL) || (*parent == '\0')) {
+		parent = ".";
+	}
+
+	idx = name_index_get(conn, parent);
+	if ((idx == NULL) || idx->unwatchable) {
+		return;
+	}
+	if (!name_index_apply(idx, action, name)) {
+		name_index_drop(idx);
+	}
+}
@@ -358,6 +358,9 @@ void notify_fname(connection_struct *conn, uint32 action, uint32 filter,
 	if (parent_dirname(talloc_tos(), path, &parent, &name)) {
 		struct smb_filename smb_fname_parent;
 
+		name_index_update(conn, action, parent, name);
+		dir_stat_cache_update(conn, parent, name);
+
 		ZERO_STRUCT(smb_fname_parent);
 		smb_fname_parent.base_name = parent;
 
@@ -542,3 +545,47 @@ NTSTATUS sys_notify_watch(struct sys_notify_context *ctx,
 				    handle);
 }
 
+/*
+ * The name index and the directory stat cache watch directories for
+ * their own bookkeeping. They share one context per process, so with
+ * inotify all their watches live on a single inotify instance. Only
+ * connections whose notify_watch ends up in the default VFS module
+ * may use it, so all watches on it are of the same kind.
+ */
+
+static struct sys_notify_context *smbd_cache_notify_ctx;
+
+struct sys_notify_context *smbd_cache_notify_context(connection_struct *conn)
+{
+	if (!vfs_default_notify_watch(conn)) {
+		return NULL;
+	}
+	if (smbd_cache_notify_ctx == NULL) {
+		smbd_cache_notify_ctx = sys_notify_context_create(
+			conn, NULL, conn->sconn->ev_ctx);
+		if (smbd_cache_notify_ctx == NULL) {
+			return NULL;
+		}
+	}
+	/* Only used to route the next watch through this VFS */
+	smbd_cache_notify_ctx->conn = conn;
+	return smbd_cache_notify_ctx;
+}
+
+/*
+ * Deliver all changes the kernel has queued for ctx. Returns false if
+ * the backend can't do that, a cache must not trust a miss then.
+ */
+
+bool sys_notify_drain(struct sys_notify_context *ctx)
+{
+	if (ctx == NULL) {
+		return false;
+	}
+#ifdef HAVE_INOTIFY
+	return inotify_drain(ctx);
+#else
+	return false;
+#endif
+}
+
@@ -76,6 +76,8 @@ static int inotify_rm_watch(int fd, int wd)
 struct inotify_private {
 	struct sys_notify_context *ctx;
 	int fd;
+	/* set once we lost track of the events on fd */
+	bool broken;
 	struct inotify_watch_context *watches;
 };
 
@@ -224,32 +226,17 @@ static void inotify_dispatch(struct inotify_private *in,
 }
 
 /*
-  called when the kernel has some events for us
+  read and dispatch bufsize bytes worth of events. Returns false if
+  the fd is out of sync afterwards
 */
-static void inotify_handler(struct event_context *ev, struct fd_event *fde,
-			    uint16_t flags, void *private_data)
+static bool inotify_read_events(struct inotify_private *in, int bufsize)
 {
-	struct inotify_private *in = talloc_get_type(private_data,
-						     struct inotify_private);
-	int bufsize = 0;
 	struct inotify_event *e0, *e;
 	uint32_t prev_cookie=0;
 	NTSTATUS status;
 
-	/*
-	  we must use FIONREAD as we cannot predict the length of the
-	  filenames, and thus can't know how much to allocate
-	  otherwise
-	*/
-	if (ioctl(in->fd, FIONREAD, &bufsize) != 0 || 
-	    bufsize == 0) {
-		DEBUG(0,("No data on inotify fd?!\n"));
-		TALLOC_FREE(fde);
-		return;
-	}
-
 	e0 = e = (struct inotify_event *)TALLOC_SIZE(in, bufsize + 1);
-	if (e == NULL) return;
+	if (e == NULL) return true;
 	((uint8_t *)e)[bufsize] = '\0';
 
 	status = read_data(in->fd, (char *)e0, bufsize);
@@ -257,10 +244,8 @@ static void inotify_handler(struct event_context *ev, struct fd_event *fde,
 		DEBUG(0,("Failed to read all inotify data - %s\n",
 			nt_errstr(status)));
 		talloc_free(e0);
-		/* the inotify fd will now be out of sync,
-		 * can't keep reading data off it */
-		TALLOC_FREE(fde);
-		return;
+		in->broken = true;
+		return false;
 	}
 
 	/* we can get more than one event in the buffer */
@@ -276,6 +261,69 @@ static void inotify_handler(struct event_context *ev, struct fd_event *fde,
 	}
 
 	talloc_free(e0);
+	return true;
+}
+
+/*
+  called when the kernel has some events for us
+*/
+static void inotify_handler(struct event_context *ev, struct fd_event *fde,
+			    uint16_t flags, void *private_data)
+{
+	struct inotify_private *in = talloc_get_type(private_data,
+						     struct inotify_private);
+	int bufsize = 0;
+
+	/*
+	  we must use FIONREAD as we cannot predict the length of the
+	  filenames, and thus can't know how much to allocate
+	  otherwise
+	*/
+	if (ioctl(in->fd, FIONREAD, &bufsize) != 0) {
+		DEBUG(0,("FIONREAD on inotify fd failed - %s\n",
+			 strerror(errno)));
+		in->broken = true;
+		TALLOC_FREE(fde);
+		return;
+	}
+	if (bufsize == 0) {
+		/* inotify_drain() got there first */
+		return;
+	}
+
+	if (!inotify_read_events(in, bufsize)) {
+		/* the inotify fd will now be out of sync,
+		 * can't keep reading data off it */
+		TALLOC_FREE(fde);
+	}
+}
+
+/*
+  run the callbacks for everything the kernel has queued for us right
+  now, without waiting for the event loop. Changes made by other
+  processes on this machine have been queued by the time their system
+  call returned. Returns false if ctx is not an inotify context or we
+  lost track of its events.
+*/
+bool inotify_drain(struct sys_notify_context *ctx)
+{
+	struct inotify_private *in;
+	int bufsize = 0;
+
+	if (ctx->private_data == NULL) {
+		return false;
+	}
+	in = talloc_get_type(ctx->private_data, struct inotify_private);
+	if ((in == NULL) || in->broken) {
+		return false;
+	}
+	if (ioctl(in->fd, FIONREAD, &bufsize) != 0) {
+		return false;
+	}
+	if (bufsize == 0) {
+		return true;
+	}
+	return inotify_read_events(in, bufsize);
 }
 
 /*
@@ -299,6 +347,7 @@ static NTSTATUS inotify_setup(struct sys_notify_context *ctx)
 		return map_nt_error_from_unix(errno);
 	}
 	in->ctx = ctx;
+	in->broken = false;
 	in->watches = NULL;
 
 	ctx->private_data = in;
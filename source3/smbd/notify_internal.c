@@ -21,6 +21,11 @@
   this is the change notify database. It implements mechanisms for
   storing current change notify waiters in a tdb, and checking if a
   given event matches any of the stored notify waiiters.
+
+  Watches that are not fully handled by the kernel are stored in
+  notify.tdb, one record per watched directory, keyed by its path.
+  A change only has to look at the records of the directories above
+  the changed name, no matter how many other watches there are.
 */
 
 #include "includes.h"
@@ -40,10 +45,7 @@ struct notify_context {
 	struct server_id server;
 	struct messaging_context *messaging_ctx;
 	struct notify_list *list;
-	struct notify_array *array;
-	int seqnum;
 	struct sys_notify_context *sys_notify_ctx;
-	TDB_DATA key;
 };
 
 
@@ -52,16 +54,13 @@ struct notify_list {
 	void *private_data;
 	void (*callback)(void *, const struct notify_event *);
 	void *sys_notify_handle;
-	int depth;
+	char *path;	/* set if we have an entry in notify.tdb */
 };
 
-#define NOTIFY_KEY "notify array"
-
 #define NOTIFY_ENABLE		"notify:enable"
 #define NOTIFY_ENABLE_DEFAULT	True
 
-static NTSTATUS notify_remove_all(struct notify_context *notify,
-				  const struct server_id *server);
+static NTSTATUS notify_remove_all(struct notify_context *notify);
 static void notify_handler(struct messaging_context *msg_ctx, void *private_data, 
 			   uint32_t msg_type, struct server_id server_id, DATA_BLOB *data);
 
@@ -73,7 +72,7 @@ static int notify_destructor(struct notify_context *notify)
 	messaging_deregister(notify->messaging_ctx, MSG_PVFS_NOTIFY, notify);
 
 	if (notify->list != NULL) {
-		notify_remove_all(notify, &notify->server);
+		notify_remove_all(notify);
 	}
 
 	return 0;
@@ -119,9 +118,6 @@ struct notify_context *notify_init(TALLOC_CTX *mem_ctx, struct server_id server,
 	notify->server = server;
 	notify->messaging_ctx = messaging_ctx;
 	notify->list = NULL;
-	notify->array = NULL;
-	notify->seqnum = dbwrap_get_seqnum(notify->db_recursive);
-	notify->key = string_term_tdb_data(NOTIFY_KEY);
 
 	talloc_set_destructor(notify, notify_destructor);
 
@@ -176,140 +172,67 @@ bool notify_internal_parent_init(TALLOC_CTX *mem_ctx)
 }
 
 /*
-  lock and fetch the record
+  parse a notify.tdb or notify_onelevel.tdb record
 */
-static NTSTATUS notify_fetch_locked(struct notify_context *notify, struct db_record **rec)
+static NTSTATUS notify_entry_array_parse(TDB_DATA dbuf,
+					 struct notify_entry_array *array)
 {
-	*rec = dbwrap_fetch_locked(notify->db_recursive, notify, notify->key);
-	if (*rec == NULL) {
-		return NT_STATUS_INTERNAL_DB_CORRUPTION;
-	}
-	return NT_STATUS_OK;
-}
-
-/*
-  load the notify array
-*/
-static NTSTATUS notify_load(struct notify_context *notify, struct db_record *rec)
-{
-	TDB_DATA dbuf;
+	enum ndr_err_code ndr_err;
 	DATA_BLOB blob;
-	NTSTATUS status;
-	int seqnum;
 
-	seqnum = dbwrap_get_seqnum(notify->db_recursive);
+	blob.data = (uint8_t *)dbuf.dptr;
+	blob.length = dbuf.dsize;
 
-	if (seqnum == notify->seqnum && notify->array != NULL) {
+	if (blob.length == 0) {
 		return NT_STATUS_OK;
 	}
 
-	notify->seqnum = seqnum;
-
-	talloc_free(notify->array);
-	notify->array = talloc_zero(notify, struct notify_array);
-	NT_STATUS_HAVE_NO_MEMORY(notify->array);
-
-	if (!rec) {
-		status = dbwrap_fetch(notify->db_recursive, notify,
-				      notify->key, &dbuf);
-		if (!NT_STATUS_IS_OK(status)) {
-			return NT_STATUS_INTERNAL_DB_CORRUPTION;
-		}
-	} else {
-		dbuf = dbwrap_record_get_value(rec);
-	}
-
-	blob.data = (uint8 *)dbuf.dptr;
-	blob.length = dbuf.dsize;
-
-	status = NT_STATUS_OK;
-	if (blob.length > 0) {
-		enum ndr_err_code ndr_err;
-		ndr_err = ndr_pull_struct_blob(&blob, notify->array, notify->array,
-					       (ndr_pull_flags_fn_t)ndr_pull_notify_array);
-		if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
-			/* 1. log that we got a corrupt notify_array
-			 * 2. clear the variable the garbage was stored into to not trip
-			 *  over it next time this method is entered with the same seqnum
-			 * 3. delete it from the database */
-			DEBUG(2, ("notify_array is corrupt, discarding it\n"));
-
-			ZERO_STRUCTP(notify->array);
-			if (rec != NULL) {
-				dbwrap_record_delete(rec);
-			}
-
-		} else {
-			if (DEBUGLEVEL >= 10) {
-				DEBUG(10, ("notify_load:\n"));
-				NDR_PRINT_DEBUG(notify_array, notify->array);
-			}
-		}
+	ndr_err = ndr_pull_struct_blob(&blob, array, array,
+		(ndr_pull_flags_fn_t)ndr_pull_notify_entry_array);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		DEBUG(10, ("ndr_pull_notify_entry_array failed: %s\n",
+			   ndr_errstr(ndr_err)));
+		return ndr_map_error2ntstatus(ndr_err);
 	}
-
-
-	if (!rec) {
-		talloc_free(dbuf.dptr);
+	if (DEBUGLEVEL >= 10) {
+		NDR_PRINT_DEBUG(notify_entry_array, array);
 	}
-
-	return status;
-}
-
-/*
-  compare notify entries for sorting
-*/
-static int notify_compare(const struct notify_entry *e1, const struct notify_entry *e2)
-{
-	return strcmp(e1->path, e2->path);
+	return NT_STATUS_OK;
 }
 
 /*
-  save the notify array
+  store a notify.tdb or notify_onelevel.tdb record, deleting it if
+  there are no entries left
 */
-static NTSTATUS notify_save(struct notify_context *notify, struct db_record *rec)
+static NTSTATUS notify_entry_array_store(struct db_record *rec,
+					 struct notify_entry_array *array)
 {
-	TDB_DATA dbuf;
-	DATA_BLOB blob;
-	NTSTATUS status;
 	enum ndr_err_code ndr_err;
-	TALLOC_CTX *tmp_ctx;
-
-	/* if possible, remove some depth arrays */
-	while (notify->array->num_depths > 0 &&
-	       notify->array->depth[notify->array->num_depths-1].num_entries == 0) {
-		notify->array->num_depths--;
-	}
+	DATA_BLOB blob;
+	TDB_DATA dbuf;
 
-	/* we might just be able to delete the record */
-	if (notify->array->num_depths == 0) {
+	if (array->num_entries == 0) {
 		return dbwrap_record_delete(rec);
 	}
 
-	tmp_ctx = talloc_new(notify);
-	NT_STATUS_HAVE_NO_MEMORY(tmp_ctx);
-
-	ndr_err = ndr_push_struct_blob(&blob, tmp_ctx, notify->array,
-				      (ndr_push_flags_fn_t)ndr_push_notify_array);
+	ndr_err = ndr_push_struct_blob(&blob, array, array,
+		(ndr_push_flags_fn_t)ndr_push_notify_entry_array);
 	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
-		talloc_free(tmp_ctx);
+		DEBUG(10, ("ndr_push_notify_entry_array failed: %s\n",
+			   ndr_errstr(ndr_err)));
 		return ndr_map_error2ntstatus(ndr_err);
 	}
 
 	if (DEBUGLEVEL >= 10) {
-		DEBUG(10, ("notify_save:\n"));
-		NDR_PRINT_DEBUG(notify_array, notify->array);
+		NDR_PRINT_DEBUG(notify_entry_array, array);
 	}
 
 	dbuf.dptr = blob.data;
 	dbuf.dsize = blob.length;
 
-	status = dbwrap_record_store(rec, dbuf, TDB_REPLACE);
-	talloc_free(tmp_ctx);
-
-	return status;
+	return dbwrap_record_store(rec, dbuf, TDB_REPLACE);
 }
 
-
 /*
   handle incoming notify messages
 */
@@ -357,56 +280,108 @@ static void sys_notify_callback(struct sys_notify_context *ctx,
 }
 
 /*
-  add an entry to the notify array
+  add an entry to the record of the watched directory in notify.tdb
 */
-static NTSTATUS notify_add_array(struct notify_context *notify, struct db_record *rec,
+static NTSTATUS notify_add_array(struct notify_context *notify,
 				 struct notify_entry *e,
-				 void *private_data, int depth)
+				 void *private_data)
 {
-	int i;
-	struct notify_depth *d;
-	struct notify_entry *ee;
-
-	/* possibly expand the depths array */
-	if (depth >= notify->array->num_depths) {
-		d = talloc_realloc(notify->array, notify->array->depth, 
-				   struct notify_depth, depth+1);
-		NT_STATUS_HAVE_NO_MEMORY(d);
-		for (i=notify->array->num_depths;i<=depth;i++) {
-			ZERO_STRUCT(d[i]);
-		}
-		notify->array->depth = d;
-		notify->array->num_depths = depth+1;
+	struct notify_entry_array *array;
+	struct notify_entry *entries;
+	struct db_record *rec;
+	NTSTATUS status;
+
+	array = talloc_zero(talloc_tos(), struct notify_entry_array);
+	if (array == NULL) {
+		return NT_STATUS_NO_MEMORY;
 	}
-	d = &notify->array->depth[depth];
 
-	/* expand the entries array */
-	ee = talloc_realloc(notify->array->depth, d->entries, struct notify_entry,
-			    d->num_entries+1);
-	NT_STATUS_HAVE_NO_MEMORY(ee);
-	d->entries = ee;
+	rec = dbwrap_fetch_locked(notify->db_recursive, array,
+				  string_tdb_data(e->path));
+	if (rec == NULL) {
+		DEBUG(10, ("notify_add_array: fetch_locked for %s failed\n",
+			   e->path));
+		TALLOC_FREE(array);
+		return NT_STATUS_INTERNAL_DB_CORRUPTION;
+	}
 
-	d->entries[d->num_entries] = *e;
-	d->entries[d->num_entries].private_data = private_data;
-	d->entries[d->num_entries].server = notify->server;
-	d->entries[d->num_entries].path_len = strlen(e->path);
-	d->num_entries++;
+	status = notify_entry_array_parse(dbwrap_record_get_value(rec),
+					  array);
+	if (!NT_STATUS_IS_OK(status)) {
+		TALLOC_FREE(array);
+		return status;
+	}
 
-	d->max_mask |= e->filter;
-	d->max_mask_subdir |= e->subdir_filter;
+	entries = talloc_realloc(array, array->entries, struct notify_entry,
+				 array->num_entries+1);
+	if (entries == NULL) {
+		TALLOC_FREE(array);
+		return NT_STATUS_NO_MEMORY;
+	}
+	array->entries = entries;
 
-	TYPESAFE_QSORT(d->entries, d->num_entries, notify_compare);
+	entries[array->num_entries] = *e;
+	entries[array->num_entries].private_data = private_data;
+	entries[array->num_entries].server = notify->server;
+	entries[array->num_entries].path_len = strlen(e->path);
+	array->num_entries += 1;
 
-	/* recalculate the maximum masks */
-	d->max_mask = 0;
-	d->max_mask_subdir = 0;
+	status = notify_entry_array_store(rec, array);
+	TALLOC_FREE(array);
+	return status;
+}
+
+/*
+  remove an entry from the record of a watched directory in notify.tdb
+*/
+static NTSTATUS notify_remove_array(struct notify_context *notify,
+				    TDB_DATA key,
+				    const struct server_id *server,
+				    void *private_data)
+{
+	struct notify_entry_array *array;
+	struct db_record *rec;
+	NTSTATUS status;
+	uint32_t i;
 
-	for (i=0;i<d->num_entries;i++) {
-		d->max_mask |= d->entries[i].filter;
-		d->max_mask_subdir |= d->entries[i].subdir_filter;
+	array = talloc_zero(talloc_tos(), struct notify_entry_array);
+	if (array == NULL) {
+		return NT_STATUS_NO_MEMORY;
 	}
 
-	return notify_save(notify, rec);
+	rec = dbwrap_fetch_locked(notify->db_recursive, array, key);
+	if (rec == NULL) {
+		DEBUG(10, ("notify_remove_array: fetch_locked for %.*s "
+			   "failed\n", (int)key.dsize, (char *)key.dptr));
+		TALLOC_FREE(array);
+		return NT_STATUS_INTERNAL_DB_CORRUPTION;
+	}
+
+	status = notify_entry_array_parse(dbwrap_record_get_value(rec),
+					  array);
+	if (!NT_STATUS_IS_OK(status)) {
+		TALLOC_FREE(array);
+		return status;
+	}
+
+	for (i=0; i<array->num_entries; i++) {
+		if ((private_data == array->entries[i].private_data) &&
+		    cluster_id_equal(server, &array->entries[i].server)) {
+			break;
+		}
+	}
+
+	if (i == array->num_entries) {
+		TALLOC_FREE(array);
+		return NT_STATUS_OBJECT_NAME_NOT_FOUND;
+	}
+
+	array->entries[i] = array->entries[array->num_entries-1];
+	array->num_entries -= 1;
+
+	status = notify_entry_array_store(rec, array);
+	TALLOC_FREE(array);
+	return status;
 }
 
 /*
@@ -508,27 +483,16 @@ NTSTATUS notify_add(struct notify_context *notify, struct notify_entry *e0,
 		    void *private_data)
 {
 	struct notify_entry e = *e0;
-	NTSTATUS status;
+	NTSTATUS status = NT_STATUS_OK;
 	char *tmp_path = NULL;
 	struct notify_list *listel;
 	size_t len;
-	int depth;
-	struct db_record *rec;
 
 	/* see if change notify is enabled at all */
 	if (notify == NULL) {
 		return NT_STATUS_NOT_IMPLEMENTED;
 	}
 
-	status = notify_fetch_locked(notify, &rec);
-	NT_STATUS_NOT_OK_RETURN(status);
-
-	status = notify_load(notify, rec);
-	if (!NT_STATUS_IS_OK(status)) {
-		talloc_free(rec);
-		return status;
-	}
-
 	/* cope with /. on the end of the path */
 	len = strlen(e.path);
 	if (len > 1 && e.path[len-1] == '.' && e.path[len-2] == '/') {
@@ -540,8 +504,6 @@ NTSTATUS notify_add(struct notify_context *notify, struct notify_entry *e0,
 		e.path = tmp_path;
 	}
 
-	depth = count_chars(e.path, '/');
-
 	listel = talloc_zero(notify, struct notify_list);
 	if (listel == NULL) {
 		status = NT_STATUS_NO_MEMORY;
@@ -550,7 +512,6 @@ NTSTATUS notify_add(struct notify_context *notify, struct notify_entry *e0,
 
 	listel->private_data = private_data;
 	listel->callback = callback;
-	listel->depth = depth;
 	DLIST_ADD(notify->list, listel);
 
 	/* ignore failures from sys_notify */
@@ -577,11 +538,18 @@ NTSTATUS notify_add(struct notify_context *notify, struct notify_entry *e0,
 	   then we need to install it in the array used for the
 	   intra-samba notify handling */
 	if (e.filter != 0 || e.subdir_filter != 0) {
-		status = notify_add_array(notify, rec, &e, private_data, depth);
+		listel->path = talloc_strdup(listel, e.path);
+		if (listel->path == NULL) {
+			status = NT_STATUS_NO_MEMORY;
+			goto done;
+		}
+		status = notify_add_array(notify, &e, private_data);
+		if (!NT_STATUS_IS_OK(status)) {
+			TALLOC_FREE(listel->path);
+		}
 	}
 
 done:
-	talloc_free(rec);
 	talloc_free(tmp_path);
 
 	return status;
@@ -692,11 +660,8 @@ NTSTATUS notify_remove_onelevel(struct notify_context *notify,
 */
 NTSTATUS notify_remove(struct notify_context *notify, void *private_data)
 {
-	NTSTATUS status;
+	NTSTATUS status = NT_STATUS_OK;
 	struct notify_list *listel;
-	int i, depth;
-	struct notify_depth *d;
-	struct db_record *rec;
 
 	/* see if change notify is enabled at all */
 	if (notify == NULL) {
@@ -713,94 +678,33 @@ NTSTATUS notify_remove(struct notify_context *notify, void *private_data)
 		return NT_STATUS_OBJECT_NAME_NOT_FOUND;
 	}
 
-	depth = listel->depth;
-
-	talloc_free(listel);
-
-	status = notify_fetch_locked(notify, &rec);
-	NT_STATUS_NOT_OK_RETURN(status);
-
-	status = notify_load(notify, rec);
-	if (!NT_STATUS_IS_OK(status)) {
-		talloc_free(rec);
-		return status;
+	if (listel->path != NULL) {
+		status = notify_remove_array(notify,
+					     string_tdb_data(listel->path),
+					     &notify->server, private_data);
 	}
 
-	if (depth >= notify->array->num_depths) {
-		talloc_free(rec);
-		return NT_STATUS_OBJECT_NAME_NOT_FOUND;
-	}
-
-	/* we only have to search at the depth of this element */
-	d = &notify->array->depth[depth];
-
-	for (i=0;i<d->num_entries;i++) {
-		if (private_data == d->entries[i].private_data &&
-		    cluster_id_equal(&notify->server, &d->entries[i].server)) {
-			break;
-		}
-	}
-	if (i == d->num_entries) {
-		talloc_free(rec);
-		return NT_STATUS_OBJECT_NAME_NOT_FOUND;
-	}
-
-	if (i < d->num_entries-1) {
-		memmove(&d->entries[i], &d->entries[i+1], 
-			sizeof(d->entries[i])*(d->num_entries-(i+1)));
-	}
-	d->num_entries--;
-
-	status = notify_save(notify, rec);
-
-	talloc_free(rec);
+	talloc_free(listel);
 
 	return status;
 }
 
 /*
-  remove all notify watches for a messaging server
+  remove all our notify watches
 */
-static NTSTATUS notify_remove_all(struct notify_context *notify,
-				  const struct server_id *server)
+static NTSTATUS notify_remove_all(struct notify_context *notify)
 {
-	NTSTATUS status;
-	int i, depth, del_count=0;
-	struct db_record *rec;
-
-	status = notify_fetch_locked(notify, &rec);
-	NT_STATUS_NOT_OK_RETURN(status);
-
-	status = notify_load(notify, rec);
-	if (!NT_STATUS_IS_OK(status)) {
-		talloc_free(rec);
-		return status;
-	}
+	struct notify_list *listel;
 
-	/* we have to search for all entries across all depths, looking for matches
-	   for the server id */
-	for (depth=0;depth<notify->array->num_depths;depth++) {
-		struct notify_depth *d = &notify->array->depth[depth];
-		for (i=0;i<d->num_entries;i++) {
-			if (cluster_id_equal(server, &d->entries[i].server)) {
-				if (i < d->num_entries-1) {
-					memmove(&d->entries[i], &d->entries[i+1], 
-						sizeof(d->entries[i])*(d->num_entries-(i+1)));
-				}
-				i--;
-				d->num_entries--;
-				del_count++;
-			}
+	for (listel=notify->list;listel;listel=listel->next) {
+		if (listel->path == NULL) {
+			continue;
 		}
+		notify_remove_array(notify, string_tdb_data(listel->path),
+				    &notify->server, listel->private_data);
 	}
 
-	if (del_count > 0) {
-		status = notify_save(notify, rec);
-	}
-
-	talloc_free(rec);
-
-	return status;
+	return NT_STATUS_OK;
 }
 
 
@@ -924,116 +828,118 @@ void notify_onelevel(struct notify_context *notify, uint32_t action,
 	return;
 }
 
-/*
-  trigger a notify message for anyone waiting on a matching event
+struct notify_trigger_dir_state {
+	struct notify_entry_array *array;
+	NTSTATUS status;
+};
+
+static void notify_trigger_dir_parser(TDB_DATA key, TDB_DATA data,
+				      void *private_data)
+{
+	struct notify_trigger_dir_state *state =
+		(struct notify_trigger_dir_state *)private_data;
 
-  This function is called a lot, and needs to be very fast. The unusual data structure
-  and traversal is designed to be fast in the average case, even for large numbers of
-  notifies
+	state->status = notify_entry_array_parse(data, state->array);
+}
+
+/*
+  send the change of path to the watches on one of its parent
+  directories, the first dir_len bytes of path
 */
-void notify_trigger(struct notify_context *notify,
-		    uint32_t action, uint32_t filter, const char *path)
+static void notify_trigger_dir(struct notify_context *notify,
+			       uint32_t action, uint32_t filter,
+			       const char *path, size_t dir_len,
+			       bool subdir)
 {
+	struct notify_trigger_dir_state state;
+	TDB_DATA key = make_tdb_data((const uint8_t *)path, dir_len);
+	bool have_dead_entries = false;
 	NTSTATUS status;
-	int depth;
-	const char *p, *next_p;
-
-	DEBUG(10, ("notify_trigger called action=0x%x, filter=0x%x, "
-		   "path=%s\n", (unsigned)action, (unsigned)filter, path));
+	uint32_t i;
 
-	/* see if change notify is enabled at all */
-	if (notify == NULL) {
+	state.array = talloc_zero(talloc_tos(), struct notify_entry_array);
+	if (state.array == NULL) {
 		return;
 	}
+	state.status = NT_STATUS_OK;
 
- again:
-	status = notify_load(notify, NULL);
-	if (!NT_STATUS_IS_OK(status)) {
+	status = dbwrap_parse_record(notify->db_recursive, key,
+				     notify_trigger_dir_parser, &state);
+	if (!NT_STATUS_IS_OK(status) || !NT_STATUS_IS_OK(state.status)) {
+		TALLOC_FREE(state.array);
 		return;
 	}
 
-	/* loop along the given path, working with each directory depth separately */
-	for (depth=0,p=path;
-	     p && depth < notify->array->num_depths;
-	     p=next_p,depth++) {
-		int p_len = p - path;
-		int min_i, max_i, i;
-		struct notify_depth *d = &notify->array->depth[depth];
-		next_p = strchr(p+1, '/');
-
-		/* see if there are any entries at this depth */
-		if (d->num_entries == 0) continue;
+	for (i=0; i<state.array->num_entries; i++) {
+		struct notify_entry *e = &state.array->entries[i];
 
-		/* try to skip based on the maximum mask. If next_p is
-		 NULL then we know it will be a 'this directory'
-		 match, otherwise it must be a subdir match */
-		if (next_p != NULL) {
-			if (0 == (filter & d->max_mask_subdir)) {
+		if (subdir) {
+			if (0 == (filter & e->subdir_filter)) {
 				continue;
 			}
 		} else {
-			if (0 == (filter & d->max_mask)) {
+			if (0 == (filter & e->filter)) {
 				continue;
 			}
 		}
-
-		/* we know there is an entry here worth looking
-		 for. Use a bisection search to find the first entry
-		 with a matching path */
-		min_i = 0;
-		max_i = d->num_entries-1;
-
-		while (min_i < max_i) {
-			struct notify_entry *e;
-			int cmp;
-			i = (min_i+max_i)/2;
-			e = &d->entries[i];
-			cmp = strncmp(path, e->path, p_len);
-			if (cmp == 0) {
-				if (p_len == e->path_len) {
-					max_i = i;
-				} else {
-					max_i = i-1;
-				}
-			} else if (cmp < 0) {
-				max_i = i-1;
-			} else {
-				min_i = i+1;
-			}
+		status = notify_send(notify, e, path + dir_len + 1, action);
+		if (NT_STATUS_EQUAL(status, NT_STATUS_INVALID_HANDLE)) {
+			/* see notify_onelevel() */
+			e->path = NULL;
+			have_dead_entries = true;
 		}
+	}
 
-		if (min_i != max_i) {
-			/* none match */
+	if (!have_dead_entries) {
+		TALLOC_FREE(state.array);
+		return;
+	}
+
+	for (i=0; i<state.array->num_entries; i++) {
+		struct notify_entry *e = &state.array->entries[i];
+		if (e->path != NULL) {
 			continue;
 		}
+		DEBUG(10, ("Deleting notify entries for process %s because "
+			   "it's gone\n", procid_str_static(&e->server)));
+		notify_remove_array(notify, key, &e->server, e->private_data);
+	}
 
-		/* we now know that the entries start at min_i */
-		for (i=min_i;i<d->num_entries;i++) {
-			struct notify_entry *e = &d->entries[i];
-			if (p_len != e->path_len ||
-			    strncmp(path, e->path, p_len) != 0) break;
-			if (next_p != NULL) {
-				if (0 == (filter & e->subdir_filter)) {
-					continue;
-				}
-			} else {
-				if (0 == (filter & e->filter)) {
-					continue;
-				}
-			}
-			status = notify_send(notify, e,	path + e->path_len + 1,
-					     action);
+	TALLOC_FREE(state.array);
+}
 
-			if (NT_STATUS_EQUAL(
-				    status, NT_STATUS_INVALID_HANDLE)) {
-				struct server_id server = e->server;
+/*
+  trigger a notify message for anyone waiting on a matching event
 
-				DEBUG(10, ("Deleting notify entries for "
-					   "process %s because it's gone\n",
-					   procid_str_static(&e->server)));
-				notify_remove_all(notify, &server);
-				goto again;
-			}
+  This function is called a lot, and needs to be very fast. The watches
+  are stored per directory, so we only look up the directories above
+  path, independent of the number of watches elsewhere.
+*/
+void notify_trigger(struct notify_context *notify,
+		    uint32_t action, uint32_t filter, const char *path)
+{
+	const char *p, *next_p;
+
+	DEBUG(10, ("notify_trigger called action=0x%x, filter=0x%x, "
+		   "path=%s\n", (unsigned)action, (unsigned)filter, path));
+
+	/* see if change notify is enabled at all */
+	if (notify == NULL) {
+		return;
+	}
+
+	/*
+	 * Loop along the given path, every '/' ends a directory that
+	 * might be watched. Only the last one is the directory the
+	 * change happened in, for the others it's a subdir match.
+	 */
+	for (p=strchr(path, '/'); p != NULL; p=next_p) {
+		next_p = strchr(p+1, '/');
+
+		if (p == path) {
+			continue;
 		}
+		notify_trigger_dir(notify, action, filter, path, p - path,
+				   next_p != NULL);
 	}
 }
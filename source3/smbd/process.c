@@ -3274,6 +3274,8 @@ void smbd_process(struct tevent_context *ev_ctx,
 			   MSG_SMB_CLOSE_FILE, msg_close_file);
 	messaging_register(sconn->msg_ctx, sconn,
 			   MSG_SMB_FILE_RENAME, msg_file_was_renamed);
+	messaging_register(sconn->msg_ctx, sconn,
+			   MSG_SMB_REQ_CREDIT_STATS, smbd_smb2_msg_credit_stats);
 
 	id_cache_register_msgs(sconn->msg_ctx);
 	messaging_deregister(sconn->msg_ctx, ID_CACHE_KILL, NULL);
@@ -352,6 +352,7 @@ NTSTATUS filename_convert(TALLOC_CTX *mem_ctx,
 
 /* The following definitions come from smbd/files.c  */
 
+void fsp_set_file_id(files_struct *fsp, struct file_id id);
 NTSTATUS file_new(struct smb_request *req, connection_struct *conn,
 		  files_struct **result);
 void file_close_conn(connection_struct *conn);
@@ -373,6 +374,7 @@ files_struct *file_find_di_next(files_struct *start_fsp);
 bool file_find_subpath(files_struct *dir_fsp);
 void file_sync_all(connection_struct *conn);
 void file_free(struct smb_request *req, files_struct *fsp);
+files_struct *file_fsp_sconn(struct smbd_server_connection *sconn, uint16 fid);
 files_struct *file_fsp(struct smb_request *req, uint16 fid);
 NTSTATUS dup_file_fsp(struct smb_request *req, files_struct *from,
 		      uint32 access_mask, uint32 share_access,
@@ -517,6 +519,8 @@ NTSTATUS sys_notify_watch(struct sys_notify_context *ctx,
 					   void *private_data,
 					   struct notify_event *ev),
 			  void *private_data, void *handle);
+struct sys_notify_context *smbd_cache_notify_context(connection_struct *conn);
+bool sys_notify_drain(struct sys_notify_context *ctx);
 
 /* The following definitions come from smbd/notify_inotify.c  */
 
@@ -527,6 +531,7 @@ NTSTATUS inotify_watch(struct sys_notify_context *ctx,
 					struct notify_event *ev),
 		       void *private_data,
 		       void *handle_p);
+bool inotify_drain(struct sys_notify_context *ctx);
 
 /* The following definitions come from smbd/notify_internal.c  */
 
@@ -1021,9 +1026,26 @@ size_t srvstr_push_fn(const char *base_ptr, uint16 smb_flags2, void *dest,
 		      const char *src, int dest_len, int flags);
 ssize_t message_push_string(uint8 **outbuf, const char *str, int flags);
 
+/* The following definitions come from smbd/name_index.c  */
+
+int name_index_get_real_filename(connection_struct *conn, const char *path,
+				 const char *name, TALLOC_CTX *mem_ctx,
+				 char **found_name);
+void name_index_update(connection_struct *conn, uint32_t action,
+		       const char *parent, const char *name);
+
+/* The following definitions come from smbd/dir_stat_cache.c  */
+
+bool dir_stat_cache_parent_init(TALLOC_CTX *mem_ctx);
+int dir_stat_cache_stat(connection_struct *conn, struct smb_filename *smb_fname);
+void dir_stat_cache_update(connection_struct *conn, const char *parent,
+			   const char *name);
+
 /* The following definitions come from smbd/statcache.c  */
 
-void stat_cache_add( const char *full_orig_name,
+bool stat_cache_parent_init(TALLOC_CTX *mem_ctx);
+void stat_cache_add(connection_struct *conn,
+		const char *full_orig_name,
 		char *translated_path,
 		bool case_sensitive);
 bool stat_cache_lookup(connection_struct *conn,
@@ -1142,6 +1164,10 @@ void vfs_remove_fsp_extension(vfs_handle_struct *handle, files_struct *fsp);
 void *vfs_memctx_fsp_extension(vfs_handle_struct *handle, files_struct *fsp);
 void *vfs_fetch_fsp_extension(vfs_handle_struct *handle, files_struct *fsp);
 bool smbd_vfs_init(connection_struct *conn);
+bool vfs_plain_fd_io(connection_struct *conn);
+bool vfs_plain_fd_sendfile(connection_struct *conn);
+bool vfs_plain_dir_stat(connection_struct *conn);
+bool vfs_default_notify_watch(connection_struct *conn);
 NTSTATUS vfs_file_exist(connection_struct *conn, struct smb_filename *smb_fname);
 ssize_t vfs_read_data(files_struct *fsp, char *buf, size_t byte_count);
 ssize_t vfs_pread_data(files_struct *fsp, char *buf,
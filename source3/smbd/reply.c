@@ -6243,6 +6243,12 @@ NTSTATUS rename_internals_fsp(connection_struct *conn,
 		notify_rename(conn, fsp->is_directory, fsp->fsp_name,
 			      smb_fname_dst);
 
+		if (fsp->is_directory) {
+			/* Cached names below the old path are now wrong. */
+			send_stat_cache_delete_message(conn->sconn->msg_ctx,
+						       fsp->fsp_name->base_name);
+		}
+
 		rename_open_files(conn, lck, fsp->name_hash, smb_fname_dst);
 
 		/*
@@ -337,6 +337,11 @@ static void remove_child_pid(struct smbd_parent_context *parent,
 						parent);
 			DEBUG(1,("Scheduled cleanup of brl and lock database after unclean shutdown\n"));
 		}
+
+		/* it did not get to free its broadcast slot */
+		if (parent->msg_ctx->bcast != NULL) {
+			messaging_bcast_forget(parent->msg_ctx->bcast, pid);
+		}
 	}
 
 	child_id = pid_to_procid(pid);
@@ -1289,6 +1294,14 @@ extern void build_options(bool screen);
 		exit(1);
 	}
 
+	if (!stat_cache_parent_init(ev_ctx)) {
+		exit(1);
+	}
+
+	if (!dir_stat_cache_parent_init(ev_ctx)) {
+		exit(1);
+	}
+
 	if (!W_ERROR_IS_OK(registry_init_full()))
 		exit(1);
 
@@ -226,11 +226,19 @@ NTSTATUS smbd_smb2_request_process_negprot(struct smbd_smb2_request *req)
 	}
 
 	/*
-	 * Unless we implement SMB2_CAP_LARGE_MTU,
-	 * 0x10000 (65536) is the maximum allowed message size
+	 * Without SMB2_CAP_LARGE_MTU, 0x10000 (65536) is the maximum
+	 * allowed message size. With it a request may use up to
+	 * 0x800000 (8 MB) if its credit charge covers the size.
 	 */
 	max_limit = 0x10000;
 
+	if ((protocol >= PROTOCOL_SMB2_10) &&
+	    (dialect != SMB2_DIALECT_REVISION_2FF)) {
+		capabilities |= SMB2_CAP_LARGE_MTU;
+		req->sconn->smb2.supports_multicredit = true;
+		max_limit = 0x800000;
+	}
+
 	max_trans = MIN(max_limit, max_trans);
 	max_read  = MIN(max_limit, max_read);
 	max_write = MIN(max_limit, max_write);
@@ -261,8 +269,8 @@ NTSTATUS smbd_smb2_request_process_negprot(struct smbd_smb2_request *req)
 	SIVAL(outbody.data, 0x18,
 	      capabilities);			/* capabilities */
 	SIVAL(outbody.data, 0x1C, max_trans);	/* max transact size */
-	SIVAL(outbody.data, 0x20, max_trans);	/* max read size */
-	SIVAL(outbody.data, 0x24, max_trans);	/* max write size */
+	SIVAL(outbody.data, 0x20, max_read);	/* max read size */
+	SIVAL(outbody.data, 0x24, max_write);	/* max write size */
 	SBVAL(outbody.data, 0x28, 0);		/* system time */
 	SBVAL(outbody.data, 0x30, 0);		/* server start time */
 	SSVAL(outbody.data, 0x38,
@@ -80,6 +80,11 @@ NTSTATUS smbd_smb2_request_process_read(struct smbd_smb2_request *req)
 		return smbd_smb2_request_error(req, NT_STATUS_INVALID_PARAMETER);
 	}
 
+	status = smbd_smb2_request_verify_creditcharge(req, in_length);
+	if (!NT_STATUS_IS_OK(status)) {
+		return smbd_smb2_request_error(req, status);
+	}
+
 	if (req->compat_chain_fsp) {
 		/* skip check */
 	} else if (in_file_id_persistent != in_file_id_volatile) {
@@ -177,6 +182,11 @@ struct smbd_smb2_read_state {
 	uint32_t in_minimum;
 	DATA_BLOB out_data;
 	uint32_t out_remaining;
+	/* Used when the pread runs on a "smb2 worker threads" helper */
+	struct smbd_smb2_read_job *job;
+	struct lock_struct lock;
+	struct file_id file_id;
+	unsigned long gen_id;
 };
 
 /* struct smbd_smb2_read_state destructor. Send the SMB2_READ data. */
@@ -197,13 +207,41 @@ static int smb2_sendfile_send_data(struct smbd_smb2_read_state *state)
 		(int)nread,
 		fsp_str_dbg(fsp) ));
 
+	if (nread == -1 && (errno == ENOSYS || errno == EINTR)) {
+		int saved_errno = errno;
+
+		/*
+		 * Special hack for broken systems with no working
+		 * sendfile. Don't try it again for this share.
+		 */
+		set_use_sendfile(SNUM(fsp->conn), false);
+		errno = saved_errno;
+
+		/*
+		 * Try to move the pages via a pipe with splice. Unlike
+		 * fake_sendfile this still never copies the data into
+		 * userspace. That reads the fd behind the VFS' back, so
+		 * only do it if the VFS would read the fd as well. A
+		 * module may fail sendfile on purpose to get a file
+		 * read through its pread.
+		 */
+		if (vfs_plain_fd_sendfile(fsp->conn)) {
+			nread = sys_splicefile(fsp->conn->sconn->sock,
+					       fsp->fh->fd,
+					       in_offset,
+					       in_length);
+			DEBUG(10,("smb2_sendfile_send_data: sys_splicefile "
+				"returned %d on file %s\n",
+				(int)nread,
+				fsp_str_dbg(fsp) ));
+		}
+	}
+
 	if (nread == -1) {
 		if (errno == ENOSYS || errno == EINTR) {
 			/*
-			 * Special hack for broken systems with no working
-			 * sendfile. Fake this up by doing read/write calls.
-			*/
-			set_use_sendfile(SNUM(fsp->conn), false);
+			 * Fake this up by doing read/write calls.
+			 */
 			nread = fake_sendfile(fsp, in_offset, in_length);
 			if (nread == -1) {
 				DEBUG(0,("smb2_sendfile_send_data: "
@@ -312,6 +350,121 @@ static NTSTATUS schedule_smb2_sendfile_read(struct smbd_smb2_request *smb2req,
 	return NT_STATUS_OK;
 }
 
+/*******************************************************************
+ State handed to a "smb2 worker threads" helper thread. The job
+ owns a dup of the file descriptor, so that a close of the fsp
+ while the job is running can never make us read from a reused fd.
+ This calls pread directly and does not go through the VFS, so it
+ is only used when vfs_plain_fd_io() says the VFS would do the same.
+*******************************************************************/
+
+struct smbd_smb2_read_job {
+	int fd;
+	uint8_t *buf;
+	size_t length;
+	SMB_OFF_T offset;
+	ssize_t nread;
+	int err;
+};
+
+static int smbd_smb2_read_job_destructor(struct smbd_smb2_read_job *job)
+{
+	if (job->fd != -1) {
+		close(job->fd);
+		job->fd = -1;
+	}
+	return 0;
+}
+
+/* Runs in a helper thread, must not touch anything but the job. */
+static void smbd_smb2_read_job_fn(void *private_data)
+{
+	struct smbd_smb2_read_job *job =
+		(struct smbd_smb2_read_job *)private_data;
+
+	job->nread = sys_pread(job->fd, job->buf, job->length, job->offset);
+	if (job->nread == -1) {
+		job->err = errno;
+	} else {
+		job->err = 0;
+	}
+}
+
+static void smbd_smb2_read_job_done(struct tevent_req *subreq);
+
+/*******************************************************************
+ Hand a read to the per-connection worker threads. On success the
+ caller's strict lock is kept until the job has finished. Returns
+ NT_STATUS_RETRY if the read has to be done synchronously.
+*******************************************************************/
+
+static NTSTATUS schedule_smb2_worker_read(struct tevent_req *req,
+					struct smbd_smb2_read_state *state,
+					const struct lock_struct *lock)
+{
+	struct smbd_server_connection *sconn = state->smb2req->sconn;
+	files_struct *fsp = state->fsp;
+	struct smbd_smb2_read_job *job = NULL;
+	struct tevent_req *subreq = NULL;
+
+	if ((sconn->smb2.workers == NULL) ||
+			(fsp->base_fsp != NULL) ||
+			(fsp->wcp != NULL) ||
+			(fsp->print_file != NULL) ||
+			(fsp->fh->fd == -1) ||
+			!vfs_plain_fd_io(fsp->conn)) {
+		return NT_STATUS_RETRY;
+	}
+
+	job = talloc_zero(state, struct smbd_smb2_read_job);
+	if (job == NULL) {
+		return NT_STATUS_NO_MEMORY;
+	}
+	job->fd = -1;
+	job->length = state->in_length;
+	job->offset = (SMB_OFF_T)state->in_offset;
+
+	job->buf = talloc_array(job, uint8_t, state->in_length);
+	if (state->in_length > 0 && job->buf == NULL) {
+		TALLOC_FREE(job);
+		return NT_STATUS_NO_MEMORY;
+	}
+
+	job->fd = dup(fsp->fh->fd);
+	if (job->fd == -1) {
+		DEBUG(5,("schedule_smb2_worker_read: dup failed: %s\n",
+			strerror(errno)));
+		TALLOC_FREE(job);
+		return NT_STATUS_RETRY;
+	}
+	talloc_set_destructor(job, smbd_smb2_read_job_destructor);
+
+	/*
+	 * From here on the job belongs to fncall until it finishes,
+	 * fncall keeps it around if we go away in the meantime.
+	 */
+	subreq = fncall_send(state, sconn->ev_ctx, sconn->smb2.workers,
+			     smbd_smb2_read_job_fn, job);
+	if (subreq == NULL) {
+		TALLOC_FREE(job);
+		return NT_STATUS_NO_MEMORY;
+	}
+	tevent_req_set_callback(subreq, smbd_smb2_read_job_done, req);
+
+	state->job = job;
+	state->lock = *lock;
+	state->file_id = fsp->file_id;
+	state->gen_id = fsp->fh->gen_id;
+
+	DEBUG(10,("smb2: scheduled worker read for file %s, "
+		"offset %.0f, len = %u\n",
+		fsp_str_dbg(fsp),
+		(double)state->in_offset,
+		(unsigned int)state->in_length));
+
+	return NT_STATUS_OK;
+}
+
 static void smbd_smb2_read_pipe_done(struct tevent_req *subreq);
 
 /*******************************************************************
@@ -519,6 +672,17 @@ static struct tevent_req *smbd_smb2_read_send(TALLOC_CTX *mem_ctx,
 		}
 	}
 
+	/* Let a worker thread do the read if we're configured to. */
+	status = schedule_smb2_worker_read(req, state, &lock);
+	if (NT_STATUS_IS_OK(status)) {
+		return req;
+	}
+	if (!NT_STATUS_EQUAL(status, NT_STATUS_RETRY)) {
+		SMB_VFS_STRICT_UNLOCK(conn, fsp, &lock);
+		tevent_req_nterror(req, status);
+		return tevent_req_post(req, ev);
+	}
+
 	/* Ok, read into memory. Allocate the out buffer. */
 	state->out_data = data_blob_talloc(state, NULL, in_length);
 	if (in_length > 0 && tevent_req_nomem(state->out_data.data, req)) {
@@ -553,6 +717,76 @@ static struct tevent_req *smbd_smb2_read_send(TALLOC_CTX *mem_ctx,
 	return tevent_req_post(req, ev);
 }
 
+static void smbd_smb2_read_job_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq,
+				 struct tevent_req);
+	struct smbd_smb2_read_state *state = tevent_req_data(req,
+					     struct smbd_smb2_read_state);
+	struct smbd_smb2_read_job *job = state->job;
+	files_struct *fsp = NULL;
+	NTSTATUS status;
+	ssize_t nread;
+	int err = 0;
+	int ret;
+
+	ret = fncall_recv(subreq, &err);
+	/* On error the job went away together with subreq. */
+	TALLOC_FREE(subreq);
+	state->job = NULL;
+
+	/*
+	 * The client might have closed the file while the job was
+	 * running, find it again by its unique generation number.
+	 */
+	fsp = file_find_dif(state->smb2req->sconn,
+			    state->file_id,
+			    state->gen_id);
+	if (fsp != state->fsp) {
+		DEBUG(3,("smb2: file closed whilst worker read "
+			"outstanding\n"));
+		if (ret == 0) {
+			TALLOC_FREE(job);
+		}
+		tevent_req_nterror(req, NT_STATUS_FILE_CLOSED);
+		return;
+	}
+
+	SMB_VFS_STRICT_UNLOCK(fsp->conn, fsp, &state->lock);
+
+	if (ret == -1) {
+		tevent_req_nterror(req, map_nt_error_from_unix(err));
+		return;
+	}
+
+	state->out_data.data = talloc_move(state, &job->buf);
+	nread = job->nread;
+	err = job->err;
+	TALLOC_FREE(job);
+
+	status = smb2_read_complete(req, nread, err);
+
+	if (nread > 0) {
+		fsp->fh->pos = state->in_offset + nread;
+		fsp->fh->position_information = fsp->fh->pos;
+	}
+
+	DEBUG(10,("smb2: worker read completed for file %s, "
+		"offset %.0f, len = %u (errcode = %d, NTSTATUS = %s)\n",
+		fsp_str_dbg(fsp),
+		(double)state->in_offset,
+		(unsigned int)nread,
+		err,
+		nt_errstr(status)));
+
+	if (!NT_STATUS_IS_OK(status)) {
+		tevent_req_nterror(req, status);
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
 static void smbd_smb2_read_pipe_done(struct tevent_req *subreq)
 {
 	struct tevent_req *req = tevent_req_callback_data(subreq,
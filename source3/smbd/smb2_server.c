@@ -29,6 +29,7 @@
 #include "../lib/util/bitmap.h"
 #include "../librpc/gen_ndr/krb5pac.h"
 #include "auth.h"
+#include "messages.h"
 
 #define OUTVEC_ALLOC_SIZE (SMB2_HDR_BODY + 9)
 
@@ -117,12 +118,23 @@ static NTSTATUS smbd_initialize_smb2(struct smbd_server_connection *sconn)
 	sconn->smb2.seqnum_low = 0;
 	sconn->smb2.credits_granted = 0;
 	sconn->smb2.max_credits = lp_smb2_max_credits();
+	sconn->smb2.credits_window_min = MIN(DEFAULT_SMB2_MIN_CREDIT_WINDOW,
+					     sconn->smb2.max_credits);
+	sconn->smb2.credits_window = sconn->smb2.credits_window_min;
 	sconn->smb2.credits_bitmap = bitmap_talloc(sconn,
 			DEFAULT_SMB2_MAX_CREDIT_BITMAP_FACTOR*sconn->smb2.max_credits);
 	if (sconn->smb2.credits_bitmap == NULL) {
 		return NT_STATUS_NO_MEMORY;
 	}
 
+	if (lp_smb2_worker_threads() > 0) {
+		sconn->smb2.workers = fncall_context_init(sconn,
+						lp_smb2_worker_threads());
+		if (sconn->smb2.workers == NULL) {
+			return NT_STATUS_NO_MEMORY;
+		}
+	}
+
 	ret = tstream_bsd_existing_socket(sconn, sconn->sock,
 					  &sconn->smb2.stream);
 	if (ret == -1) {
@@ -299,70 +311,129 @@ static NTSTATUS smbd_smb2_request_create(struct smbd_server_connection *sconn,
 	return NT_STATUS_OK;
 }
 
+/*
+ * Number of credits a request consumes. Before SMB 2.1 the field is
+ * the reserved epoch, every request costs one credit.
+ */
+static uint16_t smb2_credit_charge(struct smbd_server_connection *sconn,
+				   const uint8_t *inhdr)
+{
+	uint16_t credit_charge = 1;
+
+	if (sconn->smb2.supports_multicredit) {
+		credit_charge = SVAL(inhdr, SMB2_HDR_CREDIT_CHARGE);
+		credit_charge = MAX(credit_charge, 1);
+	}
+	return credit_charge;
+}
+
 static bool smb2_validate_message_id(struct smbd_server_connection *sconn,
 				const uint8_t *inhdr)
 {
 	uint64_t message_id = BVAL(inhdr, SMB2_HDR_MESSAGE_ID);
 	struct bitmap *credits_bm = sconn->smb2.credits_bitmap;
 	uint16_t opcode = IVAL(inhdr, SMB2_HDR_OPCODE);
+	uint64_t window = sconn->smb2.max_credits *
+		DEFAULT_SMB2_MAX_CREDIT_BITMAP_FACTOR;
+	uint16_t credit_charge;
 	unsigned int bitmap_offset;
+	uint16_t i;
 
 	if (opcode == SMB2_OP_CANCEL) {
 		/* SMB2_CANCEL requests by definition resend messageids. */
 		return true;
 	}
 
+	credit_charge = smb2_credit_charge(sconn, inhdr);
+
+	/*
+	 * seqnum_low is the lowest message_id the client has not
+	 * used yet, the bitmap has the used ones above it. A request
+	 * with a credit charge of n uses n message_ids.
+	 */
 	if (message_id < sconn->smb2.seqnum_low ||
-			message_id > (sconn->smb2.seqnum_low +
-			(sconn->smb2.max_credits * DEFAULT_SMB2_MAX_CREDIT_BITMAP_FACTOR))) {
+	    message_id > UINT64_MAX - credit_charge ||
+	    message_id + credit_charge > sconn->smb2.seqnum_low + window) {
 		DEBUG(0,("smb2_validate_message_id: bad message_id "
-			"%llu (low = %llu, max = %lu)\n",
+			"%llu charge %u (low = %llu, max = %lu)\n",
 			(unsigned long long)message_id,
+			(unsigned int)credit_charge,
 			(unsigned long long)sconn->smb2.seqnum_low,
 			(unsigned long)sconn->smb2.max_credits ));
 		return false;
 	}
 
-	if (sconn->smb2.credits_granted == 0) {
+	if (sconn->smb2.credits_granted < credit_charge) {
 		DEBUG(0,("smb2_validate_message_id: client used more "
-			 "credits than granted message_id (%llu)\n",
-			 (unsigned long long)message_id));
+			 "credits than granted message_id (%llu) "
+			 "charge %u granted %u\n",
+			 (unsigned long long)message_id,
+			 (unsigned int)credit_charge,
+			 (unsigned int)sconn->smb2.credits_granted));
 		return false;
 	}
 
-	/* client just used a credit. */
-	sconn->smb2.credits_granted -= 1;
+	for (i=0; i<credit_charge; i++) {
+		bitmap_offset = (unsigned int)((message_id + i) % window);
+		if (bitmap_query(credits_bm, bitmap_offset)) {
+			DEBUG(0,("smb2_validate_message_id: duplicate "
+				"message_id %llu (bm offset %u)\n",
+				(unsigned long long)(message_id + i),
+				bitmap_offset));
+			return false;
+		}
+	}
 
-	/* Mark the message_id as seen in the bitmap. */
-	bitmap_offset = (unsigned int)(message_id %
-			(uint64_t)(sconn->smb2.max_credits * DEFAULT_SMB2_MAX_CREDIT_BITMAP_FACTOR));
-	if (bitmap_query(credits_bm, bitmap_offset)) {
-		DEBUG(0,("smb2_validate_message_id: duplicate message_id "
-			"%llu (bm offset %u)\n",
-			(unsigned long long)message_id,
-			bitmap_offset));
-		return false;
+	/* client just used the credits. */
+	sconn->smb2.credits_granted -= credit_charge;
+
+	/* Mark the message_ids as seen in the bitmap. */
+	for (i=0; i<credit_charge; i++) {
+		bitmap_offset = (unsigned int)((message_id + i) % window);
+		bitmap_set(credits_bm, bitmap_offset);
 	}
-	bitmap_set(credits_bm, bitmap_offset);
 
-	if (message_id == sconn->smb2.seqnum_low + 1) {
-		/* Move the window forward by all the message_id's
-		   already seen. */
-		while (bitmap_query(credits_bm, bitmap_offset)) {
-			DEBUG(10,("smb2_validate_message_id: clearing "
-				"id %llu (position %u) from bitmap\n",
-				(unsigned long long)(sconn->smb2.seqnum_low + 1),
-				bitmap_offset ));
-			bitmap_clear(credits_bm, bitmap_offset);
-			sconn->smb2.seqnum_low += 1;
-			bitmap_offset = (bitmap_offset + 1) %
-				(sconn->smb2.max_credits * DEFAULT_SMB2_MAX_CREDIT_BITMAP_FACTOR);
-		}
+	/* Move the window forward by all the message_id's already seen. */
+	bitmap_offset = (unsigned int)(sconn->smb2.seqnum_low % window);
+	while (bitmap_query(credits_bm, bitmap_offset)) {
+		DEBUG(10,("smb2_validate_message_id: clearing "
+			"id %llu (position %u) from bitmap\n",
+			(unsigned long long)sconn->smb2.seqnum_low,
+			bitmap_offset ));
+		bitmap_clear(credits_bm, bitmap_offset);
+		sconn->smb2.seqnum_low += 1;
+		bitmap_offset = (bitmap_offset + 1) % window;
 	}
 
 	return true;
 }
 
+/*
+ * Check that the credit charge of the current request covers its
+ * payload, one credit per 64k of the larger of the request and the
+ * response size.
+ */
+NTSTATUS smbd_smb2_request_verify_creditcharge(struct smbd_smb2_request *req,
+					       uint32_t data_length)
+{
+	const uint8_t *inhdr;
+	uint16_t credit_charge;
+	uint32_t needed_charge;
+
+	inhdr = (const uint8_t *)req->in.vector[req->current_idx].iov_base;
+	credit_charge = smb2_credit_charge(req->sconn, inhdr);
+
+	needed_charge = (MAX(data_length, 1) - 1) / 65536 + 1;
+
+	if (needed_charge > credit_charge) {
+		DEBUG(2, ("CreditCharge too low, given %u, needed %u\n",
+			  (unsigned int)credit_charge,
+			  (unsigned int)needed_charge));
+		return NT_STATUS_INVALID_PARAMETER;
+	}
+	return NT_STATUS_OK;
+}
+
 static NTSTATUS smbd_smb2_request_validate(struct smbd_smb2_request *req)
 {
 	int count;
@@ -453,13 +524,16 @@ static void smb2_set_operation_credit(struct smbd_server_connection *sconn,
 	const uint8_t *inhdr = (const uint8_t *)in_vector->iov_base;
 	uint8_t *outhdr = (uint8_t *)out_vector->iov_base;
 	uint16_t credits_requested;
+	uint16_t credit_charge;
 	uint32_t out_flags;
 	uint16_t credits_granted = 0;
 
 	credits_requested = SVAL(inhdr, SMB2_HDR_CREDIT);
+	credit_charge = smb2_credit_charge(sconn, inhdr);
 	out_flags = IVAL(outhdr, SMB2_HDR_FLAGS);
 
 	SMB_ASSERT(sconn->smb2.max_credits >= sconn->smb2.credits_granted);
+	SMB_ASSERT(sconn->smb2.max_credits >= sconn->smb2.credits_window);
 
 	if (out_flags & SMB2_HDR_FLAG_ASYNC) {
 		/*
@@ -470,12 +544,13 @@ static void smb2_set_operation_credit(struct smbd_server_connection *sconn,
 		credits_requested = 0;
 	}
 
-	if (credits_requested) {
+	if (credits_requested &&
+	    sconn->smb2.credits_granted < sconn->smb2.credits_window) {
 		uint16_t modified_credits_requested;
 		uint32_t multiplier;
 
 		/*
-		 * Split up max_credits into 1/16ths, and then scale
+		 * Split up the credit window into 1/16ths, and then scale
 		 * the requested credits by how many 16ths have been
 		 * currently granted. Less than 1/16th == grant all
 		 * requested (100%), scale down as more have been
@@ -483,16 +558,24 @@ static void smb2_set_operation_credit(struct smbd_server_connection *sconn,
 		 * asked for at least 1. JRA.
 		 */
 
-		multiplier = 16 - (((sconn->smb2.credits_granted * 16) / sconn->smb2.max_credits) % 16);
+		multiplier = 16 - ((sconn->smb2.credits_granted * 16) / sconn->smb2.credits_window);
 
 		modified_credits_requested = (multiplier * credits_requested) / 16;
 		if (modified_credits_requested == 0) {
 			modified_credits_requested = 1;
 		}
 
+		/*
+		 * Give back what a multi-credit request used if the
+		 * client asks for it, otherwise a client doing large
+		 * reads and writes would see its window shrink.
+		 */
+		modified_credits_requested = MAX(modified_credits_requested,
+					MIN(credits_requested, credit_charge));
+
 		/* Remember what we gave out. */
 		credits_granted = MIN(modified_credits_requested,
-					(sconn->smb2.max_credits - sconn->smb2.credits_granted));
+					(sconn->smb2.credits_window - sconn->smb2.credits_granted));
 	}
 
 	if (credits_granted == 0 && sconn->smb2.credits_granted == 0) {
@@ -503,6 +586,7 @@ static void smb2_set_operation_credit(struct smbd_server_connection *sconn,
 
 	SSVAL(outhdr, SMB2_HDR_CREDIT, credits_granted);
 	sconn->smb2.credits_granted += credits_granted;
+	sconn->smb2.credit_stats.credits += credits_granted;
 
 	DEBUG(10,("smb2_set_operation_credit: requested %u, "
 		"granted %u, total granted %u\n",
@@ -511,14 +595,114 @@ static void smb2_set_operation_credit(struct smbd_server_connection *sconn,
 		(unsigned int)sconn->smb2.credits_granted ));
 }
 
+/*
+ * The aio slots and the worker threads are shared by everything this
+ * process does, don't hand out more credits while they are backed up.
+ */
+
+static bool smb2_credit_backlog(struct smbd_server_connection *sconn)
+{
+	if (aio_pending_size > 0 &&
+	    outstanding_aio_calls * 4 >= aio_pending_size * 3) {
+		return true;
+	}
+	if (sconn->smb2.workers != NULL &&
+	    fncall_num_pending(sconn->smb2.workers) >
+	    2 * lp_smb2_worker_threads()) {
+		return true;
+	}
+	return false;
+}
+
+/*
+ * Adjust the credit window when a response goes out. The window
+ * grows by the credits a request used if it did not take much longer
+ * than the ones before it, and loses a quarter at most once per
+ * average request time while there is a backlog. Requests that went
+ * async waited for something else (a lock, a notify, an oplock break)
+ * and don't say anything about how busy we are.
+ */
+
+static void smb2_credit_window_update(struct smbd_server_connection *sconn,
+				      const struct smbd_smb2_request *inreq,
+				      bool went_async)
+{
+	struct timespec now;
+	uint64_t latency;
+	uint32_t charge = 0;
+	int idx;
+
+	clock_gettime_mono(&now);
+	sconn->smb2.credit_stats.requests += 1;
+
+	if (smb2_credit_backlog(sconn)) {
+		int64_t interval;
+
+		interval = MAX(sconn->smb2.credits_latency_usec, 1000);
+		interval *= 1000;
+		if (nsec_time_diff(&now, &sconn->smb2.credits_window_shrunk)
+		    < interval) {
+			return;
+		}
+		sconn->smb2.credits_window_shrunk = now;
+
+		if (sconn->smb2.credits_window > sconn->smb2.credits_window_min) {
+			sconn->smb2.credits_window = MAX(
+				sconn->smb2.credits_window_min,
+				sconn->smb2.credits_window -
+				sconn->smb2.credits_window / 4);
+			sconn->smb2.credit_stats.shrunk += 1;
+		}
+		return;
+	}
+
+	if (went_async) {
+		return;
+	}
+
+	latency = nsec_time_diff(&now, &inreq->request_time) / 1000;
+	latency = MIN(latency, UINT32_MAX / 8);
+
+	if (sconn->smb2.credits_latency_usec == 0) {
+		sconn->smb2.credits_latency_usec = MAX(latency, 1);
+	} else {
+		bool slow = latency > 2 * sconn->smb2.credits_latency_usec;
+
+		sconn->smb2.credits_latency_usec =
+			(7 * (uint64_t)sconn->smb2.credits_latency_usec
+			 + latency) / 8;
+		if (slow) {
+			return;
+		}
+	}
+
+	if (sconn->smb2.credits_window == sconn->smb2.max_credits) {
+		return;
+	}
+
+	for (idx=1; idx < inreq->in.vector_count; idx += 3) {
+		charge += smb2_credit_charge(
+			sconn, (const uint8_t *)inreq->in.vector[idx].iov_base);
+	}
+
+	sconn->smb2.credits_window = MIN(sconn->smb2.max_credits,
+					 sconn->smb2.credits_window + charge);
+	sconn->smb2.credit_stats.grown += 1;
+}
+
 static void smb2_calculate_credits(const struct smbd_smb2_request *inreq,
 				struct smbd_smb2_request *outreq)
 {
 	int count, idx;
 	uint16_t total_credits = 0;
+	const uint8_t *lasthdr;
 
 	count = outreq->out.vector_count;
 
+	lasthdr = (const uint8_t *)outreq->out.vector[count-3].iov_base;
+	smb2_credit_window_update(outreq->sconn, inreq,
+			IVAL(lasthdr, SMB2_HDR_FLAGS) & SMB2_HDR_FLAG_ASYNC);
+
 	for (idx=1; idx < count; idx += 3) {
 		uint8_t *outhdr = (uint8_t *)outreq->out.vector[idx].iov_base;
 		smb2_set_operation_credit(outreq->sconn,
@@ -552,6 +736,8 @@ static NTSTATUS smbd_smb2_request_setup_out(struct smbd_smb2_request *req)
 	vector[0].iov_len	= 4;
 	SIVAL(req->out.nbt_hdr, 0, 0);
 
+	clock_gettime_mono(&req->request_time);
+
 	for (idx=1; idx < count; idx += 3) {
 		const uint8_t *inhdr = NULL;
 		uint32_t in_flags;
@@ -1283,6 +1469,12 @@ NTSTATUS smbd_smb2_request_verify_sizes(struct smbd_smb2_request *req,
 	case SMB2_OP_GETINFO:
 		min_dyn_size = 0;
 		break;
+	case SMB2_OP_WRITE:
+		if (req->sconn->smb2.unread_bytes != 0) {
+			/* The data is still in the socket */
+			min_dyn_size = 0;
+		}
+		break;
 	}
 
 	/*
@@ -2202,9 +2394,112 @@ static void smbd_smb2_oplock_break_writev_done(struct tevent_req *subreq)
 struct smbd_smb2_request_read_state {
 	size_t missing;
 	bool asked_for_header;
+	bool doing_receivefile;
 	struct smbd_smb2_request *smb2_req;
 };
 
+/*
+ * Check if a single (non compound) WRITE is big enough to leave its
+ * data in the socket and have it written to the file with
+ * SMB_VFS_RECVFILE. We only have the header at this point, the body
+ * is checked by smbd_smb2_request_recvfile_ok().
+ */
+static bool smbd_smb2_request_is_recvfile(struct smbd_server_connection *sconn,
+					  const uint8_t *hdr,
+					  size_t body_size,
+					  size_t dyn_size)
+{
+	size_t min_recv_size = lp_min_receive_file_size();
+	uint32_t flags = IVAL(hdr, SMB2_HDR_FLAGS);
+
+	if (min_recv_size == 0) {
+		return false;
+	}
+	if (SVAL(hdr, SMB2_HDR_OPCODE) != SMB2_OP_WRITE) {
+		return false;
+	}
+	if (IVAL(hdr, SMB2_HDR_NEXT_COMMAND) != 0) {
+		return false;
+	}
+	/*
+	 * Signed requests need the data to check the signature
+	 * before anything is written.
+	 */
+	if (flags & (SMB2_HDR_FLAG_SIGNED|SMB2_HDR_FLAG_CHAINED)) {
+		return false;
+	}
+	if (body_size != 0x30) {
+		return false;
+	}
+	if (dyn_size < min_recv_size) {
+		return false;
+	}
+	if (dyn_size > sconn->smb2.max_write) {
+		return false;
+	}
+	return true;
+}
+
+/*
+ * Validate the session, tcon and file id of a WRITE that's a
+ * recvfile candidate. If this fails the data is read into memory
+ * as usual and the normal processing reports the error.
+ */
+static bool smbd_smb2_request_recvfile_ok(struct smbd_server_connection *sconn,
+					  const uint8_t *hdr,
+					  const uint8_t *body,
+					  size_t dyn_size)
+{
+	struct smbd_smb2_session *session;
+	struct smbd_smb2_tcon *tcon;
+	files_struct *fsp;
+	uint64_t in_file_id_persistent;
+	uint64_t in_file_id_volatile;
+	void *p;
+
+	if (SVAL(body, 0x02) != (SMB2_HDR_BODY + 0x30)) {
+		return false;
+	}
+	if (IVAL(body, 0x04) != dyn_size) {
+		return false;
+	}
+
+	p = idr_find(sconn->smb2.sessions.idtree,
+		     BVAL(hdr, SMB2_HDR_SESSION_ID));
+	if (p == NULL) {
+		return false;
+	}
+	session = talloc_get_type_abort(p, struct smbd_smb2_session);
+	if (!NT_STATUS_IS_OK(session->status) || session->do_signing) {
+		return false;
+	}
+
+	p = idr_find(session->tcons.idtree, IVAL(hdr, SMB2_HDR_TID));
+	if (p == NULL) {
+		return false;
+	}
+	tcon = talloc_get_type_abort(p, struct smbd_smb2_tcon);
+	if (IS_IPC(tcon->compat_conn) || IS_PRINT(tcon->compat_conn)) {
+		return false;
+	}
+
+	in_file_id_persistent = BVAL(body, 0x10);
+	in_file_id_volatile = BVAL(body, 0x18);
+	if (in_file_id_persistent != in_file_id_volatile) {
+		return false;
+	}
+
+	fsp = file_fsp_sconn(sconn, (uint16_t)in_file_id_volatile);
+	if (fsp == NULL ||
+			fsp->conn != tcon->compat_conn ||
+			fsp->vuid != session->vuid ||
+			fsp->is_directory ||
+			fsp->fh->fd == -1) {
+		return false;
+	}
+	return true;
+}
+
 static int smbd_smb2_request_next_vector(struct tstream_context *stream,
 					 void *private_data,
 					 TALLOC_CTX *mem_ctx,
@@ -2227,6 +2522,7 @@ static struct tevent_req *smbd_smb2_request_read_send(TALLOC_CTX *mem_ctx,
 	}
 	state->missing = 0;
 	state->asked_for_header = false;
+	state->doing_receivefile = false;
 
 	state->smb2_req = smbd_smb2_request_allocate(state);
 	if (tevent_req_nomem(state->smb2_req, req)) {
@@ -2353,6 +2649,55 @@ static int smbd_smb2_request_next_vector(struct tstream_context *stream,
 		return 0;
 	}
 
+	if (state->doing_receivefile) {
+		const uint8_t *hdr;
+		const uint8_t *body;
+
+		state->doing_receivefile = false;
+
+		/*
+		 * We got the body of a large WRITE, the data
+		 * is still in the socket.
+		 */
+		hdr = (const uint8_t *)req->in.vector[idx-3].iov_base;
+		body = (const uint8_t *)req->in.vector[idx-2].iov_base;
+
+		if (smbd_smb2_request_recvfile_ok(req->sconn, hdr, body,
+						  state->missing)) {
+			/*
+			 * Leave the data in the socket, the
+			 * WRITE processing writes it to the file
+			 * with SMB_VFS_RECVFILE.
+			 */
+			req->sconn->smb2.unread_bytes = state->missing;
+			state->missing = 0;
+			*_vector = NULL;
+			*_count = 0;
+			return 0;
+		}
+
+		/* Fall back to reading the data into memory. */
+		buf = talloc_array(req->in.vector, uint8_t, state->missing);
+		if (buf == NULL) {
+			return -1;
+		}
+
+		req->in.vector[idx-1].iov_base	= (void *)buf;
+		req->in.vector[idx-1].iov_len	= state->missing;
+		state->missing = 0;
+
+		vector = talloc_array(mem_ctx, struct iovec, 1);
+		if (vector == NULL) {
+			return -1;
+		}
+
+		vector[0] = req->in.vector[idx-1];
+
+		*_vector = vector;
+		*_count = 1;
+		return 0;
+	}
+
 	if (state->missing == 0) {
 		/* if there're no remaining bytes, we're done */
 		*_vector = NULL;
@@ -2442,6 +2787,43 @@ static int smbd_smb2_request_next_vector(struct tstream_context *stream,
 
 		dyn_size = full_size - (SMB2_HDR_BODY + body_size);
 
+		if (!invalid &&
+		    state->missing == (body_size - 2) + dyn_size &&
+		    smbd_smb2_request_is_recvfile(req->sconn, hdr,
+						  body_size, dyn_size)) {
+			/*
+			 * Only read the body for now, we decide
+			 * about the data when we can look at the
+			 * file id.
+			 */
+			state->doing_receivefile = true;
+			state->missing -= (body_size - 2);
+
+			body = talloc_array(req->in.vector, uint8_t,
+					    body_size);
+			if (body == NULL) {
+				return -1;
+			}
+
+			req->in.vector[idx].iov_base	= (void *)body;
+			req->in.vector[idx].iov_len	= body_size;
+			req->in.vector[idx+1].iov_base	= NULL;
+			req->in.vector[idx+1].iov_len	= 0;
+
+			vector = talloc_array(mem_ctx, struct iovec, 1);
+			if (vector == NULL) {
+				return -1;
+			}
+
+			memcpy(body, hdr + SMB2_HDR_BODY, 2);
+			vector[0].iov_base = body + 2;
+			vector[0].iov_len = body_size - 2;
+
+			*_vector = vector;
+			*_count = 1;
+			return 0;
+		}
+
 		state->missing -= (body_size - 2) + dyn_size;
 
 		body = talloc_array(req->in.vector, uint8_t, body_size);
@@ -2701,6 +3083,21 @@ static void smbd_smb2_request_incoming(struct tevent_req *subreq)
 		return;
 	}
 
+	if (sconn->smb2.unread_bytes != 0) {
+		/*
+		 * The WRITE failed before it could use the data
+		 * we left in the socket for recvfile.
+		 */
+		size_t unread_bytes = sconn->smb2.unread_bytes;
+
+		sconn->smb2.unread_bytes = 0;
+		if (drain_socket(sconn->sock, unread_bytes) != unread_bytes) {
+			smbd_server_connection_terminate(sconn,
+				"failed to drain pending bytes");
+			return;
+		}
+	}
+
 next:
 	status = smbd_smb2_request_next_incoming(sconn);
 	if (!NT_STATUS_IS_OK(status)) {
@@ -2723,3 +3120,45 @@ next:
 		check_log_size();
 	}
 }
+
+/*
+ * Tell smbstatus how the credit window of this connection is doing.
+ */
+
+void smbd_smb2_msg_credit_stats(struct messaging_context *msg,
+				void *private_data,
+				uint32_t msg_type,
+				struct server_id server_id,
+				DATA_BLOB *data)
+{
+	struct smbd_server_connection *sconn = talloc_get_type_abort(
+		private_data, struct smbd_server_connection);
+	struct smb2_credit_stats stats;
+	enum ndr_err_code ndr_err;
+	DATA_BLOB blob;
+
+	ZERO_STRUCT(stats);
+
+	if (sconn->smb2.credits_bitmap != NULL) {
+		stats.window = sconn->smb2.credits_window;
+		stats.window_min = sconn->smb2.credits_window_min;
+		stats.window_max = sconn->smb2.max_credits;
+		stats.granted = sconn->smb2.credits_granted;
+		stats.latency_usec = sconn->smb2.credits_latency_usec;
+		stats.requests = sconn->smb2.credit_stats.requests;
+		stats.credits = sconn->smb2.credit_stats.credits;
+		stats.grown = sconn->smb2.credit_stats.grown;
+		stats.shrunk = sconn->smb2.credit_stats.shrunk;
+	}
+
+	ndr_err = ndr_push_struct_blob(&blob, talloc_tos(), &stats,
+			(ndr_push_flags_fn_t)ndr_push_smb2_credit_stats);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		DEBUG(1, ("smbd_smb2_msg_credit_stats: ndr_push failed: %s\n",
+			  ndr_errstr(ndr_err)));
+		return;
+	}
+
+	messaging_send(msg, server_id, MSG_SMB_CREDIT_STATS, &blob);
+	data_blob_free(&blob);
+}
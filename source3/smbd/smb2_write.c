@@ -73,7 +73,16 @@ NTSTATUS smbd_smb2_request_process_write(struct smbd_smb2_request *req)
 		return smbd_smb2_request_error(req, NT_STATUS_INVALID_PARAMETER);
 	}
 
-	if (in_data_length > req->in.vector[i+2].iov_len) {
+	if (req->sconn->smb2.unread_bytes != 0) {
+		/*
+		 * The data is still in the socket and will be
+		 * written to the file with SMB_VFS_RECVFILE.
+		 */
+		if (in_data_length != req->sconn->smb2.unread_bytes) {
+			return smbd_smb2_request_error(req,
+					NT_STATUS_INVALID_PARAMETER);
+		}
+	} else if (in_data_length > req->in.vector[i+2].iov_len) {
 		return smbd_smb2_request_error(req, NT_STATUS_INVALID_PARAMETER);
 	}
 
@@ -85,6 +94,11 @@ NTSTATUS smbd_smb2_request_process_write(struct smbd_smb2_request *req)
 		return smbd_smb2_request_error(req, NT_STATUS_INVALID_PARAMETER);
 	}
 
+	status = smbd_smb2_request_verify_creditcharge(req, in_data_length);
+	if (!NT_STATUS_IS_OK(status)) {
+		return smbd_smb2_request_error(req, status);
+	}
+
 	in_data_buffer.data = (uint8_t *)req->in.vector[i+2].iov_base;
 	in_data_buffer.length = in_data_length;
 
@@ -171,6 +185,12 @@ struct smbd_smb2_write_state {
 	uint32_t in_length;
 	uint64_t in_offset;
 	uint32_t out_count;
+	/* Used when the pwrite runs on a "smb2 worker threads" helper */
+	struct smbd_smb2_write_job *job;
+	struct lock_struct lock;
+	struct file_id file_id;
+	unsigned long gen_id;
+	bool synced;
 };
 
 static void smbd_smb2_write_pipe_done(struct tevent_req *subreq);
@@ -200,7 +220,11 @@ NTSTATUS smb2_write_complete(struct tevent_req *req, ssize_t nwritten, int err)
 		return NT_STATUS_DISK_FULL;
 	}
 
-	status = sync_file(fsp->conn, fsp, state->write_through);
+	if (state->synced) {
+		status = NT_STATUS_OK;
+	} else {
+		status = sync_file(fsp->conn, fsp, state->write_through);
+	}
 	if (!NT_STATUS_IS_OK(status)) {
 		DEBUG(5,("smb2: sync_file for %s returned %s\n",
 			fsp_str_dbg(fsp),
@@ -224,6 +248,142 @@ static bool smbd_smb2_write_cancel(struct tevent_req *req)
 	return cancel_smb2_aio(state->smbreq);
 }
 
+/*******************************************************************
+ State handed to a "smb2 worker threads" helper thread. As for
+ reads the job works on a dup of the file descriptor and bypasses
+ the VFS, so it is only used on plain fd VFS stacks. A sync the
+ write needs is done in the helper thread as well. The data is owned
+ by the smb2 request, which stays around until we reply.
+*******************************************************************/
+
+struct smbd_smb2_write_job {
+	int fd;
+	const uint8_t *data;
+	size_t length;
+	SMB_OFF_T offset;
+	bool sync;
+	ssize_t nwritten;
+	int err;
+};
+
+static int smbd_smb2_write_job_destructor(struct smbd_smb2_write_job *job)
+{
+	if (job->fd != -1) {
+		close(job->fd);
+		job->fd = -1;
+	}
+	return 0;
+}
+
+/* Runs in a helper thread, must not touch anything but the job. */
+static void smbd_smb2_write_job_fn(void *private_data)
+{
+	struct smbd_smb2_write_job *job =
+		(struct smbd_smb2_write_job *)private_data;
+	size_t total = 0;
+
+	job->err = 0;
+
+	while (total < job->length) {
+		ssize_t ret = sys_pwrite(job->fd,
+					 job->data + total,
+					 job->length - total,
+					 job->offset + total);
+		if (ret == -1) {
+			job->err = errno;
+			job->nwritten = -1;
+			return;
+		}
+		if (ret == 0) {
+			break;
+		}
+		total += ret;
+	}
+	job->nwritten = total;
+
+	if (job->sync && (total > 0) && (fsync(job->fd) == -1)) {
+		job->err = errno;
+		job->nwritten = -1;
+	}
+}
+
+static void smbd_smb2_write_job_done(struct tevent_req *subreq);
+
+/*******************************************************************
+ Hand a write to the per-connection worker threads. The first write
+ on a handle is left to write_file(), which does the write time and
+ DOS attribute bookkeeping for us. On success the caller's strict
+ lock is kept until the job has finished. Returns NT_STATUS_RETRY if
+ the write has to be done synchronously.
+*******************************************************************/
+
+static NTSTATUS schedule_smb2_worker_write(struct tevent_req *req,
+					struct smbd_smb2_write_state *state,
+					DATA_BLOB in_data,
+					const struct lock_struct *lock)
+{
+	struct smbd_server_connection *sconn = state->smb2req->sconn;
+	files_struct *fsp = state->fsp;
+	struct smbd_smb2_write_job *job = NULL;
+	struct tevent_req *subreq = NULL;
+
+	if ((sconn->smb2.workers == NULL) ||
+			!fsp->modified ||
+			!fsp->can_write ||
+			(fsp->base_fsp != NULL) ||
+			(fsp->wcp != NULL) ||
+			(fsp->print_file != NULL) ||
+			(fsp->fh->fd == -1) ||
+			lp_strict_allocate(SNUM(fsp->conn)) ||
+			!vfs_plain_fd_io(fsp->conn)) {
+		return NT_STATUS_RETRY;
+	}
+
+	job = talloc_zero(state, struct smbd_smb2_write_job);
+	if (job == NULL) {
+		return NT_STATUS_NO_MEMORY;
+	}
+	job->data = in_data.data;
+	job->length = in_data.length;
+	job->offset = (SMB_OFF_T)state->in_offset;
+	job->sync = lp_strict_sync(SNUM(fsp->conn)) &&
+		(lp_syncalways(SNUM(fsp->conn)) || state->write_through);
+
+	job->fd = dup(fsp->fh->fd);
+	if (job->fd == -1) {
+		DEBUG(5,("schedule_smb2_worker_write: dup failed: %s\n",
+			strerror(errno)));
+		TALLOC_FREE(job);
+		return NT_STATUS_RETRY;
+	}
+	talloc_set_destructor(job, smbd_smb2_write_job_destructor);
+
+	subreq = fncall_send(state, sconn->ev_ctx, sconn->smb2.workers,
+			     smbd_smb2_write_job_fn, job);
+	if (subreq == NULL) {
+		TALLOC_FREE(job);
+		return NT_STATUS_NO_MEMORY;
+	}
+	tevent_req_set_callback(subreq, smbd_smb2_write_job_done, req);
+
+	state->job = job;
+	state->lock = *lock;
+	state->file_id = fsp->file_id;
+	state->gen_id = fsp->fh->gen_id;
+
+	/* This should actually be improved to span the write. */
+	contend_level2_oplocks_begin(fsp, LEVEL2_CONTEND_WRITE);
+	contend_level2_oplocks_end(fsp, LEVEL2_CONTEND_WRITE);
+
+	DEBUG(10,("smb2: scheduled worker write for file %s, "
+		"offset %.0f, len = %u\n",
+		fsp_str_dbg(fsp),
+		(double)state->in_offset,
+		(unsigned int)in_data.length));
+
+	return NT_STATUS_OK;
+}
+
 static struct tevent_req *smbd_smb2_write_send(TALLOC_CTX *mem_ctx,
 					       struct tevent_context *ev,
 					       struct smbd_smb2_request *smb2req,
@@ -252,6 +412,7 @@ static struct tevent_req *smbd_smb2_write_send(TALLOC_CTX *mem_ctx,
 		state->write_through = true;
 	}
 	state->in_length = in_data.length;
+	state->in_offset = in_offset;
 	state->out_count = 0;
 
 	DEBUG(10,("smbd_smb2_write: file_id[0x%016llX]\n",
@@ -305,13 +466,21 @@ static struct tevent_req *smbd_smb2_write_send(TALLOC_CTX *mem_ctx,
 		return tevent_req_post(req, ev);
 	}
 
-	/* Try and do an asynchronous write. */
-	status = schedule_aio_smb2_write(conn,
-					smbreq,
-					fsp,
-					in_offset,
-					in_data,
-					state->write_through);
+	if (smb2req->sconn->smb2.unread_bytes != 0) {
+		/*
+		 * The data is still in the socket, it has to be
+		 * written before we read the next request.
+		 */
+		status = NT_STATUS_RETRY;
+	} else {
+		/* Try and do an asynchronous write. */
+		status = schedule_aio_smb2_write(conn,
+						smbreq,
+						fsp,
+						in_offset,
+						in_data,
+						state->write_through);
+	}
 
 	if (NT_STATUS_IS_OK(status)) {
 		/*
@@ -341,11 +510,35 @@ static struct tevent_req *smbd_smb2_write_send(TALLOC_CTX *mem_ctx,
 		return tevent_req_post(req, ev);
 	}
 
+	/* Let a worker thread do the write if we're configured to. */
+	if (smb2req->sconn->smb2.unread_bytes == 0) {
+		status = schedule_smb2_worker_write(req, state, in_data,
+						    &lock);
+	}
+	if (NT_STATUS_IS_OK(status)) {
+		return req;
+	}
+	if (!NT_STATUS_EQUAL(status, NT_STATUS_RETRY)) {
+		SMB_VFS_STRICT_UNLOCK(conn, fsp, &lock);
+		tevent_req_nterror(req, status);
+		return tevent_req_post(req, ev);
+	}
+
+	/*
+	 * With recvfile write_file() moves the data from the
+	 * socket to the file and drains the socket on error.
+	 */
+	smbreq->unread_bytes = smb2req->sconn->smb2.unread_bytes;
+	smb2req->sconn->smb2.unread_bytes = 0;
+
 	nwritten = write_file(smbreq, fsp,
 			      (const char *)in_data.data,
 			      in_offset,
 			      in_data.length);
 
+	smb2req->sconn->smb2.unread_bytes = smbreq->unread_bytes;
+	smbreq->unread_bytes = 0;
+
 	status = smb2_write_complete(req, nwritten, errno);
 
 	SMB_VFS_STRICT_UNLOCK(conn, fsp, &lock);
@@ -367,6 +560,77 @@ static struct tevent_req *smbd_smb2_write_send(TALLOC_CTX *mem_ctx,
 	return tevent_req_post(req, ev);
 }
 
+static void smbd_smb2_write_job_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(subreq,
+				 struct tevent_req);
+	struct smbd_smb2_write_state *state = tevent_req_data(req,
+					      struct smbd_smb2_write_state);
+	struct smbd_smb2_write_job *job = state->job;
+	files_struct *fsp = NULL;
+	NTSTATUS status;
+	ssize_t nwritten;
+	int err = 0;
+	int ret;
+
+	ret = fncall_recv(subreq, &err);
+	/* On error the job went away together with subreq. */
+	TALLOC_FREE(subreq);
+	state->job = NULL;
+
+	/*
+	 * The client might have closed the file while the job was
+	 * running, find it again by its unique generation number.
+	 */
+	fsp = file_find_dif(state->smb2req->sconn,
+			    state->file_id,
+			    state->gen_id);
+	if (fsp != state->fsp) {
+		DEBUG(3,("smb2: file closed whilst worker write "
+			"outstanding\n"));
+		if (ret == 0) {
+			TALLOC_FREE(job);
+		}
+		tevent_req_nterror(req, NT_STATUS_FILE_CLOSED);
+		return;
+	}
+
+	SMB_VFS_STRICT_UNLOCK(fsp->conn, fsp, &state->lock);
+
+	if (ret == -1) {
+		tevent_req_nterror(req, map_nt_error_from_unix(err));
+		return;
+	}
+
+	nwritten = job->nwritten;
+	err = job->err;
+	state->synced = job->sync;
+	TALLOC_FREE(job);
+
+	status = smb2_write_complete(req, nwritten, err);
+
+	if (nwritten > 0) {
+		fsp->fh->pos = state->in_offset + nwritten;
+	}
+
+	DEBUG(10,("smb2: worker write completed for file %s, "
+		"offset %.0f, requested %u, written = %d "
+		"(errcode = %d, NTSTATUS = %s)\n",
+		fsp_str_dbg(fsp),
+		(double)state->in_offset,
+		(unsigned int)state->in_length,
+		(int)nwritten,
+		err,
+		nt_errstr(status)));
+
+	if (!NT_STATUS_IS_OK(status)) {
+		tevent_req_nterror(req, status);
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
 static void smbd_smb2_write_pipe_done(struct tevent_req *subreq)
 {
 	struct tevent_req *req = tevent_req_callback_data(subreq,
@@ -21,19 +21,330 @@
 */
 
 #include "includes.h"
+#include "system/filesys.h"
 #include "memcache.h"
 #include "smbd/smbd.h"
 #include "messages.h"
 #include "smbprofile.h"
 #include "tdb_compat.h"
+#include "util_tdb.h"
+#include "dbwrap/dbwrap.h"
+#include "dbwrap/dbwrap_tdb.h"
 
 /****************************************************************************
  Stat cache code used in unix_convert.
 *****************************************************************************/
 
+/*
+ * With "stat cache shared" the entries live in statcache.tdb, opened
+ * by the parent smbd and shared by all its children. Keys are the
+ * share name, the case sensitivity and the absolute (share path
+ * prefixed) name, values carry the generation they were added in.
+ *
+ * The generation lives in its own statcache_gen.tdb. Its seqnum only
+ * changes when the generation is bumped, so a process just compares
+ * seqnums to know its cached generation is still current, adding
+ * entries doesn't touch it. Bumping the generation invalidates every
+ * entry for all processes at once, that's what a directory rename or
+ * delete does.
+ */
+
+#define STAT_CACHE_GENERATION_KEY "STAT_CACHE/GENERATION"
+
+/* rough size of a shared entry including the tdb overhead */
+#define STAT_CACHE_SHARED_ENTRY_SIZE 256
+
+/* count the shared entries after this many local inserts */
+#define STAT_CACHE_SHARED_TRIM_INTERVAL 256
+
+struct stat_cache_shared_entry {
+	uint32_t generation;
+	char translated_path[1];
+};
+
+static struct db_context *stat_cache_db;
+static struct db_context *stat_cache_gen_db;
+static int stat_cache_seqnum = -1;
+static uint32_t stat_cache_generation;
+static unsigned stat_cache_inserts;
+
+bool stat_cache_parent_init(TALLOC_CTX *mem_ctx)
+{
+	if (!lp_stat_cache() || !lp_stat_cache_shared()) {
+		return true;
+	}
+
+	/*
+	 * Open the tdbs in the parent process (smbd) so that our
+	 * CLEAR_IF_FIRST optimization in tdb_reopen_all can properly
+	 * work. The children inherit them, they would not be able to
+	 * open them later when running as the user.
+	 */
+
+	stat_cache_gen_db = db_open_tdb(mem_ctx, lock_path("statcache_gen.tdb"),
+					0,
+					TDB_DEFAULT|TDB_CLEAR_IF_FIRST|
+					TDB_INCOMPATIBLE_HASH|TDB_SEQNUM|
+					TDB_NOSYNC,
+					O_RDWR|O_CREAT, 0644);
+	if (stat_cache_gen_db == NULL) {
+		DEBUG(0, ("could not open statcache_gen.tdb: %s, using a "
+			  "per-process stat cache\n", strerror(errno)));
+		return true;
+	}
+
+	stat_cache_db = db_open_tdb(mem_ctx, lock_path("statcache.tdb"), 10007,
+				    TDB_DEFAULT|TDB_CLEAR_IF_FIRST|
+				    TDB_INCOMPATIBLE_HASH|TDB_NOSYNC,
+				    O_RDWR|O_CREAT, 0644);
+	if (stat_cache_db == NULL) {
+		DEBUG(0, ("could not open statcache.tdb: %s, using a "
+			  "per-process stat cache\n", strerror(errno)));
+		TALLOC_FREE(stat_cache_gen_db);
+	}
+	return true;
+}
+
+static void stat_cache_parse_uint32(TDB_DATA key, TDB_DATA data,
+				    void *private_data)
+{
+	uint32_t *val = (uint32_t *)private_data;
+
+	if (data.dsize == sizeof(uint32_t)) {
+		*val = IVAL(data.dptr, 0);
+	}
+}
+
+/*
+ * The current generation. Only bumping it writes to
+ * statcache_gen.tdb, so as long as its seqnum is unchanged we don't
+ * have to look.
+ */
+
+static uint32_t stat_cache_shared_generation(void)
+{
+	int seqnum = dbwrap_get_seqnum(stat_cache_gen_db);
+
+	if (seqnum != stat_cache_seqnum) {
+		uint32_t generation = 0;
+
+		dbwrap_parse_record(stat_cache_gen_db,
+				    string_term_tdb_data(STAT_CACHE_GENERATION_KEY),
+				    stat_cache_parse_uint32, &generation);
+		stat_cache_generation = generation;
+		stat_cache_seqnum = seqnum;
+	}
+	return stat_cache_generation;
+}
+
+/*
+ * Shares can point at the same path with different case sensitivity
+ * or name mangling settings, so they must not share translations.
+ */
+
+static char *stat_cache_shared_key(TALLOC_CTX *mem_ctx,
+				   connection_struct *conn,
+				   const char *name, size_t namelen)
+{
+	return talloc_asprintf(mem_ctx, "%s:%d:%s/%.*s",
+			       lp_servicename(SNUM(conn)),
+			       conn->case_sensitive ? 1 : 0,
+			       conn->connectpath, (int)namelen, name);
+}
+
+static int stat_cache_shared_count_fn(struct db_record *rec,
+				      void *private_data)
+{
+	return 0;
+}
+
+/*
+ * Forget all entries once the cache has grown past "max stat cache
+ * size". To not serialize all smbds on a shared counter every
+ * process only counts the entries once every
+ * STAT_CACHE_SHARED_TRIM_INTERVAL inserts it did itself.
+ */
+
+static void stat_cache_shared_trim(void)
+{
+	size_t max_entries;
+	int entries = 0;
+	NTSTATUS status;
+
+	max_entries = (size_t)lp_max_stat_cache_size() * 1024 /
+		STAT_CACHE_SHARED_ENTRY_SIZE;
+	if (max_entries == 0) {
+		return;
+	}
+
+	stat_cache_inserts += 1;
+	if ((stat_cache_inserts % STAT_CACHE_SHARED_TRIM_INTERVAL) != 0) {
+		return;
+	}
+
+	status = dbwrap_traverse_read(stat_cache_db,
+				      stat_cache_shared_count_fn, NULL,
+				      &entries);
+	if (!NT_STATUS_IS_OK(status) || ((size_t)entries < max_entries)) {
+		return;
+	}
+
+	DEBUG(10, ("stat_cache_shared_trim: wiping %d entries\n", entries));
+
+	/*
+	 * All entries go away, there is nothing to invalidate. An
+	 * entry stored concurrently with the current generation is as
+	 * valid as before.
+	 */
+	dbwrap_wipe(stat_cache_db);
+}
+
+static void stat_cache_shared_add(connection_struct *conn,
+				  const char *original_path,
+				  size_t original_path_length,
+				  const char *translated_path,
+				  size_t translated_path_length)
+{
+	struct stat_cache_shared_entry *entry;
+	size_t entry_size;
+	char *key;
+	NTSTATUS status;
+
+	key = stat_cache_shared_key(talloc_tos(), conn, original_path,
+				    original_path_length);
+	if (key == NULL) {
+		return;
+	}
+
+	entry_size = offsetof(struct stat_cache_shared_entry,
+			      translated_path) + translated_path_length + 1;
+	entry = (struct stat_cache_shared_entry *)talloc_size(
+		key, entry_size);
+	if (entry == NULL) {
+		TALLOC_FREE(key);
+		return;
+	}
+	entry->generation = stat_cache_shared_generation();
+	memcpy(entry->translated_path, translated_path,
+	       translated_path_length);
+	entry->translated_path[translated_path_length] = '\0';
+
+	status = dbwrap_store(stat_cache_db, string_tdb_data(key),
+			      make_tdb_data((uint8_t *)entry, entry_size),
+			      TDB_INSERT);
+	if (NT_STATUS_EQUAL(status, NT_STATUS_OBJECT_NAME_COLLISION)) {
+		status = dbwrap_store(stat_cache_db, string_tdb_data(key),
+				      make_tdb_data((uint8_t *)entry,
+						    entry_size),
+				      TDB_REPLACE);
+	} else if (NT_STATUS_IS_OK(status)) {
+		stat_cache_shared_trim();
+	}
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(10, ("stat_cache_shared_add: storing %s failed: %s\n",
+			   key, nt_errstr(status)));
+	}
+	TALLOC_FREE(key);
+}
+
+struct stat_cache_shared_lookup_state {
+	TALLOC_CTX *mem_ctx;
+	uint32_t generation;
+	char *translated_path;
+	bool stale;
+};
+
+static void stat_cache_shared_lookup_fn(TDB_DATA key, TDB_DATA data,
+					void *private_data)
+{
+	struct stat_cache_shared_lookup_state *state =
+		(struct stat_cache_shared_lookup_state *)private_data;
+	struct stat_cache_shared_entry entry;
+	size_t hdr_size = offsetof(struct stat_cache_shared_entry,
+				   translated_path);
+
+	if ((data.dsize <= hdr_size) || (data.dptr[data.dsize-1] != '\0')) {
+		state->stale = true;
+		return;
+	}
+	memcpy(&entry, data.dptr, hdr_size);
+	if (entry.generation != state->generation) {
+		state->stale = true;
+		return;
+	}
+	state->translated_path = talloc_memdup(
+		state->mem_ctx, data.dptr + hdr_size, data.dsize - hdr_size);
+}
+
+/*
+ * Returns the translated path (talloced off mem_ctx) for a key
+ */
+
+static char *stat_cache_shared_lookup(TALLOC_CTX *mem_ctx,
+				      connection_struct *conn,
+				      const char *name)
+{
+	struct stat_cache_shared_lookup_state state;
+	char *key;
+	NTSTATUS status;
+
+	key = stat_cache_shared_key(talloc_tos(), conn, name, strlen(name));
+	if (key == NULL) {
+		return NULL;
+	}
+
+	state.mem_ctx = mem_ctx;
+	state.generation = stat_cache_shared_generation();
+	state.translated_path = NULL;
+	state.stale = false;
+
+	status = dbwrap_parse_record(stat_cache_db, string_tdb_data(key),
+				     stat_cache_shared_lookup_fn, &state);
+	if (NT_STATUS_IS_OK(status) && state.stale) {
+		dbwrap_delete(stat_cache_db, string_tdb_data(key));
+	}
+	TALLOC_FREE(key);
+	return state.translated_path;
+}
+
+static void stat_cache_shared_delete(connection_struct *conn,
+				     const char *name)
+{
+	char *key;
+
+	key = stat_cache_shared_key(talloc_tos(), conn, name, strlen(name));
+	if (key == NULL) {
+		return;
+	}
+	dbwrap_delete(stat_cache_db, string_tdb_data(key));
+	TALLOC_FREE(key);
+}
+
+/*
+ * Invalidate all shared entries
+ */
+
+static void stat_cache_shared_invalidate(void)
+{
+	uint32_t generation;
+	NTSTATUS status;
+
+	status = dbwrap_change_uint32_atomic(stat_cache_gen_db,
+					     STAT_CACHE_GENERATION_KEY,
+					     &generation, 1);
+	if (!NT_STATUS_IS_OK(status)) {
+		DEBUG(1, ("stat_cache_shared_invalidate: %s\n",
+			  nt_errstr(status)));
+		return;
+	}
+	DEBUG(10, ("stat_cache_shared_invalidate: generation %u\n",
+		   (unsigned)generation + 1));
+}
+
 /**
  * Add an entry into the stat cache.
  *
+ * @param conn                 The connection the name was translated for.
  * @param full_orig_name       The original name as specified by the client
  * @param orig_translated_path The name on our filesystem.
  *
@@ -43,7 +354,8 @@
  *
  */
 
-void stat_cache_add( const char *full_orig_name,
+void stat_cache_add(connection_struct *conn,
+		const char *full_orig_name,
 		char *translated_path,
 		bool case_sensitive)
 {
@@ -131,10 +443,18 @@ void stat_cache_add( const char *full_orig_name,
 	 * New entry or replace old entry.
 	 */
 
-	memcache_add(
-		smbd_memcache(), STAT_CACHE,
-		data_blob_const(original_path, original_path_length),
-		data_blob_const(translated_path, translated_path_length + 1));
+	if (stat_cache_db != NULL) {
+		stat_cache_shared_add(conn, original_path,
+				      original_path_length,
+				      translated_path,
+				      translated_path_length);
+	} else {
+		memcache_add(
+			smbd_memcache(), STAT_CACHE,
+			data_blob_const(original_path, original_path_length),
+			data_blob_const(translated_path,
+					translated_path_length + 1));
+	}
 
 	DEBUG(5,("stat_cache_add: Added entry (%lx:size %x) %s -> %s\n",
 		 (unsigned long)translated_path,
@@ -180,6 +500,7 @@ bool stat_cache_lookup(connection_struct *conn,
 	char *translated_path;
 	size_t translated_path_length;
 	DATA_BLOB data_val;
+	char *shared_path = NULL;
 	char *name;
 	TALLOC_CTX *ctx = talloc_tos();
 	struct smb_filename smb_fname;
@@ -233,7 +554,15 @@ bool stat_cache_lookup(connection_struct *conn,
 
 		data_val = data_blob_null;
 
-		if (memcache_lookup(
+		if (stat_cache_db != NULL) {
+			shared_path = stat_cache_shared_lookup(ctx, conn,
+							       chk_name);
+			if (shared_path != NULL) {
+				data_val = data_blob_const(
+					shared_path, strlen(shared_path) + 1);
+				break;
+			}
+		} else if (memcache_lookup(
 			    smbd_memcache(), STAT_CACHE,
 			    data_blob_const(chk_name, strlen(chk_name)),
 			    &data_val)) {
@@ -278,6 +607,7 @@ bool stat_cache_lookup(connection_struct *conn,
 		smb_panic("talloc failed");
 	}
 	translated_path_length = data_val.length - 1;
+	TALLOC_FREE(shared_path);
 
 	DEBUG(10,("stat_cache_lookup: lookup succeeded for name [%s] "
 		  "-> [%s]\n", chk_name, translated_path ));
@@ -294,8 +624,13 @@ bool stat_cache_lookup(connection_struct *conn,
 
 	if (ret != 0) {
 		/* Discard this entry - it doesn't exist in the filesystem. */
-		memcache_delete(smbd_memcache(), STAT_CACHE,
+		if (stat_cache_db != NULL) {
+			stat_cache_shared_delete(conn, chk_name);
+		} else {
+			memcache_delete(
+				smbd_memcache(), STAT_CACHE,
 				data_blob_const(chk_name, strlen(chk_name)));
+		}
 		TALLOC_FREE(chk_name);
 		TALLOC_FREE(translated_path);
 		return False;
@@ -346,12 +681,17 @@ bool stat_cache_lookup(connection_struct *conn,
 }
 
 /***************************************************************************
- Tell all smbd's to delete an entry.
+ Tell all smbd's to delete an entry. With a shared stat cache this
+ drops all entries, names below a renamed or deleted directory are
+ not found by key.
 **************************************************************************/
 
 void smbd_send_stat_cache_delete_message(struct messaging_context *msg_ctx,
 					 const char *name)
 {
+	if (stat_cache_db != NULL) {
+		stat_cache_shared_invalidate();
+	}
 #ifdef DEVELOPER
 	message_send_all(msg_ctx,
 			MSG_SMB_STAT_CACHE_DELETE,
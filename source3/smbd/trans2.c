@@ -1486,7 +1486,7 @@ static bool smbd_dirptr_lanman2_mode_fn(TALLOC_CTX *ctx,
 			return false;
 		}
 	} else if (!VALID_STAT(smb_fname->st) &&
-		   SMB_VFS_STAT(state->conn, smb_fname) != 0) {
+		   dir_stat_cache_stat(state->conn, smb_fname) != 0) {
 		/* Needed to show the msdfs symlinks as
 		 * directories */
 
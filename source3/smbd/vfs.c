@@ -319,6 +319,131 @@ bool smbd_vfs_init(connection_struct *conn)
 	return True;
 }
 
+/*******************************************************************
+ Check whether pread, pwrite and fsync on this connection end up in
+ the default module, i.e. are plain system calls on fsp->fh->fd.
+ Only then is it safe to do the I/O on the fd behind the VFS' back.
+********************************************************************/
+
+bool vfs_plain_fd_io(connection_struct *conn)
+{
+	const struct vfs_init_function_entry *entry;
+	const struct vfs_fn_pointers *pread_fns = NULL;
+	const struct vfs_fn_pointers *pwrite_fns = NULL;
+	const struct vfs_fn_pointers *fsync_fns = NULL;
+	vfs_handle_struct *handle;
+
+	entry = vfs_find_backend_entry(DEFAULT_VFS_MODULE_NAME);
+	if (entry == NULL) {
+		return false;
+	}
+
+	for (handle = conn->vfs_handles; handle; handle = handle->next) {
+		if ((pread_fns == NULL) && (handle->fns->pread_fn != NULL)) {
+			pread_fns = handle->fns;
+		}
+		if ((pwrite_fns == NULL) && (handle->fns->pwrite_fn != NULL)) {
+			pwrite_fns = handle->fns;
+		}
+		if ((fsync_fns == NULL) && (handle->fns->fsync_fn != NULL)) {
+			fsync_fns = handle->fns;
+		}
+	}
+
+	return ((pread_fns == entry->fns) &&
+		(pwrite_fns == entry->fns) &&
+		(fsync_fns == entry->fns));
+}
+
+/*******************************************************************
+ Check whether sendfile also ends up in the default module. Modules
+ that implement it may fail it on purpose, for example for offline
+ files that have to be recalled through their pread.
+********************************************************************/
+
+bool vfs_plain_fd_sendfile(connection_struct *conn)
+{
+	const struct vfs_init_function_entry *entry;
+	vfs_handle_struct *handle;
+
+	if (!vfs_plain_fd_io(conn)) {
+		return false;
+	}
+
+	entry = vfs_find_backend_entry(DEFAULT_VFS_MODULE_NAME);
+	if (entry == NULL) {
+		return false;
+	}
+
+	for (handle = conn->vfs_handles; handle; handle = handle->next) {
+		if (handle->fns->sendfile_fn != NULL) {
+			return (handle->fns == entry->fns);
+		}
+	}
+	return false;
+}
+
+/*******************************************************************
+ Check whether opendir, readdir and stat on this connection end up
+ in the default module, so that a directory listing can read and
+ stat the entries behind the VFS' back.
+********************************************************************/
+
+bool vfs_plain_dir_stat(connection_struct *conn)
+{
+	const struct vfs_init_function_entry *entry;
+	const struct vfs_fn_pointers *opendir_fns = NULL;
+	const struct vfs_fn_pointers *readdir_fns = NULL;
+	const struct vfs_fn_pointers *stat_fns = NULL;
+	vfs_handle_struct *handle;
+
+	entry = vfs_find_backend_entry(DEFAULT_VFS_MODULE_NAME);
+	if (entry == NULL) {
+		return false;
+	}
+
+	for (handle = conn->vfs_handles; handle; handle = handle->next) {
+		if ((opendir_fns == NULL) &&
+		    (handle->fns->opendir_fn != NULL)) {
+			opendir_fns = handle->fns;
+		}
+		if ((readdir_fns == NULL) &&
+		    (handle->fns->readdir_fn != NULL)) {
+			readdir_fns = handle->fns;
+		}
+		if ((stat_fns == NULL) && (handle->fns->stat_fn != NULL)) {
+			stat_fns = handle->fns;
+		}
+	}
+
+	return ((opendir_fns == entry->fns) &&
+		(readdir_fns == entry->fns) &&
+		(stat_fns == entry->fns));
+}
+
+/*******************************************************************
+ Check whether directory watches on this connection end up in the
+ default module, i.e. are kernel (inotify) watches.
+********************************************************************/
+
+bool vfs_default_notify_watch(connection_struct *conn)
+{
+	const struct vfs_init_function_entry *entry;
+	vfs_handle_struct *handle;
+
+	entry = vfs_find_backend_entry(DEFAULT_VFS_MODULE_NAME);
+	if (entry == NULL) {
+		return false;
+	}
+
+	for (handle = conn->vfs_handles; handle; handle = handle->next) {
+		if (handle->fns->notify_watch_fn != NULL) {
+			return (handle->fns == entry->fns);
+		}
+	}
+	return false;
+}
+
 /*******************************************************************
  Check if a file exists in the vfs.
 ********************************************************************/
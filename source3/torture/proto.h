@@ -73,6 +73,12 @@ bool torture_close_connection(struct cli_state *c);
 bool torture_ioctl_test(int dummy);
 bool torture_chkpath_test(int dummy);
 NTSTATUS torture_setup_unix_extensions(struct cli_state *cli);
+bool torture_create_file(struct cli_state *cli, const char *fname);
+bool torture_check_open(struct cli_state *cli, const char *fname,
+			NTSTATUS expected);
+bool torture_fill_dir(struct cli_state *cli, const char *dname,
+		      int num_files);
+void torture_clean_dir(struct cli_state *cli, const char *dname);
 
 /* The following definitions come from torture/utable.c  */
 
@@ -85,6 +91,9 @@ bool torture_casetable(int dummy);
 
 bool run_posix_append(int dummy);
 bool run_case_insensitive_create(int dummy);
+bool run_name_index(int dummy);
+bool run_stat_cache_shared(int dummy);
+bool run_dir_stat_cache(int dummy);
 
 bool run_nbench2(int dummy);
 bool run_async_echo(int dummy);
@@ -101,6 +110,9 @@ bool run_smb2_multi_channel(int dummy);
 bool run_smb2_session_reauth(int dummy);
 bool run_local_conv_auth_info(int dummy);
 bool run_local_sprintf_append(int dummy);
+bool run_local_crypto_bench(int dummy);
+bool run_local_messaging_bench(int dummy);
+bool run_local_messaging_order(int dummy);
 bool run_cleanup1(int dummy);
 bool run_cleanup2(int dummy);
 
@@ -0,0 +1,154 @@
+/*
+   Unix SMB/CIFS implementation.
+   Compare the speed of the accelerated and the portable crypto code
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "includes.h"
+#include "torture/proto.h"
+#include "../lib/crypto/crypto.h"
+#include "../lib/crypto/cpu.h"
+
+#define CRYPTO_BENCH_SECONDS 1.0
+
+/*
+ * HMAC-SHA256 over a buffer the way SMB2 signing does it, one init
+ * per PDU with a 16 byte session key.
+ */
+static void bench_hmac_sha256(const uint8_t *buf, size_t len,
+			      uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+	static const uint8_t key[16] = { 1, 2, 3, 4, 5, 6, 7, 8,
+					 9, 10, 11, 12, 13, 14, 15, 16 };
+	struct HMACSHA256Context ctx;
+
+	hmac_sha256_init(key, sizeof(key), &ctx);
+	hmac_sha256_update(buf, len, &ctx);
+	hmac_sha256_final(digest, &ctx);
+}
+
+static void bench_aes128(const uint8_t *buf, size_t len,
+			 uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+	static const uint8_t keydata[16] = { 1, 2, 3, 4, 5, 6, 7, 8,
+					     9, 10, 11, 12, 13, 14, 15, 16 };
+	AES_KEY key;
+	uint8_t block[AES_BLOCK_SIZE];
+	size_t ofs;
+
+	AES_set_encrypt_key(keydata, 128, &key);
+	memset(block, 0, sizeof(block));
+
+	for (ofs = 0; ofs + AES_BLOCK_SIZE <= len; ofs += AES_BLOCK_SIZE) {
+		int i;
+		for (i = 0; i < AES_BLOCK_SIZE; i++) {
+			block[i] ^= buf[ofs + i];
+		}
+		AES_encrypt(block, block, &key);
+	}
+	memset(digest, 0, SHA256_DIGEST_LENGTH);
+	memcpy(digest, block, sizeof(block));
+}
+
+/*
+ * Run fn on len bytes for CRYPTO_BENCH_SECONDS, return MB/s and the
+ * result of the last run.
+ */
+static double bench_one(void (*fn)(const uint8_t *buf, size_t len,
+				   uint8_t digest[SHA256_DIGEST_LENGTH]),
+			const uint8_t *buf, size_t len,
+			uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+	struct timeval start;
+	double secs;
+	uint64_t bytes = 0;
+
+	start = timeval_current();
+	do {
+		int i;
+		for (i = 0; i < 16; i++) {
+			fn(buf, len, digest);
+			bytes += len;
+		}
+		secs = timeval_elapsed(&start);
+	} while (secs < CRYPTO_BENCH_SECONDS);
+
+	return bytes / secs / (1024 * 1024);
+}
+
+bool run_local_crypto_bench(int dummy)
+{
+	static const struct {
+		const char *name;
+		void (*fn)(const uint8_t *buf, size_t len,
+			   uint8_t digest[SHA256_DIGEST_LENGTH]);
+		size_t len;
+	} benches[] = {
+		{ "hmac-sha256", bench_hmac_sha256, 128 },
+		{ "hmac-sha256", bench_hmac_sha256, 4096 },
+		{ "hmac-sha256", bench_hmac_sha256, 65536 },
+		{ "aes-128", bench_aes128, 4096 },
+	};
+	unsigned int features, old_mask;
+	uint8_t *buf;
+	size_t i, buflen = 65536;
+	bool ret = true;
+
+	buf = talloc_array(talloc_tos(), uint8_t, buflen);
+	if (buf == NULL) {
+		printf("talloc failed\n");
+		return false;
+	}
+	for (i = 0; i < buflen; i++) {
+		buf[i] = i * 31 + (i >> 9);
+	}
+
+	features = samba_crypto_cpu_features();
+	printf("accelerated routines:%s%s%s\n",
+	       (features & SAMBA_CRYPTO_CPU_AESNI) ? " aes-ni" : "",
+	       (features & SAMBA_CRYPTO_CPU_SHA) ? " sha" : "",
+	       (features == 0) ? " none" : "");
+
+	old_mask = samba_crypto_cpu_set_mask(~0U);
+
+	for (i = 0; i < ARRAY_SIZE(benches); i++) {
+		uint8_t ref_digest[SHA256_DIGEST_LENGTH];
+		uint8_t digest[SHA256_DIGEST_LENGTH];
+		double ref_rate, rate;
+
+		samba_crypto_cpu_set_mask(0);
+		ref_rate = bench_one(benches[i].fn, buf, benches[i].len,
+				     ref_digest);
+
+		samba_crypto_cpu_set_mask(~0U);
+		rate = bench_one(benches[i].fn, buf, benches[i].len, digest);
+
+		printf("%-12s %6u bytes: portable %8.1f MB/s, "
+		       "accelerated %8.1f MB/s (x%.2f)\n",
+		       benches[i].name, (unsigned int)benches[i].len,
+		       ref_rate, rate, rate / ref_rate);
+
+		if (memcmp(ref_digest, digest, sizeof(digest)) != 0) {
+			printf("%s: accelerated and portable code differ\n",
+			       benches[i].name);
+			ret = false;
+		}
+	}
+
+	samba_crypto_cpu_set_mask(old_mask);
+	TALLOC_FREE(buf);
+
+	return ret;
+}
@@ -0,0 +1,178 @@
+/*
+   Unix SMB/CIFS implementation.
+   Test the directory stat cache against changes by others
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "includes.h"
+#include "torture/proto.h"
+#include "system/filesys.h"
+#include "libsmb/libsmb.h"
+#include "libsmb/clirap.h"
+
+/*
+ * More than the 1000 entries the server needs to stat before it
+ * caches a directory
+ */
+#define DIR_STAT_CACHE_NUM_FILES 1100
+
+/*
+ * Some time that the files created by the test don't have
+ */
+#define DIR_STAT_CACHE_MTIME 1000000000
+
+struct dir_stat_cache_state {
+	const char *fname;
+	int count;
+	bool found;
+	time_t mtime;
+};
+
+static NTSTATUS dir_stat_cache_list_fn(const char *mnt,
+				       struct file_info *finfo,
+				       const char *mask, void *private_data)
+{
+	struct dir_stat_cache_state *state =
+		(struct dir_stat_cache_state *)private_data;
+
+	if (strequal(finfo->name, ".") || strequal(finfo->name, "..")) {
+		return NT_STATUS_OK;
+	}
+	state->count += 1;
+	if (strequal(finfo->name, state->fname)) {
+		state->found = true;
+		state->mtime = finfo->mtime_ts.tv_sec;
+	}
+	return NT_STATUS_OK;
+}
+
+/*
+ * List the directory, check the number of entries and whether
+ * "fname" has the modification time "mtime"
+ */
+
+static bool dir_stat_cache_check(struct cli_state *cli, const char *fname,
+				 int count, time_t mtime, bool expect_mtime)
+{
+	struct dir_stat_cache_state state;
+	NTSTATUS status;
+
+	ZERO_STRUCT(state);
+	state.fname = fname;
+
+	status = cli_list(cli, "\\dir_stat_cache\\*", 0,
+			  dir_stat_cache_list_fn, &state);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_list failed: %s\n", nt_errstr(status));
+		return false;
+	}
+	if (state.count != count) {
+		printf("Found %d files, expected %d\n", state.count, count);
+		return false;
+	}
+	if (!state.found) {
+		printf("%s not listed\n", fname);
+		return false;
+	}
+	if ((state.mtime == mtime) != expect_mtime) {
+		printf("%s has mtime %u, expected %s%u\n", fname,
+		       (unsigned)state.mtime, expect_mtime ? "" : "not ",
+		       (unsigned)mtime);
+		return false;
+	}
+	return true;
+}
+
+bool run_dir_stat_cache(int dummy)
+{
+	struct cli_state *cli1 = NULL, *cli2 = NULL;
+	const char *dname = "\\dir_stat_cache";
+	bool ret = false;
+	NTSTATUS status;
+	int i;
+
+	printf("Starting directory stat cache test\n");
+
+	if (!torture_open_connection(&cli1, 0) ||
+	    !torture_open_connection(&cli2, 1)) {
+		goto done;
+	}
+
+	torture_clean_dir(cli1, dname);
+
+	if (!torture_fill_dir(cli1, dname, DIR_STAT_CACHE_NUM_FILES)) {
+		goto cleanup;
+	}
+
+	/*
+	 * The first listing makes cli1's smbd watch the directory, the
+	 * second one fills the cache, the third one uses it
+	 */
+	for (i = 0; i < 3; i++) {
+		if (!dir_stat_cache_check(cli1, "file17",
+					  DIR_STAT_CACHE_NUM_FILES,
+					  DIR_STAT_CACHE_MTIME, false)) {
+			goto cleanup;
+		}
+	}
+
+	/*
+	 * An mtime set by another smbd has to be visible in the next
+	 * listing, not only once cli1's smbd got around to read its
+	 * kernel events
+	 */
+	status = cli_setpathinfo_basic(cli2, "\\dir_stat_cache\\file17",
+				       0, 0, DIR_STAT_CACHE_MTIME, 0, 0);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_setpathinfo_basic failed: %s\n",
+		       nt_errstr(status));
+		goto cleanup;
+	}
+	if (!dir_stat_cache_check(cli1, "file17", DIR_STAT_CACHE_NUM_FILES,
+				  DIR_STAT_CACHE_MTIME, true)) {
+		goto cleanup;
+	}
+
+	/* Same for a file replaced under an existing name */
+	status = cli_unlink(cli2, "\\dir_stat_cache\\file18", 0);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_unlink failed: %s\n", nt_errstr(status));
+		goto cleanup;
+	}
+	status = cli_rename(cli2, "\\dir_stat_cache\\file17",
+			    "\\dir_stat_cache\\file18");
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_rename failed: %s\n", nt_errstr(status));
+		goto cleanup;
+	}
+	if (!dir_stat_cache_check(cli1, "file18",
+				  DIR_STAT_CACHE_NUM_FILES - 1,
+				  DIR_STAT_CACHE_MTIME, true)) {
+		goto cleanup;
+	}
+
+	ret = true;
+
+cleanup:
+	torture_clean_dir(cli1, dname);
+done:
+	if (cli1 != NULL) {
+		torture_close_connection(cli1);
+	}
+	if (cli2 != NULL) {
+		torture_close_connection(cli2);
+	}
+	return ret;
+}
@@ -0,0 +1,296 @@
+/*
+   Unix SMB/CIFS implementation.
+   Latency and throughput of messages between processes
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "includes.h"
+#include "torture/proto.h"
+#include "messages.h"
+#include "serverid.h"
+
+extern int torture_numops;
+
+#define MESSAGING_BENCH_SECONDS 1.0
+
+/* Pings in flight per child in the throughput test */
+#define MESSAGING_BENCH_WINDOW 32
+
+struct messaging_bench_state {
+	unsigned num_pongs;
+	bool done;
+};
+
+static void messaging_bench_pong(struct messaging_context *msg_ctx,
+				 void *private_data,
+				 uint32_t msg_type,
+				 struct server_id server_id,
+				 DATA_BLOB *data)
+{
+	struct messaging_bench_state *state =
+		(struct messaging_bench_state *)private_data;
+	state->num_pongs += 1;
+}
+
+static void messaging_bench_shutdown(struct messaging_context *msg_ctx,
+				     void *private_data,
+				     uint32_t msg_type,
+				     struct server_id server_id,
+				     DATA_BLOB *data)
+{
+	struct messaging_bench_state *state =
+		(struct messaging_bench_state *)private_data;
+	state->done = true;
+}
+
+/*
+ * The child answers MSG_PING from messages.c until told to go away
+ */
+static void messaging_bench_child(struct tevent_context *ev,
+				  struct messaging_context *msg_ctx,
+				  struct server_id parent)
+{
+	struct messaging_bench_state state;
+	NTSTATUS status;
+
+	ZERO_STRUCT(state);
+
+	status = reinit_after_fork(msg_ctx, ev, true);
+	if (!NT_STATUS_IS_OK(status)) {
+		exit(1);
+	}
+	if (!serverid_register(messaging_server_id(msg_ctx),
+			       FLAG_MSG_GENERAL)) {
+		exit(1);
+	}
+	messaging_register(msg_ctx, &state, MSG_SHUTDOWN,
+			   messaging_bench_shutdown);
+
+	status = messaging_send(msg_ctx, parent, MSG_PONG, &data_blob_null);
+	if (!NT_STATUS_IS_OK(status)) {
+		exit(1);
+	}
+
+	while (!state.done) {
+		if (tevent_loop_once(ev) != 0) {
+			exit(1);
+		}
+	}
+	serverid_deregister(messaging_server_id(msg_ctx));
+	TALLOC_FREE(msg_ctx);
+	exit(0);
+}
+
+static bool messaging_bench_wait(struct tevent_context *ev,
+				 struct messaging_bench_state *state,
+				 unsigned num_pongs)
+{
+	struct timeval start = timeval_current();
+
+	while (state->num_pongs < num_pongs) {
+		if (timeval_elapsed(&start) > 30) {
+			printf("Timed out waiting for %u replies\n",
+			       num_pongs - state->num_pongs);
+			return false;
+		}
+		if (tevent_loop_once(ev) != 0) {
+			printf("tevent_loop_once failed\n");
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool messaging_bench_run(struct tevent_context *ev, int num_children,
+				double *platency, double *prate,
+				double *pbcast)
+{
+	TALLOC_CTX *frame = talloc_stackframe();
+	struct messaging_context *msg_ctx;
+	struct messaging_bench_state state;
+	struct server_id *children;
+	struct timeval start;
+	unsigned num_pings;
+	uint8_t buf[32];
+	DATA_BLOB blob;
+	bool ret = false;
+	int i, j;
+
+	ZERO_STRUCT(state);
+	memset(buf, 'x', sizeof(buf));
+	blob = data_blob_const(buf, sizeof(buf));
+
+	children = talloc_zero_array(frame, struct server_id, num_children);
+	msg_ctx = messaging_init(frame, ev);
+	if ((children == NULL) || (msg_ctx == NULL)) {
+		printf("messaging_init failed\n");
+		goto done;
+	}
+	messaging_register(msg_ctx, &state, MSG_PONG, messaging_bench_pong);
+	if (!serverid_register(messaging_server_id(msg_ctx),
+			       FLAG_MSG_GENERAL)) {
+		printf("serverid_register failed\n");
+		goto done;
+	}
+
+	for (i=0; i<num_children; i++) {
+		pid_t pid = fork();
+		if (pid == -1) {
+			printf("fork failed: %s\n", strerror(errno));
+			goto done;
+		}
+		if (pid == 0) {
+			messaging_bench_child(ev, msg_ctx,
+					      messaging_server_id(msg_ctx));
+		}
+		children[i] = pid_to_procid(pid);
+	}
+
+	/* every child says hello once it listens */
+	if (!messaging_bench_wait(ev, &state, num_children)) {
+		goto done;
+	}
+
+	/* latency: one ping at a time, round robin over the children */
+	state.num_pongs = 0;
+	start = timeval_current();
+	for (j=0; j<torture_numops; j++) {
+		for (i=0; i<num_children; i++) {
+			messaging_send(msg_ctx, children[i], MSG_PING, &blob);
+			if (!messaging_bench_wait(ev, &state,
+						  state.num_pongs + 1)) {
+				goto done;
+			}
+		}
+	}
+	*platency = timeval_elapsed(&start) * 1000000.0 /
+		(torture_numops * num_children);
+
+	/*
+	 * throughput: keep MESSAGING_BENCH_WINDOW pings per child in
+	 * flight
+	 */
+	state.num_pongs = 0;
+	num_pings = 0;
+	start = timeval_current();
+	while (timeval_elapsed(&start) < MESSAGING_BENCH_SECONDS) {
+		while (num_pings - state.num_pongs <
+		       MESSAGING_BENCH_WINDOW * num_children) {
+			i = num_pings % num_children;
+			messaging_send(msg_ctx, children[i], MSG_PING, &blob);
+			num_pings += 1;
+		}
+		if (tevent_loop_once(ev) != 0) {
+			printf("tevent_loop_once failed\n");
+			goto done;
+		}
+	}
+	if (!messaging_bench_wait(ev, &state, num_pings)) {
+		goto done;
+	}
+	*prate = num_pings / timeval_elapsed(&start);
+
+	/*
+	 * broadcast: every process with a MSG_PING handler answers,
+	 * ourselves and other Samba daemons on this box included
+	 */
+	start = timeval_current();
+	for (j=0; j<torture_numops; j++) {
+		int n_sent = 0;
+
+		state.num_pongs = 0;
+		if (!message_send_all(msg_ctx, MSG_PING, buf, sizeof(buf),
+				      &n_sent)) {
+			printf("message_send_all failed\n");
+			goto done;
+		}
+		if (n_sent < num_children) {
+			printf("broadcast reached %d of %d processes\n",
+			       n_sent, num_children);
+			goto done;
+		}
+		if (!messaging_bench_wait(ev, &state, n_sent)) {
+			goto done;
+		}
+	}
+	*pbcast = timeval_elapsed(&start) * 1000000.0 / torture_numops;
+
+	ret = true;
+done:
+	if (msg_ctx != NULL) {
+		serverid_deregister(messaging_server_id(msg_ctx));
+	}
+	for (i=0; (children != NULL) && (i<num_children); i++) {
+		if (children[i].pid == 0) {
+			break;
+		}
+		messaging_send(msg_ctx, children[i], MSG_SHUTDOWN,
+			       &data_blob_null);
+	}
+	for (i=0; (children != NULL) && (i<num_children); i++) {
+		int status;
+		if (children[i].pid == 0) {
+			break;
+		}
+		if (waitpid(children[i].pid, &status, 0) == -1) {
+			continue;
+		}
+		if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+			printf("child %d failed\n", (int)children[i].pid);
+			ret = false;
+		}
+	}
+	TALLOC_FREE(frame);
+	return ret;
+}
+
+bool run_local_messaging_bench(int dummy)
+{
+	static const int num_children[] = { 1, 4, 16 };
+	static const char *sockets[] = { "yes", "no" };
+	struct tevent_context *ev;
+	bool orig = lp_messaging_sockets();
+	bool ret = true;
+	size_t i, j;
+
+	ev = tevent_context_init(talloc_tos());
+	if (ev == NULL) {
+		printf("tevent_context_init failed\n");
+		return false;
+	}
+
+	for (i=0; i<ARRAY_SIZE(sockets); i++) {
+		lp_set_cmdline("messaging sockets", sockets[i]);
+
+		for (j=0; j<ARRAY_SIZE(num_children); j++) {
+			double latency = 0, rate = 0, bcast = 0;
+
+			if (!messaging_bench_run(ev, num_children[j],
+						 &latency, &rate, &bcast)) {
+				ret = false;
+				continue;
+			}
+			printf("messaging sockets = %-3s %2d children: "
+			       "latency %8.1f us, %9.0f pings/sec, "
+			       "broadcast %8.1f us\n",
+			       sockets[i], num_children[j], latency, rate,
+			       bcast);
+		}
+	}
+
+	lp_set_cmdline("messaging sockets", orig ? "yes" : "no");
+	TALLOC_FREE(ev);
+	return ret;
+}
@@ -0,0 +1,220 @@
+/*
+   Unix SMB/CIFS implementation.
+   Messages to a busy process must arrive in the order they were sent
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "includes.h"
+#include "torture/proto.h"
+#include "messages.h"
+#include "serverid.h"
+
+/*
+ * More than a socket queue holds, but below the limit of messages the
+ * sender queues for a busy receiver
+ */
+#define MESSAGING_ORDER_NUM_MSGS 500
+
+struct messaging_order_state {
+	uint32_t next;
+	bool in_order;
+	bool done;
+	bool hello;
+};
+
+static void messaging_order_ping(struct messaging_context *msg_ctx,
+				 void *private_data,
+				 uint32_t msg_type,
+				 struct server_id server_id,
+				 DATA_BLOB *data)
+{
+	struct messaging_order_state *state =
+		(struct messaging_order_state *)private_data;
+
+	if ((data->length != sizeof(uint32_t)) ||
+	    (IVAL(data->data, 0) != state->next)) {
+		state->in_order = false;
+	}
+	state->next += 1;
+	if (state->next == MESSAGING_ORDER_NUM_MSGS) {
+		state->done = true;
+	}
+}
+
+static void messaging_order_pong(struct messaging_context *msg_ctx,
+				 void *private_data,
+				 uint32_t msg_type,
+				 struct server_id server_id,
+				 DATA_BLOB *data)
+{
+	struct messaging_order_state *state =
+		(struct messaging_order_state *)private_data;
+
+	if (!state->hello) {
+		state->hello = true;
+		return;
+	}
+	state->in_order = (data->length == 1) && (data->data[0] == 1);
+	state->done = true;
+}
+
+/*
+ * The child says hello, then sleeps so that its socket queue fills
+ * up, then checks the sequence numbers and reports back
+ */
+static void messaging_order_child(struct tevent_context *ev,
+				  struct messaging_context *msg_ctx,
+				  struct server_id parent)
+{
+	struct messaging_order_state state;
+	uint8_t result;
+	NTSTATUS status;
+
+	ZERO_STRUCT(state);
+	state.in_order = true;
+
+	status = reinit_after_fork(msg_ctx, ev, true);
+	if (!NT_STATUS_IS_OK(status)) {
+		exit(1);
+	}
+	/* Replace the default MSG_PING handler that answers with a pong */
+	messaging_deregister(msg_ctx, MSG_PING, NULL);
+	messaging_register(msg_ctx, &state, MSG_PING, messaging_order_ping);
+
+	status = messaging_send(msg_ctx, parent, MSG_PONG, &data_blob_null);
+	if (!NT_STATUS_IS_OK(status)) {
+		exit(1);
+	}
+
+	sleep(1);
+
+	while (!state.done) {
+		if (tevent_loop_once(ev) != 0) {
+			exit(1);
+		}
+	}
+
+	result = state.in_order ? 1 : 0;
+	status = messaging_send_buf(msg_ctx, parent, MSG_PONG, &result, 1);
+	if (!NT_STATUS_IS_OK(status)) {
+		exit(1);
+	}
+	TALLOC_FREE(msg_ctx);
+	exit(0);
+}
+
+static bool messaging_order_wait(struct tevent_context *ev,
+				 struct messaging_order_state *state,
+				 bool *pflag)
+{
+	struct timeval start = timeval_current();
+
+	while (!*pflag) {
+		if (timeval_elapsed(&start) > 30) {
+			printf("Timed out waiting for the child\n");
+			return false;
+		}
+		if (tevent_loop_once(ev) != 0) {
+			printf("tevent_loop_once failed\n");
+			return false;
+		}
+	}
+	return true;
+}
+
+bool run_local_messaging_order(int dummy)
+{
+	TALLOC_CTX *frame = talloc_stackframe();
+	struct tevent_context *ev;
+	struct messaging_context *msg_ctx;
+	struct messaging_order_state state;
+	struct server_id child;
+	bool orig = lp_messaging_sockets();
+	bool ret = false;
+	pid_t pid = -1;
+	int i, status;
+
+	ZERO_STRUCT(state);
+
+	lp_set_cmdline("messaging sockets", "yes");
+
+	ev = tevent_context_init(frame);
+	if (ev == NULL) {
+		printf("tevent_context_init failed\n");
+		goto done;
+	}
+	msg_ctx = messaging_init(frame, ev);
+	if (msg_ctx == NULL) {
+		printf("messaging_init failed\n");
+		goto done;
+	}
+	messaging_register(msg_ctx, &state, MSG_PONG, messaging_order_pong);
+
+	pid = fork();
+	if (pid == -1) {
+		printf("fork failed: %s\n", strerror(errno));
+		goto done;
+	}
+	if (pid == 0) {
+		messaging_order_child(ev, msg_ctx,
+				      messaging_server_id(msg_ctx));
+	}
+	child = pid_to_procid(pid);
+
+	if (!messaging_order_wait(ev, &state, &state.hello)) {
+		goto done;
+	}
+
+	/*
+	 * Send everything without running the event loop, most of it
+	 * finds the child's socket queue full
+	 */
+	for (i=0; i<MESSAGING_ORDER_NUM_MSGS; i++) {
+		uint8_t buf[4];
+		NTSTATUS st;
+
+		SIVAL(buf, 0, i);
+		st = messaging_send_buf(msg_ctx, child, MSG_PING, buf,
+					sizeof(buf));
+		if (!NT_STATUS_IS_OK(st)) {
+			printf("message %d failed: %s\n", i, nt_errstr(st));
+			goto done;
+		}
+	}
+
+	if (!messaging_order_wait(ev, &state, &state.done)) {
+		goto done;
+	}
+	if (!state.in_order) {
+		printf("The child got the messages out of order\n");
+		goto done;
+	}
+
+	ret = true;
+done:
+	if (pid > 0) {
+		if (!ret) {
+			kill(pid, SIGTERM);
+		}
+		if ((waitpid(pid, &status, 0) != -1) && ret &&
+		    (!WIFEXITED(status) || (WEXITSTATUS(status) != 0))) {
+			printf("child failed\n");
+			ret = false;
+		}
+	}
+	lp_set_cmdline("messaging sockets", orig ? "yes" : "no");
+	TALLOC_FREE(frame);
+	return ret;
+}
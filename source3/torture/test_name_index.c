@@ -0,0 +1,135 @@
+/*
+   Unix SMB/CIFS implementation.
+   Test the case insensitive name index against changes by others
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "includes.h"
+#include "torture/proto.h"
+#include "system/filesys.h"
+#include "libsmb/libsmb.h"
+
+/*
+ * More than the 1000 entries the server needs to keep an index
+ */
+#define NAME_INDEX_NUM_FILES 1100
+
+static NTSTATUS name_index_count_fn(const char *mnt, struct file_info *finfo,
+				    const char *mask, void *state)
+{
+	int *count = (int *)state;
+
+	if (strequal(finfo->name, ".") || strequal(finfo->name, "..")) {
+		return NT_STATUS_OK;
+	}
+	*count += 1;
+	return NT_STATUS_OK;
+}
+
+bool run_name_index(int dummy)
+{
+	struct cli_state *cli1 = NULL, *cli2 = NULL;
+	const char *dname = "\\name_index";
+	int count;
+	bool ret = false;
+	NTSTATUS status;
+
+	printf("Starting name index test\n");
+
+	if (!torture_open_connection(&cli1, 0) ||
+	    !torture_open_connection(&cli2, 1)) {
+		goto done;
+	}
+
+	torture_clean_dir(cli1, dname);
+
+	if (!torture_fill_dir(cli1, dname, NAME_INDEX_NUM_FILES)) {
+		goto cleanup;
+	}
+
+	/* Builds the index in cli1's smbd */
+	if (!torture_check_open(cli1, "\\name_index\\FILE17", NT_STATUS_OK) ||
+	    !torture_check_open(cli1, "\\name_index\\NoSuchFile",
+				NT_STATUS_OBJECT_NAME_NOT_FOUND)) {
+		goto cleanup;
+	}
+
+	/*
+	 * Changes by another smbd have to be visible right away, not
+	 * only once cli1's smbd got around to read its kernel events
+	 */
+	if (!torture_create_file(cli2, "\\name_index\\NewName") ||
+	    !torture_check_open(cli1, "\\name_index\\NEWNAME", NT_STATUS_OK)) {
+		goto cleanup;
+	}
+
+	status = cli_rename(cli2, "\\name_index\\NewName",
+			    "\\name_index\\Renamed");
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_rename failed: %s\n", nt_errstr(status));
+		goto cleanup;
+	}
+	if (!torture_check_open(cli1, "\\name_index\\newname",
+				NT_STATUS_OBJECT_NAME_NOT_FOUND) ||
+	    !torture_check_open(cli1, "\\name_index\\RENAMED",
+				NT_STATUS_OK)) {
+		goto cleanup;
+	}
+
+	status = cli_unlink(cli2, "\\name_index\\Renamed", 0);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_unlink failed: %s\n", nt_errstr(status));
+		goto cleanup;
+	}
+	if (!torture_check_open(cli1, "\\name_index\\renamed",
+				NT_STATUS_OBJECT_NAME_NOT_FOUND)) {
+		goto cleanup;
+	}
+
+	/*
+	 * A create with a different case must open the other smbd's
+	 * file, not add a second case variant
+	 */
+	if (!torture_create_file(cli2, "\\name_index\\Other") ||
+	    !torture_create_file(cli1, "\\name_index\\OTHER")) {
+		goto cleanup;
+	}
+
+	count = 0;
+	status = cli_list(cli1, "\\name_index\\*", 0, name_index_count_fn,
+			  &count);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_list failed: %s\n", nt_errstr(status));
+		goto cleanup;
+	}
+	if (count != NAME_INDEX_NUM_FILES + 1) {
+		printf("Found %d files, expected %d\n", count,
+		       NAME_INDEX_NUM_FILES + 1);
+		goto cleanup;
+	}
+
+	ret = true;
+
+cleanup:
+	torture_clean_dir(cli1, dname);
+done:
+	if (cli1 != NULL) {
+		torture_close_connection(cli1);
+	}
+	if (cli2 != NULL) {
+		torture_close_connection(cli2);
+	}
+	return ret;
+}
@@ -0,0 +1,117 @@
+/*
+   Unix SMB/CIFS implementation.
+   Test the shared stat cache against renames by others
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "includes.h"
+#include "torture/proto.h"
+#include "system/filesys.h"
+#include "libsmb/libsmb.h"
+
+static void stat_cache_cleanup(struct cli_state *cli)
+{
+	torture_clean_dir(cli, "\\stat_cache\\Dir");
+	torture_clean_dir(cli, "\\stat_cache\\Moved");
+	cli_rmdir(cli, "\\stat_cache");
+}
+
+bool run_stat_cache_shared(int dummy)
+{
+	struct cli_state *cli1 = NULL, *cli2 = NULL;
+	bool ret = false;
+	NTSTATUS status;
+
+	printf("Starting shared stat cache test\n");
+
+	if (!torture_open_connection(&cli1, 0) ||
+	    !torture_open_connection(&cli2, 1)) {
+		goto done;
+	}
+
+	stat_cache_cleanup(cli1);
+
+	status = cli_mkdir(cli1, "\\stat_cache");
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_mkdir failed: %s\n", nt_errstr(status));
+		goto done;
+	}
+	if (!torture_fill_dir(cli1, "\\stat_cache\\Dir", 1)) {
+		goto cleanup;
+	}
+
+	/*
+	 * Both smbds translate the same name, with a shared stat
+	 * cache the second one finds the first one's entry
+	 */
+	if (!torture_check_open(cli1, "\\STAT_CACHE\\DIR\\FILE0",
+				NT_STATUS_OK) ||
+	    !torture_check_open(cli2, "\\STAT_CACHE\\DIR\\FILE0",
+				NT_STATUS_OK)) {
+		goto cleanup;
+	}
+
+	/*
+	 * A rename in one smbd has to invalidate the entries of the
+	 * other one
+	 */
+	status = cli_rename(cli2, "\\stat_cache\\Dir", "\\stat_cache\\Moved");
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_rename failed: %s\n", nt_errstr(status));
+		goto cleanup;
+	}
+	if (!torture_check_open(cli1, "\\STAT_CACHE\\DIR\\FILE0",
+				NT_STATUS_OBJECT_PATH_NOT_FOUND) ||
+	    !torture_check_open(cli1, "\\STAT_CACHE\\MOVED\\FILE0",
+				NT_STATUS_OK)) {
+		goto cleanup;
+	}
+
+	/*
+	 * Recreating the old name must be found under the new
+	 * translation, not under the one cached before the rename
+	 */
+	if (!torture_fill_dir(cli2, "\\stat_cache\\Dir", 1) ||
+	    !torture_check_open(cli1, "\\STAT_CACHE\\DIR\\FILE0",
+				NT_STATUS_OK) ||
+	    !torture_check_open(cli2, "\\stat_cache\\moved\\file0",
+				NT_STATUS_OK)) {
+		goto cleanup;
+	}
+
+	/* Same for an unlink */
+	status = cli_unlink(cli2, "\\stat_cache\\Moved\\file0", 0);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_unlink failed: %s\n", nt_errstr(status));
+		goto cleanup;
+	}
+	if (!torture_check_open(cli1, "\\STAT_CACHE\\MOVED\\FILE0",
+				NT_STATUS_OBJECT_NAME_NOT_FOUND)) {
+		goto cleanup;
+	}
+
+	ret = true;
+
+cleanup:
+	stat_cache_cleanup(cli1);
+done:
+	if (cli1 != NULL) {
+		torture_close_connection(cli1);
+	}
+	if (cli2 != NULL) {
+		torture_close_connection(cli2);
+	}
+	return ret;
+}
@@ -2767,6 +2767,165 @@ fail_nofd:
 	return correct;
 }
 
+/*
+ * Many small locks and one wide read lock over all of them. A conflict
+ * search that only prunes by a running maximum of lock ends has to
+ * walk all locks here, check that the results are still right.
+ */
+
+#define LOCKTEST10_NUM_LOCKS 2000
+#define LOCKTEST10_STRIDE 100
+#define LOCKTEST10_SIZE 10
+
+static bool run_locktest10(int dummy)
+{
+	static struct cli_state *cli1, *cli2;
+	const char *fname = "\\lockt10.lck";
+	const uint32_t wide_start = 5;
+	const uint32_t wide_size =
+		LOCKTEST10_NUM_LOCKS * LOCKTEST10_STRIDE;
+	uint16_t fnum1, fnum2;
+	char buf[LOCKTEST10_SIZE];
+	bool ret;
+	bool correct = true;
+	NTSTATUS status;
+	int i;
+
+	if (!torture_open_connection(&cli1, 0) ||
+	    !torture_open_connection(&cli2, 1)) {
+		return false;
+	}
+
+	printf("starting locktest10\n");
+
+	cli_unlink(cli1, fname, FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN);
+
+	status = cli_openx(cli1, fname, O_RDWR|O_CREAT|O_EXCL, DENY_NONE,
+			   &fnum1);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("open of %s failed (%s)\n", fname, nt_errstr(status));
+		return false;
+	}
+	status = cli_openx(cli2, fname, O_RDWR, DENY_NONE, &fnum2);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("open2 of %s failed (%s)\n", fname, nt_errstr(status));
+		correct = false;
+		goto fail;
+	}
+
+	memset(buf, 0, sizeof(buf));
+
+	for (i=0; i<LOCKTEST10_NUM_LOCKS; i++) {
+		status = cli_lock32(cli1, fnum1, i * LOCKTEST10_STRIDE,
+				    LOCKTEST10_SIZE, 0, WRITE_LOCK);
+		if (!NT_STATUS_IS_OK(status)) {
+			printf("lock %d failed (%s)\n", i, nt_errstr(status));
+			correct = false;
+			goto fail;
+		}
+	}
+
+	/* Our own write locks don't stop our read lock on top. */
+	status = cli_lock32(cli1, fnum1, wide_start, wide_size, 0, READ_LOCK);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("wide read lock failed (%s)\n", nt_errstr(status));
+		correct = false;
+		goto fail;
+	}
+
+	for (i=0; i<LOCKTEST10_NUM_LOCKS; i += LOCKTEST10_NUM_LOCKS/10) {
+		uint32_t locked = i * LOCKTEST10_STRIDE;
+		uint32_t gap = locked + LOCKTEST10_STRIDE / 2;
+
+		ret = NT_STATUS_IS_OK(cli_lock32(cli2, fnum2, locked,
+						 LOCKTEST10_SIZE, 0,
+						 READ_LOCK));
+		EXPECTED(ret, false);
+		printf("a different connection %s read lock a write locked "
+		       "range at %u\n", ret?"can":"cannot", locked);
+
+		ret = NT_STATUS_IS_OK(cli_lock32(cli2, fnum2, gap,
+						 LOCKTEST10_SIZE, 0,
+						 READ_LOCK)) &&
+		      NT_STATUS_IS_OK(cli_unlock(cli2, fnum2, gap,
+						 LOCKTEST10_SIZE));
+		EXPECTED(ret, true);
+		printf("a different connection %s read lock the gap at "
+		       "%u\n", ret?"can":"cannot", gap);
+
+		ret = NT_STATUS_IS_OK(cli_lock32(cli2, fnum2, gap,
+						 LOCKTEST10_SIZE, 0,
+						 WRITE_LOCK));
+		EXPECTED(ret, false);
+		printf("a different connection %s write lock the read "
+		       "locked gap at %u\n", ret?"can":"cannot", gap);
+
+		ret = test_cli_read(cli2, fnum2, buf, locked,
+				    LOCKTEST10_SIZE, NULL, LOCKTEST10_SIZE);
+		EXPECTED(ret, false);
+		printf("a different connection %s read a write locked "
+		       "range at %u\n", ret?"can":"cannot", locked);
+
+		ret = test_cli_read(cli2, fnum2, buf, gap,
+				    LOCKTEST10_SIZE, NULL, 0);
+		EXPECTED(ret, true);
+		printf("a different connection %s read the gap at %u\n",
+		       ret?"can":"cannot", gap);
+
+		ret = NT_STATUS_IS_OK(cli_writeall(cli2, fnum2, 0,
+						   (uint8_t *)buf, gap,
+						   LOCKTEST10_SIZE, NULL));
+		EXPECTED(ret, false);
+		printf("a different connection %s write the read locked "
+		       "gap at %u\n", ret?"can":"cannot", gap);
+	}
+
+	/* Past the wide lock nothing is locked. */
+	ret = NT_STATUS_IS_OK(cli_lock32(cli2, fnum2, wide_start + wide_size,
+					 LOCKTEST10_SIZE, 0, WRITE_LOCK)) &&
+	      NT_STATUS_IS_OK(cli_unlock(cli2, fnum2, wide_start + wide_size,
+					 LOCKTEST10_SIZE));
+	EXPECTED(ret, true);
+	printf("a different connection %s write lock past the wide lock\n",
+	       ret?"can":"cannot");
+
+	/* Without the wide lock the gaps are free for writing. */
+	status = cli_unlock(cli1, fnum1, wide_start, wide_size);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("unlock of the wide lock failed (%s)\n",
+		       nt_errstr(status));
+		correct = false;
+		goto fail;
+	}
+
+	ret = NT_STATUS_IS_OK(cli_lock32(cli2, fnum2, LOCKTEST10_STRIDE / 2,
+					 LOCKTEST10_SIZE, 0, WRITE_LOCK));
+	EXPECTED(ret, true);
+	printf("a different connection %s write lock a gap without the "
+	       "wide lock\n", ret?"can":"cannot");
+
+	ret = NT_STATUS_IS_OK(cli_lock32(cli2, fnum2,
+					 LOCKTEST10_SIZE / 2,
+					 LOCKTEST10_SIZE, 0, READ_LOCK));
+	EXPECTED(ret, false);
+	printf("a different connection %s read lock across the end of a "
+	       "write lock\n", ret?"can":"cannot");
+
+fail:
+	cli_close(cli1, fnum1);
+	cli_close(cli2, fnum2);
+	cli_unlink(cli1, fname, FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN);
+	if (!torture_close_connection(cli1)) {
+		correct = false;
+	}
+	if (!torture_close_connection(cli2)) {
+		correct = false;
+	}
+
+	printf("finished locktest10\n");
+	return correct;
+}
+
 /*
 test whether fnums and tids open on one VC are available on another (a major
 security hole)
@@ -5327,6 +5486,81 @@ NTSTATUS torture_setup_unix_extensions(struct cli_state *cli)
 	return NT_STATUS_OK;
 }
 
+/*
+  create fname, opening it if it already exists
+ */
+bool torture_create_file(struct cli_state *cli, const char *fname)
+{
+	uint16_t fnum;
+	NTSTATUS status;
+
+	status = cli_openx(cli, fname, O_RDWR|O_CREAT, DENY_NONE, &fnum);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("creating %s failed: %s\n", fname, nt_errstr(status));
+		return false;
+	}
+	cli_close(cli, fnum);
+	return true;
+}
+
+/*
+  check that opening fname returns expected
+ */
+bool torture_check_open(struct cli_state *cli, const char *fname,
+			NTSTATUS expected)
+{
+	uint16_t fnum;
+	NTSTATUS status;
+
+	status = cli_openx(cli, fname, O_RDWR, DENY_NONE, &fnum);
+	if (NT_STATUS_IS_OK(status)) {
+		cli_close(cli, fnum);
+	}
+	if (!NT_STATUS_EQUAL(status, expected)) {
+		printf("opening %s returned %s, expected %s\n", fname,
+		       nt_errstr(status), nt_errstr(expected));
+		return false;
+	}
+	return true;
+}
+
+/*
+  create dname with the empty files file0 .. file<num_files-1>
+ */
+bool torture_fill_dir(struct cli_state *cli, const char *dname,
+		      int num_files)
+{
+	char fname[1024];
+	NTSTATUS status;
+	int i;
+
+	status = cli_mkdir(cli, dname);
+	if (!NT_STATUS_IS_OK(status)) {
+		printf("cli_mkdir %s failed: %s\n", dname, nt_errstr(status));
+		return false;
+	}
+
+	for (i = 0; i < num_files; i++) {
+		snprintf(fname, sizeof(fname), "%s\\file%d", dname, i);
+		if (!torture_create_file(cli, fname)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+  remove the files in dname and dname itself
+ */
+void torture_clean_dir(struct cli_state *cli, const char *dname)
+{
+	char mask[1024];
+
+	snprintf(mask, sizeof(mask), "%s\\*", dname);
+	cli_unlink(cli, mask, FILE_ATTRIBUTE_SYSTEM|FILE_ATTRIBUTE_HIDDEN);
+	cli_rmdir(cli, dname);
+}
+
 /*
   Test POSIX open /mkdir calls.
  */
@@ -6448,6 +6682,201 @@ static bool run_sesssetup_bench(int dummy)
 	return true;
 }
 
+/*
+ * Measure the open/close rate on a file that is already held open
+ * by a growing number of other opens. Every open and close has to
+ * look at all share mode entries of the file. Run it against two
+ * server builds to compare them, the last line sums up a run.
+ */
+
+static bool run_open_bench(int dummy)
+{
+	static struct cli_state *cli1, *cli2;
+	const char *fname = "\\open_bench.dat";
+	const int num_holders[] = { 0, 16, 64, 256, 1024 };
+	uint16_t *holders;
+	uint16_t fnum;
+	NTSTATUS status;
+	int i, j, held = 0;
+	double rate = 0, base_rate = 0;
+	bool ret = false;
+
+	printf("starting open bench\n");
+
+	if (!torture_open_connection(&cli1, 0) ||
+	    !torture_open_connection(&cli2, 1)) {
+		return false;
+	}
+
+	holders = talloc_array(talloc_tos(), uint16_t,
+			       num_holders[ARRAY_SIZE(num_holders)-1]);
+	if (holders == NULL) {
+		goto fail;
+	}
+
+	cli_unlink(cli1, fname, FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN);
+
+	for (i=0; i<ARRAY_SIZE(num_holders); i++) {
+		struct timeval start;
+		double seconds;
+
+		while (held < num_holders[i]) {
+			status = cli_ntcreate(
+				cli1, fname, 0, FILE_READ_DATA,
+				FILE_ATTRIBUTE_NORMAL,
+				FILE_SHARE_READ|FILE_SHARE_WRITE|
+				FILE_SHARE_DELETE,
+				FILE_OPEN_IF, 0, 0, &holders[held]);
+			if (!NT_STATUS_IS_OK(status)) {
+				printf("open %d of %s failed: %s\n", held,
+				       fname, nt_errstr(status));
+				goto fail;
+			}
+			held += 1;
+		}
+
+		start = timeval_current();
+
+		for (j=0; j<torture_numops; j++) {
+			status = cli_ntcreate(
+				cli2, fname, 0, FILE_READ_DATA,
+				FILE_ATTRIBUTE_NORMAL,
+				FILE_SHARE_READ|FILE_SHARE_WRITE|
+				FILE_SHARE_DELETE,
+				FILE_OPEN_IF, 0, 0, &fnum);
+			if (!NT_STATUS_IS_OK(status)) {
+				printf("open of %s failed: %s\n", fname,
+				       nt_errstr(status));
+				goto fail;
+			}
+			status = cli_close(cli2, fnum);
+			if (!NT_STATUS_IS_OK(status)) {
+				printf("close failed: %s\n",
+				       nt_errstr(status));
+				goto fail;
+			}
+		}
+
+		seconds = timeval_elapsed(&start);
+		rate = torture_numops / seconds;
+		if (i == 0) {
+			base_rate = rate;
+		}
+
+		printf("%5d openers: %d open/close in %.2f seconds, "
+		       "%.1f per second, %.2fx the rate without openers\n",
+		       held, torture_numops, seconds, rate, rate / base_rate);
+	}
+
+	/*
+	 * One line to compare between server builds: the rate without
+	 * other openers and with the most of them
+	 */
+	printf("open bench: %.1f per second without openers, %.1f per "
+	       "second with %d openers\n", base_rate, rate, held);
+
+	ret = true;
+fail:
+	for (j=0; j<held; j++) {
+		cli_close(cli1, holders[j]);
+	}
+	TALLOC_FREE(holders);
+	cli_unlink(cli1, fname, FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN);
+
+	if (!torture_close_connection(cli1)) {
+		ret = false;
+	}
+	if (!torture_close_connection(cli2)) {
+		ret = false;
+	}
+	return ret;
+}
+
+/*
+ * Time requests on one handle while more and more other handles are
+ * open on the same connection
+ */
+static bool run_handle_bench(int dummy)
+{
+	static struct cli_state *cli;
+	const char *fname = "\\handle_bench.dat";
+	const int num_handles[] = { 1, 1000, 4000, 8000 };
+	uint16_t *handles;
+	NTSTATUS status;
+	int i, j, opened = 0;
+	bool ret = false;
+
+	printf("starting handle bench\n");
+
+	if (!torture_open_connection(&cli, 0)) {
+		return false;
+	}
+
+	handles = talloc_array(talloc_tos(), uint16_t,
+			       num_handles[ARRAY_SIZE(num_handles)-1]);
+	if (handles == NULL) {
+		goto fail;
+	}
+
+	cli_unlink(cli, fname, FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN);
+
+	for (i=0; i<ARRAY_SIZE(num_handles); i++) {
+		struct timeval start;
+		double seconds;
+
+		while (opened < num_handles[i]) {
+			status = cli_ntcreate(
+				cli, fname, 0, FILE_READ_ATTRIBUTES,
+				FILE_ATTRIBUTE_NORMAL,
+				FILE_SHARE_READ|FILE_SHARE_WRITE|
+				FILE_SHARE_DELETE,
+				FILE_OPEN_IF, 0, 0, &handles[opened]);
+			if (!NT_STATUS_IS_OK(status)) {
+				printf("open %d of %s failed: %s\n", opened,
+				       fname, nt_errstr(status));
+				goto fail;
+			}
+			opened += 1;
+		}
+
+		start = timeval_current();
+
+		for (j=0; j<torture_numops; j++) {
+			uint16_t attr;
+			SMB_OFF_T size;
+			time_t c_time, a_time, m_time;
+
+			/* The oldest handle, the one furthest down a list */
+			status = cli_getattrE(cli, handles[0], &attr, &size,
+					      &c_time, &a_time, &m_time);
+			if (!NT_STATUS_IS_OK(status)) {
+				printf("getattrE failed: %s\n",
+				       nt_errstr(status));
+				goto fail;
+			}
+		}
+
+		seconds = timeval_elapsed(&start);
+
+		printf("%5d handles: %d requests in %.2f seconds, "
+		       "%.1f per second\n", opened, torture_numops, seconds,
+		       torture_numops / seconds);
+	}
+
+	ret = true;
+fail:
+	for (j=0; j<opened; j++) {
+		cli_close(cli, handles[j]);
+	}
+	TALLOC_FREE(handles);
+	cli_unlink(cli, fname, FILE_ATTRIBUTE_SYSTEM | FILE_ATTRIBUTE_HIDDEN);
+
+	if (!torture_close_connection(cli)) {
+		ret = false;
+	}
+	return ret;
+}
+
 static bool subst_test(const char *str, const char *user, const char *domain,
 		       uid_t uid, gid_t gid, const char *expected)
 {
@@ -8804,6 +9233,7 @@ static struct {
 	{"LOCK7",  run_locktest7,  0},
 	{"LOCK8",  run_locktest8,  0},
 	{"LOCK9",  run_locktest9,  0},
+	{"LOCK10", run_locktest10, 0},
 	{"UNLINK", run_unlinktest, 0},
 	{"BROWSE", run_browsetest, 0},
 	{"ATTR",   run_attrtest,   0},
@@ -8832,6 +9262,9 @@ static struct {
 	{"POSIX", run_simple_posix_open_test, 0},
 	{"POSIX-APPEND", run_posix_append, 0},
 	{"CASE-INSENSITIVE-CREATE", run_case_insensitive_create, 0},
+	{"NAME-INDEX", run_name_index, 0},
+	{"STAT-CACHE-SHARED", run_stat_cache_shared, 0},
+	{"DIR-STAT-CACHE", run_dir_stat_cache, 0},
 	{"ASYNC-ECHO", run_async_echo, 0},
 	{ "UID-REGRESSION-TEST", run_uid_regression_test, 0},
 	{ "SHORTNAME-TEST", run_shortname_test, 0},
@@ -8859,6 +9292,8 @@ static struct {
 	{"FDSESS", run_fdsesstest, 0},
 	{ "EATEST", run_eatest, 0},
 	{ "SESSSETUP_BENCH", run_sesssetup_bench, 0},
+	{ "OPEN-BENCH", run_open_bench, 0},
+	{ "HANDLE-BENCH", run_handle_bench, 0},
 	{ "CHAIN1", run_chain1, 0},
 	{ "CHAIN2", run_chain2, 0},
 	{ "WINDOWS-WRITE", run_windows_write, 0},
@@ -8895,6 +9330,9 @@ static struct {
 	{ "LOCAL-CONVERT-STRING", run_local_convert_string, 0},
 	{ "LOCAL-CONV-AUTH-INFO", run_local_conv_auth_info, 0},
 	{ "LOCAL-sprintf_append", run_local_sprintf_append, 0},
+	{ "LOCAL-CRYPTO-BENCH", run_local_crypto_bench, 0},
+	{ "LOCAL-MESSAGING-BENCH", run_local_messaging_bench, 0},
+	{ "LOCAL-MESSAGING-ORDER", run_local_messaging_order, 0},
 	{NULL, NULL, 0}};
 
 
@@ -53,6 +53,7 @@ static bool locks_only;            /* Added by RJS */
 static bool processes_only;
 static bool show_brl;
 static bool numeric_only;
+static bool credits_only;
 
 const char *username = NULL;
 
@@ -284,8 +285,159 @@ static int traverse_sessionid(const char *key, struct sessionid *session,
 	return 0;
 }
 
+struct credit_pids {
+	struct server_id *pids;
+	int num_pids;
+};
 
+static void credit_pids_add(struct credit_pids *state, struct server_id pid)
+{
+	struct server_id *pids;
+	int i;
+
+	if (!process_exists(pid)) {
+		return;
+	}
+
+	for (i=0; i<state->num_pids; i++) {
+		if (cluster_id_equal(&pid, &state->pids[i])) {
+			return;
+		}
+	}
+
+	pids = talloc_realloc(talloc_tos(), state->pids, struct server_id,
+			      state->num_pids + 1);
+	if (pids == NULL) {
+		return;
+	}
+	pids[state->num_pids] = pid;
+	state->pids = pids;
+	state->num_pids += 1;
+}
+
+static int credit_pids_sessionid(const char *key, struct sessionid *session,
+				 void *private_data)
+{
+	struct credit_pids *state = (struct credit_pids *)private_data;
+
+	if (Ucrit_checkUid(session->uid)) {
+		credit_pids_add(state, session->pid);
+	}
+	return 0;
+}
+
+static int credit_pids_connection(const struct connections_key *key,
+				  const struct connections_data *crec,
+				  void *private_data)
+{
+	struct credit_pids *state = (struct credit_pids *)private_data;
+
+	if (crec->cnum != -1 && Ucrit_checkUid(crec->uid)) {
+		credit_pids_add(state, crec->pid);
+	}
+	return 0;
+}
+
+static int num_credit_replies;
+
+static void print_credit_stats(struct messaging_context *msg,
+			       void *private_data,
+			       uint32_t msg_type,
+			       struct server_id pid,
+			       DATA_BLOB *data)
+{
+	struct smb2_credit_stats stats;
+	enum ndr_err_code ndr_err;
+
+	num_credit_replies++;
+
+	ndr_err = ndr_pull_struct_blob(data, talloc_tos(), &stats,
+			(ndr_pull_flags_fn_t)ndr_pull_smb2_credit_stats);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		return;
+	}
+
+	if (stats.window_max == 0) {
+		/* not an SMB2 connection */
+		return;
+	}
 
+	d_printf("%-7s  %6u  %6u  %6u  %7u  %10u  %10llu  %10llu  %8llu  %8llu\n",
+		 procid_str_static(&pid),
+		 (unsigned int)stats.window,
+		 (unsigned int)stats.window_min,
+		 (unsigned int)stats.window_max,
+		 (unsigned int)stats.granted,
+		 (unsigned int)stats.latency_usec,
+		 (unsigned long long)stats.requests,
+		 (unsigned long long)stats.credits,
+		 (unsigned long long)stats.grown,
+		 (unsigned long long)stats.shrunk);
+}
+
+static void credit_stats_timeout(struct tevent_context *ev,
+				 struct tevent_timer *te,
+				 struct timeval now,
+				 void *private_data)
+{
+	bool *timed_out = (bool *)private_data;
+
+	*timed_out = true;
+}
+
+/* Ask every smbd for the state of its SMB2 credit window */
+
+static int show_credit_stats(struct messaging_context *msg_ctx)
+{
+	struct credit_pids state;
+	struct tevent_timer *te;
+	bool timed_out = false;
+	int i, num_sent = 0;
+
+	ZERO_STRUCT(state);
+
+	sessionid_traverse_read(credit_pids_sessionid, &state);
+	connections_forall_read(credit_pids_connection, &state);
+
+	d_printf("\nPID      Window     Min     Max  Granted  Latency us"
+		 "    Requests     Credits     Grown    Shrunk\n");
+	d_printf("-----------------------------------------------------------"
+		 "----------------------------------------------\n");
+
+	messaging_register(msg_ctx, NULL, MSG_SMB_CREDIT_STATS,
+			   print_credit_stats);
+
+	for (i=0; i<state.num_pids; i++) {
+		NTSTATUS status;
+
+		status = messaging_send(msg_ctx, state.pids[i],
+					MSG_SMB_REQ_CREDIT_STATS, &data_blob_null);
+		if (NT_STATUS_IS_OK(status)) {
+			num_sent++;
+		}
+	}
+
+	te = tevent_add_timer(messaging_event_context(msg_ctx), NULL,
+			      timeval_current_ofs(5, 0),
+			      credit_stats_timeout, &timed_out);
+	if (te == NULL) {
+		return 1;
+	}
+
+	while (!timed_out && num_credit_replies < num_sent) {
+		if (tevent_loop_once(messaging_event_context(msg_ctx)) != 0) {
+			break;
+		}
+	}
+
+	TALLOC_FREE(te);
+	TALLOC_FREE(state.pids);
+	messaging_deregister(msg_ctx, MSG_SMB_CREDIT_STATS, NULL);
+
+	d_printf("\n");
+
+	return 0;
+}
 
  int main(int argc, char *argv[])
 {
@@ -305,12 +457,13 @@ static int traverse_sessionid(const char *key, struct sessionid *session,
 		{"profile-rates", 'R', POPT_ARG_NONE, NULL, 'R', "Show call rates" },
 		{"byterange",	'B', POPT_ARG_NONE,	NULL, 'B', "Include byte range locks"},
 		{"numeric",	'n', POPT_ARG_NONE,	NULL, 'n', "Numeric uid/gid"},
+		{"credits",	'C', POPT_ARG_NONE,	NULL, 'C', "Show SMB2 credit windows only"},
 		POPT_COMMON_SAMBA
 		POPT_TABLEEND
 	};
 	TALLOC_CTX *frame = talloc_stackframe();
 	int ret = 0;
-	struct messaging_context *msg_ctx;
+	struct messaging_context *msg_ctx = NULL;
 
 	sec_init();
 	load_case_tables();
@@ -356,6 +509,9 @@ static int traverse_sessionid(const char *key, struct sessionid *session,
 		case 'n':
 			numeric_only = true;
 			break;
+		case 'C':
+			credits_only = true;
+			break;
 		}
 	}
 
@@ -412,6 +568,20 @@ static int traverse_sessionid(const char *key, struct sessionid *session,
 			break;
 	}
 
+	if (credits_only) {
+		if (msg_ctx == NULL) {
+			msg_ctx = messaging_init(NULL,
+						 event_context_init(NULL));
+			if (msg_ctx == NULL) {
+				fprintf(stderr, "messaging_init failed\n");
+				ret = -1;
+				goto done;
+			}
+		}
+		ret = show_credit_stats(msg_ctx);
+		goto done;
+	}
+
 	if ( show_processes ) {
 		d_printf("\nSamba version %s\n",samba_version_string());
 		d_printf("PID     Username      Group         Machine                        \n");
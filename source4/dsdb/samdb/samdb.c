@@ -57,6 +57,11 @@ struct ldb_context *samdb_connect_url(TALLOC_CTX *mem_ctx,
 	struct dsdb_schema *schema;
 	int ret;
 
+	/* let concurrent writers of the sam share their commit syncs */
+	if (lpcfg_parm_bool(lp_ctx, NULL, "ldb", "group commit", false)) {
+		flags |= LDB_FLG_GROUP_COMMIT;
+	}
+
 	ldb = ldb_wrap_find(url, ev_ctx, lp_ctx, session_info, NULL, flags);
 	if (ldb != NULL)
 		return talloc_reference(mem_ctx, ldb);
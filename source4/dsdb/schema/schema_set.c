@@ -61,6 +61,7 @@ static int dsdb_schema_set_attributes(struct ldb_context *ldb, struct dsdb_schem
 	TALLOC_CTX *mem_ctx;
 	struct ldb_message *msg;
 	struct ldb_message *msg_idx;
+	struct loadparm_context *lp_ctx;
 
 	/* setup our own attribute name to schema handler */
 	ldb_schema_attribute_set_override_handler(ldb, dsdb_attribute_handler_override, schema);
@@ -100,6 +101,20 @@ static int dsdb_schema_set_attributes(struct ldb_context *ldb, struct dsdb_schem
 		goto op_error;
 	}
 
+	/*
+	 * Older versions can't read paged index records, so they are
+	 * only written when explicitly asked for. Turning the option
+	 * off again re-indexes the database into the old format.
+	 */
+	lp_ctx = talloc_get_type(ldb_get_opaque(ldb, "loadparm"),
+				 struct loadparm_context);
+	if (lp_ctx != NULL &&
+	    lpcfg_parm_bool(lp_ctx, NULL, "dsdb", "paged index", false)) {
+		ret = ldb_msg_add_string(msg_idx, "@IDXPAGED", "1");
+		if (ret != LDB_SUCCESS) {
+			goto op_error;
+		}
+	}
 
 	ret = ldb_msg_add_string(msg_idx, "@IDXVERSION", SAMDB_INDEXING_VERSION);
 	if (ret != LDB_SUCCESS) {
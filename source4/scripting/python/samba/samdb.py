@@ -53,6 +53,13 @@ class SamDB(samba.Ldb):
 
         self.url = url
 
+        # Allow admins to share the commit syncs of the sam partitions,
+        # this only takes effect when they are created
+        if lp is not None:
+            group_commit_p = lp.get("group commit", "ldb")
+            if group_commit_p is not None and group_commit_p == True:
+                flags |= ldb.FLG_GROUP_COMMIT
+
         super(SamDB, self).__init__(url=url, lp=lp, modules_dir=modules_dir,
             session_info=session_info, credentials=credentials, flags=flags,
             options=options)
@@ -288,8 +288,10 @@ for t in ["local.convert_string_handle", "local.convert_string", "local.ndr"]:
 tdbtorture4 = binpath("tdbtorture")
 if os.path.exists(tdbtorture4):
     plantestsuite("tdb.stress", "none", valgrindify(tdbtorture4))
+    plantestsuite("tdb.stress.group-commit", "none", valgrindify(tdbtorture4 + " -c -k"))
 else:
     skiptestsuite("tdb.stress", "Using system TDB, tdbtorture not available")
+    skiptestsuite("tdb.stress.group-commit", "Using system TDB, tdbtorture not available")
 
 plansmbtorturetestsuite("drs.unit", "none", "ncalrpc:")
 
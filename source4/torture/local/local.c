@@ -67,6 +67,7 @@
 	torture_local_string_case,
 	torture_local_compression,
 	torture_local_event, 
+	torture_local_event_bench,
 	torture_local_torture,
 	torture_local_dbspeed, 
 	torture_local_credentials,
@@ -92,6 +93,10 @@ NTSTATUS torture_local_init(void)
 				      torture_local_crypto_md5);
 	torture_suite_add_simple_test(suite, "crypto.hmacmd5", 
 				      torture_local_crypto_hmacmd5);
+	torture_suite_add_simple_test(suite, "crypto.hmacsha256",
+				      torture_local_crypto_hmacsha256);
+	torture_suite_add_simple_test(suite, "crypto.aes",
+				      torture_local_crypto_aes);
 
 	for (i = 0; suite_generators[i]; i++)
 		torture_suite_add_suite(suite,
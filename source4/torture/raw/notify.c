@@ -1291,6 +1291,132 @@ done:
 	return ret;
 }
 
+/*
+   stress test: many watched directories side by side, each change must
+   only reach the watches on its own directory and the recursive watch
+   above them
+*/
+#define NOTIFY_MANY_DIR BASEDIR "\\many"
+#define NOTIFY_MANY_NUM 200
+
+static bool test_notify_many(struct smbcli_state *cli, TALLOC_CTX *mem_ctx)
+{
+	bool ret = true;
+	union smb_notify notify;
+	union smb_open io;
+	struct smbcli_request *req;
+	struct timeval tv;
+	int fnums[NOTIFY_MANY_NUM+1];
+	int counted[NOTIFY_MANY_NUM+1];
+	int expected[NOTIFY_MANY_NUM+1];
+	int i;
+	NTSTATUS status;
+	bool all_done = false;
+
+	printf("TESTING CHANGE NOTIFY ON %d DIRECTORIES\n", NOTIFY_MANY_NUM);
+
+	io.generic.level = RAW_OPEN_NTCREATEX;
+	io.ntcreatex.in.root_fid.fnum = 0;
+	io.ntcreatex.in.flags = 0;
+	io.ntcreatex.in.access_mask = SEC_FILE_ALL;
+	io.ntcreatex.in.create_options = NTCREATEX_OPTIONS_DIRECTORY;
+	io.ntcreatex.in.file_attr = FILE_ATTRIBUTE_NORMAL;
+	io.ntcreatex.in.share_access = NTCREATEX_SHARE_ACCESS_READ | NTCREATEX_SHARE_ACCESS_WRITE;
+	io.ntcreatex.in.alloc_size = 0;
+	io.ntcreatex.in.open_disposition = NTCREATEX_DISP_OPEN_IF;
+	io.ntcreatex.in.impersonation = NTCREATEX_IMPERSONATION_ANONYMOUS;
+	io.ntcreatex.in.security_flags = 0;
+
+	notify.nttrans.level = RAW_NOTIFY_NTTRANS;
+	notify.nttrans.in.buffer_size = 20000;
+	notify.nttrans.in.completion_filter = FILE_NOTIFY_CHANGE_NAME;
+
+	/*
+	  fnums[0] is a recursive watch on the parent, it sees the
+	  changes in all subdirectories. The others only see their own.
+	*/
+	for (i=0;i<=NOTIFY_MANY_NUM;i++) {
+		fnums[i] = -1;
+	}
+
+	for (i=0;i<=NOTIFY_MANY_NUM;i++) {
+		if (i == 0) {
+			io.ntcreatex.in.fname = NOTIFY_MANY_DIR;
+		} else {
+			io.ntcreatex.in.fname = talloc_asprintf(
+				mem_ctx, NOTIFY_MANY_DIR "\\d%d", i);
+		}
+		status = smb_raw_open(cli->tree, mem_ctx, &io);
+		CHECK_STATUS(status, NT_STATUS_OK);
+		fnums[i] = io.ntcreatex.out.file.fnum;
+		counted[i] = 0;
+		expected[i] = (i == 0) ? NOTIFY_MANY_NUM*2 : 2;
+	}
+
+	for (i=0;i<=NOTIFY_MANY_NUM;i++) {
+		notify.nttrans.in.file.fnum = fnums[i];
+		notify.nttrans.in.recursive = (i == 0);
+		req = smb_raw_changenotify_send(cli->tree, &notify);
+		smb_raw_ntcancel(req);
+		status = smb_raw_changenotify_recv(req, mem_ctx, &notify);
+		CHECK_STATUS(status, NT_STATUS_CANCELLED);
+	}
+
+	tv = timeval_current();
+
+	/* trigger 2 events in each subdirectory */
+	for (i=1;i<=NOTIFY_MANY_NUM;i++) {
+		char *path = talloc_asprintf(mem_ctx, NOTIFY_MANY_DIR
+					     "\\d%d\\test.dir", i);
+		smbcli_mkdir(cli->tree, path);
+		smbcli_rmdir(cli->tree, path);
+		talloc_free(path);
+	}
+
+	printf("%d changes took %.4f seconds\n", NOTIFY_MANY_NUM*2,
+	       timeval_elapsed(&tv));
+
+	do {
+		for (i=0;i<=NOTIFY_MANY_NUM;i++) {
+			notify.nttrans.in.file.fnum = fnums[i];
+			notify.nttrans.in.recursive = (i == 0);
+			req = smb_raw_changenotify_send(cli->tree, &notify);
+			smb_raw_ntcancel(req);
+			notify.nttrans.out.num_changes = 0;
+			status = smb_raw_changenotify_recv(req, mem_ctx, &notify);
+			counted[i] += notify.nttrans.out.num_changes;
+		}
+
+		all_done = true;
+
+		for (i=0;i<=NOTIFY_MANY_NUM;i++) {
+			if (counted[i] != expected[i]) {
+				all_done = false;
+			}
+		}
+	} while (!all_done && timeval_elapsed(&tv) < 20);
+
+	printf("took %.4f seconds to propogate all events\n", timeval_elapsed(&tv));
+
+	for (i=0;i<=NOTIFY_MANY_NUM;i++) {
+		if (counted[i] != expected[i]) {
+			printf("ERROR: i=%d expected %d got %d\n",
+			       i, expected[i], counted[i]);
+			ret = false;
+		}
+	}
+
+done:
+	for (i=NOTIFY_MANY_NUM;i>=0;i--) {
+		if (fnums[i] != -1) {
+			smbcli_close(cli->tree, fnums[i]);
+		}
+	}
+	smbcli_deltree(cli->tree, NOTIFY_MANY_DIR);
+	smb_raw_exit(cli->session);
+	return ret;
+}
+
 /*
    Test response when cached server events exceed single NT NOTFIY response
    packet size.
@@ -1716,6 +1842,7 @@ bool torture_raw_notify(struct torture_context *torture,
 	ret &= test_notify_tcp_dis(torture);
 	ret &= test_notify_double(cli, torture);
 	ret &= test_notify_tree(cli, torture);
+	ret &= test_notify_many(cli, torture);
 	ret &= test_notify_overflow(cli, torture);
 	ret &= test_notify_basedir(cli, torture);
 	ret &= test_notify_alignment(cli, torture);
@@ -25,6 +25,7 @@
 
 #include "torture/torture.h"
 #include "torture/smb2/proto.h"
+#include "../libcli/smb/smbXcli_base.h"
 
 
 #define CHECK_STATUS(status, correct) do { \
@@ -234,6 +235,84 @@ done:
 	return ret;
 }
 
+/*
+  read and write with the largest sizes the server offers, more
+  than 64k needs multi-credit requests
+*/
+static bool test_read_large(struct torture_context *torture,
+			    struct smb2_tree *tree)
+{
+	bool ret = true;
+	NTSTATUS status;
+	struct smb2_handle h;
+	struct smb2_read rd;
+	struct smb2_write w;
+	TALLOC_CTX *tmp_ctx = talloc_new(tree);
+	struct smbXcli_conn *conn = tree->session->transport->conn;
+	uint32_t max_read, max_write, i;
+	uint8_t *buf;
+
+	max_read = smb2cli_conn_max_read_size(conn);
+	max_write = smb2cli_conn_max_write_size(conn);
+	torture_comment(torture, "max read %u, max write %u\n",
+			(unsigned)max_read, (unsigned)max_write);
+
+	if ((smb2cli_conn_server_capabilities(conn) & SMB2_CAP_LARGE_MTU) == 0) {
+		torture_skip(torture, "server does not support large MTU\n");
+	}
+
+	buf = talloc_array(tmp_ctx, uint8_t, MAX(max_read, max_write));
+	if (buf == NULL) {
+		torture_fail(torture, "out of memory");
+	}
+	for (i=0; i<max_write; i++) {
+		buf[i] = i % 251;
+	}
+
+	smb2_util_unlink(tree, FNAME);
+
+	status = torture_smb2_testfile(tree, FNAME, &h);
+	CHECK_STATUS(status, NT_STATUS_OK);
+
+	ZERO_STRUCT(w);
+	w.in.file.handle = h;
+	w.in.offset      = 0;
+	w.in.data        = data_blob_const(buf, max_write);
+	status = smb2_write(tree, &w);
+	CHECK_STATUS(status, NT_STATUS_OK);
+	CHECK_VALUE(w.out.nwritten, max_write);
+
+	ZERO_STRUCT(rd);
+	rd.in.file.handle = h;
+	rd.in.length      = MIN(max_read, max_write);
+	rd.in.offset      = 0;
+	status = smb2_read(tree, tmp_ctx, &rd);
+	CHECK_STATUS(status, NT_STATUS_OK);
+	CHECK_VALUE(rd.out.data.length, MIN(max_read, max_write));
+
+	if (memcmp(rd.out.data.data, buf, rd.out.data.length) != 0) {
+		torture_result(torture, TORTURE_FAIL,
+			       __location__ ": read data mismatch\n");
+		ret = false;
+		goto done;
+	}
+
+	/* the client sizes the charge, so many requests in a row
+	   must keep the credit window open */
+	for (i=0; i<16; i++) {
+		rd.in.offset = 0;
+		status = smb2_read(tree, tmp_ctx, &rd);
+		CHECK_STATUS(status, NT_STATUS_OK);
+		talloc_free(rd.out.data.data);
+	}
+
+done:
+	smb2_util_close(tree, h);
+	smb2_util_unlink(tree, FNAME);
+	talloc_free(tmp_ctx);
+	return ret;
+}
+
 
 /* 
    basic testing of SMB2 read
@@ -245,6 +324,7 @@ struct torture_suite *torture_smb2_read_init(void)
 	torture_suite_add_1smb2_test(suite, "eof", test_read_eof);
 	torture_suite_add_1smb2_test(suite, "position", test_read_position);
 	torture_suite_add_1smb2_test(suite, "dir", test_read_dir);
+	torture_suite_add_1smb2_test(suite, "large", test_read_large);
 
 	suite->description = talloc_strdup(suite, "SMB2-READ tests");
 